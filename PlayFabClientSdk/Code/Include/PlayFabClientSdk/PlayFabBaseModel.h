@@ -1,8 +1,12 @@
 #pragma once
 
 #include "PlayFabHttp.h"
+#include "PlayFabJsonReader.h"
+#include "PlayFabDatetime.h"
+#include "PlayFabFlatMap.h"
 #include "StdAfx.h"
 #include <list>
+#include <vector>
 #include <map>
 
 #include <AzCore/JSON/rapidjson.h>
@@ -21,6 +25,15 @@ namespace PlayFabClientSdk
     typedef rapidjson::Writer< rapidjson::GenericStringBuffer< rapidjson::UTF8<> > > PFStringJsonWriter;
     template<typename ResType> using ProcessApiCallback = void(*)(const ResType& result, void* customData);
 
+    // Type of the string keyed dictionary fields in the data models, std::map by default.
+    // Define PLAYFAB_FLAT_MAP_DICTIONARIES to use PlayFabFlatMap instead, for faster lookups. It keeps the std::map interface the models use,
+    // but iterates in insertion order, has no lower_bound, upper_bound or equal_range, and inserting or erasing invalidates iterators and references to values.
+#if defined(PLAYFAB_FLAT_MAP_DICTIONARIES)
+    template<typename ValueType> using PlayFabStringMap = PlayFabFlatMap<ValueType>;
+#else
+    template<typename ValueType> using PlayFabStringMap = std::map<AZStd::string, ValueType>;
+#endif
+
 #ifdef WIN32
     typedef signed __int64 Int64;
     typedef signed __int32 Int32;
@@ -74,10 +87,12 @@ namespace PlayFabClientSdk
         virtual ~PlayFabBaseModel() {}
         virtual void writeJSON(PFStringJsonWriter& writer) = 0;
         virtual bool readFromValue(const rapidjson::Value& obj) = 0;
+        virtual bool readFromReader(PlayFabJsonReader& reader) = 0; // Streaming equivalent of readFromValue, which consumes the value at the reader's position
 
         AZStd::string toJSONString();
 
         static bool DecodeRequest(PlayFabRequest* request);
+        static void ReadResult(PlayFabRequest* request, PlayFabBaseModel& result); // Read the data of a response which DecodeRequest accepted
     };
 
     enum MultitypeVarTypes
@@ -106,7 +121,9 @@ namespace PlayFabClientSdk
         MultitypeVar(Int32 val) : mType(MultitypeNumber), mString(), mBool(), mNumber(val) {}
         MultitypeVar(float val) : mType(MultitypeNumber), mString(), mBool(), mNumber(val) {}
         MultitypeVar(double val) : mType(MultitypeNumber), mString(), mBool(), mNumber(val) {}
-        MultitypeVar(AZStd::string val) : mType(MultitypeString), mString(val), mBool(), mNumber() {}
+        MultitypeVar(AZStd::string val) : mType(MultitypeString), mString(AZStd::move(val)), mBool(), mNumber() {}
+        MultitypeVar(const MultitypeVar& src) = default;
+        MultitypeVar(MultitypeVar&& src) noexcept : mType(src.mType), mString(AZStd::move(src.mString)), mBool(src.mBool), mNumber(src.mNumber) {}
 
         MultitypeVar(const rapidjson::Value& obj)
         {
@@ -125,7 +142,9 @@ namespace PlayFabClientSdk
         MultitypeVar& operator=(Int32 val) { mNumber = val; mType = MultitypeNumber; return *this; }
         MultitypeVar& operator=(float val) { mNumber = val; mType = MultitypeNumber; return *this; }
         MultitypeVar& operator=(double val) { mNumber = val; mType = MultitypeNumber; return *this; }
-        MultitypeVar& operator=(AZStd::string val) { mString = val; mType = MultitypeString; return *this; }
+        MultitypeVar& operator=(AZStd::string val) { mString = AZStd::move(val); mType = MultitypeString; return *this; }
+        MultitypeVar& operator=(const MultitypeVar& src) = default;
+        MultitypeVar& operator=(MultitypeVar&& src) = default;
 
         operator bool() const { return mBool; }
         operator Uint16() const { return (Uint16)mNumber; }
@@ -139,6 +158,7 @@ namespace PlayFabClientSdk
         ~MultitypeVar() {}
         void writeJSON(PFStringJsonWriter& writer) override;
         bool readFromValue(const rapidjson::Value& obj) override;
+        bool readFromReader(PlayFabJsonReader& reader) override { return readFromValue(reader.GetValue()); }
     };
 
     void writeDatetime(time_t datetime, PFStringJsonWriter& writer);
@@ -211,31 +231,31 @@ namespace PlayFabClientSdk
 
     inline void writeDatetime(time_t datetime, PFStringJsonWriter& writer)
     {
-        char buff[40];
-        strftime(buff, 40, "%Y-%m-%dT%H:%M:%S.000Z", gmtime(&datetime));
-        writer.String(buff);
+        char buff[PlayFabDatetime::FormattedLength + 1];
+        writer.String(buff, static_cast<rapidjson::SizeType>(PlayFabDatetime::Format(static_cast<AZ::s64>(datetime) * 1000, buff)));
     }
 
     inline time_t readDatetime(const rapidjson::Value& obj)
     {
-        AZStd::string enumStr = obj.GetString();
-
-        tm timeStruct = {};
-        unsigned int milliseconds = 0; // milliseconds are truncated in a standard time_t structure
-        sscanf(enumStr.c_str(), "%u-%u-%uT%u:%u%u.%uZ", &timeStruct.tm_year, &timeStruct.tm_mon, &timeStruct.tm_mday,
-            &timeStruct.tm_hour, &timeStruct.tm_min, &timeStruct.tm_sec, &milliseconds);
-        timeStruct.tm_year -= 1900;
-        timeStruct.tm_mon -= 1;
-
-        return mktime(&timeStruct);
+        // Times are UTC, and milliseconds are truncated in a standard time_t
+        AZ::s64 milliseconds = 0;
+        if (!obj.IsString() || !PlayFabDatetime::Parse(obj.GetString(), obj.GetStringLength(), milliseconds))
+            return 0;
+        return static_cast<time_t>(milliseconds >= 0 ? milliseconds / 1000 : (milliseconds - 999) / 1000);
     }
 
     inline bool PlayFabBaseModel::DecodeRequest(PlayFabRequest* request)
     {
         bool result = false;
 
+        if (request->mResponseReader != nullptr)
+        {
+            // Streamed response, see PlayFabSettings::jsonStreamingDecode. The same checks, which leave the reader on the data object.
+            PlayFabJsonReader& reader = *request->mResponseReader;
+            result = reader.IsValid() && !reader.SeekMember("errorCode") && reader.SeekMember("data") && reader.IsObject();
+        }
         // Check for bad responses
-        if (request->mResponseSize != 0 // Not a null response
+        else if (request->mResponseSize != 0 // Not a null response
             && request->mResponseJson->GetParseError() == kParseErrorNone) // Proper json response
         {
             // Check if the returned json indicates an error
@@ -253,4 +273,12 @@ namespace PlayFabClientSdk
         // API will parse the result data object into the known object type (We don't know it here)
         return result;
     }
+
+    inline void PlayFabBaseModel::ReadResult(PlayFabRequest* request, PlayFabBaseModel& result)
+    {
+        if (request->mResponseReader != nullptr)
+            result.readFromReader(*request->mResponseReader);
+        else
+            result.readFromValue(request->mResponseJson->FindMember("data")->value);
+    }
 }
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <PlayFabClientSdk/PlayFabHttp.h>
 
 namespace PlayFabClientSdk
 {
@@ -20,6 +21,12 @@ namespace PlayFabClientSdk
         virtual void SetTitleId(AZStd::string newTitleId) = 0;
         virtual AZStd::string GetTitleId() = 0;
 
+        // Client side rate limits. A rate of 0 removes the limit.
+        virtual void SetTitleRateLimit(float ratePerSecond, float burst) = 0;
+        virtual void SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst) = 0; // callPath is the api path, such as "/Server/WriteTitleEvent"
+        virtual PlayFabRateLimitState GetTitleRateLimitState() = 0;
+        virtual PlayFabRateLimitState GetEndpointRateLimitState(AZStd::string callPath) = 0;
+
     };
 
     using PlayFabClient_SettingsRequestBus = AZ::EBus<PlayFabClient_SettingsRequests>;
@@ -0,0 +1,74 @@
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <PlayFabClientSdk/PlayFabBaseModel.h>
+
+namespace PlayFabClientSdk
+{
+    // The Write*Event api a telemetry event is sent through
+    enum PlayFabTelemetryEventType
+    {
+        PlayFabTelemetryPlayerEvent,
+        PlayFabTelemetryCharacterEvent,
+        PlayFabTelemetryTitleEvent
+    };
+
+    // What happens to new events while the telemetry buffer is saturated
+    enum PlayFabTelemetryDropPolicy
+    {
+        PlayFabTelemetryDropOldest, // A new event always goes in, and the oldest waiting event is dropped when the buffer is full
+        PlayFabTelemetrySample // Once the buffer is 3/4 full, only one in sampleRate new events go in, and none once it is full
+    };
+
+    // One event waiting in the telemetry buffer. Player and character events are written for the logged in player.
+    struct PlayFabTelemetryEvent
+    {
+        PlayFabTelemetryEvent() : type(PlayFabTelemetryTitleEvent) {}
+
+        PlayFabTelemetryEventType type;
+        AZStd::string characterId; // For character events
+        AZStd::string eventName;
+        OptionalTime timestamp; // Set when the event is queued if it is not set already, as the event may be sent some time later
+        PlayFabStringMap<MultitypeVar> body;
+    };
+
+    // Telemetry pipeline counters since startup, see PlayFabClient_TelemetryRequests::GetTelemetryStats
+    struct PlayFabTelemetryStats
+    {
+        AZ::u64 producedEvents; // Every event passed to QueueTelemetryEvent
+        AZ::u64 sentEvents; // Write*Event calls made, including any which then returned an error
+        AZ::u64 failedEvents; // Calls which could not be sent, or returned an error once their retries were spent
+        AZ::u64 droppedOldest; // Waiting events dropped to make room for new ones, by PlayFabTelemetryDropOldest
+        AZ::u64 droppedSampled; // New events left out by PlayFabTelemetrySample
+        AZ::u64 droppedFull; // New events rejected because the buffer was full
+        int queuedEvents; // Waiting in the buffer
+        int capacity;
+        int inFlightEvents; // Sent and not yet completed
+    };
+
+    class PlayFabClient_TelemetryRequests
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        // Put event in the fixed size telemetry buffer, which any thread can write to without a lock. The event's strings are moved into the buffer,
+        // not copied. The flusher thread sends waiting events at the telemetry send rate, with a limit on how many are in flight at once,
+        // so telemetry never crowds out other api calls. Returns false if the event was dropped by the drop policy.
+        virtual bool QueueTelemetryEvent(PlayFabTelemetryEvent& event) = 0;
+
+        virtual void SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate) = 0;
+        virtual void SetTelemetrySendRate(float eventsPerSecond) = 0;
+        // Send waiting events now, ignoring the send rate. The in flight limit still applies, so the rest follow as earlier events complete.
+        // When the gem shuts down this is repeated until every event is sent or playfab_shutdown_flush_wait_ms passes.
+        virtual void FlushTelemetry() = 0;
+
+        virtual PlayFabTelemetryStats GetTelemetryStats() = 0;
+
+    };
+
+    using PlayFabClient_TelemetryRequestBus = AZ::EBus<PlayFabClient_TelemetryRequests>;
+} // namespace PlayFabClientSdk
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <PlayFabClientSdk/PlayFabHttp.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabClientSdk
+{
+    // Recycled buffers for response bodies, in power of two size classes from 4 KB to 4 MB.
+    // A response is read into one of these once, then parsed in place, so steady traffic reuses the same few buffers instead of allocating per response.
+    // Bodies larger than the biggest class get a buffer of their own, which is freed on release.
+    class PlayFabBufferPool
+    {
+    public:
+        // Keep at most maxBuffersPerClass free buffers of each size, extra ones are freed on release
+        explicit PlayFabBufferPool(int maxBuffersPerClass);
+        ~PlayFabBufferPool();
+
+        // Return a buffer of at least size bytes, and its actual size in capacity
+        char* Acquire(size_t size, size_t& capacity);
+        // Give back a buffer from Acquire, with the capacity Acquire returned
+        void Release(char* buffer, size_t capacity);
+
+        PlayFabResponseBufferStats GetStats();
+
+    private:
+        static const int MinSizeClassShift = 12; // 4 KB
+        static const int SizeClassCount = 11; // Up to 4 MB
+
+        // Index of the smallest class which holds size bytes, or SizeClassCount if none does
+        static int GetSizeClass(size_t size);
+
+        const size_t m_maxBuffersPerClass;
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<char*> m_freeBuffers[SizeClassCount];
+        PlayFabResponseBufferStats m_stats;
+    };
+}
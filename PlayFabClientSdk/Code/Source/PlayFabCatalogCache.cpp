@@ -0,0 +1,238 @@
+#include "StdAfx.h"
+#include "PlayFabCatalogCache.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabClientSdk;
+
+PlayFabCatalogCache* PlayFabCatalogCache::catalogCache = nullptr;
+
+namespace
+{
+    const size_t SmallStringCapacity = 15; // Strings up to this long are stored inside the string object
+
+    AZ::u64 StringBytes(const AZStd::string& text)
+    {
+        return text.capacity() > SmallStringCapacity ? text.capacity() + 1 : 0;
+    }
+
+    AZ::u64 StringListBytes(const std::vector<AZStd::string>& texts)
+    {
+        AZ::u64 bytes = texts.capacity() * sizeof(AZStd::string);
+        for (const AZStd::string& text : texts)
+            bytes += StringBytes(text);
+        return bytes;
+    }
+
+    AZ::u64 CurrencyMapBytes(const PlayFabStringMap<Uint32>& amounts)
+    {
+        AZ::u64 bytes = amounts.size() * sizeof(PlayFabStringMap<Uint32>::value_type);
+        for (const auto& amount : amounts)
+            bytes += StringBytes(amount.first);
+        return bytes;
+    }
+
+    AZ::u64 IndexBytes(const PlayFabFlatMap<AZStd::vector<AZ::u32>>& index)
+    {
+        AZ::u64 bytes = index.GetAllocatedBytes();
+        for (const auto& entry : index)
+            bytes += StringBytes(entry.first) + entry.second.capacity() * sizeof(AZ::u32);
+        return bytes;
+    }
+}
+
+PlayFabCatalogCache::PlayFabCatalogCache(FetchFunction fetchFunction, int refreshIntervalSeconds)
+    : m_fetchFunction(fetchFunction)
+    , m_published(AZStd::make_shared<const SnapshotSet>())
+    , m_refreshIntervalSeconds(AZStd::GetMax(refreshIntervalSeconds, 1))
+{
+    AZ::TickBus::Handler::BusConnect();
+}
+
+PlayFabCatalogCache::~PlayFabCatalogCache()
+{
+    AZ::TickBus::Handler::BusDisconnect();
+}
+
+void PlayFabCatalogCache::Start(const AZStd::string& catalogVersion)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabFlatMap<CatalogState>::iterator found = m_catalogs.find(catalogVersion);
+    if (found == m_catalogs.end())
+    {
+        CatalogState state = {};
+        found = m_catalogs.insert(PlayFabFlatMap<CatalogState>::value_type(catalogVersion, state)).first;
+    }
+    found->second.active = true;
+    found->second.refreshRequested = true;
+}
+
+void PlayFabCatalogCache::Stop(const AZStd::string& catalogVersion)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabFlatMap<CatalogState>::iterator found = m_catalogs.find(catalogVersion);
+    if (found != m_catalogs.end())
+    {
+        found->second.active = false;
+        found->second.refreshRequested = false;
+    }
+}
+
+void PlayFabCatalogCache::Refresh(const AZStd::string& catalogVersion)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabFlatMap<CatalogState>::iterator found = m_catalogs.find(catalogVersion);
+    if (found != m_catalogs.end())
+        found->second.refreshRequested = true;
+}
+
+void PlayFabCatalogCache::SetRefreshInterval(int seconds)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_refreshIntervalSeconds = AZStd::GetMax(seconds, 1);
+}
+
+PlayFabCatalogCacheStats PlayFabCatalogCache::GetStats(const AZStd::string& catalogVersion)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabFlatMap<CatalogState>::const_iterator found = m_catalogs.find(catalogVersion);
+    if (found == m_catalogs.end())
+        return PlayFabCatalogCacheStats();
+    return found->second.stats;
+}
+
+void PlayFabCatalogCache::Update(AZStd::chrono::system_clock::time_point now)
+{
+    AZStd::vector<AZStd::string> due;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (auto& entry : m_catalogs)
+        {
+            CatalogState& state = entry.second;
+            if (state.active && !state.fetching && (state.refreshRequested || now >= state.nextRefreshTime))
+            {
+                state.fetching = true;
+                state.refreshRequested = false;
+                due.push_back(entry.first);
+            }
+        }
+    }
+
+    // Sent outside the lock, as a request rejected by the rate limiter fails straight away
+    for (const AZStd::string& catalogVersion : due)
+    {
+        if (!m_fetchFunction(catalogVersion))
+            ApplyFetchFailure(catalogVersion);
+    }
+}
+
+void PlayFabCatalogCache::ApplyFetchResult(const AZStd::string& catalogVersion, std::vector<PlayFabCatalogItem>&& catalog)
+{
+    // Indexed before taking the lock, as this is the expensive part for a large catalog
+    PlayFabCatalogCacheStats built = {};
+    AZStd::shared_ptr<PlayFabCatalogSnapshot> snapshot = BuildSnapshot(catalogVersion, AZStd::move(catalog), built);
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabFlatMap<CatalogState>::iterator found = m_catalogs.find(catalogVersion);
+    if (found == m_catalogs.end())
+    {
+        CatalogState state = {};
+        found = m_catalogs.insert(PlayFabFlatMap<CatalogState>::value_type(catalogVersion, state)).first;
+    }
+    CatalogState& state = found->second;
+    state.fetching = false;
+    state.nextRefreshTime = snapshot->fetchedTime + AZStd::chrono::seconds(m_refreshIntervalSeconds);
+    built.refreshes = state.stats.refreshes + 1;
+    built.failedRefreshes = state.stats.failedRefreshes;
+    state.stats = built;
+
+    // The other catalog versions are shared with the new set, only this one's snapshot is replaced
+    AZStd::shared_ptr<SnapshotSet> set = AZStd::make_shared<SnapshotSet>(*m_published.Get());
+    PlayFabCatalogSnapshotPtr& entry = (*set)[catalogVersion];
+    snapshot->version = entry != nullptr ? entry->version + 1 : 1;
+    entry = snapshot;
+    m_published.Publish(set);
+}
+
+void PlayFabCatalogCache::ApplyFetchFailure(const AZStd::string& catalogVersion)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabFlatMap<CatalogState>::iterator found = m_catalogs.find(catalogVersion);
+    if (found == m_catalogs.end())
+        return;
+    found->second.fetching = false;
+    found->second.nextRefreshTime = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(AZStd::GetMin(m_refreshIntervalSeconds, static_cast<int>(FailureRetrySeconds)));
+    found->second.stats.failedRefreshes++;
+}
+
+AZStd::shared_ptr<PlayFabCatalogSnapshot> PlayFabCatalogCache::BuildSnapshot(const AZStd::string& catalogVersion, std::vector<PlayFabCatalogItem>&& catalog, PlayFabCatalogCacheStats& stats)
+{
+    auto start = AZStd::chrono::system_clock::now();
+    AZStd::shared_ptr<PlayFabCatalogSnapshot> snapshot = AZStd::make_shared<PlayFabCatalogSnapshot>();
+    snapshot->catalogVersion = catalogVersion;
+    snapshot->fetchedTime = start;
+    snapshot->items = AZStd::move(catalog);
+
+    const std::vector<PlayFabCatalogItem>& items = snapshot->items;
+    snapshot->itemIndex.reserve(items.size());
+    for (AZ::u32 i = 0; i < items.size(); ++i)
+    {
+        const PlayFabCatalogItem& item = items[i];
+        snapshot->itemIndex.insert(PlayFabFlatMap<AZ::u32>::value_type(item.ItemId, i));
+        if (!item.ItemClass.empty())
+            snapshot->classIndex[item.ItemClass].push_back(i);
+        for (const AZStd::string& tag : item.Tags)
+            snapshot->tagIndex[tag].push_back(i);
+    }
+    stats.buildUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start).count();
+
+    // Every item looked up once, which also finds ItemIds used more than once (only the first is indexed)
+    size_t indexed = 0;
+    auto lookupStart = AZStd::chrono::system_clock::now();
+    for (const PlayFabCatalogItem& item : items)
+        indexed += snapshot->FindItem(item.ItemId.c_str()) == &item;
+    AZ::u64 lookupNs = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::system_clock::now() - lookupStart).count();
+    if (indexed != items.size())
+        AZ_TracePrintf("PlayFab", "*** PlayFab Catalog %s has %d items with an ItemId used by an earlier item, which cannot be looked up by ItemId", catalogVersion.c_str(), static_cast<int>(items.size() - indexed));
+
+    AZ::u64 memoryBytes = sizeof(PlayFabCatalogSnapshot) + items.capacity() * sizeof(PlayFabCatalogItem);
+    for (const PlayFabCatalogItem& item : items)
+        memoryBytes += EstimateItemBytes(item);
+    memoryBytes += snapshot->itemIndex.GetAllocatedBytes();
+    for (const auto& entry : snapshot->itemIndex)
+        memoryBytes += StringBytes(entry.first);
+    memoryBytes += IndexBytes(snapshot->classIndex) + IndexBytes(snapshot->tagIndex);
+
+    stats.itemCount = static_cast<int>(items.size());
+    stats.classCount = static_cast<int>(snapshot->classIndex.size());
+    stats.tagCount = static_cast<int>(snapshot->tagIndex.size());
+    stats.memoryBytes = memoryBytes;
+    stats.lookupNs = items.empty() ? 0.0f : static_cast<float>(lookupNs) / items.size();
+    return snapshot;
+}
+
+AZ::u64 PlayFabCatalogCache::EstimateItemBytes(const PlayFabCatalogItem& item)
+{
+    // Memory the item owns outside its own object
+    AZ::u64 bytes = StringBytes(item.ItemId) + StringBytes(item.ItemClass) + StringBytes(item.CatalogVersion) + StringBytes(item.DisplayName)
+        + StringBytes(item.Description) + StringBytes(item.CustomData) + StringBytes(item.ItemImageUrl)
+        + CurrencyMapBytes(item.VirtualCurrencyPrices) + CurrencyMapBytes(item.RealCurrencyPrices) + StringListBytes(item.Tags);
+    if (item.Consumable != nullptr)
+        bytes += sizeof(*item.Consumable) + StringBytes(item.Consumable->UsagePeriodGroup);
+    if (item.Container != nullptr)
+        bytes += sizeof(*item.Container) + StringBytes(item.Container->KeyItemId) + StringListBytes(item.Container->ItemContents)
+            + StringListBytes(item.Container->ResultTableContents) + CurrencyMapBytes(item.Container->VirtualCurrencyContents);
+    if (item.Bundle != nullptr)
+        bytes += sizeof(*item.Bundle) + StringListBytes(item.Bundle->BundledItems) + StringListBytes(item.Bundle->BundledResultTables)
+            + CurrencyMapBytes(item.Bundle->BundledVirtualCurrencies);
+    return bytes;
+}
+
+void PlayFabCatalogCache::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+{
+    (void)deltaTime;
+    (void)time;
+    Update(AZStd::chrono::system_clock::now());
+}
@@ -3,6 +3,7 @@
 #include <PlayFabClientSdk/PlayFabError.h>
 #include <PlayFabClientSdk/PlayFabClientDataModels.h>
 #include <PlayFabClientSdk/PlayFabHttp.h>
+#include <PlayFabClientSdk/PlayFabLazyModel.h>
 
 namespace PlayFabClientSdk
 {
@@ -15,136 +16,264 @@ namespace PlayFabClientSdk
         static void ForgetClientCredentials();  // #THIRD_KIND_PLAYFAB_SHUTDOWN_FIXES: - Added a logout function so that the statics can be destroyed before the system allocator.
 
         // ------------ Generated Api calls
-        static void GetPhotonAuthenticationToken(ClientModels::GetPhotonAuthenticationTokenRequest& request, ProcessApiCallback<ClientModels::GetPhotonAuthenticationTokenResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitlePublicKey(ClientModels::GetTitlePublicKeyRequest& request, ProcessApiCallback<ClientModels::GetTitlePublicKeyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetWindowsHelloChallenge(ClientModels::GetWindowsHelloChallengeRequest& request, ProcessApiCallback<ClientModels::GetWindowsHelloChallengeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithAndroidDeviceID(ClientModels::LoginWithAndroidDeviceIDRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithCustomID(ClientModels::LoginWithCustomIDRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithEmailAddress(ClientModels::LoginWithEmailAddressRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithFacebook(ClientModels::LoginWithFacebookRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithGameCenter(ClientModels::LoginWithGameCenterRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithGoogleAccount(ClientModels::LoginWithGoogleAccountRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithIOSDeviceID(ClientModels::LoginWithIOSDeviceIDRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithKongregate(ClientModels::LoginWithKongregateRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithPlayFab(ClientModels::LoginWithPlayFabRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithSteam(ClientModels::LoginWithSteamRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithTwitch(ClientModels::LoginWithTwitchRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LoginWithWindowsHello(ClientModels::LoginWithWindowsHelloRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RegisterPlayFabUser(ClientModels::RegisterPlayFabUserRequest& request, ProcessApiCallback<ClientModels::RegisterPlayFabUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RegisterWithWindowsHello(ClientModels::RegisterWithWindowsHelloRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetPlayerSecret(ClientModels::SetPlayerSecretRequest& request, ProcessApiCallback<ClientModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddGenericID(ClientModels::AddGenericIDRequest& request, ProcessApiCallback<ClientModels::AddGenericIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddUsernamePassword(ClientModels::AddUsernamePasswordRequest& request, ProcessApiCallback<ClientModels::AddUsernamePasswordResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAccountInfo(ClientModels::GetAccountInfoRequest& request, ProcessApiCallback<ClientModels::GetAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerCombinedInfo(ClientModels::GetPlayerCombinedInfoRequest& request, ProcessApiCallback<ClientModels::GetPlayerCombinedInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerProfile(ClientModels::GetPlayerProfileRequest& request, ProcessApiCallback<ClientModels::GetPlayerProfileResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromFacebookIDs(ClientModels::GetPlayFabIDsFromFacebookIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromFacebookIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromGameCenterIDs(ClientModels::GetPlayFabIDsFromGameCenterIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGameCenterIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromGenericIDs(ClientModels::GetPlayFabIDsFromGenericIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGenericIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromGoogleIDs(ClientModels::GetPlayFabIDsFromGoogleIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGoogleIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromKongregateIDs(ClientModels::GetPlayFabIDsFromKongregateIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromKongregateIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromSteamIDs(ClientModels::GetPlayFabIDsFromSteamIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromSteamIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromTwitchIDs(ClientModels::GetPlayFabIDsFromTwitchIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromTwitchIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkAndroidDeviceID(ClientModels::LinkAndroidDeviceIDRequest& request, ProcessApiCallback<ClientModels::LinkAndroidDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkCustomID(ClientModels::LinkCustomIDRequest& request, ProcessApiCallback<ClientModels::LinkCustomIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkFacebookAccount(ClientModels::LinkFacebookAccountRequest& request, ProcessApiCallback<ClientModels::LinkFacebookAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkGameCenterAccount(ClientModels::LinkGameCenterAccountRequest& request, ProcessApiCallback<ClientModels::LinkGameCenterAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkGoogleAccount(ClientModels::LinkGoogleAccountRequest& request, ProcessApiCallback<ClientModels::LinkGoogleAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkIOSDeviceID(ClientModels::LinkIOSDeviceIDRequest& request, ProcessApiCallback<ClientModels::LinkIOSDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkKongregate(ClientModels::LinkKongregateAccountRequest& request, ProcessApiCallback<ClientModels::LinkKongregateAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkSteamAccount(ClientModels::LinkSteamAccountRequest& request, ProcessApiCallback<ClientModels::LinkSteamAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkTwitch(ClientModels::LinkTwitchAccountRequest& request, ProcessApiCallback<ClientModels::LinkTwitchAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void LinkWindowsHello(ClientModels::LinkWindowsHelloAccountRequest& request, ProcessApiCallback<ClientModels::LinkWindowsHelloAccountResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveGenericID(ClientModels::RemoveGenericIDRequest& request, ProcessApiCallback<ClientModels::RemoveGenericIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ReportPlayer(ClientModels::ReportPlayerClientRequest& request, ProcessApiCallback<ClientModels::ReportPlayerClientResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SendAccountRecoveryEmail(ClientModels::SendAccountRecoveryEmailRequest& request, ProcessApiCallback<ClientModels::SendAccountRecoveryEmailResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkAndroidDeviceID(ClientModels::UnlinkAndroidDeviceIDRequest& request, ProcessApiCallback<ClientModels::UnlinkAndroidDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkCustomID(ClientModels::UnlinkCustomIDRequest& request, ProcessApiCallback<ClientModels::UnlinkCustomIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkFacebookAccount(ProcessApiCallback<ClientModels::UnlinkFacebookAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkGameCenterAccount(ProcessApiCallback<ClientModels::UnlinkGameCenterAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkGoogleAccount(ProcessApiCallback<ClientModels::UnlinkGoogleAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkIOSDeviceID(ClientModels::UnlinkIOSDeviceIDRequest& request, ProcessApiCallback<ClientModels::UnlinkIOSDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkKongregate(ProcessApiCallback<ClientModels::UnlinkKongregateAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkSteamAccount(ProcessApiCallback<ClientModels::UnlinkSteamAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkTwitch(ProcessApiCallback<ClientModels::UnlinkTwitchAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlinkWindowsHello(ClientModels::UnlinkWindowsHelloAccountRequest& request, ProcessApiCallback<ClientModels::UnlinkWindowsHelloAccountResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateAvatarUrl(ClientModels::UpdateAvatarUrlRequest& request, ProcessApiCallback<ClientModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserTitleDisplayName(ClientModels::UpdateUserTitleDisplayNameRequest& request, ProcessApiCallback<ClientModels::UpdateUserTitleDisplayNameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetFriendLeaderboard(ClientModels::GetFriendLeaderboardRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetFriendLeaderboardAroundPlayer(ClientModels::GetFriendLeaderboardAroundPlayerRequest& request, ProcessApiCallback<ClientModels::GetFriendLeaderboardAroundPlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboard(ClientModels::GetLeaderboardRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboardAroundPlayer(ClientModels::GetLeaderboardAroundPlayerRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardAroundPlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerStatistics(ClientModels::GetPlayerStatisticsRequest& request, ProcessApiCallback<ClientModels::GetPlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerStatisticVersions(ClientModels::GetPlayerStatisticVersionsRequest& request, ProcessApiCallback<ClientModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherReadOnlyData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserReadOnlyData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdatePlayerStatistics(ClientModels::UpdatePlayerStatisticsRequest& request, ProcessApiCallback<ClientModels::UpdatePlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserData(ClientModels::UpdateUserDataRequest& request, ProcessApiCallback<ClientModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherData(ClientModels::UpdateUserDataRequest& request, ProcessApiCallback<ClientModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCatalogItems(ClientModels::GetCatalogItemsRequest& request, ProcessApiCallback<ClientModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPublisherData(ClientModels::GetPublisherDataRequest& request, ProcessApiCallback<ClientModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetStoreItems(ClientModels::GetStoreItemsRequest& request, ProcessApiCallback<ClientModels::GetStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTime(ProcessApiCallback<ClientModels::GetTimeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleData(ClientModels::GetTitleDataRequest& request, ProcessApiCallback<ClientModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleNews(ClientModels::GetTitleNewsRequest& request, ProcessApiCallback<ClientModels::GetTitleNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddUserVirtualCurrency(ClientModels::AddUserVirtualCurrencyRequest& request, ProcessApiCallback<ClientModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ConfirmPurchase(ClientModels::ConfirmPurchaseRequest& request, ProcessApiCallback<ClientModels::ConfirmPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ConsumeItem(ClientModels::ConsumeItemRequest& request, ProcessApiCallback<ClientModels::ConsumeItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterInventory(ClientModels::GetCharacterInventoryRequest& request, ProcessApiCallback<ClientModels::GetCharacterInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPurchase(ClientModels::GetPurchaseRequest& request, ProcessApiCallback<ClientModels::GetPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserInventory(ProcessApiCallback<ClientModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void PayForPurchase(ClientModels::PayForPurchaseRequest& request, ProcessApiCallback<ClientModels::PayForPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void PurchaseItem(ClientModels::PurchaseItemRequest& request, ProcessApiCallback<ClientModels::PurchaseItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RedeemCoupon(ClientModels::RedeemCouponRequest& request, ProcessApiCallback<ClientModels::RedeemCouponResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void StartPurchase(ClientModels::StartPurchaseRequest& request, ProcessApiCallback<ClientModels::StartPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SubtractUserVirtualCurrency(ClientModels::SubtractUserVirtualCurrencyRequest& request, ProcessApiCallback<ClientModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlockContainerInstance(ClientModels::UnlockContainerInstanceRequest& request, ProcessApiCallback<ClientModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlockContainerItem(ClientModels::UnlockContainerItemRequest& request, ProcessApiCallback<ClientModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddFriend(ClientModels::AddFriendRequest& request, ProcessApiCallback<ClientModels::AddFriendResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetFriendsList(ClientModels::GetFriendsListRequest& request, ProcessApiCallback<ClientModels::GetFriendsListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveFriend(ClientModels::RemoveFriendRequest& request, ProcessApiCallback<ClientModels::RemoveFriendResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetFriendTags(ClientModels::SetFriendTagsRequest& request, ProcessApiCallback<ClientModels::SetFriendTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCurrentGames(ClientModels::CurrentGamesRequest& request, ProcessApiCallback<ClientModels::CurrentGamesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetGameServerRegions(ClientModels::GameServerRegionsRequest& request, ProcessApiCallback<ClientModels::GameServerRegionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void Matchmake(ClientModels::MatchmakeRequest& request, ProcessApiCallback<ClientModels::MatchmakeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void StartGame(ClientModels::StartGameRequest& request, ProcessApiCallback<ClientModels::StartGameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void WriteCharacterEvent(ClientModels::WriteClientCharacterEventRequest& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void WritePlayerEvent(ClientModels::WriteClientPlayerEventRequest& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void WriteTitleEvent(ClientModels::WriteTitleEventRequest& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddSharedGroupMembers(ClientModels::AddSharedGroupMembersRequest& request, ProcessApiCallback<ClientModels::AddSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void CreateSharedGroup(ClientModels::CreateSharedGroupRequest& request, ProcessApiCallback<ClientModels::CreateSharedGroupResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetSharedGroupData(ClientModels::GetSharedGroupDataRequest& request, ProcessApiCallback<ClientModels::GetSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveSharedGroupMembers(ClientModels::RemoveSharedGroupMembersRequest& request, ProcessApiCallback<ClientModels::RemoveSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateSharedGroupData(ClientModels::UpdateSharedGroupDataRequest& request, ProcessApiCallback<ClientModels::UpdateSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ExecuteCloudScript(ClientModels::ExecuteCloudScriptRequest& request, ProcessApiCallback<ClientModels::ExecuteCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetContentDownloadUrl(ClientModels::GetContentDownloadUrlRequest& request, ProcessApiCallback<ClientModels::GetContentDownloadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAllUsersCharacters(ClientModels::ListUsersCharactersRequest& request, ProcessApiCallback<ClientModels::ListUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterLeaderboard(ClientModels::GetCharacterLeaderboardRequest& request, ProcessApiCallback<ClientModels::GetCharacterLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterStatistics(ClientModels::GetCharacterStatisticsRequest& request, ProcessApiCallback<ClientModels::GetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboardAroundCharacter(ClientModels::GetLeaderboardAroundCharacterRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardAroundCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboardForUserCharacters(ClientModels::GetLeaderboardForUsersCharactersRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardForUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GrantCharacterToUser(ClientModels::GrantCharacterToUserRequest& request, ProcessApiCallback<ClientModels::GrantCharacterToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCharacterStatistics(ClientModels::UpdateCharacterStatisticsRequest& request, ProcessApiCallback<ClientModels::UpdateCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterData(ClientModels::GetCharacterDataRequest& request, ProcessApiCallback<ClientModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterReadOnlyData(ClientModels::GetCharacterDataRequest& request, ProcessApiCallback<ClientModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCharacterData(ClientModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ClientModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AcceptTrade(ClientModels::AcceptTradeRequest& request, ProcessApiCallback<ClientModels::AcceptTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void CancelTrade(ClientModels::CancelTradeRequest& request, ProcessApiCallback<ClientModels::CancelTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerTrades(ClientModels::GetPlayerTradesRequest& request, ProcessApiCallback<ClientModels::GetPlayerTradesResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTradeStatus(ClientModels::GetTradeStatusRequest& request, ProcessApiCallback<ClientModels::GetTradeStatusResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void OpenTrade(ClientModels::OpenTradeRequest& request, ProcessApiCallback<ClientModels::OpenTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AttributeInstall(ClientModels::AttributeInstallRequest& request, ProcessApiCallback<ClientModels::AttributeInstallResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerSegments(ProcessApiCallback<ClientModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerTags(ClientModels::GetPlayerTagsRequest& request, ProcessApiCallback<ClientModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AndroidDevicePushNotificationRegistration(ClientModels::AndroidDevicePushNotificationRegistrationRequest& request, ProcessApiCallback<ClientModels::AndroidDevicePushNotificationRegistrationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RegisterForIOSPushNotification(ClientModels::RegisterForIOSPushNotificationRequest& request, ProcessApiCallback<ClientModels::RegisterForIOSPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RestoreIOSPurchases(ClientModels::RestoreIOSPurchasesRequest& request, ProcessApiCallback<ClientModels::RestoreIOSPurchasesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ValidateAmazonIAPReceipt(ClientModels::ValidateAmazonReceiptRequest& request, ProcessApiCallback<ClientModels::ValidateAmazonReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ValidateGooglePlayPurchase(ClientModels::ValidateGooglePlayPurchaseRequest& request, ProcessApiCallback<ClientModels::ValidateGooglePlayPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ValidateIOSReceipt(ClientModels::ValidateIOSReceiptRequest& request, ProcessApiCallback<ClientModels::ValidateIOSReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ValidateWindowsStoreReceipt(ClientModels::ValidateWindowsReceiptRequest& request, ProcessApiCallback<ClientModels::ValidateWindowsReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+        static void GetPhotonAuthenticationToken(ClientModels::GetPhotonAuthenticationTokenRequest& request, ProcessApiCallback<ClientModels::GetPhotonAuthenticationTokenResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitlePublicKey(ClientModels::GetTitlePublicKeyRequest& request, ProcessApiCallback<ClientModels::GetTitlePublicKeyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetWindowsHelloChallenge(ClientModels::GetWindowsHelloChallengeRequest& request, ProcessApiCallback<ClientModels::GetWindowsHelloChallengeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithAndroidDeviceID(ClientModels::LoginWithAndroidDeviceIDRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithCustomID(ClientModels::LoginWithCustomIDRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithEmailAddress(ClientModels::LoginWithEmailAddressRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithFacebook(ClientModels::LoginWithFacebookRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithGameCenter(ClientModels::LoginWithGameCenterRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithGoogleAccount(ClientModels::LoginWithGoogleAccountRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithIOSDeviceID(ClientModels::LoginWithIOSDeviceIDRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithKongregate(ClientModels::LoginWithKongregateRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithPlayFab(ClientModels::LoginWithPlayFabRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithSteam(ClientModels::LoginWithSteamRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithTwitch(ClientModels::LoginWithTwitchRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LoginWithWindowsHello(ClientModels::LoginWithWindowsHelloRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RegisterPlayFabUser(ClientModels::RegisterPlayFabUserRequest& request, ProcessApiCallback<ClientModels::RegisterPlayFabUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RegisterWithWindowsHello(ClientModels::RegisterWithWindowsHelloRequest& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetPlayerSecret(ClientModels::SetPlayerSecretRequest& request, ProcessApiCallback<ClientModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddGenericID(ClientModels::AddGenericIDRequest& request, ProcessApiCallback<ClientModels::AddGenericIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddUsernamePassword(ClientModels::AddUsernamePasswordRequest& request, ProcessApiCallback<ClientModels::AddUsernamePasswordResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAccountInfo(ClientModels::GetAccountInfoRequest& request, ProcessApiCallback<ClientModels::GetAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerCombinedInfo(ClientModels::GetPlayerCombinedInfoRequest& request, ProcessApiCallback<ClientModels::GetPlayerCombinedInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerProfile(ClientModels::GetPlayerProfileRequest& request, ProcessApiCallback<ClientModels::GetPlayerProfileResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromFacebookIDs(ClientModels::GetPlayFabIDsFromFacebookIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromFacebookIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromGameCenterIDs(ClientModels::GetPlayFabIDsFromGameCenterIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGameCenterIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromGenericIDs(ClientModels::GetPlayFabIDsFromGenericIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGenericIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromGoogleIDs(ClientModels::GetPlayFabIDsFromGoogleIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGoogleIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromKongregateIDs(ClientModels::GetPlayFabIDsFromKongregateIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromKongregateIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromSteamIDs(ClientModels::GetPlayFabIDsFromSteamIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromSteamIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromTwitchIDs(ClientModels::GetPlayFabIDsFromTwitchIDsRequest& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromTwitchIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkAndroidDeviceID(ClientModels::LinkAndroidDeviceIDRequest& request, ProcessApiCallback<ClientModels::LinkAndroidDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkCustomID(ClientModels::LinkCustomIDRequest& request, ProcessApiCallback<ClientModels::LinkCustomIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkFacebookAccount(ClientModels::LinkFacebookAccountRequest& request, ProcessApiCallback<ClientModels::LinkFacebookAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkGameCenterAccount(ClientModels::LinkGameCenterAccountRequest& request, ProcessApiCallback<ClientModels::LinkGameCenterAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkGoogleAccount(ClientModels::LinkGoogleAccountRequest& request, ProcessApiCallback<ClientModels::LinkGoogleAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkIOSDeviceID(ClientModels::LinkIOSDeviceIDRequest& request, ProcessApiCallback<ClientModels::LinkIOSDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkKongregate(ClientModels::LinkKongregateAccountRequest& request, ProcessApiCallback<ClientModels::LinkKongregateAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkSteamAccount(ClientModels::LinkSteamAccountRequest& request, ProcessApiCallback<ClientModels::LinkSteamAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkTwitch(ClientModels::LinkTwitchAccountRequest& request, ProcessApiCallback<ClientModels::LinkTwitchAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void LinkWindowsHello(ClientModels::LinkWindowsHelloAccountRequest& request, ProcessApiCallback<ClientModels::LinkWindowsHelloAccountResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveGenericID(ClientModels::RemoveGenericIDRequest& request, ProcessApiCallback<ClientModels::RemoveGenericIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ReportPlayer(ClientModels::ReportPlayerClientRequest& request, ProcessApiCallback<ClientModels::ReportPlayerClientResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SendAccountRecoveryEmail(ClientModels::SendAccountRecoveryEmailRequest& request, ProcessApiCallback<ClientModels::SendAccountRecoveryEmailResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkAndroidDeviceID(ClientModels::UnlinkAndroidDeviceIDRequest& request, ProcessApiCallback<ClientModels::UnlinkAndroidDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkCustomID(ClientModels::UnlinkCustomIDRequest& request, ProcessApiCallback<ClientModels::UnlinkCustomIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkFacebookAccount(ProcessApiCallback<ClientModels::UnlinkFacebookAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkGameCenterAccount(ProcessApiCallback<ClientModels::UnlinkGameCenterAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkGoogleAccount(ProcessApiCallback<ClientModels::UnlinkGoogleAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkIOSDeviceID(ClientModels::UnlinkIOSDeviceIDRequest& request, ProcessApiCallback<ClientModels::UnlinkIOSDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkKongregate(ProcessApiCallback<ClientModels::UnlinkKongregateAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkSteamAccount(ProcessApiCallback<ClientModels::UnlinkSteamAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkTwitch(ProcessApiCallback<ClientModels::UnlinkTwitchAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlinkWindowsHello(ClientModels::UnlinkWindowsHelloAccountRequest& request, ProcessApiCallback<ClientModels::UnlinkWindowsHelloAccountResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateAvatarUrl(ClientModels::UpdateAvatarUrlRequest& request, ProcessApiCallback<ClientModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserTitleDisplayName(ClientModels::UpdateUserTitleDisplayNameRequest& request, ProcessApiCallback<ClientModels::UpdateUserTitleDisplayNameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetFriendLeaderboard(ClientModels::GetFriendLeaderboardRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetFriendLeaderboardAroundPlayer(ClientModels::GetFriendLeaderboardAroundPlayerRequest& request, ProcessApiCallback<ClientModels::GetFriendLeaderboardAroundPlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboard(ClientModels::GetLeaderboardRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboardAroundPlayer(ClientModels::GetLeaderboardAroundPlayerRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardAroundPlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerStatistics(ClientModels::GetPlayerStatisticsRequest& request, ProcessApiCallback<ClientModels::GetPlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerStatisticVersions(ClientModels::GetPlayerStatisticVersionsRequest& request, ProcessApiCallback<ClientModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherReadOnlyData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserReadOnlyData(ClientModels::GetUserDataRequest& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdatePlayerStatistics(ClientModels::UpdatePlayerStatisticsRequest& request, ProcessApiCallback<ClientModels::UpdatePlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserData(ClientModels::UpdateUserDataRequest& request, ProcessApiCallback<ClientModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherData(ClientModels::UpdateUserDataRequest& request, ProcessApiCallback<ClientModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCatalogItems(ClientModels::GetCatalogItemsRequest& request, ProcessApiCallback<ClientModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPublisherData(ClientModels::GetPublisherDataRequest& request, ProcessApiCallback<ClientModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetStoreItems(ClientModels::GetStoreItemsRequest& request, ProcessApiCallback<ClientModels::GetStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTime(ProcessApiCallback<ClientModels::GetTimeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleData(ClientModels::GetTitleDataRequest& request, ProcessApiCallback<ClientModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleNews(ClientModels::GetTitleNewsRequest& request, ProcessApiCallback<ClientModels::GetTitleNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddUserVirtualCurrency(ClientModels::AddUserVirtualCurrencyRequest& request, ProcessApiCallback<ClientModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ConfirmPurchase(ClientModels::ConfirmPurchaseRequest& request, ProcessApiCallback<ClientModels::ConfirmPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ConsumeItem(ClientModels::ConsumeItemRequest& request, ProcessApiCallback<ClientModels::ConsumeItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterInventory(ClientModels::GetCharacterInventoryRequest& request, ProcessApiCallback<ClientModels::GetCharacterInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPurchase(ClientModels::GetPurchaseRequest& request, ProcessApiCallback<ClientModels::GetPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInventory(ProcessApiCallback<ClientModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void PayForPurchase(ClientModels::PayForPurchaseRequest& request, ProcessApiCallback<ClientModels::PayForPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void PurchaseItem(ClientModels::PurchaseItemRequest& request, ProcessApiCallback<ClientModels::PurchaseItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RedeemCoupon(ClientModels::RedeemCouponRequest& request, ProcessApiCallback<ClientModels::RedeemCouponResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void StartPurchase(ClientModels::StartPurchaseRequest& request, ProcessApiCallback<ClientModels::StartPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SubtractUserVirtualCurrency(ClientModels::SubtractUserVirtualCurrencyRequest& request, ProcessApiCallback<ClientModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlockContainerInstance(ClientModels::UnlockContainerInstanceRequest& request, ProcessApiCallback<ClientModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlockContainerItem(ClientModels::UnlockContainerItemRequest& request, ProcessApiCallback<ClientModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddFriend(ClientModels::AddFriendRequest& request, ProcessApiCallback<ClientModels::AddFriendResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetFriendsList(ClientModels::GetFriendsListRequest& request, ProcessApiCallback<ClientModels::GetFriendsListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveFriend(ClientModels::RemoveFriendRequest& request, ProcessApiCallback<ClientModels::RemoveFriendResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetFriendTags(ClientModels::SetFriendTagsRequest& request, ProcessApiCallback<ClientModels::SetFriendTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCurrentGames(ClientModels::CurrentGamesRequest& request, ProcessApiCallback<ClientModels::CurrentGamesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetGameServerRegions(ClientModels::GameServerRegionsRequest& request, ProcessApiCallback<ClientModels::GameServerRegionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void Matchmake(ClientModels::MatchmakeRequest& request, ProcessApiCallback<ClientModels::MatchmakeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void StartGame(ClientModels::StartGameRequest& request, ProcessApiCallback<ClientModels::StartGameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void WriteCharacterEvent(ClientModels::WriteClientCharacterEventRequest& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void WritePlayerEvent(ClientModels::WriteClientPlayerEventRequest& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void WriteTitleEvent(ClientModels::WriteTitleEventRequest& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddSharedGroupMembers(ClientModels::AddSharedGroupMembersRequest& request, ProcessApiCallback<ClientModels::AddSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void CreateSharedGroup(ClientModels::CreateSharedGroupRequest& request, ProcessApiCallback<ClientModels::CreateSharedGroupResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetSharedGroupData(ClientModels::GetSharedGroupDataRequest& request, ProcessApiCallback<ClientModels::GetSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveSharedGroupMembers(ClientModels::RemoveSharedGroupMembersRequest& request, ProcessApiCallback<ClientModels::RemoveSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateSharedGroupData(ClientModels::UpdateSharedGroupDataRequest& request, ProcessApiCallback<ClientModels::UpdateSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ExecuteCloudScript(ClientModels::ExecuteCloudScriptRequest& request, ProcessApiCallback<ClientModels::ExecuteCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetContentDownloadUrl(ClientModels::GetContentDownloadUrlRequest& request, ProcessApiCallback<ClientModels::GetContentDownloadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAllUsersCharacters(ClientModels::ListUsersCharactersRequest& request, ProcessApiCallback<ClientModels::ListUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterLeaderboard(ClientModels::GetCharacterLeaderboardRequest& request, ProcessApiCallback<ClientModels::GetCharacterLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterStatistics(ClientModels::GetCharacterStatisticsRequest& request, ProcessApiCallback<ClientModels::GetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboardAroundCharacter(ClientModels::GetLeaderboardAroundCharacterRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardAroundCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboardForUserCharacters(ClientModels::GetLeaderboardForUsersCharactersRequest& request, ProcessApiCallback<ClientModels::GetLeaderboardForUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GrantCharacterToUser(ClientModels::GrantCharacterToUserRequest& request, ProcessApiCallback<ClientModels::GrantCharacterToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCharacterStatistics(ClientModels::UpdateCharacterStatisticsRequest& request, ProcessApiCallback<ClientModels::UpdateCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterData(ClientModels::GetCharacterDataRequest& request, ProcessApiCallback<ClientModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterReadOnlyData(ClientModels::GetCharacterDataRequest& request, ProcessApiCallback<ClientModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCharacterData(ClientModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ClientModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AcceptTrade(ClientModels::AcceptTradeRequest& request, ProcessApiCallback<ClientModels::AcceptTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void CancelTrade(ClientModels::CancelTradeRequest& request, ProcessApiCallback<ClientModels::CancelTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerTrades(ClientModels::GetPlayerTradesRequest& request, ProcessApiCallback<ClientModels::GetPlayerTradesResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTradeStatus(ClientModels::GetTradeStatusRequest& request, ProcessApiCallback<ClientModels::GetTradeStatusResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void OpenTrade(ClientModels::OpenTradeRequest& request, ProcessApiCallback<ClientModels::OpenTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AttributeInstall(ClientModels::AttributeInstallRequest& request, ProcessApiCallback<ClientModels::AttributeInstallResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerSegments(ProcessApiCallback<ClientModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerTags(ClientModels::GetPlayerTagsRequest& request, ProcessApiCallback<ClientModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AndroidDevicePushNotificationRegistration(ClientModels::AndroidDevicePushNotificationRegistrationRequest& request, ProcessApiCallback<ClientModels::AndroidDevicePushNotificationRegistrationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RegisterForIOSPushNotification(ClientModels::RegisterForIOSPushNotificationRequest& request, ProcessApiCallback<ClientModels::RegisterForIOSPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RestoreIOSPurchases(ClientModels::RestoreIOSPurchasesRequest& request, ProcessApiCallback<ClientModels::RestoreIOSPurchasesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ValidateAmazonIAPReceipt(ClientModels::ValidateAmazonReceiptRequest& request, ProcessApiCallback<ClientModels::ValidateAmazonReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ValidateGooglePlayPurchase(ClientModels::ValidateGooglePlayPurchaseRequest& request, ProcessApiCallback<ClientModels::ValidateGooglePlayPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ValidateIOSReceipt(ClientModels::ValidateIOSReceiptRequest& request, ProcessApiCallback<ClientModels::ValidateIOSReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ValidateWindowsStoreReceipt(ClientModels::ValidateWindowsReceiptRequest& request, ProcessApiCallback<ClientModels::ValidateWindowsReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+
+        // ------------ Generated Api calls taking a temporary or moved request, which is serialized in place as the lvalue calls do
+        static void GetPhotonAuthenticationToken(ClientModels::GetPhotonAuthenticationTokenRequest&& request, ProcessApiCallback<ClientModels::GetPhotonAuthenticationTokenResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPhotonAuthenticationToken(request, callback, errorCallback, customData, priority); }
+        static void GetTitlePublicKey(ClientModels::GetTitlePublicKeyRequest&& request, ProcessApiCallback<ClientModels::GetTitlePublicKeyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitlePublicKey(request, callback, errorCallback, customData, priority); }
+        static void GetWindowsHelloChallenge(ClientModels::GetWindowsHelloChallengeRequest&& request, ProcessApiCallback<ClientModels::GetWindowsHelloChallengeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetWindowsHelloChallenge(request, callback, errorCallback, customData, priority); }
+        static void LoginWithAndroidDeviceID(ClientModels::LoginWithAndroidDeviceIDRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithAndroidDeviceID(request, callback, errorCallback, customData, priority); }
+        static void LoginWithCustomID(ClientModels::LoginWithCustomIDRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithCustomID(request, callback, errorCallback, customData, priority); }
+        static void LoginWithEmailAddress(ClientModels::LoginWithEmailAddressRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithEmailAddress(request, callback, errorCallback, customData, priority); }
+        static void LoginWithFacebook(ClientModels::LoginWithFacebookRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithFacebook(request, callback, errorCallback, customData, priority); }
+        static void LoginWithGameCenter(ClientModels::LoginWithGameCenterRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithGameCenter(request, callback, errorCallback, customData, priority); }
+        static void LoginWithGoogleAccount(ClientModels::LoginWithGoogleAccountRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithGoogleAccount(request, callback, errorCallback, customData, priority); }
+        static void LoginWithIOSDeviceID(ClientModels::LoginWithIOSDeviceIDRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithIOSDeviceID(request, callback, errorCallback, customData, priority); }
+        static void LoginWithKongregate(ClientModels::LoginWithKongregateRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithKongregate(request, callback, errorCallback, customData, priority); }
+        static void LoginWithPlayFab(ClientModels::LoginWithPlayFabRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithPlayFab(request, callback, errorCallback, customData, priority); }
+        static void LoginWithSteam(ClientModels::LoginWithSteamRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithSteam(request, callback, errorCallback, customData, priority); }
+        static void LoginWithTwitch(ClientModels::LoginWithTwitchRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithTwitch(request, callback, errorCallback, customData, priority); }
+        static void LoginWithWindowsHello(ClientModels::LoginWithWindowsHelloRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LoginWithWindowsHello(request, callback, errorCallback, customData, priority); }
+        static void RegisterPlayFabUser(ClientModels::RegisterPlayFabUserRequest&& request, ProcessApiCallback<ClientModels::RegisterPlayFabUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RegisterPlayFabUser(request, callback, errorCallback, customData, priority); }
+        static void RegisterWithWindowsHello(ClientModels::RegisterWithWindowsHelloRequest&& request, ProcessApiCallback<ClientModels::LoginResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RegisterWithWindowsHello(request, callback, errorCallback, customData, priority); }
+        static void SetPlayerSecret(ClientModels::SetPlayerSecretRequest&& request, ProcessApiCallback<ClientModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetPlayerSecret(request, callback, errorCallback, customData, priority); }
+        static void AddGenericID(ClientModels::AddGenericIDRequest&& request, ProcessApiCallback<ClientModels::AddGenericIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddGenericID(request, callback, errorCallback, customData, priority); }
+        static void AddUsernamePassword(ClientModels::AddUsernamePasswordRequest&& request, ProcessApiCallback<ClientModels::AddUsernamePasswordResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddUsernamePassword(request, callback, errorCallback, customData, priority); }
+        static void GetAccountInfo(ClientModels::GetAccountInfoRequest&& request, ProcessApiCallback<ClientModels::GetAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetAccountInfo(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerCombinedInfo(ClientModels::GetPlayerCombinedInfoRequest&& request, ProcessApiCallback<ClientModels::GetPlayerCombinedInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerCombinedInfo(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerProfile(ClientModels::GetPlayerProfileRequest&& request, ProcessApiCallback<ClientModels::GetPlayerProfileResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerProfile(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromFacebookIDs(ClientModels::GetPlayFabIDsFromFacebookIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromFacebookIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromFacebookIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromGameCenterIDs(ClientModels::GetPlayFabIDsFromGameCenterIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGameCenterIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromGameCenterIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromGenericIDs(ClientModels::GetPlayFabIDsFromGenericIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGenericIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromGenericIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromGoogleIDs(ClientModels::GetPlayFabIDsFromGoogleIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromGoogleIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromGoogleIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromKongregateIDs(ClientModels::GetPlayFabIDsFromKongregateIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromKongregateIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromKongregateIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromSteamIDs(ClientModels::GetPlayFabIDsFromSteamIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromSteamIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromSteamIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromTwitchIDs(ClientModels::GetPlayFabIDsFromTwitchIDsRequest&& request, ProcessApiCallback<ClientModels::GetPlayFabIDsFromTwitchIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromTwitchIDs(request, callback, errorCallback, customData, priority); }
+        static void LinkAndroidDeviceID(ClientModels::LinkAndroidDeviceIDRequest&& request, ProcessApiCallback<ClientModels::LinkAndroidDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkAndroidDeviceID(request, callback, errorCallback, customData, priority); }
+        static void LinkCustomID(ClientModels::LinkCustomIDRequest&& request, ProcessApiCallback<ClientModels::LinkCustomIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkCustomID(request, callback, errorCallback, customData, priority); }
+        static void LinkFacebookAccount(ClientModels::LinkFacebookAccountRequest&& request, ProcessApiCallback<ClientModels::LinkFacebookAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkFacebookAccount(request, callback, errorCallback, customData, priority); }
+        static void LinkGameCenterAccount(ClientModels::LinkGameCenterAccountRequest&& request, ProcessApiCallback<ClientModels::LinkGameCenterAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkGameCenterAccount(request, callback, errorCallback, customData, priority); }
+        static void LinkGoogleAccount(ClientModels::LinkGoogleAccountRequest&& request, ProcessApiCallback<ClientModels::LinkGoogleAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkGoogleAccount(request, callback, errorCallback, customData, priority); }
+        static void LinkIOSDeviceID(ClientModels::LinkIOSDeviceIDRequest&& request, ProcessApiCallback<ClientModels::LinkIOSDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkIOSDeviceID(request, callback, errorCallback, customData, priority); }
+        static void LinkKongregate(ClientModels::LinkKongregateAccountRequest&& request, ProcessApiCallback<ClientModels::LinkKongregateAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkKongregate(request, callback, errorCallback, customData, priority); }
+        static void LinkSteamAccount(ClientModels::LinkSteamAccountRequest&& request, ProcessApiCallback<ClientModels::LinkSteamAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkSteamAccount(request, callback, errorCallback, customData, priority); }
+        static void LinkTwitch(ClientModels::LinkTwitchAccountRequest&& request, ProcessApiCallback<ClientModels::LinkTwitchAccountResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkTwitch(request, callback, errorCallback, customData, priority); }
+        static void LinkWindowsHello(ClientModels::LinkWindowsHelloAccountRequest&& request, ProcessApiCallback<ClientModels::LinkWindowsHelloAccountResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { LinkWindowsHello(request, callback, errorCallback, customData, priority); }
+        static void RemoveGenericID(ClientModels::RemoveGenericIDRequest&& request, ProcessApiCallback<ClientModels::RemoveGenericIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveGenericID(request, callback, errorCallback, customData, priority); }
+        static void ReportPlayer(ClientModels::ReportPlayerClientRequest&& request, ProcessApiCallback<ClientModels::ReportPlayerClientResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ReportPlayer(request, callback, errorCallback, customData, priority); }
+        static void SendAccountRecoveryEmail(ClientModels::SendAccountRecoveryEmailRequest&& request, ProcessApiCallback<ClientModels::SendAccountRecoveryEmailResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SendAccountRecoveryEmail(request, callback, errorCallback, customData, priority); }
+        static void UnlinkAndroidDeviceID(ClientModels::UnlinkAndroidDeviceIDRequest&& request, ProcessApiCallback<ClientModels::UnlinkAndroidDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlinkAndroidDeviceID(request, callback, errorCallback, customData, priority); }
+        static void UnlinkCustomID(ClientModels::UnlinkCustomIDRequest&& request, ProcessApiCallback<ClientModels::UnlinkCustomIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlinkCustomID(request, callback, errorCallback, customData, priority); }
+        static void UnlinkIOSDeviceID(ClientModels::UnlinkIOSDeviceIDRequest&& request, ProcessApiCallback<ClientModels::UnlinkIOSDeviceIDResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlinkIOSDeviceID(request, callback, errorCallback, customData, priority); }
+        static void UnlinkWindowsHello(ClientModels::UnlinkWindowsHelloAccountRequest&& request, ProcessApiCallback<ClientModels::UnlinkWindowsHelloAccountResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlinkWindowsHello(request, callback, errorCallback, customData, priority); }
+        static void UpdateAvatarUrl(ClientModels::UpdateAvatarUrlRequest&& request, ProcessApiCallback<ClientModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateAvatarUrl(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserTitleDisplayName(ClientModels::UpdateUserTitleDisplayNameRequest&& request, ProcessApiCallback<ClientModels::UpdateUserTitleDisplayNameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserTitleDisplayName(request, callback, errorCallback, customData, priority); }
+        static void GetFriendLeaderboard(ClientModels::GetFriendLeaderboardRequest&& request, ProcessApiCallback<ClientModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetFriendLeaderboard(request, callback, errorCallback, customData, priority); }
+        static void GetFriendLeaderboardAroundPlayer(ClientModels::GetFriendLeaderboardAroundPlayerRequest&& request, ProcessApiCallback<ClientModels::GetFriendLeaderboardAroundPlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetFriendLeaderboardAroundPlayer(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboard(ClientModels::GetLeaderboardRequest&& request, ProcessApiCallback<ClientModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboard(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboardAroundPlayer(ClientModels::GetLeaderboardAroundPlayerRequest&& request, ProcessApiCallback<ClientModels::GetLeaderboardAroundPlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboardAroundPlayer(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerStatistics(ClientModels::GetPlayerStatisticsRequest&& request, ProcessApiCallback<ClientModels::GetPlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerStatistics(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerStatisticVersions(ClientModels::GetPlayerStatisticVersionsRequest&& request, ProcessApiCallback<ClientModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerStatisticVersions(request, callback, errorCallback, customData, priority); }
+        static void GetUserData(ClientModels::GetUserDataRequest&& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherData(ClientModels::GetUserDataRequest&& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherReadOnlyData(ClientModels::GetUserDataRequest&& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void GetUserReadOnlyData(ClientModels::GetUserDataRequest&& request, ProcessApiCallback<ClientModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void UpdatePlayerStatistics(ClientModels::UpdatePlayerStatisticsRequest&& request, ProcessApiCallback<ClientModels::UpdatePlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdatePlayerStatistics(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserData(ClientModels::UpdateUserDataRequest&& request, ProcessApiCallback<ClientModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherData(ClientModels::UpdateUserDataRequest&& request, ProcessApiCallback<ClientModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetCatalogItems(ClientModels::GetCatalogItemsRequest&& request, ProcessApiCallback<ClientModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCatalogItems(request, callback, errorCallback, customData, priority); }
+        static void GetPublisherData(ClientModels::GetPublisherDataRequest&& request, ProcessApiCallback<ClientModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetStoreItems(ClientModels::GetStoreItemsRequest&& request, ProcessApiCallback<ClientModels::GetStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetStoreItems(request, callback, errorCallback, customData, priority); }
+        static void GetTitleData(ClientModels::GetTitleDataRequest&& request, ProcessApiCallback<ClientModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleData(request, callback, errorCallback, customData, priority); }
+        static void GetTitleNews(ClientModels::GetTitleNewsRequest&& request, ProcessApiCallback<ClientModels::GetTitleNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleNews(request, callback, errorCallback, customData, priority); }
+        static void AddUserVirtualCurrency(ClientModels::AddUserVirtualCurrencyRequest&& request, ProcessApiCallback<ClientModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddUserVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void ConfirmPurchase(ClientModels::ConfirmPurchaseRequest&& request, ProcessApiCallback<ClientModels::ConfirmPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ConfirmPurchase(request, callback, errorCallback, customData, priority); }
+        static void ConsumeItem(ClientModels::ConsumeItemRequest&& request, ProcessApiCallback<ClientModels::ConsumeItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ConsumeItem(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterInventory(ClientModels::GetCharacterInventoryRequest&& request, ProcessApiCallback<ClientModels::GetCharacterInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterInventory(request, callback, errorCallback, customData, priority); }
+        static void GetPurchase(ClientModels::GetPurchaseRequest&& request, ProcessApiCallback<ClientModels::GetPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPurchase(request, callback, errorCallback, customData, priority); }
+        static void PayForPurchase(ClientModels::PayForPurchaseRequest&& request, ProcessApiCallback<ClientModels::PayForPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { PayForPurchase(request, callback, errorCallback, customData, priority); }
+        static void PurchaseItem(ClientModels::PurchaseItemRequest&& request, ProcessApiCallback<ClientModels::PurchaseItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { PurchaseItem(request, callback, errorCallback, customData, priority); }
+        static void RedeemCoupon(ClientModels::RedeemCouponRequest&& request, ProcessApiCallback<ClientModels::RedeemCouponResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RedeemCoupon(request, callback, errorCallback, customData, priority); }
+        static void StartPurchase(ClientModels::StartPurchaseRequest&& request, ProcessApiCallback<ClientModels::StartPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { StartPurchase(request, callback, errorCallback, customData, priority); }
+        static void SubtractUserVirtualCurrency(ClientModels::SubtractUserVirtualCurrencyRequest&& request, ProcessApiCallback<ClientModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SubtractUserVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void UnlockContainerInstance(ClientModels::UnlockContainerInstanceRequest&& request, ProcessApiCallback<ClientModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlockContainerInstance(request, callback, errorCallback, customData, priority); }
+        static void UnlockContainerItem(ClientModels::UnlockContainerItemRequest&& request, ProcessApiCallback<ClientModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlockContainerItem(request, callback, errorCallback, customData, priority); }
+        static void AddFriend(ClientModels::AddFriendRequest&& request, ProcessApiCallback<ClientModels::AddFriendResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddFriend(request, callback, errorCallback, customData, priority); }
+        static void GetFriendsList(ClientModels::GetFriendsListRequest&& request, ProcessApiCallback<ClientModels::GetFriendsListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetFriendsList(request, callback, errorCallback, customData, priority); }
+        static void RemoveFriend(ClientModels::RemoveFriendRequest&& request, ProcessApiCallback<ClientModels::RemoveFriendResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveFriend(request, callback, errorCallback, customData, priority); }
+        static void SetFriendTags(ClientModels::SetFriendTagsRequest&& request, ProcessApiCallback<ClientModels::SetFriendTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetFriendTags(request, callback, errorCallback, customData, priority); }
+        static void GetCurrentGames(ClientModels::CurrentGamesRequest&& request, ProcessApiCallback<ClientModels::CurrentGamesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCurrentGames(request, callback, errorCallback, customData, priority); }
+        static void GetGameServerRegions(ClientModels::GameServerRegionsRequest&& request, ProcessApiCallback<ClientModels::GameServerRegionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetGameServerRegions(request, callback, errorCallback, customData, priority); }
+        static void Matchmake(ClientModels::MatchmakeRequest&& request, ProcessApiCallback<ClientModels::MatchmakeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { Matchmake(request, callback, errorCallback, customData, priority); }
+        static void StartGame(ClientModels::StartGameRequest&& request, ProcessApiCallback<ClientModels::StartGameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { StartGame(request, callback, errorCallback, customData, priority); }
+        static void WriteCharacterEvent(ClientModels::WriteClientCharacterEventRequest&& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { WriteCharacterEvent(request, callback, errorCallback, customData, priority); }
+        static void WritePlayerEvent(ClientModels::WriteClientPlayerEventRequest&& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { WritePlayerEvent(request, callback, errorCallback, customData, priority); }
+        static void WriteTitleEvent(ClientModels::WriteTitleEventRequest&& request, ProcessApiCallback<ClientModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { WriteTitleEvent(request, callback, errorCallback, customData, priority); }
+        static void AddSharedGroupMembers(ClientModels::AddSharedGroupMembersRequest&& request, ProcessApiCallback<ClientModels::AddSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddSharedGroupMembers(request, callback, errorCallback, customData, priority); }
+        static void CreateSharedGroup(ClientModels::CreateSharedGroupRequest&& request, ProcessApiCallback<ClientModels::CreateSharedGroupResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CreateSharedGroup(request, callback, errorCallback, customData, priority); }
+        static void GetSharedGroupData(ClientModels::GetSharedGroupDataRequest&& request, ProcessApiCallback<ClientModels::GetSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetSharedGroupData(request, callback, errorCallback, customData, priority); }
+        static void RemoveSharedGroupMembers(ClientModels::RemoveSharedGroupMembersRequest&& request, ProcessApiCallback<ClientModels::RemoveSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveSharedGroupMembers(request, callback, errorCallback, customData, priority); }
+        static void UpdateSharedGroupData(ClientModels::UpdateSharedGroupDataRequest&& request, ProcessApiCallback<ClientModels::UpdateSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateSharedGroupData(request, callback, errorCallback, customData, priority); }
+        static void ExecuteCloudScript(ClientModels::ExecuteCloudScriptRequest&& request, ProcessApiCallback<ClientModels::ExecuteCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ExecuteCloudScript(request, callback, errorCallback, customData, priority); }
+        static void GetContentDownloadUrl(ClientModels::GetContentDownloadUrlRequest&& request, ProcessApiCallback<ClientModels::GetContentDownloadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetContentDownloadUrl(request, callback, errorCallback, customData, priority); }
+        static void GetAllUsersCharacters(ClientModels::ListUsersCharactersRequest&& request, ProcessApiCallback<ClientModels::ListUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetAllUsersCharacters(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterLeaderboard(ClientModels::GetCharacterLeaderboardRequest&& request, ProcessApiCallback<ClientModels::GetCharacterLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterLeaderboard(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterStatistics(ClientModels::GetCharacterStatisticsRequest&& request, ProcessApiCallback<ClientModels::GetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterStatistics(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboardAroundCharacter(ClientModels::GetLeaderboardAroundCharacterRequest&& request, ProcessApiCallback<ClientModels::GetLeaderboardAroundCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboardAroundCharacter(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboardForUserCharacters(ClientModels::GetLeaderboardForUsersCharactersRequest&& request, ProcessApiCallback<ClientModels::GetLeaderboardForUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboardForUserCharacters(request, callback, errorCallback, customData, priority); }
+        static void GrantCharacterToUser(ClientModels::GrantCharacterToUserRequest&& request, ProcessApiCallback<ClientModels::GrantCharacterToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GrantCharacterToUser(request, callback, errorCallback, customData, priority); }
+        static void UpdateCharacterStatistics(ClientModels::UpdateCharacterStatisticsRequest&& request, ProcessApiCallback<ClientModels::UpdateCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCharacterStatistics(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterData(ClientModels::GetCharacterDataRequest&& request, ProcessApiCallback<ClientModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterData(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterReadOnlyData(ClientModels::GetCharacterDataRequest&& request, ProcessApiCallback<ClientModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void UpdateCharacterData(ClientModels::UpdateCharacterDataRequest&& request, ProcessApiCallback<ClientModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCharacterData(request, callback, errorCallback, customData, priority); }
+        static void AcceptTrade(ClientModels::AcceptTradeRequest&& request, ProcessApiCallback<ClientModels::AcceptTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AcceptTrade(request, callback, errorCallback, customData, priority); }
+        static void CancelTrade(ClientModels::CancelTradeRequest&& request, ProcessApiCallback<ClientModels::CancelTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CancelTrade(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerTrades(ClientModels::GetPlayerTradesRequest&& request, ProcessApiCallback<ClientModels::GetPlayerTradesResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerTrades(request, callback, errorCallback, customData, priority); }
+        static void GetTradeStatus(ClientModels::GetTradeStatusRequest&& request, ProcessApiCallback<ClientModels::GetTradeStatusResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTradeStatus(request, callback, errorCallback, customData, priority); }
+        static void OpenTrade(ClientModels::OpenTradeRequest&& request, ProcessApiCallback<ClientModels::OpenTradeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { OpenTrade(request, callback, errorCallback, customData, priority); }
+        static void AttributeInstall(ClientModels::AttributeInstallRequest&& request, ProcessApiCallback<ClientModels::AttributeInstallResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AttributeInstall(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerTags(ClientModels::GetPlayerTagsRequest&& request, ProcessApiCallback<ClientModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerTags(request, callback, errorCallback, customData, priority); }
+        static void AndroidDevicePushNotificationRegistration(ClientModels::AndroidDevicePushNotificationRegistrationRequest&& request, ProcessApiCallback<ClientModels::AndroidDevicePushNotificationRegistrationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AndroidDevicePushNotificationRegistration(request, callback, errorCallback, customData, priority); }
+        static void RegisterForIOSPushNotification(ClientModels::RegisterForIOSPushNotificationRequest&& request, ProcessApiCallback<ClientModels::RegisterForIOSPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RegisterForIOSPushNotification(request, callback, errorCallback, customData, priority); }
+        static void RestoreIOSPurchases(ClientModels::RestoreIOSPurchasesRequest&& request, ProcessApiCallback<ClientModels::RestoreIOSPurchasesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RestoreIOSPurchases(request, callback, errorCallback, customData, priority); }
+        static void ValidateAmazonIAPReceipt(ClientModels::ValidateAmazonReceiptRequest&& request, ProcessApiCallback<ClientModels::ValidateAmazonReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ValidateAmazonIAPReceipt(request, callback, errorCallback, customData, priority); }
+        static void ValidateGooglePlayPurchase(ClientModels::ValidateGooglePlayPurchaseRequest&& request, ProcessApiCallback<ClientModels::ValidateGooglePlayPurchaseResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ValidateGooglePlayPurchase(request, callback, errorCallback, customData, priority); }
+        static void ValidateIOSReceipt(ClientModels::ValidateIOSReceiptRequest&& request, ProcessApiCallback<ClientModels::ValidateIOSReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ValidateIOSReceipt(request, callback, errorCallback, customData, priority); }
+        static void ValidateWindowsStoreReceipt(ClientModels::ValidateWindowsReceiptRequest&& request, ProcessApiCallback<ClientModels::ValidateWindowsReceiptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ValidateWindowsStoreReceipt(request, callback, errorCallback, customData, priority); }
+
+        // ------------ Lazily decoded variants of the calls with the largest results, see PlayFabLazyModel
+        static void GetPlayerCombinedInfoLazy(ClientModels::GetPlayerCombinedInfoRequest& request, ProcessApiCallback<PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCatalogItemsLazy(ClientModels::GetCatalogItemsRequest& request, ProcessApiCallback<PlayFabLazyModel<ClientModels::GetCatalogItemsResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInventoryLazy(ProcessApiCallback<PlayFabLazyModel<ClientModels::GetUserInventoryResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
 
     private:
         // ------------ Private constructor, to enforce all-static class
@@ -0,0 +1,127 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabClient_CatalogSysComponent.h"
+
+#include "PlayFabClientApi.h"
+#include "PlayFabCatalogCache.h"
+#include <PlayFabClientSdk/PlayFabLazyModel.h>
+
+namespace PlayFabClientSdk
+{
+    // Fetch results, delivered to the cache which is deleted only after the request manager. customData is the catalog version, allocated for the fetch.
+    static void OnCatalogFetched(const PlayFabLazyModel<ClientModels::GetCatalogItemsResult>& result, void* customData)
+    {
+        // Decoded straight into a model the cache takes the items from, rather than copying them out of a shared result
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        ClientModels::GetCatalogItemsResult decoded;
+        result.Decode(decoded);
+        PlayFabCatalogCache::catalogCache->ApplyFetchResult(*catalogVersion, AZStd::move(decoded.Catalog));
+        delete catalogVersion;
+    }
+
+    static void OnCatalogFetchFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        PlayFabCatalogCache::catalogCache->ApplyFetchFailure(*catalogVersion);
+        delete catalogVersion;
+    }
+
+    void PlayFabClient_CatalogSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabClient_CatalogSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabClient_CatalogSysComponent>("PlayFabClient_Catalog", "Provides cached, indexed catalogs within the PlayFab Client SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabClient_CatalogSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabClient_CatalogService"));
+    }
+
+    void PlayFabClient_CatalogSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabClient_CatalogService"));
+    }
+
+    void PlayFabClient_CatalogSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabClient_CatalogSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabClient_CatalogSysComponent::Init()
+    {
+    }
+
+    void PlayFabClient_CatalogSysComponent::Activate()
+    {
+        PlayFabClient_CatalogRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabClient_CatalogSysComponent::Deactivate()
+    {
+        PlayFabClient_CatalogRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabClient_CatalogSysComponent::FetchCatalog(const AZStd::string& catalogVersion)
+    {
+        ClientModels::GetCatalogItemsRequest request;
+        request.CatalogVersion = catalogVersion;
+
+        // Nothing is waiting on a refresh, the cache keeps serving the previous snapshot
+        PlayFabClientApi::GetCatalogItemsLazy(request, OnCatalogFetched, OnCatalogFetchFailed, new AZStd::string(catalogVersion), PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabClient_CatalogSysComponent::StartCatalogCache(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Start(catalogVersion);
+    }
+
+    void PlayFabClient_CatalogSysComponent::StopCatalogCache(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Stop(catalogVersion);
+    }
+
+    void PlayFabClient_CatalogSysComponent::RefreshCatalog(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Refresh(catalogVersion);
+    }
+
+    void PlayFabClient_CatalogSysComponent::SetCatalogRefreshInterval(int seconds)
+    {
+        PlayFabCatalogCache::catalogCache->SetRefreshInterval(seconds);
+    }
+
+    PlayFabCatalogSnapshotPtr PlayFabClient_CatalogSysComponent::GetCatalogSnapshot(const char* catalogVersion)
+    {
+        return PlayFabCatalogCache::catalogCache->GetSnapshot(catalogVersion);
+    }
+
+    PlayFabCatalogCacheStats PlayFabClient_CatalogSysComponent::GetCatalogCacheStats(AZStd::string catalogVersion)
+    {
+        return PlayFabCatalogCache::catalogCache->GetStats(catalogVersion);
+    }
+}
@@ -0,0 +1,42 @@
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabClientSdk/PlayFabClient_Catalogbus.h>
+
+namespace PlayFabClientSdk
+{
+    class PlayFabClient_CatalogSysComponent
+        : public AZ::Component
+        , protected PlayFabClient_CatalogRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabClient_CatalogSysComponent, "{FDEEA325-EC4C-4D4B-9FBD-E64A8D523CE2}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabCatalogCache::FetchFunction for this gem's apis
+        static bool FetchCatalog(const AZStd::string& catalogVersion);
+
+        void StartCatalogCache(AZStd::string catalogVersion) override;
+        void StopCatalogCache(AZStd::string catalogVersion) override;
+        void RefreshCatalog(AZStd::string catalogVersion) override;
+        void SetCatalogRefreshInterval(int seconds) override;
+        PlayFabCatalogSnapshotPtr GetCatalogSnapshot(const char* catalogVersion) override;
+        PlayFabCatalogCacheStats GetCatalogCacheStats(AZStd::string catalogVersion) override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
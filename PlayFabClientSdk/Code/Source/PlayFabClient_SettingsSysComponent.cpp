@@ -7,6 +7,7 @@
 #include "PlayFabClient_SettingsSysComponent.h"
 
 #include "PlayFabSettings.h"
+#include "PlayFabRateLimiter.h"
 
 namespace PlayFabClientSdk
 {
@@ -81,4 +82,25 @@ namespace PlayFabClientSdk
         return PlayFabSettings::playFabSettings->titleId;
     }
 
+    // Rate limit Section
+    void PlayFabClient_SettingsSysComponent::SetTitleRateLimit(float ratePerSecond, float burst)
+    {
+        PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetTitleLimit(ratePerSecond, burst);
+    }
+
+    void PlayFabClient_SettingsSysComponent::SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst)
+    {
+        PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetEndpointLimit(callPath, ratePerSecond, burst);
+    }
+
+    PlayFabRateLimitState PlayFabClient_SettingsSysComponent::GetTitleRateLimitState()
+    {
+        return PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetTitleState();
+    }
+
+    PlayFabRateLimitState PlayFabClient_SettingsSysComponent::GetEndpointRateLimitState(AZStd::string callPath)
+    {
+        return PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetEndpointState(callPath);
+    }
+
 }
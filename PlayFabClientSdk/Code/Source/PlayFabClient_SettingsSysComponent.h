@@ -28,6 +28,12 @@ namespace PlayFabClientSdk
         void SetTitleId(AZStd::string newTitleId) override;
         AZStd::string GetTitleId() override;
 
+        // Rate limit Section
+        void SetTitleRateLimit(float ratePerSecond, float burst) override;
+        void SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst) override;
+        PlayFabRateLimitState GetTitleRateLimitState() override;
+        PlayFabRateLimitState GetEndpointRateLimitState(AZStd::string callPath) override;
+
     protected:
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
@@ -0,0 +1,144 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabClient_TelemetrySysComponent.h"
+
+#include "PlayFabClientApi.h"
+#include "PlayFabTelemetryPipeline.h"
+
+namespace PlayFabClientSdk
+{
+    // Delivered to the telemetry pipeline, which is deleted only after the request manager
+    static void OnTelemetryEventSent(const ClientModels::WriteEventResponse& result, void* customData)
+    {
+        (void)result;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(true);
+    }
+
+    static void OnTelemetryEventSendFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(false);
+    }
+
+    void PlayFabClient_TelemetrySysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabClient_TelemetrySysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabClient_TelemetrySysComponent>("PlayFabClient_Telemetry", "Buffers and rate limits telemetry events within the PlayFab Client SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabClient_TelemetrySysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabClient_TelemetryService"));
+    }
+
+    void PlayFabClient_TelemetrySysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabClient_TelemetryService"));
+    }
+
+    void PlayFabClient_TelemetrySysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabClient_TelemetrySysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabClient_TelemetrySysComponent::Init()
+    {
+    }
+
+    void PlayFabClient_TelemetrySysComponent::Activate()
+    {
+        PlayFabClient_TelemetryRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabClient_TelemetrySysComponent::Deactivate()
+    {
+        PlayFabClient_TelemetryRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabClient_TelemetrySysComponent::SendTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        switch (event.type)
+        {
+        case PlayFabTelemetryPlayerEvent:
+        {
+            ClientModels::WriteClientPlayerEventRequest request;
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabClientApi::WritePlayerEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryCharacterEvent:
+        {
+            ClientModels::WriteClientCharacterEventRequest request;
+            request.CharacterId = AZStd::move(event.characterId);
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabClientApi::WriteCharacterEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryTitleEvent:
+        {
+            ClientModels::WriteTitleEventRequest request;
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabClientApi::WriteTitleEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    bool PlayFabClient_TelemetrySysComponent::QueueTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        return PlayFabTelemetryPipeline::telemetryPipeline->Queue(event);
+    }
+
+    void PlayFabClient_TelemetrySysComponent::SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate)
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->SetDropPolicy(policy, sampleRate);
+    }
+
+    void PlayFabClient_TelemetrySysComponent::SetTelemetrySendRate(float eventsPerSecond)
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->SetSendRate(eventsPerSecond);
+    }
+
+    void PlayFabClient_TelemetrySysComponent::FlushTelemetry()
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->Flush();
+    }
+
+    PlayFabTelemetryStats PlayFabClient_TelemetrySysComponent::GetTelemetryStats()
+    {
+        return PlayFabTelemetryPipeline::telemetryPipeline->GetStats();
+    }
+}
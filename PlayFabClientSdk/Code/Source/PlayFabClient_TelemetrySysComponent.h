@@ -0,0 +1,40 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabClientSdk/PlayFabClient_Telemetrybus.h>
+
+namespace PlayFabClientSdk
+{
+    class PlayFabClient_TelemetrySysComponent
+        : public AZ::Component
+        , protected PlayFabClient_TelemetryRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabClient_TelemetrySysComponent, "{FDEEA325-EC4C-4D4B-9FBD-E64A8D523CE5}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabTelemetryPipeline::SendFunction for this gem's apis
+        static bool SendTelemetryEvent(PlayFabTelemetryEvent& event);
+
+        bool QueueTelemetryEvent(PlayFabTelemetryEvent& event) override;
+        void SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate) override;
+        void SetTelemetrySendRate(float eventsPerSecond) override;
+        void FlushTelemetry() override;
+        PlayFabTelemetryStats GetTelemetryStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
@@ -0,0 +1,124 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabClient_TitleDataSysComponent.h"
+
+#include "PlayFabClientApi.h"
+#include "PlayFabTitleDataCache.h"
+
+namespace PlayFabClientSdk
+{
+    // Fetch results, delivered to the cache which is deleted only after the request manager
+    static void OnTitleDataFetched(const ClientModels::GetTitleDataResult& result, void* customData)
+    {
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchResult(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)), result.Data);
+    }
+
+    static void OnTitleDataFetchFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchFailure(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)));
+    }
+
+    void PlayFabClient_TitleDataSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabClient_TitleDataSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabClient_TitleDataSysComponent>("PlayFabClient_TitleData", "Provides cached title data within the PlayFab Client SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabClient_TitleDataSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabClient_TitleDataService"));
+    }
+
+    void PlayFabClient_TitleDataSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabClient_TitleDataService"));
+    }
+
+    void PlayFabClient_TitleDataSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabClient_TitleDataSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabClient_TitleDataSysComponent::Init()
+    {
+    }
+
+    void PlayFabClient_TitleDataSysComponent::Activate()
+    {
+        PlayFabClient_TitleDataRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabClient_TitleDataSysComponent::Deactivate()
+    {
+        PlayFabClient_TitleDataRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabClient_TitleDataSysComponent::FetchTitleData(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys)
+    {
+        // Internal title data is only readable with the server secret key
+        if (source != PlayFabTitleDataPublic)
+            return false;
+
+        ClientModels::GetTitleDataRequest request;
+        request.Keys.assign(keys.begin(), keys.end());
+        void* customData = reinterpret_cast<void*>(static_cast<intptr_t>(source));
+
+        // Nothing is waiting on a refresh, the cache keeps serving the previous snapshot
+        PlayFabClientApi::GetTitleData(request, OnTitleDataFetched, OnTitleDataFetchFailed, customData, PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabClient_TitleDataSysComponent::StartTitleDataCache(PlayFabTitleDataSource source, AZStd::vector<AZStd::string> keys)
+    {
+        PlayFabTitleDataCache::titleDataCache->Start(source, keys);
+    }
+
+    void PlayFabClient_TitleDataSysComponent::StopTitleDataCache(PlayFabTitleDataSource source)
+    {
+        PlayFabTitleDataCache::titleDataCache->Stop(source);
+    }
+
+    void PlayFabClient_TitleDataSysComponent::RefreshTitleData(PlayFabTitleDataSource source)
+    {
+        PlayFabTitleDataCache::titleDataCache->Refresh(source);
+    }
+
+    void PlayFabClient_TitleDataSysComponent::SetTitleDataRefreshInterval(int seconds)
+    {
+        PlayFabTitleDataCache::titleDataCache->SetRefreshInterval(seconds);
+    }
+
+    PlayFabTitleDataSnapshotPtr PlayFabClient_TitleDataSysComponent::GetTitleDataSnapshot(PlayFabTitleDataSource source)
+    {
+        return PlayFabTitleDataCache::titleDataCache->GetSnapshot(source);
+    }
+
+    PlayFabTitleDataCacheStats PlayFabClient_TitleDataSysComponent::GetTitleDataCacheStats(PlayFabTitleDataSource source)
+    {
+        return PlayFabTitleDataCache::titleDataCache->GetStats(source);
+    }
+}
@@ -0,0 +1,55 @@
+#include "StdAfx.h"
+#include "PlayFabCompression.h"
+
+#include <AzCore/Compression/compression.h>
+#include <zlib.h>
+
+using namespace PlayFabClientSdk;
+
+const char* PlayFabCompression::ContentEncoding = "deflate";
+
+// Json compresses well at moderate levels, higher ones cost far more time for a few more bytes
+static const unsigned int CompressionLevel = 6;
+
+bool PlayFabCompression::Deflate(const char* data, size_t size, AZStd::vector<char>& compressed)
+{
+    AZ::ZLib zlib;
+    zlib.StartCompressor(CompressionLevel);
+    compressed.resize(zlib.GetMinCompressedBufferSize(static_cast<unsigned int>(size)));
+    unsigned int remaining = static_cast<unsigned int>(size);
+    unsigned int written = zlib.Compress(data, remaining, compressed.data(), static_cast<unsigned int>(compressed.size()), AZ::ZLib::FT_FINISH);
+    zlib.StopCompressor();
+
+    compressed.resize(written);
+    return remaining == 0;
+}
+
+bool PlayFabCompression::Inflate(const char* data, size_t size, AZStd::vector<char>& decompressed)
+{
+    // zlib itself rather than the engine's wrapper, which neither reports the end of the stream nor tolerates a corrupt one
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (inflateInit(&stream) != Z_OK)
+        return false;
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in = static_cast<uInt>(size);
+
+    // Decompress straight into the output, growing it whenever a pass fills it
+    decompressed.resize(size * 4 + 1024);
+    size_t produced = 0;
+    int result = Z_OK;
+    while (result == Z_OK)
+    {
+        if (produced == decompressed.size())
+            decompressed.resize(decompressed.size() * 2);
+        stream.next_out = reinterpret_cast<Bytef*>(decompressed.data() + produced);
+        stream.avail_out = static_cast<uInt>(decompressed.size() - produced);
+        result = inflate(&stream, Z_NO_FLUSH);
+        produced = decompressed.size() - stream.avail_out;
+    }
+    inflateEnd(&stream);
+
+    // Z_STREAM_END only comes once the trailer checksum has matched. A truncated body stops with Z_BUF_ERROR, a corrupt one with Z_DATA_ERROR.
+    decompressed.resize(produced);
+    return result == Z_STREAM_END && stream.avail_in == 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabClientSdk
+{
+    // Http "deflate" content coding (zlib format) for request and response bodies
+    class PlayFabCompression
+    {
+    public:
+        static const char* ContentEncoding; // The Content-Encoding and Accept-Encoding value for this coding
+
+        // Compress data into compressed, returning false if it could not be compressed
+        static bool Deflate(const char* data, size_t size, AZStd::vector<char>& compressed);
+        // Decompress data into decompressed, returning false unless it is exactly one complete deflate stream with a matching checksum
+        static bool Inflate(const char* data, size_t size, AZStd::vector<char>& decompressed);
+    };
+}
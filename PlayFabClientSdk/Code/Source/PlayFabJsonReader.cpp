@@ -0,0 +1,268 @@
+#include "StdAfx.h"
+#include <PlayFabClientSdk/PlayFabJsonReader.h>
+
+#include <AzCore/JSON/reader.h>
+#include <AzCore/std/utils.h>
+
+using namespace PlayFabClientSdk;
+
+struct PlayFabJsonReader::TokenWriter
+{
+    PlayFabJsonReader& reader;
+
+    explicit TokenWriter(PlayFabJsonReader& owner) : reader(owner) {}
+
+    Token& Add(TokenType type)
+    {
+        reader.m_tokens.push_back(Token());
+        Token& token = reader.m_tokens.back();
+        token.type = type;
+        return token;
+    }
+    bool Open(TokenType type)
+    {
+        reader.m_openTokens.push_back(reader.m_tokens.size());
+        Add(type);
+        return true;
+    }
+    bool Close(TokenType type, rapidjson::SizeType count)
+    {
+        Add(type);
+        Token& start = reader.m_tokens[reader.m_openTokens.back()];
+        start.end = reader.m_tokens.size();
+        start.length = count;
+        reader.m_openTokens.pop_back();
+        return true;
+    }
+
+    bool Null() { Add(TokenNull); return true; }
+    bool Bool(bool value) { Add(TokenBool).boolean = value; return true; }
+    bool Int(int value) { Add(TokenInt).intValue = value; return true; }
+    bool Uint(unsigned value) { Add(TokenUint).uintValue = value; return true; }
+    bool Int64(int64_t value) { Add(TokenInt64).int64Value = value; return true; }
+    bool Uint64(uint64_t value) { Add(TokenUint64).uint64Value = value; return true; }
+    bool Double(double value) { Add(TokenDouble).doubleValue = value; return true; }
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) { return String(str, length, copy); }
+    bool String(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        // Parsed in place, so the text is never copied and the pointer stays valid
+        (void)copy;
+        Token& token = Add(TokenString);
+        token.string = str;
+        token.length = length;
+        return true;
+    }
+    bool Key(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        (void)copy;
+        Token& token = Add(TokenKey);
+        token.string = str;
+        token.length = length;
+        token.hash = Hash(str);
+        return true;
+    }
+    bool StartObject() { return Open(TokenStartObject); }
+    bool EndObject(rapidjson::SizeType memberCount) { return Close(TokenEndObject, memberCount); }
+    bool StartArray() { return Open(TokenStartArray); }
+    bool EndArray(rapidjson::SizeType elementCount) { return Close(TokenEndArray, elementCount); }
+};
+
+PlayFabJsonReader::PlayFabJsonReader()
+    : m_position(0)
+    , m_memberHash(0)
+    , m_arraySize(0)
+    , m_filterObject(NoPosition)
+    , m_filterKey(NoPosition)
+    , m_filterName(nullptr)
+    , m_filterHash(0)
+    , m_valid(false)
+{
+}
+
+bool PlayFabJsonReader::Parse(char* text)
+{
+    Clear();
+    TokenWriter writer(*this);
+    rapidjson::InsituStringStream stream(text);
+    rapidjson::Reader parser;
+    m_valid = !parser.Parse<rapidjson::kParseInsituFlag>(stream, writer).IsError();
+    return m_valid;
+}
+
+void PlayFabJsonReader::Clear()
+{
+    m_tokens.clear();
+    m_openTokens.clear();
+    m_position = 0;
+    m_filterObject = NoPosition;
+    m_filterKey = NoPosition;
+    m_valid = false;
+}
+
+void PlayFabJsonReader::Swap(PlayFabJsonReader& other)
+{
+    m_tokens.swap(other.m_tokens);
+    m_openTokens.swap(other.m_openTokens);
+    AZStd::swap(m_position, other.m_position);
+    AZStd::swap(m_filterObject, other.m_filterObject);
+    AZStd::swap(m_filterKey, other.m_filterKey);
+    AZStd::swap(m_filterName, other.m_filterName);
+    AZStd::swap(m_filterHash, other.m_filterHash);
+    AZStd::swap(m_valid, other.m_valid);
+}
+
+void PlayFabJsonReader::Relocate(const char* oldText, const char* newText)
+{
+    for (Token& token : m_tokens)
+    {
+        if (token.type == TokenString || token.type == TokenKey)
+            token.string = newText + (token.string - oldText);
+    }
+}
+
+bool PlayFabJsonReader::SeekMember(const char* name)
+{
+    Rewind();
+    return FindMember(name);
+}
+
+bool PlayFabJsonReader::FindMember(const char* name)
+{
+    const char* member;
+    if (!StartObject())
+        return false;
+    while (NextMember(member))
+    {
+        if (strcmp(member, name) == 0)
+            return true;
+        Skip();
+    }
+    return false;
+}
+
+void PlayFabJsonReader::FilterMember(const char* name)
+{
+    m_filterObject = m_position;
+    m_filterKey = NoPosition;
+    m_filterName = name;
+    m_filterHash = Hash(name);
+}
+
+bool PlayFabJsonReader::StartObject()
+{
+    if (!IsObject())
+    {
+        Skip();
+        return false;
+    }
+    if (m_position == m_filterObject)
+    {
+        m_filterObject = NoPosition;
+        m_filterKey = m_position + 1;
+    }
+    m_position++;
+    return true;
+}
+
+bool PlayFabJsonReader::NextMember(const char*& name)
+{
+    // Keys of the filtered object are reached by jumping over whole members, so keys of nested objects never land on m_filterKey
+    while (m_position == m_filterKey && m_position < m_tokens.size() && m_tokens[m_position].type == TokenKey)
+    {
+        size_t key = m_position;
+        m_position++;
+        Skip();
+        m_filterKey = m_position;
+        if (m_tokens[key].hash == m_filterHash && strcmp(m_tokens[key].string, m_filterName) == 0)
+        {
+            m_position = key;
+            break;
+        }
+    }
+
+    if (m_position >= m_tokens.size())
+        return false;
+    const Token& token = m_tokens[m_position++];
+    if (token.type != TokenKey)
+    {
+        if (m_position - 1 == m_filterKey)
+            m_filterKey = NoPosition; // Left the filtered object
+        return false; // End of the object
+    }
+    name = token.string;
+    m_memberHash = token.hash;
+    return true;
+}
+
+bool PlayFabJsonReader::StartArray()
+{
+    if (m_position >= m_tokens.size() || m_tokens[m_position].type != TokenStartArray)
+    {
+        Skip();
+        return false;
+    }
+    m_arraySize = m_tokens[m_position].length;
+    m_position++;
+    return true;
+}
+
+bool PlayFabJsonReader::NextElement()
+{
+    if (m_position >= m_tokens.size())
+        return false;
+    if (m_tokens[m_position].type != TokenEndArray)
+        return true;
+    m_position++;
+    return false;
+}
+
+const rapidjson::Value& PlayFabJsonReader::GetValue()
+{
+    if (m_position >= m_tokens.size())
+    {
+        m_value.SetNull();
+        return m_value;
+    }
+
+    const Token& token = m_tokens[m_position];
+    switch (token.type)
+    {
+    case TokenBool:
+        m_value.SetBool(token.boolean);
+        break;
+    case TokenInt:
+        m_value.SetInt(token.intValue);
+        break;
+    case TokenUint:
+        m_value.SetUint(token.uintValue);
+        break;
+    case TokenInt64:
+        m_value.SetInt64(token.int64Value);
+        break;
+    case TokenUint64:
+        m_value.SetUint64(token.uint64Value);
+        break;
+    case TokenDouble:
+        m_value.SetDouble(token.doubleValue);
+        break;
+    case TokenString:
+        m_value.SetString(token.string, token.length);
+        break;
+    default:
+        m_value.SetNull();
+        break;
+    }
+    Skip();
+    return m_value;
+}
+
+void PlayFabJsonReader::Skip()
+{
+    if (m_position >= m_tokens.size())
+        return;
+    const Token& token = m_tokens[m_position];
+    if (token.type == TokenStartObject || token.type == TokenStartArray)
+        m_position = token.end;
+    else
+        m_position++;
+}
@@ -0,0 +1,120 @@
+#include "StdAfx.h"
+#include "PlayFabRequestCoalescer.h"
+
+#include <AzCore/std/parallel/lock.h>
+
+using namespace PlayFabClientSdk;
+
+// Reads which return the same thing to every identical caller. Not every Get* api qualifies: some mint a token, nonce,
+// signed url or paging cursor per call (GetPhotonAuthenticationToken, GetWindowsHelloChallenge, GetContentDownloadUrl,
+// GetPlayersInSegment, ...), and one response handed to several callers would be wrong for all but one of them.
+static const char* const CoalescableApis[] =
+{
+    "GetAccountInfo",
+    "GetAllActionGroups",
+    "GetAllSegments",
+    "GetAllUsersCharacters",
+    "GetCatalogItems",
+    "GetCharacterData",
+    "GetCharacterInternalData",
+    "GetCharacterInventory",
+    "GetCharacterLeaderboard",
+    "GetCharacterReadOnlyData",
+    "GetCharacterStatistics",
+    "GetCurrentGames",
+    "GetFriendLeaderboard",
+    "GetFriendLeaderboardAroundPlayer",
+    "GetFriendsList",
+    "GetGameServerRegions",
+    "GetLeaderboard",
+    "GetLeaderboardAroundCharacter",
+    "GetLeaderboardAroundPlayer",
+    "GetLeaderboardAroundUser",
+    "GetLeaderboardForUserCharacters",
+    "GetPlayFabIDsFromFacebookIDs",
+    "GetPlayFabIDsFromGameCenterIDs",
+    "GetPlayFabIDsFromGenericIDs",
+    "GetPlayFabIDsFromGoogleIDs",
+    "GetPlayFabIDsFromKongregateIDs",
+    "GetPlayFabIDsFromSteamIDs",
+    "GetPlayFabIDsFromTwitchIDs",
+    "GetPlayerCombinedInfo",
+    "GetPlayerProfile",
+    "GetPlayerSegments",
+    "GetPlayerStatisticDefinitions",
+    "GetPlayerStatisticVersions",
+    "GetPlayerStatistics",
+    "GetPlayerTags",
+    "GetPublisherData",
+    "GetRandomResultTables",
+    "GetSharedGroupData",
+    "GetStoreItems",
+    "GetTime",
+    "GetTitleData",
+    "GetTitleInternalData",
+    "GetTitleNews",
+    "GetUserAccountInfo",
+    "GetUserBans",
+    "GetUserData",
+    "GetUserInternalData",
+    "GetUserInventory",
+    "GetUserPublisherData",
+    "GetUserPublisherInternalData",
+    "GetUserPublisherReadOnlyData",
+    "GetUserReadOnlyData",
+};
+
+bool PlayFabRequestCoalescer::IsCoalescable(const AZStd::string& callPath)
+{
+    size_t nameStart = callPath.rfind('/');
+    const char* name = callPath.c_str() + (nameStart == AZStd::string::npos ? 0 : nameStart + 1);
+    for (const char* api : CoalescableApis)
+    {
+        if (strcmp(name, api) == 0)
+            return true;
+    }
+    return false;
+}
+
+bool PlayFabRequestCoalescer::JoinOrLead(PlayFabRequest* request)
+{
+    if (!IsCoalescable(request->mCallPath))
+        return false;
+
+    // The full text is the key, rather than a hash of it, so that distinct requests can never share a response.
+    // Lazy and fully decoded calls to the same api have different result types, so they are kept apart too.
+    AZStd::string key = request->mURI + (request->mStreamResponse ? "\nlazy\n" : "\n") + request->mAuthKey + ':' + request->mAuthValue + '\n';
+    key.append(request->GetRequestBody(), request->GetRequestBodySize());
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabCoalescingStats& stats = m_stats[request->mCallPath];
+    stats.requests++;
+
+    auto leader = m_leaders.find(key);
+    if (leader != m_leaders.end())
+    {
+        leader->second->mFollowers.push_back(request);
+        stats.coalesced++;
+        return true;
+    }
+
+    request->mCoalesceKey = key;
+    m_leaders[key] = request;
+    return false;
+}
+
+void PlayFabRequestCoalescer::Finish(PlayFabRequest* request)
+{
+    if (request->mCoalesceKey.empty())
+        return;
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_leaders.erase(request->mCoalesceKey);
+    request->mCoalesceKey.clear();
+}
+
+AZStd::unordered_map<AZStd::string, PlayFabCoalescingStats> PlayFabRequestCoalescer::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    return m_stats;
+}
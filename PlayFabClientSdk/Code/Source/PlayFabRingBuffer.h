@@ -0,0 +1,114 @@
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace PlayFabClientSdk
+{
+    // Fixed size queue which any number of threads can push to and pop from without a lock.
+    // Every slot is allocated up front, and values are moved in and out of them, so pushing and popping never allocate.
+    // Each slot carries a sequence number, which says whether it is ready to be written or read for the current lap of the ring.
+    template <typename ValueType>
+    class PlayFabRingBuffer
+    {
+    public:
+        // capacity is rounded up to a power of two
+        explicit PlayFabRingBuffer(size_t capacity)
+            : m_capacity(CapacityFor(capacity))
+            , m_slots(new Slot[m_capacity])
+            , m_pushPosition(0)
+            , m_popPosition(0)
+        {
+            for (size_t i = 0; i < m_capacity; ++i)
+                m_slots[i].sequence.store(i, AZStd::memory_order_relaxed);
+        }
+
+        ~PlayFabRingBuffer()
+        {
+            delete[] m_slots;
+        }
+
+        // Move value into the ring, or return false, leaving value untouched, if the ring is full
+        bool TryPush(ValueType& value)
+        {
+            size_t position = m_pushPosition.load(AZStd::memory_order_relaxed);
+            for (;;)
+            {
+                Slot& slot = m_slots[position & (m_capacity - 1)];
+                size_t sequence = slot.sequence.load(AZStd::memory_order_acquire);
+                ptrdiff_t lag = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+                if (lag == 0)
+                {
+                    if (m_pushPosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        slot.value = AZStd::move(value);
+                        slot.sequence.store(position + 1, AZStd::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                    return false; // The slot still holds the value from the previous lap
+                else
+                    position = m_pushPosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        // Move the oldest value out of the ring, or return false if it is empty
+        bool TryPop(ValueType& value)
+        {
+            size_t position = m_popPosition.load(AZStd::memory_order_relaxed);
+            for (;;)
+            {
+                Slot& slot = m_slots[position & (m_capacity - 1)];
+                size_t sequence = slot.sequence.load(AZStd::memory_order_acquire);
+                ptrdiff_t lag = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position + 1);
+                if (lag == 0)
+                {
+                    if (m_popPosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        value = AZStd::move(slot.value);
+                        slot.sequence.store(position + m_capacity, AZStd::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (lag < 0)
+                    return false; // The slot has not been written this lap
+                else
+                    position = m_popPosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        // Approximate while other threads are pushing or popping
+        size_t Size() const
+        {
+            size_t pushed = m_pushPosition.load(AZStd::memory_order_relaxed);
+            size_t popped = m_popPosition.load(AZStd::memory_order_relaxed);
+            return pushed > popped ? AZStd::GetMin(pushed - popped, m_capacity) : 0;
+        }
+        size_t Capacity() const { return m_capacity; }
+
+    private:
+        struct Slot
+        {
+            AZStd::atomic<size_t> sequence;
+            ValueType value;
+        };
+
+        static size_t CapacityFor(size_t capacity)
+        {
+            size_t rounded = 2;
+            while (rounded < capacity)
+                rounded *= 2;
+            return rounded;
+        }
+
+        const size_t m_capacity;
+        Slot* const m_slots;
+        AZStd::atomic<size_t> m_pushPosition;
+        AZStd::atomic<size_t> m_popPosition;
+
+        PlayFabRingBuffer(const PlayFabRingBuffer&);
+        PlayFabRingBuffer& operator=(const PlayFabRingBuffer&);
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace PlayFabClientSdk
+{
+    // The current version of an immutable snapshot, shared with readers on any thread, see PlayFabTitleDataCache and PlayFabCatalogCache.
+    // Readers take a reference counted handle, so a replaced snapshot is freed when the last handle to it is released, however long a reader keeps one.
+    // Get may be called from any thread, calls to Publish must be serialized by the owner.
+    template<typename Snapshot>
+    class PlayFabSnapshotPublisher
+    {
+    public:
+        typedef AZStd::shared_ptr<const Snapshot> Handle;
+
+        explicit PlayFabSnapshotPublisher(Handle initial) : m_current(AZStd::move(initial)) {}
+        PlayFabSnapshotPublisher(const PlayFabSnapshotPublisher&) = delete;
+        PlayFabSnapshotPublisher& operator=(const PlayFabSnapshotPublisher&) = delete;
+
+        // Does not take the owner's lock or allocate, only the reference count is touched
+        Handle Get() const { return AZStd::atomic_load(&m_current); }
+        // Replace the current snapshot. Readers which already hold the previous one keep it until they release it.
+        void Publish(Handle snapshot) { AZStd::atomic_store(&m_current, AZStd::move(snapshot)); }
+
+    private:
+        Handle m_current;
+    };
+}
@@ -3,6 +3,37 @@
 
 #include <AzTest/AzTest.h>
 
+#include <PlayFabClientSdk/PlayFabHttp.h>
+#include "PlayFabRequestQueue.h"
+#include "PlayFabHttpClientPool.h"
+#include "PlayFabRetryPolicy.h"
+#include "PlayFabRateLimiter.h"
+#include "PlayFabRequestCoalescer.h"
+#include "PlayFabCompression.h"
+#include "PlayFabBufferPool.h"
+#include "PlayFabJsonArenaPool.h"
+#include "PlayFabRequestBodyPool.h"
+#include <PlayFabClientSdk/PlayFabClientDataModels.h>
+#include <PlayFabClientSdk/PlayFabLazyModel.h>
+#include <PlayFabClientSdk/PlayFabClient_TitleDatabus.h>
+#include "PlayFabTitleDataCache.h"
+#include "PlayFabCatalogCache.h"
+#include "PlayFabTelemetryPipeline.h"
+#include "PlayFabSettings.h"
+
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <type_traits>
+
+using namespace PlayFabClientSdk;
+
 class PlayFabClientSdkTest
     : public ::testing::Test
 {
@@ -16,6 +47,16 @@ protected:
     {
 
     }
+
+    static PlayFabRequest* CreateTestRequest(const AZStd::string& callPath)
+    {
+        return new PlayFabRequest("https://test.playfabapi.com" + callPath, Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, nullptr, nullptr, nullptr);
+    }
+
+    static AZ::u64 MicrosecondsSince(AZStd::chrono::system_clock::time_point start)
+    {
+        return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start).count();
+    }
 };
 
 TEST_F(PlayFabClientSdkTest, ExampleTest)
@@ -23,4 +64,2312 @@ TEST_F(PlayFabClientSdkTest, ExampleTest)
     ASSERT_TRUE(true);
 }
 
+// Enqueue-to-send latency: how long a request sits in the queue while a worker is idle.
+// "Before" replays the old worker loop, which polled the queue and slept 33 ms whenever it was empty.
+TEST_F(PlayFabClientSdkTest, RequestQueue_EnqueueToSendLatency_Benchmark)
+{
+    const int sampleCount = 30;
+
+    // Before: polling worker
+    AZ::u64 pollingTotalUs = 0;
+    {
+        AZStd::queue<PlayFabRequest*> requests;
+        AZStd::mutex requestMutex;
+        AZStd::atomic<bool> running(true);
+        AZStd::atomic<AZ::u64> latencyUs(0);
+        AZStd::atomic<int> received(0);
+
+        AZStd::thread worker([&]()
+        {
+            while (running)
+            {
+                PlayFabRequest* request = nullptr;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(requestMutex);
+                    if (!requests.empty())
+                    {
+                        request = requests.front();
+                        requests.pop();
+                    }
+                }
+                if (request == nullptr)
+                {
+                    CrySleep(33);
+                    continue;
+                }
+                latencyUs += MicrosecondsSince(request->mQueuedTime);
+                received++;
+                delete request;
+            }
+        });
+
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            PlayFabRequest* request = CreateTestRequest("/Server/GetTime");
+            request->mQueuedTime = AZStd::chrono::system_clock::now();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(requestMutex);
+                requests.push(request);
+            }
+            while (received <= i)
+                CrySleep(1);
+            CrySleep(3 + (i % 7)); // Let the worker go idle again, at a point which varies within its sleep
+        }
+        running = false;
+        worker.join();
+        pollingTotalUs = latencyUs;
+    }
+
+    // After: worker blocked on the request queue's condition variable
+    AZ::u64 blockingTotalUs = 0;
+    {
+        PlayFabRequestQueue queue(1, 2000);
+        AZStd::atomic<AZ::u64> latencyUs(0);
+        AZStd::atomic<int> received(0);
+
+        AZStd::thread worker([&]()
+        {
+            while (PlayFabRequest* request = queue.Pop())
+            {
+                latencyUs += MicrosecondsSince(request->mQueuedTime);
+                received++;
+                queue.Complete(request->mPriority);
+                delete request;
+            }
+        });
+
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            PlayFabRequest* request = CreateTestRequest("/Server/GetTime");
+            request->mQueuedTime = AZStd::chrono::system_clock::now();
+            queue.Push(request);
+            while (received <= i)
+                CrySleep(1);
+            CrySleep(3 + (i % 7));
+        }
+        queue.Shutdown();
+        worker.join();
+        blockingTotalUs = latencyUs;
+    }
+
+    printf("Enqueue-to-send latency, average over %d requests: polling %llu us, condition variable %llu us\n", sampleCount,
+        static_cast<unsigned long long>(pollingTotalUs / sampleCount), static_cast<unsigned long long>(blockingTotalUs / sampleCount));
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_ShutdownReleasesIdleWorkers)
+{
+    PlayFabRequestQueue queue(1, 2000);
+    AZStd::atomic<int> exited(0);
+    AZStd::thread workers[4];
+    for (auto& worker : workers)
+    {
+        worker = AZStd::thread([&]()
+        {
+            while (queue.Pop() != nullptr) {}
+            exited++;
+        });
+    }
+
+    queue.Shutdown();
+    for (auto& worker : workers)
+        worker.join();
+    EXPECT_EQ(4, exited);
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_PendingCountIncludesInFlight)
+{
+    PlayFabRequestQueue queue(1, 2000);
+    PlayFabRequest* first = CreateTestRequest("/Server/GetTime");
+    PlayFabRequest* second = CreateTestRequest("/Server/GetTime");
+    queue.Push(first);
+    queue.Push(second);
+    EXPECT_EQ(2, queue.GetPendingCount());
+
+    PlayFabRequest* popped = queue.Pop();
+    EXPECT_EQ(first, popped);
+    EXPECT_EQ(2, queue.GetPendingCount());
+
+    queue.Complete(popped->mPriority);
+    EXPECT_EQ(1, queue.GetPendingCount());
+    delete first;
+    // The queue deletes the unsent second request
+}
+
+TEST_F(PlayFabClientSdkTest, RequestPriority_EndpointDefaults)
+{
+    EXPECT_EQ(PlayFabRequestPriorityCritical, PlayFabRequestManager::GetDefaultPriority("/Client/LoginWithCustomID"));
+    EXPECT_EQ(PlayFabRequestPriorityCritical, PlayFabRequestManager::GetDefaultPriority("/Server/RefreshGameServerInstanceHeartbeat"));
+    EXPECT_EQ(PlayFabRequestPriorityGameplay, PlayFabRequestManager::GetDefaultPriority("/Server/GetTime"));
+    EXPECT_EQ(PlayFabRequestPriorityBackground, PlayFabRequestManager::GetDefaultPriority("/Server/WriteTitleEvent"));
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_HigherPriorityFirst)
+{
+    PlayFabRequestQueue queue(1, 2000);
+    PlayFabRequest* background = CreateTestRequest("/Server/WriteTitleEvent");
+    background->mPriority = PlayFabRequestPriorityBackground;
+    PlayFabRequest* gameplay = CreateTestRequest("/Server/GetTime");
+    gameplay->mPriority = PlayFabRequestPriorityGameplay;
+    PlayFabRequest* critical = CreateTestRequest("/Server/RefreshGameServerInstanceHeartbeat");
+    critical->mPriority = PlayFabRequestPriorityCritical;
+    for (PlayFabRequest* request : { background, gameplay, critical })
+    {
+        request->mQueuedTime = AZStd::chrono::system_clock::now();
+        queue.Push(request);
+    }
+
+    EXPECT_EQ(critical, queue.Pop());
+    EXPECT_EQ(gameplay, queue.Pop());
+    EXPECT_EQ(background, queue.Pop());
+
+    delete background;
+    delete gameplay;
+    delete critical;
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_BackgroundAging)
+{
+    PlayFabRequestQueue queue(1, 20);
+    PlayFabRequest* background = CreateTestRequest("/Server/WriteTitleEvent");
+    background->mPriority = PlayFabRequestPriorityBackground;
+    background->mQueuedTime = AZStd::chrono::system_clock::now();
+    queue.Push(background);
+    CrySleep(30);
+
+    PlayFabRequest* gameplay = CreateTestRequest("/Server/GetTime");
+    gameplay->mPriority = PlayFabRequestPriorityGameplay;
+    gameplay->mQueuedTime = AZStd::chrono::system_clock::now();
+    queue.Push(gameplay);
+
+    EXPECT_EQ(background, queue.Pop());
+    EXPECT_EQ(gameplay, queue.Pop());
+
+    delete background;
+    delete gameplay;
+}
+
+TEST_F(PlayFabClientSdkTest, ClientPool_HigherPriorityGetsNextConnectionUnderBackgroundLoad)
+{
+    const AZStd::string host = "test.playfabapi.com";
+    PlayFabHttpClientPool pool(4, 60000);
+
+    // Background load takes every connection it may, which leaves one for higher priorities
+    AZStd::vector<std::shared_ptr<Aws::Http::HttpClient>> background;
+    for (int i = 0; i < 3; ++i)
+        background.push_back(pool.AcquireClient(host, PlayFabRequestPriorityBackground));
+    std::shared_ptr<Aws::Http::HttpClient> gameplay = pool.AcquireClient(host, PlayFabRequestPriorityGameplay);
+    ASSERT_TRUE(gameplay != nullptr);
+    EXPECT_EQ(4, pool.GetStats().activeConnections);
+
+    // With the pool saturated, a background request starts waiting before a critical one
+    AZStd::atomic<int> acquireOrder(0);
+    AZStd::atomic<int> backgroundOrder(0);
+    AZStd::atomic<int> criticalOrder(0);
+    std::shared_ptr<Aws::Http::HttpClient> backgroundClient;
+    std::shared_ptr<Aws::Http::HttpClient> criticalClient;
+    AZStd::thread backgroundWaiter([&]()
+    {
+        backgroundClient = pool.AcquireClient(host, PlayFabRequestPriorityBackground);
+        backgroundOrder = ++acquireOrder;
+    });
+    CrySleep(30);
+    AZStd::thread criticalWaiter([&]()
+    {
+        criticalClient = pool.AcquireClient(host, PlayFabRequestPriorityCritical);
+        criticalOrder = ++acquireOrder;
+    });
+    CrySleep(30);
+    EXPECT_EQ(0, acquireOrder.load());
+
+    // The freed connection goes to the critical request, and the background one keeps waiting
+    pool.ReleaseClient(host, background[0], true);
+    criticalWaiter.join();
+    EXPECT_EQ(1, criticalOrder.load());
+    EXPECT_TRUE(criticalClient == background[0]);
+    CrySleep(30);
+    EXPECT_EQ(0, backgroundOrder.load());
+
+    // Freeing the gameplay connection still leaves background at its limit, it only gets the next one
+    pool.ReleaseClient(host, gameplay, true);
+    CrySleep(30);
+    EXPECT_EQ(0, backgroundOrder.load());
+    pool.ReleaseClient(host, background[1], true);
+    backgroundWaiter.join();
+    EXPECT_EQ(2, backgroundOrder.load());
+
+    pool.ReleaseClient(host, background[2], true);
+    pool.ReleaseClient(host, criticalClient, true);
+    pool.ReleaseClient(host, backgroundClient, true);
+    EXPECT_EQ(0, pool.GetStats().activeConnections);
+}
+
+// Heartbeat queue wait during a telemetry burst, with every request in one class (the old single fifo) and with default priorities
+static AZ::u64 MeasureHeartbeatQueueWaitP99(bool usePriorities)
+{
+    const int workerCount = 4;
+    const int telemetryCount = 200;
+    const int heartbeatCount = 20;
+
+    PlayFabRequestQueue queue(workerCount - 1, 2000);
+    AZStd::vector<PlayFabRequest*> heartbeats;
+    AZStd::vector<PlayFabRequest*> allRequests;
+
+    AZStd::vector<AZStd::thread> workers;
+    for (int i = 0; i < workerCount; ++i)
+    {
+        workers.push_back(AZStd::thread([&queue]()
+        {
+            while (PlayFabRequest* request = queue.Pop())
+            {
+                request->mSentTime = AZStd::chrono::system_clock::now();
+                CrySleep(10); // Simulated round trip
+                queue.Complete(request->mPriority);
+            }
+        }));
+    }
+
+    auto push = [&](const char* callPath)
+    {
+        PlayFabRequest* request = new PlayFabRequest(AZStd::string("https://test.playfabapi.com") + callPath, Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, nullptr, nullptr, nullptr);
+        request->mPriority = usePriorities ? PlayFabRequestManager::GetDefaultPriority(request->mCallPath) : PlayFabRequestPriorityGameplay;
+        request->mQueuedTime = AZStd::chrono::system_clock::now();
+        allRequests.push_back(request);
+        queue.Push(request);
+        return request;
+    };
+
+    for (int i = 0; i < telemetryCount; ++i)
+        push("/Server/WriteTitleEvent");
+    for (int i = 0; i < heartbeatCount; ++i)
+    {
+        heartbeats.push_back(push("/Server/RefreshGameServerInstanceHeartbeat"));
+        CrySleep(15);
+    }
+
+    while (queue.GetPendingCount() > 0)
+        CrySleep(5);
+    queue.Shutdown();
+    for (auto& worker : workers)
+        worker.join();
+
+    AZStd::vector<AZ::u64> waits;
+    for (PlayFabRequest* heartbeat : heartbeats)
+        waits.push_back(heartbeat->GetQueueWaitMicroseconds());
+    AZStd::sort(waits.begin(), waits.end());
+    for (PlayFabRequest* request : allRequests)
+        delete request;
+    return waits[(waits.size() * 99) / 100];
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_HeartbeatLatencyDuringTelemetryBurst_Benchmark)
+{
+    AZ::u64 fifoP99 = MeasureHeartbeatQueueWaitP99(false);
+    AZ::u64 priorityP99 = MeasureHeartbeatQueueWaitP99(true);
+    printf("Heartbeat queue wait p99 during a telemetry burst: single fifo %llu us, priority classes %llu us\n",
+        static_cast<unsigned long long>(fifoP99), static_cast<unsigned long long>(priorityP99));
+}
+
+struct CallbackTestResult
+{
+    int value;
+};
+
+static AZStd::atomic<int> s_resultCallbacks(0);
+static AZStd::atomic<int> s_errorCallbacks(0);
+static AZStd::atomic<int> s_lastErrorCode(0);
+
+static void SlowResultCallback(const CallbackTestResult& result, void* customData)
+{
+    (void)result;
+    (void)customData;
+    CrySleep(1);
+    s_resultCallbacks++;
+}
+
+static void CountingErrorCallback(const PlayFabError& error, void* customData)
+{
+    (void)customData;
+    s_lastErrorCode = error.ErrorCode;
+    s_errorCallbacks++;
+}
+
+class PlayFabClientSdkCallbackTest
+    : public PlayFabClientSdkTest
+{
+protected:
+    void SetUp() override
+    {
+        PlayFabSettings::playFabSettings = new PlayFabSettings();
+        PlayFabSettings::playFabSettings->httpWorkerThreads = 1;
+        PlayFabRequestManager::playFabHttp = new PlayFabRequestManager();
+        s_resultCallbacks = 0;
+        s_errorCallbacks = 0;
+    }
+
+    void TearDown() override
+    {
+        SAFE_DELETE(PlayFabRequestManager::playFabHttp);
+        SAFE_DELETE(PlayFabSettings::playFabSettings);
+    }
+
+    static void DispatchTestResult()
+    {
+        PlayFabRequest* request = new PlayFabRequest("https://test.playfabapi.com/Server/GetTime", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, nullptr);
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, new CallbackTestResult());
+    }
+};
+
+TEST_F(PlayFabClientSdkCallbackTest, Callbacks_Immediate_RunOnDispatchingThread)
+{
+    DispatchTestResult();
+    EXPECT_EQ(1, s_resultCallbacks);
+    EXPECT_EQ(0, PlayFabRequestManager::playFabHttp->GetCallbackStats().queuedCallbacks);
+}
+
+TEST_F(PlayFabClientSdkCallbackTest, Callbacks_MainThread_SpreadAcrossTicksByBudget)
+{
+    PlayFabSettings::playFabSettings->callbacksOnMainThread = true;
+    const int resultCount = 10;
+    AZStd::thread worker([]()
+    {
+        for (int i = 0; i < resultCount; ++i)
+            DispatchTestResult();
+    });
+    worker.join();
+
+    EXPECT_EQ(0, s_resultCallbacks);
+    EXPECT_EQ(resultCount, PlayFabRequestManager::playFabHttp->GetCallbackStats().queuedCallbacks);
+
+    // Each callback takes at least 1 ms, so a 2.5 ms budget cannot deliver all of them in one tick
+    PlayFabRequestManager::playFabHttp->DispatchQueuedCallbacks(2500);
+    EXPECT_GT(s_resultCallbacks, 0);
+    EXPECT_LT(s_resultCallbacks, resultCount);
+
+    int ticks = 1;
+    while (PlayFabRequestManager::playFabHttp->GetCallbackStats().queuedCallbacks > 0)
+    {
+        PlayFabRequestManager::playFabHttp->DispatchQueuedCallbacks(2500);
+        ticks++;
+    }
+
+    PlayFabCallbackStats stats = PlayFabRequestManager::playFabHttp->GetCallbackStats();
+    EXPECT_EQ(resultCount, s_resultCallbacks);
+    EXPECT_EQ(resultCount, static_cast<int>(stats.dispatchedCallbacks));
+    EXPECT_EQ(resultCount, stats.maxQueuedCallbacks);
+    EXPECT_EQ(ticks - 1, static_cast<int>(stats.deferredTicks));
+    EXPECT_GT(stats.budgetOverruns, 0u);
+}
+
+TEST_F(PlayFabClientSdkCallbackTest, Callbacks_MainThread_ErrorsAreQueuedToo)
+{
+    PlayFabSettings::playFabSettings->callbacksOnMainThread = true;
+    PlayFabRequest* request = new PlayFabRequest("https://test.playfabapi.com/Server/GetTime", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, nullptr);
+    request->HandleErrorReport(); // No response, reported as a connection timeout
+
+    EXPECT_EQ(0, s_errorCallbacks);
+    PlayFabRequestManager::playFabHttp->DispatchQueuedCallbacks(0);
+    EXPECT_EQ(1, s_errorCallbacks);
+    EXPECT_EQ(0, s_resultCallbacks);
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_DelayedRequestWaitsForItsTime)
+{
+    PlayFabRequestQueue queue(1, 2000);
+    PlayFabRequest* delayed = CreateTestRequest("/Server/GetTime");
+    auto pushTime = AZStd::chrono::system_clock::now();
+    delayed->mQueuedTime = pushTime + AZStd::chrono::milliseconds(30);
+    queue.PushDelayed(delayed);
+    EXPECT_EQ(1, queue.GetPendingCount());
+
+    EXPECT_EQ(delayed, queue.Pop());
+    EXPECT_GE(MicrosecondsSince(pushTime), 30000u);
+    delete delayed;
+}
+
+TEST_F(PlayFabClientSdkTest, RequestQueue_DelayedRequestsPromotedInDueOrder)
+{
+    PlayFabRequestQueue queue(1, 2000);
+    auto dueTime = AZStd::chrono::system_clock::now() + AZStd::chrono::milliseconds(20);
+    PlayFabRequest* late = CreateTestRequest("/Client/GetTime");
+    PlayFabRequest* first = CreateTestRequest("/Client/GetTime");
+    PlayFabRequest* second = CreateTestRequest("/Client/GetTime");
+    PlayFabRequest* early = CreateTestRequest("/Client/GetTime");
+    late->mQueuedTime = dueTime + AZStd::chrono::milliseconds(10);
+    first->mQueuedTime = dueTime;
+    second->mQueuedTime = dueTime;
+    early->mQueuedTime = dueTime - AZStd::chrono::milliseconds(10);
+    queue.PushDelayed(late);
+    queue.PushDelayed(first);
+    queue.PushDelayed(second);
+    queue.PushDelayed(early);
+
+    // Earliest due first, and requests due at the same time keep the order they were pushed in
+    PlayFabRequest* expected[] = { early, first, second, late };
+    for (PlayFabRequest* request : expected)
+    {
+        EXPECT_EQ(request, queue.Pop());
+        queue.Complete(request->mPriority);
+        delete request;
+    }
+}
+
+TEST_F(PlayFabClientSdkTest, RetryPolicy_OnlyIdempotentApis)
+{
+    EXPECT_TRUE(PlayFabRetryPolicy::IsIdempotent("/Server/GetTime"));
+    EXPECT_TRUE(PlayFabRetryPolicy::IsIdempotent("/Client/LoginWithCustomID"));
+    EXPECT_TRUE(PlayFabRetryPolicy::IsIdempotent("/Server/RefreshGameServerInstanceHeartbeat"));
+    EXPECT_FALSE(PlayFabRetryPolicy::IsIdempotent("/Client/PurchaseItem"));
+    EXPECT_FALSE(PlayFabRetryPolicy::IsIdempotent("/Server/AddUserVirtualCurrency"));
+    EXPECT_FALSE(PlayFabRetryPolicy::IsIdempotent("/Server/WriteTitleEvent"));
+}
+
+TEST_F(PlayFabClientSdkTest, RetryPolicy_LoginWhichCreatesTheAccountNotRetried)
+{
+    auto createLogin = [](const char* body)
+    {
+        return new PlayFabRequest("https://test.playfabapi.com/Client/LoginWithCustomID", Aws::Http::HttpMethod::HTTP_POST, "", "", body, nullptr, nullptr, nullptr, nullptr);
+    };
+    PlayFabRequest* login = createLogin("{\"CustomId\":\"a\"}");
+    PlayFabRequest* loginNoCreate = createLogin("{\"CustomId\":\"a\",\"CreateAccount\":false}");
+    PlayFabRequest* loginCreate = createLogin("{\"CustomId\":\"a\",\"CreateAccount\":true}");
+    EXPECT_TRUE(PlayFabRetryPolicy::IsIdempotent(login));
+    EXPECT_TRUE(PlayFabRetryPolicy::IsIdempotent(loginNoCreate));
+    EXPECT_FALSE(PlayFabRetryPolicy::IsIdempotent(loginCreate));
+
+    // No response is a transient failure, so only the login which creates the account is refused
+    PlayFabRetryPolicy policy(3, 10, 200, 10);
+    int delayMs = 0;
+    EXPECT_TRUE(policy.ShouldRetry(login, delayMs));
+    EXPECT_FALSE(policy.ShouldRetry(loginCreate, delayMs));
+    delete login;
+    delete loginNoCreate;
+    delete loginCreate;
+}
+
+TEST_F(PlayFabClientSdkTest, RetryPolicy_BackoffWithinBoundsAndBudgetLimited)
+{
+    PlayFabRetryPolicy policy(100, 10, 200, 10);
+    PlayFabRequest* request = CreateTestRequest("/Server/GetTime"); // No response, a transient failure
+
+    int retries = 0;
+    int delayMs = 0;
+    while (policy.ShouldRetry(request, delayMs) && policy.CommitRetry(request))
+    {
+        EXPECT_GE(delayMs, 10);
+        EXPECT_LE(delayMs, 200);
+        request->mRetryCount++;
+        request->mRetryDelayMs = delayMs;
+        retries++;
+    }
+    // Only the burst allowance is available before any new requests have paid into the budget
+    EXPECT_EQ(10, retries);
+
+    // Ten new requests at 10% pay for exactly one more retry
+    for (int i = 0; i < 10; ++i)
+        policy.OnNewRequest();
+    EXPECT_TRUE(policy.ShouldRetry(request, delayMs) && policy.CommitRetry(request));
+    EXPECT_FALSE(policy.ShouldRetry(request, delayMs));
+
+    PlayFabRetryStats stats = policy.GetStats()["/Server/GetTime"];
+    EXPECT_EQ(11u, stats.retries);
+    EXPECT_EQ(2u, stats.budgetRejected);
+    delete request;
+}
+
+TEST_F(PlayFabClientSdkTest, RetryPolicy_RefusedRetryIsNotCharged)
+{
+    PlayFabRetryPolicy policy(100, 10, 200, 10);
+    PlayFabRequest* request = CreateTestRequest("/Client/GetTime");
+
+    // Approved retries the rate limiter then refuses are never committed, and cost nothing
+    int delayMs = 0;
+    for (int i = 0; i < 20; ++i)
+        EXPECT_TRUE(policy.ShouldRetry(request, delayMs));
+    EXPECT_EQ(0u, policy.GetStats()["/Client/GetTime"].retries);
+
+    // So the whole burst allowance is still there
+    int retries = 0;
+    while (policy.ShouldRetry(request, delayMs) && policy.CommitRetry(request))
+        retries++;
+    EXPECT_EQ(10, retries);
+    EXPECT_EQ(10u, policy.GetStats()["/Client/GetTime"].retries);
+    delete request;
+}
+
+TEST_F(PlayFabClientSdkTest, RetryPolicy_OnlySuccessfulFinalResponsesAreRecovered)
+{
+    PlayFabRetryPolicy policy(3, 10, 200, 10);
+    PlayFabRequest* request = CreateTestRequest("/Client/GetTime");
+    request->mRetryCount = 1;
+
+    // A permanent failure after a retry
+    auto httpRequest = Aws::Http::CreateHttpRequest(Aws::String(request->mURI.c_str()), Aws::Http::HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = std::make_shared<Aws::Http::Standard::StandardHttpResponse>(*httpRequest);
+    response->SetResponseCode(Aws::Http::HttpResponseCode::BAD_REQUEST);
+    request->httpResponse = response;
+    request->mHttpCode = Aws::Http::HttpResponseCode::BAD_REQUEST;
+    EXPECT_FALSE(PlayFabRetryPolicy::IsTransientFailure(request));
+    policy.RecordResult(request);
+    EXPECT_EQ(0u, policy.GetStats()["/Client/GetTime"].recovered);
+
+    // Success after a retry
+    response->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    request->mHttpCode = Aws::Http::HttpResponseCode::OK;
+    policy.RecordResult(request);
+    EXPECT_EQ(1u, policy.GetStats()["/Client/GetTime"].recovered);
+
+    // Success without a retry
+    request->mRetryCount = 0;
+    policy.RecordResult(request);
+    EXPECT_EQ(1u, policy.GetStats()["/Client/GetTime"].recovered);
+    delete request;
+}
+
+static AZStd::atomic<int> s_internalCallbacks(0);
+
+TEST_F(PlayFabClientSdkCallbackTest, Retry_TransientFailuresRetriedOnlyForIdempotentApis)
+{
+    // Replace the manager with one using short backoffs
+    SAFE_DELETE(PlayFabRequestManager::playFabHttp);
+    PlayFabSettings::playFabSettings->httpRetryBaseDelayMs = 1;
+    PlayFabSettings::playFabSettings->httpRetryMaxDelayMs = 5;
+    PlayFabRequestManager::playFabHttp = new PlayFabRequestManager();
+    s_internalCallbacks = 0;
+
+    // The test http client never receives a response
+    auto internalCallback = [](PlayFabRequest* request)
+    {
+        s_internalCallbacks++;
+        request->HandleErrorReport();
+    };
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/GetTime", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, internalCallback));
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/AddUserVirtualCurrency", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, internalCallback));
+    while (PlayFabRequestManager::playFabHttp->GetPendingCalls() > 0)
+        CrySleep(1);
+
+    auto stats = PlayFabRequestManager::playFabHttp->GetRetryStats();
+    EXPECT_EQ(3u, stats["/Server/GetTime"].retries);
+    EXPECT_EQ(1u, stats["/Server/GetTime"].exhausted);
+    EXPECT_EQ(0u, stats["/Server/AddUserVirtualCurrency"].retries);
+    EXPECT_EQ(2, s_internalCallbacks);
+    EXPECT_EQ(2, s_errorCallbacks);
+}
+
+TEST_F(PlayFabClientSdkTest, RateLimiter_BurstThenDelayThenReject)
+{
+    PlayFabRateLimiter limiter(500);
+    limiter.SetTitleLimit(10.0f, 3.0f); // One token per 100 ms
+    auto now = AZStd::chrono::system_clock::now();
+    AZStd::chrono::system_clock::time_point sendTime;
+
+    // The burst goes straight out
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(limiter.Acquire("/Server/GetTime", now, sendTime));
+        EXPECT_TRUE(sendTime == now);
+    }
+
+    // Then requests are spaced out at the refill rate, until the wait would exceed 500 ms
+    for (int i = 1; i <= 5; ++i)
+    {
+        EXPECT_TRUE(limiter.Acquire("/Server/GetTime", now, sendTime));
+        EXPECT_NEAR(i * 100000.0, static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(sendTime - now).count()), 1000.0);
+    }
+    EXPECT_FALSE(limiter.Acquire("/Server/GetTime", now, sendTime));
+
+    PlayFabRateLimitState state = limiter.GetTitleState();
+    EXPECT_EQ(5u, state.delayedRequests);
+    EXPECT_EQ(1u, state.rejectedRequests);
+}
+
+TEST_F(PlayFabClientSdkTest, RateLimiter_EndpointBucketsAreIndependent)
+{
+    PlayFabRateLimiter limiter(0); // Reject rather than delay
+    limiter.SetEndpointLimit("/Server/WriteTitleEvent", 1.0f, 2.0f);
+    auto now = AZStd::chrono::system_clock::now();
+    AZStd::chrono::system_clock::time_point sendTime;
+
+    EXPECT_TRUE(limiter.Acquire("/Server/WriteTitleEvent", now, sendTime));
+    EXPECT_TRUE(limiter.Acquire("/Server/WriteTitleEvent", now, sendTime));
+    EXPECT_FALSE(limiter.Acquire("/Server/WriteTitleEvent", now, sendTime));
+    for (int i = 0; i < 10; ++i)
+        EXPECT_TRUE(limiter.Acquire("/Server/GetTime", now, sendTime));
+
+    EXPECT_EQ(1u, limiter.GetEndpointState("/Server/WriteTitleEvent").rejectedRequests);
+    EXPECT_EQ(0.0f, limiter.GetEndpointState("/Server/GetTime").ratePerSecond);
+}
+
+TEST_F(PlayFabClientSdkCallbackTest, RateLimiter_RejectedRequestsFailLocally)
+{
+    s_lastErrorCode = 0;
+    SAFE_DELETE(PlayFabRequestManager::playFabHttp);
+    PlayFabSettings::playFabSettings->rateLimitMaxDelayMs = 100;
+    PlayFabRequestManager::playFabHttp = new PlayFabRequestManager();
+    auto internalCallback = [](PlayFabRequest* request) { request->HandleErrorReport(); };
+
+    // The first request takes the only token, the second would have to wait a whole second
+    PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetEndpointLimit("/Server/WriteTitleEvent", 1.0f, 1.0f);
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/WriteTitleEvent", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, internalCallback));
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/WriteTitleEvent", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, internalCallback));
+    EXPECT_EQ(PlayFabErrorRateLimitedLocally, s_lastErrorCode); // Reported before AddRequest returns, without being queued
+
+    while (PlayFabRequestManager::playFabHttp->GetPendingCalls() > 0)
+        CrySleep(1);
+    EXPECT_EQ(2, s_errorCallbacks); // The first was sent, and timed out against the test http client
+    EXPECT_EQ(1u, PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetEndpointState("/Server/WriteTitleEvent").rejectedRequests);
+}
+
+TEST_F(PlayFabClientSdkTest, RequestCoalescer_OnlyIdenticalReads)
+{
+    EXPECT_TRUE(PlayFabRequestCoalescer::IsCoalescable("/Server/GetTitleData"));
+    EXPECT_FALSE(PlayFabRequestCoalescer::IsCoalescable("/Server/UpdateUserData"));
+
+    PlayFabRequestCoalescer coalescer;
+    PlayFabRequest* leader = CreateTestRequest("/Server/GetTitleData");
+    PlayFabRequest* duplicate = CreateTestRequest("/Server/GetTitleData");
+    PlayFabRequest* differentBody = new PlayFabRequest("https://test.playfabapi.com/Server/GetTitleData", Aws::Http::HttpMethod::HTTP_POST, "", "", "{\"Keys\":[\"a\"]}", nullptr, nullptr, nullptr, nullptr);
+    EXPECT_FALSE(coalescer.JoinOrLead(leader));
+    EXPECT_TRUE(coalescer.JoinOrLead(duplicate));
+    EXPECT_FALSE(coalescer.JoinOrLead(differentBody));
+    ASSERT_EQ(1u, leader->mFollowers.size());
+
+    // Once the leader's response is being delivered, a new duplicate starts its own flight
+    coalescer.Finish(leader);
+    PlayFabRequest* late = CreateTestRequest("/Server/GetTitleData");
+    EXPECT_FALSE(coalescer.JoinOrLead(late));
+
+    EXPECT_EQ(4u, coalescer.GetStats()["/Server/GetTitleData"].requests);
+    EXPECT_EQ(1u, coalescer.GetStats()["/Server/GetTitleData"].coalesced);
+    delete leader; // And its follower
+    delete differentBody;
+    delete late;
+}
+
+TEST_F(PlayFabClientSdkTest, RequestCoalescer_PerCallTokensNeverShared)
+{
+    // Each caller must get its own token, nonce or signed url, even though these are Get apis
+    EXPECT_FALSE(PlayFabRequestCoalescer::IsCoalescable("/Client/GetPhotonAuthenticationToken"));
+    EXPECT_FALSE(PlayFabRequestCoalescer::IsCoalescable("/Client/GetWindowsHelloChallenge"));
+    EXPECT_FALSE(PlayFabRequestCoalescer::IsCoalescable("/Client/GetContentDownloadUrl"));
+    EXPECT_FALSE(PlayFabRequestCoalescer::IsCoalescable("/Client/GetTitleDataAndMore")); // Only exact names
+
+    PlayFabRequestCoalescer coalescer;
+    PlayFabRequest* first = CreateTestRequest("/Client/GetPhotonAuthenticationToken");
+    PlayFabRequest* second = CreateTestRequest("/Client/GetPhotonAuthenticationToken");
+    EXPECT_FALSE(coalescer.JoinOrLead(first));
+    EXPECT_FALSE(coalescer.JoinOrLead(second));
+    EXPECT_TRUE(first->mFollowers.empty());
+    EXPECT_TRUE(coalescer.GetStats().empty());
+    delete first;
+    delete second;
+}
+
+TEST_F(PlayFabClientSdkCallbackTest, RequestCoalescer_OneResponseFansOutToEveryCaller)
+{
+    SAFE_DELETE(PlayFabRequestManager::playFabHttp);
+    PlayFabSettings::playFabSettings->httpMaxRetries = 0;
+    PlayFabRequestManager::playFabHttp = new PlayFabRequestManager();
+    s_internalCallbacks = 0;
+
+    // Hold the only worker, so every duplicate arrives while the first request is still queued
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/UpdateUserData", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, nullptr, nullptr,
+        [](PlayFabRequest* request) { CrySleep(20); delete request; }));
+
+    const int joinCount = 50;
+    for (int i = 0; i < joinCount; ++i)
+    {
+        PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/GetTitleData", Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", "secret", "{}", nullptr, SlowResultCallback, CountingErrorCallback,
+            [](PlayFabRequest* request) { s_internalCallbacks++; request->HandleErrorReport(); }));
+    }
+    while (PlayFabRequestManager::playFabHttp->GetPendingCalls() > 0)
+        CrySleep(1);
+
+    EXPECT_EQ(1, s_internalCallbacks); // Sent and decoded once
+    EXPECT_EQ(joinCount, s_errorCallbacks); // Reported to every caller
+    PlayFabCoalescingStats stats = PlayFabRequestManager::playFabHttp->GetCoalescingStats()["/Server/GetTitleData"];
+    EXPECT_EQ(static_cast<AZ::u64>(joinCount), stats.requests);
+    EXPECT_EQ(static_cast<AZ::u64>(joinCount - 1), stats.coalesced);
+}
+
+TEST_F(PlayFabClientSdkTest, Compression_RoundTripAndRatio)
+{
+    // A typical large body: user data and statistics repeat the same keys many times over
+    AZStd::string json = "{\"Data\":{";
+    for (int i = 0; i < 200; ++i)
+        json += (i ? ",\"Key" : "\"Key") + AZStd::to_string(i) + "\":{\"Value\":\"" + AZStd::to_string(i * 7) + "\",\"LastUpdated\":\"2017-01-01T00:00:00.000Z\",\"Permission\":\"Private\"}";
+    json += "},\"DataVersion\":42}";
+
+    AZStd::vector<char> compressed;
+    ASSERT_TRUE(PlayFabCompression::Deflate(json.c_str(), json.length(), compressed));
+    float ratio = static_cast<float>(compressed.size()) / json.length();
+    printf("Deflate: %u bytes -> %u bytes (%.1f%%)\n", static_cast<unsigned>(json.length()), static_cast<unsigned>(compressed.size()), ratio * 100.0f);
+    EXPECT_LT(ratio, 0.25f);
+
+    AZStd::vector<char> decompressed;
+    ASSERT_TRUE(PlayFabCompression::Inflate(compressed.data(), compressed.size(), decompressed));
+    EXPECT_EQ(json, AZStd::string(decompressed.data(), decompressed.size()));
+
+    // A body which is not deflate data is refused rather than returned half decoded
+    EXPECT_FALSE(PlayFabCompression::Inflate(json.c_str(), json.length(), decompressed));
+}
+
+TEST_F(PlayFabClientSdkTest, Compression_TruncatedBodyFailsToInflate)
+{
+    AZStd::string json = "{\"Data\":{";
+    for (int i = 0; i < 100; ++i)
+        json += (i ? ",\"Key" : "\"Key") + AZStd::to_string(i) + "\":{\"Value\":\"" + AZStd::to_string(i * 7) + "\"}";
+    json += "},\"DataVersion\":42}";
+
+    AZStd::vector<char> compressed;
+    ASSERT_TRUE(PlayFabCompression::Deflate(json.c_str(), json.length(), compressed));
+
+    // Cut inside the checksum, just before it, and mid stream
+    AZStd::vector<char> decompressed;
+    for (size_t cut : { size_t(1), size_t(4), size_t(5), compressed.size() / 2 })
+        EXPECT_FALSE(PlayFabCompression::Inflate(compressed.data(), compressed.size() - cut, decompressed)) << "cut " << cut;
+    EXPECT_TRUE(PlayFabCompression::Inflate(compressed.data(), compressed.size(), decompressed));
+
+    // A damaged checksum, and bytes after the end of the stream
+    AZStd::vector<char> damaged = compressed;
+    damaged.back() ^= 1;
+    EXPECT_FALSE(PlayFabCompression::Inflate(damaged.data(), damaged.size(), decompressed));
+    AZStd::vector<char> padded = compressed;
+    padded.push_back('}');
+    EXPECT_FALSE(PlayFabCompression::Inflate(padded.data(), padded.size(), decompressed));
+}
+
+TEST_F(PlayFabClientSdkCallbackTest, Compression_UninflatedResponseFailsTheCall)
+{
+    s_lastErrorCode = 0;
+    s_errorCallbacks = 0;
+    EXPECT_FALSE(PlayFabSettings::playFabSettings->httpAcceptCompressedResponses); // Opt in only
+
+    // What ReadResponse leaves when a compressed body will not inflate: the error, and no body to decode
+    PlayFabRequest* request = new PlayFabRequest("https://test.playfabapi.com/Client/GetTime", Aws::Http::HttpMethod::HTTP_POST, "", "", "{}", nullptr, SlowResultCallback, CountingErrorCallback, nullptr);
+    auto httpRequest = Aws::Http::CreateHttpRequest(Aws::String(request->mURI.c_str()), Aws::Http::HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = std::make_shared<Aws::Http::Standard::StandardHttpResponse>(*httpRequest);
+    response->SetResponseCode(Aws::Http::HttpResponseCode::OK);
+    request->httpResponse = response;
+    request->mHttpCode = Aws::Http::HttpResponseCode::OK;
+    EXPECT_FALSE(PlayFabRetryPolicy::IsTransientFailure(request));
+    request->mError = new PlayFabError;
+    request->mError->ErrorCode = PlayFabErrorResponseNotInflated;
+    EXPECT_TRUE(PlayFabRetryPolicy::IsTransientFailure(request)); // Most likely cut short, so worth sending again
+
+    EXPECT_FALSE(PlayFabBaseModel::DecodeRequest(request)); // Dispatches the error, and the request with it
+    EXPECT_EQ(1, s_errorCallbacks);
+    EXPECT_EQ(PlayFabErrorResponseNotInflated, s_lastErrorCode);
+}
+
+TEST_F(PlayFabClientSdkCallbackTest, Compression_OnlyLargeBodiesAreCompressed)
+{
+    SAFE_DELETE(PlayFabRequestManager::playFabHttp);
+    PlayFabSettings::playFabSettings->httpMaxRetries = 0;
+    PlayFabSettings::playFabSettings->httpCompressRequests = true;
+    PlayFabSettings::playFabSettings->httpCompressionThreshold = 1024;
+    PlayFabRequestManager::playFabHttp = new PlayFabRequestManager();
+
+    AZStd::string smallBody = "{\"PlayFabId\":\"1234\"}";
+    AZStd::string largeBody = "{\"Data\":{";
+    for (int i = 0; i < 100; ++i)
+        largeBody += (i ? ",\"Key" : "\"Key") + AZStd::to_string(i) + "\":\"Value" + AZStd::to_string(i) + "\"";
+    largeBody += "}}";
+
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/GetUserData", Aws::Http::HttpMethod::HTTP_POST, "", "", smallBody, nullptr, nullptr, nullptr,
+        [](PlayFabRequest* request) { delete request; }));
+    PlayFabRequestManager::playFabHttp->AddRequest(new PlayFabRequest("https://test.playfabapi.com/Server/UpdateUserData", Aws::Http::HttpMethod::HTTP_POST, "", "", largeBody, nullptr, nullptr, nullptr,
+        [](PlayFabRequest* request) { delete request; }));
+    while (PlayFabRequestManager::playFabHttp->GetPendingCalls() > 0)
+        CrySleep(1);
+
+    auto stats = PlayFabRequestManager::playFabHttp->GetCompressionStats();
+    EXPECT_EQ(static_cast<AZ::u64>(smallBody.length()), stats["/Server/GetUserData"].requestBytesSent);
+    EXPECT_EQ(static_cast<AZ::u64>(largeBody.length()), stats["/Server/UpdateUserData"].requestBytes);
+    EXPECT_LT(stats["/Server/UpdateUserData"].requestBytesSent, stats["/Server/UpdateUserData"].requestBytes);
+}
+
+TEST_F(PlayFabClientSdkTest, BufferPool_SizeClassesAndReuse)
+{
+    PlayFabBufferPool pool(2);
+    size_t capacity;
+
+    char* small = pool.Acquire(100, capacity);
+    EXPECT_EQ(4096u, capacity); // Smallest class
+    pool.Release(small, capacity);
+    EXPECT_EQ(small, pool.Acquire(4000, capacity)); // Same class, so the same buffer comes back
+    pool.Release(small, capacity);
+
+    char* medium = pool.Acquire(5000, capacity);
+    EXPECT_EQ(8192u, capacity);
+    EXPECT_NE(small, medium);
+    pool.Release(medium, capacity);
+
+    // Too large for any class, so it is sized exactly and not kept
+    size_t hugeSize = 5 * 1024 * 1024;
+    char* huge = pool.Acquire(hugeSize, capacity);
+    EXPECT_EQ(hugeSize, capacity);
+    pool.Release(huge, capacity);
+
+    PlayFabResponseBufferStats stats = pool.GetStats();
+    EXPECT_EQ(4u, stats.acquiredBuffers);
+    EXPECT_EQ(1u, stats.reusedBuffers);
+    EXPECT_EQ(4096u + 8192u, stats.pooledBytes);
+    EXPECT_EQ(static_cast<AZ::u64>(hugeSize), stats.largestResponseBytes);
+}
+
+TEST_F(PlayFabClientSdkTest, BufferPool_LargeResponseAllocation_Benchmark)
+{
+    // Four workers each reading catalog sized responses, as PlayFabRequestManager::ReadResponse does
+    const int workerCount = 4;
+    const int responsesPerWorker = 50;
+    const size_t responseSize = 1536 * 1024;
+    PlayFabBufferPool pool(workerCount);
+
+    AZStd::vector<AZStd::thread> workers;
+    for (int i = 0; i < workerCount; ++i)
+    {
+        workers.push_back(AZStd::thread([&pool, responseSize, responsesPerWorker]()
+        {
+            for (int response = 0; response < responsesPerWorker; ++response)
+            {
+                size_t capacity;
+                char* buffer = pool.Acquire(responseSize + 1, capacity);
+                memset(buffer, '{', responseSize);
+                pool.Release(buffer, capacity);
+            }
+        }));
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    // Without the pool every response allocates its full size, and the in situ parse saves the Document a second copy of its strings
+    PlayFabResponseBufferStats stats = pool.GetStats();
+    AZ::u64 responseCount = workerCount * responsesPerWorker;
+    printf("Response buffers: %llu bytes allocated for %llu responses, %llu bytes unpooled\n", static_cast<unsigned long long>(stats.allocatedBytes),
+        static_cast<unsigned long long>(responseCount), static_cast<unsigned long long>(responseCount * (responseSize + 1)));
+    EXPECT_LE(stats.allocatedBytes, static_cast<AZ::u64>(workerCount) * 2 * 1024 * 1024);
+    EXPECT_GE(stats.reusedBuffers, responseCount - workerCount);
+}
+
+TEST_F(PlayFabClientSdkTest, JsonArenaPool_ReusedAndGrownToHighWaterMark)
+{
+    PlayFabJsonArenaPool pool(2);
+
+    PlayFabJsonArena* arena = pool.Acquire();
+    size_t initialSize = arena->bufferSize;
+    pool.Release(arena);
+    EXPECT_EQ(arena, pool.Acquire()); // Steady state: the same arena, nothing allocated
+
+    // A Document larger than the buffer overflows once, after which arenas are sized to hold it
+    arena->allocator->Malloc(initialSize * 3);
+    pool.Release(arena);
+    PlayFabJsonArena* grown = pool.Acquire();
+    EXPECT_GE(grown->bufferSize, initialSize * 3);
+    EXPECT_EQ(0u, grown->allocator->Size()); // Cleared for the next response
+    pool.Release(grown);
+
+    PlayFabJsonArenaStats stats = pool.GetStats();
+    EXPECT_EQ(3u, stats.acquiredArenas);
+    EXPECT_EQ(2u, stats.reusedArenas);
+    EXPECT_EQ(1u, stats.overflowedArenas);
+    EXPECT_EQ(static_cast<AZ::u64>(initialSize * 3), stats.highWaterBytes);
+    EXPECT_EQ(static_cast<AZ::u64>(grown->bufferSize), stats.arenaBytes);
+}
+
+TEST_F(PlayFabClientSdkTest, JsonArenaPool_SteadyStateAllocations_Benchmark)
+{
+    const int workerCount = 4;
+    const int responsesPerWorker = 250;
+    PlayFabJsonArenaPool pool(workerCount);
+
+    AZStd::vector<AZStd::thread> workers;
+    for (int i = 0; i < workerCount; ++i)
+    {
+        workers.push_back(AZStd::thread([&pool, responsesPerWorker]()
+        {
+            for (int response = 0; response < responsesPerWorker; ++response)
+            {
+                PlayFabJsonArena* arena = pool.Acquire();
+                arena->allocator->Malloc(48 * 1024);
+                pool.Release(arena);
+            }
+        }));
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    // Only the first response on each worker should have needed a new arena
+    PlayFabJsonArenaStats stats = pool.GetStats();
+    AZ::u64 created = stats.acquiredArenas - stats.reusedArenas;
+    printf("Json arenas: %llu created for %llu responses\n", static_cast<unsigned long long>(created), static_cast<unsigned long long>(stats.acquiredArenas));
+    EXPECT_LE(created, static_cast<AZ::u64>(workerCount));
+    EXPECT_EQ(0u, stats.overflowedArenas);
+}
+
+// A leaderboard response with entryCount entries, each with unknown members and nulls mixed in as real responses have
+static AZStd::string MakeLeaderboardResponse(int entryCount)
+{
+    AZStd::string json = "{\"code\":200,\"status\":\"OK\",\"data\":{\"Leaderboard\":[";
+    for (int i = 0; i < entryCount; ++i)
+    {
+        json += (i ? ",{\"PlayFabId\":\"" : "{\"PlayFabId\":\"") + AZStd::to_string(100000 + i) + "\",\"DisplayName\":\"Player \\\"" + AZStd::to_string(i)
+            + "\\\"\",\"StatValue\":" + AZStd::to_string(5000 - i) + ",\"Position\":" + AZStd::to_string(i)
+            + ",\"Profile\":{\"PlayerId\":\"" + AZStd::to_string(100000 + i) + "\",\"Tags\":[\"a\",\"b\"],\"Unknown\":{\"Nested\":[1,2,{\"x\":null}]}},\"Extra\":null}";
+    }
+    json += "],\"Version\":7,\"NextReset\":null}}";
+    return json;
+}
+
+TEST_F(PlayFabClientSdkTest, JsonReader_StreamsIntoResultModels)
+{
+    AZStd::string json = MakeLeaderboardResponse(3);
+    AZStd::vector<char> text(json.begin(), json.end());
+    text.push_back('\0');
+
+    PlayFabJsonReader reader;
+    ASSERT_TRUE(reader.Parse(text.data()));
+    EXPECT_FALSE(reader.SeekMember("errorCode"));
+    ASSERT_TRUE(reader.SeekMember("data"));
+
+    ClientModels::GetLeaderboardResult result;
+    ASSERT_TRUE(result.readFromReader(reader));
+    EXPECT_EQ(7, result.Version);
+    EXPECT_TRUE(result.NextReset.isNull());
+    ASSERT_EQ(3u, result.Leaderboard.size());
+    const ClientModels::PlayerLeaderboardEntry& last = result.Leaderboard.back();
+    EXPECT_EQ(AZStd::string("100002"), last.PlayFabId);
+    EXPECT_EQ(AZStd::string("Player \"2\""), last.DisplayName);
+    EXPECT_EQ(4998, last.StatValue);
+    EXPECT_EQ(2, last.Position);
+    ASSERT_NE(nullptr, last.Profile);
+    EXPECT_EQ(AZStd::string("100002"), last.Profile->PlayerId);
+
+    // Maps of models, enums and dates
+    char userData[] = "{\"data\":{\"DataVersion\":12,\"Data\":{\"Gold\":{\"Value\":\"250\",\"LastUpdated\":\"2017-06-01T12:30:00.000Z\",\"Permission\":\"Public\"},\"Skin\":{\"Value\":\"red\"}}}}";
+    ASSERT_TRUE(reader.Parse(userData));
+    ASSERT_TRUE(reader.SeekMember("data"));
+    ClientModels::GetUserDataResult userDataResult;
+    ASSERT_TRUE(userDataResult.readFromReader(reader));
+    EXPECT_EQ(12u, userDataResult.DataVersion);
+    ASSERT_EQ(2u, userDataResult.Data.size());
+    EXPECT_EQ(AZStd::string("250"), userDataResult.Data["Gold"].Value);
+    EXPECT_NE(0, userDataResult.Data["Gold"].LastUpdated);
+    EXPECT_EQ(ClientModels::UserDataPermissionPublic, userDataResult.Data["Gold"].Permission.mValue);
+    EXPECT_EQ(AZStd::string("red"), userDataResult.Data["Skin"].Value);
+
+    char broken[] = "{\"data\":{\"Version\":";
+    EXPECT_FALSE(reader.Parse(broken));
+}
+
+TEST_F(PlayFabClientSdkTest, JsonReader_LargeResponseDecode_Benchmark)
+{
+    const int entryCount = 1000;
+    const int iterations = 20;
+    AZStd::string json = MakeLeaderboardResponse(entryCount);
+    AZStd::vector<char> text;
+    PlayFabJsonReader reader;
+
+    // Both paths parse in place, as PlayFabRequestManager::ReadResponse does, so each iteration needs a fresh copy of the text
+    AZ::u64 streamingUs = 0;
+    size_t decodedEntries = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        text.assign(json.begin(), json.end());
+        text.push_back('\0');
+        auto start = AZStd::chrono::system_clock::now();
+        reader.Parse(text.data());
+        reader.SeekMember("data");
+        ClientModels::GetLeaderboardResult result;
+        result.readFromReader(reader);
+        streamingUs += MicrosecondsSince(start);
+        decodedEntries = result.Leaderboard.size();
+    }
+
+    AZ::u64 documentUs = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        text.assign(json.begin(), json.end());
+        text.push_back('\0');
+        auto start = AZStd::chrono::system_clock::now();
+        rapidjson::Document document;
+        document.ParseInsitu<0>(text.data());
+        ClientModels::GetLeaderboardResult result;
+        if (!document.HasParseError() && document.IsObject() && document.FindMember("data") != document.MemberEnd())
+            result.readFromValue(document.FindMember("data")->value);
+        documentUs += MicrosecondsSince(start);
+    }
+
+    printf("Decode %u byte leaderboard: streaming %llu us, document %llu us\n", static_cast<unsigned>(json.length()),
+        static_cast<unsigned long long>(streamingUs / iterations), static_cast<unsigned long long>(documentUs / iterations));
+    EXPECT_EQ(static_cast<size_t>(entryCount), decodedEntries);
+}
+
+// An UpdateUserData request carrying entryCount keys, as a save game sync would send
+static void MakeUpdateUserDataRequest(int entryCount, ClientModels::UpdateUserDataRequest& request)
+{
+    for (int i = 0; i < entryCount; ++i)
+        request.Data["SaveSlot" + AZStd::to_string(i)] = "{\"level\":" + AZStd::to_string(i) + ",\"position\":[12.5,0,-3.25],\"inventory\":\"sword,shield,potion\"}";
+}
+
+TEST_F(PlayFabClientSdkTest, RequestBody_SerializedOnceIntoRecycledBuffer)
+{
+    ClientModels::UpdateUserDataRequest model;
+    MakeUpdateUserDataRequest(3, model);
+    AZStd::string expected = model.toJSONString();
+
+    // Without a request manager the body is allocated, and still written straight from the model
+    PlayFabRequest request("https://test.playfabapi.com/Server/UpdateUserData", Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", "secret", model, nullptr, nullptr, nullptr, nullptr);
+    EXPECT_EQ(expected, AZStd::string(request.GetRequestBody(), request.GetRequestBodySize()));
+
+    PlayFabRequestBodyPool pool(1);
+    PlayFabRequestBody* body = pool.Acquire();
+    model.writeJSON(body->writer);
+    EXPECT_EQ(expected, AZStd::string(body->buffer.GetString(), body->buffer.GetSize()));
+    PlayFabRequestBodyPool::Release(body);
+
+    // The same buffer and writer come back cleared, ready for a new document
+    EXPECT_EQ(body, pool.Acquire());
+    EXPECT_EQ(0u, body->buffer.GetSize());
+    model.writeJSON(body->writer);
+    EXPECT_EQ(expected, AZStd::string(body->buffer.GetString(), body->buffer.GetSize()));
+
+    // The body is read by the http client in place, including the seeks it does to find the length and rewind on a resend
+    PlayFabMemoryStream stream(body->buffer.GetString(), body->buffer.GetSize());
+    stream.seekg(0, std::ios_base::end);
+    EXPECT_EQ(static_cast<std::streamoff>(expected.length()), static_cast<std::streamoff>(stream.tellg()));
+    stream.seekg(0, std::ios_base::beg);
+    AZStd::vector<char> sent(expected.length());
+    stream.read(sent.data(), sent.size());
+    EXPECT_EQ(expected, AZStd::string(sent.data(), sent.size()));
+    PlayFabRequestBodyPool::Release(body);
+
+    PlayFabRequestBodyStats stats = pool.GetStats();
+    EXPECT_EQ(2u, stats.acquiredBodies);
+    EXPECT_EQ(1u, stats.reusedBodies);
+    EXPECT_EQ(static_cast<AZ::u64>(expected.length()), stats.largestBodyBytes);
+}
+
+TEST_F(PlayFabClientSdkTest, RequestBody_SerializationCopies_Benchmark)
+{
+    const int iterations = 200;
+    ClientModels::UpdateUserDataRequest model;
+    MakeUpdateUserDataRequest(200, model);
+
+    // Previous path: toJSONString copies out of its buffer, the request copies that string, and HandleRequest copies it into a StringStream
+    AZ::u64 copyingUs = 0;
+    AZ::u64 copyingBytes = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        auto start = AZStd::chrono::system_clock::now();
+        AZStd::string json = model.toJSONString();
+        AZStd::string requestJsonBody(json);
+        Aws::StringStream stream;
+        stream << requestJsonBody.c_str();
+        copyingUs += MicrosecondsSince(start);
+        copyingBytes += json.length() + requestJsonBody.length() + static_cast<AZ::u64>(stream.tellp());
+    }
+
+    // Current path: written once into a recycled body, which the http client reads in place
+    PlayFabRequestBodyPool pool(1);
+    AZ::u64 pooledUs = 0;
+    size_t bodySize = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        auto start = AZStd::chrono::system_clock::now();
+        PlayFabRequestBody* body = pool.Acquire();
+        model.writeJSON(body->writer);
+        PlayFabMemoryStream stream(body->buffer.GetString(), body->buffer.GetSize());
+        bodySize = body->buffer.GetSize();
+        PlayFabRequestBodyPool::Release(body);
+        pooledUs += MicrosecondsSince(start);
+    }
+
+    PlayFabRequestBodyStats stats = pool.GetStats();
+    printf("Serialize %u byte UpdateUserData: copying %llu us and %llu bytes copied per request, pooled %llu us and 0 bytes copied per request, %llu bodies allocated\n",
+        static_cast<unsigned>(bodySize), static_cast<unsigned long long>(copyingUs / iterations), static_cast<unsigned long long>(copyingBytes / iterations),
+        static_cast<unsigned long long>(pooledUs / iterations), static_cast<unsigned long long>(stats.acquiredBodies - stats.reusedBodies));
+    EXPECT_EQ(1u, stats.acquiredBodies - stats.reusedBodies);
+    EXPECT_EQ(static_cast<AZ::u64>(3 * bodySize), copyingBytes / iterations);
+}
+
+// The names of every value of an enum, as its generated write function serializes them
+template <typename EnumType>
+static AZStd::vector<AZStd::string> GetEnumNames(EnumType lastValue, void(*writeEnum)(EnumType, PFStringJsonWriter&))
+{
+    AZStd::vector<AZStd::string> names;
+    for (int value = 0; value <= static_cast<int>(lastValue); ++value)
+    {
+        rapidjson::StringBuffer buffer;
+        PFStringJsonWriter writer(buffer);
+        writeEnum(static_cast<EnumType>(value), writer);
+        AZStd::string quoted = buffer.GetString();
+        names.push_back(quoted.substr(1, quoted.length() - 2));
+    }
+    return names;
+}
+
+TEST_F(PlayFabClientSdkTest, EnumDecode_EveryNameRoundTrips)
+{
+    AZStd::vector<AZStd::string> names = GetEnumNames(ClientModels::CountryCodeZW, &ClientModels::writeCountryCodeEnumJSON);
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        rapidjson::Value value(names[i].c_str(), static_cast<rapidjson::SizeType>(names[i].length()));
+        EXPECT_EQ(static_cast<int>(i), static_cast<int>(ClientModels::readCountryCodeFromValue(value))) << names[i].c_str();
+    }
+
+    names = GetEnumNames(ClientModels::CurrencyZWD, &ClientModels::writeCurrencyEnumJSON);
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        rapidjson::Value value(names[i].c_str(), static_cast<rapidjson::SizeType>(names[i].length()));
+        EXPECT_EQ(static_cast<int>(i), static_cast<int>(ClientModels::readCurrencyFromValue(value))) << names[i].c_str();
+    }
+
+    // Unknown names, including a prefix of a real one, still fall back to the first value, and numbers are taken as they are
+    rapidjson::Value unknown("U", 1);
+    EXPECT_EQ(ClientModels::CountryCodeAF, ClientModels::readCountryCodeFromValue(unknown));
+    rapidjson::Value numeric;
+    numeric.SetInt(ClientModels::CurrencyUSD);
+    EXPECT_EQ(ClientModels::CurrencyUSD, ClientModels::readCurrencyFromValue(numeric));
+}
+
+// Per-lookup cost of decoding every name of an enum, against the std::map lookup the generated code used before
+template <typename EnumType>
+static void BenchmarkEnumDecode(const char* enumName, EnumType lastValue, void(*writeEnum)(EnumType, PFStringJsonWriter&), EnumType(*readEnum)(const rapidjson::Value&))
+{
+    const int rounds = 2000;
+    AZStd::vector<AZStd::string> names = GetEnumNames(lastValue, writeEnum);
+    AZStd::vector<rapidjson::Value> values(names.size());
+    std::map<const char*, EnumType, StringCompare> map;
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        values[i].SetString(names[i].c_str(), static_cast<rapidjson::SizeType>(names[i].length()));
+        map[names[i].c_str()] = static_cast<EnumType>(i);
+    }
+
+    auto microsecondsSince = [](AZStd::chrono::system_clock::time_point start)
+    {
+        return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start).count();
+    };
+
+    int checksum = 0;
+    auto start = AZStd::chrono::system_clock::now();
+    for (int round = 0; round < rounds; ++round)
+        for (const rapidjson::Value& value : values)
+            checksum += static_cast<int>(map.find(value.GetString())->second);
+    AZ::u64 mapUs = microsecondsSince(start);
+
+    start = AZStd::chrono::system_clock::now();
+    for (int round = 0; round < rounds; ++round)
+        for (const rapidjson::Value& value : values)
+            checksum -= static_cast<int>(readEnum(value));
+    AZ::u64 switchUs = microsecondsSince(start);
+
+    double lookups = static_cast<double>(rounds) * values.size();
+    printf("Decode %s (%u names): map %.1f ns, hash switch %.1f ns per lookup\n", enumName, static_cast<unsigned>(values.size()), mapUs * 1000.0 / lookups, switchUs * 1000.0 / lookups);
+    EXPECT_EQ(0, checksum);
+}
+
+TEST_F(PlayFabClientSdkTest, EnumDecode_LargeEnumLookup_Benchmark)
+{
+    BenchmarkEnumDecode("CountryCode", ClientModels::CountryCodeZW, &ClientModels::writeCountryCodeEnumJSON, &ClientModels::readCountryCodeFromValue);
+    BenchmarkEnumDecode("Currency", ClientModels::CurrencyZWD, &ClientModels::writeCurrencyEnumJSON, &ClientModels::readCurrencyFromValue);
+}
+
+TEST_F(PlayFabClientSdkTest, Datetime_ParseAndFormatKnownTimes)
+{
+    struct KnownTime { const char* text; AZ::s64 milliseconds; };
+    const KnownTime knownTimes[] = {
+        { "1970-01-01T00:00:00.000Z", 0LL },
+        { "2000-02-29T12:34:56.789Z", 951827696789LL },
+        { "2017-04-12T18:03:45.123Z", 1492020225123LL },
+        { "1969-12-31T23:59:59.999Z", -1LL },
+        { "2038-01-19T03:14:08.000Z", 2147483648000LL },
+        { "1900-03-01T00:00:00.000Z", -2203891200000LL },
+        { "2100-02-28T23:00:00.000Z", 4107538800000LL },
+        { "9999-12-31T23:59:59.999Z", 253402300799999LL }
+    };
+    for (const KnownTime& known : knownTimes)
+    {
+        AZ::s64 milliseconds = 0;
+        EXPECT_TRUE(PlayFabDatetime::Parse(known.text, strlen(known.text), milliseconds)) << known.text;
+        EXPECT_EQ(known.milliseconds, milliseconds) << known.text;
+        char formatted[PlayFabDatetime::FormattedLength + 1];
+        EXPECT_EQ(PlayFabDatetime::FormattedLength, PlayFabDatetime::Format(known.milliseconds, formatted));
+        EXPECT_STREQ(known.text, formatted);
+    }
+
+    // Other forms the service and callers use
+    struct Variant { const char* text; AZ::s64 milliseconds; };
+    const Variant variants[] = {
+        { "2017-04-12T18:03:45Z", 1492020225000LL },
+        { "2017-04-12T18:03:45.1234567Z", 1492020225123LL },
+        { "2017-04-12T18:03:45.5", 1492020225500LL },
+        { "2017-04-12T18:03Z", 1492020180000LL },
+        { "2017-04-12", 1491955200000LL },
+        { "2017-04-12T20:03:45.123+02:00", 1492020225123LL },
+        { "2017-04-12T13:33:45.123-04:30", 1492020225123LL }
+    };
+    for (const Variant& variant : variants)
+    {
+        AZ::s64 milliseconds = 0;
+        EXPECT_TRUE(PlayFabDatetime::Parse(variant.text, strlen(variant.text), milliseconds)) << variant.text;
+        EXPECT_EQ(variant.milliseconds, milliseconds) << variant.text;
+    }
+
+    const char* invalid[] = { "", "2017", "2017-04-1", "2017/04/12", "2017-13-01", "2017-02-29", "1900-02-29", "2017-04-31", "2017-04-12T24:00:00Z",
+        "2017-04-12T18:60Z", "2017-04-12T18:03:45.Z", "2017-04-12T18:03:45Zjunk", "2017-04-12T18:03:45+0200", "2017-0a-12" };
+    for (const char* text : invalid)
+    {
+        AZ::s64 milliseconds = 42;
+        EXPECT_FALSE(PlayFabDatetime::Parse(text, strlen(text), milliseconds)) << text;
+        EXPECT_EQ(42, milliseconds) << text;
+    }
+}
+
+TEST_F(PlayFabClientSdkTest, Datetime_EveryDayRoundTrips)
+{
+    // Every day from 1600 to 2400, against a day counter which steps through the calendar one day at a time
+    AZ::s64 expectedDays = PlayFabDatetime::DaysFromCivil(1600, 1, 1);
+    for (int year = 1600; year <= 2400; ++year)
+    {
+        bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+        const int daysInMonth[] = { 31, leap ? 29 : 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        for (unsigned month = 1; month <= 12; ++month)
+        {
+            for (unsigned day = 1; day <= static_cast<unsigned>(daysInMonth[month - 1]); ++day, ++expectedDays)
+            {
+                ASSERT_EQ(expectedDays, PlayFabDatetime::DaysFromCivil(year, month, day));
+                AZ::s64 civilYear;
+                unsigned civilMonth, civilDay;
+                PlayFabDatetime::CivilFromDays(expectedDays, civilYear, civilMonth, civilDay);
+                ASSERT_EQ(year, civilYear);
+                ASSERT_EQ(month, civilMonth);
+                ASSERT_EQ(day, civilDay);
+            }
+        }
+    }
+
+    // And through the model helpers, which keep whole seconds in a time_t as UTC whatever the local timezone is
+    for (time_t time = -2000000000; time < 4000000000LL; time += 86399 * 37)
+    {
+        rapidjson::StringBuffer buffer;
+        PFStringJsonWriter writer(buffer);
+        writeDatetime(time, writer);
+        AZStd::string quoted = buffer.GetString();
+        rapidjson::Value value(quoted.c_str() + 1, static_cast<rapidjson::SizeType>(quoted.length() - 2));
+        ASSERT_EQ(time, readDatetime(value)) << quoted.c_str();
+    }
+}
+
+TEST_F(PlayFabClientSdkTest, Datetime_DecodeAndEncode_Benchmark)
+{
+    const int count = 10000;
+    AZStd::vector<AZStd::string> texts;
+    for (int i = 0; i < count; ++i)
+    {
+        char text[PlayFabDatetime::FormattedLength + 1];
+        PlayFabDatetime::Format(1492020225123LL + i * 7919013LL, text);
+        texts.push_back(text);
+    }
+
+    // Previous decode: a string copy, sscanf, and mktime, which takes the libc timezone lock
+    AZ::s64 checksum = 0;
+    auto start = AZStd::chrono::system_clock::now();
+    for (const AZStd::string& text : texts)
+    {
+        AZStd::string copy = text;
+        tm timeStruct = {};
+        unsigned int milliseconds = 0;
+        sscanf(copy.c_str(), "%u-%u-%uT%u:%u:%u.%uZ", &timeStruct.tm_year, &timeStruct.tm_mon, &timeStruct.tm_mday,
+            &timeStruct.tm_hour, &timeStruct.tm_min, &timeStruct.tm_sec, &milliseconds);
+        timeStruct.tm_year -= 1900;
+        timeStruct.tm_mon -= 1;
+        checksum += mktime(&timeStruct);
+    }
+    AZ::u64 libcDecodeUs = MicrosecondsSince(start);
+
+    start = AZStd::chrono::system_clock::now();
+    for (const AZStd::string& text : texts)
+    {
+        rapidjson::Value value(text.c_str(), static_cast<rapidjson::SizeType>(text.length()));
+        checksum += readDatetime(value);
+    }
+    AZ::u64 decodeUs = MicrosecondsSince(start);
+
+    // Previous encode: gmtime, which shares one static result between threads, and strftime
+    start = AZStd::chrono::system_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        time_t time = 1492020225 + i * 7919;
+        char text[40];
+        strftime(text, 40, "%Y-%m-%dT%H:%M:%S.000Z", gmtime(&time));
+        checksum += text[18];
+    }
+    AZ::u64 libcEncodeUs = MicrosecondsSince(start);
+
+    start = AZStd::chrono::system_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        char text[PlayFabDatetime::FormattedLength + 1];
+        PlayFabDatetime::Format((1492020225 + i * 7919) * 1000LL, text);
+        checksum += text[18];
+    }
+    AZ::u64 encodeUs = MicrosecondsSince(start);
+
+    printf("Datetimes (%d): decode libc %.1f ns, arithmetic %.1f ns; encode libc %.1f ns, arithmetic %.1f ns per timestamp (checksum %lld)\n", count,
+        libcDecodeUs * 1000.0 / count, decodeUs * 1000.0 / count, libcEncodeUs * 1000.0 / count, encodeUs * 1000.0 / count, static_cast<long long>(checksum));
+}
+
+// A catalog response with itemCount items, each with prices, tags and a consumable section
+static AZStd::string MakeCatalogResponse(int itemCount)
+{
+    AZStd::string json = "{\"code\":200,\"status\":\"OK\",\"data\":{\"Catalog\":[";
+    for (int i = 0; i < itemCount; ++i)
+    {
+        AZStd::string id = AZStd::to_string(i);
+        json += (i ? ",{\"ItemId\":\"item_" : "{\"ItemId\":\"item_") + id + "\",\"ItemClass\":\"weapon\",\"CatalogVersion\":\"main\",\"DisplayName\":\"Item " + id
+            + "\",\"Description\":\"A generated catalog item\",\"VirtualCurrencyPrices\":{\"GC\":" + AZStd::to_string(100 + i) + ",\"RM\":" + AZStd::to_string(i % 7)
+            + "},\"Tags\":[\"tier" + AZStd::to_string(i % 5) + "\",\"weapon\",\"sale\"],\"Consumable\":{\"UsageCount\":3},\"IsStackable\":true,\"IsTradable\":false}";
+    }
+    json += "]}}";
+    return json;
+}
+
+TEST_F(PlayFabClientSdkTest, DataModels_LargeCatalogDecode_Benchmark)
+{
+    const int itemCount = 5000;
+    const int iterations = 5;
+    AZStd::string json = MakeCatalogResponse(itemCount);
+    AZStd::vector<char> text;
+    PlayFabJsonReader reader;
+
+    // Previous models: a list node per element, with each element read into a temporary and copied in
+    AZ::u64 listUs = 0;
+    size_t listItems = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        text.assign(json.begin(), json.end());
+        text.push_back('\0');
+        reader.Parse(text.data());
+        reader.SeekMember("data");
+        auto start = AZStd::chrono::system_clock::now();
+        std::list<ClientModels::CatalogItem> catalog;
+        const char* member;
+        reader.StartObject();
+        while (reader.NextMember(member))
+        {
+            if (strcmp(member, "Catalog") != 0 || !reader.StartArray())
+            {
+                reader.Skip();
+                continue;
+            }
+            while (reader.NextElement())
+            {
+                ClientModels::CatalogItem item;
+                item.readFromReader(reader);
+                catalog.push_back(item);
+            }
+        }
+        listUs += MicrosecondsSince(start);
+        listItems = catalog.size();
+    }
+
+    // Current models: one reserved vector, with each element read where it is stored
+    AZ::u64 vectorUs = 0;
+    size_t vectorItems = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        text.assign(json.begin(), json.end());
+        text.push_back('\0');
+        reader.Parse(text.data());
+        reader.SeekMember("data");
+        auto start = AZStd::chrono::system_clock::now();
+        ClientModels::GetCatalogItemsResult result;
+        result.readFromReader(reader);
+        vectorUs += MicrosecondsSince(start);
+        vectorItems = result.Catalog.size();
+        EXPECT_EQ(static_cast<size_t>(itemCount), result.Catalog.capacity()); // Reserved once, never regrown
+        EXPECT_EQ(3u, result.Catalog.back().Tags.size());
+        ASSERT_NE(nullptr, result.Catalog.back().Consumable);
+    }
+
+    printf("Decode %d item catalog: list %llu us with %d element allocations and copies, vector %llu us with 1 allocation and no copies\n", itemCount,
+        static_cast<unsigned long long>(listUs / iterations), itemCount, static_cast<unsigned long long>(vectorUs / iterations));
+    EXPECT_EQ(static_cast<size_t>(itemCount), listItems);
+    EXPECT_EQ(static_cast<size_t>(itemCount), vectorItems);
+}
+
+TEST_F(PlayFabClientSdkTest, FlatMap_MatchesStdMapThroughInsertsAndErases)
+{
+    PlayFabFlatMap<int> flat;
+    std::map<AZStd::string, int> reference;
+    unsigned int seed = 12345;
+    for (int step = 0; step < 20000; ++step)
+    {
+        seed = seed * 1103515245u + 12345u;
+        AZStd::string key = "key" + AZStd::to_string((seed >> 8) % 300);
+        switch ((seed >> 20) % 4)
+        {
+        case 0:
+        case 1:
+            flat[key.c_str()] = step;
+            reference[key] = step;
+            break;
+        case 2:
+            EXPECT_EQ(reference.erase(key), flat.erase(key.c_str()));
+            break;
+        default:
+            EXPECT_EQ(reference.count(key), flat.count(key));
+            break;
+        }
+    }
+
+    ASSERT_EQ(reference.size(), flat.size());
+    for (const auto& entry : reference)
+    {
+        auto match = flat.find(entry.first.c_str(), entry.first.length());
+        ASSERT_NE(flat.end(), match);
+        EXPECT_EQ(entry.second, match->second);
+    }
+    int visited = 0;
+    for (auto iter = flat.begin(); iter != flat.end(); ++iter, ++visited)
+        EXPECT_EQ(reference[iter->first], iter->second);
+    EXPECT_EQ(static_cast<int>(reference.size()), visited);
+
+    // Copies are independent, and compare equal regardless of order
+    PlayFabFlatMap<int> copy = flat;
+    EXPECT_TRUE(copy == flat);
+    copy.erase(copy.begin());
+    EXPECT_TRUE(copy != flat);
+    EXPECT_FALSE(flat.insert(AZStd::pair<AZStd::string, int>(flat.begin()->first, -1)).second);
+    flat.clear();
+    EXPECT_TRUE(flat.empty());
+    EXPECT_EQ(flat.end(), flat.find("key1"));
+}
+
+TEST_F(PlayFabClientSdkTest, FlatMap_UserDataInsertAndLookup_Benchmark)
+{
+    // A player's user data: tens of keys, looked up by name every frame
+    const int keyCounts[] = { 16, 64, 256 };
+    const int lookupRounds = 2000;
+    for (int keyCount : keyCounts)
+    {
+        AZStd::vector<AZStd::string> keys;
+        for (int i = 0; i < keyCount; ++i)
+            keys.push_back("PlayerSetting_" + AZStd::to_string(i * 7919));
+        ClientModels::UserDataRecord record;
+        record.Value = "{\"volume\":0.8,\"sensitivity\":2.5,\"bindings\":[\"W\",\"A\",\"S\",\"D\"]}";
+
+        auto start = AZStd::chrono::system_clock::now();
+        std::map<AZStd::string, ClientModels::UserDataRecord> treeMap;
+        for (const AZStd::string& key : keys)
+            treeMap[key.c_str()] = record;
+        AZ::u64 treeInsertUs = MicrosecondsSince(start);
+
+        start = AZStd::chrono::system_clock::now();
+        PlayFabFlatMap<ClientModels::UserDataRecord> flatMap;
+        for (const AZStd::string& key : keys)
+            flatMap[key.c_str()] = record;
+        AZ::u64 flatInsertUs = MicrosecondsSince(start);
+
+        // Looked up by const char*, as game code holding literal key names does
+        size_t found = 0;
+        start = AZStd::chrono::system_clock::now();
+        for (int round = 0; round < lookupRounds; ++round)
+            for (const AZStd::string& key : keys)
+                found += treeMap.find(key.c_str()) != treeMap.end();
+        AZ::u64 treeLookupUs = MicrosecondsSince(start);
+
+        start = AZStd::chrono::system_clock::now();
+        for (int round = 0; round < lookupRounds; ++round)
+            for (const AZStd::string& key : keys)
+                found += flatMap.find(key.c_str()) != flatMap.end();
+        AZ::u64 flatLookupUs = MicrosecondsSince(start);
+
+        double lookups = static_cast<double>(lookupRounds) * keyCount;
+        printf("User data with %d keys: insert std::map %llu us, flat %llu us; lookup std::map %.1f ns, flat %.1f ns\n", keyCount,
+            static_cast<unsigned long long>(treeInsertUs), static_cast<unsigned long long>(flatInsertUs), treeLookupUs * 1000.0 / lookups, flatLookupUs * 1000.0 / lookups);
+        EXPECT_EQ(static_cast<size_t>(2 * lookups), found);
+    }
+}
+
+TEST_F(PlayFabClientSdkTest, DataModels_MoveTransfersOwnedMembers)
+{
+    static_assert(std::is_nothrow_move_constructible<ClientModels::CatalogItem>::value, "Containers only move elements which cannot throw while moving");
+
+    ClientModels::CatalogItem item;
+    item.ItemId = "item_0";
+    item.Description = "A generated catalog item, long enough to live on the heap";
+    item.VirtualCurrencyPrices["GC"] = 100;
+    item.Tags.push_back("weapon");
+    item.Consumable = new ClientModels::CatalogItemConsumableInfo();
+    item.Consumable->UsageCount = 3;
+    ClientModels::CatalogItemConsumableInfo* consumable = item.Consumable;
+
+    // Copies are deep, and assigning one frees what the target owned
+    ClientModels::CatalogItem copy(item);
+    ASSERT_NE(nullptr, copy.Consumable);
+    EXPECT_NE(consumable, copy.Consumable);
+    ClientModels::CatalogItem assigned;
+    assigned.Container = new ClientModels::CatalogItemContainerInfo();
+    assigned = item;
+    ASSERT_NE(nullptr, assigned.Consumable);
+    EXPECT_NE(consumable, assigned.Consumable);
+    EXPECT_EQ(nullptr, assigned.Container);
+    EXPECT_EQ(item.Description, assigned.Description);
+    EXPECT_EQ(3u, static_cast<Uint32>(assigned.Consumable->UsageCount));
+
+    // Moves hand over the owned members and the containers' storage, and leave the source empty
+    const AZStd::string* tags = item.Tags.data();
+    ClientModels::CatalogItem moved(AZStd::move(item));
+    EXPECT_EQ(consumable, moved.Consumable);
+    EXPECT_EQ(nullptr, item.Consumable);
+    EXPECT_EQ(tags, moved.Tags.data());
+    EXPECT_TRUE(item.Tags.empty());
+
+    ClientModels::CatalogItem target;
+    target.Container = new ClientModels::CatalogItemContainerInfo();
+    target = AZStd::move(moved);
+    EXPECT_EQ(consumable, target.Consumable);
+    EXPECT_EQ(nullptr, target.Container);
+    EXPECT_EQ(nullptr, moved.Consumable);
+    EXPECT_EQ(100u, target.VirtualCurrencyPrices["GC"]);
+    EXPECT_EQ("item_0", target.ItemId);
+}
+
+// A catalog item as the models were without move support: the declared copy constructor suppresses the implicit move
+struct CopyOnlyCatalogItem : public ClientModels::CatalogItem
+{
+    CopyOnlyCatalogItem(const ClientModels::CatalogItem& src) : ClientModels::CatalogItem(src) {}
+    CopyOnlyCatalogItem(const CopyOnlyCatalogItem& src) : ClientModels::CatalogItem(src) {}
+};
+
+TEST_F(PlayFabClientSdkTest, DataModels_CatalogHandOff_Benchmark)
+{
+    // Decoded items handed on into a list which grows as it goes, as a tool collecting items for SetCatalogItems would
+    const int itemCount = 5000;
+    const int iterations = 5;
+    AZStd::string json = MakeCatalogResponse(itemCount);
+    AZStd::vector<char> text(json.begin(), json.end());
+    text.push_back('\0');
+    PlayFabJsonReader reader;
+    reader.Parse(text.data());
+    reader.SeekMember("data");
+    ClientModels::GetCatalogItemsResult decoded;
+    decoded.readFromReader(reader);
+    ASSERT_EQ(static_cast<size_t>(itemCount), decoded.Catalog.size());
+
+    AZ::u64 copyingUs = 0;
+    AZ::u64 movingUs = 0;
+    size_t handedOff = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        std::vector<CopyOnlyCatalogItem> copyOnly(decoded.Catalog.begin(), decoded.Catalog.end());
+        auto start = AZStd::chrono::system_clock::now();
+        std::vector<CopyOnlyCatalogItem> copied;
+        for (CopyOnlyCatalogItem& item : copyOnly)
+            copied.push_back(AZStd::move(item)); // Copied, and copied again whenever the vector regrows
+        copyingUs += MicrosecondsSince(start);
+
+        std::vector<ClientModels::CatalogItem> movable(decoded.Catalog);
+        start = AZStd::chrono::system_clock::now();
+        std::vector<ClientModels::CatalogItem> moved;
+        for (ClientModels::CatalogItem& item : movable)
+            moved.push_back(AZStd::move(item));
+        movingUs += MicrosecondsSince(start);
+
+        EXPECT_NE(nullptr, copyOnly.back().Consumable);
+        EXPECT_EQ(nullptr, movable.back().Consumable);
+        ASSERT_NE(nullptr, moved.back().Consumable);
+        handedOff = moved.size();
+    }
+
+    printf("Hand off %d catalog items into a growing vector: copying %llu us, moving %llu us\n", itemCount,
+        static_cast<unsigned long long>(copyingUs / iterations), static_cast<unsigned long long>(movingUs / iterations));
+    EXPECT_EQ(static_cast<size_t>(itemCount), handedOff);
+}
+
+// A combined info response for a player with a large inventory, user data and statistics, and two currencies
+static AZStd::string MakeCombinedInfoResponse(int itemCount)
+{
+    AZStd::string json = "{\"code\":200,\"status\":\"OK\",\"data\":{\"PlayFabId\":\"A1B2C3D4\",\"InfoResultPayload\":{\"UserInventory\":[";
+    for (int i = 0; i < itemCount; ++i)
+    {
+        AZStd::string id = AZStd::to_string(i);
+        json += (i ? ",{\"ItemId\":\"item_" : "{\"ItemId\":\"item_") + id + "\",\"ItemInstanceId\":\"INST" + id + "\",\"ItemClass\":\"weapon\",\"PurchaseDate\":\"2017-04-12T18:03:45.123Z\""
+            + ",\"CatalogVersion\":\"main\",\"DisplayName\":\"Item " + id + "\",\"UnitCurrency\":\"GC\",\"UnitPrice\":100,\"CustomData\":{\"level\":\"" + AZStd::to_string(i % 50) + "\"}}";
+    }
+    json += "],\"UserVirtualCurrency\":{\"GC\":2500,\"RM\":12},\"UserData\":{";
+    for (int i = 0; i < itemCount / 2; ++i)
+        json += (i ? ",\"Setting" : "\"Setting") + AZStd::to_string(i) + "\":{\"Value\":\"{\\\"volume\\\":0.8}\",\"LastUpdated\":\"2017-04-12T18:03:45.123Z\",\"Permission\":\"Private\"}";
+    json += "},\"UserDataVersion\":7,\"PlayerStatistics\":[";
+    for (int i = 0; i < itemCount / 10; ++i)
+        json += (i ? ",{\"StatisticName\":\"Stat" : "{\"StatisticName\":\"Stat") + AZStd::to_string(i) + "\",\"Value\":" + AZStd::to_string(i * 3) + ",\"Version\":1}";
+    json += "]}}}";
+    return json;
+}
+
+TEST_F(PlayFabClientSdkTest, LazyModel_DecodesMembersOnFirstAccess)
+{
+    AZStd::string json = MakeCombinedInfoResponse(20);
+    AZStd::vector<char> text(json.begin(), json.end());
+    text.push_back('\0');
+    PlayFabJsonReader reader;
+    reader.Parse(text.data());
+
+    PlayFabRequest* request = CreateTestRequest("/Server/GetPlayerCombinedInfo");
+    request->mResponseText = text.data();
+    request->mResponseSize = static_cast<int>(json.length());
+    request->mResponseReader = &reader;
+    ASSERT_TRUE(PlayFabBaseModel::DecodeRequest(request));
+    PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResult> result(request);
+
+    // The result keeps its own copy of the response, which goes back to the request manager as usual
+    request->mResponseText = nullptr;
+    request->mResponseReader = nullptr;
+    delete request;
+    memset(text.data(), 0, text.size());
+    reader.Clear();
+
+    EXPECT_EQ("A1B2C3D4", result.Get("PlayFabId").PlayFabId);
+    EXPECT_EQ(nullptr, result.Get("PlayFabId").InfoResultPayload);
+    EXPECT_FALSE(result.IsDecoded("InfoResultPayload"));
+
+    // Only the members asked for are decoded, each of them once
+    PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResultPayload> payload = result.GetObject<ClientModels::GetPlayerCombinedInfoResultPayload>("InfoResultPayload");
+    const ClientModels::GetPlayerCombinedInfoResultPayload& currency = payload.Get("UserVirtualCurrency");
+    EXPECT_EQ(2500, currency.UserVirtualCurrency.find("GC")->second);
+    EXPECT_EQ(12, currency.UserVirtualCurrency.find("RM")->second);
+    EXPECT_TRUE(currency.UserInventory.empty());
+    EXPECT_TRUE(currency.UserData.empty());
+    EXPECT_EQ(0u, currency.UserDataVersion);
+    EXPECT_EQ(20u, payload.Get("UserInventory").UserInventory.size());
+    EXPECT_EQ(20u, payload.Get("UserInventory").UserInventory.size());
+    EXPECT_EQ("item_19", payload.Get("UserInventory").UserInventory.back().ItemId);
+    EXPECT_EQ("19", payload.Get("UserInventory").UserInventory.back().CustomData.find("level")->second);
+    EXPECT_EQ(2u, payload.Get("PlayerStatistics").PlayerStatistics.size());
+    EXPECT_TRUE(payload.IsDecoded("UserVirtualCurrency"));
+    EXPECT_FALSE(payload.IsDecoded("UserData"));
+
+    // Decoding everything matches the eager decode
+    const ClientModels::GetPlayerCombinedInfoResult& full = result.Get();
+    text.assign(json.begin(), json.end());
+    text.push_back('\0');
+    reader.Parse(text.data());
+    reader.SeekMember("data");
+    ClientModels::GetPlayerCombinedInfoResult eager;
+    eager.readFromReader(reader);
+    ASSERT_NE(nullptr, full.InfoResultPayload);
+    EXPECT_EQ(eager.PlayFabId, full.PlayFabId);
+    EXPECT_EQ(eager.InfoResultPayload->UserInventory.size(), full.InfoResultPayload->UserInventory.size());
+    EXPECT_EQ(eager.InfoResultPayload->UserData.size(), full.InfoResultPayload->UserData.size());
+    EXPECT_EQ(7u, full.InfoResultPayload->UserDataVersion);
+    EXPECT_TRUE(eager.InfoResultPayload->UserVirtualCurrency == full.InfoResultPayload->UserVirtualCurrency);
+
+    // Missing objects give an empty lazy model
+    EXPECT_TRUE(result.GetObject<ClientModels::UserAccountInfo>("AccountInfo").Get().PlayFabId.empty());
+
+    // Copies and child models share one cursor, which each access locks, so they can decode on different threads at once
+    AZStd::atomic<int> mismatches(0);
+    auto decodeCopies = [&result, &mismatches](const char* member)
+    {
+        for (int i = 0; i < 5000; ++i)
+        {
+            PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResult> copy = result;
+            PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResultPayload> child = copy.GetObject<ClientModels::GetPlayerCombinedInfoResultPayload>("InfoResultPayload");
+            const ClientModels::GetPlayerCombinedInfoResultPayload& decoded = child.Get(member);
+            if (decoded.UserInventory.size() + decoded.PlayerStatistics.size() != (strcmp(member, "UserInventory") == 0 ? 20u : 2u))
+                ++mismatches;
+        }
+    };
+    AZStd::thread inventoryThread([&]() { decodeCopies("UserInventory"); });
+    decodeCopies("PlayerStatistics");
+    inventoryThread.join();
+    EXPECT_EQ(0, mismatches.load());
+}
+
+TEST_F(PlayFabClientSdkTest, LazyModel_CombinedInfoCurrencyRead_Benchmark)
+{
+    // A currency check at match start, which only needs UserVirtualCurrency out of the whole combined info payload
+    const int itemCount = 500;
+    const int iterations = 20;
+    AZStd::string json = MakeCombinedInfoResponse(itemCount);
+    AZStd::vector<char> text;
+    PlayFabJsonReader reader;
+
+    // The response is tokenized by the worker for both, so only decoding on the callback's thread is timed
+    AZ::u64 eagerUs = 0;
+    AZ::u64 lazyUs = 0;
+    Int32 eagerGold = 0;
+    Int32 lazyGold = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        text.assign(json.begin(), json.end());
+        text.push_back('\0');
+        reader.Parse(text.data());
+        reader.SeekMember("data");
+        auto start = AZStd::chrono::system_clock::now();
+        ClientModels::GetPlayerCombinedInfoResult eager;
+        eager.readFromReader(reader);
+        eagerGold = eager.InfoResultPayload->UserVirtualCurrency.find("GC")->second;
+        eagerUs += MicrosecondsSince(start);
+
+        text.assign(json.begin(), json.end());
+        text.push_back('\0');
+        reader.Parse(text.data());
+        reader.SeekMember("data");
+        start = AZStd::chrono::system_clock::now();
+        size_t position = reader.GetPosition();
+        PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResult> lazy(AZStd::make_shared<PlayFabRetainedResponse>(reader, text.data(), json.length()), position);
+        PlayFabLazyModel<ClientModels::GetPlayerCombinedInfoResultPayload> payload = lazy.GetObject<ClientModels::GetPlayerCombinedInfoResultPayload>("InfoResultPayload");
+        lazyGold = payload.Get("UserVirtualCurrency").UserVirtualCurrency.find("GC")->second;
+        lazyUs += MicrosecondsSince(start);
+    }
+
+    printf("Read currency from %u byte combined info: full decode %llu us, lazy %llu us (%.1f%%)\n", static_cast<unsigned>(json.length()),
+        static_cast<unsigned long long>(eagerUs / iterations), static_cast<unsigned long long>(lazyUs / iterations), lazyUs * 100.0 / eagerUs);
+    EXPECT_EQ(2500, eagerGold);
+    EXPECT_EQ(2500, lazyGold);
+}
+
+// Helpers for the title data, catalog and telemetry tests.
+// A SendRecorder records the calls a cache or buffer makes through its fetch or send function, in order, instead of sending them.
+// Record is passed as the function, and records into the one recorder of its kind alive at the time, which a test declares first.
+template <typename Sent>
+class SendRecorder
+    : public AZStd::vector<Sent>
+{
+public:
+    SendRecorder() { s_recorder = this; }
+    ~SendRecorder() { s_recorder = nullptr; }
+
+    template <typename... Args>
+    static bool Record(Args... args)
+    {
+        s_recorder->emplace_back(args...);
+        return true;
+    }
+
+private:
+    static SendRecorder* s_recorder;
+};
+
+template <typename Sent>
+SendRecorder<Sent>* SendRecorder<Sent>::s_recorder = nullptr;
+
+typedef SendRecorder<AZStd::pair<PlayFabTitleDataSource, AZStd::vector<AZStd::string>>> TitleDataFetchRecorder;
+typedef SendRecorder<AZStd::string> CatalogFetchRecorder;
+typedef SendRecorder<PlayFabTelemetryEvent> TelemetrySendRecorder;
+
+// A notification bus handler, connected for as long as it exists
+template <typename Bus>
+class ConnectedHandler
+    : public Bus::Handler
+{
+public:
+    ConnectedHandler() { this->BusConnect(); }
+    ~ConnectedHandler() { this->BusDisconnect(); }
+};
+
+static ClientModels::CatalogItem MakeCatalogItem(const char* itemId, const char* itemClass, std::vector<AZStd::string> tags)
+{
+    ClientModels::CatalogItem item;
+    item.ItemId = itemId;
+    item.ItemClass = itemClass;
+    item.Tags = AZStd::move(tags);
+    return item;
+}
+
+static PlayFabTelemetryEvent MakeTelemetryEvent(const AZStd::string& eventName)
+{
+    PlayFabTelemetryEvent event;
+    event.type = PlayFabTelemetryPlayerEvent;
+    event.eventName = eventName;
+    return event;
+}
+
+class TitleDataChangeRecorder
+    : public ConnectedHandler<PlayFabClient_TitleDataNotificationBus>
+{
+public:
+    void OnTitleDataChanged(PlayFabTitleDataSource source, const PlayFabTitleDataSnapshot& snapshot, const AZStd::vector<AZStd::string>& changedKeys) override
+    {
+        (void)source;
+        versions.push_back(snapshot.version);
+        keys.push_back(changedKeys);
+    }
+
+    AZStd::vector<AZ::u64> versions;
+    AZStd::vector<AZStd::vector<AZStd::string>> keys;
+};
+
+TEST_F(PlayFabClientSdkTest, TitleDataCache_PublishesOnlyChangedKeys)
+{
+    TitleDataFetchRecorder titleDataFetches;
+    PlayFabTitleDataCache cache(&TitleDataFetchRecorder::Record, 300);
+    TitleDataChangeRecorder recorder;
+    PlayFabTitleDataSnapshotPtr empty = cache.GetSnapshot(PlayFabTitleDataPublic);
+    EXPECT_EQ(0, empty->version);
+    EXPECT_EQ(nullptr, empty->Find("MatchLength"));
+
+    // Nothing is fetched until a source is started, then its keys are fetched together, once at a time
+    auto now = AZStd::chrono::system_clock::now();
+    cache.Update(now);
+    EXPECT_TRUE(titleDataFetches.empty());
+    AZStd::vector<AZStd::string> keys = { "MatchLength", "RespawnDelay", "MOTD" };
+    cache.Start(PlayFabTitleDataPublic, keys);
+    cache.Update(now);
+    cache.Update(now);
+    ASSERT_EQ(1, titleDataFetches.size());
+    EXPECT_EQ(PlayFabTitleDataPublic, titleDataFetches[0].first);
+    EXPECT_EQ(keys, titleDataFetches[0].second);
+
+    PlayFabStringMap<AZStd::string> data;
+    data["MatchLength"] = "600";
+    data["RespawnDelay"] = "5";
+    data["MOTD"] = "Welcome";
+    cache.ApplyFetchResult(PlayFabTitleDataPublic, data);
+    PlayFabTitleDataSnapshotPtr first = cache.GetSnapshot(PlayFabTitleDataPublic);
+    EXPECT_EQ(1, first->version);
+    EXPECT_EQ("600", *first->Find("MatchLength"));
+    ASSERT_EQ(1, recorder.keys.size());
+    EXPECT_EQ(3, recorder.keys[0].size());
+
+    // An identical refresh keeps the same snapshot and sends nothing
+    cache.ApplyFetchResult(PlayFabTitleDataPublic, data);
+    EXPECT_EQ(first, cache.GetSnapshot(PlayFabTitleDataPublic));
+    EXPECT_EQ(1, recorder.keys.size());
+
+    // A changed and a removed key are published, and the replaced snapshot stays readable for as long as it is held
+    data["RespawnDelay"] = "3";
+    data.erase("MOTD");
+    cache.ApplyFetchResult(PlayFabTitleDataPublic, data);
+    PlayFabTitleDataSnapshotPtr second = cache.GetSnapshot(PlayFabTitleDataPublic);
+    EXPECT_EQ(2, second->version);
+    EXPECT_EQ("3", *second->Find("RespawnDelay"));
+    EXPECT_EQ(nullptr, second->Find("MOTD"));
+    EXPECT_EQ("5", *first->Find("RespawnDelay"));
+    ASSERT_EQ(2, recorder.keys.size());
+    EXPECT_EQ(2, recorder.versions[1]);
+    AZStd::vector<AZStd::string> changed = recorder.keys[1];
+    AZStd::sort(changed.begin(), changed.end());
+    EXPECT_EQ((AZStd::vector<AZStd::string>{ "MOTD", "RespawnDelay" }), changed);
+
+    PlayFabTitleDataCacheStats stats = cache.GetStats(PlayFabTitleDataPublic);
+    EXPECT_EQ(3, stats.refreshes);
+    EXPECT_EQ(2, stats.publishedSnapshots);
+    EXPECT_EQ(5, stats.changedKeys);
+
+    // The cache let go of the replaced snapshots, so they are freed as soon as the last reader does
+    EXPECT_EQ(1, first.use_count());
+    EXPECT_EQ(1, empty.use_count());
+    EXPECT_EQ(2, second.use_count());
+
+    // The next fetch waits for the refresh interval
+    now = AZStd::chrono::system_clock::now();
+    cache.Update(now + AZStd::chrono::seconds(299));
+    EXPECT_EQ(1, titleDataFetches.size());
+    cache.Update(now + AZStd::chrono::seconds(301));
+    EXPECT_EQ(2, titleDataFetches.size());
+
+    // A failed fetch is tried again sooner than the refresh interval
+    cache.ApplyFetchFailure(PlayFabTitleDataPublic);
+    now = AZStd::chrono::system_clock::now();
+    cache.Update(now + AZStd::chrono::seconds(31));
+    EXPECT_EQ(3, titleDataFetches.size());
+    EXPECT_EQ(1, cache.GetStats(PlayFabTitleDataPublic).failedRefreshes);
+}
+
+TEST_F(PlayFabClientSdkTest, TitleDataCache_ConcurrentTuningReads_Benchmark)
+{
+    // Game threads reading tuning values while refreshes land, against a mutex guarded map which copies each value out
+    const int readerCount = 4;
+    const int readsPerThread = 200000;
+    const char* tuningKeys[] = { "MatchLength", "RespawnDelay", "MaxPlayers", "DamageScale" };
+    PlayFabStringMap<AZStd::string> data;
+    for (int i = 0; i < 64; ++i)
+        data["Tuning_" + AZStd::to_string(i)] = AZStd::to_string(i * 31);
+    for (const char* key : tuningKeys)
+        data[key] = "100";
+
+    PlayFabTitleDataCache cache(&TitleDataFetchRecorder::Record, 300);
+    cache.ApplyFetchResult(PlayFabTitleDataPublic, data);
+    AZStd::mutex lockedMutex;
+    PlayFabStringMap<AZStd::string> lockedData = data;
+
+    AZStd::atomic<bool> done(false);
+    AZStd::thread writer([&]()
+    {
+        // Each refresh changes a value, so every one publishes
+        for (int version = 0; !done.load(); ++version)
+        {
+            PlayFabStringMap<AZStd::string> refreshed = data;
+            refreshed["MatchLength"] = AZStd::to_string(version);
+            cache.ApplyFetchResult(PlayFabTitleDataPublic, refreshed);
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(lockedMutex);
+                lockedData = refreshed;
+            }
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+    });
+
+    auto runReaders = [&](bool snapshotReads)
+    {
+        AZStd::atomic<size_t> found(0);
+        AZStd::vector<AZStd::thread> readers;
+        auto start = AZStd::chrono::system_clock::now();
+        for (int t = 0; t < readerCount; ++t)
+        {
+            readers.emplace_back([&]()
+            {
+                size_t localFound = 0;
+                for (int i = 0; i < readsPerThread; ++i)
+                {
+                    const char* key = tuningKeys[i & 3];
+                    if (snapshotReads)
+                    {
+                        const AZStd::string* value = cache.GetSnapshot(PlayFabTitleDataPublic)->Find(key);
+                        localFound += value != nullptr && !value->empty();
+                    }
+                    else
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(lockedMutex);
+                        AZStd::string value = lockedData.find(key)->second;
+                        localFound += !value.empty();
+                    }
+                }
+                found += localFound;
+            });
+        }
+        for (AZStd::thread& reader : readers)
+            reader.join();
+        AZ::u64 elapsedUs = MicrosecondsSince(start);
+        EXPECT_EQ(static_cast<size_t>(readerCount) * readsPerThread, found.load());
+        return elapsedUs * 1000.0 / (static_cast<double>(readerCount) * readsPerThread);
+    };
+
+    double lockedNs = runReaders(false);
+    double snapshotNs = runReaders(true);
+    done = true;
+    writer.join();
+
+    PlayFabTitleDataCacheStats stats = cache.GetStats(PlayFabTitleDataPublic);
+    printf("Tuning value reads by %d threads during %llu refreshes: locked copy %.1f ns, snapshot %.1f ns per read\n", readerCount,
+        static_cast<unsigned long long>(stats.publishedSnapshots), lockedNs, snapshotNs);
+    EXPECT_GT(stats.publishedSnapshots, 1);
+}
+
+TEST_F(PlayFabClientSdkTest, CatalogCache_IndexesEachCatalogVersion)
+{
+    CatalogFetchRecorder catalogFetches;
+    PlayFabCatalogCache cache(&CatalogFetchRecorder::Record, 600);
+    cache.Start("");
+    cache.Start("Season2");
+    auto now = AZStd::chrono::system_clock::now();
+    cache.Update(now);
+    cache.Update(now);
+    ASSERT_EQ(2, catalogFetches.size());
+    EXPECT_EQ(nullptr, cache.GetSnapshot(""));
+
+    std::vector<ClientModels::CatalogItem> catalog;
+    catalog.push_back(MakeCatalogItem("sword", "weapon", { "melee", "starter" }));
+    catalog.push_back(MakeCatalogItem("bow", "weapon", { "ranged" }));
+    catalog.push_back(MakeCatalogItem("potion", "consumable", { "starter" }));
+    cache.ApplyFetchResult("", AZStd::move(catalog));
+
+    // Each catalog version has its own snapshot, published as soon as its own fetch completes
+    PlayFabCatalogSnapshotPtr primary = cache.GetSnapshot("");
+    ASSERT_NE(nullptr, primary);
+    EXPECT_EQ(nullptr, cache.GetSnapshot("Season2"));
+    EXPECT_EQ(1, primary->version);
+    ASSERT_NE(nullptr, primary->FindItem("bow"));
+    EXPECT_EQ("bow", primary->FindItem("bow")->ItemId);
+    EXPECT_EQ(nullptr, primary->FindItem("axe"));
+    EXPECT_EQ((AZStd::vector<AZ::u32>{ 0, 1 }), primary->FindByClass("weapon"));
+    EXPECT_EQ((AZStd::vector<AZ::u32>{ 0, 2 }), primary->FindByTag("starter"));
+    EXPECT_TRUE(primary->FindByTag("legendary").empty());
+
+    std::vector<ClientModels::CatalogItem> season;
+    season.push_back(MakeCatalogItem("snowboard", "vehicle", { "winter" }));
+    cache.ApplyFetchResult("Season2", AZStd::move(season));
+    EXPECT_EQ(primary, cache.GetSnapshot(""));
+    ASSERT_NE(nullptr, cache.GetSnapshot("Season2"));
+    EXPECT_NE(nullptr, cache.GetSnapshot("Season2")->FindItem("snowboard"));
+
+    PlayFabCatalogCacheStats stats = cache.GetStats("");
+    EXPECT_EQ(1, stats.refreshes);
+    EXPECT_EQ(3, stats.itemCount);
+    EXPECT_EQ(2, stats.classCount);
+    EXPECT_EQ(3, stats.tagCount);
+    EXPECT_GT(stats.memoryBytes, 3 * sizeof(ClientModels::CatalogItem));
+
+    // A refresh replaces the snapshot
+    now = AZStd::chrono::system_clock::now();
+    cache.Update(now + AZStd::chrono::seconds(599));
+    EXPECT_EQ(2, catalogFetches.size());
+    cache.Update(now + AZStd::chrono::seconds(601));
+    EXPECT_EQ(4, catalogFetches.size());
+    std::vector<ClientModels::CatalogItem> refreshed;
+    refreshed.push_back(MakeCatalogItem("sword", "weapon", {}));
+    cache.ApplyFetchResult("", AZStd::move(refreshed));
+    PlayFabCatalogSnapshotPtr second = cache.GetSnapshot("");
+    EXPECT_EQ(2, second->version);
+    EXPECT_EQ(nullptr, second->FindItem("bow"));
+
+    // A failed fetch is tried again sooner than the refresh interval
+    cache.ApplyFetchFailure("Season2");
+    now = AZStd::chrono::system_clock::now();
+    cache.Update(now + AZStd::chrono::seconds(31));
+    EXPECT_EQ(5, catalogFetches.size());
+    EXPECT_EQ(1, cache.GetStats("Season2").failedRefreshes);
+}
+
+TEST_F(PlayFabClientSdkTest, CatalogCache_ItemLookup_Benchmark)
+{
+    // Looking items up by ItemId, as every system holding an inventory does, by walking the decoded catalog or through the cache's index
+    const int itemCounts[] = { 500, 5000 };
+    const int lookups = 2000;
+    for (int itemCount : itemCounts)
+    {
+        AZStd::string json = MakeCatalogResponse(itemCount);
+        AZStd::vector<char> text(json.begin(), json.end());
+        text.push_back('\0');
+        PlayFabJsonReader reader;
+        reader.Parse(text.data());
+        reader.SeekMember("data");
+        size_t position = reader.GetPosition();
+        PlayFabLazyModel<ClientModels::GetCatalogItemsResult> lazy(AZStd::make_shared<PlayFabRetainedResponse>(reader, text.data(), json.length()), position);
+        ClientModels::GetCatalogItemsResult decoded;
+        lazy.Decode(decoded);
+        ASSERT_EQ(static_cast<size_t>(itemCount), decoded.Catalog.size());
+        std::vector<ClientModels::CatalogItem> walked = decoded.Catalog;
+
+        PlayFabCatalogCache cache(&CatalogFetchRecorder::Record, 600);
+        cache.ApplyFetchResult("", AZStd::move(decoded.Catalog));
+        PlayFabCatalogSnapshotPtr snapshot = cache.GetSnapshot("");
+
+        AZStd::vector<AZStd::string> wanted;
+        for (int i = 0; i < lookups; ++i)
+            wanted.push_back("item_" + AZStd::to_string((i * 7919) % itemCount));
+
+        size_t found = 0;
+        auto start = AZStd::chrono::system_clock::now();
+        for (const AZStd::string& itemId : wanted)
+        {
+            for (const ClientModels::CatalogItem& item : walked)
+            {
+                if (item.ItemId == itemId)
+                {
+                    found++;
+                    break;
+                }
+            }
+        }
+        AZ::u64 walkUs = MicrosecondsSince(start);
+
+        start = AZStd::chrono::system_clock::now();
+        for (const AZStd::string& itemId : wanted)
+            found += snapshot->FindItem(itemId.c_str()) != nullptr;
+        AZ::u64 indexUs = MicrosecondsSince(start);
+
+        PlayFabCatalogCacheStats stats = cache.GetStats("");
+        printf("Catalog of %d items: walk %.1f ns, index %.1f ns per lookup; indexed in %llu us, %llu KB with indexes\n", itemCount,
+            walkUs * 1000.0 / lookups, indexUs * 1000.0 / lookups, static_cast<unsigned long long>(stats.buildUs), static_cast<unsigned long long>(stats.memoryBytes / 1024));
+        EXPECT_EQ(static_cast<size_t>(2 * lookups), found);
+        EXPECT_EQ(static_cast<size_t>(itemCount), snapshot->FindByClass("weapon").size());
+        EXPECT_EQ(static_cast<size_t>(itemCount / 5), snapshot->FindByTag("tier3").size());
+    }
+}
+
+TEST_F(PlayFabClientSdkTest, TelemetryPipeline_DropPoliciesAndSendLimits)
+{
+    TelemetrySendRecorder telemetrySent;
+    PlayFabTelemetryPipeline pipeline(&TelemetrySendRecorder::Record, 8, 10.0f, 3, PlayFabTelemetryDropOldest, 4);
+    auto start = AZStd::chrono::system_clock::now();
+
+    // Drop oldest always takes the new event
+    for (int i = 0; i < 10; ++i)
+    {
+        PlayFabTelemetryEvent event = MakeTelemetryEvent("event_" + AZStd::to_string(i));
+        EXPECT_TRUE(pipeline.Queue(event));
+    }
+    PlayFabTelemetryStats stats = pipeline.GetStats();
+    EXPECT_EQ(10u, stats.producedEvents);
+    EXPECT_EQ(2u, stats.droppedOldest);
+    EXPECT_EQ(8, stats.queuedEvents);
+    EXPECT_EQ(8, stats.capacity);
+
+    // A second's worth of events, but no more than 3 in flight
+    pipeline.Update(start + AZStd::chrono::seconds(1));
+    ASSERT_EQ(3u, telemetrySent.size());
+    EXPECT_EQ("event_2", telemetrySent[0].eventName);
+    EXPECT_FALSE(telemetrySent[0].timestamp.isNull());
+    pipeline.Update(start + AZStd::chrono::seconds(1));
+    EXPECT_EQ(3u, telemetrySent.size());
+    pipeline.OnSendCompleted(true);
+    pipeline.OnSendCompleted(true);
+    pipeline.OnSendCompleted(false);
+    pipeline.Update(start + AZStd::chrono::seconds(1));
+    EXPECT_EQ(6u, telemetrySent.size());
+    for (int i = 0; i < 3; ++i)
+        pipeline.OnSendCompleted(true);
+    pipeline.Update(start + AZStd::chrono::seconds(1));
+    ASSERT_EQ(8u, telemetrySent.size());
+    EXPECT_EQ("event_9", telemetrySent[7].eventName);
+    pipeline.OnSendCompleted(true);
+    pipeline.OnSendCompleted(true);
+
+    // The send rate limits events even with nothing in flight
+    pipeline.SetSendRate(2.0f);
+    for (int i = 0; i < 5; ++i)
+    {
+        PlayFabTelemetryEvent event = MakeTelemetryEvent("late_" + AZStd::to_string(i));
+        pipeline.Queue(event);
+    }
+    pipeline.Update(start + AZStd::chrono::milliseconds(1500));
+    EXPECT_EQ(10u, telemetrySent.size()); // The bucket holds no more than a second's worth
+    for (int i = 0; i < 2; ++i)
+        pipeline.OnSendCompleted(true);
+    pipeline.Update(start + AZStd::chrono::milliseconds(1500));
+    EXPECT_EQ(10u, telemetrySent.size());
+    pipeline.Update(start + AZStd::chrono::milliseconds(2000));
+    EXPECT_EQ(11u, telemetrySent.size());
+    pipeline.OnSendCompleted(true);
+
+    stats = pipeline.GetStats();
+    EXPECT_EQ(11u, stats.sentEvents);
+    EXPECT_EQ(1u, stats.failedEvents);
+    EXPECT_EQ(0, stats.inFlightEvents);
+    EXPECT_EQ(2, stats.queuedEvents);
+
+    // Sampling starts at 3/4 full, keeping one in four new events until the buffer is full
+    telemetrySent.clear();
+    PlayFabTelemetryPipeline sampled(&TelemetrySendRecorder::Record, 8, 0.0f, 0, PlayFabTelemetrySample, 4);
+    int accepted = 0;
+    for (int i = 0; i < 20; ++i)
+    {
+        PlayFabTelemetryEvent event = MakeTelemetryEvent("sampled_" + AZStd::to_string(i));
+        if (sampled.Queue(event))
+            ++accepted;
+    }
+    stats = sampled.GetStats();
+    EXPECT_EQ(8, accepted);
+    EXPECT_EQ(10u, stats.droppedSampled);
+    EXPECT_EQ(2u, stats.droppedFull);
+    EXPECT_EQ(0u, stats.droppedOldest);
+
+    // A send rate of 0 sends nothing until the flush, which ignores it
+    sampled.Update(start + AZStd::chrono::seconds(10));
+    EXPECT_EQ(0u, telemetrySent.size());
+    EXPECT_TRUE(sampled.Flush());
+    ASSERT_EQ(8u, telemetrySent.size());
+    EXPECT_EQ("sampled_0", telemetrySent[0].eventName);
+    EXPECT_EQ("sampled_10", telemetrySent[7].eventName);
+    EXPECT_EQ(0, sampled.GetStats().queuedEvents);
+
+    // The flush keeps to the in flight limit, sending the rest in rounds as earlier events complete
+    telemetrySent.clear();
+    PlayFabTelemetryPipeline limited(&TelemetrySendRecorder::Record, 8, 0.0f, 3, PlayFabTelemetryDropOldest, 4);
+    for (int i = 0; i < 7; ++i)
+    {
+        PlayFabTelemetryEvent event = MakeTelemetryEvent("limited_" + AZStd::to_string(i));
+        limited.Queue(event);
+    }
+    int rounds = 0;
+    for (; !limited.Flush() && rounds < 10; ++rounds)
+    {
+        EXPECT_EQ(3, limited.GetStats().inFlightEvents);
+        EXPECT_EQ(static_cast<size_t>(3 * (rounds + 1)), telemetrySent.size());
+        limited.OnSendCompleted(true);
+        limited.OnSendCompleted(true);
+        limited.OnSendCompleted(true);
+    }
+    EXPECT_EQ(2, rounds);
+    ASSERT_EQ(7u, telemetrySent.size());
+    EXPECT_EQ("limited_6", telemetrySent[6].eventName);
+    EXPECT_EQ(1, limited.GetStats().inFlightEvents);
+    limited.OnSendCompleted(true);
+
+    // The flusher thread sends on its own, and stops before anything queued later can be sent
+    telemetrySent.clear();
+    PlayFabTelemetryPipeline flushed(&TelemetrySendRecorder::Record, 8, 100.0f, 0, PlayFabTelemetryDropOldest, 4);
+    flushed.StartFlusher();
+    PlayFabTelemetryEvent event = MakeTelemetryEvent("flushed");
+    flushed.Queue(event);
+    for (int i = 0; i < 200 && flushed.GetStats().sentEvents == 0; ++i)
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+    flushed.StopFlusher();
+    ASSERT_EQ(1u, telemetrySent.size());
+    EXPECT_EQ("flushed", telemetrySent[0].eventName);
+    event = MakeTelemetryEvent("after_stop");
+    flushed.Queue(event);
+    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(100));
+    EXPECT_EQ(1u, telemetrySent.size());
+}
+
+TEST_F(PlayFabClientSdkTest, TelemetryPipeline_PlayerBurst_Benchmark)
+{
+    // 100 players hitting a boss phase at once, each reporting a burst of combat events from 4 game threads. The flusher then drains
+    // the buffer, waking every 50 ms, with the request manager completing the calls it was given before the next wake.
+    const int players = 100;
+    const int eventsPerPlayer = 100;
+    const int producers = 4;
+    const int events = players * eventsPerPlayer;
+    TelemetrySendRecorder telemetrySent;
+    PlayFabTelemetryPipeline pipeline(&TelemetrySendRecorder::Record, 1024, 50.0f, 4, PlayFabTelemetryDropOldest, 4);
+
+    AZStd::atomic<AZ::u64> queueUs(0);
+    AZStd::vector<AZStd::thread> workers;
+    for (int p = 0; p < producers; ++p)
+    {
+        workers.push_back(AZStd::thread([&pipeline, &queueUs, p]()
+        {
+            AZStd::vector<PlayFabTelemetryEvent> burst;
+            for (int i = p; i < events; i += producers)
+            {
+                PlayFabTelemetryEvent event;
+                event.type = PlayFabTelemetryPlayerEvent;
+                event.eventName = "damage_dealt";
+                event.body["target"] = MultitypeVar(i % players);
+                event.body["amount"] = MultitypeVar(i % 500);
+                burst.push_back(AZStd::move(event));
+            }
+
+            auto start = AZStd::chrono::system_clock::now();
+            for (PlayFabTelemetryEvent& event : burst)
+                pipeline.Queue(event);
+            queueUs += MicrosecondsSince(start);
+        }));
+    }
+    for (AZStd::thread& worker : workers)
+        worker.join();
+    PlayFabTelemetryStats burstStats = pipeline.GetStats();
+
+    auto flusherTime = AZStd::chrono::system_clock::now();
+    int maxPendingCalls = 0;
+    size_t completed = 0;
+    int wakes = 0;
+    while (pipeline.GetStats().queuedEvents > 0 && wakes < 10000)
+    {
+        flusherTime += AZStd::chrono::milliseconds(50);
+        pipeline.Update(flusherTime);
+        ++wakes;
+        maxPendingCalls = AZStd::GetMax(maxPendingCalls, static_cast<int>(telemetrySent.size() - completed));
+        for (; completed < telemetrySent.size(); ++completed)
+            pipeline.OnSendCompleted(true);
+    }
+
+    PlayFabTelemetryStats stats = pipeline.GetStats();
+    printf("%d telemetry events from %d players: %.0f ns per event queued, %d buffered and %llu dropped oldest instead of %d calls queued at once, drained in %.1f s with at most %d calls in flight\n",
+        events, players, static_cast<double>(queueUs) * 1000.0 / events, burstStats.queuedEvents, static_cast<unsigned long long>(burstStats.droppedOldest), events,
+        wakes * 0.05, maxPendingCalls);
+    EXPECT_EQ(static_cast<AZ::u64>(events), stats.producedEvents);
+    EXPECT_EQ(static_cast<AZ::u64>(events - burstStats.capacity), burstStats.droppedOldest);
+    EXPECT_EQ(static_cast<AZ::u64>(burstStats.capacity), stats.sentEvents);
+    EXPECT_EQ(0u, stats.droppedFull);
+    EXPECT_LE(maxPendingCalls, 4);
+    EXPECT_EQ(0, stats.queuedEvents);
+}
+
 AZ_UNIT_TEST_HOOK();
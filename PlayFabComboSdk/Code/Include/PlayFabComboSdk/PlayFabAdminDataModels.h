@@ -23,6 +23,14 @@ namespace PlayFabComboSdk
                 TaskInstanceId(src.TaskInstanceId)
             {}
 
+            AbortTaskInstanceRequest(AbortTaskInstanceRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId))
+            {}
+
+            AbortTaskInstanceRequest& operator=(const AbortTaskInstanceRequest& src) = default;
+            AbortTaskInstanceRequest& operator=(AbortTaskInstanceRequest&& src) = default;
+
             AbortTaskInstanceRequest(const rapidjson::Value& obj) : AbortTaskInstanceRequest()
             {
                 readFromValue(obj);
@@ -47,6 +55,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ActionsOnPlayersInSegmentTaskParameter : public PlayFabBaseModel
@@ -66,6 +97,15 @@ namespace PlayFabComboSdk
                 ActionId(src.ActionId)
             {}
 
+            ActionsOnPlayersInSegmentTaskParameter(ActionsOnPlayersInSegmentTaskParameter&& src) noexcept :
+                PlayFabBaseModel(),
+                SegmentId(AZStd::move(src.SegmentId)),
+                ActionId(AZStd::move(src.ActionId))
+            {}
+
+            ActionsOnPlayersInSegmentTaskParameter& operator=(const ActionsOnPlayersInSegmentTaskParameter& src) = default;
+            ActionsOnPlayersInSegmentTaskParameter& operator=(ActionsOnPlayersInSegmentTaskParameter&& src) = default;
+
             ActionsOnPlayersInSegmentTaskParameter(const rapidjson::Value& obj) : ActionsOnPlayersInSegmentTaskParameter()
             {
                 readFromValue(obj);
@@ -94,6 +134,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SegmentId"):
+                            if (strcmp(member, "SegmentId") != 0)
+                                break;
+                            SegmentId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ActionId"):
+                            if (strcmp(member, "ActionId") != 0)
+                                break;
+                            ActionId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct NameIdentifier : public PlayFabBaseModel
@@ -113,6 +181,15 @@ namespace PlayFabComboSdk
                 Id(src.Id)
             {}
 
+            NameIdentifier(NameIdentifier&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Id(AZStd::move(src.Id))
+            {}
+
+            NameIdentifier& operator=(const NameIdentifier& src) = default;
+            NameIdentifier& operator=(NameIdentifier&& src) = default;
+
             NameIdentifier(const rapidjson::Value& obj) : NameIdentifier()
             {
                 readFromValue(obj);
@@ -145,6 +222,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum TaskInstanceStatus
@@ -177,23 +282,18 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<TaskInstanceStatus>(obj.GetInt());
 
-            static std::map<const char *, TaskInstanceStatus, PlayFabComboSdk::StringCompare> _TaskInstanceStatusMap;
-            if (_TaskInstanceStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _TaskInstanceStatusMap["Succeeded"] = TaskInstanceStatusSucceeded;
-                _TaskInstanceStatusMap["Starting"] = TaskInstanceStatusStarting;
-                _TaskInstanceStatusMap["InProgress"] = TaskInstanceStatusInProgress;
-                _TaskInstanceStatusMap["Failed"] = TaskInstanceStatusFailed;
-                _TaskInstanceStatusMap["Aborted"] = TaskInstanceStatusAborted;
-                _TaskInstanceStatusMap["Pending"] = TaskInstanceStatusPending;
-
+            case PlayFabJsonReader::Hash("Succeeded"): if (strcmp(name, "Succeeded") == 0) return TaskInstanceStatusSucceeded; break;
+            case PlayFabJsonReader::Hash("Starting"): if (strcmp(name, "Starting") == 0) return TaskInstanceStatusStarting; break;
+            case PlayFabJsonReader::Hash("InProgress"): if (strcmp(name, "InProgress") == 0) return TaskInstanceStatusInProgress; break;
+            case PlayFabJsonReader::Hash("Failed"): if (strcmp(name, "Failed") == 0) return TaskInstanceStatusFailed; break;
+            case PlayFabJsonReader::Hash("Aborted"): if (strcmp(name, "Aborted") == 0) return TaskInstanceStatusAborted; break;
+            case PlayFabJsonReader::Hash("Pending"): if (strcmp(name, "Pending") == 0) return TaskInstanceStatusPending; break;
             }
 
-            auto output = _TaskInstanceStatusMap.find(obj.GetString());
-            if (output != _TaskInstanceStatusMap.end())
-                return output->second;
-
             return TaskInstanceStatusSucceeded; // Basically critical fail
         }
 
@@ -244,6 +344,53 @@ namespace PlayFabComboSdk
                 TotalPlayersProcessed(src.TotalPlayersProcessed)
             {}
 
+            ActionsOnPlayersInSegmentTaskSummary(ActionsOnPlayersInSegmentTaskSummary&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId)),
+                TaskIdentifier(src.TaskIdentifier),
+                StartedAt(AZStd::move(src.StartedAt)),
+                CompletedAt(AZStd::move(src.CompletedAt)),
+                Status(AZStd::move(src.Status)),
+                PercentComplete(AZStd::move(src.PercentComplete)),
+                EstimatedSecondsRemaining(AZStd::move(src.EstimatedSecondsRemaining)),
+                ScheduledByUserId(AZStd::move(src.ScheduledByUserId)),
+                ErrorMessage(AZStd::move(src.ErrorMessage)),
+                ErrorWasFatal(AZStd::move(src.ErrorWasFatal)),
+                TotalPlayersInSegment(AZStd::move(src.TotalPlayersInSegment)),
+                TotalPlayersProcessed(AZStd::move(src.TotalPlayersProcessed))
+            {
+                src.TaskIdentifier = nullptr;
+            }
+
+            ActionsOnPlayersInSegmentTaskSummary& operator=(const ActionsOnPlayersInSegmentTaskSummary& src)
+            {
+                if (this != &src)
+                    *this = ActionsOnPlayersInSegmentTaskSummary(src);
+                return *this;
+            }
+
+            ActionsOnPlayersInSegmentTaskSummary& operator=(ActionsOnPlayersInSegmentTaskSummary&& src)
+            {
+                if (this != &src)
+                {
+                    TaskInstanceId = AZStd::move(src.TaskInstanceId);
+                    if (TaskIdentifier != nullptr) delete TaskIdentifier;
+                    TaskIdentifier = src.TaskIdentifier;
+                    src.TaskIdentifier = nullptr;
+                    StartedAt = AZStd::move(src.StartedAt);
+                    CompletedAt = AZStd::move(src.CompletedAt);
+                    Status = AZStd::move(src.Status);
+                    PercentComplete = AZStd::move(src.PercentComplete);
+                    EstimatedSecondsRemaining = AZStd::move(src.EstimatedSecondsRemaining);
+                    ScheduledByUserId = AZStd::move(src.ScheduledByUserId);
+                    ErrorMessage = AZStd::move(src.ErrorMessage);
+                    ErrorWasFatal = AZStd::move(src.ErrorWasFatal);
+                    TotalPlayersInSegment = AZStd::move(src.TotalPlayersInSegment);
+                    TotalPlayersProcessed = AZStd::move(src.TotalPlayersProcessed);
+                }
+                return *this;
+            }
+
             ActionsOnPlayersInSegmentTaskSummary(const rapidjson::Value& obj) : ActionsOnPlayersInSegmentTaskSummary()
             {
                 readFromValue(obj);
@@ -335,6 +482,85 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TaskIdentifier"):
+                            if (strcmp(member, "TaskIdentifier") != 0)
+                                break;
+                            TaskIdentifier = new NameIdentifier;
+                            TaskIdentifier->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("StartedAt"):
+                            if (strcmp(member, "StartedAt") != 0)
+                                break;
+                            StartedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CompletedAt"):
+                            if (strcmp(member, "CompletedAt") != 0)
+                                break;
+                            CompletedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readTaskInstanceStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PercentComplete"):
+                            if (strcmp(member, "PercentComplete") != 0)
+                                break;
+                            PercentComplete = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("EstimatedSecondsRemaining"):
+                            if (strcmp(member, "EstimatedSecondsRemaining") != 0)
+                                break;
+                            EstimatedSecondsRemaining = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledByUserId"):
+                            if (strcmp(member, "ScheduledByUserId") != 0)
+                                break;
+                            ScheduledByUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ErrorMessage"):
+                            if (strcmp(member, "ErrorMessage") != 0)
+                                break;
+                            ErrorMessage = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ErrorWasFatal"):
+                            if (strcmp(member, "ErrorWasFatal") != 0)
+                                break;
+                            ErrorWasFatal = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalPlayersInSegment"):
+                            if (strcmp(member, "TotalPlayersInSegment") != 0)
+                                break;
+                            TotalPlayersInSegment = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalPlayersProcessed"):
+                            if (strcmp(member, "TotalPlayersProcessed") != 0)
+                                break;
+                            TotalPlayersProcessed = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AdCampaignAttribution : public PlayFabBaseModel
@@ -357,6 +583,16 @@ namespace PlayFabComboSdk
                 AttributedAt(src.AttributedAt)
             {}
 
+            AdCampaignAttribution(AdCampaignAttribution&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                CampaignId(AZStd::move(src.CampaignId)),
+                AttributedAt(AZStd::move(src.AttributedAt))
+            {}
+
+            AdCampaignAttribution& operator=(const AdCampaignAttribution& src) = default;
+            AdCampaignAttribution& operator=(AdCampaignAttribution&& src) = default;
+
             AdCampaignAttribution(const rapidjson::Value& obj) : AdCampaignAttribution()
             {
                 readFromValue(obj);
@@ -393,6 +629,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CampaignId"):
+                            if (strcmp(member, "CampaignId") != 0)
+                                break;
+                            CampaignId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("AttributedAt"):
+                            if (strcmp(member, "AttributedAt") != 0)
+                                break;
+                            AttributedAt = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddNewsRequest : public PlayFabBaseModel
@@ -415,6 +684,16 @@ namespace PlayFabComboSdk
                 Body(src.Body)
             {}
 
+            AddNewsRequest(AddNewsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Timestamp(AZStd::move(src.Timestamp)),
+                Title(AZStd::move(src.Title)),
+                Body(AZStd::move(src.Body))
+            {}
+
+            AddNewsRequest& operator=(const AddNewsRequest& src) = default;
+            AddNewsRequest& operator=(AddNewsRequest&& src) = default;
+
             AddNewsRequest(const rapidjson::Value& obj) : AddNewsRequest()
             {
                 readFromValue(obj);
@@ -449,6 +728,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Title"):
+                            if (strcmp(member, "Title") != 0)
+                                break;
+                            Title = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Body"):
+                            if (strcmp(member, "Body") != 0)
+                                break;
+                            Body = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddNewsResult : public PlayFabBaseModel
@@ -465,6 +777,14 @@ namespace PlayFabComboSdk
                 NewsId(src.NewsId)
             {}
 
+            AddNewsResult(AddNewsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                NewsId(AZStd::move(src.NewsId))
+            {}
+
+            AddNewsResult& operator=(const AddNewsResult& src) = default;
+            AddNewsResult& operator=(AddNewsResult&& src) = default;
+
             AddNewsResult(const rapidjson::Value& obj) : AddNewsResult()
             {
                 readFromValue(obj);
@@ -491,6 +811,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("NewsId"):
+                            if (strcmp(member, "NewsId") != 0)
+                                break;
+                            NewsId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddPlayerTagRequest : public PlayFabBaseModel
@@ -510,6 +853,15 @@ namespace PlayFabComboSdk
                 TagName(src.TagName)
             {}
 
+            AddPlayerTagRequest(AddPlayerTagRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                TagName(AZStd::move(src.TagName))
+            {}
+
+            AddPlayerTagRequest& operator=(const AddPlayerTagRequest& src) = default;
+            AddPlayerTagRequest& operator=(AddPlayerTagRequest&& src) = default;
+
             AddPlayerTagRequest(const rapidjson::Value& obj) : AddPlayerTagRequest()
             {
                 readFromValue(obj);
@@ -538,6 +890,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TagName"):
+                            if (strcmp(member, "TagName") != 0)
+                                break;
+                            TagName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddPlayerTagResult : public PlayFabBaseModel
@@ -551,6 +931,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            AddPlayerTagResult(AddPlayerTagResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            AddPlayerTagResult& operator=(const AddPlayerTagResult& src) = default;
+            AddPlayerTagResult& operator=(AddPlayerTagResult&& src) = default;
+
             AddPlayerTagResult(const rapidjson::Value& obj) : AddPlayerTagResult()
             {
                 readFromValue(obj);
@@ -571,6 +958,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         enum Region
@@ -605,24 +998,19 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<Region>(obj.GetInt());
 
-            static std::map<const char *, Region, PlayFabComboSdk::StringCompare> _RegionMap;
-            if (_RegionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _RegionMap["USCentral"] = RegionUSCentral;
-                _RegionMap["USEast"] = RegionUSEast;
-                _RegionMap["EUWest"] = RegionEUWest;
-                _RegionMap["Singapore"] = RegionSingapore;
-                _RegionMap["Japan"] = RegionJapan;
-                _RegionMap["Brazil"] = RegionBrazil;
-                _RegionMap["Australia"] = RegionAustralia;
-
+            case PlayFabJsonReader::Hash("USCentral"): if (strcmp(name, "USCentral") == 0) return RegionUSCentral; break;
+            case PlayFabJsonReader::Hash("USEast"): if (strcmp(name, "USEast") == 0) return RegionUSEast; break;
+            case PlayFabJsonReader::Hash("EUWest"): if (strcmp(name, "EUWest") == 0) return RegionEUWest; break;
+            case PlayFabJsonReader::Hash("Singapore"): if (strcmp(name, "Singapore") == 0) return RegionSingapore; break;
+            case PlayFabJsonReader::Hash("Japan"): if (strcmp(name, "Japan") == 0) return RegionJapan; break;
+            case PlayFabJsonReader::Hash("Brazil"): if (strcmp(name, "Brazil") == 0) return RegionBrazil; break;
+            case PlayFabJsonReader::Hash("Australia"): if (strcmp(name, "Australia") == 0) return RegionAustralia; break;
             }
 
-            auto output = _RegionMap.find(obj.GetString());
-            if (output != _RegionMap.end())
-                return output->second;
-
             return RegionUSCentral; // Basically critical fail
         }
 
@@ -631,7 +1019,7 @@ namespace PlayFabComboSdk
             AZStd::string BuildId;
             AZStd::string CommandLineTemplate;
             AZStd::string ExecutablePath;
-            std::list<Region> ActiveRegions;
+            std::vector<Region> ActiveRegions;
             AZStd::string Comment;
             Int32 MaxGamesPerHost;
             Int32 MinFreeGameSlots;
@@ -658,6 +1046,20 @@ namespace PlayFabComboSdk
                 MinFreeGameSlots(src.MinFreeGameSlots)
             {}
 
+            AddServerBuildRequest(AddServerBuildRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId)),
+                CommandLineTemplate(AZStd::move(src.CommandLineTemplate)),
+                ExecutablePath(AZStd::move(src.ExecutablePath)),
+                ActiveRegions(AZStd::move(src.ActiveRegions)),
+                Comment(AZStd::move(src.Comment)),
+                MaxGamesPerHost(AZStd::move(src.MaxGamesPerHost)),
+                MinFreeGameSlots(AZStd::move(src.MinFreeGameSlots))
+            {}
+
+            AddServerBuildRequest& operator=(const AddServerBuildRequest& src) = default;
+            AddServerBuildRequest& operator=(AddServerBuildRequest&& src) = default;
+
             AddServerBuildRequest(const rapidjson::Value& obj) : AddServerBuildRequest()
             {
                 readFromValue(obj);
@@ -683,7 +1085,7 @@ namespace PlayFabComboSdk
                 if (!ActiveRegions.empty()) {
                     writer.String("ActiveRegions");
                     writer.StartArray();
-                    for (std::list<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
+                    for (std::vector<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
                         writeRegionEnumJSON(*iter, writer);
                     }
                     writer.EndArray();
@@ -710,6 +1112,7 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActiveRegions_member = obj.FindMember("ActiveRegions");
                 if (ActiveRegions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActiveRegions_member->value;
+                    ActiveRegions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
                         ActiveRegions.push_back(readRegionFromValue(memberList[i]));
                     }
@@ -723,6 +1126,66 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CommandLineTemplate"):
+                            if (strcmp(member, "CommandLineTemplate") != 0)
+                                break;
+                            CommandLineTemplate = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExecutablePath"):
+                            if (strcmp(member, "ExecutablePath") != 0)
+                                break;
+                            ExecutablePath = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ActiveRegions"):
+                            if (strcmp(member, "ActiveRegions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActiveRegions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActiveRegions.push_back(readRegionFromValue(reader.GetValue()));
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxGamesPerHost"):
+                            if (strcmp(member, "MaxGamesPerHost") != 0)
+                                break;
+                            MaxGamesPerHost = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinFreeGameSlots"):
+                            if (strcmp(member, "MinFreeGameSlots") != 0)
+                                break;
+                            MinFreeGameSlots = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum GameBuildStatus
@@ -753,29 +1216,24 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<GameBuildStatus>(obj.GetInt());
 
-            static std::map<const char *, GameBuildStatus, PlayFabComboSdk::StringCompare> _GameBuildStatusMap;
-            if (_GameBuildStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _GameBuildStatusMap["Available"] = GameBuildStatusAvailable;
-                _GameBuildStatusMap["Validating"] = GameBuildStatusValidating;
-                _GameBuildStatusMap["InvalidBuildPackage"] = GameBuildStatusInvalidBuildPackage;
-                _GameBuildStatusMap["Processing"] = GameBuildStatusProcessing;
-                _GameBuildStatusMap["FailedToProcess"] = GameBuildStatusFailedToProcess;
-
+            case PlayFabJsonReader::Hash("Available"): if (strcmp(name, "Available") == 0) return GameBuildStatusAvailable; break;
+            case PlayFabJsonReader::Hash("Validating"): if (strcmp(name, "Validating") == 0) return GameBuildStatusValidating; break;
+            case PlayFabJsonReader::Hash("InvalidBuildPackage"): if (strcmp(name, "InvalidBuildPackage") == 0) return GameBuildStatusInvalidBuildPackage; break;
+            case PlayFabJsonReader::Hash("Processing"): if (strcmp(name, "Processing") == 0) return GameBuildStatusProcessing; break;
+            case PlayFabJsonReader::Hash("FailedToProcess"): if (strcmp(name, "FailedToProcess") == 0) return GameBuildStatusFailedToProcess; break;
             }
 
-            auto output = _GameBuildStatusMap.find(obj.GetString());
-            if (output != _GameBuildStatusMap.end())
-                return output->second;
-
             return GameBuildStatusAvailable; // Basically critical fail
         }
 
         struct AddServerBuildResult : public PlayFabBaseModel
         {
             AZStd::string BuildId;
-            std::list<Region> ActiveRegions;
+            std::vector<Region> ActiveRegions;
             Int32 MaxGamesPerHost;
             Int32 MinFreeGameSlots;
             AZStd::string CommandLineTemplate;
@@ -813,6 +1271,23 @@ namespace PlayFabComboSdk
                 Status(src.Status)
             {}
 
+            AddServerBuildResult(AddServerBuildResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId)),
+                ActiveRegions(AZStd::move(src.ActiveRegions)),
+                MaxGamesPerHost(AZStd::move(src.MaxGamesPerHost)),
+                MinFreeGameSlots(AZStd::move(src.MinFreeGameSlots)),
+                CommandLineTemplate(AZStd::move(src.CommandLineTemplate)),
+                ExecutablePath(AZStd::move(src.ExecutablePath)),
+                Comment(AZStd::move(src.Comment)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                TitleId(AZStd::move(src.TitleId)),
+                Status(AZStd::move(src.Status))
+            {}
+
+            AddServerBuildResult& operator=(const AddServerBuildResult& src) = default;
+            AddServerBuildResult& operator=(AddServerBuildResult&& src) = default;
+
             AddServerBuildResult(const rapidjson::Value& obj) : AddServerBuildResult()
             {
                 readFromValue(obj);
@@ -832,7 +1307,7 @@ namespace PlayFabComboSdk
                 if (!ActiveRegions.empty()) {
                     writer.String("ActiveRegions");
                     writer.StartArray();
-                    for (std::list<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
+                    for (std::vector<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
                         writeRegionEnumJSON(*iter, writer);
                     }
                     writer.EndArray();
@@ -873,6 +1348,7 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActiveRegions_member = obj.FindMember("ActiveRegions");
                 if (ActiveRegions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActiveRegions_member->value;
+                    ActiveRegions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
                         ActiveRegions.push_back(readRegionFromValue(memberList[i]));
                     }
@@ -896,6 +1372,81 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ActiveRegions"):
+                            if (strcmp(member, "ActiveRegions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActiveRegions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActiveRegions.push_back(readRegionFromValue(reader.GetValue()));
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxGamesPerHost"):
+                            if (strcmp(member, "MaxGamesPerHost") != 0)
+                                break;
+                            MaxGamesPerHost = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinFreeGameSlots"):
+                            if (strcmp(member, "MinFreeGameSlots") != 0)
+                                break;
+                            MinFreeGameSlots = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("CommandLineTemplate"):
+                            if (strcmp(member, "CommandLineTemplate") != 0)
+                                break;
+                            CommandLineTemplate = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExecutablePath"):
+                            if (strcmp(member, "ExecutablePath") != 0)
+                                break;
+                            ExecutablePath = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readGameBuildStatusFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddUserVirtualCurrencyRequest : public PlayFabBaseModel
@@ -918,6 +1469,16 @@ namespace PlayFabComboSdk
                 Amount(src.Amount)
             {}
 
+            AddUserVirtualCurrencyRequest(AddUserVirtualCurrencyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Amount(AZStd::move(src.Amount))
+            {}
+
+            AddUserVirtualCurrencyRequest& operator=(const AddUserVirtualCurrencyRequest& src) = default;
+            AddUserVirtualCurrencyRequest& operator=(AddUserVirtualCurrencyRequest&& src) = default;
+
             AddUserVirtualCurrencyRequest(const rapidjson::Value& obj) : AddUserVirtualCurrencyRequest()
             {
                 readFromValue(obj);
@@ -950,6 +1511,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Amount"):
+                            if (strcmp(member, "Amount") != 0)
+                                break;
+                            Amount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct VirtualCurrencyData : public PlayFabBaseModel
@@ -978,6 +1572,18 @@ namespace PlayFabComboSdk
                 RechargeMax(src.RechargeMax)
             {}
 
+            VirtualCurrencyData(VirtualCurrencyData&& src) noexcept :
+                PlayFabBaseModel(),
+                CurrencyCode(AZStd::move(src.CurrencyCode)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                InitialDeposit(AZStd::move(src.InitialDeposit)),
+                RechargeRate(AZStd::move(src.RechargeRate)),
+                RechargeMax(AZStd::move(src.RechargeMax))
+            {}
+
+            VirtualCurrencyData& operator=(const VirtualCurrencyData& src) = default;
+            VirtualCurrencyData& operator=(VirtualCurrencyData&& src) = default;
+
             VirtualCurrencyData(const rapidjson::Value& obj) : VirtualCurrencyData()
             {
                 readFromValue(obj);
@@ -1026,11 +1632,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CurrencyCode"):
+                            if (strcmp(member, "CurrencyCode") != 0)
+                                break;
+                            CurrencyCode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("InitialDeposit"):
+                            if (strcmp(member, "InitialDeposit") != 0)
+                                break;
+                            InitialDeposit = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeRate"):
+                            if (strcmp(member, "RechargeRate") != 0)
+                                break;
+                            RechargeRate = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeMax"):
+                            if (strcmp(member, "RechargeMax") != 0)
+                                break;
+                            RechargeMax = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddVirtualCurrencyTypesRequest : public PlayFabBaseModel
         {
-            std::list<VirtualCurrencyData> VirtualCurrencies;
+            std::vector<VirtualCurrencyData> VirtualCurrencies;
 
             AddVirtualCurrencyTypesRequest() :
                 PlayFabBaseModel(),
@@ -1042,6 +1691,14 @@ namespace PlayFabComboSdk
                 VirtualCurrencies(src.VirtualCurrencies)
             {}
 
+            AddVirtualCurrencyTypesRequest(AddVirtualCurrencyTypesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                VirtualCurrencies(AZStd::move(src.VirtualCurrencies))
+            {}
+
+            AddVirtualCurrencyTypesRequest& operator=(const AddVirtualCurrencyTypesRequest& src) = default;
+            AddVirtualCurrencyTypesRequest& operator=(AddVirtualCurrencyTypesRequest&& src) = default;
+
             AddVirtualCurrencyTypesRequest(const rapidjson::Value& obj) : AddVirtualCurrencyTypesRequest()
             {
                 readFromValue(obj);
@@ -1056,7 +1713,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("VirtualCurrencies");
                 writer.StartArray();
-                for (std::list<VirtualCurrencyData>::iterator iter = VirtualCurrencies.begin(); iter != VirtualCurrencies.end(); iter++) {
+                for (std::vector<VirtualCurrencyData>::iterator iter = VirtualCurrencies.begin(); iter != VirtualCurrencies.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -1068,13 +1725,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator VirtualCurrencies_member = obj.FindMember("VirtualCurrencies");
                 if (VirtualCurrencies_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = VirtualCurrencies_member->value;
+                    VirtualCurrencies.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        VirtualCurrencies.push_back(VirtualCurrencyData(memberList[i]));
+                        VirtualCurrencies.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("VirtualCurrencies"):
+                            if (strcmp(member, "VirtualCurrencies") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                VirtualCurrencies.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    VirtualCurrencies.emplace_back();
+                                    VirtualCurrencies.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum Conditionals
@@ -1101,20 +1790,15 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<Conditionals>(obj.GetInt());
 
-            static std::map<const char *, Conditionals, PlayFabComboSdk::StringCompare> _ConditionalsMap;
-            if (_ConditionalsMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ConditionalsMap["Any"] = ConditionalsAny;
-                _ConditionalsMap["True"] = ConditionalsTrue;
-                _ConditionalsMap["False"] = ConditionalsFalse;
-
+            case PlayFabJsonReader::Hash("Any"): if (strcmp(name, "Any") == 0) return ConditionalsAny; break;
+            case PlayFabJsonReader::Hash("True"): if (strcmp(name, "True") == 0) return ConditionalsTrue; break;
+            case PlayFabJsonReader::Hash("False"): if (strcmp(name, "False") == 0) return ConditionalsFalse; break;
             }
 
-            auto output = _ConditionalsMap.find(obj.GetString());
-            if (output != _ConditionalsMap.end())
-                return output->second;
-
             return ConditionalsAny; // Basically critical fail
         }
 
@@ -1132,6 +1816,14 @@ namespace PlayFabComboSdk
                 HasSignatureOrEncryption(src.HasSignatureOrEncryption)
             {}
 
+            ApiCondition(ApiCondition&& src) noexcept :
+                PlayFabBaseModel(),
+                HasSignatureOrEncryption(AZStd::move(src.HasSignatureOrEncryption))
+            {}
+
+            ApiCondition& operator=(const ApiCondition& src) = default;
+            ApiCondition& operator=(ApiCondition&& src) = default;
+
             ApiCondition(const rapidjson::Value& obj) : ApiCondition()
             {
                 readFromValue(obj);
@@ -1158,6 +1850,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("HasSignatureOrEncryption"):
+                            if (strcmp(member, "HasSignatureOrEncryption") != 0)
+                                break;
+                            HasSignatureOrEncryption = readConditionalsFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanInfo : public PlayFabBaseModel
@@ -1195,6 +1910,21 @@ namespace PlayFabComboSdk
                 Active(src.Active)
             {}
 
+            BanInfo(BanInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                BanId(AZStd::move(src.BanId)),
+                IPAddress(AZStd::move(src.IPAddress)),
+                MACAddress(AZStd::move(src.MACAddress)),
+                Created(AZStd::move(src.Created)),
+                Expires(AZStd::move(src.Expires)),
+                Reason(AZStd::move(src.Reason)),
+                Active(AZStd::move(src.Active))
+            {}
+
+            BanInfo& operator=(const BanInfo& src) = default;
+            BanInfo& operator=(BanInfo&& src) = default;
+
             BanInfo(const rapidjson::Value& obj) : BanInfo()
             {
                 readFromValue(obj);
@@ -1261,6 +1991,64 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BanId"):
+                            if (strcmp(member, "BanId") != 0)
+                                break;
+                            BanId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IPAddress"):
+                            if (strcmp(member, "IPAddress") != 0)
+                                break;
+                            IPAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MACAddress"):
+                            if (strcmp(member, "MACAddress") != 0)
+                                break;
+                            MACAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expires"):
+                            if (strcmp(member, "Expires") != 0)
+                                break;
+                            Expires = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Active"):
+                            if (strcmp(member, "Active") != 0)
+                                break;
+                            Active = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanRequest : public PlayFabBaseModel
@@ -1289,6 +2077,18 @@ namespace PlayFabComboSdk
                 DurationInHours(src.DurationInHours)
             {}
 
+            BanRequest(BanRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                IPAddress(AZStd::move(src.IPAddress)),
+                MACAddress(AZStd::move(src.MACAddress)),
+                Reason(AZStd::move(src.Reason)),
+                DurationInHours(AZStd::move(src.DurationInHours))
+            {}
+
+            BanRequest& operator=(const BanRequest& src) = default;
+            BanRequest& operator=(BanRequest&& src) = default;
+
             BanRequest(const rapidjson::Value& obj) : BanRequest()
             {
                 readFromValue(obj);
@@ -1337,11 +2137,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IPAddress"):
+                            if (strcmp(member, "IPAddress") != 0)
+                                break;
+                            IPAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MACAddress"):
+                            if (strcmp(member, "MACAddress") != 0)
+                                break;
+                            MACAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DurationInHours"):
+                            if (strcmp(member, "DurationInHours") != 0)
+                                break;
+                            DurationInHours = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanUsersRequest : public PlayFabBaseModel
         {
-            std::list<BanRequest> Bans;
+            std::vector<BanRequest> Bans;
 
             BanUsersRequest() :
                 PlayFabBaseModel(),
@@ -1353,6 +2196,14 @@ namespace PlayFabComboSdk
                 Bans(src.Bans)
             {}
 
+            BanUsersRequest(BanUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Bans(AZStd::move(src.Bans))
+            {}
+
+            BanUsersRequest& operator=(const BanUsersRequest& src) = default;
+            BanUsersRequest& operator=(BanUsersRequest&& src) = default;
+
             BanUsersRequest(const rapidjson::Value& obj) : BanUsersRequest()
             {
                 readFromValue(obj);
@@ -1367,7 +2218,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Bans");
                 writer.StartArray();
-                for (std::list<BanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
+                for (std::vector<BanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -1379,18 +2230,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Bans_member = obj.FindMember("Bans");
                 if (Bans_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Bans_member->value;
+                    Bans.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Bans.push_back(BanRequest(memberList[i]));
+                        Bans.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Bans"):
+                            if (strcmp(member, "Bans") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Bans.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Bans.emplace_back();
+                                    Bans.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanUsersResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             BanUsersResult() :
                 PlayFabBaseModel(),
@@ -1402,6 +2285,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            BanUsersResult(BanUsersResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            BanUsersResult& operator=(const BanUsersResult& src) = default;
+            BanUsersResult& operator=(BanUsersResult&& src) = default;
+
             BanUsersResult(const rapidjson::Value& obj) : BanUsersResult()
             {
                 readFromValue(obj);
@@ -1417,7 +2308,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -1430,13 +2321,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BlankResult : public PlayFabBaseModel
@@ -1450,6 +2373,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            BlankResult(BlankResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            BlankResult& operator=(const BlankResult& src) = default;
+            BlankResult& operator=(BlankResult&& src) = default;
+
             BlankResult(const rapidjson::Value& obj) : BlankResult()
             {
                 readFromValue(obj);
@@ -1470,6 +2400,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct CatalogItemConsumableInfo : public PlayFabBaseModel
@@ -1492,6 +2428,16 @@ namespace PlayFabComboSdk
                 UsagePeriodGroup(src.UsagePeriodGroup)
             {}
 
+            CatalogItemConsumableInfo(CatalogItemConsumableInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                UsageCount(AZStd::move(src.UsageCount)),
+                UsagePeriod(AZStd::move(src.UsagePeriod)),
+                UsagePeriodGroup(AZStd::move(src.UsagePeriodGroup))
+            {}
+
+            CatalogItemConsumableInfo& operator=(const CatalogItemConsumableInfo& src) = default;
+            CatalogItemConsumableInfo& operator=(CatalogItemConsumableInfo&& src) = default;
+
             CatalogItemConsumableInfo(const rapidjson::Value& obj) : CatalogItemConsumableInfo()
             {
                 readFromValue(obj);
@@ -1530,14 +2476,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("UsageCount"):
+                            if (strcmp(member, "UsageCount") != 0)
+                                break;
+                            UsageCount = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsagePeriod"):
+                            if (strcmp(member, "UsagePeriod") != 0)
+                                break;
+                            UsagePeriod = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsagePeriodGroup"):
+                            if (strcmp(member, "UsagePeriodGroup") != 0)
+                                break;
+                            UsagePeriodGroup = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItemContainerInfo : public PlayFabBaseModel
         {
             AZStd::string KeyItemId;
-            std::list<AZStd::string> ItemContents;
-            std::list<AZStd::string> ResultTableContents;
-            std::map<AZStd::string, Uint32> VirtualCurrencyContents;
+            std::vector<AZStd::string> ItemContents;
+            std::vector<AZStd::string> ResultTableContents;
+            PlayFabStringMap<Uint32> VirtualCurrencyContents;
 
             CatalogItemContainerInfo() :
                 PlayFabBaseModel(),
@@ -1555,6 +2534,17 @@ namespace PlayFabComboSdk
                 VirtualCurrencyContents(src.VirtualCurrencyContents)
             {}
 
+            CatalogItemContainerInfo(CatalogItemContainerInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                KeyItemId(AZStd::move(src.KeyItemId)),
+                ItemContents(AZStd::move(src.ItemContents)),
+                ResultTableContents(AZStd::move(src.ResultTableContents)),
+                VirtualCurrencyContents(AZStd::move(src.VirtualCurrencyContents))
+            {}
+
+            CatalogItemContainerInfo& operator=(const CatalogItemContainerInfo& src) = default;
+            CatalogItemContainerInfo& operator=(CatalogItemContainerInfo&& src) = default;
+
             CatalogItemContainerInfo(const rapidjson::Value& obj) : CatalogItemContainerInfo()
             {
                 readFromValue(obj);
@@ -1574,7 +2564,7 @@ namespace PlayFabComboSdk
                 if (!ItemContents.empty()) {
                     writer.String("ItemContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = ItemContents.begin(); iter != ItemContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = ItemContents.begin(); iter != ItemContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -1582,7 +2572,7 @@ namespace PlayFabComboSdk
                 if (!ResultTableContents.empty()) {
                     writer.String("ResultTableContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = ResultTableContents.begin(); iter != ResultTableContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = ResultTableContents.begin(); iter != ResultTableContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -1590,7 +2580,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyContents.empty()) {
                     writer.String("VirtualCurrencyContents");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = VirtualCurrencyContents.begin(); iter != VirtualCurrencyContents.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = VirtualCurrencyContents.begin(); iter != VirtualCurrencyContents.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -1606,15 +2596,17 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemContents_member = obj.FindMember("ItemContents");
                 if (ItemContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemContents_member->value;
+                    ItemContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemContents.push_back(memberList[i].GetString());
+                        ItemContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator ResultTableContents_member = obj.FindMember("ResultTableContents");
                 if (ResultTableContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ResultTableContents_member->value;
+                    ResultTableContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ResultTableContents.push_back(memberList[i].GetString());
+                        ResultTableContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrencyContents_member = obj.FindMember("VirtualCurrencyContents");
@@ -1626,13 +2618,72 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("KeyItemId"):
+                            if (strcmp(member, "KeyItemId") != 0)
+                                break;
+                            KeyItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemContents"):
+                            if (strcmp(member, "ItemContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("ResultTableContents"):
+                            if (strcmp(member, "ResultTableContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ResultTableContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ResultTableContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyContents"):
+                            if (strcmp(member, "VirtualCurrencyContents") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyContents[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItemBundleInfo : public PlayFabBaseModel
         {
-            std::list<AZStd::string> BundledItems;
-            std::list<AZStd::string> BundledResultTables;
-            std::map<AZStd::string, Uint32> BundledVirtualCurrencies;
+            std::vector<AZStd::string> BundledItems;
+            std::vector<AZStd::string> BundledResultTables;
+            PlayFabStringMap<Uint32> BundledVirtualCurrencies;
 
             CatalogItemBundleInfo() :
                 PlayFabBaseModel(),
@@ -1648,6 +2699,16 @@ namespace PlayFabComboSdk
                 BundledVirtualCurrencies(src.BundledVirtualCurrencies)
             {}
 
+            CatalogItemBundleInfo(CatalogItemBundleInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                BundledItems(AZStd::move(src.BundledItems)),
+                BundledResultTables(AZStd::move(src.BundledResultTables)),
+                BundledVirtualCurrencies(AZStd::move(src.BundledVirtualCurrencies))
+            {}
+
+            CatalogItemBundleInfo& operator=(const CatalogItemBundleInfo& src) = default;
+            CatalogItemBundleInfo& operator=(CatalogItemBundleInfo&& src) = default;
+
             CatalogItemBundleInfo(const rapidjson::Value& obj) : CatalogItemBundleInfo()
             {
                 readFromValue(obj);
@@ -1663,7 +2724,7 @@ namespace PlayFabComboSdk
                 if (!BundledItems.empty()) {
                     writer.String("BundledItems");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundledItems.begin(); iter != BundledItems.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundledItems.begin(); iter != BundledItems.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -1671,7 +2732,7 @@ namespace PlayFabComboSdk
                 if (!BundledResultTables.empty()) {
                     writer.String("BundledResultTables");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundledResultTables.begin(); iter != BundledResultTables.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundledResultTables.begin(); iter != BundledResultTables.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -1679,7 +2740,7 @@ namespace PlayFabComboSdk
                 if (!BundledVirtualCurrencies.empty()) {
                     writer.String("BundledVirtualCurrencies");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = BundledVirtualCurrencies.begin(); iter != BundledVirtualCurrencies.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = BundledVirtualCurrencies.begin(); iter != BundledVirtualCurrencies.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -1693,15 +2754,17 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundledItems_member = obj.FindMember("BundledItems");
                 if (BundledItems_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundledItems_member->value;
+                    BundledItems.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundledItems.push_back(memberList[i].GetString());
+                        BundledItems.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator BundledResultTables_member = obj.FindMember("BundledResultTables");
                 if (BundledResultTables_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundledResultTables_member->value;
+                    BundledResultTables.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundledResultTables.push_back(memberList[i].GetString());
+                        BundledResultTables.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator BundledVirtualCurrencies_member = obj.FindMember("BundledVirtualCurrencies");
@@ -1713,6 +2776,60 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BundledItems"):
+                            if (strcmp(member, "BundledItems") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundledItems.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundledItems.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("BundledResultTables"):
+                            if (strcmp(member, "BundledResultTables") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundledResultTables.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundledResultTables.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("BundledVirtualCurrencies"):
+                            if (strcmp(member, "BundledVirtualCurrencies") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    BundledVirtualCurrencies[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItem : public PlayFabBaseModel
@@ -1722,9 +2839,9 @@ namespace PlayFabComboSdk
             AZStd::string CatalogVersion;
             AZStd::string DisplayName;
             AZStd::string Description;
-            std::map<AZStd::string, Uint32> VirtualCurrencyPrices;
-            std::map<AZStd::string, Uint32> RealCurrencyPrices;
-            std::list<AZStd::string> Tags;
+            PlayFabStringMap<Uint32> VirtualCurrencyPrices;
+            PlayFabStringMap<Uint32> RealCurrencyPrices;
+            std::vector<AZStd::string> Tags;
             AZStd::string CustomData;
             CatalogItemConsumableInfo* Consumable;
             CatalogItemContainerInfo* Container;
@@ -1780,6 +2897,71 @@ namespace PlayFabComboSdk
                 InitialLimitedEditionCount(src.InitialLimitedEditionCount)
             {}
 
+            CatalogItem(CatalogItem&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                Description(AZStd::move(src.Description)),
+                VirtualCurrencyPrices(AZStd::move(src.VirtualCurrencyPrices)),
+                RealCurrencyPrices(AZStd::move(src.RealCurrencyPrices)),
+                Tags(AZStd::move(src.Tags)),
+                CustomData(AZStd::move(src.CustomData)),
+                Consumable(src.Consumable),
+                Container(src.Container),
+                Bundle(src.Bundle),
+                CanBecomeCharacter(AZStd::move(src.CanBecomeCharacter)),
+                IsStackable(AZStd::move(src.IsStackable)),
+                IsTradable(AZStd::move(src.IsTradable)),
+                ItemImageUrl(AZStd::move(src.ItemImageUrl)),
+                IsLimitedEdition(AZStd::move(src.IsLimitedEdition)),
+                InitialLimitedEditionCount(AZStd::move(src.InitialLimitedEditionCount))
+            {
+                src.Consumable = nullptr;
+                src.Container = nullptr;
+                src.Bundle = nullptr;
+            }
+
+            CatalogItem& operator=(const CatalogItem& src)
+            {
+                if (this != &src)
+                    *this = CatalogItem(src);
+                return *this;
+            }
+
+            CatalogItem& operator=(CatalogItem&& src)
+            {
+                if (this != &src)
+                {
+                    ItemId = AZStd::move(src.ItemId);
+                    ItemClass = AZStd::move(src.ItemClass);
+                    CatalogVersion = AZStd::move(src.CatalogVersion);
+                    DisplayName = AZStd::move(src.DisplayName);
+                    Description = AZStd::move(src.Description);
+                    VirtualCurrencyPrices = AZStd::move(src.VirtualCurrencyPrices);
+                    RealCurrencyPrices = AZStd::move(src.RealCurrencyPrices);
+                    Tags = AZStd::move(src.Tags);
+                    CustomData = AZStd::move(src.CustomData);
+                    if (Consumable != nullptr) delete Consumable;
+                    Consumable = src.Consumable;
+                    src.Consumable = nullptr;
+                    if (Container != nullptr) delete Container;
+                    Container = src.Container;
+                    src.Container = nullptr;
+                    if (Bundle != nullptr) delete Bundle;
+                    Bundle = src.Bundle;
+                    src.Bundle = nullptr;
+                    CanBecomeCharacter = AZStd::move(src.CanBecomeCharacter);
+                    IsStackable = AZStd::move(src.IsStackable);
+                    IsTradable = AZStd::move(src.IsTradable);
+                    ItemImageUrl = AZStd::move(src.ItemImageUrl);
+                    IsLimitedEdition = AZStd::move(src.IsLimitedEdition);
+                    InitialLimitedEditionCount = AZStd::move(src.InitialLimitedEditionCount);
+                }
+                return *this;
+            }
+
             CatalogItem(const rapidjson::Value& obj) : CatalogItem()
             {
                 readFromValue(obj);
@@ -1816,7 +2998,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyPrices.empty()) {
                     writer.String("VirtualCurrencyPrices");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = VirtualCurrencyPrices.begin(); iter != VirtualCurrencyPrices.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = VirtualCurrencyPrices.begin(); iter != VirtualCurrencyPrices.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -1825,7 +3007,7 @@ namespace PlayFabComboSdk
                 if (!RealCurrencyPrices.empty()) {
                     writer.String("RealCurrencyPrices");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = RealCurrencyPrices.begin(); iter != RealCurrencyPrices.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = RealCurrencyPrices.begin(); iter != RealCurrencyPrices.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -1834,7 +3016,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -1899,8 +3081,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -1926,6 +3109,138 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyPrices"):
+                            if (strcmp(member, "VirtualCurrencyPrices") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyPrices[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("RealCurrencyPrices"):
+                            if (strcmp(member, "RealCurrencyPrices") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    RealCurrencyPrices[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            CustomData = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Consumable"):
+                            if (strcmp(member, "Consumable") != 0)
+                                break;
+                            Consumable = new CatalogItemConsumableInfo;
+                            Consumable->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Container"):
+                            if (strcmp(member, "Container") != 0)
+                                break;
+                            Container = new CatalogItemContainerInfo;
+                            Container->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Bundle"):
+                            if (strcmp(member, "Bundle") != 0)
+                                break;
+                            Bundle = new CatalogItemBundleInfo;
+                            Bundle->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("CanBecomeCharacter"):
+                            if (strcmp(member, "CanBecomeCharacter") != 0)
+                                break;
+                            CanBecomeCharacter = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsStackable"):
+                            if (strcmp(member, "IsStackable") != 0)
+                                break;
+                            IsStackable = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsTradable"):
+                            if (strcmp(member, "IsTradable") != 0)
+                                break;
+                            IsTradable = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemImageUrl"):
+                            if (strcmp(member, "ItemImageUrl") != 0)
+                                break;
+                            ItemImageUrl = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsLimitedEdition"):
+                            if (strcmp(member, "IsLimitedEdition") != 0)
+                                break;
+                            IsLimitedEdition = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("InitialLimitedEditionCount"):
+                            if (strcmp(member, "InitialLimitedEditionCount") != 0)
+                                break;
+                            InitialLimitedEditionCount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CloudScriptFile : public PlayFabBaseModel
@@ -1945,6 +3260,15 @@ namespace PlayFabComboSdk
                 FileContents(src.FileContents)
             {}
 
+            CloudScriptFile(CloudScriptFile&& src) noexcept :
+                PlayFabBaseModel(),
+                Filename(AZStd::move(src.Filename)),
+                FileContents(AZStd::move(src.FileContents))
+            {}
+
+            CloudScriptFile& operator=(const CloudScriptFile& src) = default;
+            CloudScriptFile& operator=(CloudScriptFile&& src) = default;
+
             CloudScriptFile(const rapidjson::Value& obj) : CloudScriptFile()
             {
                 readFromValue(obj);
@@ -1973,6 +3297,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Filename"):
+                            if (strcmp(member, "Filename") != 0)
+                                break;
+                            Filename = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FileContents"):
+                            if (strcmp(member, "FileContents") != 0)
+                                break;
+                            FileContents = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CloudScriptTaskParameter : public PlayFabBaseModel
@@ -1992,6 +3344,15 @@ namespace PlayFabComboSdk
                 Argument(src.Argument)
             {}
 
+            CloudScriptTaskParameter(CloudScriptTaskParameter&& src) noexcept :
+                PlayFabBaseModel(),
+                FunctionName(AZStd::move(src.FunctionName)),
+                Argument(AZStd::move(src.Argument))
+            {}
+
+            CloudScriptTaskParameter& operator=(const CloudScriptTaskParameter& src) = default;
+            CloudScriptTaskParameter& operator=(CloudScriptTaskParameter&& src) = default;
+
             CloudScriptTaskParameter(const rapidjson::Value& obj) : CloudScriptTaskParameter()
             {
                 readFromValue(obj);
@@ -2024,6 +3385,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FunctionName"):
+                            if (strcmp(member, "FunctionName") != 0)
+                                break;
+                            FunctionName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Argument"):
+                            if (strcmp(member, "Argument") != 0)
+                                break;
+                            Argument.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct LogStatement : public PlayFabBaseModel
@@ -2046,6 +3435,16 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            LogStatement(LogStatement&& src) noexcept :
+                PlayFabBaseModel(),
+                Level(AZStd::move(src.Level)),
+                Message(AZStd::move(src.Message)),
+                Data(AZStd::move(src.Data))
+            {}
+
+            LogStatement& operator=(const LogStatement& src) = default;
+            LogStatement& operator=(LogStatement&& src) = default;
+
             LogStatement(const rapidjson::Value& obj) : LogStatement()
             {
                 readFromValue(obj);
@@ -2084,6 +3483,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Level"):
+                            if (strcmp(member, "Level") != 0)
+                                break;
+                            Level = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Message"):
+                            if (strcmp(member, "Message") != 0)
+                                break;
+                            Message = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            Data.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ScriptExecutionError : public PlayFabBaseModel
@@ -2106,8 +3538,18 @@ namespace PlayFabComboSdk
                 StackTrace(src.StackTrace)
             {}
 
-            ScriptExecutionError(const rapidjson::Value& obj) : ScriptExecutionError()
-            {
+            ScriptExecutionError(ScriptExecutionError&& src) noexcept :
+                PlayFabBaseModel(),
+                Error(AZStd::move(src.Error)),
+                Message(AZStd::move(src.Message)),
+                StackTrace(AZStd::move(src.StackTrace))
+            {}
+
+            ScriptExecutionError& operator=(const ScriptExecutionError& src) = default;
+            ScriptExecutionError& operator=(ScriptExecutionError&& src) = default;
+
+            ScriptExecutionError(const rapidjson::Value& obj) : ScriptExecutionError()
+            {
                 readFromValue(obj);
             }
 
@@ -2144,6 +3586,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Error"):
+                            if (strcmp(member, "Error") != 0)
+                                break;
+                            Error = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Message"):
+                            if (strcmp(member, "Message") != 0)
+                                break;
+                            Message = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StackTrace"):
+                            if (strcmp(member, "StackTrace") != 0)
+                                break;
+                            StackTrace = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ExecuteCloudScriptResult : public PlayFabBaseModel
@@ -2152,7 +3627,7 @@ namespace PlayFabComboSdk
             Int32 Revision;
             MultitypeVar FunctionResult;
             OptionalBool FunctionResultTooLarge;
-            std::list<LogStatement> Logs;
+            std::vector<LogStatement> Logs;
             OptionalBool LogsTooLarge;
             double ExecutionTimeSeconds;
             double ProcessorTimeSeconds;
@@ -2193,6 +3668,53 @@ namespace PlayFabComboSdk
                 Error(src.Error ? new ScriptExecutionError(*src.Error) : nullptr)
             {}
 
+            ExecuteCloudScriptResult(ExecuteCloudScriptResult&& src) noexcept :
+                PlayFabBaseModel(),
+                FunctionName(AZStd::move(src.FunctionName)),
+                Revision(AZStd::move(src.Revision)),
+                FunctionResult(AZStd::move(src.FunctionResult)),
+                FunctionResultTooLarge(AZStd::move(src.FunctionResultTooLarge)),
+                Logs(AZStd::move(src.Logs)),
+                LogsTooLarge(AZStd::move(src.LogsTooLarge)),
+                ExecutionTimeSeconds(AZStd::move(src.ExecutionTimeSeconds)),
+                ProcessorTimeSeconds(AZStd::move(src.ProcessorTimeSeconds)),
+                MemoryConsumedBytes(AZStd::move(src.MemoryConsumedBytes)),
+                APIRequestsIssued(AZStd::move(src.APIRequestsIssued)),
+                HttpRequestsIssued(AZStd::move(src.HttpRequestsIssued)),
+                Error(src.Error)
+            {
+                src.Error = nullptr;
+            }
+
+            ExecuteCloudScriptResult& operator=(const ExecuteCloudScriptResult& src)
+            {
+                if (this != &src)
+                    *this = ExecuteCloudScriptResult(src);
+                return *this;
+            }
+
+            ExecuteCloudScriptResult& operator=(ExecuteCloudScriptResult&& src)
+            {
+                if (this != &src)
+                {
+                    FunctionName = AZStd::move(src.FunctionName);
+                    Revision = AZStd::move(src.Revision);
+                    FunctionResult = AZStd::move(src.FunctionResult);
+                    FunctionResultTooLarge = AZStd::move(src.FunctionResultTooLarge);
+                    Logs = AZStd::move(src.Logs);
+                    LogsTooLarge = AZStd::move(src.LogsTooLarge);
+                    ExecutionTimeSeconds = AZStd::move(src.ExecutionTimeSeconds);
+                    ProcessorTimeSeconds = AZStd::move(src.ProcessorTimeSeconds);
+                    MemoryConsumedBytes = AZStd::move(src.MemoryConsumedBytes);
+                    APIRequestsIssued = AZStd::move(src.APIRequestsIssued);
+                    HttpRequestsIssued = AZStd::move(src.HttpRequestsIssued);
+                    if (Error != nullptr) delete Error;
+                    Error = src.Error;
+                    src.Error = nullptr;
+                }
+                return *this;
+            }
+
             ExecuteCloudScriptResult(const rapidjson::Value& obj) : ExecuteCloudScriptResult()
             {
                 readFromValue(obj);
@@ -2223,7 +3745,7 @@ namespace PlayFabComboSdk
                 if (!Logs.empty()) {
                     writer.String("Logs");
                     writer.StartArray();
-                    for (std::list<LogStatement>::iterator iter = Logs.begin(); iter != Logs.end(); iter++) {
+                    for (std::vector<LogStatement>::iterator iter = Logs.begin(); iter != Logs.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -2262,8 +3784,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Logs_member = obj.FindMember("Logs");
                 if (Logs_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Logs_member->value;
+                    Logs.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Logs.push_back(LogStatement(memberList[i]));
+                        Logs.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator LogsTooLarge_member = obj.FindMember("LogsTooLarge");
@@ -2283,6 +3806,93 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FunctionName"):
+                            if (strcmp(member, "FunctionName") != 0)
+                                break;
+                            FunctionName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Revision"):
+                            if (strcmp(member, "Revision") != 0)
+                                break;
+                            Revision = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("FunctionResult"):
+                            if (strcmp(member, "FunctionResult") != 0)
+                                break;
+                            FunctionResult.readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("FunctionResultTooLarge"):
+                            if (strcmp(member, "FunctionResultTooLarge") != 0)
+                                break;
+                            FunctionResultTooLarge = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Logs"):
+                            if (strcmp(member, "Logs") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Logs.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Logs.emplace_back();
+                                    Logs.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("LogsTooLarge"):
+                            if (strcmp(member, "LogsTooLarge") != 0)
+                                break;
+                            LogsTooLarge = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExecutionTimeSeconds"):
+                            if (strcmp(member, "ExecutionTimeSeconds") != 0)
+                                break;
+                            ExecutionTimeSeconds = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProcessorTimeSeconds"):
+                            if (strcmp(member, "ProcessorTimeSeconds") != 0)
+                                break;
+                            ProcessorTimeSeconds = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("MemoryConsumedBytes"):
+                            if (strcmp(member, "MemoryConsumedBytes") != 0)
+                                break;
+                            MemoryConsumedBytes = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("APIRequestsIssued"):
+                            if (strcmp(member, "APIRequestsIssued") != 0)
+                                break;
+                            APIRequestsIssued = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("HttpRequestsIssued"):
+                            if (strcmp(member, "HttpRequestsIssued") != 0)
+                                break;
+                            HttpRequestsIssued = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Error"):
+                            if (strcmp(member, "Error") != 0)
+                                break;
+                            Error = new ScriptExecutionError;
+                            Error->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CloudScriptTaskSummary : public PlayFabBaseModel
@@ -2323,6 +3933,50 @@ namespace PlayFabComboSdk
                 Result(src.Result ? new ExecuteCloudScriptResult(*src.Result) : nullptr)
             {}
 
+            CloudScriptTaskSummary(CloudScriptTaskSummary&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId)),
+                TaskIdentifier(src.TaskIdentifier),
+                StartedAt(AZStd::move(src.StartedAt)),
+                CompletedAt(AZStd::move(src.CompletedAt)),
+                Status(AZStd::move(src.Status)),
+                PercentComplete(AZStd::move(src.PercentComplete)),
+                EstimatedSecondsRemaining(AZStd::move(src.EstimatedSecondsRemaining)),
+                ScheduledByUserId(AZStd::move(src.ScheduledByUserId)),
+                Result(src.Result)
+            {
+                src.TaskIdentifier = nullptr;
+                src.Result = nullptr;
+            }
+
+            CloudScriptTaskSummary& operator=(const CloudScriptTaskSummary& src)
+            {
+                if (this != &src)
+                    *this = CloudScriptTaskSummary(src);
+                return *this;
+            }
+
+            CloudScriptTaskSummary& operator=(CloudScriptTaskSummary&& src)
+            {
+                if (this != &src)
+                {
+                    TaskInstanceId = AZStd::move(src.TaskInstanceId);
+                    if (TaskIdentifier != nullptr) delete TaskIdentifier;
+                    TaskIdentifier = src.TaskIdentifier;
+                    src.TaskIdentifier = nullptr;
+                    StartedAt = AZStd::move(src.StartedAt);
+                    CompletedAt = AZStd::move(src.CompletedAt);
+                    Status = AZStd::move(src.Status);
+                    PercentComplete = AZStd::move(src.PercentComplete);
+                    EstimatedSecondsRemaining = AZStd::move(src.EstimatedSecondsRemaining);
+                    ScheduledByUserId = AZStd::move(src.ScheduledByUserId);
+                    if (Result != nullptr) delete Result;
+                    Result = src.Result;
+                    src.Result = nullptr;
+                }
+                return *this;
+            }
+
             CloudScriptTaskSummary(const rapidjson::Value& obj) : CloudScriptTaskSummary()
             {
                 readFromValue(obj);
@@ -2397,6 +4051,71 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TaskIdentifier"):
+                            if (strcmp(member, "TaskIdentifier") != 0)
+                                break;
+                            TaskIdentifier = new NameIdentifier;
+                            TaskIdentifier->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("StartedAt"):
+                            if (strcmp(member, "StartedAt") != 0)
+                                break;
+                            StartedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CompletedAt"):
+                            if (strcmp(member, "CompletedAt") != 0)
+                                break;
+                            CompletedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readTaskInstanceStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PercentComplete"):
+                            if (strcmp(member, "PercentComplete") != 0)
+                                break;
+                            PercentComplete = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("EstimatedSecondsRemaining"):
+                            if (strcmp(member, "EstimatedSecondsRemaining") != 0)
+                                break;
+                            EstimatedSecondsRemaining = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledByUserId"):
+                            if (strcmp(member, "ScheduledByUserId") != 0)
+                                break;
+                            ScheduledByUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Result"):
+                            if (strcmp(member, "Result") != 0)
+                                break;
+                            Result = new ExecuteCloudScriptResult;
+                            Result->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CloudScriptVersionStatus : public PlayFabBaseModel
@@ -2419,6 +4138,16 @@ namespace PlayFabComboSdk
                 LatestRevision(src.LatestRevision)
             {}
 
+            CloudScriptVersionStatus(CloudScriptVersionStatus&& src) noexcept :
+                PlayFabBaseModel(),
+                Version(AZStd::move(src.Version)),
+                PublishedRevision(AZStd::move(src.PublishedRevision)),
+                LatestRevision(AZStd::move(src.LatestRevision))
+            {}
+
+            CloudScriptVersionStatus& operator=(const CloudScriptVersionStatus& src) = default;
+            CloudScriptVersionStatus& operator=(CloudScriptVersionStatus&& src) = default;
+
             CloudScriptVersionStatus(const rapidjson::Value& obj) : CloudScriptVersionStatus()
             {
                 readFromValue(obj);
@@ -2451,6 +4180,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("PublishedRevision"):
+                            if (strcmp(member, "PublishedRevision") != 0)
+                                break;
+                            PublishedRevision = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("LatestRevision"):
+                            if (strcmp(member, "LatestRevision") != 0)
+                                break;
+                            LatestRevision = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum EmailVerificationStatus
@@ -2477,20 +4239,15 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<EmailVerificationStatus>(obj.GetInt());
 
-            static std::map<const char *, EmailVerificationStatus, PlayFabComboSdk::StringCompare> _EmailVerificationStatusMap;
-            if (_EmailVerificationStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _EmailVerificationStatusMap["Unverified"] = EmailVerificationStatusUnverified;
-                _EmailVerificationStatusMap["Pending"] = EmailVerificationStatusPending;
-                _EmailVerificationStatusMap["Confirmed"] = EmailVerificationStatusConfirmed;
-
+            case PlayFabJsonReader::Hash("Unverified"): if (strcmp(name, "Unverified") == 0) return EmailVerificationStatusUnverified; break;
+            case PlayFabJsonReader::Hash("Pending"): if (strcmp(name, "Pending") == 0) return EmailVerificationStatusPending; break;
+            case PlayFabJsonReader::Hash("Confirmed"): if (strcmp(name, "Confirmed") == 0) return EmailVerificationStatusConfirmed; break;
             }
 
-            auto output = _EmailVerificationStatusMap.find(obj.GetString());
-            if (output != _EmailVerificationStatusMap.end())
-                return output->second;
-
             return EmailVerificationStatusUnverified; // Basically critical fail
         }
 
@@ -2514,6 +4271,16 @@ namespace PlayFabComboSdk
                 VerificationStatus(src.VerificationStatus)
             {}
 
+            ContactEmailInfo(ContactEmailInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                EmailAddress(AZStd::move(src.EmailAddress)),
+                VerificationStatus(AZStd::move(src.VerificationStatus))
+            {}
+
+            ContactEmailInfo& operator=(const ContactEmailInfo& src) = default;
+            ContactEmailInfo& operator=(ContactEmailInfo&& src) = default;
+
             ContactEmailInfo(const rapidjson::Value& obj) : ContactEmailInfo()
             {
                 readFromValue(obj);
@@ -2552,6 +4319,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("EmailAddress"):
+                            if (strcmp(member, "EmailAddress") != 0)
+                                break;
+                            EmailAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VerificationStatus"):
+                            if (strcmp(member, "VerificationStatus") != 0)
+                                break;
+                            VerificationStatus = readEmailVerificationStatusFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ContentInfo : public PlayFabBaseModel
@@ -2574,6 +4374,16 @@ namespace PlayFabComboSdk
                 LastModified(src.LastModified)
             {}
 
+            ContentInfo(ContentInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                Size(AZStd::move(src.Size)),
+                LastModified(AZStd::move(src.LastModified))
+            {}
+
+            ContentInfo& operator=(const ContentInfo& src) = default;
+            ContentInfo& operator=(ContentInfo&& src) = default;
+
             ContentInfo(const rapidjson::Value& obj) : ContentInfo()
             {
                 readFromValue(obj);
@@ -2608,6 +4418,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Size"):
+                            if (strcmp(member, "Size") != 0)
+                                break;
+                            Size = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("LastModified"):
+                            if (strcmp(member, "LastModified") != 0)
+                                break;
+                            LastModified = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum ContinentCode
@@ -2642,24 +4485,19 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<ContinentCode>(obj.GetInt());
 
-            static std::map<const char *, ContinentCode, PlayFabComboSdk::StringCompare> _ContinentCodeMap;
-            if (_ContinentCodeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ContinentCodeMap["AF"] = ContinentCodeAF;
-                _ContinentCodeMap["AN"] = ContinentCodeAN;
-                _ContinentCodeMap["AS"] = ContinentCodeAS;
-                _ContinentCodeMap["EU"] = ContinentCodeEU;
-                _ContinentCodeMap["NA"] = ContinentCodeNA;
-                _ContinentCodeMap["OC"] = ContinentCodeOC;
-                _ContinentCodeMap["SA"] = ContinentCodeSA;
-
+            case PlayFabJsonReader::Hash("AF"): if (strcmp(name, "AF") == 0) return ContinentCodeAF; break;
+            case PlayFabJsonReader::Hash("AN"): if (strcmp(name, "AN") == 0) return ContinentCodeAN; break;
+            case PlayFabJsonReader::Hash("AS"): if (strcmp(name, "AS") == 0) return ContinentCodeAS; break;
+            case PlayFabJsonReader::Hash("EU"): if (strcmp(name, "EU") == 0) return ContinentCodeEU; break;
+            case PlayFabJsonReader::Hash("NA"): if (strcmp(name, "NA") == 0) return ContinentCodeNA; break;
+            case PlayFabJsonReader::Hash("OC"): if (strcmp(name, "OC") == 0) return ContinentCodeOC; break;
+            case PlayFabJsonReader::Hash("SA"): if (strcmp(name, "SA") == 0) return ContinentCodeSA; break;
             }
 
-            auto output = _ContinentCodeMap.find(obj.GetString());
-            if (output != _ContinentCodeMap.end())
-                return output->second;
-
             return ContinentCodeAF; // Basically critical fail
         }
 
@@ -3179,265 +5017,260 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<CountryCode>(obj.GetInt());
 
-            static std::map<const char *, CountryCode, PlayFabComboSdk::StringCompare> _CountryCodeMap;
-            if (_CountryCodeMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _CountryCodeMap["AF"] = CountryCodeAF;
-                _CountryCodeMap["AX"] = CountryCodeAX;
-                _CountryCodeMap["AL"] = CountryCodeAL;
-                _CountryCodeMap["DZ"] = CountryCodeDZ;
-                _CountryCodeMap["AS"] = CountryCodeAS;
-                _CountryCodeMap["AD"] = CountryCodeAD;
-                _CountryCodeMap["AO"] = CountryCodeAO;
-                _CountryCodeMap["AI"] = CountryCodeAI;
-                _CountryCodeMap["AQ"] = CountryCodeAQ;
-                _CountryCodeMap["AG"] = CountryCodeAG;
-                _CountryCodeMap["AR"] = CountryCodeAR;
-                _CountryCodeMap["AM"] = CountryCodeAM;
-                _CountryCodeMap["AW"] = CountryCodeAW;
-                _CountryCodeMap["AU"] = CountryCodeAU;
-                _CountryCodeMap["AT"] = CountryCodeAT;
-                _CountryCodeMap["AZ"] = CountryCodeAZ;
-                _CountryCodeMap["BS"] = CountryCodeBS;
-                _CountryCodeMap["BH"] = CountryCodeBH;
-                _CountryCodeMap["BD"] = CountryCodeBD;
-                _CountryCodeMap["BB"] = CountryCodeBB;
-                _CountryCodeMap["BY"] = CountryCodeBY;
-                _CountryCodeMap["BE"] = CountryCodeBE;
-                _CountryCodeMap["BZ"] = CountryCodeBZ;
-                _CountryCodeMap["BJ"] = CountryCodeBJ;
-                _CountryCodeMap["BM"] = CountryCodeBM;
-                _CountryCodeMap["BT"] = CountryCodeBT;
-                _CountryCodeMap["BO"] = CountryCodeBO;
-                _CountryCodeMap["BQ"] = CountryCodeBQ;
-                _CountryCodeMap["BA"] = CountryCodeBA;
-                _CountryCodeMap["BW"] = CountryCodeBW;
-                _CountryCodeMap["BV"] = CountryCodeBV;
-                _CountryCodeMap["BR"] = CountryCodeBR;
-                _CountryCodeMap["IO"] = CountryCodeIO;
-                _CountryCodeMap["BN"] = CountryCodeBN;
-                _CountryCodeMap["BG"] = CountryCodeBG;
-                _CountryCodeMap["BF"] = CountryCodeBF;
-                _CountryCodeMap["BI"] = CountryCodeBI;
-                _CountryCodeMap["KH"] = CountryCodeKH;
-                _CountryCodeMap["CM"] = CountryCodeCM;
-                _CountryCodeMap["CA"] = CountryCodeCA;
-                _CountryCodeMap["CV"] = CountryCodeCV;
-                _CountryCodeMap["KY"] = CountryCodeKY;
-                _CountryCodeMap["CF"] = CountryCodeCF;
-                _CountryCodeMap["TD"] = CountryCodeTD;
-                _CountryCodeMap["CL"] = CountryCodeCL;
-                _CountryCodeMap["CN"] = CountryCodeCN;
-                _CountryCodeMap["CX"] = CountryCodeCX;
-                _CountryCodeMap["CC"] = CountryCodeCC;
-                _CountryCodeMap["CO"] = CountryCodeCO;
-                _CountryCodeMap["KM"] = CountryCodeKM;
-                _CountryCodeMap["CG"] = CountryCodeCG;
-                _CountryCodeMap["CD"] = CountryCodeCD;
-                _CountryCodeMap["CK"] = CountryCodeCK;
-                _CountryCodeMap["CR"] = CountryCodeCR;
-                _CountryCodeMap["CI"] = CountryCodeCI;
-                _CountryCodeMap["HR"] = CountryCodeHR;
-                _CountryCodeMap["CU"] = CountryCodeCU;
-                _CountryCodeMap["CW"] = CountryCodeCW;
-                _CountryCodeMap["CY"] = CountryCodeCY;
-                _CountryCodeMap["CZ"] = CountryCodeCZ;
-                _CountryCodeMap["DK"] = CountryCodeDK;
-                _CountryCodeMap["DJ"] = CountryCodeDJ;
-                _CountryCodeMap["DM"] = CountryCodeDM;
-                _CountryCodeMap["DO"] = CountryCodeDO;
-                _CountryCodeMap["EC"] = CountryCodeEC;
-                _CountryCodeMap["EG"] = CountryCodeEG;
-                _CountryCodeMap["SV"] = CountryCodeSV;
-                _CountryCodeMap["GQ"] = CountryCodeGQ;
-                _CountryCodeMap["ER"] = CountryCodeER;
-                _CountryCodeMap["EE"] = CountryCodeEE;
-                _CountryCodeMap["ET"] = CountryCodeET;
-                _CountryCodeMap["FK"] = CountryCodeFK;
-                _CountryCodeMap["FO"] = CountryCodeFO;
-                _CountryCodeMap["FJ"] = CountryCodeFJ;
-                _CountryCodeMap["FI"] = CountryCodeFI;
-                _CountryCodeMap["FR"] = CountryCodeFR;
-                _CountryCodeMap["GF"] = CountryCodeGF;
-                _CountryCodeMap["PF"] = CountryCodePF;
-                _CountryCodeMap["TF"] = CountryCodeTF;
-                _CountryCodeMap["GA"] = CountryCodeGA;
-                _CountryCodeMap["GM"] = CountryCodeGM;
-                _CountryCodeMap["GE"] = CountryCodeGE;
-                _CountryCodeMap["DE"] = CountryCodeDE;
-                _CountryCodeMap["GH"] = CountryCodeGH;
-                _CountryCodeMap["GI"] = CountryCodeGI;
-                _CountryCodeMap["GR"] = CountryCodeGR;
-                _CountryCodeMap["GL"] = CountryCodeGL;
-                _CountryCodeMap["GD"] = CountryCodeGD;
-                _CountryCodeMap["GP"] = CountryCodeGP;
-                _CountryCodeMap["GU"] = CountryCodeGU;
-                _CountryCodeMap["GT"] = CountryCodeGT;
-                _CountryCodeMap["GG"] = CountryCodeGG;
-                _CountryCodeMap["GN"] = CountryCodeGN;
-                _CountryCodeMap["GW"] = CountryCodeGW;
-                _CountryCodeMap["GY"] = CountryCodeGY;
-                _CountryCodeMap["HT"] = CountryCodeHT;
-                _CountryCodeMap["HM"] = CountryCodeHM;
-                _CountryCodeMap["VA"] = CountryCodeVA;
-                _CountryCodeMap["HN"] = CountryCodeHN;
-                _CountryCodeMap["HK"] = CountryCodeHK;
-                _CountryCodeMap["HU"] = CountryCodeHU;
-                _CountryCodeMap["IS"] = CountryCodeIS;
-                _CountryCodeMap["IN"] = CountryCodeIN;
-                _CountryCodeMap["ID"] = CountryCodeID;
-                _CountryCodeMap["IR"] = CountryCodeIR;
-                _CountryCodeMap["IQ"] = CountryCodeIQ;
-                _CountryCodeMap["IE"] = CountryCodeIE;
-                _CountryCodeMap["IM"] = CountryCodeIM;
-                _CountryCodeMap["IL"] = CountryCodeIL;
-                _CountryCodeMap["IT"] = CountryCodeIT;
-                _CountryCodeMap["JM"] = CountryCodeJM;
-                _CountryCodeMap["JP"] = CountryCodeJP;
-                _CountryCodeMap["JE"] = CountryCodeJE;
-                _CountryCodeMap["JO"] = CountryCodeJO;
-                _CountryCodeMap["KZ"] = CountryCodeKZ;
-                _CountryCodeMap["KE"] = CountryCodeKE;
-                _CountryCodeMap["KI"] = CountryCodeKI;
-                _CountryCodeMap["KP"] = CountryCodeKP;
-                _CountryCodeMap["KR"] = CountryCodeKR;
-                _CountryCodeMap["KW"] = CountryCodeKW;
-                _CountryCodeMap["KG"] = CountryCodeKG;
-                _CountryCodeMap["LA"] = CountryCodeLA;
-                _CountryCodeMap["LV"] = CountryCodeLV;
-                _CountryCodeMap["LB"] = CountryCodeLB;
-                _CountryCodeMap["LS"] = CountryCodeLS;
-                _CountryCodeMap["LR"] = CountryCodeLR;
-                _CountryCodeMap["LY"] = CountryCodeLY;
-                _CountryCodeMap["LI"] = CountryCodeLI;
-                _CountryCodeMap["LT"] = CountryCodeLT;
-                _CountryCodeMap["LU"] = CountryCodeLU;
-                _CountryCodeMap["MO"] = CountryCodeMO;
-                _CountryCodeMap["MK"] = CountryCodeMK;
-                _CountryCodeMap["MG"] = CountryCodeMG;
-                _CountryCodeMap["MW"] = CountryCodeMW;
-                _CountryCodeMap["MY"] = CountryCodeMY;
-                _CountryCodeMap["MV"] = CountryCodeMV;
-                _CountryCodeMap["ML"] = CountryCodeML;
-                _CountryCodeMap["MT"] = CountryCodeMT;
-                _CountryCodeMap["MH"] = CountryCodeMH;
-                _CountryCodeMap["MQ"] = CountryCodeMQ;
-                _CountryCodeMap["MR"] = CountryCodeMR;
-                _CountryCodeMap["MU"] = CountryCodeMU;
-                _CountryCodeMap["YT"] = CountryCodeYT;
-                _CountryCodeMap["MX"] = CountryCodeMX;
-                _CountryCodeMap["FM"] = CountryCodeFM;
-                _CountryCodeMap["MD"] = CountryCodeMD;
-                _CountryCodeMap["MC"] = CountryCodeMC;
-                _CountryCodeMap["MN"] = CountryCodeMN;
-                _CountryCodeMap["ME"] = CountryCodeME;
-                _CountryCodeMap["MS"] = CountryCodeMS;
-                _CountryCodeMap["MA"] = CountryCodeMA;
-                _CountryCodeMap["MZ"] = CountryCodeMZ;
-                _CountryCodeMap["MM"] = CountryCodeMM;
-                _CountryCodeMap["NA"] = CountryCodeNA;
-                _CountryCodeMap["NR"] = CountryCodeNR;
-                _CountryCodeMap["NP"] = CountryCodeNP;
-                _CountryCodeMap["NL"] = CountryCodeNL;
-                _CountryCodeMap["NC"] = CountryCodeNC;
-                _CountryCodeMap["NZ"] = CountryCodeNZ;
-                _CountryCodeMap["NI"] = CountryCodeNI;
-                _CountryCodeMap["NE"] = CountryCodeNE;
-                _CountryCodeMap["NG"] = CountryCodeNG;
-                _CountryCodeMap["NU"] = CountryCodeNU;
-                _CountryCodeMap["NF"] = CountryCodeNF;
-                _CountryCodeMap["MP"] = CountryCodeMP;
-                _CountryCodeMap["NO"] = CountryCodeNO;
-                _CountryCodeMap["OM"] = CountryCodeOM;
-                _CountryCodeMap["PK"] = CountryCodePK;
-                _CountryCodeMap["PW"] = CountryCodePW;
-                _CountryCodeMap["PS"] = CountryCodePS;
-                _CountryCodeMap["PA"] = CountryCodePA;
-                _CountryCodeMap["PG"] = CountryCodePG;
-                _CountryCodeMap["PY"] = CountryCodePY;
-                _CountryCodeMap["PE"] = CountryCodePE;
-                _CountryCodeMap["PH"] = CountryCodePH;
-                _CountryCodeMap["PN"] = CountryCodePN;
-                _CountryCodeMap["PL"] = CountryCodePL;
-                _CountryCodeMap["PT"] = CountryCodePT;
-                _CountryCodeMap["PR"] = CountryCodePR;
-                _CountryCodeMap["QA"] = CountryCodeQA;
-                _CountryCodeMap["RE"] = CountryCodeRE;
-                _CountryCodeMap["RO"] = CountryCodeRO;
-                _CountryCodeMap["RU"] = CountryCodeRU;
-                _CountryCodeMap["RW"] = CountryCodeRW;
-                _CountryCodeMap["BL"] = CountryCodeBL;
-                _CountryCodeMap["SH"] = CountryCodeSH;
-                _CountryCodeMap["KN"] = CountryCodeKN;
-                _CountryCodeMap["LC"] = CountryCodeLC;
-                _CountryCodeMap["MF"] = CountryCodeMF;
-                _CountryCodeMap["PM"] = CountryCodePM;
-                _CountryCodeMap["VC"] = CountryCodeVC;
-                _CountryCodeMap["WS"] = CountryCodeWS;
-                _CountryCodeMap["SM"] = CountryCodeSM;
-                _CountryCodeMap["ST"] = CountryCodeST;
-                _CountryCodeMap["SA"] = CountryCodeSA;
-                _CountryCodeMap["SN"] = CountryCodeSN;
-                _CountryCodeMap["RS"] = CountryCodeRS;
-                _CountryCodeMap["SC"] = CountryCodeSC;
-                _CountryCodeMap["SL"] = CountryCodeSL;
-                _CountryCodeMap["SG"] = CountryCodeSG;
-                _CountryCodeMap["SX"] = CountryCodeSX;
-                _CountryCodeMap["SK"] = CountryCodeSK;
-                _CountryCodeMap["SI"] = CountryCodeSI;
-                _CountryCodeMap["SB"] = CountryCodeSB;
-                _CountryCodeMap["SO"] = CountryCodeSO;
-                _CountryCodeMap["ZA"] = CountryCodeZA;
-                _CountryCodeMap["GS"] = CountryCodeGS;
-                _CountryCodeMap["SS"] = CountryCodeSS;
-                _CountryCodeMap["ES"] = CountryCodeES;
-                _CountryCodeMap["LK"] = CountryCodeLK;
-                _CountryCodeMap["SD"] = CountryCodeSD;
-                _CountryCodeMap["SR"] = CountryCodeSR;
-                _CountryCodeMap["SJ"] = CountryCodeSJ;
-                _CountryCodeMap["SZ"] = CountryCodeSZ;
-                _CountryCodeMap["SE"] = CountryCodeSE;
-                _CountryCodeMap["CH"] = CountryCodeCH;
-                _CountryCodeMap["SY"] = CountryCodeSY;
-                _CountryCodeMap["TW"] = CountryCodeTW;
-                _CountryCodeMap["TJ"] = CountryCodeTJ;
-                _CountryCodeMap["TZ"] = CountryCodeTZ;
-                _CountryCodeMap["TH"] = CountryCodeTH;
-                _CountryCodeMap["TL"] = CountryCodeTL;
-                _CountryCodeMap["TG"] = CountryCodeTG;
-                _CountryCodeMap["TK"] = CountryCodeTK;
-                _CountryCodeMap["TO"] = CountryCodeTO;
-                _CountryCodeMap["TT"] = CountryCodeTT;
-                _CountryCodeMap["TN"] = CountryCodeTN;
-                _CountryCodeMap["TR"] = CountryCodeTR;
-                _CountryCodeMap["TM"] = CountryCodeTM;
-                _CountryCodeMap["TC"] = CountryCodeTC;
-                _CountryCodeMap["TV"] = CountryCodeTV;
-                _CountryCodeMap["UG"] = CountryCodeUG;
-                _CountryCodeMap["UA"] = CountryCodeUA;
-                _CountryCodeMap["AE"] = CountryCodeAE;
-                _CountryCodeMap["GB"] = CountryCodeGB;
-                _CountryCodeMap["US"] = CountryCodeUS;
-                _CountryCodeMap["UM"] = CountryCodeUM;
-                _CountryCodeMap["UY"] = CountryCodeUY;
-                _CountryCodeMap["UZ"] = CountryCodeUZ;
-                _CountryCodeMap["VU"] = CountryCodeVU;
-                _CountryCodeMap["VE"] = CountryCodeVE;
-                _CountryCodeMap["VN"] = CountryCodeVN;
-                _CountryCodeMap["VG"] = CountryCodeVG;
-                _CountryCodeMap["VI"] = CountryCodeVI;
-                _CountryCodeMap["WF"] = CountryCodeWF;
-                _CountryCodeMap["EH"] = CountryCodeEH;
-                _CountryCodeMap["YE"] = CountryCodeYE;
-                _CountryCodeMap["ZM"] = CountryCodeZM;
-                _CountryCodeMap["ZW"] = CountryCodeZW;
-
-            }
-
-            auto output = _CountryCodeMap.find(obj.GetString());
-            if (output != _CountryCodeMap.end())
-                return output->second;
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("AF"): if (strcmp(name, "AF") == 0) return CountryCodeAF; break;
+            case PlayFabJsonReader::Hash("AX"): if (strcmp(name, "AX") == 0) return CountryCodeAX; break;
+            case PlayFabJsonReader::Hash("AL"): if (strcmp(name, "AL") == 0) return CountryCodeAL; break;
+            case PlayFabJsonReader::Hash("DZ"): if (strcmp(name, "DZ") == 0) return CountryCodeDZ; break;
+            case PlayFabJsonReader::Hash("AS"): if (strcmp(name, "AS") == 0) return CountryCodeAS; break;
+            case PlayFabJsonReader::Hash("AD"): if (strcmp(name, "AD") == 0) return CountryCodeAD; break;
+            case PlayFabJsonReader::Hash("AO"): if (strcmp(name, "AO") == 0) return CountryCodeAO; break;
+            case PlayFabJsonReader::Hash("AI"): if (strcmp(name, "AI") == 0) return CountryCodeAI; break;
+            case PlayFabJsonReader::Hash("AQ"): if (strcmp(name, "AQ") == 0) return CountryCodeAQ; break;
+            case PlayFabJsonReader::Hash("AG"): if (strcmp(name, "AG") == 0) return CountryCodeAG; break;
+            case PlayFabJsonReader::Hash("AR"): if (strcmp(name, "AR") == 0) return CountryCodeAR; break;
+            case PlayFabJsonReader::Hash("AM"): if (strcmp(name, "AM") == 0) return CountryCodeAM; break;
+            case PlayFabJsonReader::Hash("AW"): if (strcmp(name, "AW") == 0) return CountryCodeAW; break;
+            case PlayFabJsonReader::Hash("AU"): if (strcmp(name, "AU") == 0) return CountryCodeAU; break;
+            case PlayFabJsonReader::Hash("AT"): if (strcmp(name, "AT") == 0) return CountryCodeAT; break;
+            case PlayFabJsonReader::Hash("AZ"): if (strcmp(name, "AZ") == 0) return CountryCodeAZ; break;
+            case PlayFabJsonReader::Hash("BS"): if (strcmp(name, "BS") == 0) return CountryCodeBS; break;
+            case PlayFabJsonReader::Hash("BH"): if (strcmp(name, "BH") == 0) return CountryCodeBH; break;
+            case PlayFabJsonReader::Hash("BD"): if (strcmp(name, "BD") == 0) return CountryCodeBD; break;
+            case PlayFabJsonReader::Hash("BB"): if (strcmp(name, "BB") == 0) return CountryCodeBB; break;
+            case PlayFabJsonReader::Hash("BY"): if (strcmp(name, "BY") == 0) return CountryCodeBY; break;
+            case PlayFabJsonReader::Hash("BE"): if (strcmp(name, "BE") == 0) return CountryCodeBE; break;
+            case PlayFabJsonReader::Hash("BZ"): if (strcmp(name, "BZ") == 0) return CountryCodeBZ; break;
+            case PlayFabJsonReader::Hash("BJ"): if (strcmp(name, "BJ") == 0) return CountryCodeBJ; break;
+            case PlayFabJsonReader::Hash("BM"): if (strcmp(name, "BM") == 0) return CountryCodeBM; break;
+            case PlayFabJsonReader::Hash("BT"): if (strcmp(name, "BT") == 0) return CountryCodeBT; break;
+            case PlayFabJsonReader::Hash("BO"): if (strcmp(name, "BO") == 0) return CountryCodeBO; break;
+            case PlayFabJsonReader::Hash("BQ"): if (strcmp(name, "BQ") == 0) return CountryCodeBQ; break;
+            case PlayFabJsonReader::Hash("BA"): if (strcmp(name, "BA") == 0) return CountryCodeBA; break;
+            case PlayFabJsonReader::Hash("BW"): if (strcmp(name, "BW") == 0) return CountryCodeBW; break;
+            case PlayFabJsonReader::Hash("BV"): if (strcmp(name, "BV") == 0) return CountryCodeBV; break;
+            case PlayFabJsonReader::Hash("BR"): if (strcmp(name, "BR") == 0) return CountryCodeBR; break;
+            case PlayFabJsonReader::Hash("IO"): if (strcmp(name, "IO") == 0) return CountryCodeIO; break;
+            case PlayFabJsonReader::Hash("BN"): if (strcmp(name, "BN") == 0) return CountryCodeBN; break;
+            case PlayFabJsonReader::Hash("BG"): if (strcmp(name, "BG") == 0) return CountryCodeBG; break;
+            case PlayFabJsonReader::Hash("BF"): if (strcmp(name, "BF") == 0) return CountryCodeBF; break;
+            case PlayFabJsonReader::Hash("BI"): if (strcmp(name, "BI") == 0) return CountryCodeBI; break;
+            case PlayFabJsonReader::Hash("KH"): if (strcmp(name, "KH") == 0) return CountryCodeKH; break;
+            case PlayFabJsonReader::Hash("CM"): if (strcmp(name, "CM") == 0) return CountryCodeCM; break;
+            case PlayFabJsonReader::Hash("CA"): if (strcmp(name, "CA") == 0) return CountryCodeCA; break;
+            case PlayFabJsonReader::Hash("CV"): if (strcmp(name, "CV") == 0) return CountryCodeCV; break;
+            case PlayFabJsonReader::Hash("KY"): if (strcmp(name, "KY") == 0) return CountryCodeKY; break;
+            case PlayFabJsonReader::Hash("CF"): if (strcmp(name, "CF") == 0) return CountryCodeCF; break;
+            case PlayFabJsonReader::Hash("TD"): if (strcmp(name, "TD") == 0) return CountryCodeTD; break;
+            case PlayFabJsonReader::Hash("CL"): if (strcmp(name, "CL") == 0) return CountryCodeCL; break;
+            case PlayFabJsonReader::Hash("CN"): if (strcmp(name, "CN") == 0) return CountryCodeCN; break;
+            case PlayFabJsonReader::Hash("CX"): if (strcmp(name, "CX") == 0) return CountryCodeCX; break;
+            case PlayFabJsonReader::Hash("CC"): if (strcmp(name, "CC") == 0) return CountryCodeCC; break;
+            case PlayFabJsonReader::Hash("CO"): if (strcmp(name, "CO") == 0) return CountryCodeCO; break;
+            case PlayFabJsonReader::Hash("KM"): if (strcmp(name, "KM") == 0) return CountryCodeKM; break;
+            case PlayFabJsonReader::Hash("CG"): if (strcmp(name, "CG") == 0) return CountryCodeCG; break;
+            case PlayFabJsonReader::Hash("CD"): if (strcmp(name, "CD") == 0) return CountryCodeCD; break;
+            case PlayFabJsonReader::Hash("CK"): if (strcmp(name, "CK") == 0) return CountryCodeCK; break;
+            case PlayFabJsonReader::Hash("CR"): if (strcmp(name, "CR") == 0) return CountryCodeCR; break;
+            case PlayFabJsonReader::Hash("CI"): if (strcmp(name, "CI") == 0) return CountryCodeCI; break;
+            case PlayFabJsonReader::Hash("HR"): if (strcmp(name, "HR") == 0) return CountryCodeHR; break;
+            case PlayFabJsonReader::Hash("CU"): if (strcmp(name, "CU") == 0) return CountryCodeCU; break;
+            case PlayFabJsonReader::Hash("CW"): if (strcmp(name, "CW") == 0) return CountryCodeCW; break;
+            case PlayFabJsonReader::Hash("CY"): if (strcmp(name, "CY") == 0) return CountryCodeCY; break;
+            case PlayFabJsonReader::Hash("CZ"): if (strcmp(name, "CZ") == 0) return CountryCodeCZ; break;
+            case PlayFabJsonReader::Hash("DK"): if (strcmp(name, "DK") == 0) return CountryCodeDK; break;
+            case PlayFabJsonReader::Hash("DJ"): if (strcmp(name, "DJ") == 0) return CountryCodeDJ; break;
+            case PlayFabJsonReader::Hash("DM"): if (strcmp(name, "DM") == 0) return CountryCodeDM; break;
+            case PlayFabJsonReader::Hash("DO"): if (strcmp(name, "DO") == 0) return CountryCodeDO; break;
+            case PlayFabJsonReader::Hash("EC"): if (strcmp(name, "EC") == 0) return CountryCodeEC; break;
+            case PlayFabJsonReader::Hash("EG"): if (strcmp(name, "EG") == 0) return CountryCodeEG; break;
+            case PlayFabJsonReader::Hash("SV"): if (strcmp(name, "SV") == 0) return CountryCodeSV; break;
+            case PlayFabJsonReader::Hash("GQ"): if (strcmp(name, "GQ") == 0) return CountryCodeGQ; break;
+            case PlayFabJsonReader::Hash("ER"): if (strcmp(name, "ER") == 0) return CountryCodeER; break;
+            case PlayFabJsonReader::Hash("EE"): if (strcmp(name, "EE") == 0) return CountryCodeEE; break;
+            case PlayFabJsonReader::Hash("ET"): if (strcmp(name, "ET") == 0) return CountryCodeET; break;
+            case PlayFabJsonReader::Hash("FK"): if (strcmp(name, "FK") == 0) return CountryCodeFK; break;
+            case PlayFabJsonReader::Hash("FO"): if (strcmp(name, "FO") == 0) return CountryCodeFO; break;
+            case PlayFabJsonReader::Hash("FJ"): if (strcmp(name, "FJ") == 0) return CountryCodeFJ; break;
+            case PlayFabJsonReader::Hash("FI"): if (strcmp(name, "FI") == 0) return CountryCodeFI; break;
+            case PlayFabJsonReader::Hash("FR"): if (strcmp(name, "FR") == 0) return CountryCodeFR; break;
+            case PlayFabJsonReader::Hash("GF"): if (strcmp(name, "GF") == 0) return CountryCodeGF; break;
+            case PlayFabJsonReader::Hash("PF"): if (strcmp(name, "PF") == 0) return CountryCodePF; break;
+            case PlayFabJsonReader::Hash("TF"): if (strcmp(name, "TF") == 0) return CountryCodeTF; break;
+            case PlayFabJsonReader::Hash("GA"): if (strcmp(name, "GA") == 0) return CountryCodeGA; break;
+            case PlayFabJsonReader::Hash("GM"): if (strcmp(name, "GM") == 0) return CountryCodeGM; break;
+            case PlayFabJsonReader::Hash("GE"): if (strcmp(name, "GE") == 0) return CountryCodeGE; break;
+            case PlayFabJsonReader::Hash("DE"): if (strcmp(name, "DE") == 0) return CountryCodeDE; break;
+            case PlayFabJsonReader::Hash("GH"): if (strcmp(name, "GH") == 0) return CountryCodeGH; break;
+            case PlayFabJsonReader::Hash("GI"): if (strcmp(name, "GI") == 0) return CountryCodeGI; break;
+            case PlayFabJsonReader::Hash("GR"): if (strcmp(name, "GR") == 0) return CountryCodeGR; break;
+            case PlayFabJsonReader::Hash("GL"): if (strcmp(name, "GL") == 0) return CountryCodeGL; break;
+            case PlayFabJsonReader::Hash("GD"): if (strcmp(name, "GD") == 0) return CountryCodeGD; break;
+            case PlayFabJsonReader::Hash("GP"): if (strcmp(name, "GP") == 0) return CountryCodeGP; break;
+            case PlayFabJsonReader::Hash("GU"): if (strcmp(name, "GU") == 0) return CountryCodeGU; break;
+            case PlayFabJsonReader::Hash("GT"): if (strcmp(name, "GT") == 0) return CountryCodeGT; break;
+            case PlayFabJsonReader::Hash("GG"): if (strcmp(name, "GG") == 0) return CountryCodeGG; break;
+            case PlayFabJsonReader::Hash("GN"): if (strcmp(name, "GN") == 0) return CountryCodeGN; break;
+            case PlayFabJsonReader::Hash("GW"): if (strcmp(name, "GW") == 0) return CountryCodeGW; break;
+            case PlayFabJsonReader::Hash("GY"): if (strcmp(name, "GY") == 0) return CountryCodeGY; break;
+            case PlayFabJsonReader::Hash("HT"): if (strcmp(name, "HT") == 0) return CountryCodeHT; break;
+            case PlayFabJsonReader::Hash("HM"): if (strcmp(name, "HM") == 0) return CountryCodeHM; break;
+            case PlayFabJsonReader::Hash("VA"): if (strcmp(name, "VA") == 0) return CountryCodeVA; break;
+            case PlayFabJsonReader::Hash("HN"): if (strcmp(name, "HN") == 0) return CountryCodeHN; break;
+            case PlayFabJsonReader::Hash("HK"): if (strcmp(name, "HK") == 0) return CountryCodeHK; break;
+            case PlayFabJsonReader::Hash("HU"): if (strcmp(name, "HU") == 0) return CountryCodeHU; break;
+            case PlayFabJsonReader::Hash("IS"): if (strcmp(name, "IS") == 0) return CountryCodeIS; break;
+            case PlayFabJsonReader::Hash("IN"): if (strcmp(name, "IN") == 0) return CountryCodeIN; break;
+            case PlayFabJsonReader::Hash("ID"): if (strcmp(name, "ID") == 0) return CountryCodeID; break;
+            case PlayFabJsonReader::Hash("IR"): if (strcmp(name, "IR") == 0) return CountryCodeIR; break;
+            case PlayFabJsonReader::Hash("IQ"): if (strcmp(name, "IQ") == 0) return CountryCodeIQ; break;
+            case PlayFabJsonReader::Hash("IE"): if (strcmp(name, "IE") == 0) return CountryCodeIE; break;
+            case PlayFabJsonReader::Hash("IM"): if (strcmp(name, "IM") == 0) return CountryCodeIM; break;
+            case PlayFabJsonReader::Hash("IL"): if (strcmp(name, "IL") == 0) return CountryCodeIL; break;
+            case PlayFabJsonReader::Hash("IT"): if (strcmp(name, "IT") == 0) return CountryCodeIT; break;
+            case PlayFabJsonReader::Hash("JM"): if (strcmp(name, "JM") == 0) return CountryCodeJM; break;
+            case PlayFabJsonReader::Hash("JP"): if (strcmp(name, "JP") == 0) return CountryCodeJP; break;
+            case PlayFabJsonReader::Hash("JE"): if (strcmp(name, "JE") == 0) return CountryCodeJE; break;
+            case PlayFabJsonReader::Hash("JO"): if (strcmp(name, "JO") == 0) return CountryCodeJO; break;
+            case PlayFabJsonReader::Hash("KZ"): if (strcmp(name, "KZ") == 0) return CountryCodeKZ; break;
+            case PlayFabJsonReader::Hash("KE"): if (strcmp(name, "KE") == 0) return CountryCodeKE; break;
+            case PlayFabJsonReader::Hash("KI"): if (strcmp(name, "KI") == 0) return CountryCodeKI; break;
+            case PlayFabJsonReader::Hash("KP"): if (strcmp(name, "KP") == 0) return CountryCodeKP; break;
+            case PlayFabJsonReader::Hash("KR"): if (strcmp(name, "KR") == 0) return CountryCodeKR; break;
+            case PlayFabJsonReader::Hash("KW"): if (strcmp(name, "KW") == 0) return CountryCodeKW; break;
+            case PlayFabJsonReader::Hash("KG"): if (strcmp(name, "KG") == 0) return CountryCodeKG; break;
+            case PlayFabJsonReader::Hash("LA"): if (strcmp(name, "LA") == 0) return CountryCodeLA; break;
+            case PlayFabJsonReader::Hash("LV"): if (strcmp(name, "LV") == 0) return CountryCodeLV; break;
+            case PlayFabJsonReader::Hash("LB"): if (strcmp(name, "LB") == 0) return CountryCodeLB; break;
+            case PlayFabJsonReader::Hash("LS"): if (strcmp(name, "LS") == 0) return CountryCodeLS; break;
+            case PlayFabJsonReader::Hash("LR"): if (strcmp(name, "LR") == 0) return CountryCodeLR; break;
+            case PlayFabJsonReader::Hash("LY"): if (strcmp(name, "LY") == 0) return CountryCodeLY; break;
+            case PlayFabJsonReader::Hash("LI"): if (strcmp(name, "LI") == 0) return CountryCodeLI; break;
+            case PlayFabJsonReader::Hash("LT"): if (strcmp(name, "LT") == 0) return CountryCodeLT; break;
+            case PlayFabJsonReader::Hash("LU"): if (strcmp(name, "LU") == 0) return CountryCodeLU; break;
+            case PlayFabJsonReader::Hash("MO"): if (strcmp(name, "MO") == 0) return CountryCodeMO; break;
+            case PlayFabJsonReader::Hash("MK"): if (strcmp(name, "MK") == 0) return CountryCodeMK; break;
+            case PlayFabJsonReader::Hash("MG"): if (strcmp(name, "MG") == 0) return CountryCodeMG; break;
+            case PlayFabJsonReader::Hash("MW"): if (strcmp(name, "MW") == 0) return CountryCodeMW; break;
+            case PlayFabJsonReader::Hash("MY"): if (strcmp(name, "MY") == 0) return CountryCodeMY; break;
+            case PlayFabJsonReader::Hash("MV"): if (strcmp(name, "MV") == 0) return CountryCodeMV; break;
+            case PlayFabJsonReader::Hash("ML"): if (strcmp(name, "ML") == 0) return CountryCodeML; break;
+            case PlayFabJsonReader::Hash("MT"): if (strcmp(name, "MT") == 0) return CountryCodeMT; break;
+            case PlayFabJsonReader::Hash("MH"): if (strcmp(name, "MH") == 0) return CountryCodeMH; break;
+            case PlayFabJsonReader::Hash("MQ"): if (strcmp(name, "MQ") == 0) return CountryCodeMQ; break;
+            case PlayFabJsonReader::Hash("MR"): if (strcmp(name, "MR") == 0) return CountryCodeMR; break;
+            case PlayFabJsonReader::Hash("MU"): if (strcmp(name, "MU") == 0) return CountryCodeMU; break;
+            case PlayFabJsonReader::Hash("YT"): if (strcmp(name, "YT") == 0) return CountryCodeYT; break;
+            case PlayFabJsonReader::Hash("MX"): if (strcmp(name, "MX") == 0) return CountryCodeMX; break;
+            case PlayFabJsonReader::Hash("FM"): if (strcmp(name, "FM") == 0) return CountryCodeFM; break;
+            case PlayFabJsonReader::Hash("MD"): if (strcmp(name, "MD") == 0) return CountryCodeMD; break;
+            case PlayFabJsonReader::Hash("MC"): if (strcmp(name, "MC") == 0) return CountryCodeMC; break;
+            case PlayFabJsonReader::Hash("MN"): if (strcmp(name, "MN") == 0) return CountryCodeMN; break;
+            case PlayFabJsonReader::Hash("ME"): if (strcmp(name, "ME") == 0) return CountryCodeME; break;
+            case PlayFabJsonReader::Hash("MS"): if (strcmp(name, "MS") == 0) return CountryCodeMS; break;
+            case PlayFabJsonReader::Hash("MA"): if (strcmp(name, "MA") == 0) return CountryCodeMA; break;
+            case PlayFabJsonReader::Hash("MZ"): if (strcmp(name, "MZ") == 0) return CountryCodeMZ; break;
+            case PlayFabJsonReader::Hash("MM"): if (strcmp(name, "MM") == 0) return CountryCodeMM; break;
+            case PlayFabJsonReader::Hash("NA"): if (strcmp(name, "NA") == 0) return CountryCodeNA; break;
+            case PlayFabJsonReader::Hash("NR"): if (strcmp(name, "NR") == 0) return CountryCodeNR; break;
+            case PlayFabJsonReader::Hash("NP"): if (strcmp(name, "NP") == 0) return CountryCodeNP; break;
+            case PlayFabJsonReader::Hash("NL"): if (strcmp(name, "NL") == 0) return CountryCodeNL; break;
+            case PlayFabJsonReader::Hash("NC"): if (strcmp(name, "NC") == 0) return CountryCodeNC; break;
+            case PlayFabJsonReader::Hash("NZ"): if (strcmp(name, "NZ") == 0) return CountryCodeNZ; break;
+            case PlayFabJsonReader::Hash("NI"): if (strcmp(name, "NI") == 0) return CountryCodeNI; break;
+            case PlayFabJsonReader::Hash("NE"): if (strcmp(name, "NE") == 0) return CountryCodeNE; break;
+            case PlayFabJsonReader::Hash("NG"): if (strcmp(name, "NG") == 0) return CountryCodeNG; break;
+            case PlayFabJsonReader::Hash("NU"): if (strcmp(name, "NU") == 0) return CountryCodeNU; break;
+            case PlayFabJsonReader::Hash("NF"): if (strcmp(name, "NF") == 0) return CountryCodeNF; break;
+            case PlayFabJsonReader::Hash("MP"): if (strcmp(name, "MP") == 0) return CountryCodeMP; break;
+            case PlayFabJsonReader::Hash("NO"): if (strcmp(name, "NO") == 0) return CountryCodeNO; break;
+            case PlayFabJsonReader::Hash("OM"): if (strcmp(name, "OM") == 0) return CountryCodeOM; break;
+            case PlayFabJsonReader::Hash("PK"): if (strcmp(name, "PK") == 0) return CountryCodePK; break;
+            case PlayFabJsonReader::Hash("PW"): if (strcmp(name, "PW") == 0) return CountryCodePW; break;
+            case PlayFabJsonReader::Hash("PS"): if (strcmp(name, "PS") == 0) return CountryCodePS; break;
+            case PlayFabJsonReader::Hash("PA"): if (strcmp(name, "PA") == 0) return CountryCodePA; break;
+            case PlayFabJsonReader::Hash("PG"): if (strcmp(name, "PG") == 0) return CountryCodePG; break;
+            case PlayFabJsonReader::Hash("PY"): if (strcmp(name, "PY") == 0) return CountryCodePY; break;
+            case PlayFabJsonReader::Hash("PE"): if (strcmp(name, "PE") == 0) return CountryCodePE; break;
+            case PlayFabJsonReader::Hash("PH"): if (strcmp(name, "PH") == 0) return CountryCodePH; break;
+            case PlayFabJsonReader::Hash("PN"): if (strcmp(name, "PN") == 0) return CountryCodePN; break;
+            case PlayFabJsonReader::Hash("PL"): if (strcmp(name, "PL") == 0) return CountryCodePL; break;
+            case PlayFabJsonReader::Hash("PT"): if (strcmp(name, "PT") == 0) return CountryCodePT; break;
+            case PlayFabJsonReader::Hash("PR"): if (strcmp(name, "PR") == 0) return CountryCodePR; break;
+            case PlayFabJsonReader::Hash("QA"): if (strcmp(name, "QA") == 0) return CountryCodeQA; break;
+            case PlayFabJsonReader::Hash("RE"): if (strcmp(name, "RE") == 0) return CountryCodeRE; break;
+            case PlayFabJsonReader::Hash("RO"): if (strcmp(name, "RO") == 0) return CountryCodeRO; break;
+            case PlayFabJsonReader::Hash("RU"): if (strcmp(name, "RU") == 0) return CountryCodeRU; break;
+            case PlayFabJsonReader::Hash("RW"): if (strcmp(name, "RW") == 0) return CountryCodeRW; break;
+            case PlayFabJsonReader::Hash("BL"): if (strcmp(name, "BL") == 0) return CountryCodeBL; break;
+            case PlayFabJsonReader::Hash("SH"): if (strcmp(name, "SH") == 0) return CountryCodeSH; break;
+            case PlayFabJsonReader::Hash("KN"): if (strcmp(name, "KN") == 0) return CountryCodeKN; break;
+            case PlayFabJsonReader::Hash("LC"): if (strcmp(name, "LC") == 0) return CountryCodeLC; break;
+            case PlayFabJsonReader::Hash("MF"): if (strcmp(name, "MF") == 0) return CountryCodeMF; break;
+            case PlayFabJsonReader::Hash("PM"): if (strcmp(name, "PM") == 0) return CountryCodePM; break;
+            case PlayFabJsonReader::Hash("VC"): if (strcmp(name, "VC") == 0) return CountryCodeVC; break;
+            case PlayFabJsonReader::Hash("WS"): if (strcmp(name, "WS") == 0) return CountryCodeWS; break;
+            case PlayFabJsonReader::Hash("SM"): if (strcmp(name, "SM") == 0) return CountryCodeSM; break;
+            case PlayFabJsonReader::Hash("ST"): if (strcmp(name, "ST") == 0) return CountryCodeST; break;
+            case PlayFabJsonReader::Hash("SA"): if (strcmp(name, "SA") == 0) return CountryCodeSA; break;
+            case PlayFabJsonReader::Hash("SN"): if (strcmp(name, "SN") == 0) return CountryCodeSN; break;
+            case PlayFabJsonReader::Hash("RS"): if (strcmp(name, "RS") == 0) return CountryCodeRS; break;
+            case PlayFabJsonReader::Hash("SC"): if (strcmp(name, "SC") == 0) return CountryCodeSC; break;
+            case PlayFabJsonReader::Hash("SL"): if (strcmp(name, "SL") == 0) return CountryCodeSL; break;
+            case PlayFabJsonReader::Hash("SG"): if (strcmp(name, "SG") == 0) return CountryCodeSG; break;
+            case PlayFabJsonReader::Hash("SX"): if (strcmp(name, "SX") == 0) return CountryCodeSX; break;
+            case PlayFabJsonReader::Hash("SK"): if (strcmp(name, "SK") == 0) return CountryCodeSK; break;
+            case PlayFabJsonReader::Hash("SI"): if (strcmp(name, "SI") == 0) return CountryCodeSI; break;
+            case PlayFabJsonReader::Hash("SB"): if (strcmp(name, "SB") == 0) return CountryCodeSB; break;
+            case PlayFabJsonReader::Hash("SO"): if (strcmp(name, "SO") == 0) return CountryCodeSO; break;
+            case PlayFabJsonReader::Hash("ZA"): if (strcmp(name, "ZA") == 0) return CountryCodeZA; break;
+            case PlayFabJsonReader::Hash("GS"): if (strcmp(name, "GS") == 0) return CountryCodeGS; break;
+            case PlayFabJsonReader::Hash("SS"): if (strcmp(name, "SS") == 0) return CountryCodeSS; break;
+            case PlayFabJsonReader::Hash("ES"): if (strcmp(name, "ES") == 0) return CountryCodeES; break;
+            case PlayFabJsonReader::Hash("LK"): if (strcmp(name, "LK") == 0) return CountryCodeLK; break;
+            case PlayFabJsonReader::Hash("SD"): if (strcmp(name, "SD") == 0) return CountryCodeSD; break;
+            case PlayFabJsonReader::Hash("SR"): if (strcmp(name, "SR") == 0) return CountryCodeSR; break;
+            case PlayFabJsonReader::Hash("SJ"): if (strcmp(name, "SJ") == 0) return CountryCodeSJ; break;
+            case PlayFabJsonReader::Hash("SZ"): if (strcmp(name, "SZ") == 0) return CountryCodeSZ; break;
+            case PlayFabJsonReader::Hash("SE"): if (strcmp(name, "SE") == 0) return CountryCodeSE; break;
+            case PlayFabJsonReader::Hash("CH"): if (strcmp(name, "CH") == 0) return CountryCodeCH; break;
+            case PlayFabJsonReader::Hash("SY"): if (strcmp(name, "SY") == 0) return CountryCodeSY; break;
+            case PlayFabJsonReader::Hash("TW"): if (strcmp(name, "TW") == 0) return CountryCodeTW; break;
+            case PlayFabJsonReader::Hash("TJ"): if (strcmp(name, "TJ") == 0) return CountryCodeTJ; break;
+            case PlayFabJsonReader::Hash("TZ"): if (strcmp(name, "TZ") == 0) return CountryCodeTZ; break;
+            case PlayFabJsonReader::Hash("TH"): if (strcmp(name, "TH") == 0) return CountryCodeTH; break;
+            case PlayFabJsonReader::Hash("TL"): if (strcmp(name, "TL") == 0) return CountryCodeTL; break;
+            case PlayFabJsonReader::Hash("TG"): if (strcmp(name, "TG") == 0) return CountryCodeTG; break;
+            case PlayFabJsonReader::Hash("TK"): if (strcmp(name, "TK") == 0) return CountryCodeTK; break;
+            case PlayFabJsonReader::Hash("TO"): if (strcmp(name, "TO") == 0) return CountryCodeTO; break;
+            case PlayFabJsonReader::Hash("TT"): if (strcmp(name, "TT") == 0) return CountryCodeTT; break;
+            case PlayFabJsonReader::Hash("TN"): if (strcmp(name, "TN") == 0) return CountryCodeTN; break;
+            case PlayFabJsonReader::Hash("TR"): if (strcmp(name, "TR") == 0) return CountryCodeTR; break;
+            case PlayFabJsonReader::Hash("TM"): if (strcmp(name, "TM") == 0) return CountryCodeTM; break;
+            case PlayFabJsonReader::Hash("TC"): if (strcmp(name, "TC") == 0) return CountryCodeTC; break;
+            case PlayFabJsonReader::Hash("TV"): if (strcmp(name, "TV") == 0) return CountryCodeTV; break;
+            case PlayFabJsonReader::Hash("UG"): if (strcmp(name, "UG") == 0) return CountryCodeUG; break;
+            case PlayFabJsonReader::Hash("UA"): if (strcmp(name, "UA") == 0) return CountryCodeUA; break;
+            case PlayFabJsonReader::Hash("AE"): if (strcmp(name, "AE") == 0) return CountryCodeAE; break;
+            case PlayFabJsonReader::Hash("GB"): if (strcmp(name, "GB") == 0) return CountryCodeGB; break;
+            case PlayFabJsonReader::Hash("US"): if (strcmp(name, "US") == 0) return CountryCodeUS; break;
+            case PlayFabJsonReader::Hash("UM"): if (strcmp(name, "UM") == 0) return CountryCodeUM; break;
+            case PlayFabJsonReader::Hash("UY"): if (strcmp(name, "UY") == 0) return CountryCodeUY; break;
+            case PlayFabJsonReader::Hash("UZ"): if (strcmp(name, "UZ") == 0) return CountryCodeUZ; break;
+            case PlayFabJsonReader::Hash("VU"): if (strcmp(name, "VU") == 0) return CountryCodeVU; break;
+            case PlayFabJsonReader::Hash("VE"): if (strcmp(name, "VE") == 0) return CountryCodeVE; break;
+            case PlayFabJsonReader::Hash("VN"): if (strcmp(name, "VN") == 0) return CountryCodeVN; break;
+            case PlayFabJsonReader::Hash("VG"): if (strcmp(name, "VG") == 0) return CountryCodeVG; break;
+            case PlayFabJsonReader::Hash("VI"): if (strcmp(name, "VI") == 0) return CountryCodeVI; break;
+            case PlayFabJsonReader::Hash("WF"): if (strcmp(name, "WF") == 0) return CountryCodeWF; break;
+            case PlayFabJsonReader::Hash("EH"): if (strcmp(name, "EH") == 0) return CountryCodeEH; break;
+            case PlayFabJsonReader::Hash("YE"): if (strcmp(name, "YE") == 0) return CountryCodeYE; break;
+            case PlayFabJsonReader::Hash("ZM"): if (strcmp(name, "ZM") == 0) return CountryCodeZM; break;
+            case PlayFabJsonReader::Hash("ZW"): if (strcmp(name, "ZW") == 0) return CountryCodeZW; break;
+            }
 
             return CountryCodeAF; // Basically critical fail
         }
@@ -3468,6 +5301,18 @@ namespace PlayFabComboSdk
                 Parameter(src.Parameter)
             {}
 
+            CreateActionsOnPlayerSegmentTaskRequest(CreateActionsOnPlayerSegmentTaskRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Description(AZStd::move(src.Description)),
+                Schedule(AZStd::move(src.Schedule)),
+                IsActive(AZStd::move(src.IsActive)),
+                Parameter(AZStd::move(src.Parameter))
+            {}
+
+            CreateActionsOnPlayerSegmentTaskRequest& operator=(const CreateActionsOnPlayerSegmentTaskRequest& src) = default;
+            CreateActionsOnPlayerSegmentTaskRequest& operator=(CreateActionsOnPlayerSegmentTaskRequest&& src) = default;
+
             CreateActionsOnPlayerSegmentTaskRequest(const rapidjson::Value& obj) : CreateActionsOnPlayerSegmentTaskRequest()
             {
                 readFromValue(obj);
@@ -3512,6 +5357,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Schedule"):
+                            if (strcmp(member, "Schedule") != 0)
+                                break;
+                            Schedule = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsActive"):
+                            if (strcmp(member, "IsActive") != 0)
+                                break;
+                            IsActive = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Parameter"):
+                            if (strcmp(member, "Parameter") != 0)
+                                break;
+                            Parameter.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CreateCloudScriptTaskRequest : public PlayFabBaseModel
@@ -3540,6 +5428,18 @@ namespace PlayFabComboSdk
                 Parameter(src.Parameter)
             {}
 
+            CreateCloudScriptTaskRequest(CreateCloudScriptTaskRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Description(AZStd::move(src.Description)),
+                Schedule(AZStd::move(src.Schedule)),
+                IsActive(AZStd::move(src.IsActive)),
+                Parameter(AZStd::move(src.Parameter))
+            {}
+
+            CreateCloudScriptTaskRequest& operator=(const CreateCloudScriptTaskRequest& src) = default;
+            CreateCloudScriptTaskRequest& operator=(CreateCloudScriptTaskRequest&& src) = default;
+
             CreateCloudScriptTaskRequest(const rapidjson::Value& obj) : CreateCloudScriptTaskRequest()
             {
                 readFromValue(obj);
@@ -3584,6 +5484,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Schedule"):
+                            if (strcmp(member, "Schedule") != 0)
+                                break;
+                            Schedule = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsActive"):
+                            if (strcmp(member, "IsActive") != 0)
+                                break;
+                            IsActive = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Parameter"):
+                            if (strcmp(member, "Parameter") != 0)
+                                break;
+                            Parameter.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CreatePlayerSharedSecretRequest : public PlayFabBaseModel
@@ -3600,6 +5543,14 @@ namespace PlayFabComboSdk
                 FriendlyName(src.FriendlyName)
             {}
 
+            CreatePlayerSharedSecretRequest(CreatePlayerSharedSecretRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                FriendlyName(AZStd::move(src.FriendlyName))
+            {}
+
+            CreatePlayerSharedSecretRequest& operator=(const CreatePlayerSharedSecretRequest& src) = default;
+            CreatePlayerSharedSecretRequest& operator=(CreatePlayerSharedSecretRequest&& src) = default;
+
             CreatePlayerSharedSecretRequest(const rapidjson::Value& obj) : CreatePlayerSharedSecretRequest()
             {
                 readFromValue(obj);
@@ -3626,6 +5577,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FriendlyName"):
+                            if (strcmp(member, "FriendlyName") != 0)
+                                break;
+                            FriendlyName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CreatePlayerSharedSecretResult : public PlayFabBaseModel
@@ -3642,6 +5616,14 @@ namespace PlayFabComboSdk
                 SecretKey(src.SecretKey)
             {}
 
+            CreatePlayerSharedSecretResult(CreatePlayerSharedSecretResult&& src) noexcept :
+                PlayFabBaseModel(),
+                SecretKey(AZStd::move(src.SecretKey))
+            {}
+
+            CreatePlayerSharedSecretResult& operator=(const CreatePlayerSharedSecretResult& src) = default;
+            CreatePlayerSharedSecretResult& operator=(CreatePlayerSharedSecretResult&& src) = default;
+
             CreatePlayerSharedSecretResult(const rapidjson::Value& obj) : CreatePlayerSharedSecretResult()
             {
                 readFromValue(obj);
@@ -3668,6 +5650,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecretKey"):
+                            if (strcmp(member, "SecretKey") != 0)
+                                break;
+                            SecretKey = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum StatisticResetIntervalOption
@@ -3698,22 +5703,17 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<StatisticResetIntervalOption>(obj.GetInt());
 
-            static std::map<const char *, StatisticResetIntervalOption, PlayFabComboSdk::StringCompare> _StatisticResetIntervalOptionMap;
-            if (_StatisticResetIntervalOptionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _StatisticResetIntervalOptionMap["Never"] = StatisticResetIntervalOptionNever;
-                _StatisticResetIntervalOptionMap["Hour"] = StatisticResetIntervalOptionHour;
-                _StatisticResetIntervalOptionMap["Day"] = StatisticResetIntervalOptionDay;
-                _StatisticResetIntervalOptionMap["Week"] = StatisticResetIntervalOptionWeek;
-                _StatisticResetIntervalOptionMap["Month"] = StatisticResetIntervalOptionMonth;
-
+            case PlayFabJsonReader::Hash("Never"): if (strcmp(name, "Never") == 0) return StatisticResetIntervalOptionNever; break;
+            case PlayFabJsonReader::Hash("Hour"): if (strcmp(name, "Hour") == 0) return StatisticResetIntervalOptionHour; break;
+            case PlayFabJsonReader::Hash("Day"): if (strcmp(name, "Day") == 0) return StatisticResetIntervalOptionDay; break;
+            case PlayFabJsonReader::Hash("Week"): if (strcmp(name, "Week") == 0) return StatisticResetIntervalOptionWeek; break;
+            case PlayFabJsonReader::Hash("Month"): if (strcmp(name, "Month") == 0) return StatisticResetIntervalOptionMonth; break;
             }
 
-            auto output = _StatisticResetIntervalOptionMap.find(obj.GetString());
-            if (output != _StatisticResetIntervalOptionMap.end())
-                return output->second;
-
             return StatisticResetIntervalOptionNever; // Basically critical fail
         }
 
@@ -3743,21 +5743,16 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<StatisticAggregationMethod>(obj.GetInt());
 
-            static std::map<const char *, StatisticAggregationMethod, PlayFabComboSdk::StringCompare> _StatisticAggregationMethodMap;
-            if (_StatisticAggregationMethodMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _StatisticAggregationMethodMap["Last"] = StatisticAggregationMethodLast;
-                _StatisticAggregationMethodMap["Min"] = StatisticAggregationMethodMin;
-                _StatisticAggregationMethodMap["Max"] = StatisticAggregationMethodMax;
-                _StatisticAggregationMethodMap["Sum"] = StatisticAggregationMethodSum;
-
+            case PlayFabJsonReader::Hash("Last"): if (strcmp(name, "Last") == 0) return StatisticAggregationMethodLast; break;
+            case PlayFabJsonReader::Hash("Min"): if (strcmp(name, "Min") == 0) return StatisticAggregationMethodMin; break;
+            case PlayFabJsonReader::Hash("Max"): if (strcmp(name, "Max") == 0) return StatisticAggregationMethodMax; break;
+            case PlayFabJsonReader::Hash("Sum"): if (strcmp(name, "Sum") == 0) return StatisticAggregationMethodSum; break;
             }
 
-            auto output = _StatisticAggregationMethodMap.find(obj.GetString());
-            if (output != _StatisticAggregationMethodMap.end())
-                return output->second;
-
             return StatisticAggregationMethodLast; // Basically critical fail
         }
 
@@ -3781,6 +5776,16 @@ namespace PlayFabComboSdk
                 AggregationMethod(src.AggregationMethod)
             {}
 
+            CreatePlayerStatisticDefinitionRequest(CreatePlayerStatisticDefinitionRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                VersionChangeInterval(AZStd::move(src.VersionChangeInterval)),
+                AggregationMethod(AZStd::move(src.AggregationMethod))
+            {}
+
+            CreatePlayerStatisticDefinitionRequest& operator=(const CreatePlayerStatisticDefinitionRequest& src) = default;
+            CreatePlayerStatisticDefinitionRequest& operator=(CreatePlayerStatisticDefinitionRequest&& src) = default;
+
             CreatePlayerStatisticDefinitionRequest(const rapidjson::Value& obj) : CreatePlayerStatisticDefinitionRequest()
             {
                 readFromValue(obj);
@@ -3817,6 +5822,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VersionChangeInterval"):
+                            if (strcmp(member, "VersionChangeInterval") != 0)
+                                break;
+                            VersionChangeInterval = readStatisticResetIntervalOptionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("AggregationMethod"):
+                            if (strcmp(member, "AggregationMethod") != 0)
+                                break;
+                            AggregationMethod = readStatisticAggregationMethodFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerStatisticDefinition : public PlayFabBaseModel
@@ -3842,6 +5880,17 @@ namespace PlayFabComboSdk
                 AggregationMethod(src.AggregationMethod)
             {}
 
+            PlayerStatisticDefinition(PlayerStatisticDefinition&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                CurrentVersion(AZStd::move(src.CurrentVersion)),
+                VersionChangeInterval(AZStd::move(src.VersionChangeInterval)),
+                AggregationMethod(AZStd::move(src.AggregationMethod))
+            {}
+
+            PlayerStatisticDefinition& operator=(const PlayerStatisticDefinition& src) = default;
+            PlayerStatisticDefinition& operator=(PlayerStatisticDefinition&& src) = default;
+
             PlayerStatisticDefinition(const rapidjson::Value& obj) : PlayerStatisticDefinition()
             {
                 readFromValue(obj);
@@ -3884,6 +5933,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CurrentVersion"):
+                            if (strcmp(member, "CurrentVersion") != 0)
+                                break;
+                            CurrentVersion = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("VersionChangeInterval"):
+                            if (strcmp(member, "VersionChangeInterval") != 0)
+                                break;
+                            VersionChangeInterval = readStatisticResetIntervalOptionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("AggregationMethod"):
+                            if (strcmp(member, "AggregationMethod") != 0)
+                                break;
+                            AggregationMethod = readStatisticAggregationMethodFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CreatePlayerStatisticDefinitionResult : public PlayFabBaseModel
@@ -3900,6 +5987,31 @@ namespace PlayFabComboSdk
                 Statistic(src.Statistic ? new PlayerStatisticDefinition(*src.Statistic) : nullptr)
             {}
 
+            CreatePlayerStatisticDefinitionResult(CreatePlayerStatisticDefinitionResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Statistic(src.Statistic)
+            {
+                src.Statistic = nullptr;
+            }
+
+            CreatePlayerStatisticDefinitionResult& operator=(const CreatePlayerStatisticDefinitionResult& src)
+            {
+                if (this != &src)
+                    *this = CreatePlayerStatisticDefinitionResult(src);
+                return *this;
+            }
+
+            CreatePlayerStatisticDefinitionResult& operator=(CreatePlayerStatisticDefinitionResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (Statistic != nullptr) delete Statistic;
+                    Statistic = src.Statistic;
+                    src.Statistic = nullptr;
+                }
+                return *this;
+            }
+
             CreatePlayerStatisticDefinitionResult(const rapidjson::Value& obj) : CreatePlayerStatisticDefinitionResult()
             {
                 readFromValue(obj);
@@ -3927,6 +6039,30 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Statistic"):
+                            if (strcmp(member, "Statistic") != 0)
+                                break;
+                            Statistic = new PlayerStatisticDefinition;
+                            Statistic->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CreateTaskResult : public PlayFabBaseModel
@@ -3943,6 +6079,14 @@ namespace PlayFabComboSdk
                 TaskId(src.TaskId)
             {}
 
+            CreateTaskResult(CreateTaskResult&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskId(AZStd::move(src.TaskId))
+            {}
+
+            CreateTaskResult& operator=(const CreateTaskResult& src) = default;
+            CreateTaskResult& operator=(CreateTaskResult&& src) = default;
+
             CreateTaskResult(const rapidjson::Value& obj) : CreateTaskResult()
             {
                 readFromValue(obj);
@@ -3969,6 +6113,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskId"):
+                            if (strcmp(member, "TaskId") != 0)
+                                break;
+                            TaskId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum Currency
@@ -4313,178 +6480,173 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<Currency>(obj.GetInt());
 
-            static std::map<const char *, Currency, PlayFabComboSdk::StringCompare> _CurrencyMap;
-            if (_CurrencyMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _CurrencyMap["AED"] = CurrencyAED;
-                _CurrencyMap["AFN"] = CurrencyAFN;
-                _CurrencyMap["ALL"] = CurrencyALL;
-                _CurrencyMap["AMD"] = CurrencyAMD;
-                _CurrencyMap["ANG"] = CurrencyANG;
-                _CurrencyMap["AOA"] = CurrencyAOA;
-                _CurrencyMap["ARS"] = CurrencyARS;
-                _CurrencyMap["AUD"] = CurrencyAUD;
-                _CurrencyMap["AWG"] = CurrencyAWG;
-                _CurrencyMap["AZN"] = CurrencyAZN;
-                _CurrencyMap["BAM"] = CurrencyBAM;
-                _CurrencyMap["BBD"] = CurrencyBBD;
-                _CurrencyMap["BDT"] = CurrencyBDT;
-                _CurrencyMap["BGN"] = CurrencyBGN;
-                _CurrencyMap["BHD"] = CurrencyBHD;
-                _CurrencyMap["BIF"] = CurrencyBIF;
-                _CurrencyMap["BMD"] = CurrencyBMD;
-                _CurrencyMap["BND"] = CurrencyBND;
-                _CurrencyMap["BOB"] = CurrencyBOB;
-                _CurrencyMap["BRL"] = CurrencyBRL;
-                _CurrencyMap["BSD"] = CurrencyBSD;
-                _CurrencyMap["BTN"] = CurrencyBTN;
-                _CurrencyMap["BWP"] = CurrencyBWP;
-                _CurrencyMap["BYR"] = CurrencyBYR;
-                _CurrencyMap["BZD"] = CurrencyBZD;
-                _CurrencyMap["CAD"] = CurrencyCAD;
-                _CurrencyMap["CDF"] = CurrencyCDF;
-                _CurrencyMap["CHF"] = CurrencyCHF;
-                _CurrencyMap["CLP"] = CurrencyCLP;
-                _CurrencyMap["CNY"] = CurrencyCNY;
-                _CurrencyMap["COP"] = CurrencyCOP;
-                _CurrencyMap["CRC"] = CurrencyCRC;
-                _CurrencyMap["CUC"] = CurrencyCUC;
-                _CurrencyMap["CUP"] = CurrencyCUP;
-                _CurrencyMap["CVE"] = CurrencyCVE;
-                _CurrencyMap["CZK"] = CurrencyCZK;
-                _CurrencyMap["DJF"] = CurrencyDJF;
-                _CurrencyMap["DKK"] = CurrencyDKK;
-                _CurrencyMap["DOP"] = CurrencyDOP;
-                _CurrencyMap["DZD"] = CurrencyDZD;
-                _CurrencyMap["EGP"] = CurrencyEGP;
-                _CurrencyMap["ERN"] = CurrencyERN;
-                _CurrencyMap["ETB"] = CurrencyETB;
-                _CurrencyMap["EUR"] = CurrencyEUR;
-                _CurrencyMap["FJD"] = CurrencyFJD;
-                _CurrencyMap["FKP"] = CurrencyFKP;
-                _CurrencyMap["GBP"] = CurrencyGBP;
-                _CurrencyMap["GEL"] = CurrencyGEL;
-                _CurrencyMap["GGP"] = CurrencyGGP;
-                _CurrencyMap["GHS"] = CurrencyGHS;
-                _CurrencyMap["GIP"] = CurrencyGIP;
-                _CurrencyMap["GMD"] = CurrencyGMD;
-                _CurrencyMap["GNF"] = CurrencyGNF;
-                _CurrencyMap["GTQ"] = CurrencyGTQ;
-                _CurrencyMap["GYD"] = CurrencyGYD;
-                _CurrencyMap["HKD"] = CurrencyHKD;
-                _CurrencyMap["HNL"] = CurrencyHNL;
-                _CurrencyMap["HRK"] = CurrencyHRK;
-                _CurrencyMap["HTG"] = CurrencyHTG;
-                _CurrencyMap["HUF"] = CurrencyHUF;
-                _CurrencyMap["IDR"] = CurrencyIDR;
-                _CurrencyMap["ILS"] = CurrencyILS;
-                _CurrencyMap["IMP"] = CurrencyIMP;
-                _CurrencyMap["INR"] = CurrencyINR;
-                _CurrencyMap["IQD"] = CurrencyIQD;
-                _CurrencyMap["IRR"] = CurrencyIRR;
-                _CurrencyMap["ISK"] = CurrencyISK;
-                _CurrencyMap["JEP"] = CurrencyJEP;
-                _CurrencyMap["JMD"] = CurrencyJMD;
-                _CurrencyMap["JOD"] = CurrencyJOD;
-                _CurrencyMap["JPY"] = CurrencyJPY;
-                _CurrencyMap["KES"] = CurrencyKES;
-                _CurrencyMap["KGS"] = CurrencyKGS;
-                _CurrencyMap["KHR"] = CurrencyKHR;
-                _CurrencyMap["KMF"] = CurrencyKMF;
-                _CurrencyMap["KPW"] = CurrencyKPW;
-                _CurrencyMap["KRW"] = CurrencyKRW;
-                _CurrencyMap["KWD"] = CurrencyKWD;
-                _CurrencyMap["KYD"] = CurrencyKYD;
-                _CurrencyMap["KZT"] = CurrencyKZT;
-                _CurrencyMap["LAK"] = CurrencyLAK;
-                _CurrencyMap["LBP"] = CurrencyLBP;
-                _CurrencyMap["LKR"] = CurrencyLKR;
-                _CurrencyMap["LRD"] = CurrencyLRD;
-                _CurrencyMap["LSL"] = CurrencyLSL;
-                _CurrencyMap["LYD"] = CurrencyLYD;
-                _CurrencyMap["MAD"] = CurrencyMAD;
-                _CurrencyMap["MDL"] = CurrencyMDL;
-                _CurrencyMap["MGA"] = CurrencyMGA;
-                _CurrencyMap["MKD"] = CurrencyMKD;
-                _CurrencyMap["MMK"] = CurrencyMMK;
-                _CurrencyMap["MNT"] = CurrencyMNT;
-                _CurrencyMap["MOP"] = CurrencyMOP;
-                _CurrencyMap["MRO"] = CurrencyMRO;
-                _CurrencyMap["MUR"] = CurrencyMUR;
-                _CurrencyMap["MVR"] = CurrencyMVR;
-                _CurrencyMap["MWK"] = CurrencyMWK;
-                _CurrencyMap["MXN"] = CurrencyMXN;
-                _CurrencyMap["MYR"] = CurrencyMYR;
-                _CurrencyMap["MZN"] = CurrencyMZN;
-                _CurrencyMap["NAD"] = CurrencyNAD;
-                _CurrencyMap["NGN"] = CurrencyNGN;
-                _CurrencyMap["NIO"] = CurrencyNIO;
-                _CurrencyMap["NOK"] = CurrencyNOK;
-                _CurrencyMap["NPR"] = CurrencyNPR;
-                _CurrencyMap["NZD"] = CurrencyNZD;
-                _CurrencyMap["OMR"] = CurrencyOMR;
-                _CurrencyMap["PAB"] = CurrencyPAB;
-                _CurrencyMap["PEN"] = CurrencyPEN;
-                _CurrencyMap["PGK"] = CurrencyPGK;
-                _CurrencyMap["PHP"] = CurrencyPHP;
-                _CurrencyMap["PKR"] = CurrencyPKR;
-                _CurrencyMap["PLN"] = CurrencyPLN;
-                _CurrencyMap["PYG"] = CurrencyPYG;
-                _CurrencyMap["QAR"] = CurrencyQAR;
-                _CurrencyMap["RON"] = CurrencyRON;
-                _CurrencyMap["RSD"] = CurrencyRSD;
-                _CurrencyMap["RUB"] = CurrencyRUB;
-                _CurrencyMap["RWF"] = CurrencyRWF;
-                _CurrencyMap["SAR"] = CurrencySAR;
-                _CurrencyMap["SBD"] = CurrencySBD;
-                _CurrencyMap["SCR"] = CurrencySCR;
-                _CurrencyMap["SDG"] = CurrencySDG;
-                _CurrencyMap["SEK"] = CurrencySEK;
-                _CurrencyMap["SGD"] = CurrencySGD;
-                _CurrencyMap["SHP"] = CurrencySHP;
-                _CurrencyMap["SLL"] = CurrencySLL;
-                _CurrencyMap["SOS"] = CurrencySOS;
-                _CurrencyMap["SPL"] = CurrencySPL;
-                _CurrencyMap["SRD"] = CurrencySRD;
-                _CurrencyMap["STD"] = CurrencySTD;
-                _CurrencyMap["SVC"] = CurrencySVC;
-                _CurrencyMap["SYP"] = CurrencySYP;
-                _CurrencyMap["SZL"] = CurrencySZL;
-                _CurrencyMap["THB"] = CurrencyTHB;
-                _CurrencyMap["TJS"] = CurrencyTJS;
-                _CurrencyMap["TMT"] = CurrencyTMT;
-                _CurrencyMap["TND"] = CurrencyTND;
-                _CurrencyMap["TOP"] = CurrencyTOP;
-                _CurrencyMap["TRY"] = CurrencyTRY;
-                _CurrencyMap["TTD"] = CurrencyTTD;
-                _CurrencyMap["TVD"] = CurrencyTVD;
-                _CurrencyMap["TWD"] = CurrencyTWD;
-                _CurrencyMap["TZS"] = CurrencyTZS;
-                _CurrencyMap["UAH"] = CurrencyUAH;
-                _CurrencyMap["UGX"] = CurrencyUGX;
-                _CurrencyMap["USD"] = CurrencyUSD;
-                _CurrencyMap["UYU"] = CurrencyUYU;
-                _CurrencyMap["UZS"] = CurrencyUZS;
-                _CurrencyMap["VEF"] = CurrencyVEF;
-                _CurrencyMap["VND"] = CurrencyVND;
-                _CurrencyMap["VUV"] = CurrencyVUV;
-                _CurrencyMap["WST"] = CurrencyWST;
-                _CurrencyMap["XAF"] = CurrencyXAF;
-                _CurrencyMap["XCD"] = CurrencyXCD;
-                _CurrencyMap["XDR"] = CurrencyXDR;
-                _CurrencyMap["XOF"] = CurrencyXOF;
-                _CurrencyMap["XPF"] = CurrencyXPF;
-                _CurrencyMap["YER"] = CurrencyYER;
-                _CurrencyMap["ZAR"] = CurrencyZAR;
-                _CurrencyMap["ZMW"] = CurrencyZMW;
-                _CurrencyMap["ZWD"] = CurrencyZWD;
-
-            }
-
-            auto output = _CurrencyMap.find(obj.GetString());
-            if (output != _CurrencyMap.end())
-                return output->second;
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("AED"): if (strcmp(name, "AED") == 0) return CurrencyAED; break;
+            case PlayFabJsonReader::Hash("AFN"): if (strcmp(name, "AFN") == 0) return CurrencyAFN; break;
+            case PlayFabJsonReader::Hash("ALL"): if (strcmp(name, "ALL") == 0) return CurrencyALL; break;
+            case PlayFabJsonReader::Hash("AMD"): if (strcmp(name, "AMD") == 0) return CurrencyAMD; break;
+            case PlayFabJsonReader::Hash("ANG"): if (strcmp(name, "ANG") == 0) return CurrencyANG; break;
+            case PlayFabJsonReader::Hash("AOA"): if (strcmp(name, "AOA") == 0) return CurrencyAOA; break;
+            case PlayFabJsonReader::Hash("ARS"): if (strcmp(name, "ARS") == 0) return CurrencyARS; break;
+            case PlayFabJsonReader::Hash("AUD"): if (strcmp(name, "AUD") == 0) return CurrencyAUD; break;
+            case PlayFabJsonReader::Hash("AWG"): if (strcmp(name, "AWG") == 0) return CurrencyAWG; break;
+            case PlayFabJsonReader::Hash("AZN"): if (strcmp(name, "AZN") == 0) return CurrencyAZN; break;
+            case PlayFabJsonReader::Hash("BAM"): if (strcmp(name, "BAM") == 0) return CurrencyBAM; break;
+            case PlayFabJsonReader::Hash("BBD"): if (strcmp(name, "BBD") == 0) return CurrencyBBD; break;
+            case PlayFabJsonReader::Hash("BDT"): if (strcmp(name, "BDT") == 0) return CurrencyBDT; break;
+            case PlayFabJsonReader::Hash("BGN"): if (strcmp(name, "BGN") == 0) return CurrencyBGN; break;
+            case PlayFabJsonReader::Hash("BHD"): if (strcmp(name, "BHD") == 0) return CurrencyBHD; break;
+            case PlayFabJsonReader::Hash("BIF"): if (strcmp(name, "BIF") == 0) return CurrencyBIF; break;
+            case PlayFabJsonReader::Hash("BMD"): if (strcmp(name, "BMD") == 0) return CurrencyBMD; break;
+            case PlayFabJsonReader::Hash("BND"): if (strcmp(name, "BND") == 0) return CurrencyBND; break;
+            case PlayFabJsonReader::Hash("BOB"): if (strcmp(name, "BOB") == 0) return CurrencyBOB; break;
+            case PlayFabJsonReader::Hash("BRL"): if (strcmp(name, "BRL") == 0) return CurrencyBRL; break;
+            case PlayFabJsonReader::Hash("BSD"): if (strcmp(name, "BSD") == 0) return CurrencyBSD; break;
+            case PlayFabJsonReader::Hash("BTN"): if (strcmp(name, "BTN") == 0) return CurrencyBTN; break;
+            case PlayFabJsonReader::Hash("BWP"): if (strcmp(name, "BWP") == 0) return CurrencyBWP; break;
+            case PlayFabJsonReader::Hash("BYR"): if (strcmp(name, "BYR") == 0) return CurrencyBYR; break;
+            case PlayFabJsonReader::Hash("BZD"): if (strcmp(name, "BZD") == 0) return CurrencyBZD; break;
+            case PlayFabJsonReader::Hash("CAD"): if (strcmp(name, "CAD") == 0) return CurrencyCAD; break;
+            case PlayFabJsonReader::Hash("CDF"): if (strcmp(name, "CDF") == 0) return CurrencyCDF; break;
+            case PlayFabJsonReader::Hash("CHF"): if (strcmp(name, "CHF") == 0) return CurrencyCHF; break;
+            case PlayFabJsonReader::Hash("CLP"): if (strcmp(name, "CLP") == 0) return CurrencyCLP; break;
+            case PlayFabJsonReader::Hash("CNY"): if (strcmp(name, "CNY") == 0) return CurrencyCNY; break;
+            case PlayFabJsonReader::Hash("COP"): if (strcmp(name, "COP") == 0) return CurrencyCOP; break;
+            case PlayFabJsonReader::Hash("CRC"): if (strcmp(name, "CRC") == 0) return CurrencyCRC; break;
+            case PlayFabJsonReader::Hash("CUC"): if (strcmp(name, "CUC") == 0) return CurrencyCUC; break;
+            case PlayFabJsonReader::Hash("CUP"): if (strcmp(name, "CUP") == 0) return CurrencyCUP; break;
+            case PlayFabJsonReader::Hash("CVE"): if (strcmp(name, "CVE") == 0) return CurrencyCVE; break;
+            case PlayFabJsonReader::Hash("CZK"): if (strcmp(name, "CZK") == 0) return CurrencyCZK; break;
+            case PlayFabJsonReader::Hash("DJF"): if (strcmp(name, "DJF") == 0) return CurrencyDJF; break;
+            case PlayFabJsonReader::Hash("DKK"): if (strcmp(name, "DKK") == 0) return CurrencyDKK; break;
+            case PlayFabJsonReader::Hash("DOP"): if (strcmp(name, "DOP") == 0) return CurrencyDOP; break;
+            case PlayFabJsonReader::Hash("DZD"): if (strcmp(name, "DZD") == 0) return CurrencyDZD; break;
+            case PlayFabJsonReader::Hash("EGP"): if (strcmp(name, "EGP") == 0) return CurrencyEGP; break;
+            case PlayFabJsonReader::Hash("ERN"): if (strcmp(name, "ERN") == 0) return CurrencyERN; break;
+            case PlayFabJsonReader::Hash("ETB"): if (strcmp(name, "ETB") == 0) return CurrencyETB; break;
+            case PlayFabJsonReader::Hash("EUR"): if (strcmp(name, "EUR") == 0) return CurrencyEUR; break;
+            case PlayFabJsonReader::Hash("FJD"): if (strcmp(name, "FJD") == 0) return CurrencyFJD; break;
+            case PlayFabJsonReader::Hash("FKP"): if (strcmp(name, "FKP") == 0) return CurrencyFKP; break;
+            case PlayFabJsonReader::Hash("GBP"): if (strcmp(name, "GBP") == 0) return CurrencyGBP; break;
+            case PlayFabJsonReader::Hash("GEL"): if (strcmp(name, "GEL") == 0) return CurrencyGEL; break;
+            case PlayFabJsonReader::Hash("GGP"): if (strcmp(name, "GGP") == 0) return CurrencyGGP; break;
+            case PlayFabJsonReader::Hash("GHS"): if (strcmp(name, "GHS") == 0) return CurrencyGHS; break;
+            case PlayFabJsonReader::Hash("GIP"): if (strcmp(name, "GIP") == 0) return CurrencyGIP; break;
+            case PlayFabJsonReader::Hash("GMD"): if (strcmp(name, "GMD") == 0) return CurrencyGMD; break;
+            case PlayFabJsonReader::Hash("GNF"): if (strcmp(name, "GNF") == 0) return CurrencyGNF; break;
+            case PlayFabJsonReader::Hash("GTQ"): if (strcmp(name, "GTQ") == 0) return CurrencyGTQ; break;
+            case PlayFabJsonReader::Hash("GYD"): if (strcmp(name, "GYD") == 0) return CurrencyGYD; break;
+            case PlayFabJsonReader::Hash("HKD"): if (strcmp(name, "HKD") == 0) return CurrencyHKD; break;
+            case PlayFabJsonReader::Hash("HNL"): if (strcmp(name, "HNL") == 0) return CurrencyHNL; break;
+            case PlayFabJsonReader::Hash("HRK"): if (strcmp(name, "HRK") == 0) return CurrencyHRK; break;
+            case PlayFabJsonReader::Hash("HTG"): if (strcmp(name, "HTG") == 0) return CurrencyHTG; break;
+            case PlayFabJsonReader::Hash("HUF"): if (strcmp(name, "HUF") == 0) return CurrencyHUF; break;
+            case PlayFabJsonReader::Hash("IDR"): if (strcmp(name, "IDR") == 0) return CurrencyIDR; break;
+            case PlayFabJsonReader::Hash("ILS"): if (strcmp(name, "ILS") == 0) return CurrencyILS; break;
+            case PlayFabJsonReader::Hash("IMP"): if (strcmp(name, "IMP") == 0) return CurrencyIMP; break;
+            case PlayFabJsonReader::Hash("INR"): if (strcmp(name, "INR") == 0) return CurrencyINR; break;
+            case PlayFabJsonReader::Hash("IQD"): if (strcmp(name, "IQD") == 0) return CurrencyIQD; break;
+            case PlayFabJsonReader::Hash("IRR"): if (strcmp(name, "IRR") == 0) return CurrencyIRR; break;
+            case PlayFabJsonReader::Hash("ISK"): if (strcmp(name, "ISK") == 0) return CurrencyISK; break;
+            case PlayFabJsonReader::Hash("JEP"): if (strcmp(name, "JEP") == 0) return CurrencyJEP; break;
+            case PlayFabJsonReader::Hash("JMD"): if (strcmp(name, "JMD") == 0) return CurrencyJMD; break;
+            case PlayFabJsonReader::Hash("JOD"): if (strcmp(name, "JOD") == 0) return CurrencyJOD; break;
+            case PlayFabJsonReader::Hash("JPY"): if (strcmp(name, "JPY") == 0) return CurrencyJPY; break;
+            case PlayFabJsonReader::Hash("KES"): if (strcmp(name, "KES") == 0) return CurrencyKES; break;
+            case PlayFabJsonReader::Hash("KGS"): if (strcmp(name, "KGS") == 0) return CurrencyKGS; break;
+            case PlayFabJsonReader::Hash("KHR"): if (strcmp(name, "KHR") == 0) return CurrencyKHR; break;
+            case PlayFabJsonReader::Hash("KMF"): if (strcmp(name, "KMF") == 0) return CurrencyKMF; break;
+            case PlayFabJsonReader::Hash("KPW"): if (strcmp(name, "KPW") == 0) return CurrencyKPW; break;
+            case PlayFabJsonReader::Hash("KRW"): if (strcmp(name, "KRW") == 0) return CurrencyKRW; break;
+            case PlayFabJsonReader::Hash("KWD"): if (strcmp(name, "KWD") == 0) return CurrencyKWD; break;
+            case PlayFabJsonReader::Hash("KYD"): if (strcmp(name, "KYD") == 0) return CurrencyKYD; break;
+            case PlayFabJsonReader::Hash("KZT"): if (strcmp(name, "KZT") == 0) return CurrencyKZT; break;
+            case PlayFabJsonReader::Hash("LAK"): if (strcmp(name, "LAK") == 0) return CurrencyLAK; break;
+            case PlayFabJsonReader::Hash("LBP"): if (strcmp(name, "LBP") == 0) return CurrencyLBP; break;
+            case PlayFabJsonReader::Hash("LKR"): if (strcmp(name, "LKR") == 0) return CurrencyLKR; break;
+            case PlayFabJsonReader::Hash("LRD"): if (strcmp(name, "LRD") == 0) return CurrencyLRD; break;
+            case PlayFabJsonReader::Hash("LSL"): if (strcmp(name, "LSL") == 0) return CurrencyLSL; break;
+            case PlayFabJsonReader::Hash("LYD"): if (strcmp(name, "LYD") == 0) return CurrencyLYD; break;
+            case PlayFabJsonReader::Hash("MAD"): if (strcmp(name, "MAD") == 0) return CurrencyMAD; break;
+            case PlayFabJsonReader::Hash("MDL"): if (strcmp(name, "MDL") == 0) return CurrencyMDL; break;
+            case PlayFabJsonReader::Hash("MGA"): if (strcmp(name, "MGA") == 0) return CurrencyMGA; break;
+            case PlayFabJsonReader::Hash("MKD"): if (strcmp(name, "MKD") == 0) return CurrencyMKD; break;
+            case PlayFabJsonReader::Hash("MMK"): if (strcmp(name, "MMK") == 0) return CurrencyMMK; break;
+            case PlayFabJsonReader::Hash("MNT"): if (strcmp(name, "MNT") == 0) return CurrencyMNT; break;
+            case PlayFabJsonReader::Hash("MOP"): if (strcmp(name, "MOP") == 0) return CurrencyMOP; break;
+            case PlayFabJsonReader::Hash("MRO"): if (strcmp(name, "MRO") == 0) return CurrencyMRO; break;
+            case PlayFabJsonReader::Hash("MUR"): if (strcmp(name, "MUR") == 0) return CurrencyMUR; break;
+            case PlayFabJsonReader::Hash("MVR"): if (strcmp(name, "MVR") == 0) return CurrencyMVR; break;
+            case PlayFabJsonReader::Hash("MWK"): if (strcmp(name, "MWK") == 0) return CurrencyMWK; break;
+            case PlayFabJsonReader::Hash("MXN"): if (strcmp(name, "MXN") == 0) return CurrencyMXN; break;
+            case PlayFabJsonReader::Hash("MYR"): if (strcmp(name, "MYR") == 0) return CurrencyMYR; break;
+            case PlayFabJsonReader::Hash("MZN"): if (strcmp(name, "MZN") == 0) return CurrencyMZN; break;
+            case PlayFabJsonReader::Hash("NAD"): if (strcmp(name, "NAD") == 0) return CurrencyNAD; break;
+            case PlayFabJsonReader::Hash("NGN"): if (strcmp(name, "NGN") == 0) return CurrencyNGN; break;
+            case PlayFabJsonReader::Hash("NIO"): if (strcmp(name, "NIO") == 0) return CurrencyNIO; break;
+            case PlayFabJsonReader::Hash("NOK"): if (strcmp(name, "NOK") == 0) return CurrencyNOK; break;
+            case PlayFabJsonReader::Hash("NPR"): if (strcmp(name, "NPR") == 0) return CurrencyNPR; break;
+            case PlayFabJsonReader::Hash("NZD"): if (strcmp(name, "NZD") == 0) return CurrencyNZD; break;
+            case PlayFabJsonReader::Hash("OMR"): if (strcmp(name, "OMR") == 0) return CurrencyOMR; break;
+            case PlayFabJsonReader::Hash("PAB"): if (strcmp(name, "PAB") == 0) return CurrencyPAB; break;
+            case PlayFabJsonReader::Hash("PEN"): if (strcmp(name, "PEN") == 0) return CurrencyPEN; break;
+            case PlayFabJsonReader::Hash("PGK"): if (strcmp(name, "PGK") == 0) return CurrencyPGK; break;
+            case PlayFabJsonReader::Hash("PHP"): if (strcmp(name, "PHP") == 0) return CurrencyPHP; break;
+            case PlayFabJsonReader::Hash("PKR"): if (strcmp(name, "PKR") == 0) return CurrencyPKR; break;
+            case PlayFabJsonReader::Hash("PLN"): if (strcmp(name, "PLN") == 0) return CurrencyPLN; break;
+            case PlayFabJsonReader::Hash("PYG"): if (strcmp(name, "PYG") == 0) return CurrencyPYG; break;
+            case PlayFabJsonReader::Hash("QAR"): if (strcmp(name, "QAR") == 0) return CurrencyQAR; break;
+            case PlayFabJsonReader::Hash("RON"): if (strcmp(name, "RON") == 0) return CurrencyRON; break;
+            case PlayFabJsonReader::Hash("RSD"): if (strcmp(name, "RSD") == 0) return CurrencyRSD; break;
+            case PlayFabJsonReader::Hash("RUB"): if (strcmp(name, "RUB") == 0) return CurrencyRUB; break;
+            case PlayFabJsonReader::Hash("RWF"): if (strcmp(name, "RWF") == 0) return CurrencyRWF; break;
+            case PlayFabJsonReader::Hash("SAR"): if (strcmp(name, "SAR") == 0) return CurrencySAR; break;
+            case PlayFabJsonReader::Hash("SBD"): if (strcmp(name, "SBD") == 0) return CurrencySBD; break;
+            case PlayFabJsonReader::Hash("SCR"): if (strcmp(name, "SCR") == 0) return CurrencySCR; break;
+            case PlayFabJsonReader::Hash("SDG"): if (strcmp(name, "SDG") == 0) return CurrencySDG; break;
+            case PlayFabJsonReader::Hash("SEK"): if (strcmp(name, "SEK") == 0) return CurrencySEK; break;
+            case PlayFabJsonReader::Hash("SGD"): if (strcmp(name, "SGD") == 0) return CurrencySGD; break;
+            case PlayFabJsonReader::Hash("SHP"): if (strcmp(name, "SHP") == 0) return CurrencySHP; break;
+            case PlayFabJsonReader::Hash("SLL"): if (strcmp(name, "SLL") == 0) return CurrencySLL; break;
+            case PlayFabJsonReader::Hash("SOS"): if (strcmp(name, "SOS") == 0) return CurrencySOS; break;
+            case PlayFabJsonReader::Hash("SPL"): if (strcmp(name, "SPL") == 0) return CurrencySPL; break;
+            case PlayFabJsonReader::Hash("SRD"): if (strcmp(name, "SRD") == 0) return CurrencySRD; break;
+            case PlayFabJsonReader::Hash("STD"): if (strcmp(name, "STD") == 0) return CurrencySTD; break;
+            case PlayFabJsonReader::Hash("SVC"): if (strcmp(name, "SVC") == 0) return CurrencySVC; break;
+            case PlayFabJsonReader::Hash("SYP"): if (strcmp(name, "SYP") == 0) return CurrencySYP; break;
+            case PlayFabJsonReader::Hash("SZL"): if (strcmp(name, "SZL") == 0) return CurrencySZL; break;
+            case PlayFabJsonReader::Hash("THB"): if (strcmp(name, "THB") == 0) return CurrencyTHB; break;
+            case PlayFabJsonReader::Hash("TJS"): if (strcmp(name, "TJS") == 0) return CurrencyTJS; break;
+            case PlayFabJsonReader::Hash("TMT"): if (strcmp(name, "TMT") == 0) return CurrencyTMT; break;
+            case PlayFabJsonReader::Hash("TND"): if (strcmp(name, "TND") == 0) return CurrencyTND; break;
+            case PlayFabJsonReader::Hash("TOP"): if (strcmp(name, "TOP") == 0) return CurrencyTOP; break;
+            case PlayFabJsonReader::Hash("TRY"): if (strcmp(name, "TRY") == 0) return CurrencyTRY; break;
+            case PlayFabJsonReader::Hash("TTD"): if (strcmp(name, "TTD") == 0) return CurrencyTTD; break;
+            case PlayFabJsonReader::Hash("TVD"): if (strcmp(name, "TVD") == 0) return CurrencyTVD; break;
+            case PlayFabJsonReader::Hash("TWD"): if (strcmp(name, "TWD") == 0) return CurrencyTWD; break;
+            case PlayFabJsonReader::Hash("TZS"): if (strcmp(name, "TZS") == 0) return CurrencyTZS; break;
+            case PlayFabJsonReader::Hash("UAH"): if (strcmp(name, "UAH") == 0) return CurrencyUAH; break;
+            case PlayFabJsonReader::Hash("UGX"): if (strcmp(name, "UGX") == 0) return CurrencyUGX; break;
+            case PlayFabJsonReader::Hash("USD"): if (strcmp(name, "USD") == 0) return CurrencyUSD; break;
+            case PlayFabJsonReader::Hash("UYU"): if (strcmp(name, "UYU") == 0) return CurrencyUYU; break;
+            case PlayFabJsonReader::Hash("UZS"): if (strcmp(name, "UZS") == 0) return CurrencyUZS; break;
+            case PlayFabJsonReader::Hash("VEF"): if (strcmp(name, "VEF") == 0) return CurrencyVEF; break;
+            case PlayFabJsonReader::Hash("VND"): if (strcmp(name, "VND") == 0) return CurrencyVND; break;
+            case PlayFabJsonReader::Hash("VUV"): if (strcmp(name, "VUV") == 0) return CurrencyVUV; break;
+            case PlayFabJsonReader::Hash("WST"): if (strcmp(name, "WST") == 0) return CurrencyWST; break;
+            case PlayFabJsonReader::Hash("XAF"): if (strcmp(name, "XAF") == 0) return CurrencyXAF; break;
+            case PlayFabJsonReader::Hash("XCD"): if (strcmp(name, "XCD") == 0) return CurrencyXCD; break;
+            case PlayFabJsonReader::Hash("XDR"): if (strcmp(name, "XDR") == 0) return CurrencyXDR; break;
+            case PlayFabJsonReader::Hash("XOF"): if (strcmp(name, "XOF") == 0) return CurrencyXOF; break;
+            case PlayFabJsonReader::Hash("XPF"): if (strcmp(name, "XPF") == 0) return CurrencyXPF; break;
+            case PlayFabJsonReader::Hash("YER"): if (strcmp(name, "YER") == 0) return CurrencyYER; break;
+            case PlayFabJsonReader::Hash("ZAR"): if (strcmp(name, "ZAR") == 0) return CurrencyZAR; break;
+            case PlayFabJsonReader::Hash("ZMW"): if (strcmp(name, "ZMW") == 0) return CurrencyZMW; break;
+            case PlayFabJsonReader::Hash("ZWD"): if (strcmp(name, "ZWD") == 0) return CurrencyZWD; break;
+            }
 
             return CurrencyAED; // Basically critical fail
         }
@@ -4503,6 +6665,14 @@ namespace PlayFabComboSdk
                 Key(src.Key)
             {}
 
+            DeleteContentRequest(DeleteContentRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key))
+            {}
+
+            DeleteContentRequest& operator=(const DeleteContentRequest& src) = default;
+            DeleteContentRequest& operator=(DeleteContentRequest&& src) = default;
+
             DeleteContentRequest(const rapidjson::Value& obj) : DeleteContentRequest()
             {
                 readFromValue(obj);
@@ -4527,6 +6697,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeletePlayerRequest : public PlayFabBaseModel
@@ -4543,6 +6736,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            DeletePlayerRequest(DeletePlayerRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            DeletePlayerRequest& operator=(const DeletePlayerRequest& src) = default;
+            DeletePlayerRequest& operator=(DeletePlayerRequest&& src) = default;
+
             DeletePlayerRequest(const rapidjson::Value& obj) : DeletePlayerRequest()
             {
                 readFromValue(obj);
@@ -4567,6 +6768,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeletePlayerResult : public PlayFabBaseModel
@@ -4580,6 +6804,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeletePlayerResult(DeletePlayerResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeletePlayerResult& operator=(const DeletePlayerResult& src) = default;
+            DeletePlayerResult& operator=(DeletePlayerResult&& src) = default;
+
             DeletePlayerResult(const rapidjson::Value& obj) : DeletePlayerResult()
             {
                 readFromValue(obj);
@@ -4600,6 +6831,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct DeletePlayerSharedSecretRequest : public PlayFabBaseModel
@@ -4616,6 +6853,14 @@ namespace PlayFabComboSdk
                 SecretKey(src.SecretKey)
             {}
 
+            DeletePlayerSharedSecretRequest(DeletePlayerSharedSecretRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SecretKey(AZStd::move(src.SecretKey))
+            {}
+
+            DeletePlayerSharedSecretRequest& operator=(const DeletePlayerSharedSecretRequest& src) = default;
+            DeletePlayerSharedSecretRequest& operator=(DeletePlayerSharedSecretRequest&& src) = default;
+
             DeletePlayerSharedSecretRequest(const rapidjson::Value& obj) : DeletePlayerSharedSecretRequest()
             {
                 readFromValue(obj);
@@ -4642,6 +6887,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecretKey"):
+                            if (strcmp(member, "SecretKey") != 0)
+                                break;
+                            SecretKey = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeletePlayerSharedSecretResult : public PlayFabBaseModel
@@ -4655,6 +6923,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeletePlayerSharedSecretResult(DeletePlayerSharedSecretResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeletePlayerSharedSecretResult& operator=(const DeletePlayerSharedSecretResult& src) = default;
+            DeletePlayerSharedSecretResult& operator=(DeletePlayerSharedSecretResult&& src) = default;
+
             DeletePlayerSharedSecretResult(const rapidjson::Value& obj) : DeletePlayerSharedSecretResult()
             {
                 readFromValue(obj);
@@ -4675,6 +6950,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct DeleteStoreRequest : public PlayFabBaseModel
@@ -4694,6 +6975,15 @@ namespace PlayFabComboSdk
                 StoreId(src.StoreId)
             {}
 
+            DeleteStoreRequest(DeleteStoreRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                StoreId(AZStd::move(src.StoreId))
+            {}
+
+            DeleteStoreRequest& operator=(const DeleteStoreRequest& src) = default;
+            DeleteStoreRequest& operator=(DeleteStoreRequest&& src) = default;
+
             DeleteStoreRequest(const rapidjson::Value& obj) : DeleteStoreRequest()
             {
                 readFromValue(obj);
@@ -4724,6 +7014,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StoreId"):
+                            if (strcmp(member, "StoreId") != 0)
+                                break;
+                            StoreId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteStoreResult : public PlayFabBaseModel
@@ -4737,6 +7055,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeleteStoreResult(DeleteStoreResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeleteStoreResult& operator=(const DeleteStoreResult& src) = default;
+            DeleteStoreResult& operator=(DeleteStoreResult&& src) = default;
+
             DeleteStoreResult(const rapidjson::Value& obj) : DeleteStoreResult()
             {
                 readFromValue(obj);
@@ -4757,6 +7082,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct DeleteTaskRequest : public PlayFabBaseModel
@@ -4773,6 +7104,31 @@ namespace PlayFabComboSdk
                 Identifier(src.Identifier ? new NameIdentifier(*src.Identifier) : nullptr)
             {}
 
+            DeleteTaskRequest(DeleteTaskRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Identifier(src.Identifier)
+            {
+                src.Identifier = nullptr;
+            }
+
+            DeleteTaskRequest& operator=(const DeleteTaskRequest& src)
+            {
+                if (this != &src)
+                    *this = DeleteTaskRequest(src);
+                return *this;
+            }
+
+            DeleteTaskRequest& operator=(DeleteTaskRequest&& src)
+            {
+                if (this != &src)
+                {
+                    if (Identifier != nullptr) delete Identifier;
+                    Identifier = src.Identifier;
+                    src.Identifier = nullptr;
+                }
+                return *this;
+            }
+
             DeleteTaskRequest(const rapidjson::Value& obj) : DeleteTaskRequest()
             {
                 readFromValue(obj);
@@ -4800,11 +7156,35 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Identifier"):
+                            if (strcmp(member, "Identifier") != 0)
+                                break;
+                            Identifier = new NameIdentifier;
+                            Identifier->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteUsersRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> PlayFabIds;
+            std::vector<AZStd::string> PlayFabIds;
             AZStd::string TitleId;
 
             DeleteUsersRequest() :
@@ -4819,6 +7199,15 @@ namespace PlayFabComboSdk
                 TitleId(src.TitleId)
             {}
 
+            DeleteUsersRequest(DeleteUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabIds(AZStd::move(src.PlayFabIds)),
+                TitleId(AZStd::move(src.TitleId))
+            {}
+
+            DeleteUsersRequest& operator=(const DeleteUsersRequest& src) = default;
+            DeleteUsersRequest& operator=(DeleteUsersRequest&& src) = default;
+
             DeleteUsersRequest(const rapidjson::Value& obj) : DeleteUsersRequest()
             {
                 readFromValue(obj);
@@ -4833,7 +7222,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("PlayFabIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -4847,8 +7236,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayFabIds_member = obj.FindMember("PlayFabIds");
                 if (PlayFabIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayFabIds_member->value;
+                    PlayFabIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayFabIds.push_back(memberList[i].GetString());
+                        PlayFabIds.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator TitleId_member = obj.FindMember("TitleId");
@@ -4856,6 +7246,41 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabIds"):
+                            if (strcmp(member, "PlayFabIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayFabIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayFabIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteUsersResult : public PlayFabBaseModel
@@ -4869,6 +7294,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeleteUsersResult(DeleteUsersResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeleteUsersResult& operator=(const DeleteUsersResult& src) = default;
+            DeleteUsersResult& operator=(DeleteUsersResult&& src) = default;
+
             DeleteUsersResult(const rapidjson::Value& obj) : DeleteUsersResult()
             {
                 readFromValue(obj);
@@ -4889,6 +7321,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         enum EffectType
@@ -4913,19 +7351,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<EffectType>(obj.GetInt());
 
-            static std::map<const char *, EffectType, PlayFabComboSdk::StringCompare> _EffectTypeMap;
-            if (_EffectTypeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _EffectTypeMap["Allow"] = EffectTypeAllow;
-                _EffectTypeMap["Deny"] = EffectTypeDeny;
-
+            case PlayFabJsonReader::Hash("Allow"): if (strcmp(name, "Allow") == 0) return EffectTypeAllow; break;
+            case PlayFabJsonReader::Hash("Deny"): if (strcmp(name, "Deny") == 0) return EffectTypeDeny; break;
             }
 
-            auto output = _EffectTypeMap.find(obj.GetString());
-            if (output != _EffectTypeMap.end())
-                return output->second;
-
             return EffectTypeAllow; // Basically critical fail
         }
 
@@ -4940,8 +7373,15 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
-            EmptyResult(const rapidjson::Value& obj) : EmptyResult()
-            {
+            EmptyResult(EmptyResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            EmptyResult& operator=(const EmptyResult& src) = default;
+            EmptyResult& operator=(EmptyResult&& src) = default;
+
+            EmptyResult(const rapidjson::Value& obj) : EmptyResult()
+            {
                 readFromValue(obj);
             }
 
@@ -4960,6 +7400,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GameModeInfo : public PlayFabBaseModel
@@ -4985,6 +7431,17 @@ namespace PlayFabComboSdk
                 StartOpen(src.StartOpen)
             {}
 
+            GameModeInfo(GameModeInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                Gamemode(AZStd::move(src.Gamemode)),
+                MinPlayerCount(AZStd::move(src.MinPlayerCount)),
+                MaxPlayerCount(AZStd::move(src.MaxPlayerCount)),
+                StartOpen(AZStd::move(src.StartOpen))
+            {}
+
+            GameModeInfo& operator=(const GameModeInfo& src) = default;
+            GameModeInfo& operator=(GameModeInfo&& src) = default;
+
             GameModeInfo(const rapidjson::Value& obj) : GameModeInfo()
             {
                 readFromValue(obj);
@@ -5023,6 +7480,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Gamemode"):
+                            if (strcmp(member, "Gamemode") != 0)
+                                break;
+                            Gamemode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinPlayerCount"):
+                            if (strcmp(member, "MinPlayerCount") != 0)
+                                break;
+                            MinPlayerCount = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxPlayerCount"):
+                            if (strcmp(member, "MaxPlayerCount") != 0)
+                                break;
+                            MaxPlayerCount = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("StartOpen"):
+                            if (strcmp(member, "StartOpen") != 0)
+                                break;
+                            StartOpen = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetActionGroupResult : public PlayFabBaseModel
@@ -5042,6 +7537,15 @@ namespace PlayFabComboSdk
                 Id(src.Id)
             {}
 
+            GetActionGroupResult(GetActionGroupResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Id(AZStd::move(src.Id))
+            {}
+
+            GetActionGroupResult& operator=(const GetActionGroupResult& src) = default;
+            GetActionGroupResult& operator=(GetActionGroupResult&& src) = default;
+
             GetActionGroupResult(const rapidjson::Value& obj) : GetActionGroupResult()
             {
                 readFromValue(obj);
@@ -5072,6 +7576,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetActionsOnPlayersInSegmentTaskInstanceResult : public PlayFabBaseModel
@@ -5091,6 +7623,36 @@ namespace PlayFabComboSdk
                 Parameter(src.Parameter ? new ActionsOnPlayersInSegmentTaskParameter(*src.Parameter) : nullptr)
             {}
 
+            GetActionsOnPlayersInSegmentTaskInstanceResult(GetActionsOnPlayersInSegmentTaskInstanceResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Summary(src.Summary),
+                Parameter(src.Parameter)
+            {
+                src.Summary = nullptr;
+                src.Parameter = nullptr;
+            }
+
+            GetActionsOnPlayersInSegmentTaskInstanceResult& operator=(const GetActionsOnPlayersInSegmentTaskInstanceResult& src)
+            {
+                if (this != &src)
+                    *this = GetActionsOnPlayersInSegmentTaskInstanceResult(src);
+                return *this;
+            }
+
+            GetActionsOnPlayersInSegmentTaskInstanceResult& operator=(GetActionsOnPlayersInSegmentTaskInstanceResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (Summary != nullptr) delete Summary;
+                    Summary = src.Summary;
+                    src.Summary = nullptr;
+                    if (Parameter != nullptr) delete Parameter;
+                    Parameter = src.Parameter;
+                    src.Parameter = nullptr;
+                }
+                return *this;
+            }
+
             GetActionsOnPlayersInSegmentTaskInstanceResult(const rapidjson::Value& obj) : GetActionsOnPlayersInSegmentTaskInstanceResult()
             {
                 readFromValue(obj);
@@ -5125,6 +7687,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Summary"):
+                            if (strcmp(member, "Summary") != 0)
+                                break;
+                            Summary = new ActionsOnPlayersInSegmentTaskSummary;
+                            Summary->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Parameter"):
+                            if (strcmp(member, "Parameter") != 0)
+                                break;
+                            Parameter = new ActionsOnPlayersInSegmentTaskParameter;
+                            Parameter->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetAllActionGroupsRequest : public PlayFabBaseModel
@@ -5138,6 +7730,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetAllActionGroupsRequest(GetAllActionGroupsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetAllActionGroupsRequest& operator=(const GetAllActionGroupsRequest& src) = default;
+            GetAllActionGroupsRequest& operator=(GetAllActionGroupsRequest&& src) = default;
+
             GetAllActionGroupsRequest(const rapidjson::Value& obj) : GetAllActionGroupsRequest()
             {
                 readFromValue(obj);
@@ -5158,11 +7757,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetAllActionGroupsResult : public PlayFabBaseModel
         {
-            std::list<GetActionGroupResult> ActionGroups;
+            std::vector<GetActionGroupResult> ActionGroups;
 
             GetAllActionGroupsResult() :
                 PlayFabBaseModel(),
@@ -5174,6 +7779,14 @@ namespace PlayFabComboSdk
                 ActionGroups(src.ActionGroups)
             {}
 
+            GetAllActionGroupsResult(GetAllActionGroupsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ActionGroups(AZStd::move(src.ActionGroups))
+            {}
+
+            GetAllActionGroupsResult& operator=(const GetAllActionGroupsResult& src) = default;
+            GetAllActionGroupsResult& operator=(GetAllActionGroupsResult&& src) = default;
+
             GetAllActionGroupsResult(const rapidjson::Value& obj) : GetAllActionGroupsResult()
             {
                 readFromValue(obj);
@@ -5188,7 +7801,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("ActionGroups");
                 writer.StartArray();
-                for (std::list<GetActionGroupResult>::iterator iter = ActionGroups.begin(); iter != ActionGroups.end(); iter++) {
+                for (std::vector<GetActionGroupResult>::iterator iter = ActionGroups.begin(); iter != ActionGroups.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -5200,13 +7813,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActionGroups_member = obj.FindMember("ActionGroups");
                 if (ActionGroups_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActionGroups_member->value;
+                    ActionGroups.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ActionGroups.push_back(GetActionGroupResult(memberList[i]));
+                        ActionGroups.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ActionGroups"):
+                            if (strcmp(member, "ActionGroups") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActionGroups.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActionGroups.emplace_back();
+                                    ActionGroups.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetAllSegmentsRequest : public PlayFabBaseModel
@@ -5220,6 +7865,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetAllSegmentsRequest(GetAllSegmentsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetAllSegmentsRequest& operator=(const GetAllSegmentsRequest& src) = default;
+            GetAllSegmentsRequest& operator=(GetAllSegmentsRequest&& src) = default;
+
             GetAllSegmentsRequest(const rapidjson::Value& obj) : GetAllSegmentsRequest()
             {
                 readFromValue(obj);
@@ -5240,6 +7892,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetSegmentResult : public PlayFabBaseModel
@@ -5262,6 +7920,16 @@ namespace PlayFabComboSdk
                 ABTestParent(src.ABTestParent)
             {}
 
+            GetSegmentResult(GetSegmentResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Id(AZStd::move(src.Id)),
+                Name(AZStd::move(src.Name)),
+                ABTestParent(AZStd::move(src.ABTestParent))
+            {}
+
+            GetSegmentResult& operator=(const GetSegmentResult& src) = default;
+            GetSegmentResult& operator=(GetSegmentResult&& src) = default;
+
             GetSegmentResult(const rapidjson::Value& obj) : GetSegmentResult()
             {
                 readFromValue(obj);
@@ -5298,11 +7966,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ABTestParent"):
+                            if (strcmp(member, "ABTestParent") != 0)
+                                break;
+                            ABTestParent = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetAllSegmentsResult : public PlayFabBaseModel
         {
-            std::list<GetSegmentResult> Segments;
+            std::vector<GetSegmentResult> Segments;
 
             GetAllSegmentsResult() :
                 PlayFabBaseModel(),
@@ -5314,6 +8015,14 @@ namespace PlayFabComboSdk
                 Segments(src.Segments)
             {}
 
+            GetAllSegmentsResult(GetAllSegmentsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Segments(AZStd::move(src.Segments))
+            {}
+
+            GetAllSegmentsResult& operator=(const GetAllSegmentsResult& src) = default;
+            GetAllSegmentsResult& operator=(GetAllSegmentsResult&& src) = default;
+
             GetAllSegmentsResult(const rapidjson::Value& obj) : GetAllSegmentsResult()
             {
                 readFromValue(obj);
@@ -5329,7 +8038,7 @@ namespace PlayFabComboSdk
                 if (!Segments.empty()) {
                     writer.String("Segments");
                     writer.StartArray();
-                    for (std::list<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
+                    for (std::vector<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -5342,13 +8051,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Segments_member = obj.FindMember("Segments");
                 if (Segments_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Segments_member->value;
+                    Segments.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Segments.push_back(GetSegmentResult(memberList[i]));
+                        Segments.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Segments"):
+                            if (strcmp(member, "Segments") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Segments.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Segments.emplace_back();
+                                    Segments.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCatalogItemsRequest : public PlayFabBaseModel
@@ -5365,6 +8106,14 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            GetCatalogItemsRequest(GetCatalogItemsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            GetCatalogItemsRequest& operator=(const GetCatalogItemsRequest& src) = default;
+            GetCatalogItemsRequest& operator=(GetCatalogItemsRequest&& src) = default;
+
             GetCatalogItemsRequest(const rapidjson::Value& obj) : GetCatalogItemsRequest()
             {
                 readFromValue(obj);
@@ -5391,11 +8140,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCatalogItemsResult : public PlayFabBaseModel
         {
-            std::list<CatalogItem> Catalog;
+            std::vector<CatalogItem> Catalog;
 
             GetCatalogItemsResult() :
                 PlayFabBaseModel(),
@@ -5407,6 +8179,14 @@ namespace PlayFabComboSdk
                 Catalog(src.Catalog)
             {}
 
+            GetCatalogItemsResult(GetCatalogItemsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Catalog(AZStd::move(src.Catalog))
+            {}
+
+            GetCatalogItemsResult& operator=(const GetCatalogItemsResult& src) = default;
+            GetCatalogItemsResult& operator=(GetCatalogItemsResult&& src) = default;
+
             GetCatalogItemsResult(const rapidjson::Value& obj) : GetCatalogItemsResult()
             {
                 readFromValue(obj);
@@ -5422,7 +8202,7 @@ namespace PlayFabComboSdk
                 if (!Catalog.empty()) {
                     writer.String("Catalog");
                     writer.StartArray();
-                    for (std::list<CatalogItem>::iterator iter = Catalog.begin(); iter != Catalog.end(); iter++) {
+                    for (std::vector<CatalogItem>::iterator iter = Catalog.begin(); iter != Catalog.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -5435,13 +8215,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Catalog_member = obj.FindMember("Catalog");
                 if (Catalog_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Catalog_member->value;
+                    Catalog.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Catalog.push_back(CatalogItem(memberList[i]));
+                        Catalog.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Catalog"):
+                            if (strcmp(member, "Catalog") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Catalog.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Catalog.emplace_back();
+                                    Catalog.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCloudScriptRevisionRequest : public PlayFabBaseModel
@@ -5461,6 +8273,15 @@ namespace PlayFabComboSdk
                 Revision(src.Revision)
             {}
 
+            GetCloudScriptRevisionRequest(GetCloudScriptRevisionRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Version(AZStd::move(src.Version)),
+                Revision(AZStd::move(src.Revision))
+            {}
+
+            GetCloudScriptRevisionRequest& operator=(const GetCloudScriptRevisionRequest& src) = default;
+            GetCloudScriptRevisionRequest& operator=(GetCloudScriptRevisionRequest&& src) = default;
+
             GetCloudScriptRevisionRequest(const rapidjson::Value& obj) : GetCloudScriptRevisionRequest()
             {
                 readFromValue(obj);
@@ -5493,6 +8314,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Revision"):
+                            if (strcmp(member, "Revision") != 0)
+                                break;
+                            Revision = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCloudScriptRevisionResult : public PlayFabBaseModel
@@ -5500,7 +8349,7 @@ namespace PlayFabComboSdk
             Int32 Version;
             Int32 Revision;
             time_t CreatedAt;
-            std::list<CloudScriptFile> Files;
+            std::vector<CloudScriptFile> Files;
             bool IsPublished;
 
             GetCloudScriptRevisionResult() :
@@ -5521,6 +8370,18 @@ namespace PlayFabComboSdk
                 IsPublished(src.IsPublished)
             {}
 
+            GetCloudScriptRevisionResult(GetCloudScriptRevisionResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Version(AZStd::move(src.Version)),
+                Revision(AZStd::move(src.Revision)),
+                CreatedAt(AZStd::move(src.CreatedAt)),
+                Files(AZStd::move(src.Files)),
+                IsPublished(AZStd::move(src.IsPublished))
+            {}
+
+            GetCloudScriptRevisionResult& operator=(const GetCloudScriptRevisionResult& src) = default;
+            GetCloudScriptRevisionResult& operator=(GetCloudScriptRevisionResult&& src) = default;
+
             GetCloudScriptRevisionResult(const rapidjson::Value& obj) : GetCloudScriptRevisionResult()
             {
                 readFromValue(obj);
@@ -5542,7 +8403,7 @@ namespace PlayFabComboSdk
                 if (!Files.empty()) {
                     writer.String("Files");
                     writer.StartArray();
-                    for (std::list<CloudScriptFile>::iterator iter = Files.begin(); iter != Files.end(); iter++) {
+                    for (std::vector<CloudScriptFile>::iterator iter = Files.begin(); iter != Files.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -5563,8 +8424,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Files_member = obj.FindMember("Files");
                 if (Files_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Files_member->value;
+                    Files.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Files.push_back(CloudScriptFile(memberList[i]));
+                        Files.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator IsPublished_member = obj.FindMember("IsPublished");
@@ -5572,6 +8434,57 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Revision"):
+                            if (strcmp(member, "Revision") != 0)
+                                break;
+                            Revision = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("CreatedAt"):
+                            if (strcmp(member, "CreatedAt") != 0)
+                                break;
+                            CreatedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Files"):
+                            if (strcmp(member, "Files") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Files.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Files.emplace_back();
+                                    Files.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("IsPublished"):
+                            if (strcmp(member, "IsPublished") != 0)
+                                break;
+                            IsPublished = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCloudScriptTaskInstanceResult : public PlayFabBaseModel
@@ -5591,6 +8504,36 @@ namespace PlayFabComboSdk
                 Parameter(src.Parameter ? new CloudScriptTaskParameter(*src.Parameter) : nullptr)
             {}
 
+            GetCloudScriptTaskInstanceResult(GetCloudScriptTaskInstanceResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Summary(src.Summary),
+                Parameter(src.Parameter)
+            {
+                src.Summary = nullptr;
+                src.Parameter = nullptr;
+            }
+
+            GetCloudScriptTaskInstanceResult& operator=(const GetCloudScriptTaskInstanceResult& src)
+            {
+                if (this != &src)
+                    *this = GetCloudScriptTaskInstanceResult(src);
+                return *this;
+            }
+
+            GetCloudScriptTaskInstanceResult& operator=(GetCloudScriptTaskInstanceResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (Summary != nullptr) delete Summary;
+                    Summary = src.Summary;
+                    src.Summary = nullptr;
+                    if (Parameter != nullptr) delete Parameter;
+                    Parameter = src.Parameter;
+                    src.Parameter = nullptr;
+                }
+                return *this;
+            }
+
             GetCloudScriptTaskInstanceResult(const rapidjson::Value& obj) : GetCloudScriptTaskInstanceResult()
             {
                 readFromValue(obj);
@@ -5625,6 +8568,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Summary"):
+                            if (strcmp(member, "Summary") != 0)
+                                break;
+                            Summary = new CloudScriptTaskSummary;
+                            Summary->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Parameter"):
+                            if (strcmp(member, "Parameter") != 0)
+                                break;
+                            Parameter = new CloudScriptTaskParameter;
+                            Parameter->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCloudScriptVersionsRequest : public PlayFabBaseModel
@@ -5638,6 +8611,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetCloudScriptVersionsRequest(GetCloudScriptVersionsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetCloudScriptVersionsRequest& operator=(const GetCloudScriptVersionsRequest& src) = default;
+            GetCloudScriptVersionsRequest& operator=(GetCloudScriptVersionsRequest&& src) = default;
+
             GetCloudScriptVersionsRequest(const rapidjson::Value& obj) : GetCloudScriptVersionsRequest()
             {
                 readFromValue(obj);
@@ -5658,11 +8638,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetCloudScriptVersionsResult : public PlayFabBaseModel
         {
-            std::list<CloudScriptVersionStatus> Versions;
+            std::vector<CloudScriptVersionStatus> Versions;
 
             GetCloudScriptVersionsResult() :
                 PlayFabBaseModel(),
@@ -5674,6 +8660,14 @@ namespace PlayFabComboSdk
                 Versions(src.Versions)
             {}
 
+            GetCloudScriptVersionsResult(GetCloudScriptVersionsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Versions(AZStd::move(src.Versions))
+            {}
+
+            GetCloudScriptVersionsResult& operator=(const GetCloudScriptVersionsResult& src) = default;
+            GetCloudScriptVersionsResult& operator=(GetCloudScriptVersionsResult&& src) = default;
+
             GetCloudScriptVersionsResult(const rapidjson::Value& obj) : GetCloudScriptVersionsResult()
             {
                 readFromValue(obj);
@@ -5689,7 +8683,7 @@ namespace PlayFabComboSdk
                 if (!Versions.empty()) {
                     writer.String("Versions");
                     writer.StartArray();
-                    for (std::list<CloudScriptVersionStatus>::iterator iter = Versions.begin(); iter != Versions.end(); iter++) {
+                    for (std::vector<CloudScriptVersionStatus>::iterator iter = Versions.begin(); iter != Versions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -5702,13 +8696,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Versions_member = obj.FindMember("Versions");
                 if (Versions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Versions_member->value;
+                    Versions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Versions.push_back(CloudScriptVersionStatus(memberList[i]));
+                        Versions.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Versions"):
+                            if (strcmp(member, "Versions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Versions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Versions.emplace_back();
+                                    Versions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetContentListRequest : public PlayFabBaseModel
@@ -5725,6 +8751,14 @@ namespace PlayFabComboSdk
                 Prefix(src.Prefix)
             {}
 
+            GetContentListRequest(GetContentListRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Prefix(AZStd::move(src.Prefix))
+            {}
+
+            GetContentListRequest& operator=(const GetContentListRequest& src) = default;
+            GetContentListRequest& operator=(GetContentListRequest&& src) = default;
+
             GetContentListRequest(const rapidjson::Value& obj) : GetContentListRequest()
             {
                 readFromValue(obj);
@@ -5751,13 +8785,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Prefix"):
+                            if (strcmp(member, "Prefix") != 0)
+                                break;
+                            Prefix = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetContentListResult : public PlayFabBaseModel
         {
             Int32 ItemCount;
             Uint32 TotalSize;
-            std::list<ContentInfo> Contents;
+            std::vector<ContentInfo> Contents;
 
             GetContentListResult() :
                 PlayFabBaseModel(),
@@ -5773,6 +8830,16 @@ namespace PlayFabComboSdk
                 Contents(src.Contents)
             {}
 
+            GetContentListResult(GetContentListResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemCount(AZStd::move(src.ItemCount)),
+                TotalSize(AZStd::move(src.TotalSize)),
+                Contents(AZStd::move(src.Contents))
+            {}
+
+            GetContentListResult& operator=(const GetContentListResult& src) = default;
+            GetContentListResult& operator=(GetContentListResult&& src) = default;
+
             GetContentListResult(const rapidjson::Value& obj) : GetContentListResult()
             {
                 readFromValue(obj);
@@ -5792,7 +8859,7 @@ namespace PlayFabComboSdk
                 if (!Contents.empty()) {
                     writer.String("Contents");
                     writer.StartArray();
-                    for (std::list<ContentInfo>::iterator iter = Contents.begin(); iter != Contents.end(); iter++) {
+                    for (std::vector<ContentInfo>::iterator iter = Contents.begin(); iter != Contents.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -5809,13 +8876,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Contents_member = obj.FindMember("Contents");
                 if (Contents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Contents_member->value;
+                    Contents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Contents.push_back(ContentInfo(memberList[i]));
+                        Contents.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemCount"):
+                            if (strcmp(member, "ItemCount") != 0)
+                                break;
+                            ItemCount = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalSize"):
+                            if (strcmp(member, "TotalSize") != 0)
+                                break;
+                            TotalSize = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("Contents"):
+                            if (strcmp(member, "Contents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Contents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Contents.emplace_back();
+                                    Contents.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetContentUploadUrlRequest : public PlayFabBaseModel
@@ -5835,6 +8944,15 @@ namespace PlayFabComboSdk
                 ContentType(src.ContentType)
             {}
 
+            GetContentUploadUrlRequest(GetContentUploadUrlRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                ContentType(AZStd::move(src.ContentType))
+            {}
+
+            GetContentUploadUrlRequest& operator=(const GetContentUploadUrlRequest& src) = default;
+            GetContentUploadUrlRequest& operator=(GetContentUploadUrlRequest&& src) = default;
+
             GetContentUploadUrlRequest(const rapidjson::Value& obj) : GetContentUploadUrlRequest()
             {
                 readFromValue(obj);
@@ -5865,6 +8983,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContentType"):
+                            if (strcmp(member, "ContentType") != 0)
+                                break;
+                            ContentType = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetContentUploadUrlResult : public PlayFabBaseModel
@@ -5881,6 +9027,14 @@ namespace PlayFabComboSdk
                 URL(src.URL)
             {}
 
+            GetContentUploadUrlResult(GetContentUploadUrlResult&& src) noexcept :
+                PlayFabBaseModel(),
+                URL(AZStd::move(src.URL))
+            {}
+
+            GetContentUploadUrlResult& operator=(const GetContentUploadUrlResult& src) = default;
+            GetContentUploadUrlResult& operator=(GetContentUploadUrlResult&& src) = default;
+
             GetContentUploadUrlResult(const rapidjson::Value& obj) : GetContentUploadUrlResult()
             {
                 readFromValue(obj);
@@ -5907,6 +9061,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("URL"):
+                            if (strcmp(member, "URL") != 0)
+                                break;
+                            URL = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetDataReportRequest : public PlayFabBaseModel
@@ -5932,6 +9109,17 @@ namespace PlayFabComboSdk
                 Day(src.Day)
             {}
 
+            GetDataReportRequest(GetDataReportRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                ReportName(AZStd::move(src.ReportName)),
+                Year(AZStd::move(src.Year)),
+                Month(AZStd::move(src.Month)),
+                Day(AZStd::move(src.Day))
+            {}
+
+            GetDataReportRequest& operator=(const GetDataReportRequest& src) = default;
+            GetDataReportRequest& operator=(GetDataReportRequest&& src) = default;
+
             GetDataReportRequest(const rapidjson::Value& obj) : GetDataReportRequest()
             {
                 readFromValue(obj);
@@ -5968,6 +9156,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ReportName"):
+                            if (strcmp(member, "ReportName") != 0)
+                                break;
+                            ReportName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Year"):
+                            if (strcmp(member, "Year") != 0)
+                                break;
+                            Year = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Month"):
+                            if (strcmp(member, "Month") != 0)
+                                break;
+                            Month = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Day"):
+                            if (strcmp(member, "Day") != 0)
+                                break;
+                            Day = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetDataReportResult : public PlayFabBaseModel
@@ -5984,6 +9210,14 @@ namespace PlayFabComboSdk
                 DownloadUrl(src.DownloadUrl)
             {}
 
+            GetDataReportResult(GetDataReportResult&& src) noexcept :
+                PlayFabBaseModel(),
+                DownloadUrl(AZStd::move(src.DownloadUrl))
+            {}
+
+            GetDataReportResult& operator=(const GetDataReportResult& src) = default;
+            GetDataReportResult& operator=(GetDataReportResult&& src) = default;
+
             GetDataReportResult(const rapidjson::Value& obj) : GetDataReportResult()
             {
                 readFromValue(obj);
@@ -6010,6 +9244,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DownloadUrl"):
+                            if (strcmp(member, "DownloadUrl") != 0)
+                                break;
+                            DownloadUrl = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetMatchmakerGameInfoRequest : public PlayFabBaseModel
@@ -6026,6 +9283,14 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            GetMatchmakerGameInfoRequest(GetMatchmakerGameInfoRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            GetMatchmakerGameInfoRequest& operator=(const GetMatchmakerGameInfoRequest& src) = default;
+            GetMatchmakerGameInfoRequest& operator=(GetMatchmakerGameInfoRequest&& src) = default;
+
             GetMatchmakerGameInfoRequest(const rapidjson::Value& obj) : GetMatchmakerGameInfoRequest()
             {
                 readFromValue(obj);
@@ -6050,6 +9315,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetMatchmakerGameInfoResult : public PlayFabBaseModel
@@ -6061,7 +9349,7 @@ namespace PlayFabComboSdk
             AZStd::string Mode;
             AZStd::string BuildVersion;
             Boxed<Region> pfRegion;
-            std::list<AZStd::string> Players;
+            std::vector<AZStd::string> Players;
             AZStd::string ServerAddress;
             Uint32 ServerPort;
 
@@ -6093,6 +9381,23 @@ namespace PlayFabComboSdk
                 ServerPort(src.ServerPort)
             {}
 
+            GetMatchmakerGameInfoResult(GetMatchmakerGameInfoResult&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                TitleId(AZStd::move(src.TitleId)),
+                StartTime(AZStd::move(src.StartTime)),
+                EndTime(AZStd::move(src.EndTime)),
+                Mode(AZStd::move(src.Mode)),
+                BuildVersion(AZStd::move(src.BuildVersion)),
+                pfRegion(AZStd::move(src.pfRegion)),
+                Players(AZStd::move(src.Players)),
+                ServerAddress(AZStd::move(src.ServerAddress)),
+                ServerPort(AZStd::move(src.ServerPort))
+            {}
+
+            GetMatchmakerGameInfoResult& operator=(const GetMatchmakerGameInfoResult& src) = default;
+            GetMatchmakerGameInfoResult& operator=(GetMatchmakerGameInfoResult&& src) = default;
+
             GetMatchmakerGameInfoResult(const rapidjson::Value& obj) : GetMatchmakerGameInfoResult()
             {
                 readFromValue(obj);
@@ -6134,7 +9439,7 @@ namespace PlayFabComboSdk
                 if (!Players.empty()) {
                     writer.String("Players");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Players.begin(); iter != Players.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Players.begin(); iter != Players.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -6167,8 +9472,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Players_member = obj.FindMember("Players");
                 if (Players_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Players_member->value;
+                    Players.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Players.push_back(memberList[i].GetString());
+                        Players.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator ServerAddress_member = obj.FindMember("ServerAddress");
@@ -6178,6 +9484,81 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StartTime"):
+                            if (strcmp(member, "StartTime") != 0)
+                                break;
+                            StartTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("EndTime"):
+                            if (strcmp(member, "EndTime") != 0)
+                                break;
+                            EndTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Mode"):
+                            if (strcmp(member, "Mode") != 0)
+                                break;
+                            Mode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BuildVersion"):
+                            if (strcmp(member, "BuildVersion") != 0)
+                                break;
+                            BuildVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Region"):
+                            if (strcmp(member, "Region") != 0)
+                                break;
+                            pfRegion = readRegionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Players"):
+                            if (strcmp(member, "Players") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Players.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Players.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerAddress"):
+                            if (strcmp(member, "ServerAddress") != 0)
+                                break;
+                            ServerAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerPort"):
+                            if (strcmp(member, "ServerPort") != 0)
+                                break;
+                            ServerPort = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetMatchmakerGameModesRequest : public PlayFabBaseModel
@@ -6194,6 +9575,14 @@ namespace PlayFabComboSdk
                 BuildVersion(src.BuildVersion)
             {}
 
+            GetMatchmakerGameModesRequest(GetMatchmakerGameModesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildVersion(AZStd::move(src.BuildVersion))
+            {}
+
+            GetMatchmakerGameModesRequest& operator=(const GetMatchmakerGameModesRequest& src) = default;
+            GetMatchmakerGameModesRequest& operator=(GetMatchmakerGameModesRequest&& src) = default;
+
             GetMatchmakerGameModesRequest(const rapidjson::Value& obj) : GetMatchmakerGameModesRequest()
             {
                 readFromValue(obj);
@@ -6218,11 +9607,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildVersion"):
+                            if (strcmp(member, "BuildVersion") != 0)
+                                break;
+                            BuildVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetMatchmakerGameModesResult : public PlayFabBaseModel
         {
-            std::list<GameModeInfo> GameModes;
+            std::vector<GameModeInfo> GameModes;
 
             GetMatchmakerGameModesResult() :
                 PlayFabBaseModel(),
@@ -6234,6 +9646,14 @@ namespace PlayFabComboSdk
                 GameModes(src.GameModes)
             {}
 
+            GetMatchmakerGameModesResult(GetMatchmakerGameModesResult&& src) noexcept :
+                PlayFabBaseModel(),
+                GameModes(AZStd::move(src.GameModes))
+            {}
+
+            GetMatchmakerGameModesResult& operator=(const GetMatchmakerGameModesResult& src) = default;
+            GetMatchmakerGameModesResult& operator=(GetMatchmakerGameModesResult&& src) = default;
+
             GetMatchmakerGameModesResult(const rapidjson::Value& obj) : GetMatchmakerGameModesResult()
             {
                 readFromValue(obj);
@@ -6249,7 +9669,7 @@ namespace PlayFabComboSdk
                 if (!GameModes.empty()) {
                     writer.String("GameModes");
                     writer.StartArray();
-                    for (std::list<GameModeInfo>::iterator iter = GameModes.begin(); iter != GameModes.end(); iter++) {
+                    for (std::vector<GameModeInfo>::iterator iter = GameModes.begin(); iter != GameModes.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6262,18 +9682,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator GameModes_member = obj.FindMember("GameModes");
                 if (GameModes_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = GameModes_member->value;
+                    GameModes.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        GameModes.push_back(GameModeInfo(memberList[i]));
+                        GameModes.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GameModes"):
+                            if (strcmp(member, "GameModes") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                GameModes.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    GameModes.emplace_back();
+                                    GameModes.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerSegmentsResult : public PlayFabBaseModel
         {
-            std::list<GetSegmentResult> Segments;
+            std::vector<GetSegmentResult> Segments;
 
             GetPlayerSegmentsResult() :
                 PlayFabBaseModel(),
@@ -6285,6 +9737,14 @@ namespace PlayFabComboSdk
                 Segments(src.Segments)
             {}
 
+            GetPlayerSegmentsResult(GetPlayerSegmentsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Segments(AZStd::move(src.Segments))
+            {}
+
+            GetPlayerSegmentsResult& operator=(const GetPlayerSegmentsResult& src) = default;
+            GetPlayerSegmentsResult& operator=(GetPlayerSegmentsResult&& src) = default;
+
             GetPlayerSegmentsResult(const rapidjson::Value& obj) : GetPlayerSegmentsResult()
             {
                 readFromValue(obj);
@@ -6300,7 +9760,7 @@ namespace PlayFabComboSdk
                 if (!Segments.empty()) {
                     writer.String("Segments");
                     writer.StartArray();
-                    for (std::list<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
+                    for (std::vector<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6313,17 +9773,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Segments_member = obj.FindMember("Segments");
                 if (Segments_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Segments_member->value;
+                    Segments.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Segments.push_back(GetSegmentResult(memberList[i]));
+                        Segments.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
-        };
-
-        struct GetPlayerSharedSecretsRequest : public PlayFabBaseModel
-        {
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Segments"):
+                            if (strcmp(member, "Segments") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Segments.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Segments.emplace_back();
+                                    Segments.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
+        };
+
+        struct GetPlayerSharedSecretsRequest : public PlayFabBaseModel
+        {
 
             GetPlayerSharedSecretsRequest() :
                 PlayFabBaseModel()
@@ -6333,6 +9825,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetPlayerSharedSecretsRequest(GetPlayerSharedSecretsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetPlayerSharedSecretsRequest& operator=(const GetPlayerSharedSecretsRequest& src) = default;
+            GetPlayerSharedSecretsRequest& operator=(GetPlayerSharedSecretsRequest&& src) = default;
+
             GetPlayerSharedSecretsRequest(const rapidjson::Value& obj) : GetPlayerSharedSecretsRequest()
             {
                 readFromValue(obj);
@@ -6353,6 +9852,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SharedSecret : public PlayFabBaseModel
@@ -6375,6 +9880,16 @@ namespace PlayFabComboSdk
                 Disabled(src.Disabled)
             {}
 
+            SharedSecret(SharedSecret&& src) noexcept :
+                PlayFabBaseModel(),
+                SecretKey(AZStd::move(src.SecretKey)),
+                FriendlyName(AZStd::move(src.FriendlyName)),
+                Disabled(AZStd::move(src.Disabled))
+            {}
+
+            SharedSecret& operator=(const SharedSecret& src) = default;
+            SharedSecret& operator=(SharedSecret&& src) = default;
+
             SharedSecret(const rapidjson::Value& obj) : SharedSecret()
             {
                 readFromValue(obj);
@@ -6411,11 +9926,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecretKey"):
+                            if (strcmp(member, "SecretKey") != 0)
+                                break;
+                            SecretKey = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendlyName"):
+                            if (strcmp(member, "FriendlyName") != 0)
+                                break;
+                            FriendlyName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Disabled"):
+                            if (strcmp(member, "Disabled") != 0)
+                                break;
+                            Disabled = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerSharedSecretsResult : public PlayFabBaseModel
         {
-            std::list<SharedSecret> SharedSecrets;
+            std::vector<SharedSecret> SharedSecrets;
 
             GetPlayerSharedSecretsResult() :
                 PlayFabBaseModel(),
@@ -6427,6 +9975,14 @@ namespace PlayFabComboSdk
                 SharedSecrets(src.SharedSecrets)
             {}
 
+            GetPlayerSharedSecretsResult(GetPlayerSharedSecretsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedSecrets(AZStd::move(src.SharedSecrets))
+            {}
+
+            GetPlayerSharedSecretsResult& operator=(const GetPlayerSharedSecretsResult& src) = default;
+            GetPlayerSharedSecretsResult& operator=(GetPlayerSharedSecretsResult&& src) = default;
+
             GetPlayerSharedSecretsResult(const rapidjson::Value& obj) : GetPlayerSharedSecretsResult()
             {
                 readFromValue(obj);
@@ -6442,7 +9998,7 @@ namespace PlayFabComboSdk
                 if (!SharedSecrets.empty()) {
                     writer.String("SharedSecrets");
                     writer.StartArray();
-                    for (std::list<SharedSecret>::iterator iter = SharedSecrets.begin(); iter != SharedSecrets.end(); iter++) {
+                    for (std::vector<SharedSecret>::iterator iter = SharedSecrets.begin(); iter != SharedSecrets.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6455,13 +10011,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator SharedSecrets_member = obj.FindMember("SharedSecrets");
                 if (SharedSecrets_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = SharedSecrets_member->value;
+                    SharedSecrets.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        SharedSecrets.push_back(SharedSecret(memberList[i]));
+                        SharedSecrets.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedSecrets"):
+                            if (strcmp(member, "SharedSecrets") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                SharedSecrets.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    SharedSecrets.emplace_back();
+                                    SharedSecrets.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayersInSegmentRequest : public PlayFabBaseModel
@@ -6487,6 +10075,17 @@ namespace PlayFabComboSdk
                 ContinuationToken(src.ContinuationToken)
             {}
 
+            GetPlayersInSegmentRequest(GetPlayersInSegmentRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SegmentId(AZStd::move(src.SegmentId)),
+                SecondsToLive(AZStd::move(src.SecondsToLive)),
+                MaxBatchSize(AZStd::move(src.MaxBatchSize)),
+                ContinuationToken(AZStd::move(src.ContinuationToken))
+            {}
+
+            GetPlayersInSegmentRequest& operator=(const GetPlayersInSegmentRequest& src) = default;
+            GetPlayersInSegmentRequest& operator=(GetPlayersInSegmentRequest&& src) = default;
+
             GetPlayersInSegmentRequest(const rapidjson::Value& obj) : GetPlayersInSegmentRequest()
             {
                 readFromValue(obj);
@@ -6529,6 +10128,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SegmentId"):
+                            if (strcmp(member, "SegmentId") != 0)
+                                break;
+                            SegmentId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SecondsToLive"):
+                            if (strcmp(member, "SecondsToLive") != 0)
+                                break;
+                            SecondsToLive = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxBatchSize"):
+                            if (strcmp(member, "MaxBatchSize") != 0)
+                                break;
+                            MaxBatchSize = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContinuationToken"):
+                            if (strcmp(member, "ContinuationToken") != 0)
+                                break;
+                            ContinuationToken = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum LoginIdentityProvider
@@ -6577,31 +10214,26 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<LoginIdentityProvider>(obj.GetInt());
 
-            static std::map<const char *, LoginIdentityProvider, PlayFabComboSdk::StringCompare> _LoginIdentityProviderMap;
-            if (_LoginIdentityProviderMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _LoginIdentityProviderMap["Unknown"] = LoginIdentityProviderUnknown;
-                _LoginIdentityProviderMap["PlayFab"] = LoginIdentityProviderPlayFab;
-                _LoginIdentityProviderMap["Custom"] = LoginIdentityProviderCustom;
-                _LoginIdentityProviderMap["GameCenter"] = LoginIdentityProviderGameCenter;
-                _LoginIdentityProviderMap["GooglePlay"] = LoginIdentityProviderGooglePlay;
-                _LoginIdentityProviderMap["Steam"] = LoginIdentityProviderSteam;
-                _LoginIdentityProviderMap["XBoxLive"] = LoginIdentityProviderXBoxLive;
-                _LoginIdentityProviderMap["PSN"] = LoginIdentityProviderPSN;
-                _LoginIdentityProviderMap["Kongregate"] = LoginIdentityProviderKongregate;
-                _LoginIdentityProviderMap["Facebook"] = LoginIdentityProviderFacebook;
-                _LoginIdentityProviderMap["IOSDevice"] = LoginIdentityProviderIOSDevice;
-                _LoginIdentityProviderMap["AndroidDevice"] = LoginIdentityProviderAndroidDevice;
-                _LoginIdentityProviderMap["Twitch"] = LoginIdentityProviderTwitch;
-                _LoginIdentityProviderMap["WindowsHello"] = LoginIdentityProviderWindowsHello;
-
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("Unknown"): if (strcmp(name, "Unknown") == 0) return LoginIdentityProviderUnknown; break;
+            case PlayFabJsonReader::Hash("PlayFab"): if (strcmp(name, "PlayFab") == 0) return LoginIdentityProviderPlayFab; break;
+            case PlayFabJsonReader::Hash("Custom"): if (strcmp(name, "Custom") == 0) return LoginIdentityProviderCustom; break;
+            case PlayFabJsonReader::Hash("GameCenter"): if (strcmp(name, "GameCenter") == 0) return LoginIdentityProviderGameCenter; break;
+            case PlayFabJsonReader::Hash("GooglePlay"): if (strcmp(name, "GooglePlay") == 0) return LoginIdentityProviderGooglePlay; break;
+            case PlayFabJsonReader::Hash("Steam"): if (strcmp(name, "Steam") == 0) return LoginIdentityProviderSteam; break;
+            case PlayFabJsonReader::Hash("XBoxLive"): if (strcmp(name, "XBoxLive") == 0) return LoginIdentityProviderXBoxLive; break;
+            case PlayFabJsonReader::Hash("PSN"): if (strcmp(name, "PSN") == 0) return LoginIdentityProviderPSN; break;
+            case PlayFabJsonReader::Hash("Kongregate"): if (strcmp(name, "Kongregate") == 0) return LoginIdentityProviderKongregate; break;
+            case PlayFabJsonReader::Hash("Facebook"): if (strcmp(name, "Facebook") == 0) return LoginIdentityProviderFacebook; break;
+            case PlayFabJsonReader::Hash("IOSDevice"): if (strcmp(name, "IOSDevice") == 0) return LoginIdentityProviderIOSDevice; break;
+            case PlayFabJsonReader::Hash("AndroidDevice"): if (strcmp(name, "AndroidDevice") == 0) return LoginIdentityProviderAndroidDevice; break;
+            case PlayFabJsonReader::Hash("Twitch"): if (strcmp(name, "Twitch") == 0) return LoginIdentityProviderTwitch; break;
+            case PlayFabJsonReader::Hash("WindowsHello"): if (strcmp(name, "WindowsHello") == 0) return LoginIdentityProviderWindowsHello; break;
             }
 
-            auto output = _LoginIdentityProviderMap.find(obj.GetString());
-            if (output != _LoginIdentityProviderMap.end())
-                return output->second;
-
             return LoginIdentityProviderUnknown; // Basically critical fail
         }
 
@@ -6631,6 +10263,18 @@ namespace PlayFabComboSdk
                 Longitude(src.Longitude)
             {}
 
+            PlayerLocation(PlayerLocation&& src) noexcept :
+                PlayFabBaseModel(),
+                pfContinentCode(AZStd::move(src.pfContinentCode)),
+                pfCountryCode(AZStd::move(src.pfCountryCode)),
+                City(AZStd::move(src.City)),
+                Latitude(AZStd::move(src.Latitude)),
+                Longitude(AZStd::move(src.Longitude))
+            {}
+
+            PlayerLocation& operator=(const PlayerLocation& src) = default;
+            PlayerLocation& operator=(PlayerLocation&& src) = default;
+
             PlayerLocation(const rapidjson::Value& obj) : PlayerLocation()
             {
                 readFromValue(obj);
@@ -6677,6 +10321,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ContinentCode"):
+                            if (strcmp(member, "ContinentCode") != 0)
+                                break;
+                            pfContinentCode = readContinentCodeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CountryCode"):
+                            if (strcmp(member, "CountryCode") != 0)
+                                break;
+                            pfCountryCode = readCountryCodeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("City"):
+                            if (strcmp(member, "City") != 0)
+                                break;
+                            City = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Latitude"):
+                            if (strcmp(member, "Latitude") != 0)
+                                break;
+                            Latitude = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("Longitude"):
+                            if (strcmp(member, "Longitude") != 0)
+                                break;
+                            Longitude = reader.GetValue().GetDouble();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum PushNotificationPlatform
@@ -6701,19 +10388,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<PushNotificationPlatform>(obj.GetInt());
 
-            static std::map<const char *, PushNotificationPlatform, PlayFabComboSdk::StringCompare> _PushNotificationPlatformMap;
-            if (_PushNotificationPlatformMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _PushNotificationPlatformMap["ApplePushNotificationService"] = PushNotificationPlatformApplePushNotificationService;
-                _PushNotificationPlatformMap["GoogleCloudMessaging"] = PushNotificationPlatformGoogleCloudMessaging;
-
+            case PlayFabJsonReader::Hash("ApplePushNotificationService"): if (strcmp(name, "ApplePushNotificationService") == 0) return PushNotificationPlatformApplePushNotificationService; break;
+            case PlayFabJsonReader::Hash("GoogleCloudMessaging"): if (strcmp(name, "GoogleCloudMessaging") == 0) return PushNotificationPlatformGoogleCloudMessaging; break;
             }
 
-            auto output = _PushNotificationPlatformMap.find(obj.GetString());
-            if (output != _PushNotificationPlatformMap.end())
-                return output->second;
-
             return PushNotificationPlatformApplePushNotificationService; // Basically critical fail
         }
 
@@ -6734,6 +10416,15 @@ namespace PlayFabComboSdk
                 NotificationEndpointARN(src.NotificationEndpointARN)
             {}
 
+            PushNotificationRegistration(PushNotificationRegistration&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                NotificationEndpointARN(AZStd::move(src.NotificationEndpointARN))
+            {}
+
+            PushNotificationRegistration& operator=(const PushNotificationRegistration& src) = default;
+            PushNotificationRegistration& operator=(PushNotificationRegistration&& src) = default;
+
             PushNotificationRegistration(const rapidjson::Value& obj) : PushNotificationRegistration()
             {
                 readFromValue(obj);
@@ -6766,6 +10457,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readPushNotificationPlatformFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("NotificationEndpointARN"):
+                            if (strcmp(member, "NotificationEndpointARN") != 0)
+                                break;
+                            NotificationEndpointARN = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerLinkedAccount : public PlayFabBaseModel
@@ -6791,6 +10510,17 @@ namespace PlayFabComboSdk
                 Email(src.Email)
             {}
 
+            PlayerLinkedAccount(PlayerLinkedAccount&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                PlatformUserId(AZStd::move(src.PlatformUserId)),
+                Username(AZStd::move(src.Username)),
+                Email(AZStd::move(src.Email))
+            {}
+
+            PlayerLinkedAccount& operator=(const PlayerLinkedAccount& src) = default;
+            PlayerLinkedAccount& operator=(PlayerLinkedAccount&& src) = default;
+
             PlayerLinkedAccount(const rapidjson::Value& obj) : PlayerLinkedAccount()
             {
                 readFromValue(obj);
@@ -6835,6 +10565,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readLoginIdentityProviderFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PlatformUserId"):
+                            if (strcmp(member, "PlatformUserId") != 0)
+                                break;
+                            PlatformUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerStatistic : public PlayFabBaseModel
@@ -6860,6 +10628,17 @@ namespace PlayFabComboSdk
                 Name(src.Name)
             {}
 
+            PlayerStatistic(PlayerStatistic&& src) noexcept :
+                PlayFabBaseModel(),
+                Id(AZStd::move(src.Id)),
+                StatisticVersion(AZStd::move(src.StatisticVersion)),
+                StatisticValue(AZStd::move(src.StatisticValue)),
+                Name(AZStd::move(src.Name))
+            {}
+
+            PlayerStatistic& operator=(const PlayerStatistic& src) = default;
+            PlayerStatistic& operator=(PlayerStatistic&& src) = default;
+
             PlayerStatistic(const rapidjson::Value& obj) : PlayerStatistic()
             {
                 readFromValue(obj);
@@ -6900,6 +10679,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticVersion"):
+                            if (strcmp(member, "StatisticVersion") != 0)
+                                break;
+                            StatisticVersion = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticValue"):
+                            if (strcmp(member, "StatisticValue") != 0)
+                                break;
+                            StatisticValue = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerProfile : public PlayFabBaseModel
@@ -6913,17 +10730,17 @@ namespace PlayFabComboSdk
             OptionalTime LastLogin;
             OptionalTime BannedUntil;
             AZStd::string AvatarUrl;
-            std::map<AZStd::string, Int32> Statistics;
+            PlayFabStringMap<Int32> Statistics;
             OptionalUint32 TotalValueToDateInUSD;
-            std::map<AZStd::string, Uint32> ValuesToDate;
-            std::list<AZStd::string> Tags;
-            std::map<AZStd::string, PlayerLocation> Locations;
-            std::map<AZStd::string, Int32> VirtualCurrencyBalances;
-            std::list<AdCampaignAttribution> AdCampaignAttributions;
-            std::list<PushNotificationRegistration> PushNotificationRegistrations;
-            std::list<PlayerLinkedAccount> LinkedAccounts;
-            std::list<PlayerStatistic> PlayerStatistics;
-            std::list<ContactEmailInfo> ContactEmailAddresses;
+            PlayFabStringMap<Uint32> ValuesToDate;
+            std::vector<AZStd::string> Tags;
+            PlayFabStringMap<PlayerLocation> Locations;
+            PlayFabStringMap<Int32> VirtualCurrencyBalances;
+            std::vector<AdCampaignAttribution> AdCampaignAttributions;
+            std::vector<PushNotificationRegistration> PushNotificationRegistrations;
+            std::vector<PlayerLinkedAccount> LinkedAccounts;
+            std::vector<PlayerStatistic> PlayerStatistics;
+            std::vector<ContactEmailInfo> ContactEmailAddresses;
 
             PlayerProfile() :
                 PlayFabBaseModel(),
@@ -6973,6 +10790,33 @@ namespace PlayFabComboSdk
                 ContactEmailAddresses(src.ContactEmailAddresses)
             {}
 
+            PlayerProfile(PlayerProfile&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayerId(AZStd::move(src.PlayerId)),
+                TitleId(AZStd::move(src.TitleId)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                PublisherId(AZStd::move(src.PublisherId)),
+                Origination(AZStd::move(src.Origination)),
+                Created(AZStd::move(src.Created)),
+                LastLogin(AZStd::move(src.LastLogin)),
+                BannedUntil(AZStd::move(src.BannedUntil)),
+                AvatarUrl(AZStd::move(src.AvatarUrl)),
+                Statistics(AZStd::move(src.Statistics)),
+                TotalValueToDateInUSD(AZStd::move(src.TotalValueToDateInUSD)),
+                ValuesToDate(AZStd::move(src.ValuesToDate)),
+                Tags(AZStd::move(src.Tags)),
+                Locations(AZStd::move(src.Locations)),
+                VirtualCurrencyBalances(AZStd::move(src.VirtualCurrencyBalances)),
+                AdCampaignAttributions(AZStd::move(src.AdCampaignAttributions)),
+                PushNotificationRegistrations(AZStd::move(src.PushNotificationRegistrations)),
+                LinkedAccounts(AZStd::move(src.LinkedAccounts)),
+                PlayerStatistics(AZStd::move(src.PlayerStatistics)),
+                ContactEmailAddresses(AZStd::move(src.ContactEmailAddresses))
+            {}
+
+            PlayerProfile& operator=(const PlayerProfile& src) = default;
+            PlayerProfile& operator=(PlayerProfile&& src) = default;
+
             PlayerProfile(const rapidjson::Value& obj) : PlayerProfile()
             {
                 readFromValue(obj);
@@ -7024,7 +10868,7 @@ namespace PlayFabComboSdk
                 if (!Statistics.empty()) {
                     writer.String("Statistics");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = Statistics.begin(); iter != Statistics.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = Statistics.begin(); iter != Statistics.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -7037,7 +10881,7 @@ namespace PlayFabComboSdk
                 if (!ValuesToDate.empty()) {
                     writer.String("ValuesToDate");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = ValuesToDate.begin(); iter != ValuesToDate.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = ValuesToDate.begin(); iter != ValuesToDate.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -7046,7 +10890,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -7054,7 +10898,7 @@ namespace PlayFabComboSdk
                 if (!Locations.empty()) {
                     writer.String("Locations");
                     writer.StartObject();
-                    for (std::map<AZStd::string, PlayerLocation>::iterator iter = Locations.begin(); iter != Locations.end(); ++iter) {
+                    for (PlayFabStringMap<PlayerLocation>::iterator iter = Locations.begin(); iter != Locations.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -7063,7 +10907,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyBalances.empty()) {
                     writer.String("VirtualCurrencyBalances");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = VirtualCurrencyBalances.begin(); iter != VirtualCurrencyBalances.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = VirtualCurrencyBalances.begin(); iter != VirtualCurrencyBalances.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -7072,7 +10916,7 @@ namespace PlayFabComboSdk
                 if (!AdCampaignAttributions.empty()) {
                     writer.String("AdCampaignAttributions");
                     writer.StartArray();
-                    for (std::list<AdCampaignAttribution>::iterator iter = AdCampaignAttributions.begin(); iter != AdCampaignAttributions.end(); iter++) {
+                    for (std::vector<AdCampaignAttribution>::iterator iter = AdCampaignAttributions.begin(); iter != AdCampaignAttributions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7080,7 +10924,7 @@ namespace PlayFabComboSdk
                 if (!PushNotificationRegistrations.empty()) {
                     writer.String("PushNotificationRegistrations");
                     writer.StartArray();
-                    for (std::list<PushNotificationRegistration>::iterator iter = PushNotificationRegistrations.begin(); iter != PushNotificationRegistrations.end(); iter++) {
+                    for (std::vector<PushNotificationRegistration>::iterator iter = PushNotificationRegistrations.begin(); iter != PushNotificationRegistrations.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7088,7 +10932,7 @@ namespace PlayFabComboSdk
                 if (!LinkedAccounts.empty()) {
                     writer.String("LinkedAccounts");
                     writer.StartArray();
-                    for (std::list<PlayerLinkedAccount>::iterator iter = LinkedAccounts.begin(); iter != LinkedAccounts.end(); iter++) {
+                    for (std::vector<PlayerLinkedAccount>::iterator iter = LinkedAccounts.begin(); iter != LinkedAccounts.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7096,7 +10940,7 @@ namespace PlayFabComboSdk
                 if (!PlayerStatistics.empty()) {
                     writer.String("PlayerStatistics");
                     writer.StartArray();
-                    for (std::list<PlayerStatistic>::iterator iter = PlayerStatistics.begin(); iter != PlayerStatistics.end(); iter++) {
+                    for (std::vector<PlayerStatistic>::iterator iter = PlayerStatistics.begin(); iter != PlayerStatistics.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7104,7 +10948,7 @@ namespace PlayFabComboSdk
                 if (!ContactEmailAddresses.empty()) {
                     writer.String("ContactEmailAddresses");
                     writer.StartArray();
-                    for (std::list<ContactEmailInfo>::iterator iter = ContactEmailAddresses.begin(); iter != ContactEmailAddresses.end(); iter++) {
+                    for (std::vector<ContactEmailInfo>::iterator iter = ContactEmailAddresses.begin(); iter != ContactEmailAddresses.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7149,8 +10993,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator Locations_member = obj.FindMember("Locations");
@@ -7168,48 +11013,246 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator AdCampaignAttributions_member = obj.FindMember("AdCampaignAttributions");
                 if (AdCampaignAttributions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = AdCampaignAttributions_member->value;
+                    AdCampaignAttributions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        AdCampaignAttributions.push_back(AdCampaignAttribution(memberList[i]));
+                        AdCampaignAttributions.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator PushNotificationRegistrations_member = obj.FindMember("PushNotificationRegistrations");
                 if (PushNotificationRegistrations_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PushNotificationRegistrations_member->value;
+                    PushNotificationRegistrations.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PushNotificationRegistrations.push_back(PushNotificationRegistration(memberList[i]));
+                        PushNotificationRegistrations.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator LinkedAccounts_member = obj.FindMember("LinkedAccounts");
                 if (LinkedAccounts_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = LinkedAccounts_member->value;
+                    LinkedAccounts.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        LinkedAccounts.push_back(PlayerLinkedAccount(memberList[i]));
+                        LinkedAccounts.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator PlayerStatistics_member = obj.FindMember("PlayerStatistics");
                 if (PlayerStatistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayerStatistics_member->value;
+                    PlayerStatistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayerStatistics.push_back(PlayerStatistic(memberList[i]));
+                        PlayerStatistics.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator ContactEmailAddresses_member = obj.FindMember("ContactEmailAddresses");
                 if (ContactEmailAddresses_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ContactEmailAddresses_member->value;
+                    ContactEmailAddresses.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ContactEmailAddresses.push_back(ContactEmailInfo(memberList[i]));
+                        ContactEmailAddresses.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayerId"):
+                            if (strcmp(member, "PlayerId") != 0)
+                                break;
+                            PlayerId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PublisherId"):
+                            if (strcmp(member, "PublisherId") != 0)
+                                break;
+                            PublisherId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Origination"):
+                            if (strcmp(member, "Origination") != 0)
+                                break;
+                            Origination = readLoginIdentityProviderFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("LastLogin"):
+                            if (strcmp(member, "LastLogin") != 0)
+                                break;
+                            LastLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("BannedUntil"):
+                            if (strcmp(member, "BannedUntil") != 0)
+                                break;
+                            BannedUntil = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("AvatarUrl"):
+                            if (strcmp(member, "AvatarUrl") != 0)
+                                break;
+                            AvatarUrl = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statistics"):
+                            if (strcmp(member, "Statistics") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Statistics[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalValueToDateInUSD"):
+                            if (strcmp(member, "TotalValueToDateInUSD") != 0)
+                                break;
+                            TotalValueToDateInUSD = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ValuesToDate"):
+                            if (strcmp(member, "ValuesToDate") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    ValuesToDate[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Locations"):
+                            if (strcmp(member, "Locations") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Locations[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyBalances"):
+                            if (strcmp(member, "VirtualCurrencyBalances") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyBalances[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("AdCampaignAttributions"):
+                            if (strcmp(member, "AdCampaignAttributions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                AdCampaignAttributions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    AdCampaignAttributions.emplace_back();
+                                    AdCampaignAttributions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PushNotificationRegistrations"):
+                            if (strcmp(member, "PushNotificationRegistrations") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PushNotificationRegistrations.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PushNotificationRegistrations.emplace_back();
+                                    PushNotificationRegistrations.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("LinkedAccounts"):
+                            if (strcmp(member, "LinkedAccounts") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                LinkedAccounts.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    LinkedAccounts.emplace_back();
+                                    LinkedAccounts.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerStatistics"):
+                            if (strcmp(member, "PlayerStatistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayerStatistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayerStatistics.emplace_back();
+                                    PlayerStatistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("ContactEmailAddresses"):
+                            if (strcmp(member, "ContactEmailAddresses") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ContactEmailAddresses.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ContactEmailAddresses.emplace_back();
+                                    ContactEmailAddresses.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayersInSegmentResult : public PlayFabBaseModel
         {
             Int32 ProfilesInSegment;
             AZStd::string ContinuationToken;
-            std::list<PlayerProfile> PlayerProfiles;
+            std::vector<PlayerProfile> PlayerProfiles;
 
             GetPlayersInSegmentResult() :
                 PlayFabBaseModel(),
@@ -7225,6 +11268,16 @@ namespace PlayFabComboSdk
                 PlayerProfiles(src.PlayerProfiles)
             {}
 
+            GetPlayersInSegmentResult(GetPlayersInSegmentResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ProfilesInSegment(AZStd::move(src.ProfilesInSegment)),
+                ContinuationToken(AZStd::move(src.ContinuationToken)),
+                PlayerProfiles(AZStd::move(src.PlayerProfiles))
+            {}
+
+            GetPlayersInSegmentResult& operator=(const GetPlayersInSegmentResult& src) = default;
+            GetPlayersInSegmentResult& operator=(GetPlayersInSegmentResult&& src) = default;
+
             GetPlayersInSegmentResult(const rapidjson::Value& obj) : GetPlayersInSegmentResult()
             {
                 readFromValue(obj);
@@ -7246,7 +11299,7 @@ namespace PlayFabComboSdk
                 if (!PlayerProfiles.empty()) {
                     writer.String("PlayerProfiles");
                     writer.StartArray();
-                    for (std::list<PlayerProfile>::iterator iter = PlayerProfiles.begin(); iter != PlayerProfiles.end(); iter++) {
+                    for (std::vector<PlayerProfile>::iterator iter = PlayerProfiles.begin(); iter != PlayerProfiles.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7263,13 +11316,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayerProfiles_member = obj.FindMember("PlayerProfiles");
                 if (PlayerProfiles_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayerProfiles_member->value;
+                    PlayerProfiles.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayerProfiles.push_back(PlayerProfile(memberList[i]));
+                        PlayerProfiles.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ProfilesInSegment"):
+                            if (strcmp(member, "ProfilesInSegment") != 0)
+                                break;
+                            ProfilesInSegment = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContinuationToken"):
+                            if (strcmp(member, "ContinuationToken") != 0)
+                                break;
+                            ContinuationToken = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerProfiles"):
+                            if (strcmp(member, "PlayerProfiles") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayerProfiles.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayerProfiles.emplace_back();
+                                    PlayerProfiles.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayersSegmentsRequest : public PlayFabBaseModel
@@ -7286,6 +11381,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            GetPlayersSegmentsRequest(GetPlayersSegmentsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetPlayersSegmentsRequest& operator=(const GetPlayersSegmentsRequest& src) = default;
+            GetPlayersSegmentsRequest& operator=(GetPlayersSegmentsRequest&& src) = default;
+
             GetPlayersSegmentsRequest(const rapidjson::Value& obj) : GetPlayersSegmentsRequest()
             {
                 readFromValue(obj);
@@ -7310,6 +11413,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticDefinitionsRequest : public PlayFabBaseModel
@@ -7323,6 +11449,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetPlayerStatisticDefinitionsRequest(GetPlayerStatisticDefinitionsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetPlayerStatisticDefinitionsRequest& operator=(const GetPlayerStatisticDefinitionsRequest& src) = default;
+            GetPlayerStatisticDefinitionsRequest& operator=(GetPlayerStatisticDefinitionsRequest&& src) = default;
+
             GetPlayerStatisticDefinitionsRequest(const rapidjson::Value& obj) : GetPlayerStatisticDefinitionsRequest()
             {
                 readFromValue(obj);
@@ -7343,11 +11476,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetPlayerStatisticDefinitionsResult : public PlayFabBaseModel
         {
-            std::list<PlayerStatisticDefinition> Statistics;
+            std::vector<PlayerStatisticDefinition> Statistics;
 
             GetPlayerStatisticDefinitionsResult() :
                 PlayFabBaseModel(),
@@ -7359,6 +11498,14 @@ namespace PlayFabComboSdk
                 Statistics(src.Statistics)
             {}
 
+            GetPlayerStatisticDefinitionsResult(GetPlayerStatisticDefinitionsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Statistics(AZStd::move(src.Statistics))
+            {}
+
+            GetPlayerStatisticDefinitionsResult& operator=(const GetPlayerStatisticDefinitionsResult& src) = default;
+            GetPlayerStatisticDefinitionsResult& operator=(GetPlayerStatisticDefinitionsResult&& src) = default;
+
             GetPlayerStatisticDefinitionsResult(const rapidjson::Value& obj) : GetPlayerStatisticDefinitionsResult()
             {
                 readFromValue(obj);
@@ -7374,7 +11521,7 @@ namespace PlayFabComboSdk
                 if (!Statistics.empty()) {
                     writer.String("Statistics");
                     writer.StartArray();
-                    for (std::list<PlayerStatisticDefinition>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
+                    for (std::vector<PlayerStatisticDefinition>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7387,13 +11534,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Statistics_member = obj.FindMember("Statistics");
                 if (Statistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statistics_member->value;
+                    Statistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statistics.push_back(PlayerStatisticDefinition(memberList[i]));
+                        Statistics.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Statistics"):
+                            if (strcmp(member, "Statistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statistics.emplace_back();
+                                    Statistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticVersionsRequest : public PlayFabBaseModel
@@ -7410,6 +11589,14 @@ namespace PlayFabComboSdk
                 StatisticName(src.StatisticName)
             {}
 
+            GetPlayerStatisticVersionsRequest(GetPlayerStatisticVersionsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName))
+            {}
+
+            GetPlayerStatisticVersionsRequest& operator=(const GetPlayerStatisticVersionsRequest& src) = default;
+            GetPlayerStatisticVersionsRequest& operator=(GetPlayerStatisticVersionsRequest&& src) = default;
+
             GetPlayerStatisticVersionsRequest(const rapidjson::Value& obj) : GetPlayerStatisticVersionsRequest()
             {
                 readFromValue(obj);
@@ -7436,6 +11623,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum StatisticVersionStatus
@@ -7466,22 +11676,17 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<StatisticVersionStatus>(obj.GetInt());
 
-            static std::map<const char *, StatisticVersionStatus, PlayFabComboSdk::StringCompare> _StatisticVersionStatusMap;
-            if (_StatisticVersionStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _StatisticVersionStatusMap["Active"] = StatisticVersionStatusActive;
-                _StatisticVersionStatusMap["SnapshotPending"] = StatisticVersionStatusSnapshotPending;
-                _StatisticVersionStatusMap["Snapshot"] = StatisticVersionStatusSnapshot;
-                _StatisticVersionStatusMap["ArchivalPending"] = StatisticVersionStatusArchivalPending;
-                _StatisticVersionStatusMap["Archived"] = StatisticVersionStatusArchived;
-
+            case PlayFabJsonReader::Hash("Active"): if (strcmp(name, "Active") == 0) return StatisticVersionStatusActive; break;
+            case PlayFabJsonReader::Hash("SnapshotPending"): if (strcmp(name, "SnapshotPending") == 0) return StatisticVersionStatusSnapshotPending; break;
+            case PlayFabJsonReader::Hash("Snapshot"): if (strcmp(name, "Snapshot") == 0) return StatisticVersionStatusSnapshot; break;
+            case PlayFabJsonReader::Hash("ArchivalPending"): if (strcmp(name, "ArchivalPending") == 0) return StatisticVersionStatusArchivalPending; break;
+            case PlayFabJsonReader::Hash("Archived"): if (strcmp(name, "Archived") == 0) return StatisticVersionStatusArchived; break;
             }
 
-            auto output = _StatisticVersionStatusMap.find(obj.GetString());
-            if (output != _StatisticVersionStatusMap.end())
-                return output->second;
-
             return StatisticVersionStatusActive; // Basically critical fail
         }
 
@@ -7520,6 +11725,21 @@ namespace PlayFabComboSdk
                 ArchiveDownloadUrl(src.ArchiveDownloadUrl)
             {}
 
+            PlayerStatisticVersion(PlayerStatisticVersion&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                Version(AZStd::move(src.Version)),
+                ScheduledActivationTime(AZStd::move(src.ScheduledActivationTime)),
+                ActivationTime(AZStd::move(src.ActivationTime)),
+                ScheduledDeactivationTime(AZStd::move(src.ScheduledDeactivationTime)),
+                DeactivationTime(AZStd::move(src.DeactivationTime)),
+                Status(AZStd::move(src.Status)),
+                ArchiveDownloadUrl(AZStd::move(src.ArchiveDownloadUrl))
+            {}
+
+            PlayerStatisticVersion& operator=(const PlayerStatisticVersion& src) = default;
+            PlayerStatisticVersion& operator=(PlayerStatisticVersion&& src) = default;
+
             PlayerStatisticVersion(const rapidjson::Value& obj) : PlayerStatisticVersion()
             {
                 readFromValue(obj);
@@ -7584,11 +11804,69 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledActivationTime"):
+                            if (strcmp(member, "ScheduledActivationTime") != 0)
+                                break;
+                            ScheduledActivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ActivationTime"):
+                            if (strcmp(member, "ActivationTime") != 0)
+                                break;
+                            ActivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledDeactivationTime"):
+                            if (strcmp(member, "ScheduledDeactivationTime") != 0)
+                                break;
+                            ScheduledDeactivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("DeactivationTime"):
+                            if (strcmp(member, "DeactivationTime") != 0)
+                                break;
+                            DeactivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readStatisticVersionStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ArchiveDownloadUrl"):
+                            if (strcmp(member, "ArchiveDownloadUrl") != 0)
+                                break;
+                            ArchiveDownloadUrl = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticVersionsResult : public PlayFabBaseModel
         {
-            std::list<PlayerStatisticVersion> StatisticVersions;
+            std::vector<PlayerStatisticVersion> StatisticVersions;
 
             GetPlayerStatisticVersionsResult() :
                 PlayFabBaseModel(),
@@ -7600,6 +11878,14 @@ namespace PlayFabComboSdk
                 StatisticVersions(src.StatisticVersions)
             {}
 
+            GetPlayerStatisticVersionsResult(GetPlayerStatisticVersionsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticVersions(AZStd::move(src.StatisticVersions))
+            {}
+
+            GetPlayerStatisticVersionsResult& operator=(const GetPlayerStatisticVersionsResult& src) = default;
+            GetPlayerStatisticVersionsResult& operator=(GetPlayerStatisticVersionsResult&& src) = default;
+
             GetPlayerStatisticVersionsResult(const rapidjson::Value& obj) : GetPlayerStatisticVersionsResult()
             {
                 readFromValue(obj);
@@ -7615,7 +11901,7 @@ namespace PlayFabComboSdk
                 if (!StatisticVersions.empty()) {
                     writer.String("StatisticVersions");
                     writer.StartArray();
-                    for (std::list<PlayerStatisticVersion>::iterator iter = StatisticVersions.begin(); iter != StatisticVersions.end(); iter++) {
+                    for (std::vector<PlayerStatisticVersion>::iterator iter = StatisticVersions.begin(); iter != StatisticVersions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7628,13 +11914,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator StatisticVersions_member = obj.FindMember("StatisticVersions");
                 if (StatisticVersions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = StatisticVersions_member->value;
+                    StatisticVersions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        StatisticVersions.push_back(PlayerStatisticVersion(memberList[i]));
+                        StatisticVersions.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticVersions"):
+                            if (strcmp(member, "StatisticVersions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                StatisticVersions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    StatisticVersions.emplace_back();
+                                    StatisticVersions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerTagsRequest : public PlayFabBaseModel
@@ -7654,6 +11972,15 @@ namespace PlayFabComboSdk
                 Namespace(src.Namespace)
             {}
 
+            GetPlayerTagsRequest(GetPlayerTagsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Namespace(AZStd::move(src.Namespace))
+            {}
+
+            GetPlayerTagsRequest& operator=(const GetPlayerTagsRequest& src) = default;
+            GetPlayerTagsRequest& operator=(GetPlayerTagsRequest&& src) = default;
+
             GetPlayerTagsRequest(const rapidjson::Value& obj) : GetPlayerTagsRequest()
             {
                 readFromValue(obj);
@@ -7684,12 +12011,40 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Namespace"):
+                            if (strcmp(member, "Namespace") != 0)
+                                break;
+                            Namespace = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerTagsResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<AZStd::string> Tags;
+            std::vector<AZStd::string> Tags;
 
             GetPlayerTagsResult() :
                 PlayFabBaseModel(),
@@ -7703,6 +12058,15 @@ namespace PlayFabComboSdk
                 Tags(src.Tags)
             {}
 
+            GetPlayerTagsResult(GetPlayerTagsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Tags(AZStd::move(src.Tags))
+            {}
+
+            GetPlayerTagsResult& operator=(const GetPlayerTagsResult& src) = default;
+            GetPlayerTagsResult& operator=(GetPlayerTagsResult&& src) = default;
+
             GetPlayerTagsResult(const rapidjson::Value& obj) : GetPlayerTagsResult()
             {
                 readFromValue(obj);
@@ -7719,7 +12083,7 @@ namespace PlayFabComboSdk
                 writer.String(PlayFabId.c_str());
                 writer.String("Tags");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -7733,13 +12097,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPolicyRequest : public PlayFabBaseModel
@@ -7756,6 +12156,14 @@ namespace PlayFabComboSdk
                 PolicyName(src.PolicyName)
             {}
 
+            GetPolicyRequest(GetPolicyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PolicyName(AZStd::move(src.PolicyName))
+            {}
+
+            GetPolicyRequest& operator=(const GetPolicyRequest& src) = default;
+            GetPolicyRequest& operator=(GetPolicyRequest&& src) = default;
+
             GetPolicyRequest(const rapidjson::Value& obj) : GetPolicyRequest()
             {
                 readFromValue(obj);
@@ -7782,6 +12190,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PolicyName"):
+                            if (strcmp(member, "PolicyName") != 0)
+                                break;
+                            PolicyName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PermissionStatement : public PlayFabBaseModel
@@ -7813,6 +12244,41 @@ namespace PlayFabComboSdk
                 ApiConditions(src.ApiConditions ? new ApiCondition(*src.ApiConditions) : nullptr)
             {}
 
+            PermissionStatement(PermissionStatement&& src) noexcept :
+                PlayFabBaseModel(),
+                Resource(AZStd::move(src.Resource)),
+                Action(AZStd::move(src.Action)),
+                Effect(AZStd::move(src.Effect)),
+                Principal(AZStd::move(src.Principal)),
+                Comment(AZStd::move(src.Comment)),
+                ApiConditions(src.ApiConditions)
+            {
+                src.ApiConditions = nullptr;
+            }
+
+            PermissionStatement& operator=(const PermissionStatement& src)
+            {
+                if (this != &src)
+                    *this = PermissionStatement(src);
+                return *this;
+            }
+
+            PermissionStatement& operator=(PermissionStatement&& src)
+            {
+                if (this != &src)
+                {
+                    Resource = AZStd::move(src.Resource);
+                    Action = AZStd::move(src.Action);
+                    Effect = AZStd::move(src.Effect);
+                    Principal = AZStd::move(src.Principal);
+                    Comment = AZStd::move(src.Comment);
+                    if (ApiConditions != nullptr) delete ApiConditions;
+                    ApiConditions = src.ApiConditions;
+                    src.ApiConditions = nullptr;
+                }
+                return *this;
+            }
+
             PermissionStatement(const rapidjson::Value& obj) : PermissionStatement()
             {
                 readFromValue(obj);
@@ -7862,12 +12328,61 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Resource"):
+                            if (strcmp(member, "Resource") != 0)
+                                break;
+                            Resource = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Action"):
+                            if (strcmp(member, "Action") != 0)
+                                break;
+                            Action = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Effect"):
+                            if (strcmp(member, "Effect") != 0)
+                                break;
+                            Effect = readEffectTypeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Principal"):
+                            if (strcmp(member, "Principal") != 0)
+                                break;
+                            Principal = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ApiConditions"):
+                            if (strcmp(member, "ApiConditions") != 0)
+                                break;
+                            ApiConditions = new ApiCondition;
+                            ApiConditions->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPolicyResponse : public PlayFabBaseModel
         {
             AZStd::string PolicyName;
-            std::list<PermissionStatement> Statements;
+            std::vector<PermissionStatement> Statements;
 
             GetPolicyResponse() :
                 PlayFabBaseModel(),
@@ -7881,6 +12396,15 @@ namespace PlayFabComboSdk
                 Statements(src.Statements)
             {}
 
+            GetPolicyResponse(GetPolicyResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                PolicyName(AZStd::move(src.PolicyName)),
+                Statements(AZStd::move(src.Statements))
+            {}
+
+            GetPolicyResponse& operator=(const GetPolicyResponse& src) = default;
+            GetPolicyResponse& operator=(GetPolicyResponse&& src) = default;
+
             GetPolicyResponse(const rapidjson::Value& obj) : GetPolicyResponse()
             {
                 readFromValue(obj);
@@ -7900,7 +12424,7 @@ namespace PlayFabComboSdk
                 if (!Statements.empty()) {
                     writer.String("Statements");
                     writer.StartArray();
-                    for (std::list<PermissionStatement>::iterator iter = Statements.begin(); iter != Statements.end(); iter++) {
+                    for (std::vector<PermissionStatement>::iterator iter = Statements.begin(); iter != Statements.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7915,18 +12439,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Statements_member = obj.FindMember("Statements");
                 if (Statements_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statements_member->value;
+                    Statements.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statements.push_back(PermissionStatement(memberList[i]));
+                        Statements.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PolicyName"):
+                            if (strcmp(member, "PolicyName") != 0)
+                                break;
+                            PolicyName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statements"):
+                            if (strcmp(member, "Statements") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statements.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statements.emplace_back();
+                                    Statements.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPublisherDataRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
 
             GetPublisherDataRequest() :
                 PlayFabBaseModel(),
@@ -7938,6 +12499,14 @@ namespace PlayFabComboSdk
                 Keys(src.Keys)
             {}
 
+            GetPublisherDataRequest(GetPublisherDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Keys(AZStd::move(src.Keys))
+            {}
+
+            GetPublisherDataRequest& operator=(const GetPublisherDataRequest& src) = default;
+            GetPublisherDataRequest& operator=(GetPublisherDataRequest&& src) = default;
+
             GetPublisherDataRequest(const rapidjson::Value& obj) : GetPublisherDataRequest()
             {
                 readFromValue(obj);
@@ -7952,7 +12521,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Keys");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -7964,18 +12533,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPublisherDataResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, AZStd::string> Data;
+            PlayFabStringMap<AZStd::string> Data;
 
             GetPublisherDataResult() :
                 PlayFabBaseModel(),
@@ -7987,6 +12587,14 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetPublisherDataResult(GetPublisherDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetPublisherDataResult& operator=(const GetPublisherDataResult& src) = default;
+            GetPublisherDataResult& operator=(GetPublisherDataResult&& src) = default;
+
             GetPublisherDataResult(const rapidjson::Value& obj) : GetPublisherDataResult()
             {
                 readFromValue(obj);
@@ -8002,7 +12610,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -8022,6 +12630,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetRandomResultTablesRequest : public PlayFabBaseModel
@@ -8038,6 +12676,14 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            GetRandomResultTablesRequest(GetRandomResultTablesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            GetRandomResultTablesRequest& operator=(const GetRandomResultTablesRequest& src) = default;
+            GetRandomResultTablesRequest& operator=(GetRandomResultTablesRequest&& src) = default;
+
             GetRandomResultTablesRequest(const rapidjson::Value& obj) : GetRandomResultTablesRequest()
             {
                 readFromValue(obj);
@@ -8064,6 +12710,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum ResultTableNodeType
@@ -8088,19 +12757,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<ResultTableNodeType>(obj.GetInt());
 
-            static std::map<const char *, ResultTableNodeType, PlayFabComboSdk::StringCompare> _ResultTableNodeTypeMap;
-            if (_ResultTableNodeTypeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ResultTableNodeTypeMap["ItemId"] = ResultTableNodeTypeItemId;
-                _ResultTableNodeTypeMap["TableId"] = ResultTableNodeTypeTableId;
-
+            case PlayFabJsonReader::Hash("ItemId"): if (strcmp(name, "ItemId") == 0) return ResultTableNodeTypeItemId; break;
+            case PlayFabJsonReader::Hash("TableId"): if (strcmp(name, "TableId") == 0) return ResultTableNodeTypeTableId; break;
             }
 
-            auto output = _ResultTableNodeTypeMap.find(obj.GetString());
-            if (output != _ResultTableNodeTypeMap.end())
-                return output->second;
-
             return ResultTableNodeTypeItemId; // Basically critical fail
         }
 
@@ -8124,6 +12788,16 @@ namespace PlayFabComboSdk
                 Weight(src.Weight)
             {}
 
+            ResultTableNode(ResultTableNode&& src) noexcept :
+                PlayFabBaseModel(),
+                ResultItemType(AZStd::move(src.ResultItemType)),
+                ResultItem(AZStd::move(src.ResultItem)),
+                Weight(AZStd::move(src.Weight))
+            {}
+
+            ResultTableNode& operator=(const ResultTableNode& src) = default;
+            ResultTableNode& operator=(ResultTableNode&& src) = default;
+
             ResultTableNode(const rapidjson::Value& obj) : ResultTableNode()
             {
                 readFromValue(obj);
@@ -8156,13 +12830,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ResultItemType"):
+                            if (strcmp(member, "ResultItemType") != 0)
+                                break;
+                            ResultItemType = readResultTableNodeTypeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ResultItem"):
+                            if (strcmp(member, "ResultItem") != 0)
+                                break;
+                            ResultItem = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Weight"):
+                            if (strcmp(member, "Weight") != 0)
+                                break;
+                            Weight = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RandomResultTableListing : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
             AZStd::string TableId;
-            std::list<ResultTableNode> Nodes;
+            std::vector<ResultTableNode> Nodes;
 
             RandomResultTableListing() :
                 PlayFabBaseModel(),
@@ -8178,6 +12885,16 @@ namespace PlayFabComboSdk
                 Nodes(src.Nodes)
             {}
 
+            RandomResultTableListing(RandomResultTableListing&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                TableId(AZStd::move(src.TableId)),
+                Nodes(AZStd::move(src.Nodes))
+            {}
+
+            RandomResultTableListing& operator=(const RandomResultTableListing& src) = default;
+            RandomResultTableListing& operator=(RandomResultTableListing&& src) = default;
+
             RandomResultTableListing(const rapidjson::Value& obj) : RandomResultTableListing()
             {
                 readFromValue(obj);
@@ -8198,7 +12915,7 @@ namespace PlayFabComboSdk
                 writer.String(TableId.c_str());
                 writer.String("Nodes");
                 writer.StartArray();
-                for (std::list<ResultTableNode>::iterator iter = Nodes.begin(); iter != Nodes.end(); iter++) {
+                for (std::vector<ResultTableNode>::iterator iter = Nodes.begin(); iter != Nodes.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -8214,18 +12931,60 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Nodes_member = obj.FindMember("Nodes");
                 if (Nodes_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Nodes_member->value;
+                    Nodes.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Nodes.push_back(ResultTableNode(memberList[i]));
+                        Nodes.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TableId"):
+                            if (strcmp(member, "TableId") != 0)
+                                break;
+                            TableId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Nodes"):
+                            if (strcmp(member, "Nodes") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Nodes.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Nodes.emplace_back();
+                                    Nodes.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetRandomResultTablesResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, RandomResultTableListing> Tables;
+            PlayFabStringMap<RandomResultTableListing> Tables;
 
             GetRandomResultTablesResult() :
                 PlayFabBaseModel(),
@@ -8237,8 +12996,16 @@ namespace PlayFabComboSdk
                 Tables(src.Tables)
             {}
 
-            GetRandomResultTablesResult(const rapidjson::Value& obj) : GetRandomResultTablesResult()
-            {
+            GetRandomResultTablesResult(GetRandomResultTablesResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Tables(AZStd::move(src.Tables))
+            {}
+
+            GetRandomResultTablesResult& operator=(const GetRandomResultTablesResult& src) = default;
+            GetRandomResultTablesResult& operator=(GetRandomResultTablesResult&& src) = default;
+
+            GetRandomResultTablesResult(const rapidjson::Value& obj) : GetRandomResultTablesResult()
+            {
                 readFromValue(obj);
             }
 
@@ -8252,7 +13019,7 @@ namespace PlayFabComboSdk
                 if (!Tables.empty()) {
                     writer.String("Tables");
                     writer.StartObject();
-                    for (std::map<AZStd::string, RandomResultTableListing>::iterator iter = Tables.begin(); iter != Tables.end(); ++iter) {
+                    for (PlayFabStringMap<RandomResultTableListing>::iterator iter = Tables.begin(); iter != Tables.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -8272,6 +13039,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Tables"):
+                            if (strcmp(member, "Tables") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Tables[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetServerBuildInfoRequest : public PlayFabBaseModel
@@ -8288,6 +13085,14 @@ namespace PlayFabComboSdk
                 BuildId(src.BuildId)
             {}
 
+            GetServerBuildInfoRequest(GetServerBuildInfoRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId))
+            {}
+
+            GetServerBuildInfoRequest& operator=(const GetServerBuildInfoRequest& src) = default;
+            GetServerBuildInfoRequest& operator=(GetServerBuildInfoRequest&& src) = default;
+
             GetServerBuildInfoRequest(const rapidjson::Value& obj) : GetServerBuildInfoRequest()
             {
                 readFromValue(obj);
@@ -8312,12 +13117,35 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetServerBuildInfoResult : public PlayFabBaseModel
         {
             AZStd::string BuildId;
-            std::list<Region> ActiveRegions;
+            std::vector<Region> ActiveRegions;
             Int32 MaxGamesPerHost;
             Int32 MinFreeGameSlots;
             AZStd::string Comment;
@@ -8352,6 +13180,22 @@ namespace PlayFabComboSdk
                 ErrorMessage(src.ErrorMessage)
             {}
 
+            GetServerBuildInfoResult(GetServerBuildInfoResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId)),
+                ActiveRegions(AZStd::move(src.ActiveRegions)),
+                MaxGamesPerHost(AZStd::move(src.MaxGamesPerHost)),
+                MinFreeGameSlots(AZStd::move(src.MinFreeGameSlots)),
+                Comment(AZStd::move(src.Comment)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                TitleId(AZStd::move(src.TitleId)),
+                Status(AZStd::move(src.Status)),
+                ErrorMessage(AZStd::move(src.ErrorMessage))
+            {}
+
+            GetServerBuildInfoResult& operator=(const GetServerBuildInfoResult& src) = default;
+            GetServerBuildInfoResult& operator=(GetServerBuildInfoResult&& src) = default;
+
             GetServerBuildInfoResult(const rapidjson::Value& obj) : GetServerBuildInfoResult()
             {
                 readFromValue(obj);
@@ -8371,7 +13215,7 @@ namespace PlayFabComboSdk
                 if (!ActiveRegions.empty()) {
                     writer.String("ActiveRegions");
                     writer.StartArray();
-                    for (std::list<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
+                    for (std::vector<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
                         writeRegionEnumJSON(*iter, writer);
                     }
                     writer.EndArray();
@@ -8408,6 +13252,7 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActiveRegions_member = obj.FindMember("ActiveRegions");
                 if (ActiveRegions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActiveRegions_member->value;
+                    ActiveRegions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
                         ActiveRegions.push_back(readRegionFromValue(memberList[i]));
                     }
@@ -8429,6 +13274,76 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ActiveRegions"):
+                            if (strcmp(member, "ActiveRegions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActiveRegions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActiveRegions.push_back(readRegionFromValue(reader.GetValue()));
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxGamesPerHost"):
+                            if (strcmp(member, "MaxGamesPerHost") != 0)
+                                break;
+                            MaxGamesPerHost = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinFreeGameSlots"):
+                            if (strcmp(member, "MinFreeGameSlots") != 0)
+                                break;
+                            MinFreeGameSlots = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readGameBuildStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ErrorMessage"):
+                            if (strcmp(member, "ErrorMessage") != 0)
+                                break;
+                            ErrorMessage = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetServerBuildUploadURLRequest : public PlayFabBaseModel
@@ -8445,6 +13360,14 @@ namespace PlayFabComboSdk
                 BuildId(src.BuildId)
             {}
 
+            GetServerBuildUploadURLRequest(GetServerBuildUploadURLRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId))
+            {}
+
+            GetServerBuildUploadURLRequest& operator=(const GetServerBuildUploadURLRequest& src) = default;
+            GetServerBuildUploadURLRequest& operator=(GetServerBuildUploadURLRequest&& src) = default;
+
             GetServerBuildUploadURLRequest(const rapidjson::Value& obj) : GetServerBuildUploadURLRequest()
             {
                 readFromValue(obj);
@@ -8469,6 +13392,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetServerBuildUploadURLResult : public PlayFabBaseModel
@@ -8485,6 +13431,14 @@ namespace PlayFabComboSdk
                 URL(src.URL)
             {}
 
+            GetServerBuildUploadURLResult(GetServerBuildUploadURLResult&& src) noexcept :
+                PlayFabBaseModel(),
+                URL(AZStd::move(src.URL))
+            {}
+
+            GetServerBuildUploadURLResult& operator=(const GetServerBuildUploadURLResult& src) = default;
+            GetServerBuildUploadURLResult& operator=(GetServerBuildUploadURLResult&& src) = default;
+
             GetServerBuildUploadURLResult(const rapidjson::Value& obj) : GetServerBuildUploadURLResult()
             {
                 readFromValue(obj);
@@ -8511,6 +13465,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("URL"):
+                            if (strcmp(member, "URL") != 0)
+                                break;
+                            URL = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetStoreItemsRequest : public PlayFabBaseModel
@@ -8530,6 +13507,15 @@ namespace PlayFabComboSdk
                 StoreId(src.StoreId)
             {}
 
+            GetStoreItemsRequest(GetStoreItemsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                StoreId(AZStd::move(src.StoreId))
+            {}
+
+            GetStoreItemsRequest& operator=(const GetStoreItemsRequest& src) = default;
+            GetStoreItemsRequest& operator=(GetStoreItemsRequest&& src) = default;
+
             GetStoreItemsRequest(const rapidjson::Value& obj) : GetStoreItemsRequest()
             {
                 readFromValue(obj);
@@ -8560,13 +13546,41 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StoreId"):
+                            if (strcmp(member, "StoreId") != 0)
+                                break;
+                            StoreId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct StoreItem : public PlayFabBaseModel
         {
             AZStd::string ItemId;
-            std::map<AZStd::string, Uint32> VirtualCurrencyPrices;
-            std::map<AZStd::string, Uint32> RealCurrencyPrices;
+            PlayFabStringMap<Uint32> VirtualCurrencyPrices;
+            PlayFabStringMap<Uint32> RealCurrencyPrices;
             MultitypeVar CustomData;
             OptionalUint32 DisplayPosition;
 
@@ -8588,6 +13602,18 @@ namespace PlayFabComboSdk
                 DisplayPosition(src.DisplayPosition)
             {}
 
+            StoreItem(StoreItem&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemId(AZStd::move(src.ItemId)),
+                VirtualCurrencyPrices(AZStd::move(src.VirtualCurrencyPrices)),
+                RealCurrencyPrices(AZStd::move(src.RealCurrencyPrices)),
+                CustomData(AZStd::move(src.CustomData)),
+                DisplayPosition(AZStd::move(src.DisplayPosition))
+            {}
+
+            StoreItem& operator=(const StoreItem& src) = default;
+            StoreItem& operator=(StoreItem&& src) = default;
+
             StoreItem(const rapidjson::Value& obj) : StoreItem()
             {
                 readFromValue(obj);
@@ -8605,7 +13631,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyPrices.empty()) {
                     writer.String("VirtualCurrencyPrices");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = VirtualCurrencyPrices.begin(); iter != VirtualCurrencyPrices.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = VirtualCurrencyPrices.begin(); iter != VirtualCurrencyPrices.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -8614,7 +13640,7 @@ namespace PlayFabComboSdk
                 if (!RealCurrencyPrices.empty()) {
                     writer.String("RealCurrencyPrices");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = RealCurrencyPrices.begin(); iter != RealCurrencyPrices.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = RealCurrencyPrices.begin(); iter != RealCurrencyPrices.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -8654,6 +13680,63 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyPrices"):
+                            if (strcmp(member, "VirtualCurrencyPrices") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyPrices[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("RealCurrencyPrices"):
+                            if (strcmp(member, "RealCurrencyPrices") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    RealCurrencyPrices[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            CustomData.readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayPosition"):
+                            if (strcmp(member, "DisplayPosition") != 0)
+                                break;
+                            DisplayPosition = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum SourceType
@@ -8684,22 +13767,17 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<SourceType>(obj.GetInt());
 
-            static std::map<const char *, SourceType, PlayFabComboSdk::StringCompare> _SourceTypeMap;
-            if (_SourceTypeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _SourceTypeMap["Admin"] = SourceTypeAdmin;
-                _SourceTypeMap["BackEnd"] = SourceTypeBackEnd;
-                _SourceTypeMap["GameClient"] = SourceTypeGameClient;
-                _SourceTypeMap["GameServer"] = SourceTypeGameServer;
-                _SourceTypeMap["Partner"] = SourceTypePartner;
-
+            case PlayFabJsonReader::Hash("Admin"): if (strcmp(name, "Admin") == 0) return SourceTypeAdmin; break;
+            case PlayFabJsonReader::Hash("BackEnd"): if (strcmp(name, "BackEnd") == 0) return SourceTypeBackEnd; break;
+            case PlayFabJsonReader::Hash("GameClient"): if (strcmp(name, "GameClient") == 0) return SourceTypeGameClient; break;
+            case PlayFabJsonReader::Hash("GameServer"): if (strcmp(name, "GameServer") == 0) return SourceTypeGameServer; break;
+            case PlayFabJsonReader::Hash("Partner"): if (strcmp(name, "Partner") == 0) return SourceTypePartner; break;
             }
 
-            auto output = _SourceTypeMap.find(obj.GetString());
-            if (output != _SourceTypeMap.end())
-                return output->second;
-
             return SourceTypeAdmin; // Basically critical fail
         }
 
@@ -8723,6 +13801,16 @@ namespace PlayFabComboSdk
                 Metadata(src.Metadata)
             {}
 
+            StoreMarketingModel(StoreMarketingModel&& src) noexcept :
+                PlayFabBaseModel(),
+                DisplayName(AZStd::move(src.DisplayName)),
+                Description(AZStd::move(src.Description)),
+                Metadata(AZStd::move(src.Metadata))
+            {}
+
+            StoreMarketingModel& operator=(const StoreMarketingModel& src) = default;
+            StoreMarketingModel& operator=(StoreMarketingModel&& src) = default;
+
             StoreMarketingModel(const rapidjson::Value& obj) : StoreMarketingModel()
             {
                 readFromValue(obj);
@@ -8761,11 +13849,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Metadata"):
+                            if (strcmp(member, "Metadata") != 0)
+                                break;
+                            Metadata.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetStoreItemsResult : public PlayFabBaseModel
         {
-            std::list<StoreItem> Store;
+            std::vector<StoreItem> Store;
             Boxed<SourceType> Source;
             AZStd::string CatalogVersion;
             AZStd::string StoreId;
@@ -8789,6 +13910,39 @@ namespace PlayFabComboSdk
                 MarketingData(src.MarketingData ? new StoreMarketingModel(*src.MarketingData) : nullptr)
             {}
 
+            GetStoreItemsResult(GetStoreItemsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Store(AZStd::move(src.Store)),
+                Source(AZStd::move(src.Source)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                StoreId(AZStd::move(src.StoreId)),
+                MarketingData(src.MarketingData)
+            {
+                src.MarketingData = nullptr;
+            }
+
+            GetStoreItemsResult& operator=(const GetStoreItemsResult& src)
+            {
+                if (this != &src)
+                    *this = GetStoreItemsResult(src);
+                return *this;
+            }
+
+            GetStoreItemsResult& operator=(GetStoreItemsResult&& src)
+            {
+                if (this != &src)
+                {
+                    Store = AZStd::move(src.Store);
+                    Source = AZStd::move(src.Source);
+                    CatalogVersion = AZStd::move(src.CatalogVersion);
+                    StoreId = AZStd::move(src.StoreId);
+                    if (MarketingData != nullptr) delete MarketingData;
+                    MarketingData = src.MarketingData;
+                    src.MarketingData = nullptr;
+                }
+                return *this;
+            }
+
             GetStoreItemsResult(const rapidjson::Value& obj) : GetStoreItemsResult()
             {
                 readFromValue(obj);
@@ -8805,7 +13959,7 @@ namespace PlayFabComboSdk
                 if (!Store.empty()) {
                     writer.String("Store");
                     writer.StartArray();
-                    for (std::list<StoreItem>::iterator iter = Store.begin(); iter != Store.end(); iter++) {
+                    for (std::vector<StoreItem>::iterator iter = Store.begin(); iter != Store.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -8834,8 +13988,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Store_member = obj.FindMember("Store");
                 if (Store_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Store_member->value;
+                    Store.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Store.push_back(StoreItem(memberList[i]));
+                        Store.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator Source_member = obj.FindMember("Source");
@@ -8849,6 +14004,58 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Store"):
+                            if (strcmp(member, "Store") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Store.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Store.emplace_back();
+                                    Store.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Source"):
+                            if (strcmp(member, "Source") != 0)
+                                break;
+                            Source = readSourceTypeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StoreId"):
+                            if (strcmp(member, "StoreId") != 0)
+                                break;
+                            StoreId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MarketingData"):
+                            if (strcmp(member, "MarketingData") != 0)
+                                break;
+                            MarketingData = new StoreMarketingModel;
+                            MarketingData->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTaskInstanceRequest : public PlayFabBaseModel
@@ -8865,6 +14072,14 @@ namespace PlayFabComboSdk
                 TaskInstanceId(src.TaskInstanceId)
             {}
 
+            GetTaskInstanceRequest(GetTaskInstanceRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId))
+            {}
+
+            GetTaskInstanceRequest& operator=(const GetTaskInstanceRequest& src) = default;
+            GetTaskInstanceRequest& operator=(GetTaskInstanceRequest&& src) = default;
+
             GetTaskInstanceRequest(const rapidjson::Value& obj) : GetTaskInstanceRequest()
             {
                 readFromValue(obj);
@@ -8889,6 +14104,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTaskInstancesRequest : public PlayFabBaseModel
@@ -8914,6 +14152,37 @@ namespace PlayFabComboSdk
                 StartedAtRangeTo(src.StartedAtRangeTo)
             {}
 
+            GetTaskInstancesRequest(GetTaskInstancesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskIdentifier(src.TaskIdentifier),
+                StatusFilter(AZStd::move(src.StatusFilter)),
+                StartedAtRangeFrom(AZStd::move(src.StartedAtRangeFrom)),
+                StartedAtRangeTo(AZStd::move(src.StartedAtRangeTo))
+            {
+                src.TaskIdentifier = nullptr;
+            }
+
+            GetTaskInstancesRequest& operator=(const GetTaskInstancesRequest& src)
+            {
+                if (this != &src)
+                    *this = GetTaskInstancesRequest(src);
+                return *this;
+            }
+
+            GetTaskInstancesRequest& operator=(GetTaskInstancesRequest&& src)
+            {
+                if (this != &src)
+                {
+                    if (TaskIdentifier != nullptr) delete TaskIdentifier;
+                    TaskIdentifier = src.TaskIdentifier;
+                    src.TaskIdentifier = nullptr;
+                    StatusFilter = AZStd::move(src.StatusFilter);
+                    StartedAtRangeFrom = AZStd::move(src.StartedAtRangeFrom);
+                    StartedAtRangeTo = AZStd::move(src.StartedAtRangeTo);
+                }
+                return *this;
+            }
+
             GetTaskInstancesRequest(const rapidjson::Value& obj) : GetTaskInstancesRequest()
             {
                 readFromValue(obj);
@@ -8959,6 +14228,45 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskIdentifier"):
+                            if (strcmp(member, "TaskIdentifier") != 0)
+                                break;
+                            TaskIdentifier = new NameIdentifier;
+                            TaskIdentifier->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("StatusFilter"):
+                            if (strcmp(member, "StatusFilter") != 0)
+                                break;
+                            StatusFilter = readTaskInstanceStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("StartedAtRangeFrom"):
+                            if (strcmp(member, "StartedAtRangeFrom") != 0)
+                                break;
+                            StartedAtRangeFrom = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("StartedAtRangeTo"):
+                            if (strcmp(member, "StartedAtRangeTo") != 0)
+                                break;
+                            StartedAtRangeTo = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum ScheduledTaskType
@@ -8983,19 +14291,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<ScheduledTaskType>(obj.GetInt());
 
-            static std::map<const char *, ScheduledTaskType, PlayFabComboSdk::StringCompare> _ScheduledTaskTypeMap;
-            if (_ScheduledTaskTypeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ScheduledTaskTypeMap["CloudScript"] = ScheduledTaskTypeCloudScript;
-                _ScheduledTaskTypeMap["ActionsOnPlayerSegment"] = ScheduledTaskTypeActionsOnPlayerSegment;
-
+            case PlayFabJsonReader::Hash("CloudScript"): if (strcmp(name, "CloudScript") == 0) return ScheduledTaskTypeCloudScript; break;
+            case PlayFabJsonReader::Hash("ActionsOnPlayerSegment"): if (strcmp(name, "ActionsOnPlayerSegment") == 0) return ScheduledTaskTypeActionsOnPlayerSegment; break;
             }
 
-            auto output = _ScheduledTaskTypeMap.find(obj.GetString());
-            if (output != _ScheduledTaskTypeMap.end())
-                return output->second;
-
             return ScheduledTaskTypeCloudScript; // Basically critical fail
         }
 
@@ -9037,6 +14340,47 @@ namespace PlayFabComboSdk
                 Type(src.Type)
             {}
 
+            TaskInstanceBasicSummary(TaskInstanceBasicSummary&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId)),
+                TaskIdentifier(src.TaskIdentifier),
+                StartedAt(AZStd::move(src.StartedAt)),
+                CompletedAt(AZStd::move(src.CompletedAt)),
+                Status(AZStd::move(src.Status)),
+                PercentComplete(AZStd::move(src.PercentComplete)),
+                EstimatedSecondsRemaining(AZStd::move(src.EstimatedSecondsRemaining)),
+                ScheduledByUserId(AZStd::move(src.ScheduledByUserId)),
+                Type(AZStd::move(src.Type))
+            {
+                src.TaskIdentifier = nullptr;
+            }
+
+            TaskInstanceBasicSummary& operator=(const TaskInstanceBasicSummary& src)
+            {
+                if (this != &src)
+                    *this = TaskInstanceBasicSummary(src);
+                return *this;
+            }
+
+            TaskInstanceBasicSummary& operator=(TaskInstanceBasicSummary&& src)
+            {
+                if (this != &src)
+                {
+                    TaskInstanceId = AZStd::move(src.TaskInstanceId);
+                    if (TaskIdentifier != nullptr) delete TaskIdentifier;
+                    TaskIdentifier = src.TaskIdentifier;
+                    src.TaskIdentifier = nullptr;
+                    StartedAt = AZStd::move(src.StartedAt);
+                    CompletedAt = AZStd::move(src.CompletedAt);
+                    Status = AZStd::move(src.Status);
+                    PercentComplete = AZStd::move(src.PercentComplete);
+                    EstimatedSecondsRemaining = AZStd::move(src.EstimatedSecondsRemaining);
+                    ScheduledByUserId = AZStd::move(src.ScheduledByUserId);
+                    Type = AZStd::move(src.Type);
+                }
+                return *this;
+            }
+
             TaskInstanceBasicSummary(const rapidjson::Value& obj) : TaskInstanceBasicSummary()
             {
                 readFromValue(obj);
@@ -9110,11 +14454,75 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TaskIdentifier"):
+                            if (strcmp(member, "TaskIdentifier") != 0)
+                                break;
+                            TaskIdentifier = new NameIdentifier;
+                            TaskIdentifier->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("StartedAt"):
+                            if (strcmp(member, "StartedAt") != 0)
+                                break;
+                            StartedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CompletedAt"):
+                            if (strcmp(member, "CompletedAt") != 0)
+                                break;
+                            CompletedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readTaskInstanceStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PercentComplete"):
+                            if (strcmp(member, "PercentComplete") != 0)
+                                break;
+                            PercentComplete = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("EstimatedSecondsRemaining"):
+                            if (strcmp(member, "EstimatedSecondsRemaining") != 0)
+                                break;
+                            EstimatedSecondsRemaining = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledByUserId"):
+                            if (strcmp(member, "ScheduledByUserId") != 0)
+                                break;
+                            ScheduledByUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Type"):
+                            if (strcmp(member, "Type") != 0)
+                                break;
+                            Type = readScheduledTaskTypeFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTaskInstancesResult : public PlayFabBaseModel
         {
-            std::list<TaskInstanceBasicSummary> Summaries;
+            std::vector<TaskInstanceBasicSummary> Summaries;
 
             GetTaskInstancesResult() :
                 PlayFabBaseModel(),
@@ -9126,6 +14534,14 @@ namespace PlayFabComboSdk
                 Summaries(src.Summaries)
             {}
 
+            GetTaskInstancesResult(GetTaskInstancesResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Summaries(AZStd::move(src.Summaries))
+            {}
+
+            GetTaskInstancesResult& operator=(const GetTaskInstancesResult& src) = default;
+            GetTaskInstancesResult& operator=(GetTaskInstancesResult&& src) = default;
+
             GetTaskInstancesResult(const rapidjson::Value& obj) : GetTaskInstancesResult()
             {
                 readFromValue(obj);
@@ -9141,7 +14557,7 @@ namespace PlayFabComboSdk
                 if (!Summaries.empty()) {
                     writer.String("Summaries");
                     writer.StartArray();
-                    for (std::list<TaskInstanceBasicSummary>::iterator iter = Summaries.begin(); iter != Summaries.end(); iter++) {
+                    for (std::vector<TaskInstanceBasicSummary>::iterator iter = Summaries.begin(); iter != Summaries.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9154,13 +14570,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Summaries_member = obj.FindMember("Summaries");
                 if (Summaries_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Summaries_member->value;
+                    Summaries.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Summaries.push_back(TaskInstanceBasicSummary(memberList[i]));
+                        Summaries.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Summaries"):
+                            if (strcmp(member, "Summaries") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Summaries.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Summaries.emplace_back();
+                                    Summaries.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTasksRequest : public PlayFabBaseModel
@@ -9177,6 +14625,31 @@ namespace PlayFabComboSdk
                 Identifier(src.Identifier ? new NameIdentifier(*src.Identifier) : nullptr)
             {}
 
+            GetTasksRequest(GetTasksRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Identifier(src.Identifier)
+            {
+                src.Identifier = nullptr;
+            }
+
+            GetTasksRequest& operator=(const GetTasksRequest& src)
+            {
+                if (this != &src)
+                    *this = GetTasksRequest(src);
+                return *this;
+            }
+
+            GetTasksRequest& operator=(GetTasksRequest&& src)
+            {
+                if (this != &src)
+                {
+                    if (Identifier != nullptr) delete Identifier;
+                    Identifier = src.Identifier;
+                    src.Identifier = nullptr;
+                }
+                return *this;
+            }
+
             GetTasksRequest(const rapidjson::Value& obj) : GetTasksRequest()
             {
                 readFromValue(obj);
@@ -9204,6 +14677,30 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Identifier"):
+                            if (strcmp(member, "Identifier") != 0)
+                                break;
+                            Identifier = new NameIdentifier;
+                            Identifier->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ScheduledTask : public PlayFabBaseModel
@@ -9244,6 +14741,22 @@ namespace PlayFabComboSdk
                 NextRunTime(src.NextRunTime)
             {}
 
+            ScheduledTask(ScheduledTask&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskId(AZStd::move(src.TaskId)),
+                Name(AZStd::move(src.Name)),
+                Description(AZStd::move(src.Description)),
+                Schedule(AZStd::move(src.Schedule)),
+                IsActive(AZStd::move(src.IsActive)),
+                Type(AZStd::move(src.Type)),
+                Parameter(AZStd::move(src.Parameter)),
+                LastRunTime(AZStd::move(src.LastRunTime)),
+                NextRunTime(AZStd::move(src.NextRunTime))
+            {}
+
+            ScheduledTask& operator=(const ScheduledTask& src) = default;
+            ScheduledTask& operator=(ScheduledTask&& src) = default;
+
             ScheduledTask(const rapidjson::Value& obj) : ScheduledTask()
             {
                 readFromValue(obj);
@@ -9314,11 +14827,74 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskId"):
+                            if (strcmp(member, "TaskId") != 0)
+                                break;
+                            TaskId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Schedule"):
+                            if (strcmp(member, "Schedule") != 0)
+                                break;
+                            Schedule = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsActive"):
+                            if (strcmp(member, "IsActive") != 0)
+                                break;
+                            IsActive = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Type"):
+                            if (strcmp(member, "Type") != 0)
+                                break;
+                            Type = readScheduledTaskTypeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Parameter"):
+                            if (strcmp(member, "Parameter") != 0)
+                                break;
+                            Parameter.readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("LastRunTime"):
+                            if (strcmp(member, "LastRunTime") != 0)
+                                break;
+                            LastRunTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("NextRunTime"):
+                            if (strcmp(member, "NextRunTime") != 0)
+                                break;
+                            NextRunTime = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTasksResult : public PlayFabBaseModel
         {
-            std::list<ScheduledTask> Tasks;
+            std::vector<ScheduledTask> Tasks;
 
             GetTasksResult() :
                 PlayFabBaseModel(),
@@ -9330,6 +14906,14 @@ namespace PlayFabComboSdk
                 Tasks(src.Tasks)
             {}
 
+            GetTasksResult(GetTasksResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Tasks(AZStd::move(src.Tasks))
+            {}
+
+            GetTasksResult& operator=(const GetTasksResult& src) = default;
+            GetTasksResult& operator=(GetTasksResult&& src) = default;
+
             GetTasksResult(const rapidjson::Value& obj) : GetTasksResult()
             {
                 readFromValue(obj);
@@ -9345,7 +14929,7 @@ namespace PlayFabComboSdk
                 if (!Tasks.empty()) {
                     writer.String("Tasks");
                     writer.StartArray();
-                    for (std::list<ScheduledTask>::iterator iter = Tasks.begin(); iter != Tasks.end(); iter++) {
+                    for (std::vector<ScheduledTask>::iterator iter = Tasks.begin(); iter != Tasks.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9358,18 +14942,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tasks_member = obj.FindMember("Tasks");
                 if (Tasks_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tasks_member->value;
+                    Tasks.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tasks.push_back(ScheduledTask(memberList[i]));
+                        Tasks.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Tasks"):
+                            if (strcmp(member, "Tasks") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tasks.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tasks.emplace_back();
+                                    Tasks.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTitleDataRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
 
             GetTitleDataRequest() :
                 PlayFabBaseModel(),
@@ -9381,6 +14997,14 @@ namespace PlayFabComboSdk
                 Keys(src.Keys)
             {}
 
+            GetTitleDataRequest(GetTitleDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Keys(AZStd::move(src.Keys))
+            {}
+
+            GetTitleDataRequest& operator=(const GetTitleDataRequest& src) = default;
+            GetTitleDataRequest& operator=(GetTitleDataRequest&& src) = default;
+
             GetTitleDataRequest(const rapidjson::Value& obj) : GetTitleDataRequest()
             {
                 readFromValue(obj);
@@ -9396,7 +15020,7 @@ namespace PlayFabComboSdk
                 if (!Keys.empty()) {
                     writer.String("Keys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -9409,18 +15033,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTitleDataResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, AZStd::string> Data;
+            PlayFabStringMap<AZStd::string> Data;
 
             GetTitleDataResult() :
                 PlayFabBaseModel(),
@@ -9432,6 +15087,14 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetTitleDataResult(GetTitleDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetTitleDataResult& operator=(const GetTitleDataResult& src) = default;
+            GetTitleDataResult& operator=(GetTitleDataResult&& src) = default;
+
             GetTitleDataResult(const rapidjson::Value& obj) : GetTitleDataResult()
             {
                 readFromValue(obj);
@@ -9447,7 +15110,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -9467,6 +15130,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserBansRequest : public PlayFabBaseModel
@@ -9483,6 +15176,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            GetUserBansRequest(GetUserBansRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetUserBansRequest& operator=(const GetUserBansRequest& src) = default;
+            GetUserBansRequest& operator=(GetUserBansRequest&& src) = default;
+
             GetUserBansRequest(const rapidjson::Value& obj) : GetUserBansRequest()
             {
                 readFromValue(obj);
@@ -9507,11 +15208,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserBansResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             GetUserBansResult() :
                 PlayFabBaseModel(),
@@ -9523,6 +15247,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            GetUserBansResult(GetUserBansResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            GetUserBansResult& operator=(const GetUserBansResult& src) = default;
+            GetUserBansResult& operator=(GetUserBansResult&& src) = default;
+
             GetUserBansResult(const rapidjson::Value& obj) : GetUserBansResult()
             {
                 readFromValue(obj);
@@ -9538,7 +15270,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9551,19 +15283,51 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
             OptionalUint32 IfChangedFromDataVersion;
 
             GetUserDataRequest() :
@@ -9580,6 +15344,16 @@ namespace PlayFabComboSdk
                 IfChangedFromDataVersion(src.IfChangedFromDataVersion)
             {}
 
+            GetUserDataRequest(GetUserDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Keys(AZStd::move(src.Keys)),
+                IfChangedFromDataVersion(AZStd::move(src.IfChangedFromDataVersion))
+            {}
+
+            GetUserDataRequest& operator=(const GetUserDataRequest& src) = default;
+            GetUserDataRequest& operator=(GetUserDataRequest&& src) = default;
+
             GetUserDataRequest(const rapidjson::Value& obj) : GetUserDataRequest()
             {
                 readFromValue(obj);
@@ -9597,7 +15371,7 @@ namespace PlayFabComboSdk
                 if (!Keys.empty()) {
                     writer.String("Keys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -9616,8 +15390,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator IfChangedFromDataVersion_member = obj.FindMember("IfChangedFromDataVersion");
@@ -9625,6 +15400,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("IfChangedFromDataVersion"):
+                            if (strcmp(member, "IfChangedFromDataVersion") != 0)
+                                break;
+                            IfChangedFromDataVersion = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum UserDataPermission
@@ -9649,19 +15464,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<UserDataPermission>(obj.GetInt());
 
-            static std::map<const char *, UserDataPermission, PlayFabComboSdk::StringCompare> _UserDataPermissionMap;
-            if (_UserDataPermissionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _UserDataPermissionMap["Private"] = UserDataPermissionPrivate;
-                _UserDataPermissionMap["Public"] = UserDataPermissionPublic;
-
+            case PlayFabJsonReader::Hash("Private"): if (strcmp(name, "Private") == 0) return UserDataPermissionPrivate; break;
+            case PlayFabJsonReader::Hash("Public"): if (strcmp(name, "Public") == 0) return UserDataPermissionPublic; break;
             }
 
-            auto output = _UserDataPermissionMap.find(obj.GetString());
-            if (output != _UserDataPermissionMap.end())
-                return output->second;
-
             return UserDataPermissionPrivate; // Basically critical fail
         }
 
@@ -9685,6 +15495,16 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            UserDataRecord(UserDataRecord&& src) noexcept :
+                PlayFabBaseModel(),
+                Value(AZStd::move(src.Value)),
+                LastUpdated(AZStd::move(src.LastUpdated)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            UserDataRecord& operator=(const UserDataRecord& src) = default;
+            UserDataRecord& operator=(UserDataRecord&& src) = default;
+
             UserDataRecord(const rapidjson::Value& obj) : UserDataRecord()
             {
                 readFromValue(obj);
@@ -9721,13 +15541,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("LastUpdated"):
+                            if (strcmp(member, "LastUpdated") != 0)
+                                break;
+                            LastUpdated = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserDataResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             Uint32 DataVersion;
-            std::map<AZStd::string, UserDataRecord> Data;
+            PlayFabStringMap<UserDataRecord> Data;
 
             GetUserDataResult() :
                 PlayFabBaseModel(),
@@ -9743,6 +15596,16 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetUserDataResult(GetUserDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                DataVersion(AZStd::move(src.DataVersion)),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetUserDataResult& operator=(const GetUserDataResult& src) = default;
+            GetUserDataResult& operator=(GetUserDataResult&& src) = default;
+
             GetUserDataResult(const rapidjson::Value& obj) : GetUserDataResult()
             {
                 readFromValue(obj);
@@ -9764,7 +15627,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, UserDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<UserDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -9788,6 +15651,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DataVersion"):
+                            if (strcmp(member, "DataVersion") != 0)
+                                break;
+                            DataVersion = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserInventoryRequest : public PlayFabBaseModel
@@ -9804,6 +15707,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            GetUserInventoryRequest(GetUserInventoryRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetUserInventoryRequest& operator=(const GetUserInventoryRequest& src) = default;
+            GetUserInventoryRequest& operator=(GetUserInventoryRequest&& src) = default;
+
             GetUserInventoryRequest(const rapidjson::Value& obj) : GetUserInventoryRequest()
             {
                 readFromValue(obj);
@@ -9828,6 +15739,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ItemInstance : public PlayFabBaseModel
@@ -9845,8 +15779,8 @@ namespace PlayFabComboSdk
             AZStd::string DisplayName;
             AZStd::string UnitCurrency;
             Uint32 UnitPrice;
-            std::list<AZStd::string> BundleContents;
-            std::map<AZStd::string, AZStd::string> CustomData;
+            std::vector<AZStd::string> BundleContents;
+            PlayFabStringMap<AZStd::string> CustomData;
 
             ItemInstance() :
                 PlayFabBaseModel(),
@@ -9886,6 +15820,28 @@ namespace PlayFabComboSdk
                 CustomData(src.CustomData)
             {}
 
+            ItemInstance(ItemInstance&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                PurchaseDate(AZStd::move(src.PurchaseDate)),
+                Expiration(AZStd::move(src.Expiration)),
+                RemainingUses(AZStd::move(src.RemainingUses)),
+                UsesIncrementedBy(AZStd::move(src.UsesIncrementedBy)),
+                Annotation(AZStd::move(src.Annotation)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                BundleParent(AZStd::move(src.BundleParent)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                UnitCurrency(AZStd::move(src.UnitCurrency)),
+                UnitPrice(AZStd::move(src.UnitPrice)),
+                BundleContents(AZStd::move(src.BundleContents)),
+                CustomData(AZStd::move(src.CustomData))
+            {}
+
+            ItemInstance& operator=(const ItemInstance& src) = default;
+            ItemInstance& operator=(ItemInstance&& src) = default;
+
             ItemInstance(const rapidjson::Value& obj) : ItemInstance()
             {
                 readFromValue(obj);
@@ -9951,7 +15907,7 @@ namespace PlayFabComboSdk
                 if (!BundleContents.empty()) {
                     writer.String("BundleContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -9959,7 +15915,7 @@ namespace PlayFabComboSdk
                 if (!CustomData.empty()) {
                     writer.String("CustomData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -9999,8 +15955,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundleContents_member = obj.FindMember("BundleContents");
                 if (BundleContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundleContents_member->value;
+                    BundleContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundleContents.push_back(memberList[i].GetString());
+                        BundleContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -10012,6 +15969,113 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PurchaseDate"):
+                            if (strcmp(member, "PurchaseDate") != 0)
+                                break;
+                            PurchaseDate = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expiration"):
+                            if (strcmp(member, "Expiration") != 0)
+                                break;
+                            Expiration = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsesIncrementedBy"):
+                            if (strcmp(member, "UsesIncrementedBy") != 0)
+                                break;
+                            UsesIncrementedBy = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleParent"):
+                            if (strcmp(member, "BundleParent") != 0)
+                                break;
+                            BundleParent = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitCurrency"):
+                            if (strcmp(member, "UnitCurrency") != 0)
+                                break;
+                            UnitCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitPrice"):
+                            if (strcmp(member, "UnitPrice") != 0)
+                                break;
+                            UnitPrice = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleContents"):
+                            if (strcmp(member, "BundleContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundleContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundleContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CustomData[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct VirtualCurrencyRechargeTime : public PlayFabBaseModel
@@ -10034,6 +16098,16 @@ namespace PlayFabComboSdk
                 RechargeMax(src.RechargeMax)
             {}
 
+            VirtualCurrencyRechargeTime(VirtualCurrencyRechargeTime&& src) noexcept :
+                PlayFabBaseModel(),
+                SecondsToRecharge(AZStd::move(src.SecondsToRecharge)),
+                RechargeTime(AZStd::move(src.RechargeTime)),
+                RechargeMax(AZStd::move(src.RechargeMax))
+            {}
+
+            VirtualCurrencyRechargeTime& operator=(const VirtualCurrencyRechargeTime& src) = default;
+            VirtualCurrencyRechargeTime& operator=(VirtualCurrencyRechargeTime&& src) = default;
+
             VirtualCurrencyRechargeTime(const rapidjson::Value& obj) : VirtualCurrencyRechargeTime()
             {
                 readFromValue(obj);
@@ -10066,14 +16140,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecondsToRecharge"):
+                            if (strcmp(member, "SecondsToRecharge") != 0)
+                                break;
+                            SecondsToRecharge = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeTime"):
+                            if (strcmp(member, "RechargeTime") != 0)
+                                break;
+                            RechargeTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeMax"):
+                            if (strcmp(member, "RechargeMax") != 0)
+                                break;
+                            RechargeMax = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserInventoryResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<ItemInstance> Inventory;
-            std::map<AZStd::string, Int32> VirtualCurrency;
-            std::map<AZStd::string, VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
+            std::vector<ItemInstance> Inventory;
+            PlayFabStringMap<Int32> VirtualCurrency;
+            PlayFabStringMap<VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
 
             GetUserInventoryResult() :
                 PlayFabBaseModel(),
@@ -10091,6 +16198,17 @@ namespace PlayFabComboSdk
                 VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+            GetUserInventoryResult(GetUserInventoryResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Inventory(AZStd::move(src.Inventory)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                VirtualCurrencyRechargeTimes(AZStd::move(src.VirtualCurrencyRechargeTimes))
+            {}
+
+            GetUserInventoryResult& operator=(const GetUserInventoryResult& src) = default;
+            GetUserInventoryResult& operator=(GetUserInventoryResult&& src) = default;
+
             GetUserInventoryResult(const rapidjson::Value& obj) : GetUserInventoryResult()
             {
                 readFromValue(obj);
@@ -10110,7 +16228,7 @@ namespace PlayFabComboSdk
                 if (!Inventory.empty()) {
                     writer.String("Inventory");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10118,7 +16236,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrency.empty()) {
                     writer.String("VirtualCurrency");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -10127,7 +16245,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyRechargeTimes.empty()) {
                     writer.String("VirtualCurrencyRechargeTimes");
                     writer.StartObject();
-                    for (std::map<AZStd::string, VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
+                    for (PlayFabStringMap<VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -10143,8 +16261,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Inventory_member = obj.FindMember("Inventory");
                 if (Inventory_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Inventory_member->value;
+                    Inventory.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Inventory.push_back(ItemInstance(memberList[i]));
+                        Inventory.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrency_member = obj.FindMember("VirtualCurrency");
@@ -10162,6 +16281,66 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Inventory"):
+                            if (strcmp(member, "Inventory") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Inventory.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Inventory.emplace_back();
+                                    Inventory.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrency[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+                            if (strcmp(member, "VirtualCurrencyRechargeTimes") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyRechargeTimes[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantedItemInstance : public PlayFabBaseModel
@@ -10182,8 +16361,8 @@ namespace PlayFabComboSdk
             AZStd::string DisplayName;
             AZStd::string UnitCurrency;
             Uint32 UnitPrice;
-            std::list<AZStd::string> BundleContents;
-            std::map<AZStd::string, AZStd::string> CustomData;
+            std::vector<AZStd::string> BundleContents;
+            PlayFabStringMap<AZStd::string> CustomData;
 
             GrantedItemInstance() :
                 PlayFabBaseModel(),
@@ -10229,6 +16408,31 @@ namespace PlayFabComboSdk
                 CustomData(src.CustomData)
             {}
 
+            GrantedItemInstance(GrantedItemInstance&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Result(AZStd::move(src.Result)),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                PurchaseDate(AZStd::move(src.PurchaseDate)),
+                Expiration(AZStd::move(src.Expiration)),
+                RemainingUses(AZStd::move(src.RemainingUses)),
+                UsesIncrementedBy(AZStd::move(src.UsesIncrementedBy)),
+                Annotation(AZStd::move(src.Annotation)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                BundleParent(AZStd::move(src.BundleParent)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                UnitCurrency(AZStd::move(src.UnitCurrency)),
+                UnitPrice(AZStd::move(src.UnitPrice)),
+                BundleContents(AZStd::move(src.BundleContents)),
+                CustomData(AZStd::move(src.CustomData))
+            {}
+
+            GrantedItemInstance& operator=(const GrantedItemInstance& src) = default;
+            GrantedItemInstance& operator=(GrantedItemInstance&& src) = default;
+
             GrantedItemInstance(const rapidjson::Value& obj) : GrantedItemInstance()
             {
                 readFromValue(obj);
@@ -10304,7 +16508,7 @@ namespace PlayFabComboSdk
                 if (!BundleContents.empty()) {
                     writer.String("BundleContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -10312,7 +16516,7 @@ namespace PlayFabComboSdk
                 if (!CustomData.empty()) {
                     writer.String("CustomData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -10358,8 +16562,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundleContents_member = obj.FindMember("BundleContents");
                 if (BundleContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundleContents_member->value;
+                    BundleContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundleContents.push_back(memberList[i].GetString());
+                        BundleContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -10371,6 +16576,128 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Result"):
+                            if (strcmp(member, "Result") != 0)
+                                break;
+                            Result = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PurchaseDate"):
+                            if (strcmp(member, "PurchaseDate") != 0)
+                                break;
+                            PurchaseDate = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expiration"):
+                            if (strcmp(member, "Expiration") != 0)
+                                break;
+                            Expiration = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsesIncrementedBy"):
+                            if (strcmp(member, "UsesIncrementedBy") != 0)
+                                break;
+                            UsesIncrementedBy = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleParent"):
+                            if (strcmp(member, "BundleParent") != 0)
+                                break;
+                            BundleParent = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitCurrency"):
+                            if (strcmp(member, "UnitCurrency") != 0)
+                                break;
+                            UnitCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitPrice"):
+                            if (strcmp(member, "UnitPrice") != 0)
+                                break;
+                            UnitPrice = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleContents"):
+                            if (strcmp(member, "BundleContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundleContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundleContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CustomData[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ItemGrant : public PlayFabBaseModel
@@ -10379,8 +16706,8 @@ namespace PlayFabComboSdk
             AZStd::string ItemId;
             AZStd::string Annotation;
             AZStd::string CharacterId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
 
             ItemGrant() :
                 PlayFabBaseModel(),
@@ -10402,6 +16729,19 @@ namespace PlayFabComboSdk
                 KeysToRemove(src.KeysToRemove)
             {}
 
+            ItemGrant(ItemGrant&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                ItemId(AZStd::move(src.ItemId)),
+                Annotation(AZStd::move(src.Annotation)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove))
+            {}
+
+            ItemGrant& operator=(const ItemGrant& src) = default;
+            ItemGrant& operator=(ItemGrant&& src) = default;
+
             ItemGrant(const rapidjson::Value& obj) : ItemGrant()
             {
                 readFromValue(obj);
@@ -10429,7 +16769,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -10438,7 +16778,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -10465,19 +16805,82 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToUsersRequest : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
-            std::list<ItemGrant> ItemGrants;
+            std::vector<ItemGrant> ItemGrants;
 
             GrantItemsToUsersRequest() :
                 PlayFabBaseModel(),
@@ -10491,6 +16894,15 @@ namespace PlayFabComboSdk
                 ItemGrants(src.ItemGrants)
             {}
 
+            GrantItemsToUsersRequest(GrantItemsToUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                ItemGrants(AZStd::move(src.ItemGrants))
+            {}
+
+            GrantItemsToUsersRequest& operator=(const GrantItemsToUsersRequest& src) = default;
+            GrantItemsToUsersRequest& operator=(GrantItemsToUsersRequest&& src) = default;
+
             GrantItemsToUsersRequest(const rapidjson::Value& obj) : GrantItemsToUsersRequest()
             {
                 readFromValue(obj);
@@ -10509,7 +16921,7 @@ namespace PlayFabComboSdk
                 }
                 writer.String("ItemGrants");
                 writer.StartArray();
-                for (std::list<ItemGrant>::iterator iter = ItemGrants.begin(); iter != ItemGrants.end(); iter++) {
+                for (std::vector<ItemGrant>::iterator iter = ItemGrants.begin(); iter != ItemGrants.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -10523,18 +16935,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemGrants_member = obj.FindMember("ItemGrants");
                 if (ItemGrants_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemGrants_member->value;
+                    ItemGrants.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemGrants.push_back(ItemGrant(memberList[i]));
+                        ItemGrants.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemGrants"):
+                            if (strcmp(member, "ItemGrants") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemGrants.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemGrants.emplace_back();
+                                    ItemGrants.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToUsersResult : public PlayFabBaseModel
         {
-            std::list<GrantedItemInstance> ItemGrantResults;
+            std::vector<GrantedItemInstance> ItemGrantResults;
 
             GrantItemsToUsersResult() :
                 PlayFabBaseModel(),
@@ -10546,6 +16995,14 @@ namespace PlayFabComboSdk
                 ItemGrantResults(src.ItemGrantResults)
             {}
 
+            GrantItemsToUsersResult(GrantItemsToUsersResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemGrantResults(AZStd::move(src.ItemGrantResults))
+            {}
+
+            GrantItemsToUsersResult& operator=(const GrantItemsToUsersResult& src) = default;
+            GrantItemsToUsersResult& operator=(GrantItemsToUsersResult&& src) = default;
+
             GrantItemsToUsersResult(const rapidjson::Value& obj) : GrantItemsToUsersResult()
             {
                 readFromValue(obj);
@@ -10561,7 +17018,7 @@ namespace PlayFabComboSdk
                 if (!ItemGrantResults.empty()) {
                     writer.String("ItemGrantResults");
                     writer.StartArray();
-                    for (std::list<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
+                    for (std::vector<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10574,13 +17031,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemGrantResults_member = obj.FindMember("ItemGrantResults");
                 if (ItemGrantResults_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemGrantResults_member->value;
+                    ItemGrantResults.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemGrantResults.push_back(GrantedItemInstance(memberList[i]));
+                        ItemGrantResults.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemGrantResults"):
+                            if (strcmp(member, "ItemGrantResults") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemGrantResults.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemGrantResults.emplace_back();
+                                    ItemGrantResults.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct IncrementPlayerStatisticVersionRequest : public PlayFabBaseModel
@@ -10597,6 +17086,14 @@ namespace PlayFabComboSdk
                 StatisticName(src.StatisticName)
             {}
 
+            IncrementPlayerStatisticVersionRequest(IncrementPlayerStatisticVersionRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName))
+            {}
+
+            IncrementPlayerStatisticVersionRequest& operator=(const IncrementPlayerStatisticVersionRequest& src) = default;
+            IncrementPlayerStatisticVersionRequest& operator=(IncrementPlayerStatisticVersionRequest&& src) = default;
+
             IncrementPlayerStatisticVersionRequest(const rapidjson::Value& obj) : IncrementPlayerStatisticVersionRequest()
             {
                 readFromValue(obj);
@@ -10623,6 +17120,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct IncrementPlayerStatisticVersionResult : public PlayFabBaseModel
@@ -10639,6 +17159,31 @@ namespace PlayFabComboSdk
                 StatisticVersion(src.StatisticVersion ? new PlayerStatisticVersion(*src.StatisticVersion) : nullptr)
             {}
 
+            IncrementPlayerStatisticVersionResult(IncrementPlayerStatisticVersionResult&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticVersion(src.StatisticVersion)
+            {
+                src.StatisticVersion = nullptr;
+            }
+
+            IncrementPlayerStatisticVersionResult& operator=(const IncrementPlayerStatisticVersionResult& src)
+            {
+                if (this != &src)
+                    *this = IncrementPlayerStatisticVersionResult(src);
+                return *this;
+            }
+
+            IncrementPlayerStatisticVersionResult& operator=(IncrementPlayerStatisticVersionResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (StatisticVersion != nullptr) delete StatisticVersion;
+                    StatisticVersion = src.StatisticVersion;
+                    src.StatisticVersion = nullptr;
+                }
+                return *this;
+            }
+
             IncrementPlayerStatisticVersionResult(const rapidjson::Value& obj) : IncrementPlayerStatisticVersionResult()
             {
                 readFromValue(obj);
@@ -10666,6 +17211,30 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticVersion"):
+                            if (strcmp(member, "StatisticVersion") != 0)
+                                break;
+                            StatisticVersion = new PlayerStatisticVersion;
+                            StatisticVersion->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ListBuildsRequest : public PlayFabBaseModel
@@ -10679,6 +17248,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            ListBuildsRequest(ListBuildsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            ListBuildsRequest& operator=(const ListBuildsRequest& src) = default;
+            ListBuildsRequest& operator=(ListBuildsRequest&& src) = default;
+
             ListBuildsRequest(const rapidjson::Value& obj) : ListBuildsRequest()
             {
                 readFromValue(obj);
@@ -10699,11 +17275,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct ListBuildsResult : public PlayFabBaseModel
         {
-            std::list<GetServerBuildInfoResult> Builds;
+            std::vector<GetServerBuildInfoResult> Builds;
 
             ListBuildsResult() :
                 PlayFabBaseModel(),
@@ -10715,6 +17297,14 @@ namespace PlayFabComboSdk
                 Builds(src.Builds)
             {}
 
+            ListBuildsResult(ListBuildsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Builds(AZStd::move(src.Builds))
+            {}
+
+            ListBuildsResult& operator=(const ListBuildsResult& src) = default;
+            ListBuildsResult& operator=(ListBuildsResult&& src) = default;
+
             ListBuildsResult(const rapidjson::Value& obj) : ListBuildsResult()
             {
                 readFromValue(obj);
@@ -10730,7 +17320,7 @@ namespace PlayFabComboSdk
                 if (!Builds.empty()) {
                     writer.String("Builds");
                     writer.StartArray();
-                    for (std::list<GetServerBuildInfoResult>::iterator iter = Builds.begin(); iter != Builds.end(); iter++) {
+                    for (std::vector<GetServerBuildInfoResult>::iterator iter = Builds.begin(); iter != Builds.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10743,13 +17333,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Builds_member = obj.FindMember("Builds");
                 if (Builds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Builds_member->value;
+                    Builds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Builds.push_back(GetServerBuildInfoResult(memberList[i]));
+                        Builds.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Builds"):
+                            if (strcmp(member, "Builds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Builds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Builds.emplace_back();
+                                    Builds.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ListVirtualCurrencyTypesRequest : public PlayFabBaseModel
@@ -10763,6 +17385,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            ListVirtualCurrencyTypesRequest(ListVirtualCurrencyTypesRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            ListVirtualCurrencyTypesRequest& operator=(const ListVirtualCurrencyTypesRequest& src) = default;
+            ListVirtualCurrencyTypesRequest& operator=(ListVirtualCurrencyTypesRequest&& src) = default;
+
             ListVirtualCurrencyTypesRequest(const rapidjson::Value& obj) : ListVirtualCurrencyTypesRequest()
             {
                 readFromValue(obj);
@@ -10783,11 +17412,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct ListVirtualCurrencyTypesResult : public PlayFabBaseModel
         {
-            std::list<VirtualCurrencyData> VirtualCurrencies;
+            std::vector<VirtualCurrencyData> VirtualCurrencies;
 
             ListVirtualCurrencyTypesResult() :
                 PlayFabBaseModel(),
@@ -10799,6 +17434,14 @@ namespace PlayFabComboSdk
                 VirtualCurrencies(src.VirtualCurrencies)
             {}
 
+            ListVirtualCurrencyTypesResult(ListVirtualCurrencyTypesResult&& src) noexcept :
+                PlayFabBaseModel(),
+                VirtualCurrencies(AZStd::move(src.VirtualCurrencies))
+            {}
+
+            ListVirtualCurrencyTypesResult& operator=(const ListVirtualCurrencyTypesResult& src) = default;
+            ListVirtualCurrencyTypesResult& operator=(ListVirtualCurrencyTypesResult&& src) = default;
+
             ListVirtualCurrencyTypesResult(const rapidjson::Value& obj) : ListVirtualCurrencyTypesResult()
             {
                 readFromValue(obj);
@@ -10814,7 +17457,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencies.empty()) {
                     writer.String("VirtualCurrencies");
                     writer.StartArray();
-                    for (std::list<VirtualCurrencyData>::iterator iter = VirtualCurrencies.begin(); iter != VirtualCurrencies.end(); iter++) {
+                    for (std::vector<VirtualCurrencyData>::iterator iter = VirtualCurrencies.begin(); iter != VirtualCurrencies.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10827,13 +17470,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator VirtualCurrencies_member = obj.FindMember("VirtualCurrencies");
                 if (VirtualCurrencies_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = VirtualCurrencies_member->value;
+                    VirtualCurrencies.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        VirtualCurrencies.push_back(VirtualCurrencyData(memberList[i]));
+                        VirtualCurrencies.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("VirtualCurrencies"):
+                            if (strcmp(member, "VirtualCurrencies") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                VirtualCurrencies.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    VirtualCurrencies.emplace_back();
+                                    VirtualCurrencies.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct LookupUserAccountInfoRequest : public PlayFabBaseModel
@@ -10859,6 +17534,17 @@ namespace PlayFabComboSdk
                 TitleDisplayName(src.TitleDisplayName)
             {}
 
+            LookupUserAccountInfoRequest(LookupUserAccountInfoRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Email(AZStd::move(src.Email)),
+                Username(AZStd::move(src.Username)),
+                TitleDisplayName(AZStd::move(src.TitleDisplayName))
+            {}
+
+            LookupUserAccountInfoRequest& operator=(const LookupUserAccountInfoRequest& src) = default;
+            LookupUserAccountInfoRequest& operator=(LookupUserAccountInfoRequest&& src) = default;
+
             LookupUserAccountInfoRequest(const rapidjson::Value& obj) : LookupUserAccountInfoRequest()
             {
                 readFromValue(obj);
@@ -10903,6 +17589,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleDisplayName"):
+                            if (strcmp(member, "TitleDisplayName") != 0)
+                                break;
+                            TitleDisplayName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum UserOrigination
@@ -10959,34 +17683,29 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<UserOrigination>(obj.GetInt());
 
-            static std::map<const char *, UserOrigination, PlayFabComboSdk::StringCompare> _UserOriginationMap;
-            if (_UserOriginationMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _UserOriginationMap["Organic"] = UserOriginationOrganic;
-                _UserOriginationMap["Steam"] = UserOriginationSteam;
-                _UserOriginationMap["Google"] = UserOriginationGoogle;
-                _UserOriginationMap["Amazon"] = UserOriginationAmazon;
-                _UserOriginationMap["Facebook"] = UserOriginationFacebook;
-                _UserOriginationMap["Kongregate"] = UserOriginationKongregate;
-                _UserOriginationMap["GamersFirst"] = UserOriginationGamersFirst;
-                _UserOriginationMap["Unknown"] = UserOriginationUnknown;
-                _UserOriginationMap["IOS"] = UserOriginationIOS;
-                _UserOriginationMap["LoadTest"] = UserOriginationLoadTest;
-                _UserOriginationMap["Android"] = UserOriginationAndroid;
-                _UserOriginationMap["PSN"] = UserOriginationPSN;
-                _UserOriginationMap["GameCenter"] = UserOriginationGameCenter;
-                _UserOriginationMap["CustomId"] = UserOriginationCustomId;
-                _UserOriginationMap["XboxLive"] = UserOriginationXboxLive;
-                _UserOriginationMap["Parse"] = UserOriginationParse;
-                _UserOriginationMap["Twitch"] = UserOriginationTwitch;
-                _UserOriginationMap["WindowsHello"] = UserOriginationWindowsHello;
-
-            }
-
-            auto output = _UserOriginationMap.find(obj.GetString());
-            if (output != _UserOriginationMap.end())
-                return output->second;
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("Organic"): if (strcmp(name, "Organic") == 0) return UserOriginationOrganic; break;
+            case PlayFabJsonReader::Hash("Steam"): if (strcmp(name, "Steam") == 0) return UserOriginationSteam; break;
+            case PlayFabJsonReader::Hash("Google"): if (strcmp(name, "Google") == 0) return UserOriginationGoogle; break;
+            case PlayFabJsonReader::Hash("Amazon"): if (strcmp(name, "Amazon") == 0) return UserOriginationAmazon; break;
+            case PlayFabJsonReader::Hash("Facebook"): if (strcmp(name, "Facebook") == 0) return UserOriginationFacebook; break;
+            case PlayFabJsonReader::Hash("Kongregate"): if (strcmp(name, "Kongregate") == 0) return UserOriginationKongregate; break;
+            case PlayFabJsonReader::Hash("GamersFirst"): if (strcmp(name, "GamersFirst") == 0) return UserOriginationGamersFirst; break;
+            case PlayFabJsonReader::Hash("Unknown"): if (strcmp(name, "Unknown") == 0) return UserOriginationUnknown; break;
+            case PlayFabJsonReader::Hash("IOS"): if (strcmp(name, "IOS") == 0) return UserOriginationIOS; break;
+            case PlayFabJsonReader::Hash("LoadTest"): if (strcmp(name, "LoadTest") == 0) return UserOriginationLoadTest; break;
+            case PlayFabJsonReader::Hash("Android"): if (strcmp(name, "Android") == 0) return UserOriginationAndroid; break;
+            case PlayFabJsonReader::Hash("PSN"): if (strcmp(name, "PSN") == 0) return UserOriginationPSN; break;
+            case PlayFabJsonReader::Hash("GameCenter"): if (strcmp(name, "GameCenter") == 0) return UserOriginationGameCenter; break;
+            case PlayFabJsonReader::Hash("CustomId"): if (strcmp(name, "CustomId") == 0) return UserOriginationCustomId; break;
+            case PlayFabJsonReader::Hash("XboxLive"): if (strcmp(name, "XboxLive") == 0) return UserOriginationXboxLive; break;
+            case PlayFabJsonReader::Hash("Parse"): if (strcmp(name, "Parse") == 0) return UserOriginationParse; break;
+            case PlayFabJsonReader::Hash("Twitch"): if (strcmp(name, "Twitch") == 0) return UserOriginationTwitch; break;
+            case PlayFabJsonReader::Hash("WindowsHello"): if (strcmp(name, "WindowsHello") == 0) return UserOriginationWindowsHello; break;
+            }
 
             return UserOriginationOrganic; // Basically critical fail
         }
@@ -11023,6 +17742,20 @@ namespace PlayFabComboSdk
                 AvatarUrl(src.AvatarUrl)
             {}
 
+            UserTitleInfo(UserTitleInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                DisplayName(AZStd::move(src.DisplayName)),
+                Origination(AZStd::move(src.Origination)),
+                Created(AZStd::move(src.Created)),
+                LastLogin(AZStd::move(src.LastLogin)),
+                FirstLogin(AZStd::move(src.FirstLogin)),
+                isBanned(AZStd::move(src.isBanned)),
+                AvatarUrl(AZStd::move(src.AvatarUrl))
+            {}
+
+            UserTitleInfo& operator=(const UserTitleInfo& src) = default;
+            UserTitleInfo& operator=(UserTitleInfo&& src) = default;
+
             UserTitleInfo(const rapidjson::Value& obj) : UserTitleInfo()
             {
                 readFromValue(obj);
@@ -11083,6 +17816,59 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Origination"):
+                            if (strcmp(member, "Origination") != 0)
+                                break;
+                            Origination = readUserOriginationFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("LastLogin"):
+                            if (strcmp(member, "LastLogin") != 0)
+                                break;
+                            LastLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("FirstLogin"):
+                            if (strcmp(member, "FirstLogin") != 0)
+                                break;
+                            FirstLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("isBanned"):
+                            if (strcmp(member, "isBanned") != 0)
+                                break;
+                            isBanned = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("AvatarUrl"):
+                            if (strcmp(member, "AvatarUrl") != 0)
+                                break;
+                            AvatarUrl = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserPrivateAccountInfo : public PlayFabBaseModel
@@ -11099,6 +17885,14 @@ namespace PlayFabComboSdk
                 Email(src.Email)
             {}
 
+            UserPrivateAccountInfo(UserPrivateAccountInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                Email(AZStd::move(src.Email))
+            {}
+
+            UserPrivateAccountInfo& operator=(const UserPrivateAccountInfo& src) = default;
+            UserPrivateAccountInfo& operator=(UserPrivateAccountInfo&& src) = default;
+
             UserPrivateAccountInfo(const rapidjson::Value& obj) : UserPrivateAccountInfo()
             {
                 readFromValue(obj);
@@ -11125,6 +17919,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserFacebookInfo : public PlayFabBaseModel
@@ -11144,6 +17961,15 @@ namespace PlayFabComboSdk
                 FullName(src.FullName)
             {}
 
+            UserFacebookInfo(UserFacebookInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                FacebookId(AZStd::move(src.FacebookId)),
+                FullName(AZStd::move(src.FullName))
+            {}
+
+            UserFacebookInfo& operator=(const UserFacebookInfo& src) = default;
+            UserFacebookInfo& operator=(UserFacebookInfo&& src) = default;
+
             UserFacebookInfo(const rapidjson::Value& obj) : UserFacebookInfo()
             {
                 readFromValue(obj);
@@ -11176,6 +18002,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FacebookId"):
+                            if (strcmp(member, "FacebookId") != 0)
+                                break;
+                            FacebookId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FullName"):
+                            if (strcmp(member, "FullName") != 0)
+                                break;
+                            FullName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum TitleActivationStatus
@@ -11206,22 +18060,17 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<TitleActivationStatus>(obj.GetInt());
 
-            static std::map<const char *, TitleActivationStatus, PlayFabComboSdk::StringCompare> _TitleActivationStatusMap;
-            if (_TitleActivationStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _TitleActivationStatusMap["None"] = TitleActivationStatusNone;
-                _TitleActivationStatusMap["ActivatedTitleKey"] = TitleActivationStatusActivatedTitleKey;
-                _TitleActivationStatusMap["PendingSteam"] = TitleActivationStatusPendingSteam;
-                _TitleActivationStatusMap["ActivatedSteam"] = TitleActivationStatusActivatedSteam;
-                _TitleActivationStatusMap["RevokedSteam"] = TitleActivationStatusRevokedSteam;
-
+            case PlayFabJsonReader::Hash("None"): if (strcmp(name, "None") == 0) return TitleActivationStatusNone; break;
+            case PlayFabJsonReader::Hash("ActivatedTitleKey"): if (strcmp(name, "ActivatedTitleKey") == 0) return TitleActivationStatusActivatedTitleKey; break;
+            case PlayFabJsonReader::Hash("PendingSteam"): if (strcmp(name, "PendingSteam") == 0) return TitleActivationStatusPendingSteam; break;
+            case PlayFabJsonReader::Hash("ActivatedSteam"): if (strcmp(name, "ActivatedSteam") == 0) return TitleActivationStatusActivatedSteam; break;
+            case PlayFabJsonReader::Hash("RevokedSteam"): if (strcmp(name, "RevokedSteam") == 0) return TitleActivationStatusRevokedSteam; break;
             }
 
-            auto output = _TitleActivationStatusMap.find(obj.GetString());
-            if (output != _TitleActivationStatusMap.end())
-                return output->second;
-
             return TitleActivationStatusNone; // Basically critical fail
         }
 
@@ -11248,6 +18097,17 @@ namespace PlayFabComboSdk
                 SteamActivationStatus(src.SteamActivationStatus)
             {}
 
+            UserSteamInfo(UserSteamInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                SteamId(AZStd::move(src.SteamId)),
+                SteamCountry(AZStd::move(src.SteamCountry)),
+                SteamCurrency(AZStd::move(src.SteamCurrency)),
+                SteamActivationStatus(AZStd::move(src.SteamActivationStatus))
+            {}
+
+            UserSteamInfo& operator=(const UserSteamInfo& src) = default;
+            UserSteamInfo& operator=(UserSteamInfo&& src) = default;
+
             UserSteamInfo(const rapidjson::Value& obj) : UserSteamInfo()
             {
                 readFromValue(obj);
@@ -11292,6 +18152,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SteamId"):
+                            if (strcmp(member, "SteamId") != 0)
+                                break;
+                            SteamId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamCountry"):
+                            if (strcmp(member, "SteamCountry") != 0)
+                                break;
+                            SteamCountry = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamCurrency"):
+                            if (strcmp(member, "SteamCurrency") != 0)
+                                break;
+                            SteamCurrency = readCurrencyFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamActivationStatus"):
+                            if (strcmp(member, "SteamActivationStatus") != 0)
+                                break;
+                            SteamActivationStatus = readTitleActivationStatusFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserGameCenterInfo : public PlayFabBaseModel
@@ -11308,6 +18206,14 @@ namespace PlayFabComboSdk
                 GameCenterId(src.GameCenterId)
             {}
 
+            UserGameCenterInfo(UserGameCenterInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                GameCenterId(AZStd::move(src.GameCenterId))
+            {}
+
+            UserGameCenterInfo& operator=(const UserGameCenterInfo& src) = default;
+            UserGameCenterInfo& operator=(UserGameCenterInfo&& src) = default;
+
             UserGameCenterInfo(const rapidjson::Value& obj) : UserGameCenterInfo()
             {
                 readFromValue(obj);
@@ -11334,6 +18240,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GameCenterId"):
+                            if (strcmp(member, "GameCenterId") != 0)
+                                break;
+                            GameCenterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserIosDeviceInfo : public PlayFabBaseModel
@@ -11350,6 +18279,14 @@ namespace PlayFabComboSdk
                 IosDeviceId(src.IosDeviceId)
             {}
 
+            UserIosDeviceInfo(UserIosDeviceInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                IosDeviceId(AZStd::move(src.IosDeviceId))
+            {}
+
+            UserIosDeviceInfo& operator=(const UserIosDeviceInfo& src) = default;
+            UserIosDeviceInfo& operator=(UserIosDeviceInfo&& src) = default;
+
             UserIosDeviceInfo(const rapidjson::Value& obj) : UserIosDeviceInfo()
             {
                 readFromValue(obj);
@@ -11376,6 +18313,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("IosDeviceId"):
+                            if (strcmp(member, "IosDeviceId") != 0)
+                                break;
+                            IosDeviceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserAndroidDeviceInfo : public PlayFabBaseModel
@@ -11392,6 +18352,14 @@ namespace PlayFabComboSdk
                 AndroidDeviceId(src.AndroidDeviceId)
             {}
 
+            UserAndroidDeviceInfo(UserAndroidDeviceInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                AndroidDeviceId(AZStd::move(src.AndroidDeviceId))
+            {}
+
+            UserAndroidDeviceInfo& operator=(const UserAndroidDeviceInfo& src) = default;
+            UserAndroidDeviceInfo& operator=(UserAndroidDeviceInfo&& src) = default;
+
             UserAndroidDeviceInfo(const rapidjson::Value& obj) : UserAndroidDeviceInfo()
             {
                 readFromValue(obj);
@@ -11418,6 +18386,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("AndroidDeviceId"):
+                            if (strcmp(member, "AndroidDeviceId") != 0)
+                                break;
+                            AndroidDeviceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserKongregateInfo : public PlayFabBaseModel
@@ -11437,6 +18428,15 @@ namespace PlayFabComboSdk
                 KongregateName(src.KongregateName)
             {}
 
+            UserKongregateInfo(UserKongregateInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                KongregateId(AZStd::move(src.KongregateId)),
+                KongregateName(AZStd::move(src.KongregateName))
+            {}
+
+            UserKongregateInfo& operator=(const UserKongregateInfo& src) = default;
+            UserKongregateInfo& operator=(UserKongregateInfo&& src) = default;
+
             UserKongregateInfo(const rapidjson::Value& obj) : UserKongregateInfo()
             {
                 readFromValue(obj);
@@ -11469,6 +18469,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("KongregateId"):
+                            if (strcmp(member, "KongregateId") != 0)
+                                break;
+                            KongregateId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("KongregateName"):
+                            if (strcmp(member, "KongregateName") != 0)
+                                break;
+                            KongregateName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserTwitchInfo : public PlayFabBaseModel
@@ -11488,6 +18516,15 @@ namespace PlayFabComboSdk
                 TwitchUserName(src.TwitchUserName)
             {}
 
+            UserTwitchInfo(UserTwitchInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                TwitchId(AZStd::move(src.TwitchId)),
+                TwitchUserName(AZStd::move(src.TwitchUserName))
+            {}
+
+            UserTwitchInfo& operator=(const UserTwitchInfo& src) = default;
+            UserTwitchInfo& operator=(UserTwitchInfo&& src) = default;
+
             UserTwitchInfo(const rapidjson::Value& obj) : UserTwitchInfo()
             {
                 readFromValue(obj);
@@ -11520,6 +18557,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TwitchId"):
+                            if (strcmp(member, "TwitchId") != 0)
+                                break;
+                            TwitchId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TwitchUserName"):
+                            if (strcmp(member, "TwitchUserName") != 0)
+                                break;
+                            TwitchUserName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserPsnInfo : public PlayFabBaseModel
@@ -11539,6 +18604,15 @@ namespace PlayFabComboSdk
                 PsnOnlineId(src.PsnOnlineId)
             {}
 
+            UserPsnInfo(UserPsnInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                PsnAccountId(AZStd::move(src.PsnAccountId)),
+                PsnOnlineId(AZStd::move(src.PsnOnlineId))
+            {}
+
+            UserPsnInfo& operator=(const UserPsnInfo& src) = default;
+            UserPsnInfo& operator=(UserPsnInfo&& src) = default;
+
             UserPsnInfo(const rapidjson::Value& obj) : UserPsnInfo()
             {
                 readFromValue(obj);
@@ -11571,6 +18645,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PsnAccountId"):
+                            if (strcmp(member, "PsnAccountId") != 0)
+                                break;
+                            PsnAccountId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PsnOnlineId"):
+                            if (strcmp(member, "PsnOnlineId") != 0)
+                                break;
+                            PsnOnlineId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserGoogleInfo : public PlayFabBaseModel
@@ -11596,6 +18698,17 @@ namespace PlayFabComboSdk
                 GoogleGender(src.GoogleGender)
             {}
 
+            UserGoogleInfo(UserGoogleInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                GoogleId(AZStd::move(src.GoogleId)),
+                GoogleEmail(AZStd::move(src.GoogleEmail)),
+                GoogleLocale(AZStd::move(src.GoogleLocale)),
+                GoogleGender(AZStd::move(src.GoogleGender))
+            {}
+
+            UserGoogleInfo& operator=(const UserGoogleInfo& src) = default;
+            UserGoogleInfo& operator=(UserGoogleInfo&& src) = default;
+
             UserGoogleInfo(const rapidjson::Value& obj) : UserGoogleInfo()
             {
                 readFromValue(obj);
@@ -11640,6 +18753,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GoogleId"):
+                            if (strcmp(member, "GoogleId") != 0)
+                                break;
+                            GoogleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleEmail"):
+                            if (strcmp(member, "GoogleEmail") != 0)
+                                break;
+                            GoogleEmail = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleLocale"):
+                            if (strcmp(member, "GoogleLocale") != 0)
+                                break;
+                            GoogleLocale = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleGender"):
+                            if (strcmp(member, "GoogleGender") != 0)
+                                break;
+                            GoogleGender = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserXboxInfo : public PlayFabBaseModel
@@ -11656,6 +18807,14 @@ namespace PlayFabComboSdk
                 XboxUserId(src.XboxUserId)
             {}
 
+            UserXboxInfo(UserXboxInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                XboxUserId(AZStd::move(src.XboxUserId))
+            {}
+
+            UserXboxInfo& operator=(const UserXboxInfo& src) = default;
+            UserXboxInfo& operator=(UserXboxInfo&& src) = default;
+
             UserXboxInfo(const rapidjson::Value& obj) : UserXboxInfo()
             {
                 readFromValue(obj);
@@ -11682,6 +18841,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("XboxUserId"):
+                            if (strcmp(member, "XboxUserId") != 0)
+                                break;
+                            XboxUserId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserCustomIdInfo : public PlayFabBaseModel
@@ -11698,6 +18880,14 @@ namespace PlayFabComboSdk
                 CustomId(src.CustomId)
             {}
 
+            UserCustomIdInfo(UserCustomIdInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                CustomId(AZStd::move(src.CustomId))
+            {}
+
+            UserCustomIdInfo& operator=(const UserCustomIdInfo& src) = default;
+            UserCustomIdInfo& operator=(UserCustomIdInfo&& src) = default;
+
             UserCustomIdInfo(const rapidjson::Value& obj) : UserCustomIdInfo()
             {
                 readFromValue(obj);
@@ -11724,6 +18914,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CustomId"):
+                            if (strcmp(member, "CustomId") != 0)
+                                break;
+                            CustomId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserAccountInfo : public PlayFabBaseModel
@@ -11785,6 +18998,97 @@ namespace PlayFabComboSdk
                 CustomIdInfo(src.CustomIdInfo ? new UserCustomIdInfo(*src.CustomIdInfo) : nullptr)
             {}
 
+            UserAccountInfo(UserAccountInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Created(AZStd::move(src.Created)),
+                Username(AZStd::move(src.Username)),
+                TitleInfo(src.TitleInfo),
+                PrivateInfo(src.PrivateInfo),
+                FacebookInfo(src.FacebookInfo),
+                SteamInfo(src.SteamInfo),
+                GameCenterInfo(src.GameCenterInfo),
+                IosDeviceInfo(src.IosDeviceInfo),
+                AndroidDeviceInfo(src.AndroidDeviceInfo),
+                KongregateInfo(src.KongregateInfo),
+                TwitchInfo(src.TwitchInfo),
+                PsnInfo(src.PsnInfo),
+                GoogleInfo(src.GoogleInfo),
+                XboxInfo(src.XboxInfo),
+                CustomIdInfo(src.CustomIdInfo)
+            {
+                src.TitleInfo = nullptr;
+                src.PrivateInfo = nullptr;
+                src.FacebookInfo = nullptr;
+                src.SteamInfo = nullptr;
+                src.GameCenterInfo = nullptr;
+                src.IosDeviceInfo = nullptr;
+                src.AndroidDeviceInfo = nullptr;
+                src.KongregateInfo = nullptr;
+                src.TwitchInfo = nullptr;
+                src.PsnInfo = nullptr;
+                src.GoogleInfo = nullptr;
+                src.XboxInfo = nullptr;
+                src.CustomIdInfo = nullptr;
+            }
+
+            UserAccountInfo& operator=(const UserAccountInfo& src)
+            {
+                if (this != &src)
+                    *this = UserAccountInfo(src);
+                return *this;
+            }
+
+            UserAccountInfo& operator=(UserAccountInfo&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    Created = AZStd::move(src.Created);
+                    Username = AZStd::move(src.Username);
+                    if (TitleInfo != nullptr) delete TitleInfo;
+                    TitleInfo = src.TitleInfo;
+                    src.TitleInfo = nullptr;
+                    if (PrivateInfo != nullptr) delete PrivateInfo;
+                    PrivateInfo = src.PrivateInfo;
+                    src.PrivateInfo = nullptr;
+                    if (FacebookInfo != nullptr) delete FacebookInfo;
+                    FacebookInfo = src.FacebookInfo;
+                    src.FacebookInfo = nullptr;
+                    if (SteamInfo != nullptr) delete SteamInfo;
+                    SteamInfo = src.SteamInfo;
+                    src.SteamInfo = nullptr;
+                    if (GameCenterInfo != nullptr) delete GameCenterInfo;
+                    GameCenterInfo = src.GameCenterInfo;
+                    src.GameCenterInfo = nullptr;
+                    if (IosDeviceInfo != nullptr) delete IosDeviceInfo;
+                    IosDeviceInfo = src.IosDeviceInfo;
+                    src.IosDeviceInfo = nullptr;
+                    if (AndroidDeviceInfo != nullptr) delete AndroidDeviceInfo;
+                    AndroidDeviceInfo = src.AndroidDeviceInfo;
+                    src.AndroidDeviceInfo = nullptr;
+                    if (KongregateInfo != nullptr) delete KongregateInfo;
+                    KongregateInfo = src.KongregateInfo;
+                    src.KongregateInfo = nullptr;
+                    if (TwitchInfo != nullptr) delete TwitchInfo;
+                    TwitchInfo = src.TwitchInfo;
+                    src.TwitchInfo = nullptr;
+                    if (PsnInfo != nullptr) delete PsnInfo;
+                    PsnInfo = src.PsnInfo;
+                    src.PsnInfo = nullptr;
+                    if (GoogleInfo != nullptr) delete GoogleInfo;
+                    GoogleInfo = src.GoogleInfo;
+                    src.GoogleInfo = nullptr;
+                    if (XboxInfo != nullptr) delete XboxInfo;
+                    XboxInfo = src.XboxInfo;
+                    src.XboxInfo = nullptr;
+                    if (CustomIdInfo != nullptr) delete CustomIdInfo;
+                    CustomIdInfo = src.CustomIdInfo;
+                    src.CustomIdInfo = nullptr;
+                }
+                return *this;
+            }
+
             UserAccountInfo(const rapidjson::Value& obj) : UserAccountInfo()
             {
                 readFromValue(obj);
@@ -11912,6 +19216,117 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleInfo"):
+                            if (strcmp(member, "TitleInfo") != 0)
+                                break;
+                            TitleInfo = new UserTitleInfo;
+                            TitleInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("PrivateInfo"):
+                            if (strcmp(member, "PrivateInfo") != 0)
+                                break;
+                            PrivateInfo = new UserPrivateAccountInfo;
+                            PrivateInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("FacebookInfo"):
+                            if (strcmp(member, "FacebookInfo") != 0)
+                                break;
+                            FacebookInfo = new UserFacebookInfo;
+                            FacebookInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamInfo"):
+                            if (strcmp(member, "SteamInfo") != 0)
+                                break;
+                            SteamInfo = new UserSteamInfo;
+                            SteamInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("GameCenterInfo"):
+                            if (strcmp(member, "GameCenterInfo") != 0)
+                                break;
+                            GameCenterInfo = new UserGameCenterInfo;
+                            GameCenterInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("IosDeviceInfo"):
+                            if (strcmp(member, "IosDeviceInfo") != 0)
+                                break;
+                            IosDeviceInfo = new UserIosDeviceInfo;
+                            IosDeviceInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("AndroidDeviceInfo"):
+                            if (strcmp(member, "AndroidDeviceInfo") != 0)
+                                break;
+                            AndroidDeviceInfo = new UserAndroidDeviceInfo;
+                            AndroidDeviceInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("KongregateInfo"):
+                            if (strcmp(member, "KongregateInfo") != 0)
+                                break;
+                            KongregateInfo = new UserKongregateInfo;
+                            KongregateInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("TwitchInfo"):
+                            if (strcmp(member, "TwitchInfo") != 0)
+                                break;
+                            TwitchInfo = new UserTwitchInfo;
+                            TwitchInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("PsnInfo"):
+                            if (strcmp(member, "PsnInfo") != 0)
+                                break;
+                            PsnInfo = new UserPsnInfo;
+                            PsnInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleInfo"):
+                            if (strcmp(member, "GoogleInfo") != 0)
+                                break;
+                            GoogleInfo = new UserGoogleInfo;
+                            GoogleInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("XboxInfo"):
+                            if (strcmp(member, "XboxInfo") != 0)
+                                break;
+                            XboxInfo = new UserXboxInfo;
+                            XboxInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomIdInfo"):
+                            if (strcmp(member, "CustomIdInfo") != 0)
+                                break;
+                            CustomIdInfo = new UserCustomIdInfo;
+                            CustomIdInfo->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct LookupUserAccountInfoResult : public PlayFabBaseModel
@@ -11928,7 +19343,32 @@ namespace PlayFabComboSdk
                 UserInfo(src.UserInfo ? new UserAccountInfo(*src.UserInfo) : nullptr)
             {}
 
-            LookupUserAccountInfoResult(const rapidjson::Value& obj) : LookupUserAccountInfoResult()
+            LookupUserAccountInfoResult(LookupUserAccountInfoResult&& src) noexcept :
+                PlayFabBaseModel(),
+                UserInfo(src.UserInfo)
+            {
+                src.UserInfo = nullptr;
+            }
+
+            LookupUserAccountInfoResult& operator=(const LookupUserAccountInfoResult& src)
+            {
+                if (this != &src)
+                    *this = LookupUserAccountInfoResult(src);
+                return *this;
+            }
+
+            LookupUserAccountInfoResult& operator=(LookupUserAccountInfoResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (UserInfo != nullptr) delete UserInfo;
+                    UserInfo = src.UserInfo;
+                    src.UserInfo = nullptr;
+                }
+                return *this;
+            }
+
+            LookupUserAccountInfoResult(const rapidjson::Value& obj) : LookupUserAccountInfoResult()
             {
                 readFromValue(obj);
             }
@@ -11955,12 +19395,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("UserInfo"):
+                            if (strcmp(member, "UserInfo") != 0)
+                                break;
+                            UserInfo = new UserAccountInfo;
+                            UserInfo->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyMatchmakerGameModesRequest : public PlayFabBaseModel
         {
             AZStd::string BuildVersion;
-            std::list<GameModeInfo> GameModes;
+            std::vector<GameModeInfo> GameModes;
 
             ModifyMatchmakerGameModesRequest() :
                 PlayFabBaseModel(),
@@ -11974,6 +19438,15 @@ namespace PlayFabComboSdk
                 GameModes(src.GameModes)
             {}
 
+            ModifyMatchmakerGameModesRequest(ModifyMatchmakerGameModesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildVersion(AZStd::move(src.BuildVersion)),
+                GameModes(AZStd::move(src.GameModes))
+            {}
+
+            ModifyMatchmakerGameModesRequest& operator=(const ModifyMatchmakerGameModesRequest& src) = default;
+            ModifyMatchmakerGameModesRequest& operator=(ModifyMatchmakerGameModesRequest&& src) = default;
+
             ModifyMatchmakerGameModesRequest(const rapidjson::Value& obj) : ModifyMatchmakerGameModesRequest()
             {
                 readFromValue(obj);
@@ -11990,7 +19463,7 @@ namespace PlayFabComboSdk
                 writer.String(BuildVersion.c_str());
                 writer.String("GameModes");
                 writer.StartArray();
-                for (std::list<GameModeInfo>::iterator iter = GameModes.begin(); iter != GameModes.end(); iter++) {
+                for (std::vector<GameModeInfo>::iterator iter = GameModes.begin(); iter != GameModes.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -12004,13 +19477,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator GameModes_member = obj.FindMember("GameModes");
                 if (GameModes_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = GameModes_member->value;
+                    GameModes.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        GameModes.push_back(GameModeInfo(memberList[i]));
+                        GameModes.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildVersion"):
+                            if (strcmp(member, "BuildVersion") != 0)
+                                break;
+                            BuildVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GameModes"):
+                            if (strcmp(member, "GameModes") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                GameModes.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    GameModes.emplace_back();
+                                    GameModes.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyMatchmakerGameModesResult : public PlayFabBaseModel
@@ -12024,6 +19534,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            ModifyMatchmakerGameModesResult(ModifyMatchmakerGameModesResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            ModifyMatchmakerGameModesResult& operator=(const ModifyMatchmakerGameModesResult& src) = default;
+            ModifyMatchmakerGameModesResult& operator=(ModifyMatchmakerGameModesResult&& src) = default;
+
             ModifyMatchmakerGameModesResult(const rapidjson::Value& obj) : ModifyMatchmakerGameModesResult()
             {
                 readFromValue(obj);
@@ -12044,13 +19561,19 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct ModifyServerBuildRequest : public PlayFabBaseModel
         {
             AZStd::string BuildId;
             OptionalTime Timestamp;
-            std::list<Region> ActiveRegions;
+            std::vector<Region> ActiveRegions;
             Int32 MaxGamesPerHost;
             Int32 MinFreeGameSlots;
             AZStd::string CommandLineTemplate;
@@ -12081,6 +19604,21 @@ namespace PlayFabComboSdk
                 Comment(src.Comment)
             {}
 
+            ModifyServerBuildRequest(ModifyServerBuildRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                ActiveRegions(AZStd::move(src.ActiveRegions)),
+                MaxGamesPerHost(AZStd::move(src.MaxGamesPerHost)),
+                MinFreeGameSlots(AZStd::move(src.MinFreeGameSlots)),
+                CommandLineTemplate(AZStd::move(src.CommandLineTemplate)),
+                ExecutablePath(AZStd::move(src.ExecutablePath)),
+                Comment(AZStd::move(src.Comment))
+            {}
+
+            ModifyServerBuildRequest& operator=(const ModifyServerBuildRequest& src) = default;
+            ModifyServerBuildRequest& operator=(ModifyServerBuildRequest&& src) = default;
+
             ModifyServerBuildRequest(const rapidjson::Value& obj) : ModifyServerBuildRequest()
             {
                 readFromValue(obj);
@@ -12102,7 +19640,7 @@ namespace PlayFabComboSdk
                 if (!ActiveRegions.empty()) {
                     writer.String("ActiveRegions");
                     writer.StartArray();
-                    for (std::list<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
+                    for (std::vector<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
                         writeRegionEnumJSON(*iter, writer);
                     }
                     writer.EndArray();
@@ -12135,6 +19673,7 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActiveRegions_member = obj.FindMember("ActiveRegions");
                 if (ActiveRegions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActiveRegions_member->value;
+                    ActiveRegions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
                         ActiveRegions.push_back(readRegionFromValue(memberList[i]));
                     }
@@ -12152,12 +19691,77 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ActiveRegions"):
+                            if (strcmp(member, "ActiveRegions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActiveRegions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActiveRegions.push_back(readRegionFromValue(reader.GetValue()));
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxGamesPerHost"):
+                            if (strcmp(member, "MaxGamesPerHost") != 0)
+                                break;
+                            MaxGamesPerHost = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinFreeGameSlots"):
+                            if (strcmp(member, "MinFreeGameSlots") != 0)
+                                break;
+                            MinFreeGameSlots = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("CommandLineTemplate"):
+                            if (strcmp(member, "CommandLineTemplate") != 0)
+                                break;
+                            CommandLineTemplate = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExecutablePath"):
+                            if (strcmp(member, "ExecutablePath") != 0)
+                                break;
+                            ExecutablePath = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyServerBuildResult : public PlayFabBaseModel
         {
             AZStd::string BuildId;
-            std::list<Region> ActiveRegions;
+            std::vector<Region> ActiveRegions;
             Int32 MaxGamesPerHost;
             Int32 MinFreeGameSlots;
             AZStd::string CommandLineTemplate;
@@ -12195,6 +19799,23 @@ namespace PlayFabComboSdk
                 Status(src.Status)
             {}
 
+            ModifyServerBuildResult(ModifyServerBuildResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId)),
+                ActiveRegions(AZStd::move(src.ActiveRegions)),
+                MaxGamesPerHost(AZStd::move(src.MaxGamesPerHost)),
+                MinFreeGameSlots(AZStd::move(src.MinFreeGameSlots)),
+                CommandLineTemplate(AZStd::move(src.CommandLineTemplate)),
+                ExecutablePath(AZStd::move(src.ExecutablePath)),
+                Comment(AZStd::move(src.Comment)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                TitleId(AZStd::move(src.TitleId)),
+                Status(AZStd::move(src.Status))
+            {}
+
+            ModifyServerBuildResult& operator=(const ModifyServerBuildResult& src) = default;
+            ModifyServerBuildResult& operator=(ModifyServerBuildResult&& src) = default;
+
             ModifyServerBuildResult(const rapidjson::Value& obj) : ModifyServerBuildResult()
             {
                 readFromValue(obj);
@@ -12214,7 +19835,7 @@ namespace PlayFabComboSdk
                 if (!ActiveRegions.empty()) {
                     writer.String("ActiveRegions");
                     writer.StartArray();
-                    for (std::list<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
+                    for (std::vector<Region>::iterator iter = ActiveRegions.begin(); iter != ActiveRegions.end(); iter++) {
                         writeRegionEnumJSON(*iter, writer);
                     }
                     writer.EndArray();
@@ -12255,6 +19876,7 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActiveRegions_member = obj.FindMember("ActiveRegions");
                 if (ActiveRegions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActiveRegions_member->value;
+                    ActiveRegions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
                         ActiveRegions.push_back(readRegionFromValue(memberList[i]));
                     }
@@ -12278,6 +19900,81 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ActiveRegions"):
+                            if (strcmp(member, "ActiveRegions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActiveRegions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActiveRegions.push_back(readRegionFromValue(reader.GetValue()));
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxGamesPerHost"):
+                            if (strcmp(member, "MaxGamesPerHost") != 0)
+                                break;
+                            MaxGamesPerHost = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinFreeGameSlots"):
+                            if (strcmp(member, "MinFreeGameSlots") != 0)
+                                break;
+                            MinFreeGameSlots = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("CommandLineTemplate"):
+                            if (strcmp(member, "CommandLineTemplate") != 0)
+                                break;
+                            CommandLineTemplate = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExecutablePath"):
+                            if (strcmp(member, "ExecutablePath") != 0)
+                                break;
+                            ExecutablePath = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readGameBuildStatusFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyUserVirtualCurrencyResult : public PlayFabBaseModel
@@ -12303,6 +20000,17 @@ namespace PlayFabComboSdk
                 Balance(src.Balance)
             {}
 
+            ModifyUserVirtualCurrencyResult(ModifyUserVirtualCurrencyResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                BalanceChange(AZStd::move(src.BalanceChange)),
+                Balance(AZStd::move(src.Balance))
+            {}
+
+            ModifyUserVirtualCurrencyResult& operator=(const ModifyUserVirtualCurrencyResult& src) = default;
+            ModifyUserVirtualCurrencyResult& operator=(ModifyUserVirtualCurrencyResult&& src) = default;
+
             ModifyUserVirtualCurrencyResult(const rapidjson::Value& obj) : ModifyUserVirtualCurrencyResult()
             {
                 readFromValue(obj);
@@ -12343,6 +20051,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BalanceChange"):
+                            if (strcmp(member, "BalanceChange") != 0)
+                                break;
+                            BalanceChange = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Balance"):
+                            if (strcmp(member, "Balance") != 0)
+                                break;
+                            Balance = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum PushSetupPlatform
@@ -12369,27 +20115,22 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<PushSetupPlatform>(obj.GetInt());
 
-            static std::map<const char *, PushSetupPlatform, PlayFabComboSdk::StringCompare> _PushSetupPlatformMap;
-            if (_PushSetupPlatformMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _PushSetupPlatformMap["GCM"] = PushSetupPlatformGCM;
-                _PushSetupPlatformMap["APNS"] = PushSetupPlatformAPNS;
-                _PushSetupPlatformMap["APNS_SANDBOX"] = PushSetupPlatformAPNS_SANDBOX;
-
+            case PlayFabJsonReader::Hash("GCM"): if (strcmp(name, "GCM") == 0) return PushSetupPlatformGCM; break;
+            case PlayFabJsonReader::Hash("APNS"): if (strcmp(name, "APNS") == 0) return PushSetupPlatformAPNS; break;
+            case PlayFabJsonReader::Hash("APNS_SANDBOX"): if (strcmp(name, "APNS_SANDBOX") == 0) return PushSetupPlatformAPNS_SANDBOX; break;
             }
 
-            auto output = _PushSetupPlatformMap.find(obj.GetString());
-            if (output != _PushSetupPlatformMap.end())
-                return output->second;
-
             return PushSetupPlatformGCM; // Basically critical fail
         }
 
         struct RandomResultTable : public PlayFabBaseModel
         {
             AZStd::string TableId;
-            std::list<ResultTableNode> Nodes;
+            std::vector<ResultTableNode> Nodes;
 
             RandomResultTable() :
                 PlayFabBaseModel(),
@@ -12403,6 +20144,15 @@ namespace PlayFabComboSdk
                 Nodes(src.Nodes)
             {}
 
+            RandomResultTable(RandomResultTable&& src) noexcept :
+                PlayFabBaseModel(),
+                TableId(AZStd::move(src.TableId)),
+                Nodes(AZStd::move(src.Nodes))
+            {}
+
+            RandomResultTable& operator=(const RandomResultTable& src) = default;
+            RandomResultTable& operator=(RandomResultTable&& src) = default;
+
             RandomResultTable(const rapidjson::Value& obj) : RandomResultTable()
             {
                 readFromValue(obj);
@@ -12419,7 +20169,7 @@ namespace PlayFabComboSdk
                 writer.String(TableId.c_str());
                 writer.String("Nodes");
                 writer.StartArray();
-                for (std::list<ResultTableNode>::iterator iter = Nodes.begin(); iter != Nodes.end(); iter++) {
+                for (std::vector<ResultTableNode>::iterator iter = Nodes.begin(); iter != Nodes.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -12433,13 +20183,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Nodes_member = obj.FindMember("Nodes");
                 if (Nodes_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Nodes_member->value;
+                    Nodes.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Nodes.push_back(ResultTableNode(memberList[i]));
+                        Nodes.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TableId"):
+                            if (strcmp(member, "TableId") != 0)
+                                break;
+                            TableId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Nodes"):
+                            if (strcmp(member, "Nodes") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Nodes.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Nodes.emplace_back();
+                                    Nodes.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RefundPurchaseRequest : public PlayFabBaseModel
@@ -12462,6 +20249,16 @@ namespace PlayFabComboSdk
                 Reason(src.Reason)
             {}
 
+            RefundPurchaseRequest(RefundPurchaseRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                OrderId(AZStd::move(src.OrderId)),
+                Reason(AZStd::move(src.Reason))
+            {}
+
+            RefundPurchaseRequest& operator=(const RefundPurchaseRequest& src) = default;
+            RefundPurchaseRequest& operator=(RefundPurchaseRequest&& src) = default;
+
             RefundPurchaseRequest(const rapidjson::Value& obj) : RefundPurchaseRequest()
             {
                 readFromValue(obj);
@@ -12496,6 +20293,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("OrderId"):
+                            if (strcmp(member, "OrderId") != 0)
+                                break;
+                            OrderId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RefundPurchaseResponse : public PlayFabBaseModel
@@ -12512,6 +20342,14 @@ namespace PlayFabComboSdk
                 PurchaseStatus(src.PurchaseStatus)
             {}
 
+            RefundPurchaseResponse(RefundPurchaseResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                PurchaseStatus(AZStd::move(src.PurchaseStatus))
+            {}
+
+            RefundPurchaseResponse& operator=(const RefundPurchaseResponse& src) = default;
+            RefundPurchaseResponse& operator=(RefundPurchaseResponse&& src) = default;
+
             RefundPurchaseResponse(const rapidjson::Value& obj) : RefundPurchaseResponse()
             {
                 readFromValue(obj);
@@ -12538,6 +20376,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PurchaseStatus"):
+                            if (strcmp(member, "PurchaseStatus") != 0)
+                                break;
+                            PurchaseStatus = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemovePlayerTagRequest : public PlayFabBaseModel
@@ -12557,6 +20418,15 @@ namespace PlayFabComboSdk
                 TagName(src.TagName)
             {}
 
+            RemovePlayerTagRequest(RemovePlayerTagRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                TagName(AZStd::move(src.TagName))
+            {}
+
+            RemovePlayerTagRequest& operator=(const RemovePlayerTagRequest& src) = default;
+            RemovePlayerTagRequest& operator=(RemovePlayerTagRequest&& src) = default;
+
             RemovePlayerTagRequest(const rapidjson::Value& obj) : RemovePlayerTagRequest()
             {
                 readFromValue(obj);
@@ -12585,6 +20455,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TagName"):
+                            if (strcmp(member, "TagName") != 0)
+                                break;
+                            TagName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemovePlayerTagResult : public PlayFabBaseModel
@@ -12598,6 +20496,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RemovePlayerTagResult(RemovePlayerTagResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RemovePlayerTagResult& operator=(const RemovePlayerTagResult& src) = default;
+            RemovePlayerTagResult& operator=(RemovePlayerTagResult&& src) = default;
+
             RemovePlayerTagResult(const rapidjson::Value& obj) : RemovePlayerTagResult()
             {
                 readFromValue(obj);
@@ -12618,6 +20523,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct RemoveServerBuildRequest : public PlayFabBaseModel
@@ -12634,6 +20545,14 @@ namespace PlayFabComboSdk
                 BuildId(src.BuildId)
             {}
 
+            RemoveServerBuildRequest(RemoveServerBuildRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BuildId(AZStd::move(src.BuildId))
+            {}
+
+            RemoveServerBuildRequest& operator=(const RemoveServerBuildRequest& src) = default;
+            RemoveServerBuildRequest& operator=(RemoveServerBuildRequest&& src) = default;
+
             RemoveServerBuildRequest(const rapidjson::Value& obj) : RemoveServerBuildRequest()
             {
                 readFromValue(obj);
@@ -12658,6 +20577,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BuildId"):
+                            if (strcmp(member, "BuildId") != 0)
+                                break;
+                            BuildId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemoveServerBuildResult : public PlayFabBaseModel
@@ -12671,6 +20613,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RemoveServerBuildResult(RemoveServerBuildResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RemoveServerBuildResult& operator=(const RemoveServerBuildResult& src) = default;
+            RemoveServerBuildResult& operator=(RemoveServerBuildResult&& src) = default;
+
             RemoveServerBuildResult(const rapidjson::Value& obj) : RemoveServerBuildResult()
             {
                 readFromValue(obj);
@@ -12691,11 +20640,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct RemoveVirtualCurrencyTypesRequest : public PlayFabBaseModel
         {
-            std::list<VirtualCurrencyData> VirtualCurrencies;
+            std::vector<VirtualCurrencyData> VirtualCurrencies;
 
             RemoveVirtualCurrencyTypesRequest() :
                 PlayFabBaseModel(),
@@ -12707,6 +20662,14 @@ namespace PlayFabComboSdk
                 VirtualCurrencies(src.VirtualCurrencies)
             {}
 
+            RemoveVirtualCurrencyTypesRequest(RemoveVirtualCurrencyTypesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                VirtualCurrencies(AZStd::move(src.VirtualCurrencies))
+            {}
+
+            RemoveVirtualCurrencyTypesRequest& operator=(const RemoveVirtualCurrencyTypesRequest& src) = default;
+            RemoveVirtualCurrencyTypesRequest& operator=(RemoveVirtualCurrencyTypesRequest&& src) = default;
+
             RemoveVirtualCurrencyTypesRequest(const rapidjson::Value& obj) : RemoveVirtualCurrencyTypesRequest()
             {
                 readFromValue(obj);
@@ -12721,7 +20684,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("VirtualCurrencies");
                 writer.StartArray();
-                for (std::list<VirtualCurrencyData>::iterator iter = VirtualCurrencies.begin(); iter != VirtualCurrencies.end(); iter++) {
+                for (std::vector<VirtualCurrencyData>::iterator iter = VirtualCurrencies.begin(); iter != VirtualCurrencies.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -12733,13 +20696,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator VirtualCurrencies_member = obj.FindMember("VirtualCurrencies");
                 if (VirtualCurrencies_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = VirtualCurrencies_member->value;
+                    VirtualCurrencies.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        VirtualCurrencies.push_back(VirtualCurrencyData(memberList[i]));
+                        VirtualCurrencies.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("VirtualCurrencies"):
+                            if (strcmp(member, "VirtualCurrencies") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                VirtualCurrencies.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    VirtualCurrencies.emplace_back();
+                                    VirtualCurrencies.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ResetCharacterStatisticsRequest : public PlayFabBaseModel
@@ -12759,6 +20754,15 @@ namespace PlayFabComboSdk
                 CharacterId(src.CharacterId)
             {}
 
+            ResetCharacterStatisticsRequest(ResetCharacterStatisticsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId))
+            {}
+
+            ResetCharacterStatisticsRequest& operator=(const ResetCharacterStatisticsRequest& src) = default;
+            ResetCharacterStatisticsRequest& operator=(ResetCharacterStatisticsRequest&& src) = default;
+
             ResetCharacterStatisticsRequest(const rapidjson::Value& obj) : ResetCharacterStatisticsRequest()
             {
                 readFromValue(obj);
@@ -12787,6 +20791,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ResetCharacterStatisticsResult : public PlayFabBaseModel
@@ -12800,6 +20832,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            ResetCharacterStatisticsResult(ResetCharacterStatisticsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            ResetCharacterStatisticsResult& operator=(const ResetCharacterStatisticsResult& src) = default;
+            ResetCharacterStatisticsResult& operator=(ResetCharacterStatisticsResult&& src) = default;
+
             ResetCharacterStatisticsResult(const rapidjson::Value& obj) : ResetCharacterStatisticsResult()
             {
                 readFromValue(obj);
@@ -12820,6 +20859,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UserCredentials : public PlayFabBaseModel
@@ -12836,6 +20881,14 @@ namespace PlayFabComboSdk
                 Username(src.Username)
             {}
 
+            UserCredentials(UserCredentials&& src) noexcept :
+                PlayFabBaseModel(),
+                Username(AZStd::move(src.Username))
+            {}
+
+            UserCredentials& operator=(const UserCredentials& src) = default;
+            UserCredentials& operator=(UserCredentials&& src) = default;
+
             UserCredentials(const rapidjson::Value& obj) : UserCredentials()
             {
                 readFromValue(obj);
@@ -12860,11 +20913,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ResetUsersRequest : public PlayFabBaseModel
         {
-            std::list<UserCredentials> Users;
+            std::vector<UserCredentials> Users;
 
             ResetUsersRequest() :
                 PlayFabBaseModel(),
@@ -12876,6 +20952,14 @@ namespace PlayFabComboSdk
                 Users(src.Users)
             {}
 
+            ResetUsersRequest(ResetUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Users(AZStd::move(src.Users))
+            {}
+
+            ResetUsersRequest& operator=(const ResetUsersRequest& src) = default;
+            ResetUsersRequest& operator=(ResetUsersRequest&& src) = default;
+
             ResetUsersRequest(const rapidjson::Value& obj) : ResetUsersRequest()
             {
                 readFromValue(obj);
@@ -12890,7 +20974,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Users");
                 writer.StartArray();
-                for (std::list<UserCredentials>::iterator iter = Users.begin(); iter != Users.end(); iter++) {
+                for (std::vector<UserCredentials>::iterator iter = Users.begin(); iter != Users.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -12902,13 +20986,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Users_member = obj.FindMember("Users");
                 if (Users_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Users_member->value;
+                    Users.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Users.push_back(UserCredentials(memberList[i]));
+                        Users.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Users"):
+                            if (strcmp(member, "Users") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Users.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Users.emplace_back();
+                                    Users.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ResetUserStatisticsRequest : public PlayFabBaseModel
@@ -12925,6 +21041,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            ResetUserStatisticsRequest(ResetUserStatisticsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            ResetUserStatisticsRequest& operator=(const ResetUserStatisticsRequest& src) = default;
+            ResetUserStatisticsRequest& operator=(ResetUserStatisticsRequest&& src) = default;
+
             ResetUserStatisticsRequest(const rapidjson::Value& obj) : ResetUserStatisticsRequest()
             {
                 readFromValue(obj);
@@ -12949,6 +21073,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ResetUserStatisticsResult : public PlayFabBaseModel
@@ -12962,6 +21109,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            ResetUserStatisticsResult(ResetUserStatisticsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            ResetUserStatisticsResult& operator=(const ResetUserStatisticsResult& src) = default;
+            ResetUserStatisticsResult& operator=(ResetUserStatisticsResult&& src) = default;
+
             ResetUserStatisticsResult(const rapidjson::Value& obj) : ResetUserStatisticsResult()
             {
                 readFromValue(obj);
@@ -12982,6 +21136,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         enum ResolutionOutcome
@@ -13008,20 +21168,15 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<ResolutionOutcome>(obj.GetInt());
 
-            static std::map<const char *, ResolutionOutcome, PlayFabComboSdk::StringCompare> _ResolutionOutcomeMap;
-            if (_ResolutionOutcomeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ResolutionOutcomeMap["Revoke"] = ResolutionOutcomeRevoke;
-                _ResolutionOutcomeMap["Reinstate"] = ResolutionOutcomeReinstate;
-                _ResolutionOutcomeMap["Manual"] = ResolutionOutcomeManual;
-
+            case PlayFabJsonReader::Hash("Revoke"): if (strcmp(name, "Revoke") == 0) return ResolutionOutcomeRevoke; break;
+            case PlayFabJsonReader::Hash("Reinstate"): if (strcmp(name, "Reinstate") == 0) return ResolutionOutcomeReinstate; break;
+            case PlayFabJsonReader::Hash("Manual"): if (strcmp(name, "Manual") == 0) return ResolutionOutcomeManual; break;
             }
 
-            auto output = _ResolutionOutcomeMap.find(obj.GetString());
-            if (output != _ResolutionOutcomeMap.end())
-                return output->second;
-
             return ResolutionOutcomeRevoke; // Basically critical fail
         }
 
@@ -13048,6 +21203,17 @@ namespace PlayFabComboSdk
                 Outcome(src.Outcome)
             {}
 
+            ResolvePurchaseDisputeRequest(ResolvePurchaseDisputeRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                OrderId(AZStd::move(src.OrderId)),
+                Reason(AZStd::move(src.Reason)),
+                Outcome(AZStd::move(src.Outcome))
+            {}
+
+            ResolvePurchaseDisputeRequest& operator=(const ResolvePurchaseDisputeRequest& src) = default;
+            ResolvePurchaseDisputeRequest& operator=(ResolvePurchaseDisputeRequest&& src) = default;
+
             ResolvePurchaseDisputeRequest(const rapidjson::Value& obj) : ResolvePurchaseDisputeRequest()
             {
                 readFromValue(obj);
@@ -13086,6 +21252,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("OrderId"):
+                            if (strcmp(member, "OrderId") != 0)
+                                break;
+                            OrderId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Outcome"):
+                            if (strcmp(member, "Outcome") != 0)
+                                break;
+                            Outcome = readResolutionOutcomeFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ResolvePurchaseDisputeResponse : public PlayFabBaseModel
@@ -13102,6 +21306,14 @@ namespace PlayFabComboSdk
                 PurchaseStatus(src.PurchaseStatus)
             {}
 
+            ResolvePurchaseDisputeResponse(ResolvePurchaseDisputeResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                PurchaseStatus(AZStd::move(src.PurchaseStatus))
+            {}
+
+            ResolvePurchaseDisputeResponse& operator=(const ResolvePurchaseDisputeResponse& src) = default;
+            ResolvePurchaseDisputeResponse& operator=(ResolvePurchaseDisputeResponse&& src) = default;
+
             ResolvePurchaseDisputeResponse(const rapidjson::Value& obj) : ResolvePurchaseDisputeResponse()
             {
                 readFromValue(obj);
@@ -13128,6 +21340,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PurchaseStatus"):
+                            if (strcmp(member, "PurchaseStatus") != 0)
+                                break;
+                            PurchaseStatus = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeAllBansForUserRequest : public PlayFabBaseModel
@@ -13144,6 +21379,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            RevokeAllBansForUserRequest(RevokeAllBansForUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            RevokeAllBansForUserRequest& operator=(const RevokeAllBansForUserRequest& src) = default;
+            RevokeAllBansForUserRequest& operator=(RevokeAllBansForUserRequest&& src) = default;
+
             RevokeAllBansForUserRequest(const rapidjson::Value& obj) : RevokeAllBansForUserRequest()
             {
                 readFromValue(obj);
@@ -13168,11 +21411,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeAllBansForUserResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             RevokeAllBansForUserResult() :
                 PlayFabBaseModel(),
@@ -13184,6 +21450,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            RevokeAllBansForUserResult(RevokeAllBansForUserResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            RevokeAllBansForUserResult& operator=(const RevokeAllBansForUserResult& src) = default;
+            RevokeAllBansForUserResult& operator=(RevokeAllBansForUserResult&& src) = default;
+
             RevokeAllBansForUserResult(const rapidjson::Value& obj) : RevokeAllBansForUserResult()
             {
                 readFromValue(obj);
@@ -13199,7 +21473,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -13212,18 +21486,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeBansRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> BanIds;
+            std::vector<AZStd::string> BanIds;
 
             RevokeBansRequest() :
                 PlayFabBaseModel(),
@@ -13235,6 +21541,14 @@ namespace PlayFabComboSdk
                 BanIds(src.BanIds)
             {}
 
+            RevokeBansRequest(RevokeBansRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BanIds(AZStd::move(src.BanIds))
+            {}
+
+            RevokeBansRequest& operator=(const RevokeBansRequest& src) = default;
+            RevokeBansRequest& operator=(RevokeBansRequest&& src) = default;
+
             RevokeBansRequest(const rapidjson::Value& obj) : RevokeBansRequest()
             {
                 readFromValue(obj);
@@ -13249,7 +21563,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("BanIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = BanIds.begin(); iter != BanIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = BanIds.begin(); iter != BanIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -13261,18 +21575,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanIds_member = obj.FindMember("BanIds");
                 if (BanIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanIds_member->value;
+                    BanIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanIds.push_back(memberList[i].GetString());
+                        BanIds.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanIds"):
+                            if (strcmp(member, "BanIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeBansResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             RevokeBansResult() :
                 PlayFabBaseModel(),
@@ -13284,6 +21629,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            RevokeBansResult(RevokeBansResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            RevokeBansResult& operator=(const RevokeBansResult& src) = default;
+            RevokeBansResult& operator=(RevokeBansResult&& src) = default;
+
             RevokeBansResult(const rapidjson::Value& obj) : RevokeBansResult()
             {
                 readFromValue(obj);
@@ -13299,7 +21652,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -13312,13 +21665,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeInventoryItemRequest : public PlayFabBaseModel
@@ -13341,6 +21726,16 @@ namespace PlayFabComboSdk
                 ItemInstanceId(src.ItemInstanceId)
             {}
 
+            RevokeInventoryItemRequest(RevokeInventoryItemRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId))
+            {}
+
+            RevokeInventoryItemRequest& operator=(const RevokeInventoryItemRequest& src) = default;
+            RevokeInventoryItemRequest& operator=(RevokeInventoryItemRequest&& src) = default;
+
             RevokeInventoryItemRequest(const rapidjson::Value& obj) : RevokeInventoryItemRequest()
             {
                 readFromValue(obj);
@@ -13375,6 +21770,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeInventoryResult : public PlayFabBaseModel
@@ -13388,6 +21816,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RevokeInventoryResult(RevokeInventoryResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RevokeInventoryResult& operator=(const RevokeInventoryResult& src) = default;
+            RevokeInventoryResult& operator=(RevokeInventoryResult&& src) = default;
+
             RevokeInventoryResult(const rapidjson::Value& obj) : RevokeInventoryResult()
             {
                 readFromValue(obj);
@@ -13408,6 +21843,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct RunTaskRequest : public PlayFabBaseModel
@@ -13424,6 +21865,31 @@ namespace PlayFabComboSdk
                 Identifier(src.Identifier ? new NameIdentifier(*src.Identifier) : nullptr)
             {}
 
+            RunTaskRequest(RunTaskRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Identifier(src.Identifier)
+            {
+                src.Identifier = nullptr;
+            }
+
+            RunTaskRequest& operator=(const RunTaskRequest& src)
+            {
+                if (this != &src)
+                    *this = RunTaskRequest(src);
+                return *this;
+            }
+
+            RunTaskRequest& operator=(RunTaskRequest&& src)
+            {
+                if (this != &src)
+                {
+                    if (Identifier != nullptr) delete Identifier;
+                    Identifier = src.Identifier;
+                    src.Identifier = nullptr;
+                }
+                return *this;
+            }
+
             RunTaskRequest(const rapidjson::Value& obj) : RunTaskRequest()
             {
                 readFromValue(obj);
@@ -13451,6 +21917,30 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Identifier"):
+                            if (strcmp(member, "Identifier") != 0)
+                                break;
+                            Identifier = new NameIdentifier;
+                            Identifier->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RunTaskResult : public PlayFabBaseModel
@@ -13467,6 +21957,14 @@ namespace PlayFabComboSdk
                 TaskInstanceId(src.TaskInstanceId)
             {}
 
+            RunTaskResult(RunTaskResult&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId))
+            {}
+
+            RunTaskResult& operator=(const RunTaskResult& src) = default;
+            RunTaskResult& operator=(RunTaskResult&& src) = default;
+
             RunTaskResult(const rapidjson::Value& obj) : RunTaskResult()
             {
                 readFromValue(obj);
@@ -13493,6 +21991,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SendAccountRecoveryEmailRequest : public PlayFabBaseModel
@@ -13509,6 +22030,14 @@ namespace PlayFabComboSdk
                 Email(src.Email)
             {}
 
+            SendAccountRecoveryEmailRequest(SendAccountRecoveryEmailRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Email(AZStd::move(src.Email))
+            {}
+
+            SendAccountRecoveryEmailRequest& operator=(const SendAccountRecoveryEmailRequest& src) = default;
+            SendAccountRecoveryEmailRequest& operator=(SendAccountRecoveryEmailRequest&& src) = default;
+
             SendAccountRecoveryEmailRequest(const rapidjson::Value& obj) : SendAccountRecoveryEmailRequest()
             {
                 readFromValue(obj);
@@ -13533,6 +22062,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SendAccountRecoveryEmailResult : public PlayFabBaseModel
@@ -13546,6 +22098,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SendAccountRecoveryEmailResult(SendAccountRecoveryEmailResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SendAccountRecoveryEmailResult& operator=(const SendAccountRecoveryEmailResult& src) = default;
+            SendAccountRecoveryEmailResult& operator=(SendAccountRecoveryEmailResult&& src) = default;
+
             SendAccountRecoveryEmailResult(const rapidjson::Value& obj) : SendAccountRecoveryEmailResult()
             {
                 readFromValue(obj);
@@ -13566,6 +22125,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetPlayerSecretRequest : public PlayFabBaseModel
@@ -13585,6 +22150,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            SetPlayerSecretRequest(SetPlayerSecretRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayerSecret(AZStd::move(src.PlayerSecret)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            SetPlayerSecretRequest& operator=(const SetPlayerSecretRequest& src) = default;
+            SetPlayerSecretRequest& operator=(SetPlayerSecretRequest&& src) = default;
+
             SetPlayerSecretRequest(const rapidjson::Value& obj) : SetPlayerSecretRequest()
             {
                 readFromValue(obj);
@@ -13613,6 +22187,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayerSecret"):
+                            if (strcmp(member, "PlayerSecret") != 0)
+                                break;
+                            PlayerSecret = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetPlayerSecretResult : public PlayFabBaseModel
@@ -13626,6 +22228,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetPlayerSecretResult(SetPlayerSecretResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetPlayerSecretResult& operator=(const SetPlayerSecretResult& src) = default;
+            SetPlayerSecretResult& operator=(SetPlayerSecretResult&& src) = default;
+
             SetPlayerSecretResult(const rapidjson::Value& obj) : SetPlayerSecretResult()
             {
                 readFromValue(obj);
@@ -13646,6 +22255,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetPublishedRevisionRequest : public PlayFabBaseModel
@@ -13665,6 +22280,15 @@ namespace PlayFabComboSdk
                 Revision(src.Revision)
             {}
 
+            SetPublishedRevisionRequest(SetPublishedRevisionRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Version(AZStd::move(src.Version)),
+                Revision(AZStd::move(src.Revision))
+            {}
+
+            SetPublishedRevisionRequest& operator=(const SetPublishedRevisionRequest& src) = default;
+            SetPublishedRevisionRequest& operator=(SetPublishedRevisionRequest&& src) = default;
+
             SetPublishedRevisionRequest(const rapidjson::Value& obj) : SetPublishedRevisionRequest()
             {
                 readFromValue(obj);
@@ -13693,6 +22317,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Revision"):
+                            if (strcmp(member, "Revision") != 0)
+                                break;
+                            Revision = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetPublishedRevisionResult : public PlayFabBaseModel
@@ -13706,6 +22358,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetPublishedRevisionResult(SetPublishedRevisionResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetPublishedRevisionResult& operator=(const SetPublishedRevisionResult& src) = default;
+            SetPublishedRevisionResult& operator=(SetPublishedRevisionResult&& src) = default;
+
             SetPublishedRevisionResult(const rapidjson::Value& obj) : SetPublishedRevisionResult()
             {
                 readFromValue(obj);
@@ -13726,6 +22385,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetPublisherDataRequest : public PlayFabBaseModel
@@ -13745,6 +22410,15 @@ namespace PlayFabComboSdk
                 Value(src.Value)
             {}
 
+            SetPublisherDataRequest(SetPublisherDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                Value(AZStd::move(src.Value))
+            {}
+
+            SetPublisherDataRequest& operator=(const SetPublisherDataRequest& src) = default;
+            SetPublisherDataRequest& operator=(SetPublisherDataRequest&& src) = default;
+
             SetPublisherDataRequest(const rapidjson::Value& obj) : SetPublisherDataRequest()
             {
                 readFromValue(obj);
@@ -13775,6 +22449,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetPublisherDataResult : public PlayFabBaseModel
@@ -13788,6 +22490,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetPublisherDataResult(SetPublisherDataResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetPublisherDataResult& operator=(const SetPublisherDataResult& src) = default;
+            SetPublisherDataResult& operator=(SetPublisherDataResult&& src) = default;
+
             SetPublisherDataResult(const rapidjson::Value& obj) : SetPublisherDataResult()
             {
                 readFromValue(obj);
@@ -13808,6 +22517,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetTitleDataRequest : public PlayFabBaseModel
@@ -13827,6 +22542,15 @@ namespace PlayFabComboSdk
                 Value(src.Value)
             {}
 
+            SetTitleDataRequest(SetTitleDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                Value(AZStd::move(src.Value))
+            {}
+
+            SetTitleDataRequest& operator=(const SetTitleDataRequest& src) = default;
+            SetTitleDataRequest& operator=(SetTitleDataRequest&& src) = default;
+
             SetTitleDataRequest(const rapidjson::Value& obj) : SetTitleDataRequest()
             {
                 readFromValue(obj);
@@ -13857,6 +22581,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetTitleDataResult : public PlayFabBaseModel
@@ -13870,6 +22622,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetTitleDataResult(SetTitleDataResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetTitleDataResult& operator=(const SetTitleDataResult& src) = default;
+            SetTitleDataResult& operator=(SetTitleDataResult&& src) = default;
+
             SetTitleDataResult(const rapidjson::Value& obj) : SetTitleDataResult()
             {
                 readFromValue(obj);
@@ -13885,9 +22644,15 @@ namespace PlayFabComboSdk
                 writer.EndObject();
             }
 
-            bool readFromValue(const rapidjson::Value& obj) override
+            bool readFromValue(const rapidjson::Value& obj) override
+            {
+
+                return true;
+            }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
             {
-
+                reader.Skip();
                 return true;
             }
         };
@@ -13918,6 +22683,18 @@ namespace PlayFabComboSdk
                 OverwriteOldARN(src.OverwriteOldARN)
             {}
 
+            SetupPushNotificationRequest(SetupPushNotificationRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Platform(AZStd::move(src.Platform)),
+                Key(AZStd::move(src.Key)),
+                Credential(AZStd::move(src.Credential)),
+                OverwriteOldARN(AZStd::move(src.OverwriteOldARN))
+            {}
+
+            SetupPushNotificationRequest& operator=(const SetupPushNotificationRequest& src) = default;
+            SetupPushNotificationRequest& operator=(SetupPushNotificationRequest&& src) = default;
+
             SetupPushNotificationRequest(const rapidjson::Value& obj) : SetupPushNotificationRequest()
             {
                 readFromValue(obj);
@@ -13960,6 +22737,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readPushSetupPlatformFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Credential"):
+                            if (strcmp(member, "Credential") != 0)
+                                break;
+                            Credential = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("OverwriteOldARN"):
+                            if (strcmp(member, "OverwriteOldARN") != 0)
+                                break;
+                            OverwriteOldARN = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetupPushNotificationResult : public PlayFabBaseModel
@@ -13976,6 +22796,14 @@ namespace PlayFabComboSdk
                 ARN(src.ARN)
             {}
 
+            SetupPushNotificationResult(SetupPushNotificationResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ARN(AZStd::move(src.ARN))
+            {}
+
+            SetupPushNotificationResult& operator=(const SetupPushNotificationResult& src) = default;
+            SetupPushNotificationResult& operator=(SetupPushNotificationResult&& src) = default;
+
             SetupPushNotificationResult(const rapidjson::Value& obj) : SetupPushNotificationResult()
             {
                 readFromValue(obj);
@@ -14002,6 +22830,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ARN"):
+                            if (strcmp(member, "ARN") != 0)
+                                break;
+                            ARN = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum StatisticVersionArchivalStatus
@@ -14032,22 +22883,17 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<StatisticVersionArchivalStatus>(obj.GetInt());
 
-            static std::map<const char *, StatisticVersionArchivalStatus, PlayFabComboSdk::StringCompare> _StatisticVersionArchivalStatusMap;
-            if (_StatisticVersionArchivalStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _StatisticVersionArchivalStatusMap["NotScheduled"] = StatisticVersionArchivalStatusNotScheduled;
-                _StatisticVersionArchivalStatusMap["Scheduled"] = StatisticVersionArchivalStatusScheduled;
-                _StatisticVersionArchivalStatusMap["Queued"] = StatisticVersionArchivalStatusQueued;
-                _StatisticVersionArchivalStatusMap["InProgress"] = StatisticVersionArchivalStatusInProgress;
-                _StatisticVersionArchivalStatusMap["Complete"] = StatisticVersionArchivalStatusComplete;
-
+            case PlayFabJsonReader::Hash("NotScheduled"): if (strcmp(name, "NotScheduled") == 0) return StatisticVersionArchivalStatusNotScheduled; break;
+            case PlayFabJsonReader::Hash("Scheduled"): if (strcmp(name, "Scheduled") == 0) return StatisticVersionArchivalStatusScheduled; break;
+            case PlayFabJsonReader::Hash("Queued"): if (strcmp(name, "Queued") == 0) return StatisticVersionArchivalStatusQueued; break;
+            case PlayFabJsonReader::Hash("InProgress"): if (strcmp(name, "InProgress") == 0) return StatisticVersionArchivalStatusInProgress; break;
+            case PlayFabJsonReader::Hash("Complete"): if (strcmp(name, "Complete") == 0) return StatisticVersionArchivalStatusComplete; break;
             }
 
-            auto output = _StatisticVersionArchivalStatusMap.find(obj.GetString());
-            if (output != _StatisticVersionArchivalStatusMap.end())
-                return output->second;
-
             return StatisticVersionArchivalStatusNotScheduled; // Basically critical fail
         }
 
@@ -14071,6 +22917,16 @@ namespace PlayFabComboSdk
                 Amount(src.Amount)
             {}
 
+            SubtractUserVirtualCurrencyRequest(SubtractUserVirtualCurrencyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Amount(AZStd::move(src.Amount))
+            {}
+
+            SubtractUserVirtualCurrencyRequest& operator=(const SubtractUserVirtualCurrencyRequest& src) = default;
+            SubtractUserVirtualCurrencyRequest& operator=(SubtractUserVirtualCurrencyRequest&& src) = default;
+
             SubtractUserVirtualCurrencyRequest(const rapidjson::Value& obj) : SubtractUserVirtualCurrencyRequest()
             {
                 readFromValue(obj);
@@ -14103,6 +22959,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Amount"):
+                            if (strcmp(member, "Amount") != 0)
+                                break;
+                            Amount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateBanRequest : public PlayFabBaseModel
@@ -14137,6 +23026,20 @@ namespace PlayFabComboSdk
                 Active(src.Active)
             {}
 
+            UpdateBanRequest(UpdateBanRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BanId(AZStd::move(src.BanId)),
+                Reason(AZStd::move(src.Reason)),
+                Expires(AZStd::move(src.Expires)),
+                IPAddress(AZStd::move(src.IPAddress)),
+                MACAddress(AZStd::move(src.MACAddress)),
+                Permanent(AZStd::move(src.Permanent)),
+                Active(AZStd::move(src.Active))
+            {}
+
+            UpdateBanRequest& operator=(const UpdateBanRequest& src) = default;
+            UpdateBanRequest& operator=(UpdateBanRequest&& src) = default;
+
             UpdateBanRequest(const rapidjson::Value& obj) : UpdateBanRequest()
             {
                 readFromValue(obj);
@@ -14197,11 +23100,64 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanId"):
+                            if (strcmp(member, "BanId") != 0)
+                                break;
+                            BanId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Expires"):
+                            if (strcmp(member, "Expires") != 0)
+                                break;
+                            Expires = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("IPAddress"):
+                            if (strcmp(member, "IPAddress") != 0)
+                                break;
+                            IPAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MACAddress"):
+                            if (strcmp(member, "MACAddress") != 0)
+                                break;
+                            MACAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Permanent"):
+                            if (strcmp(member, "Permanent") != 0)
+                                break;
+                            Permanent = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Active"):
+                            if (strcmp(member, "Active") != 0)
+                                break;
+                            Active = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateBansRequest : public PlayFabBaseModel
         {
-            std::list<UpdateBanRequest> Bans;
+            std::vector<UpdateBanRequest> Bans;
 
             UpdateBansRequest() :
                 PlayFabBaseModel(),
@@ -14213,6 +23169,14 @@ namespace PlayFabComboSdk
                 Bans(src.Bans)
             {}
 
+            UpdateBansRequest(UpdateBansRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Bans(AZStd::move(src.Bans))
+            {}
+
+            UpdateBansRequest& operator=(const UpdateBansRequest& src) = default;
+            UpdateBansRequest& operator=(UpdateBansRequest&& src) = default;
+
             UpdateBansRequest(const rapidjson::Value& obj) : UpdateBansRequest()
             {
                 readFromValue(obj);
@@ -14227,7 +23191,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Bans");
                 writer.StartArray();
-                for (std::list<UpdateBanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
+                for (std::vector<UpdateBanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -14239,18 +23203,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Bans_member = obj.FindMember("Bans");
                 if (Bans_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Bans_member->value;
+                    Bans.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Bans.push_back(UpdateBanRequest(memberList[i]));
+                        Bans.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Bans"):
+                            if (strcmp(member, "Bans") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Bans.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Bans.emplace_back();
+                                    Bans.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateBansResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             UpdateBansResult() :
                 PlayFabBaseModel(),
@@ -14262,6 +23258,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            UpdateBansResult(UpdateBansResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            UpdateBansResult& operator=(const UpdateBansResult& src) = default;
+            UpdateBansResult& operator=(UpdateBansResult&& src) = default;
+
             UpdateBansResult(const rapidjson::Value& obj) : UpdateBansResult()
             {
                 readFromValue(obj);
@@ -14277,7 +23281,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14290,20 +23294,52 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCatalogItemsRequest : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
             OptionalBool SetAsDefaultCatalog;
-            std::list<CatalogItem> Catalog;
+            std::vector<CatalogItem> Catalog;
 
             UpdateCatalogItemsRequest() :
                 PlayFabBaseModel(),
@@ -14319,6 +23355,16 @@ namespace PlayFabComboSdk
                 Catalog(src.Catalog)
             {}
 
+            UpdateCatalogItemsRequest(UpdateCatalogItemsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                SetAsDefaultCatalog(AZStd::move(src.SetAsDefaultCatalog)),
+                Catalog(AZStd::move(src.Catalog))
+            {}
+
+            UpdateCatalogItemsRequest& operator=(const UpdateCatalogItemsRequest& src) = default;
+            UpdateCatalogItemsRequest& operator=(UpdateCatalogItemsRequest&& src) = default;
+
             UpdateCatalogItemsRequest(const rapidjson::Value& obj) : UpdateCatalogItemsRequest()
             {
                 readFromValue(obj);
@@ -14342,7 +23388,7 @@ namespace PlayFabComboSdk
                 if (!Catalog.empty()) {
                     writer.String("Catalog");
                     writer.StartArray();
-                    for (std::list<CatalogItem>::iterator iter = Catalog.begin(); iter != Catalog.end(); iter++) {
+                    for (std::vector<CatalogItem>::iterator iter = Catalog.begin(); iter != Catalog.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14359,13 +23405,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Catalog_member = obj.FindMember("Catalog");
                 if (Catalog_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Catalog_member->value;
+                    Catalog.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Catalog.push_back(CatalogItem(memberList[i]));
+                        Catalog.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SetAsDefaultCatalog"):
+                            if (strcmp(member, "SetAsDefaultCatalog") != 0)
+                                break;
+                            SetAsDefaultCatalog = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Catalog"):
+                            if (strcmp(member, "Catalog") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Catalog.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Catalog.emplace_back();
+                                    Catalog.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCatalogItemsResult : public PlayFabBaseModel
@@ -14379,6 +23467,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdateCatalogItemsResult(UpdateCatalogItemsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdateCatalogItemsResult& operator=(const UpdateCatalogItemsResult& src) = default;
+            UpdateCatalogItemsResult& operator=(UpdateCatalogItemsResult&& src) = default;
+
             UpdateCatalogItemsResult(const rapidjson::Value& obj) : UpdateCatalogItemsResult()
             {
                 readFromValue(obj);
@@ -14399,11 +23494,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdateCloudScriptRequest : public PlayFabBaseModel
         {
-            std::list<CloudScriptFile> Files;
+            std::vector<CloudScriptFile> Files;
             bool Publish;
             AZStd::string DeveloperPlayFabId;
 
@@ -14421,6 +23522,16 @@ namespace PlayFabComboSdk
                 DeveloperPlayFabId(src.DeveloperPlayFabId)
             {}
 
+            UpdateCloudScriptRequest(UpdateCloudScriptRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Files(AZStd::move(src.Files)),
+                Publish(AZStd::move(src.Publish)),
+                DeveloperPlayFabId(AZStd::move(src.DeveloperPlayFabId))
+            {}
+
+            UpdateCloudScriptRequest& operator=(const UpdateCloudScriptRequest& src) = default;
+            UpdateCloudScriptRequest& operator=(UpdateCloudScriptRequest&& src) = default;
+
             UpdateCloudScriptRequest(const rapidjson::Value& obj) : UpdateCloudScriptRequest()
             {
                 readFromValue(obj);
@@ -14435,7 +23546,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Files");
                 writer.StartArray();
-                for (std::list<CloudScriptFile>::iterator iter = Files.begin(); iter != Files.end(); iter++) {
+                for (std::vector<CloudScriptFile>::iterator iter = Files.begin(); iter != Files.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -14453,8 +23564,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Files_member = obj.FindMember("Files");
                 if (Files_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Files_member->value;
+                    Files.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Files.push_back(CloudScriptFile(memberList[i]));
+                        Files.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator Publish_member = obj.FindMember("Publish");
@@ -14464,6 +23576,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Files"):
+                            if (strcmp(member, "Files") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Files.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Files.emplace_back();
+                                    Files.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Publish"):
+                            if (strcmp(member, "Publish") != 0)
+                                break;
+                            Publish = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("DeveloperPlayFabId"):
+                            if (strcmp(member, "DeveloperPlayFabId") != 0)
+                                break;
+                            DeveloperPlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCloudScriptResult : public PlayFabBaseModel
@@ -14483,6 +23636,15 @@ namespace PlayFabComboSdk
                 Revision(src.Revision)
             {}
 
+            UpdateCloudScriptResult(UpdateCloudScriptResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Version(AZStd::move(src.Version)),
+                Revision(AZStd::move(src.Revision))
+            {}
+
+            UpdateCloudScriptResult& operator=(const UpdateCloudScriptResult& src) = default;
+            UpdateCloudScriptResult& operator=(UpdateCloudScriptResult&& src) = default;
+
             UpdateCloudScriptResult(const rapidjson::Value& obj) : UpdateCloudScriptResult()
             {
                 readFromValue(obj);
@@ -14511,6 +23673,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Revision"):
+                            if (strcmp(member, "Revision") != 0)
+                                break;
+                            Revision = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdatePlayerSharedSecretRequest : public PlayFabBaseModel
@@ -14533,6 +23723,16 @@ namespace PlayFabComboSdk
                 Disabled(src.Disabled)
             {}
 
+            UpdatePlayerSharedSecretRequest(UpdatePlayerSharedSecretRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SecretKey(AZStd::move(src.SecretKey)),
+                FriendlyName(AZStd::move(src.FriendlyName)),
+                Disabled(AZStd::move(src.Disabled))
+            {}
+
+            UpdatePlayerSharedSecretRequest& operator=(const UpdatePlayerSharedSecretRequest& src) = default;
+            UpdatePlayerSharedSecretRequest& operator=(UpdatePlayerSharedSecretRequest&& src) = default;
+
             UpdatePlayerSharedSecretRequest(const rapidjson::Value& obj) : UpdatePlayerSharedSecretRequest()
             {
                 readFromValue(obj);
@@ -14569,6 +23769,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecretKey"):
+                            if (strcmp(member, "SecretKey") != 0)
+                                break;
+                            SecretKey = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendlyName"):
+                            if (strcmp(member, "FriendlyName") != 0)
+                                break;
+                            FriendlyName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Disabled"):
+                            if (strcmp(member, "Disabled") != 0)
+                                break;
+                            Disabled = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdatePlayerSharedSecretResult : public PlayFabBaseModel
@@ -14582,6 +23815,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdatePlayerSharedSecretResult(UpdatePlayerSharedSecretResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdatePlayerSharedSecretResult& operator=(const UpdatePlayerSharedSecretResult& src) = default;
+            UpdatePlayerSharedSecretResult& operator=(UpdatePlayerSharedSecretResult&& src) = default;
+
             UpdatePlayerSharedSecretResult(const rapidjson::Value& obj) : UpdatePlayerSharedSecretResult()
             {
                 readFromValue(obj);
@@ -14602,6 +23842,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdatePlayerStatisticDefinitionRequest : public PlayFabBaseModel
@@ -14624,6 +23870,16 @@ namespace PlayFabComboSdk
                 AggregationMethod(src.AggregationMethod)
             {}
 
+            UpdatePlayerStatisticDefinitionRequest(UpdatePlayerStatisticDefinitionRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                VersionChangeInterval(AZStd::move(src.VersionChangeInterval)),
+                AggregationMethod(AZStd::move(src.AggregationMethod))
+            {}
+
+            UpdatePlayerStatisticDefinitionRequest& operator=(const UpdatePlayerStatisticDefinitionRequest& src) = default;
+            UpdatePlayerStatisticDefinitionRequest& operator=(UpdatePlayerStatisticDefinitionRequest&& src) = default;
+
             UpdatePlayerStatisticDefinitionRequest(const rapidjson::Value& obj) : UpdatePlayerStatisticDefinitionRequest()
             {
                 readFromValue(obj);
@@ -14660,6 +23916,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VersionChangeInterval"):
+                            if (strcmp(member, "VersionChangeInterval") != 0)
+                                break;
+                            VersionChangeInterval = readStatisticResetIntervalOptionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("AggregationMethod"):
+                            if (strcmp(member, "AggregationMethod") != 0)
+                                break;
+                            AggregationMethod = readStatisticAggregationMethodFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdatePlayerStatisticDefinitionResult : public PlayFabBaseModel
@@ -14676,6 +23965,31 @@ namespace PlayFabComboSdk
                 Statistic(src.Statistic ? new PlayerStatisticDefinition(*src.Statistic) : nullptr)
             {}
 
+            UpdatePlayerStatisticDefinitionResult(UpdatePlayerStatisticDefinitionResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Statistic(src.Statistic)
+            {
+                src.Statistic = nullptr;
+            }
+
+            UpdatePlayerStatisticDefinitionResult& operator=(const UpdatePlayerStatisticDefinitionResult& src)
+            {
+                if (this != &src)
+                    *this = UpdatePlayerStatisticDefinitionResult(src);
+                return *this;
+            }
+
+            UpdatePlayerStatisticDefinitionResult& operator=(UpdatePlayerStatisticDefinitionResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (Statistic != nullptr) delete Statistic;
+                    Statistic = src.Statistic;
+                    src.Statistic = nullptr;
+                }
+                return *this;
+            }
+
             UpdatePlayerStatisticDefinitionResult(const rapidjson::Value& obj) : UpdatePlayerStatisticDefinitionResult()
             {
                 readFromValue(obj);
@@ -14703,12 +24017,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Statistic"):
+                            if (strcmp(member, "Statistic") != 0)
+                                break;
+                            Statistic = new PlayerStatisticDefinition;
+                            Statistic->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdatePolicyRequest : public PlayFabBaseModel
         {
             AZStd::string PolicyName;
-            std::list<PermissionStatement> Statements;
+            std::vector<PermissionStatement> Statements;
             bool OverwritePolicy;
 
             UpdatePolicyRequest() :
@@ -14725,6 +24063,16 @@ namespace PlayFabComboSdk
                 OverwritePolicy(src.OverwritePolicy)
             {}
 
+            UpdatePolicyRequest(UpdatePolicyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PolicyName(AZStd::move(src.PolicyName)),
+                Statements(AZStd::move(src.Statements)),
+                OverwritePolicy(AZStd::move(src.OverwritePolicy))
+            {}
+
+            UpdatePolicyRequest& operator=(const UpdatePolicyRequest& src) = default;
+            UpdatePolicyRequest& operator=(UpdatePolicyRequest&& src) = default;
+
             UpdatePolicyRequest(const rapidjson::Value& obj) : UpdatePolicyRequest()
             {
                 readFromValue(obj);
@@ -14741,7 +24089,7 @@ namespace PlayFabComboSdk
                 writer.String(PolicyName.c_str());
                 writer.String("Statements");
                 writer.StartArray();
-                for (std::list<PermissionStatement>::iterator iter = Statements.begin(); iter != Statements.end(); iter++) {
+                for (std::vector<PermissionStatement>::iterator iter = Statements.begin(); iter != Statements.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -14757,8 +24105,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Statements_member = obj.FindMember("Statements");
                 if (Statements_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statements_member->value;
+                    Statements.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statements.push_back(PermissionStatement(memberList[i]));
+                        Statements.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator OverwritePolicy_member = obj.FindMember("OverwritePolicy");
@@ -14766,12 +24115,53 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PolicyName"):
+                            if (strcmp(member, "PolicyName") != 0)
+                                break;
+                            PolicyName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statements"):
+                            if (strcmp(member, "Statements") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statements.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statements.emplace_back();
+                                    Statements.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("OverwritePolicy"):
+                            if (strcmp(member, "OverwritePolicy") != 0)
+                                break;
+                            OverwritePolicy = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdatePolicyResponse : public PlayFabBaseModel
         {
             AZStd::string PolicyName;
-            std::list<PermissionStatement> Statements;
+            std::vector<PermissionStatement> Statements;
 
             UpdatePolicyResponse() :
                 PlayFabBaseModel(),
@@ -14785,6 +24175,15 @@ namespace PlayFabComboSdk
                 Statements(src.Statements)
             {}
 
+            UpdatePolicyResponse(UpdatePolicyResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                PolicyName(AZStd::move(src.PolicyName)),
+                Statements(AZStd::move(src.Statements))
+            {}
+
+            UpdatePolicyResponse& operator=(const UpdatePolicyResponse& src) = default;
+            UpdatePolicyResponse& operator=(UpdatePolicyResponse&& src) = default;
+
             UpdatePolicyResponse(const rapidjson::Value& obj) : UpdatePolicyResponse()
             {
                 readFromValue(obj);
@@ -14804,7 +24203,7 @@ namespace PlayFabComboSdk
                 if (!Statements.empty()) {
                     writer.String("Statements");
                     writer.StartArray();
-                    for (std::list<PermissionStatement>::iterator iter = Statements.begin(); iter != Statements.end(); iter++) {
+                    for (std::vector<PermissionStatement>::iterator iter = Statements.begin(); iter != Statements.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14819,19 +24218,56 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Statements_member = obj.FindMember("Statements");
                 if (Statements_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statements_member->value;
+                    Statements.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statements.push_back(PermissionStatement(memberList[i]));
+                        Statements.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PolicyName"):
+                            if (strcmp(member, "PolicyName") != 0)
+                                break;
+                            PolicyName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statements"):
+                            if (strcmp(member, "Statements") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statements.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statements.emplace_back();
+                                    Statements.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateRandomResultTablesRequest : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
-            std::list<RandomResultTable> Tables;
+            std::vector<RandomResultTable> Tables;
 
             UpdateRandomResultTablesRequest() :
                 PlayFabBaseModel(),
@@ -14845,6 +24281,15 @@ namespace PlayFabComboSdk
                 Tables(src.Tables)
             {}
 
+            UpdateRandomResultTablesRequest(UpdateRandomResultTablesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                Tables(AZStd::move(src.Tables))
+            {}
+
+            UpdateRandomResultTablesRequest& operator=(const UpdateRandomResultTablesRequest& src) = default;
+            UpdateRandomResultTablesRequest& operator=(UpdateRandomResultTablesRequest&& src) = default;
+
             UpdateRandomResultTablesRequest(const rapidjson::Value& obj) : UpdateRandomResultTablesRequest()
             {
                 readFromValue(obj);
@@ -14864,7 +24309,7 @@ namespace PlayFabComboSdk
                 if (!Tables.empty()) {
                     writer.String("Tables");
                     writer.StartArray();
-                    for (std::list<RandomResultTable>::iterator iter = Tables.begin(); iter != Tables.end(); iter++) {
+                    for (std::vector<RandomResultTable>::iterator iter = Tables.begin(); iter != Tables.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14879,13 +24324,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tables_member = obj.FindMember("Tables");
                 if (Tables_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tables_member->value;
+                    Tables.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tables.push_back(RandomResultTable(memberList[i]));
+                        Tables.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tables"):
+                            if (strcmp(member, "Tables") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tables.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tables.emplace_back();
+                                    Tables.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateRandomResultTablesResult : public PlayFabBaseModel
@@ -14899,6 +24381,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdateRandomResultTablesResult(UpdateRandomResultTablesResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdateRandomResultTablesResult& operator=(const UpdateRandomResultTablesResult& src) = default;
+            UpdateRandomResultTablesResult& operator=(UpdateRandomResultTablesResult&& src) = default;
+
             UpdateRandomResultTablesResult(const rapidjson::Value& obj) : UpdateRandomResultTablesResult()
             {
                 readFromValue(obj);
@@ -14919,6 +24408,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdateStoreItemsRequest : public PlayFabBaseModel
@@ -14926,7 +24421,7 @@ namespace PlayFabComboSdk
             AZStd::string CatalogVersion;
             AZStd::string StoreId;
             StoreMarketingModel* MarketingData;
-            std::list<StoreItem> Store;
+            std::vector<StoreItem> Store;
 
             UpdateStoreItemsRequest() :
                 PlayFabBaseModel(),
@@ -14944,6 +24439,37 @@ namespace PlayFabComboSdk
                 Store(src.Store)
             {}
 
+            UpdateStoreItemsRequest(UpdateStoreItemsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                StoreId(AZStd::move(src.StoreId)),
+                MarketingData(src.MarketingData),
+                Store(AZStd::move(src.Store))
+            {
+                src.MarketingData = nullptr;
+            }
+
+            UpdateStoreItemsRequest& operator=(const UpdateStoreItemsRequest& src)
+            {
+                if (this != &src)
+                    *this = UpdateStoreItemsRequest(src);
+                return *this;
+            }
+
+            UpdateStoreItemsRequest& operator=(UpdateStoreItemsRequest&& src)
+            {
+                if (this != &src)
+                {
+                    CatalogVersion = AZStd::move(src.CatalogVersion);
+                    StoreId = AZStd::move(src.StoreId);
+                    if (MarketingData != nullptr) delete MarketingData;
+                    MarketingData = src.MarketingData;
+                    src.MarketingData = nullptr;
+                    Store = AZStd::move(src.Store);
+                }
+                return *this;
+            }
+
             UpdateStoreItemsRequest(const rapidjson::Value& obj) : UpdateStoreItemsRequest()
             {
                 readFromValue(obj);
@@ -14970,7 +24496,7 @@ namespace PlayFabComboSdk
                 if (!Store.empty()) {
                     writer.String("Store");
                     writer.StartArray();
-                    for (std::list<StoreItem>::iterator iter = Store.begin(); iter != Store.end(); iter++) {
+                    for (std::vector<StoreItem>::iterator iter = Store.begin(); iter != Store.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14989,13 +24515,61 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Store_member = obj.FindMember("Store");
                 if (Store_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Store_member->value;
+                    Store.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Store.push_back(StoreItem(memberList[i]));
+                        Store.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StoreId"):
+                            if (strcmp(member, "StoreId") != 0)
+                                break;
+                            StoreId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MarketingData"):
+                            if (strcmp(member, "MarketingData") != 0)
+                                break;
+                            MarketingData = new StoreMarketingModel;
+                            MarketingData->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Store"):
+                            if (strcmp(member, "Store") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Store.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Store.emplace_back();
+                                    Store.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateStoreItemsResult : public PlayFabBaseModel
@@ -15009,6 +24583,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdateStoreItemsResult(UpdateStoreItemsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdateStoreItemsResult& operator=(const UpdateStoreItemsResult& src) = default;
+            UpdateStoreItemsResult& operator=(UpdateStoreItemsResult&& src) = default;
+
             UpdateStoreItemsResult(const rapidjson::Value& obj) : UpdateStoreItemsResult()
             {
                 readFromValue(obj);
@@ -15029,6 +24610,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdateTaskRequest : public PlayFabBaseModel
@@ -15063,6 +24650,43 @@ namespace PlayFabComboSdk
                 Parameter(src.Parameter)
             {}
 
+            UpdateTaskRequest(UpdateTaskRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Identifier(src.Identifier),
+                Name(AZStd::move(src.Name)),
+                Description(AZStd::move(src.Description)),
+                Schedule(AZStd::move(src.Schedule)),
+                IsActive(AZStd::move(src.IsActive)),
+                Type(AZStd::move(src.Type)),
+                Parameter(AZStd::move(src.Parameter))
+            {
+                src.Identifier = nullptr;
+            }
+
+            UpdateTaskRequest& operator=(const UpdateTaskRequest& src)
+            {
+                if (this != &src)
+                    *this = UpdateTaskRequest(src);
+                return *this;
+            }
+
+            UpdateTaskRequest& operator=(UpdateTaskRequest&& src)
+            {
+                if (this != &src)
+                {
+                    if (Identifier != nullptr) delete Identifier;
+                    Identifier = src.Identifier;
+                    src.Identifier = nullptr;
+                    Name = AZStd::move(src.Name);
+                    Description = AZStd::move(src.Description);
+                    Schedule = AZStd::move(src.Schedule);
+                    IsActive = AZStd::move(src.IsActive);
+                    Type = AZStd::move(src.Type);
+                    Parameter = AZStd::move(src.Parameter);
+                }
+                return *this;
+            }
+
             UpdateTaskRequest(const rapidjson::Value& obj) : UpdateTaskRequest()
             {
                 readFromValue(obj);
@@ -15120,13 +24744,67 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Identifier"):
+                            if (strcmp(member, "Identifier") != 0)
+                                break;
+                            Identifier = new NameIdentifier;
+                            Identifier->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Schedule"):
+                            if (strcmp(member, "Schedule") != 0)
+                                break;
+                            Schedule = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsActive"):
+                            if (strcmp(member, "IsActive") != 0)
+                                break;
+                            IsActive = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Type"):
+                            if (strcmp(member, "Type") != 0)
+                                break;
+                            Type = readScheduledTaskTypeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Parameter"):
+                            if (strcmp(member, "Parameter") != 0)
+                                break;
+                            Parameter.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
             Boxed<UserDataPermission> Permission;
 
             UpdateUserDataRequest() :
@@ -15145,6 +24823,17 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            UpdateUserDataRequest(UpdateUserDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            UpdateUserDataRequest& operator=(const UpdateUserDataRequest& src) = default;
+            UpdateUserDataRequest& operator=(UpdateUserDataRequest&& src) = default;
+
             UpdateUserDataRequest(const rapidjson::Value& obj) : UpdateUserDataRequest()
             {
                 readFromValue(obj);
@@ -15162,7 +24851,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -15171,7 +24860,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -15196,8 +24885,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator Permission_member = obj.FindMember("Permission");
@@ -15205,6 +24895,58 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserDataResult : public PlayFabBaseModel
@@ -15221,6 +24963,14 @@ namespace PlayFabComboSdk
                 DataVersion(src.DataVersion)
             {}
 
+            UpdateUserDataResult(UpdateUserDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                DataVersion(AZStd::move(src.DataVersion))
+            {}
+
+            UpdateUserDataResult& operator=(const UpdateUserDataResult& src) = default;
+            UpdateUserDataResult& operator=(UpdateUserDataResult&& src) = default;
+
             UpdateUserDataResult(const rapidjson::Value& obj) : UpdateUserDataResult()
             {
                 readFromValue(obj);
@@ -15245,13 +24995,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DataVersion"):
+                            if (strcmp(member, "DataVersion") != 0)
+                                break;
+                            DataVersion = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserInternalDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
 
             UpdateUserInternalDataRequest() :
                 PlayFabBaseModel(),
@@ -15267,6 +25040,16 @@ namespace PlayFabComboSdk
                 KeysToRemove(src.KeysToRemove)
             {}
 
+            UpdateUserInternalDataRequest(UpdateUserInternalDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove))
+            {}
+
+            UpdateUserInternalDataRequest& operator=(const UpdateUserInternalDataRequest& src) = default;
+            UpdateUserInternalDataRequest& operator=(UpdateUserInternalDataRequest&& src) = default;
+
             UpdateUserInternalDataRequest(const rapidjson::Value& obj) : UpdateUserInternalDataRequest()
             {
                 readFromValue(obj);
@@ -15284,7 +25067,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -15293,7 +25076,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -15314,13 +25097,61 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserTitleDisplayNameRequest : public PlayFabBaseModel
@@ -15340,6 +25171,15 @@ namespace PlayFabComboSdk
                 DisplayName(src.DisplayName)
             {}
 
+            UpdateUserTitleDisplayNameRequest(UpdateUserTitleDisplayNameRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                DisplayName(AZStd::move(src.DisplayName))
+            {}
+
+            UpdateUserTitleDisplayNameRequest& operator=(const UpdateUserTitleDisplayNameRequest& src) = default;
+            UpdateUserTitleDisplayNameRequest& operator=(UpdateUserTitleDisplayNameRequest&& src) = default;
+
             UpdateUserTitleDisplayNameRequest(const rapidjson::Value& obj) : UpdateUserTitleDisplayNameRequest()
             {
                 readFromValue(obj);
@@ -15368,6 +25208,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserTitleDisplayNameResult : public PlayFabBaseModel
@@ -15384,6 +25252,14 @@ namespace PlayFabComboSdk
                 DisplayName(src.DisplayName)
             {}
 
+            UpdateUserTitleDisplayNameResult(UpdateUserTitleDisplayNameResult&& src) noexcept :
+                PlayFabBaseModel(),
+                DisplayName(AZStd::move(src.DisplayName))
+            {}
+
+            UpdateUserTitleDisplayNameResult& operator=(const UpdateUserTitleDisplayNameResult& src) = default;
+            UpdateUserTitleDisplayNameResult& operator=(UpdateUserTitleDisplayNameResult&& src) = default;
+
             UpdateUserTitleDisplayNameResult(const rapidjson::Value& obj) : UpdateUserTitleDisplayNameResult()
             {
                 readFromValue(obj);
@@ -15410,6 +25286,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
 
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <PlayFabComboSdk/PlayFabServerDataModels.h>
+#include <PlayFabComboSdk/PlayFabFlatMap.h>
+
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace PlayFabComboSdk
+{
+    typedef ServerModels::CatalogItem PlayFabCatalogItem;
+
+    // One decoded catalog version with its indexes, published whole by the catalog cache each time it is refreshed, see PlayFabCombo_CatalogRequests.
+    // Immutable once published, so any number of threads can read it at once. Handed out through a PlayFabCatalogSnapshotPtr, which keeps it
+    // alive for as long as it is held, however many newer snapshots replace it.
+    struct PlayFabCatalogSnapshot
+    {
+        PlayFabCatalogSnapshot() : version(0) {}
+
+        // The item with itemId, or nullptr if the catalog has no such item
+        const PlayFabCatalogItem* FindItem(const char* itemId) const
+        {
+            PlayFabFlatMap<AZ::u32>::const_iterator found = itemIndex.find(itemId);
+            return found == itemIndex.end() ? nullptr : &items[found->second];
+        }
+
+        // The positions in items of every item with itemClass or tag, in catalog order. Empty if there are none.
+        const AZStd::vector<AZ::u32>& FindByClass(const char* itemClass) const { return FindIn(classIndex, itemClass); }
+        const AZStd::vector<AZ::u32>& FindByTag(const char* tag) const { return FindIn(tagIndex, tag); }
+
+        AZStd::string catalogVersion;
+        AZ::u64 version; // Incremented for every snapshot published for catalogVersion
+        AZStd::chrono::system_clock::time_point fetchedTime; // When the response this snapshot was built from arrived
+        std::vector<PlayFabCatalogItem> items; // In catalog order
+        PlayFabFlatMap<AZ::u32> itemIndex; // ItemId to position in items
+        PlayFabFlatMap<AZStd::vector<AZ::u32>> classIndex; // ItemClass to positions in items
+        PlayFabFlatMap<AZStd::vector<AZ::u32>> tagIndex; // Tag to positions in items
+
+    private:
+        static const AZStd::vector<AZ::u32>& FindIn(const PlayFabFlatMap<AZStd::vector<AZ::u32>>& index, const char* key)
+        {
+            static const AZStd::vector<AZ::u32> none;
+            PlayFabFlatMap<AZStd::vector<AZ::u32>>::const_iterator found = index.find(key);
+            return found == index.end() ? none : found->second;
+        }
+    };
+
+    typedef AZStd::shared_ptr<const PlayFabCatalogSnapshot> PlayFabCatalogSnapshotPtr;
+
+    // Catalog cache counters for one catalog version, see PlayFabCombo_CatalogRequests::GetCatalogCacheStats
+    struct PlayFabCatalogCacheStats
+    {
+        AZ::u64 refreshes; // Fetches completed, each of which published a snapshot
+        AZ::u64 failedRefreshes; // Fetches which returned an error, and are tried again after a shorter delay
+        int itemCount; // Of the current snapshot
+        int classCount;
+        int tagCount;
+        AZ::u64 memoryBytes; // Approximate size of the current snapshot, its items and its indexes
+        AZ::u64 buildUs; // Time taken to index the last refresh
+        float lookupNs; // Average ItemId lookup in the current snapshot, measured over every item when it was built
+    };
+}
@@ -0,0 +1,33 @@
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <PlayFabComboSdk/PlayFabCatalogSnapshot.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_CatalogRequests
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        // Start caching catalogVersion, fetching it now and again every refresh interval. An empty catalogVersion is the title's primary catalog.
+        virtual void StartCatalogCache(AZStd::string catalogVersion) = 0;
+        // Stop refreshing catalogVersion. Its last snapshot stays readable.
+        virtual void StopCatalogCache(AZStd::string catalogVersion) = 0;
+        // Fetch catalogVersion on the next tick, rather than waiting for the refresh interval
+        virtual void RefreshCatalog(AZStd::string catalogVersion) = 0;
+        virtual void SetCatalogRefreshInterval(int seconds) = 0;
+
+        // The latest snapshot of catalogVersion, read without the cache's lock or an allocation, or nullptr until its first fetch completes.
+        // It stays valid while the handle is held, so take one per frame rather than per lookup.
+        virtual PlayFabCatalogSnapshotPtr GetCatalogSnapshot(const char* catalogVersion) = 0;
+        virtual PlayFabCatalogCacheStats GetCatalogCacheStats(AZStd::string catalogVersion) = 0;
+
+    };
+
+    using PlayFabCombo_CatalogRequestBus = AZ::EBus<PlayFabCombo_CatalogRequests>;
+} // namespace PlayFabComboSdk
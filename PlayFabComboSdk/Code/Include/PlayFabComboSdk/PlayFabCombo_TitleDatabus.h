@@ -0,0 +1,53 @@
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <PlayFabComboSdk/PlayFabTitleDataSnapshot.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_TitleDataRequests
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        // Start caching keys from source, fetching them in one call now and again every refresh interval. Empty keys caches every key the title has.
+        // Calling it again with other keys refetches on the next tick.
+        virtual void StartTitleDataCache(PlayFabTitleDataSource source, AZStd::vector<AZStd::string> keys) = 0;
+        // Stop refreshing source. Its last snapshot stays readable.
+        virtual void StopTitleDataCache(PlayFabTitleDataSource source) = 0;
+        // Fetch source on the next tick, rather than waiting for the refresh interval
+        virtual void RefreshTitleData(PlayFabTitleDataSource source) = 0;
+        virtual void SetTitleDataRefreshInterval(int seconds) = 0;
+
+        // The latest snapshot of source, read without the cache's lock or an allocation. Never nullptr, the snapshot has version 0 until the first fetch completes.
+        // It stays valid while the handle is held, so take one per frame rather than per lookup.
+        virtual PlayFabTitleDataSnapshotPtr GetTitleDataSnapshot(PlayFabTitleDataSource source) = 0;
+        virtual PlayFabTitleDataCacheStats GetTitleDataCacheStats(PlayFabTitleDataSource source) = 0;
+
+    };
+
+    using PlayFabCombo_TitleDataRequestBus = AZ::EBus<PlayFabCombo_TitleDataRequests>;
+
+    class PlayFabCombo_TitleDataNotifications
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using MutexType = AZStd::recursive_mutex; // Sent from whichever thread delivered the fetch result
+
+        // A refresh of source added, changed or removed changedKeys, and published snapshot.
+        // Sent on the main thread when PlayFabSettings::callbacksOnMainThread is set, otherwise on an http worker. Refreshes which change nothing are not sent.
+        virtual void OnTitleDataChanged(PlayFabTitleDataSource source, const PlayFabTitleDataSnapshot& snapshot, const AZStd::vector<AZStd::string>& changedKeys) { (void)source; (void)snapshot; (void)changedKeys; }
+
+    };
+
+    using PlayFabCombo_TitleDataNotificationBus = AZ::EBus<PlayFabCombo_TitleDataNotifications>;
+} // namespace PlayFabComboSdk
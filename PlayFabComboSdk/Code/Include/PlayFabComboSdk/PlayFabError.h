@@ -10,6 +10,8 @@ namespace PlayFabComboSdk
         PlayFabErrorConnectionTimeout,
         PlayFabErrorConnectionRefused,
         PlayFabErrorSocketError,
+        PlayFabErrorRateLimitedLocally, // Not sent, see PlayFabRateLimiter
+        PlayFabErrorResponseNotInflated, // The response body was deflate compressed, and was cut short or corrupt
         PlayFabErrorSuccess = 0,
         PlayFabErrorInvalidParams = 1000,
         PlayFabErrorAccountNotFound = 1001,
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/utils.h>
+
+#include <string.h>
+
+namespace PlayFabComboSdk
+{
+    // String keyed dictionary for the data models, with the std::map interface they use.
+    // Entries are kept contiguously in insertion order, and found through an open addressing table of hashes and entry indices with linear probing.
+    // Keys can be looked up as const char*, or pointer and length, without building a temporary string.
+    // Unlike std::map, iteration is in insertion order (changed by erase), and inserting or erasing invalidates iterators and references to values.
+    template <typename ValueType>
+    class PlayFabFlatMap
+    {
+    public:
+        typedef AZStd::string key_type;
+        typedef ValueType mapped_type;
+        typedef AZStd::pair<AZStd::string, ValueType> value_type;
+        typedef typename AZStd::vector<value_type>::iterator iterator;
+        typedef typename AZStd::vector<value_type>::const_iterator const_iterator;
+        typedef size_t size_type;
+
+        iterator begin() { return m_entries.begin(); }
+        iterator end() { return m_entries.end(); }
+        const_iterator begin() const { return m_entries.begin(); }
+        const_iterator end() const { return m_entries.end(); }
+        size_t size() const { return m_entries.size(); }
+        bool empty() const { return m_entries.empty(); }
+        // Bytes allocated for the entries and the table, not counting memory the keys and values own
+        size_t GetAllocatedBytes() const { return m_entries.capacity() * sizeof(value_type) + m_slots.capacity() * sizeof(Slot); }
+
+        void clear()
+        {
+            m_entries.clear();
+            m_slots.clear();
+        }
+
+        // Size the table for count entries, so inserting them does not rehash
+        void reserve(size_t count)
+        {
+            m_entries.reserve(count);
+            if (count * 4 > m_slots.size() * 3)
+                Rehash(SlotCountFor(count));
+        }
+
+        iterator find(const char* key, size_t length)
+        {
+            size_t slot = FindSlot(key, length, Hash(key, length));
+            return slot == NotFound ? end() : m_entries.begin() + m_slots[slot].index;
+        }
+        const_iterator find(const char* key, size_t length) const
+        {
+            size_t slot = FindSlot(key, length, Hash(key, length));
+            return slot == NotFound ? end() : m_entries.begin() + m_slots[slot].index;
+        }
+        iterator find(const char* key) { return find(key, strlen(key)); }
+        const_iterator find(const char* key) const { return find(key, strlen(key)); }
+        iterator find(const AZStd::string& key) { return find(key.c_str(), key.length()); }
+        const_iterator find(const AZStd::string& key) const { return find(key.c_str(), key.length()); }
+
+        size_t count(const char* key) const { return find(key) == end() ? 0 : 1; }
+        size_t count(const AZStd::string& key) const { return find(key) == end() ? 0 : 1; }
+
+        // The value for key, default constructed and inserted if there is none
+        ValueType& operator[](const char* key) { return Emplace(key, strlen(key), ValueType()).first->second; }
+        ValueType& operator[](const AZStd::string& key) { return Emplace(key.c_str(), key.length(), ValueType()).first->second; }
+
+        // Insert a copy of entry, unless its key is already present
+        AZStd::pair<iterator, bool> insert(const value_type& entry) { return Emplace(entry.first.c_str(), entry.first.length(), entry.second); }
+        AZStd::pair<iterator, bool> insert(value_type&& entry) { return Emplace(entry.first.c_str(), entry.first.length(), AZStd::move(entry.second)); }
+
+        size_t erase(const char* key) { return EraseSlot(FindSlot(key, strlen(key), Hash(key, strlen(key)))); }
+        size_t erase(const AZStd::string& key) { return EraseSlot(FindSlot(key.c_str(), key.length(), Hash(key.c_str(), key.length()))); }
+        // Erase the entry at position, returning the position to continue iterating from (the last entry is moved into it)
+        iterator erase(iterator position)
+        {
+            size_t index = position - m_entries.begin();
+            const AZStd::string& key = position->first;
+            EraseSlot(FindSlot(key.c_str(), key.length(), Hash(key.c_str(), key.length())));
+            return m_entries.begin() + index;
+        }
+
+        bool operator==(const PlayFabFlatMap& other) const
+        {
+            if (size() != other.size())
+                return false;
+            for (const value_type& entry : m_entries)
+            {
+                const_iterator match = other.find(entry.first);
+                if (match == other.end() || !(match->second == entry.second))
+                    return false;
+            }
+            return true;
+        }
+        bool operator!=(const PlayFabFlatMap& other) const { return !(*this == other); }
+
+    private:
+        static const size_t NotFound = static_cast<size_t>(-1);
+        static const AZ::u32 EmptySlot = static_cast<AZ::u32>(-1);
+
+        struct Slot
+        {
+            AZ::u32 hash; // Compared before the key, so probing rarely touches the entries
+            AZ::u32 index; // Into m_entries, or EmptySlot
+        };
+
+        static AZ::u32 Hash(const char* key, size_t length)
+        {
+            AZ::u32 hash = 2166136261u;
+            for (size_t i = 0; i < length; ++i)
+                hash = (hash ^ static_cast<unsigned char>(key[i])) * 16777619u;
+            return hash;
+        }
+
+        // Smallest power of two table which holds count entries at no more than 3/4 full
+        static size_t SlotCountFor(size_t count)
+        {
+            size_t slotCount = 8;
+            while (count * 4 > slotCount * 3)
+                slotCount *= 2;
+            return slotCount;
+        }
+
+        size_t FindSlot(const char* key, size_t length, AZ::u32 hash) const
+        {
+            if (m_slots.empty())
+                return NotFound;
+            size_t mask = m_slots.size() - 1;
+            for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+            {
+                const Slot& candidate = m_slots[slot];
+                if (candidate.index == EmptySlot)
+                    return NotFound;
+                if (candidate.hash == hash)
+                {
+                    const AZStd::string& candidateKey = m_entries[candidate.index].first;
+                    if (candidateKey.length() == length && memcmp(candidateKey.c_str(), key, length) == 0)
+                        return slot;
+                }
+            }
+        }
+
+        void PlaceSlot(AZ::u32 hash, AZ::u32 index)
+        {
+            size_t mask = m_slots.size() - 1;
+            size_t slot = hash & mask;
+            while (m_slots[slot].index != EmptySlot)
+                slot = (slot + 1) & mask;
+            m_slots[slot].hash = hash;
+            m_slots[slot].index = index;
+        }
+
+        void Rehash(size_t slotCount)
+        {
+            Slot empty = { 0, EmptySlot };
+            m_slots.assign(slotCount, empty);
+            for (size_t index = 0; index < m_entries.size(); ++index)
+            {
+                const AZStd::string& key = m_entries[index].first;
+                PlaceSlot(Hash(key.c_str(), key.length()), static_cast<AZ::u32>(index));
+            }
+        }
+
+        // Forwards value, so a temporary or moved value is moved into its entry rather than copied
+        template <typename Value>
+        AZStd::pair<iterator, bool> Emplace(const char* key, size_t length, Value&& value)
+        {
+            AZ::u32 hash = Hash(key, length);
+            size_t slot = FindSlot(key, length, hash);
+            if (slot != NotFound)
+                return AZStd::pair<iterator, bool>(m_entries.begin() + m_slots[slot].index, false);
+
+            if ((m_entries.size() + 1) * 4 > m_slots.size() * 3)
+                Rehash(SlotCountFor(m_entries.size() + 1));
+            m_entries.push_back(value_type(AZStd::string(key, length), AZStd::forward<Value>(value)));
+            PlaceSlot(hash, static_cast<AZ::u32>(m_entries.size() - 1));
+            return AZStd::pair<iterator, bool>(m_entries.end() - 1, true);
+        }
+
+        size_t EraseSlot(size_t slot)
+        {
+            if (slot == NotFound)
+                return 0;
+
+            // Move the last entry into the erased one's place, and point its slot at the new position
+            size_t index = m_slots[slot].index;
+            size_t last = m_entries.size() - 1;
+            if (index != last)
+            {
+                const AZStd::string& lastKey = m_entries[last].first;
+                m_slots[FindSlot(lastKey.c_str(), lastKey.length(), Hash(lastKey.c_str(), lastKey.length()))].index = static_cast<AZ::u32>(index);
+                m_entries[index] = AZStd::move(m_entries[last]);
+            }
+            m_entries.pop_back();
+
+            // Shift later entries of the probe run back into the gap, so lookups never stop early at it
+            size_t mask = m_slots.size() - 1;
+            size_t gap = slot;
+            for (size_t next = (gap + 1) & mask; m_slots[next].index != EmptySlot; next = (next + 1) & mask)
+            {
+                size_t home = m_slots[next].hash & mask;
+                if (((next - home) & mask) >= ((next - gap) & mask))
+                {
+                    m_slots[gap] = m_slots[next];
+                    gap = next;
+                }
+            }
+            m_slots[gap].index = EmptySlot;
+            return 1;
+        }
+
+        AZStd::vector<value_type> m_entries;
+        AZStd::vector<Slot> m_slots; // Power of two size, at most 3/4 full
+    };
+}
@@ -7,46 +7,209 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/utils.h>
 #include <AzCore/JSON/document.h>
+#include <AzCore/Component/TickBus.h>
 
 namespace PlayFabComboSdk
 {
+    class PlayFabHttpClientPool;
+    class PlayFabRequestQueue;
+    class PlayFabRetryPolicy;
+    class PlayFabRateLimiter;
+    class PlayFabRequestCoalescer;
+    class PlayFabBufferPool;
+    class PlayFabJsonArenaPool;
+    struct PlayFabJsonArena;
+    class PlayFabJsonReader;
+    class PlayFabBaseModel;
+    class PlayFabRequestBodyPool;
+    struct PlayFabRequestBody;
+
+    // Scheduling classes for requests, higher classes are always sent first
+    enum PlayFabRequestPriority
+    {
+        PlayFabRequestPriorityCritical, // Authentication and server heartbeats, which must not wait behind other traffic
+        PlayFabRequestPriorityGameplay, // Everything the game is actively waiting on
+        PlayFabRequestPriorityBackground, // Telemetry and other fire-and-forget calls, limited so they never occupy every worker
+        PlayFabRequestPriorityCount,
+        PlayFabRequestPriorityDefault = -1 // Use the default for the endpoint, see PlayFabRequestManager::GetDefaultPriority
+    };
+
+    // Keep-alive connection counters, see PlayFabRequestManager::GetConnectionStats
+    struct PlayFabConnectionStats
+    {
+        AZ::u64 clientsCreated; // Pooled http clients created. Each owns one keep-alive connection, but reconnects the client makes itself are not counted.
+        AZ::u64 reusedConnections; // Requests handed an existing pooled client, whose keep-alive connection is reused if the server kept it open
+        AZ::u64 evictedIdleConnections; // Connections closed because they sat idle longer than the idle timeout
+        AZ::u64 droppedUnhealthyConnections; // Connections closed because the transport failed on them
+        int activeConnections; // Connections currently carrying a request
+        int idleConnections; // Connections currently parked in the pool
+    };
+
+    // Per-request latency breakdown, see PlayFabRequestManager::GetTimingStats
+    struct PlayFabTimingStats
+    {
+        AZ::u64 completedRequests;
+        AZ::u64 totalQueueWaitUs; // Time spent queued before a worker picked the request up
+        AZ::u64 maxQueueWaitUs;
+        AZ::u64 totalNetworkUs; // Time spent between sending the request and receiving the full response
+        AZ::u64 maxNetworkUs;
+    };
+
+    // Per api retry counters, see PlayFabRequestManager::GetRetryStats
+    struct PlayFabRetryStats
+    {
+        AZ::u64 retries; // Retries sent
+        AZ::u64 recovered; // Requests which succeeded after one or more retries
+        AZ::u64 exhausted; // Requests which still failed after their last allowed retry
+        AZ::u64 budgetRejected; // Retries not sent because the retry budget was spent
+    };
+
+    // A client side rate limit bucket, see PlayFabCombo_SettingsRequests::GetTitleRateLimitState
+    struct PlayFabRateLimitState
+    {
+        float ratePerSecond; // 0 when there is no limit
+        float burst;
+        float tokens; // Negative while delayed requests are waiting on it
+        AZ::u64 delayedRequests;
+        AZ::u64 rejectedRequests;
+    };
+
+    // Per api single-flight counters, see PlayFabRequestManager::GetCoalescingStats
+    struct PlayFabCoalescingStats
+    {
+        AZ::u64 requests; // Requests to a coalescable api
+        AZ::u64 coalesced; // Requests which shared the response of an identical request already in flight, instead of being sent
+    };
+
+    // Per api body sizes on and off the wire, see PlayFabRequestManager::GetCompressionStats
+    struct PlayFabCompressionStats
+    {
+        AZ::u64 requestBytes; // Request json
+        AZ::u64 requestBytesSent; // Request body as sent, after any compression
+        AZ::u64 responseBytes; // Response json, after any decompression
+        AZ::u64 responseBytesReceived; // Response body as received
+    };
+
+    // Response body buffer reuse, see PlayFabRequestManager::GetResponseBufferStats
+    struct PlayFabResponseBufferStats
+    {
+        AZ::u64 acquiredBuffers; // One per response read
+        AZ::u64 reusedBuffers; // Responses read into a recycled buffer, without allocating
+        AZ::u64 allocatedBytes; // Total size of the buffers allocated because none of the right size were free
+        AZ::u64 pooledBytes; // Size of the free buffers currently kept for reuse
+        AZ::u64 largestResponseBytes;
+    };
+
+    // Response Document arena reuse, see PlayFabRequestManager::GetJsonArenaStats
+    struct PlayFabJsonArenaStats
+    {
+        AZ::u64 acquiredArenas; // One per response parsed
+        AZ::u64 reusedArenas; // Responses parsed into a recycled arena, without allocating one
+        AZ::u64 overflowedArenas; // Documents which outgrew their arena's buffer, and allocated extra chunks
+        AZ::u64 arenaBytes; // Total buffer size of the arenas currently allocated
+        AZ::u64 highWaterBytes; // Largest Document, which new arena buffers are sized to hold
+    };
+
+    // Request body buffer reuse, see PlayFabRequestManager::GetRequestBodyStats
+    struct PlayFabRequestBodyStats
+    {
+        AZ::u64 acquiredBodies; // One per request serialized
+        AZ::u64 reusedBodies; // Requests serialized into a recycled buffer, without allocating
+        AZ::u64 freedBodies; // Bodies not kept for reuse, because the pool was full or they had grown too large
+        AZ::u64 largestBodyBytes;
+    };
+
+    // Main thread callback delivery counters, see PlayFabRequestManager::GetCallbackStats
+    struct PlayFabCallbackStats
+    {
+        int queuedCallbacks; // Results waiting for a tick to deliver them
+        int maxQueuedCallbacks;
+        AZ::u64 dispatchedCallbacks;
+        AZ::u64 deferredTicks; // Ticks which stopped at the budget and left callbacks for the next tick
+        AZ::u64 budgetOverruns; // Ticks whose callbacks took longer than the budget
+        AZ::u64 maxTickUs; // Longest time spent delivering callbacks in one tick
+    };
+
     class PlayFabRequest
     {
     public:
         typedef std::function<void(PlayFabRequest* request)> HttpCallback;
+        typedef void(*ResultInvoker)(PlayFabRequest* request, void* result);
+        typedef void(*ResultDeleter)(void* result);
 
         // Initializing ctor
-        PlayFabRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const AZStd::string& authKey, const AZStd::string& authValue, const AZStd::string& requestJsonBody, void* customData, void* mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback);
+        PlayFabRequest(AZStd::string URI, Aws::Http::HttpMethod method, AZStd::string authKey, AZStd::string authValue, const AZStd::string& requestJsonBody, void* customData, void* mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback);
+        // Initializing ctor which serializes requestModel directly into a recycled body buffer, rather than going through an intermediate string
+        PlayFabRequest(AZStd::string URI, Aws::Http::HttpMethod method, AZStd::string authKey, AZStd::string authValue, PlayFabBaseModel& requestModel, void* customData, void* mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback);
         ~PlayFabRequest();
 
         // #THIRD_KIND_PLAYFAB_REQUEST_CALLBACK_LINUX: Allow conversion of ProcessApiCallback<T> to void*. Fixes no matching constructor for initialization of 'PlayFabComboSdk::PlayFabRequest'. no known conversion from 'ProcessApiCallback<XXX>' (aka 'void (*)(const XXX &, void *)') to 'void *'
         template < typename T >
-        inline PlayFabRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const AZStd::string& authKey, const AZStd::string& authValue, const AZStd::string& requestJsonBody, void* customData, T mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback)
-            : PlayFabRequest(URI, method, authKey, authValue, requestJsonBody, customData, (void*)mResultCallback, mErrorCallback, internalCallback)
+        inline PlayFabRequest(AZStd::string URI, Aws::Http::HttpMethod method, AZStd::string authKey, AZStd::string authValue, const AZStd::string& requestJsonBody, void* customData, T mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback)
+            : PlayFabRequest(AZStd::move(URI), method, AZStd::move(authKey), AZStd::move(authValue), requestJsonBody, customData, (void*)mResultCallback, mErrorCallback, internalCallback)
+        {
+            static_assert(sizeof(T) <= sizeof(void*), "Size of function pointer is larger than void*, bad cast will occur.");
+        }
+        template < typename T >
+        inline PlayFabRequest(AZStd::string URI, Aws::Http::HttpMethod method, AZStd::string authKey, AZStd::string authValue, PlayFabBaseModel& requestModel, void* customData, T mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback)
+            : PlayFabRequest(AZStd::move(URI), method, AZStd::move(authKey), AZStd::move(authValue), requestModel, customData, (void*)mResultCallback, mErrorCallback, internalCallback)
         {
             static_assert(sizeof(T) <= sizeof(void*), "Size of function pointer is larger than void*, bad cast will occur.");
         }
 
-        void HandleErrorReport(); // Call this when the response information describes an error (this parses that information into mError, and activates the error callback)
+        void HandleErrorReport(); // Call this when the response information describes an error (this parses that information into mError, and dispatches the error callback, after which the request belongs to the request manager)
+
+        AZ::u64 GetQueueWaitMicroseconds() const; // How long the request waited for a worker
+        AZ::u64 GetNetworkMicroseconds() const; // How long the round trip took once it was sent
+
+        void ResetResponse(); // Discard the received response, so the request can be sent again
+        void ReleaseResponseBody(); // Free mResponseText, and mResponseJson or mResponseReader, once the response has been decoded
+        void ReleaseRequestBody(); // Give back the request body buffer, once the request will not be sent again
+
+        // The serialized json request body, which is not null terminated
+        const char* GetRequestBody() const;
+        size_t GetRequestBodySize() const;
 
         // the URI in string form as an recipient of the HTTP connection
         AZStd::string mURI;
+        // The api path within mURI, such as "/Server/GetTime"
+        AZStd::string mCallPath;
+        // Scheduling class, set by PlayFabRequestManager::AddRequest
+        PlayFabRequestPriority mPriority;
+        // Number of times this request has been resent after a transient failure, and the backoff before the last resend
+        int mRetryCount;
+        int mRetryDelayMs;
         // the method of which the HTTP request will take. GET, POST, DELETE, PUT, or HEAD
         Aws::Http::HttpMethod mMethod;
         // Authentication, when present
         AZStd::string mAuthKey;
         AZStd::string mAuthValue;
-        // Json request body
-        AZStd::string mRequestJsonBody;
+        // Json request body, serialized once and sent from this buffer on every attempt
+        PlayFabRequestBody* mRequestBody;
         // Customizable object that provides identification or other information for the caller, in the callback
         void* mCustomData;
 
+        // Timestamps recorded by the request manager as the request moves through it
+        AZStd::chrono::system_clock::time_point mQueuedTime; // Handed to AddRequest
+        AZStd::chrono::system_clock::time_point mSentTime; // Picked up by a worker and sent
+        AZStd::chrono::system_clock::time_point mCompletedTime; // Full response received
+
         // Everything about the response
         std::shared_ptr<Aws::Http::HttpResponse> httpResponse;
-        char* mResponseText; // If the server responded, this will be the raw text returned
+        char* mResponseText; // If the server responded, this will be the raw text returned. Successful responses are parsed in place, so the text is no longer intact once mResponseJson is set.
         int mResponseSize; // If the server responded, this will be the size of the response
-        rapidjson::Document* mResponseJson; // If the server responded with json text, this will be a json Document describing the result from the server
+        rapidjson::Document* mResponseJson; // If the server responded with json text, this will be a json Document describing the result from the server. Its strings may point into mResponseText.
+        PlayFabBufferPool* mResponseBufferPool; // Where mResponseText came from, or nullptr if it was allocated with new[]
+        PlayFabJsonArena* mResponseArena; // Recycled arena which owns mResponseJson, or nullptr if it was allocated with new
+        PlayFabJsonReader* mResponseReader; // Set instead of mResponseJson when a successful response is streamed, see PlayFabSettings::jsonStreamingDecode. Owned by mResponseArena.
+        size_t mResponseCapacity; // Allocated size of mResponseText
+        bool mStreamResponse; // Stream a successful response into mResponseReader even when PlayFabSettings::jsonStreamingDecode is off, for a PlayFabLazyModel result which keeps its tokens
         PlayFabError* mError; // If error, this will be a description of the error
         // This will always be the response code from the server
         Aws::Http::HttpResponseCode mHttpCode;
@@ -55,6 +218,13 @@ namespace PlayFabComboSdk
         HttpCallback mInternalCallback;
         void* mResultCallback;
         ErrorCallback mErrorCallback;
+        // The decoded result, stored by PlayFabRequestManager::DispatchResult until the callbacks are delivered
+        void* mResult;
+        ResultInvoker mResultInvoker; // Calls a request's mResultCallback with mResult
+        ResultDeleter mResultDeleter; // Deletes mResult
+        // Identical requests waiting on this one's response instead of being sent themselves, see PlayFabRequestCoalescer
+        AZStd::vector<PlayFabRequest*> mFollowers;
+        AZStd::string mCoalesceKey; // Set while this request is accepting followers
     private:
         // Disable copy constructor and assignment by making them private
         PlayFabRequest(const PlayFabRequest&);
@@ -62,6 +232,7 @@ namespace PlayFabComboSdk
     };
 
     class PlayFabRequestManager
+        : private AZ::TickBus::Handler
     {
     public:
         static PlayFabRequestManager *playFabHttp;
@@ -70,30 +241,109 @@ namespace PlayFabComboSdk
         ~PlayFabRequestManager();
 
         // see IHttpRequestManager::AddRequest
-        // Add these parameters to a queue of request parameters to send off as an HTTP request as soon as they reach the head of the queue
-        void AddRequest(PlayFabRequest* httpRequestParameters);
+        // Add these parameters to a queue of request parameters to send off as an HTTP request as soon as they reach the head of the queue for their priority
+        void AddRequest(PlayFabRequest* httpRequestParameters, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
         int GetPendingCalls(); // Return the number of unfinished calls
+        bool WaitForPendingCalls(int timeoutMs); // Block until there are no unfinished calls, returning false if timeoutMs passes first. Call from the main thread, whose queued callbacks it delivers.
+        PlayFabConnectionStats GetConnectionStats(); // Return the keep-alive connection pool counters
+        PlayFabTimingStats GetTimingStats(); // Return queue wait and network time totals for completed requests
+        PlayFabCallbackStats GetCallbackStats(); // Return the main thread callback queue depth and budget counters
+        AZStd::unordered_map<AZStd::string, PlayFabRetryStats> GetRetryStats(); // Return retry counters, keyed by api path
+        PlayFabRateLimiter* GetRateLimiter(); // The client side rate limits applied to every request
+        AZStd::unordered_map<AZStd::string, PlayFabCoalescingStats> GetCoalescingStats(); // Return single-flight counters, keyed by api path
+        AZStd::unordered_map<AZStd::string, PlayFabCompressionStats> GetCompressionStats(); // Return body sizes before and after compression, keyed by api path
+        PlayFabResponseBufferStats GetResponseBufferStats(); // Return response buffer reuse counters
+        PlayFabJsonArenaStats GetJsonArenaStats(); // Return response Document arena reuse counters
+        PlayFabRequestBodyStats GetRequestBodyStats(); // Return request body buffer reuse counters
+        PlayFabRequestBodyPool* GetRequestBodyPool(); // The recycled buffers requests are serialized into
+
+        // The priority used for an api path when the caller does not choose one
+        static PlayFabRequestPriority GetDefaultPriority(const AZStd::string& callPath);
+
+        // Hand a decoded result to its callback, and take ownership of both the request and the result.
+        // The callback runs immediately on the calling worker, or later on the main thread when PlayFabSettings::callbacksOnMainThread is set.
+        template <typename ResultType>
+        void DispatchResult(PlayFabRequest* request, ResultType* result)
+        {
+            request->mResult = result;
+            request->mResultInvoker = &InvokeResultCallback<ResultType>;
+            request->mResultDeleter = &DeleteResult<ResultType>;
+            DispatchCallbacks(request);
+        }
+        // Deliver the error or result callbacks for a finished request, and take ownership of it
+        void DispatchCallbacks(PlayFabRequest* request);
+        // Deliver queued callbacks on the calling thread until budgetUs has been spent (at least one is always delivered). 0 delivers all of them.
+        void DispatchQueuedCallbacks(int budgetUs);
 
     private:
-        // PlayFabRequestManager thread loop. 
+        template <typename ResultType>
+        static void InvokeResultCallback(PlayFabRequest* request, void* result)
+        {
+            // Same signature as ProcessApiCallback<ResultType>, which is declared in PlayFabBaseModel.h after this header
+            typedef void(*SuccessCallback)(const ResultType& result, void* customData);
+            SuccessCallback successCallback = reinterpret_cast<SuccessCallback>(request->mResultCallback);
+            successCallback(*static_cast<ResultType*>(result), request->mCustomData);
+        }
+        template <typename ResultType>
+        static void DeleteResult(void* result)
+        {
+            delete static_cast<ResultType*>(result);
+        }
+
+        // Run the callbacks for a request and any requests coalesced into it, then delete them
+        void InvokeCallbacks(PlayFabRequest* request);
+
+        // AZ::TickBus::Handler, delivers queued callbacks on the main thread
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        // PlayFabRequestManager worker thread loop, each worker sends one request at a time and handles its response
         void ThreadFunction();
 
-        // Perform an HTTP request.  Not sure if this one blocks, but if it does, it's very short
-        void HandleRequest(PlayFabRequest* httpRequestParameters);
-        // For the request, block until a response is received, then give the returned JSON to the callback to parse.
+        // Perform an HTTP request, blocking until the response has been received. Returns false if the request could not be sent because the manager is shutting down.
+        bool HandleRequest(PlayFabRequest* httpRequestParameters);
+        // For the request, read the received response, then give the returned JSON to the callback to parse, or queue the request again if the failure is worth retrying.
         void HandleResponse(PlayFabRequest* requestContainer);
+        // Copy the response body into mResponseText, and parse it into mResponseJson or mResponseReader
+        void ReadResponse(PlayFabRequest* requestContainer);
+        // Record the latency breakdown of a request which has just received its response
+        void RecordTiming(PlayFabRequest* request);
+        // Add to the body size totals for an api
+        void RecordTransferSizes(const AZStd::string& callPath, AZ::u64 requestBytes, AZ::u64 requestBytesSent, AZ::u64 responseBytes, AZ::u64 responseBytesReceived);
+
+        // Collection of requests, shared by all worker threads
+        PlayFabRequestQueue* m_requestQueue;
+
+        // Keep-alive http clients, reused across requests to the same host
+        PlayFabHttpClientPool* m_clientPool;
+
+        // Which failures are resent, and the backoff before resending them
+        PlayFabRetryPolicy* m_retryPolicy;
+
+        // Client side throttling, applied before a request is queued
+        PlayFabRateLimiter* m_rateLimiter;
+
+        // Identical read requests in flight, which new duplicates wait on instead of being sent
+        PlayFabRequestCoalescer* m_coalescer;
+
+        // Recycled buffers which responses are read into
+        PlayFabBufferPool* m_bufferPool;
+
+        // Recycled allocators and Documents which responses are parsed into
+        PlayFabJsonArenaPool* m_arenaPool;
 
-        // Collection of requests
-        int m_pendingCalls;
-        AZStd::queue<PlayFabRequest*> m_requestsToHandle;
+        // Recycled buffers which requests are serialized into
+        PlayFabRequestBodyPool* m_requestBodyPool;
 
-        // Member variables for synchronization
-        AZStd::mutex m_requestMutex;
+        AZStd::mutex m_statsMutex;
+        PlayFabTimingStats m_timingStats;
+        AZStd::unordered_map<AZStd::string, PlayFabCompressionStats> m_compressionStats;
 
-        // Run flag used to signal the worker thread
-        AZStd::atomic<bool> m_runThread;
+        // Finished requests waiting for the main thread to deliver their callbacks
+        AZStd::queue<PlayFabRequest*> m_callbackQueue;
+        AZStd::mutex m_callbackMutex;
+        PlayFabCallbackStats m_callbackStats;
 
-        // This is the thread that will be used for all async operations
-        AZStd::thread m_thread;
+        // These are the worker threads that will be used for all async operations
+        AZStd::vector<AZStd::thread> m_threads;
     };
 }
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <AzCore/JSON/rapidjson.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabComboSdk
+{
+    // Streaming alternative to a rapidjson Document for decoding responses.
+    // The response is parsed in place with the rapidjson SAX Reader into a flat list of tokens, which the generated readFromReader methods consume in order.
+    // No tree is built, strings are not copied, and members are matched by a precomputed hash rather than a FindMember scan per field.
+    class PlayFabJsonReader
+    {
+    public:
+        PlayFabJsonReader();
+
+        // Compile time hash of a member name, for the case labels in generated readFromReader methods
+        static constexpr unsigned int Hash(const char* name, unsigned int hash = 2166136261u)
+        {
+            return *name == '\0' ? hash : Hash(name + 1, (hash ^ static_cast<unsigned char>(*name)) * 16777619u);
+        }
+
+        // Parse text in place, replacing any previous tokens. The text must outlive the reader's use of it.
+        bool Parse(char* text);
+        // Forget the tokens, keeping the storage for the next response
+        void Clear();
+        bool IsValid() const { return m_valid; }
+
+        // Exchange tokens and position with other, without copying them
+        void Swap(PlayFabJsonReader& other);
+        // Point the tokens at a copy of the text they were parsed from, which starts at newText rather than oldText
+        void Relocate(const char* oldText, const char* newText);
+
+        // Move back to the first token
+        void Rewind() { m_position = 0; }
+        // Rewind, then move to the value of a top level member, returning false if there is none
+        bool SeekMember(const char* name);
+        // Move from the object at the current position to the value of one of its members, returning false if there is none
+        bool FindMember(const char* name);
+
+        // The current position, to come back to with Seek
+        size_t GetPosition() const { return m_position; }
+        void Seek(size_t position) { m_position = position; m_filterObject = NoPosition; m_filterKey = NoPosition; }
+
+        // Until the object at the current position is next entered and left, NextMember only returns its member name and skips the others.
+        // A generated readFromReader called on the object then decodes just that member. Members of nested objects are not affected.
+        void FilterMember(const char* name);
+
+        // Enter the object at the current position, or skip the value and return false if it is not an object
+        bool StartObject();
+        // Move to the value of the next member of the object which was entered, or past the end of the object and return false
+        bool NextMember(const char*& name);
+        // Hash of the last member name returned by NextMember
+        unsigned int GetMemberHash() const { return m_memberHash; }
+
+        // Enter the array at the current position, or skip the value and return false if it is not an array
+        bool StartArray();
+        // Number of elements in the array last entered with StartArray, so containers can be reserved before reading them
+        rapidjson::SizeType GetArraySize() const { return m_arraySize; }
+        // Whether there is another element at the current position, if not move past the end of the array
+        bool NextElement();
+
+        bool IsNull() const { return m_position < m_tokens.size() && m_tokens[m_position].type == TokenNull; }
+        bool IsObject() const { return m_position < m_tokens.size() && m_tokens[m_position].type == TokenStartObject; }
+        // Return the scalar at the current position, and move past it. Objects and arrays are skipped, and read as null.
+        // The value refers to the response text rather than copying it, so it is only valid until the next call.
+        const rapidjson::Value& GetValue();
+        // Move past the value at the current position
+        void Skip();
+
+    private:
+        static const size_t NoPosition = static_cast<size_t>(-1);
+
+        enum TokenType
+        {
+            TokenNull,
+            TokenBool,
+            TokenInt,
+            TokenUint,
+            TokenInt64,
+            TokenUint64,
+            TokenDouble,
+            TokenString,
+            TokenKey,
+            TokenStartObject,
+            TokenEndObject,
+            TokenStartArray,
+            TokenEndArray
+        };
+
+        struct Token
+        {
+            TokenType type;
+            rapidjson::SizeType length; // Strings and keys, or the member or element count of objects and arrays
+            unsigned int hash; // Keys
+            union
+            {
+                const char* string;
+                bool boolean;
+                int intValue;
+                unsigned uintValue;
+                int64_t int64Value;
+                uint64_t uint64Value;
+                double doubleValue;
+                size_t end; // Objects and arrays: the position just past their end token, so skipping them is a jump
+            };
+        };
+
+        // rapidjson SAX handler which appends tokens
+        struct TokenWriter;
+
+        AZStd::vector<Token> m_tokens;
+        AZStd::vector<size_t> m_openTokens; // Objects and arrays whose end has not been reached yet, while parsing
+        size_t m_position;
+        unsigned int m_memberHash;
+        rapidjson::SizeType m_arraySize;
+        size_t m_filterObject; // Object which FilterMember applies to, until it is entered
+        size_t m_filterKey; // Position of the next key of the filtered object, once it has been entered
+        const char* m_filterName;
+        unsigned int m_filterHash;
+        bool m_valid;
+        rapidjson::Value m_value;
+    };
+}
@@ -23,6 +23,14 @@ namespace PlayFabComboSdk
                 AuthorizationTicket(src.AuthorizationTicket)
             {}
 
+            AuthUserRequest(AuthUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                AuthorizationTicket(AZStd::move(src.AuthorizationTicket))
+            {}
+
+            AuthUserRequest& operator=(const AuthUserRequest& src) = default;
+            AuthUserRequest& operator=(AuthUserRequest&& src) = default;
+
             AuthUserRequest(const rapidjson::Value& obj) : AuthUserRequest()
             {
                 readFromValue(obj);
@@ -47,6 +55,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("AuthorizationTicket"):
+                            if (strcmp(member, "AuthorizationTicket") != 0)
+                                break;
+                            AuthorizationTicket = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AuthUserResponse : public PlayFabBaseModel
@@ -66,6 +97,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            AuthUserResponse(AuthUserResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                Authorized(AZStd::move(src.Authorized)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            AuthUserResponse& operator=(const AuthUserResponse& src) = default;
+            AuthUserResponse& operator=(AuthUserResponse&& src) = default;
+
             AuthUserResponse(const rapidjson::Value& obj) : AuthUserResponse()
             {
                 readFromValue(obj);
@@ -96,6 +136,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Authorized"):
+                            if (strcmp(member, "Authorized") != 0)
+                                break;
+                            Authorized = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeregisterGameRequest : public PlayFabBaseModel
@@ -112,6 +180,14 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            DeregisterGameRequest(DeregisterGameRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            DeregisterGameRequest& operator=(const DeregisterGameRequest& src) = default;
+            DeregisterGameRequest& operator=(DeregisterGameRequest&& src) = default;
+
             DeregisterGameRequest(const rapidjson::Value& obj) : DeregisterGameRequest()
             {
                 readFromValue(obj);
@@ -136,6 +212,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeregisterGameResponse : public PlayFabBaseModel
@@ -149,6 +248,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeregisterGameResponse(DeregisterGameResponse&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeregisterGameResponse& operator=(const DeregisterGameResponse& src) = default;
+            DeregisterGameResponse& operator=(DeregisterGameResponse&& src) = default;
+
             DeregisterGameResponse(const rapidjson::Value& obj) : DeregisterGameResponse()
             {
                 readFromValue(obj);
@@ -169,6 +275,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct ItemInstance : public PlayFabBaseModel
@@ -186,8 +298,8 @@ namespace PlayFabComboSdk
             AZStd::string DisplayName;
             AZStd::string UnitCurrency;
             Uint32 UnitPrice;
-            std::list<AZStd::string> BundleContents;
-            std::map<AZStd::string, AZStd::string> CustomData;
+            std::vector<AZStd::string> BundleContents;
+            PlayFabStringMap<AZStd::string> CustomData;
 
             ItemInstance() :
                 PlayFabBaseModel(),
@@ -227,6 +339,28 @@ namespace PlayFabComboSdk
                 CustomData(src.CustomData)
             {}
 
+            ItemInstance(ItemInstance&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                PurchaseDate(AZStd::move(src.PurchaseDate)),
+                Expiration(AZStd::move(src.Expiration)),
+                RemainingUses(AZStd::move(src.RemainingUses)),
+                UsesIncrementedBy(AZStd::move(src.UsesIncrementedBy)),
+                Annotation(AZStd::move(src.Annotation)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                BundleParent(AZStd::move(src.BundleParent)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                UnitCurrency(AZStd::move(src.UnitCurrency)),
+                UnitPrice(AZStd::move(src.UnitPrice)),
+                BundleContents(AZStd::move(src.BundleContents)),
+                CustomData(AZStd::move(src.CustomData))
+            {}
+
+            ItemInstance& operator=(const ItemInstance& src) = default;
+            ItemInstance& operator=(ItemInstance&& src) = default;
+
             ItemInstance(const rapidjson::Value& obj) : ItemInstance()
             {
                 readFromValue(obj);
@@ -292,7 +426,7 @@ namespace PlayFabComboSdk
                 if (!BundleContents.empty()) {
                     writer.String("BundleContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -300,7 +434,7 @@ namespace PlayFabComboSdk
                 if (!CustomData.empty()) {
                     writer.String("CustomData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -340,8 +474,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundleContents_member = obj.FindMember("BundleContents");
                 if (BundleContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundleContents_member->value;
+                    BundleContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundleContents.push_back(memberList[i].GetString());
+                        BundleContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -353,6 +488,113 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PurchaseDate"):
+                            if (strcmp(member, "PurchaseDate") != 0)
+                                break;
+                            PurchaseDate = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expiration"):
+                            if (strcmp(member, "Expiration") != 0)
+                                break;
+                            Expiration = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsesIncrementedBy"):
+                            if (strcmp(member, "UsesIncrementedBy") != 0)
+                                break;
+                            UsesIncrementedBy = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleParent"):
+                            if (strcmp(member, "BundleParent") != 0)
+                                break;
+                            BundleParent = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitCurrency"):
+                            if (strcmp(member, "UnitCurrency") != 0)
+                                break;
+                            UnitCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitPrice"):
+                            if (strcmp(member, "UnitPrice") != 0)
+                                break;
+                            UnitPrice = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleContents"):
+                            if (strcmp(member, "BundleContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundleContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundleContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CustomData[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerJoinedRequest : public PlayFabBaseModel
@@ -372,6 +614,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            PlayerJoinedRequest(PlayerJoinedRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            PlayerJoinedRequest& operator=(const PlayerJoinedRequest& src) = default;
+            PlayerJoinedRequest& operator=(PlayerJoinedRequest&& src) = default;
+
             PlayerJoinedRequest(const rapidjson::Value& obj) : PlayerJoinedRequest()
             {
                 readFromValue(obj);
@@ -400,6 +651,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerJoinedResponse : public PlayFabBaseModel
@@ -413,6 +692,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            PlayerJoinedResponse(PlayerJoinedResponse&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            PlayerJoinedResponse& operator=(const PlayerJoinedResponse& src) = default;
+            PlayerJoinedResponse& operator=(PlayerJoinedResponse&& src) = default;
+
             PlayerJoinedResponse(const rapidjson::Value& obj) : PlayerJoinedResponse()
             {
                 readFromValue(obj);
@@ -433,6 +719,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct PlayerLeftRequest : public PlayFabBaseModel
@@ -452,6 +744,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            PlayerLeftRequest(PlayerLeftRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            PlayerLeftRequest& operator=(const PlayerLeftRequest& src) = default;
+            PlayerLeftRequest& operator=(PlayerLeftRequest&& src) = default;
+
             PlayerLeftRequest(const rapidjson::Value& obj) : PlayerLeftRequest()
             {
                 readFromValue(obj);
@@ -480,6 +781,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerLeftResponse : public PlayFabBaseModel
@@ -493,6 +822,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            PlayerLeftResponse(PlayerLeftResponse&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            PlayerLeftResponse& operator=(const PlayerLeftResponse& src) = default;
+            PlayerLeftResponse& operator=(PlayerLeftResponse&& src) = default;
+
             PlayerLeftResponse(const rapidjson::Value& obj) : PlayerLeftResponse()
             {
                 readFromValue(obj);
@@ -513,6 +849,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         enum Region
@@ -547,24 +889,19 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<Region>(obj.GetInt());
 
-            static std::map<const char *, Region, PlayFabComboSdk::StringCompare> _RegionMap;
-            if (_RegionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _RegionMap["USCentral"] = RegionUSCentral;
-                _RegionMap["USEast"] = RegionUSEast;
-                _RegionMap["EUWest"] = RegionEUWest;
-                _RegionMap["Singapore"] = RegionSingapore;
-                _RegionMap["Japan"] = RegionJapan;
-                _RegionMap["Brazil"] = RegionBrazil;
-                _RegionMap["Australia"] = RegionAustralia;
-
+            case PlayFabJsonReader::Hash("USCentral"): if (strcmp(name, "USCentral") == 0) return RegionUSCentral; break;
+            case PlayFabJsonReader::Hash("USEast"): if (strcmp(name, "USEast") == 0) return RegionUSEast; break;
+            case PlayFabJsonReader::Hash("EUWest"): if (strcmp(name, "EUWest") == 0) return RegionEUWest; break;
+            case PlayFabJsonReader::Hash("Singapore"): if (strcmp(name, "Singapore") == 0) return RegionSingapore; break;
+            case PlayFabJsonReader::Hash("Japan"): if (strcmp(name, "Japan") == 0) return RegionJapan; break;
+            case PlayFabJsonReader::Hash("Brazil"): if (strcmp(name, "Brazil") == 0) return RegionBrazil; break;
+            case PlayFabJsonReader::Hash("Australia"): if (strcmp(name, "Australia") == 0) return RegionAustralia; break;
             }
 
-            auto output = _RegionMap.find(obj.GetString());
-            if (output != _RegionMap.end())
-                return output->second;
-
             return RegionUSCentral; // Basically critical fail
         }
 
@@ -576,7 +913,7 @@ namespace PlayFabComboSdk
             AZStd::string Build;
             Region pfRegion;
             AZStd::string GameMode;
-            std::map<AZStd::string, AZStd::string> Tags;
+            PlayFabStringMap<AZStd::string> Tags;
 
             RegisterGameRequest() :
                 PlayFabBaseModel(),
@@ -600,6 +937,20 @@ namespace PlayFabComboSdk
                 Tags(src.Tags)
             {}
 
+            RegisterGameRequest(RegisterGameRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                ServerHost(AZStd::move(src.ServerHost)),
+                ServerPort(AZStd::move(src.ServerPort)),
+                Build(AZStd::move(src.Build)),
+                pfRegion(AZStd::move(src.pfRegion)),
+                GameMode(AZStd::move(src.GameMode)),
+                Tags(AZStd::move(src.Tags))
+            {}
+
+            RegisterGameRequest& operator=(const RegisterGameRequest& src) = default;
+            RegisterGameRequest& operator=(RegisterGameRequest&& src) = default;
+
             RegisterGameRequest(const rapidjson::Value& obj) : RegisterGameRequest()
             {
                 readFromValue(obj);
@@ -629,7 +980,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -661,6 +1012,66 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerHost"):
+                            if (strcmp(member, "ServerHost") != 0)
+                                break;
+                            ServerHost = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerPort"):
+                            if (strcmp(member, "ServerPort") != 0)
+                                break;
+                            ServerPort = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Build"):
+                            if (strcmp(member, "Build") != 0)
+                                break;
+                            Build = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Region"):
+                            if (strcmp(member, "Region") != 0)
+                                break;
+                            pfRegion = readRegionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("GameMode"):
+                            if (strcmp(member, "GameMode") != 0)
+                                break;
+                            GameMode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Tags[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RegisterGameResponse : public PlayFabBaseModel
@@ -677,6 +1088,14 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            RegisterGameResponse(RegisterGameResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            RegisterGameResponse& operator=(const RegisterGameResponse& src) = default;
+            RegisterGameResponse& operator=(RegisterGameResponse&& src) = default;
+
             RegisterGameResponse(const rapidjson::Value& obj) : RegisterGameResponse()
             {
                 readFromValue(obj);
@@ -703,6 +1122,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct StartGameRequest : public PlayFabBaseModel
@@ -731,6 +1173,18 @@ namespace PlayFabComboSdk
                 ExternalMatchmakerEventEndpoint(src.ExternalMatchmakerEventEndpoint)
             {}
 
+            StartGameRequest(StartGameRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Build(AZStd::move(src.Build)),
+                pfRegion(AZStd::move(src.pfRegion)),
+                GameMode(AZStd::move(src.GameMode)),
+                CustomCommandLineData(AZStd::move(src.CustomCommandLineData)),
+                ExternalMatchmakerEventEndpoint(AZStd::move(src.ExternalMatchmakerEventEndpoint))
+            {}
+
+            StartGameRequest& operator=(const StartGameRequest& src) = default;
+            StartGameRequest& operator=(StartGameRequest&& src) = default;
+
             StartGameRequest(const rapidjson::Value& obj) : StartGameRequest()
             {
                 readFromValue(obj);
@@ -773,6 +1227,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Build"):
+                            if (strcmp(member, "Build") != 0)
+                                break;
+                            Build = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Region"):
+                            if (strcmp(member, "Region") != 0)
+                                break;
+                            pfRegion = readRegionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("GameMode"):
+                            if (strcmp(member, "GameMode") != 0)
+                                break;
+                            GameMode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomCommandLineData"):
+                            if (strcmp(member, "CustomCommandLineData") != 0)
+                                break;
+                            CustomCommandLineData = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExternalMatchmakerEventEndpoint"):
+                            if (strcmp(member, "ExternalMatchmakerEventEndpoint") != 0)
+                                break;
+                            ExternalMatchmakerEventEndpoint = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct StartGameResponse : public PlayFabBaseModel
@@ -795,6 +1292,16 @@ namespace PlayFabComboSdk
                 ServerPort(src.ServerPort)
             {}
 
+            StartGameResponse(StartGameResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                GameID(AZStd::move(src.GameID)),
+                ServerHostname(AZStd::move(src.ServerHostname)),
+                ServerPort(AZStd::move(src.ServerPort))
+            {}
+
+            StartGameResponse& operator=(const StartGameResponse& src) = default;
+            StartGameResponse& operator=(StartGameResponse&& src) = default;
+
             StartGameResponse(const rapidjson::Value& obj) : StartGameResponse()
             {
                 readFromValue(obj);
@@ -831,6 +1338,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GameID"):
+                            if (strcmp(member, "GameID") != 0)
+                                break;
+                            GameID = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerHostname"):
+                            if (strcmp(member, "ServerHostname") != 0)
+                                break;
+                            ServerHostname = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerPort"):
+                            if (strcmp(member, "ServerPort") != 0)
+                                break;
+                            ServerPort = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserInfoRequest : public PlayFabBaseModel
@@ -850,6 +1390,15 @@ namespace PlayFabComboSdk
                 MinCatalogVersion(src.MinCatalogVersion)
             {}
 
+            UserInfoRequest(UserInfoRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                MinCatalogVersion(AZStd::move(src.MinCatalogVersion))
+            {}
+
+            UserInfoRequest& operator=(const UserInfoRequest& src) = default;
+            UserInfoRequest& operator=(UserInfoRequest&& src) = default;
+
             UserInfoRequest(const rapidjson::Value& obj) : UserInfoRequest()
             {
                 readFromValue(obj);
@@ -878,6 +1427,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MinCatalogVersion"):
+                            if (strcmp(member, "MinCatalogVersion") != 0)
+                                break;
+                            MinCatalogVersion = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct VirtualCurrencyRechargeTime : public PlayFabBaseModel
@@ -900,6 +1477,16 @@ namespace PlayFabComboSdk
                 RechargeMax(src.RechargeMax)
             {}
 
+            VirtualCurrencyRechargeTime(VirtualCurrencyRechargeTime&& src) noexcept :
+                PlayFabBaseModel(),
+                SecondsToRecharge(AZStd::move(src.SecondsToRecharge)),
+                RechargeTime(AZStd::move(src.RechargeTime)),
+                RechargeMax(AZStd::move(src.RechargeMax))
+            {}
+
+            VirtualCurrencyRechargeTime& operator=(const VirtualCurrencyRechargeTime& src) = default;
+            VirtualCurrencyRechargeTime& operator=(VirtualCurrencyRechargeTime&& src) = default;
+
             VirtualCurrencyRechargeTime(const rapidjson::Value& obj) : VirtualCurrencyRechargeTime()
             {
                 readFromValue(obj);
@@ -932,6 +1519,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecondsToRecharge"):
+                            if (strcmp(member, "SecondsToRecharge") != 0)
+                                break;
+                            SecondsToRecharge = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeTime"):
+                            if (strcmp(member, "RechargeTime") != 0)
+                                break;
+                            RechargeTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeMax"):
+                            if (strcmp(member, "RechargeMax") != 0)
+                                break;
+                            RechargeMax = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserInfoResponse : public PlayFabBaseModel
@@ -939,9 +1559,9 @@ namespace PlayFabComboSdk
             AZStd::string PlayFabId;
             AZStd::string Username;
             AZStd::string TitleDisplayName;
-            std::list<ItemInstance> Inventory;
-            std::map<AZStd::string, Int32> VirtualCurrency;
-            std::map<AZStd::string, VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
+            std::vector<ItemInstance> Inventory;
+            PlayFabStringMap<Int32> VirtualCurrency;
+            PlayFabStringMap<VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
             bool IsDeveloper;
             AZStd::string SteamId;
 
@@ -969,6 +1589,21 @@ namespace PlayFabComboSdk
                 SteamId(src.SteamId)
             {}
 
+            UserInfoResponse(UserInfoResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Username(AZStd::move(src.Username)),
+                TitleDisplayName(AZStd::move(src.TitleDisplayName)),
+                Inventory(AZStd::move(src.Inventory)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                VirtualCurrencyRechargeTimes(AZStd::move(src.VirtualCurrencyRechargeTimes)),
+                IsDeveloper(AZStd::move(src.IsDeveloper)),
+                SteamId(AZStd::move(src.SteamId))
+            {}
+
+            UserInfoResponse& operator=(const UserInfoResponse& src) = default;
+            UserInfoResponse& operator=(UserInfoResponse&& src) = default;
+
             UserInfoResponse(const rapidjson::Value& obj) : UserInfoResponse()
             {
                 readFromValue(obj);
@@ -996,7 +1631,7 @@ namespace PlayFabComboSdk
                 if (!Inventory.empty()) {
                     writer.String("Inventory");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -1004,7 +1639,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrency.empty()) {
                     writer.String("VirtualCurrency");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -1013,7 +1648,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyRechargeTimes.empty()) {
                     writer.String("VirtualCurrencyRechargeTimes");
                     writer.StartObject();
-                    for (std::map<AZStd::string, VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
+                    for (PlayFabStringMap<VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -1039,8 +1674,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Inventory_member = obj.FindMember("Inventory");
                 if (Inventory_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Inventory_member->value;
+                    Inventory.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Inventory.push_back(ItemInstance(memberList[i]));
+                        Inventory.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrency_member = obj.FindMember("VirtualCurrency");
@@ -1062,6 +1698,86 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleDisplayName"):
+                            if (strcmp(member, "TitleDisplayName") != 0)
+                                break;
+                            TitleDisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Inventory"):
+                            if (strcmp(member, "Inventory") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Inventory.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Inventory.emplace_back();
+                                    Inventory.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrency[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+                            if (strcmp(member, "VirtualCurrencyRechargeTimes") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyRechargeTimes[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("IsDeveloper"):
+                            if (strcmp(member, "IsDeveloper") != 0)
+                                break;
+                            IsDeveloper = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamId"):
+                            if (strcmp(member, "SteamId") != 0)
+                                break;
+                            SteamId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
 
@@ -26,6 +26,15 @@ namespace PlayFabComboSdk
                 Id(src.Id)
             {}
 
+            NameIdentifier(NameIdentifier&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Id(AZStd::move(src.Id))
+            {}
+
+            NameIdentifier& operator=(const NameIdentifier& src) = default;
+            NameIdentifier& operator=(NameIdentifier&& src) = default;
+
             NameIdentifier(const rapidjson::Value& obj) : NameIdentifier()
             {
                 readFromValue(obj);
@@ -58,6 +67,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum TaskInstanceStatus
@@ -90,23 +127,18 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<TaskInstanceStatus>(obj.GetInt());
 
-            static std::map<const char *, TaskInstanceStatus, PlayFabComboSdk::StringCompare> _TaskInstanceStatusMap;
-            if (_TaskInstanceStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _TaskInstanceStatusMap["Succeeded"] = TaskInstanceStatusSucceeded;
-                _TaskInstanceStatusMap["Starting"] = TaskInstanceStatusStarting;
-                _TaskInstanceStatusMap["InProgress"] = TaskInstanceStatusInProgress;
-                _TaskInstanceStatusMap["Failed"] = TaskInstanceStatusFailed;
-                _TaskInstanceStatusMap["Aborted"] = TaskInstanceStatusAborted;
-                _TaskInstanceStatusMap["Pending"] = TaskInstanceStatusPending;
-
+            case PlayFabJsonReader::Hash("Succeeded"): if (strcmp(name, "Succeeded") == 0) return TaskInstanceStatusSucceeded; break;
+            case PlayFabJsonReader::Hash("Starting"): if (strcmp(name, "Starting") == 0) return TaskInstanceStatusStarting; break;
+            case PlayFabJsonReader::Hash("InProgress"): if (strcmp(name, "InProgress") == 0) return TaskInstanceStatusInProgress; break;
+            case PlayFabJsonReader::Hash("Failed"): if (strcmp(name, "Failed") == 0) return TaskInstanceStatusFailed; break;
+            case PlayFabJsonReader::Hash("Aborted"): if (strcmp(name, "Aborted") == 0) return TaskInstanceStatusAborted; break;
+            case PlayFabJsonReader::Hash("Pending"): if (strcmp(name, "Pending") == 0) return TaskInstanceStatusPending; break;
             }
 
-            auto output = _TaskInstanceStatusMap.find(obj.GetString());
-            if (output != _TaskInstanceStatusMap.end())
-                return output->second;
-
             return TaskInstanceStatusSucceeded; // Basically critical fail
         }
 
@@ -157,6 +189,53 @@ namespace PlayFabComboSdk
                 TotalPlayersProcessed(src.TotalPlayersProcessed)
             {}
 
+            ActionsOnPlayersInSegmentTaskSummary(ActionsOnPlayersInSegmentTaskSummary&& src) noexcept :
+                PlayFabBaseModel(),
+                TaskInstanceId(AZStd::move(src.TaskInstanceId)),
+                TaskIdentifier(src.TaskIdentifier),
+                StartedAt(AZStd::move(src.StartedAt)),
+                CompletedAt(AZStd::move(src.CompletedAt)),
+                Status(AZStd::move(src.Status)),
+                PercentComplete(AZStd::move(src.PercentComplete)),
+                EstimatedSecondsRemaining(AZStd::move(src.EstimatedSecondsRemaining)),
+                ScheduledByUserId(AZStd::move(src.ScheduledByUserId)),
+                ErrorMessage(AZStd::move(src.ErrorMessage)),
+                ErrorWasFatal(AZStd::move(src.ErrorWasFatal)),
+                TotalPlayersInSegment(AZStd::move(src.TotalPlayersInSegment)),
+                TotalPlayersProcessed(AZStd::move(src.TotalPlayersProcessed))
+            {
+                src.TaskIdentifier = nullptr;
+            }
+
+            ActionsOnPlayersInSegmentTaskSummary& operator=(const ActionsOnPlayersInSegmentTaskSummary& src)
+            {
+                if (this != &src)
+                    *this = ActionsOnPlayersInSegmentTaskSummary(src);
+                return *this;
+            }
+
+            ActionsOnPlayersInSegmentTaskSummary& operator=(ActionsOnPlayersInSegmentTaskSummary&& src)
+            {
+                if (this != &src)
+                {
+                    TaskInstanceId = AZStd::move(src.TaskInstanceId);
+                    if (TaskIdentifier != nullptr) delete TaskIdentifier;
+                    TaskIdentifier = src.TaskIdentifier;
+                    src.TaskIdentifier = nullptr;
+                    StartedAt = AZStd::move(src.StartedAt);
+                    CompletedAt = AZStd::move(src.CompletedAt);
+                    Status = AZStd::move(src.Status);
+                    PercentComplete = AZStd::move(src.PercentComplete);
+                    EstimatedSecondsRemaining = AZStd::move(src.EstimatedSecondsRemaining);
+                    ScheduledByUserId = AZStd::move(src.ScheduledByUserId);
+                    ErrorMessage = AZStd::move(src.ErrorMessage);
+                    ErrorWasFatal = AZStd::move(src.ErrorWasFatal);
+                    TotalPlayersInSegment = AZStd::move(src.TotalPlayersInSegment);
+                    TotalPlayersProcessed = AZStd::move(src.TotalPlayersProcessed);
+                }
+                return *this;
+            }
+
             ActionsOnPlayersInSegmentTaskSummary(const rapidjson::Value& obj) : ActionsOnPlayersInSegmentTaskSummary()
             {
                 readFromValue(obj);
@@ -248,6 +327,85 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TaskInstanceId"):
+                            if (strcmp(member, "TaskInstanceId") != 0)
+                                break;
+                            TaskInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TaskIdentifier"):
+                            if (strcmp(member, "TaskIdentifier") != 0)
+                                break;
+                            TaskIdentifier = new NameIdentifier;
+                            TaskIdentifier->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("StartedAt"):
+                            if (strcmp(member, "StartedAt") != 0)
+                                break;
+                            StartedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CompletedAt"):
+                            if (strcmp(member, "CompletedAt") != 0)
+                                break;
+                            CompletedAt = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Status"):
+                            if (strcmp(member, "Status") != 0)
+                                break;
+                            Status = readTaskInstanceStatusFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PercentComplete"):
+                            if (strcmp(member, "PercentComplete") != 0)
+                                break;
+                            PercentComplete = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("EstimatedSecondsRemaining"):
+                            if (strcmp(member, "EstimatedSecondsRemaining") != 0)
+                                break;
+                            EstimatedSecondsRemaining = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledByUserId"):
+                            if (strcmp(member, "ScheduledByUserId") != 0)
+                                break;
+                            ScheduledByUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ErrorMessage"):
+                            if (strcmp(member, "ErrorMessage") != 0)
+                                break;
+                            ErrorMessage = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ErrorWasFatal"):
+                            if (strcmp(member, "ErrorWasFatal") != 0)
+                                break;
+                            ErrorWasFatal = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalPlayersInSegment"):
+                            if (strcmp(member, "TotalPlayersInSegment") != 0)
+                                break;
+                            TotalPlayersInSegment = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalPlayersProcessed"):
+                            if (strcmp(member, "TotalPlayersProcessed") != 0)
+                                break;
+                            TotalPlayersProcessed = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AdCampaignAttribution : public PlayFabBaseModel
@@ -270,6 +428,16 @@ namespace PlayFabComboSdk
                 AttributedAt(src.AttributedAt)
             {}
 
+            AdCampaignAttribution(AdCampaignAttribution&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                CampaignId(AZStd::move(src.CampaignId)),
+                AttributedAt(AZStd::move(src.AttributedAt))
+            {}
+
+            AdCampaignAttribution& operator=(const AdCampaignAttribution& src) = default;
+            AdCampaignAttribution& operator=(AdCampaignAttribution&& src) = default;
+
             AdCampaignAttribution(const rapidjson::Value& obj) : AdCampaignAttribution()
             {
                 readFromValue(obj);
@@ -306,6 +474,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CampaignId"):
+                            if (strcmp(member, "CampaignId") != 0)
+                                break;
+                            CampaignId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("AttributedAt"):
+                            if (strcmp(member, "AttributedAt") != 0)
+                                break;
+                            AttributedAt = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AdCampaignAttributionModel : public PlayFabBaseModel
@@ -328,6 +529,16 @@ namespace PlayFabComboSdk
                 AttributedAt(src.AttributedAt)
             {}
 
+            AdCampaignAttributionModel(AdCampaignAttributionModel&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                CampaignId(AZStd::move(src.CampaignId)),
+                AttributedAt(AZStd::move(src.AttributedAt))
+            {}
+
+            AdCampaignAttributionModel& operator=(const AdCampaignAttributionModel& src) = default;
+            AdCampaignAttributionModel& operator=(AdCampaignAttributionModel&& src) = default;
+
             AdCampaignAttributionModel(const rapidjson::Value& obj) : AdCampaignAttributionModel()
             {
                 readFromValue(obj);
@@ -364,6 +575,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CampaignId"):
+                            if (strcmp(member, "CampaignId") != 0)
+                                break;
+                            CampaignId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("AttributedAt"):
+                            if (strcmp(member, "AttributedAt") != 0)
+                                break;
+                            AttributedAt = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddCharacterVirtualCurrencyRequest : public PlayFabBaseModel
@@ -389,6 +633,17 @@ namespace PlayFabComboSdk
                 Amount(src.Amount)
             {}
 
+            AddCharacterVirtualCurrencyRequest(AddCharacterVirtualCurrencyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Amount(AZStd::move(src.Amount))
+            {}
+
+            AddCharacterVirtualCurrencyRequest& operator=(const AddCharacterVirtualCurrencyRequest& src) = default;
+            AddCharacterVirtualCurrencyRequest& operator=(AddCharacterVirtualCurrencyRequest&& src) = default;
+
             AddCharacterVirtualCurrencyRequest(const rapidjson::Value& obj) : AddCharacterVirtualCurrencyRequest()
             {
                 readFromValue(obj);
@@ -425,6 +680,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Amount"):
+                            if (strcmp(member, "Amount") != 0)
+                                break;
+                            Amount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddFriendRequest : public PlayFabBaseModel
@@ -453,6 +746,18 @@ namespace PlayFabComboSdk
                 FriendTitleDisplayName(src.FriendTitleDisplayName)
             {}
 
+            AddFriendRequest(AddFriendRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                FriendPlayFabId(AZStd::move(src.FriendPlayFabId)),
+                FriendUsername(AZStd::move(src.FriendUsername)),
+                FriendEmail(AZStd::move(src.FriendEmail)),
+                FriendTitleDisplayName(AZStd::move(src.FriendTitleDisplayName))
+            {}
+
+            AddFriendRequest& operator=(const AddFriendRequest& src) = default;
+            AddFriendRequest& operator=(AddFriendRequest&& src) = default;
+
             AddFriendRequest(const rapidjson::Value& obj) : AddFriendRequest()
             {
                 readFromValue(obj);
@@ -501,6 +806,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendPlayFabId"):
+                            if (strcmp(member, "FriendPlayFabId") != 0)
+                                break;
+                            FriendPlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendUsername"):
+                            if (strcmp(member, "FriendUsername") != 0)
+                                break;
+                            FriendUsername = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendEmail"):
+                            if (strcmp(member, "FriendEmail") != 0)
+                                break;
+                            FriendEmail = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendTitleDisplayName"):
+                            if (strcmp(member, "FriendTitleDisplayName") != 0)
+                                break;
+                            FriendTitleDisplayName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddPlayerTagRequest : public PlayFabBaseModel
@@ -520,6 +868,15 @@ namespace PlayFabComboSdk
                 TagName(src.TagName)
             {}
 
+            AddPlayerTagRequest(AddPlayerTagRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                TagName(AZStd::move(src.TagName))
+            {}
+
+            AddPlayerTagRequest& operator=(const AddPlayerTagRequest& src) = default;
+            AddPlayerTagRequest& operator=(AddPlayerTagRequest&& src) = default;
+
             AddPlayerTagRequest(const rapidjson::Value& obj) : AddPlayerTagRequest()
             {
                 readFromValue(obj);
@@ -548,6 +905,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TagName"):
+                            if (strcmp(member, "TagName") != 0)
+                                break;
+                            TagName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddPlayerTagResult : public PlayFabBaseModel
@@ -561,6 +946,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            AddPlayerTagResult(AddPlayerTagResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            AddPlayerTagResult& operator=(const AddPlayerTagResult& src) = default;
+            AddPlayerTagResult& operator=(AddPlayerTagResult&& src) = default;
+
             AddPlayerTagResult(const rapidjson::Value& obj) : AddPlayerTagResult()
             {
                 readFromValue(obj);
@@ -581,12 +973,18 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct AddSharedGroupMembersRequest : public PlayFabBaseModel
         {
             AZStd::string SharedGroupId;
-            std::list<AZStd::string> PlayFabIds;
+            std::vector<AZStd::string> PlayFabIds;
 
             AddSharedGroupMembersRequest() :
                 PlayFabBaseModel(),
@@ -600,6 +998,15 @@ namespace PlayFabComboSdk
                 PlayFabIds(src.PlayFabIds)
             {}
 
+            AddSharedGroupMembersRequest(AddSharedGroupMembersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId)),
+                PlayFabIds(AZStd::move(src.PlayFabIds))
+            {}
+
+            AddSharedGroupMembersRequest& operator=(const AddSharedGroupMembersRequest& src) = default;
+            AddSharedGroupMembersRequest& operator=(AddSharedGroupMembersRequest&& src) = default;
+
             AddSharedGroupMembersRequest(const rapidjson::Value& obj) : AddSharedGroupMembersRequest()
             {
                 readFromValue(obj);
@@ -616,7 +1023,7 @@ namespace PlayFabComboSdk
                 writer.String(SharedGroupId.c_str());
                 writer.String("PlayFabIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -630,13 +1037,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayFabIds_member = obj.FindMember("PlayFabIds");
                 if (PlayFabIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayFabIds_member->value;
+                    PlayFabIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayFabIds.push_back(memberList[i].GetString());
+                        PlayFabIds.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabIds"):
+                            if (strcmp(member, "PlayFabIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayFabIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayFabIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AddSharedGroupMembersResult : public PlayFabBaseModel
@@ -650,6 +1093,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            AddSharedGroupMembersResult(AddSharedGroupMembersResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            AddSharedGroupMembersResult& operator=(const AddSharedGroupMembersResult& src) = default;
+            AddSharedGroupMembersResult& operator=(AddSharedGroupMembersResult&& src) = default;
+
             AddSharedGroupMembersResult(const rapidjson::Value& obj) : AddSharedGroupMembersResult()
             {
                 readFromValue(obj);
@@ -670,6 +1120,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct AddUserVirtualCurrencyRequest : public PlayFabBaseModel
@@ -692,6 +1148,16 @@ namespace PlayFabComboSdk
                 Amount(src.Amount)
             {}
 
+            AddUserVirtualCurrencyRequest(AddUserVirtualCurrencyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Amount(AZStd::move(src.Amount))
+            {}
+
+            AddUserVirtualCurrencyRequest& operator=(const AddUserVirtualCurrencyRequest& src) = default;
+            AddUserVirtualCurrencyRequest& operator=(AddUserVirtualCurrencyRequest&& src) = default;
+
             AddUserVirtualCurrencyRequest(const rapidjson::Value& obj) : AddUserVirtualCurrencyRequest()
             {
                 readFromValue(obj);
@@ -724,6 +1190,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Amount"):
+                            if (strcmp(member, "Amount") != 0)
+                                break;
+                            Amount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AuthenticateSessionTicketRequest : public PlayFabBaseModel
@@ -740,6 +1239,14 @@ namespace PlayFabComboSdk
                 SessionTicket(src.SessionTicket)
             {}
 
+            AuthenticateSessionTicketRequest(AuthenticateSessionTicketRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SessionTicket(AZStd::move(src.SessionTicket))
+            {}
+
+            AuthenticateSessionTicketRequest& operator=(const AuthenticateSessionTicketRequest& src) = default;
+            AuthenticateSessionTicketRequest& operator=(AuthenticateSessionTicketRequest&& src) = default;
+
             AuthenticateSessionTicketRequest(const rapidjson::Value& obj) : AuthenticateSessionTicketRequest()
             {
                 readFromValue(obj);
@@ -764,6 +1271,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SessionTicket"):
+                            if (strcmp(member, "SessionTicket") != 0)
+                                break;
+                            SessionTicket = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum UserOrigination
@@ -820,34 +1350,29 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<UserOrigination>(obj.GetInt());
 
-            static std::map<const char *, UserOrigination, PlayFabComboSdk::StringCompare> _UserOriginationMap;
-            if (_UserOriginationMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _UserOriginationMap["Organic"] = UserOriginationOrganic;
-                _UserOriginationMap["Steam"] = UserOriginationSteam;
-                _UserOriginationMap["Google"] = UserOriginationGoogle;
-                _UserOriginationMap["Amazon"] = UserOriginationAmazon;
-                _UserOriginationMap["Facebook"] = UserOriginationFacebook;
-                _UserOriginationMap["Kongregate"] = UserOriginationKongregate;
-                _UserOriginationMap["GamersFirst"] = UserOriginationGamersFirst;
-                _UserOriginationMap["Unknown"] = UserOriginationUnknown;
-                _UserOriginationMap["IOS"] = UserOriginationIOS;
-                _UserOriginationMap["LoadTest"] = UserOriginationLoadTest;
-                _UserOriginationMap["Android"] = UserOriginationAndroid;
-                _UserOriginationMap["PSN"] = UserOriginationPSN;
-                _UserOriginationMap["GameCenter"] = UserOriginationGameCenter;
-                _UserOriginationMap["CustomId"] = UserOriginationCustomId;
-                _UserOriginationMap["XboxLive"] = UserOriginationXboxLive;
-                _UserOriginationMap["Parse"] = UserOriginationParse;
-                _UserOriginationMap["Twitch"] = UserOriginationTwitch;
-                _UserOriginationMap["WindowsHello"] = UserOriginationWindowsHello;
-
-            }
-
-            auto output = _UserOriginationMap.find(obj.GetString());
-            if (output != _UserOriginationMap.end())
-                return output->second;
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("Organic"): if (strcmp(name, "Organic") == 0) return UserOriginationOrganic; break;
+            case PlayFabJsonReader::Hash("Steam"): if (strcmp(name, "Steam") == 0) return UserOriginationSteam; break;
+            case PlayFabJsonReader::Hash("Google"): if (strcmp(name, "Google") == 0) return UserOriginationGoogle; break;
+            case PlayFabJsonReader::Hash("Amazon"): if (strcmp(name, "Amazon") == 0) return UserOriginationAmazon; break;
+            case PlayFabJsonReader::Hash("Facebook"): if (strcmp(name, "Facebook") == 0) return UserOriginationFacebook; break;
+            case PlayFabJsonReader::Hash("Kongregate"): if (strcmp(name, "Kongregate") == 0) return UserOriginationKongregate; break;
+            case PlayFabJsonReader::Hash("GamersFirst"): if (strcmp(name, "GamersFirst") == 0) return UserOriginationGamersFirst; break;
+            case PlayFabJsonReader::Hash("Unknown"): if (strcmp(name, "Unknown") == 0) return UserOriginationUnknown; break;
+            case PlayFabJsonReader::Hash("IOS"): if (strcmp(name, "IOS") == 0) return UserOriginationIOS; break;
+            case PlayFabJsonReader::Hash("LoadTest"): if (strcmp(name, "LoadTest") == 0) return UserOriginationLoadTest; break;
+            case PlayFabJsonReader::Hash("Android"): if (strcmp(name, "Android") == 0) return UserOriginationAndroid; break;
+            case PlayFabJsonReader::Hash("PSN"): if (strcmp(name, "PSN") == 0) return UserOriginationPSN; break;
+            case PlayFabJsonReader::Hash("GameCenter"): if (strcmp(name, "GameCenter") == 0) return UserOriginationGameCenter; break;
+            case PlayFabJsonReader::Hash("CustomId"): if (strcmp(name, "CustomId") == 0) return UserOriginationCustomId; break;
+            case PlayFabJsonReader::Hash("XboxLive"): if (strcmp(name, "XboxLive") == 0) return UserOriginationXboxLive; break;
+            case PlayFabJsonReader::Hash("Parse"): if (strcmp(name, "Parse") == 0) return UserOriginationParse; break;
+            case PlayFabJsonReader::Hash("Twitch"): if (strcmp(name, "Twitch") == 0) return UserOriginationTwitch; break;
+            case PlayFabJsonReader::Hash("WindowsHello"): if (strcmp(name, "WindowsHello") == 0) return UserOriginationWindowsHello; break;
+            }
 
             return UserOriginationOrganic; // Basically critical fail
         }
@@ -884,6 +1409,20 @@ namespace PlayFabComboSdk
                 AvatarUrl(src.AvatarUrl)
             {}
 
+            UserTitleInfo(UserTitleInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                DisplayName(AZStd::move(src.DisplayName)),
+                Origination(AZStd::move(src.Origination)),
+                Created(AZStd::move(src.Created)),
+                LastLogin(AZStd::move(src.LastLogin)),
+                FirstLogin(AZStd::move(src.FirstLogin)),
+                isBanned(AZStd::move(src.isBanned)),
+                AvatarUrl(AZStd::move(src.AvatarUrl))
+            {}
+
+            UserTitleInfo& operator=(const UserTitleInfo& src) = default;
+            UserTitleInfo& operator=(UserTitleInfo&& src) = default;
+
             UserTitleInfo(const rapidjson::Value& obj) : UserTitleInfo()
             {
                 readFromValue(obj);
@@ -944,6 +1483,59 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Origination"):
+                            if (strcmp(member, "Origination") != 0)
+                                break;
+                            Origination = readUserOriginationFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("LastLogin"):
+                            if (strcmp(member, "LastLogin") != 0)
+                                break;
+                            LastLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("FirstLogin"):
+                            if (strcmp(member, "FirstLogin") != 0)
+                                break;
+                            FirstLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("isBanned"):
+                            if (strcmp(member, "isBanned") != 0)
+                                break;
+                            isBanned = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("AvatarUrl"):
+                            if (strcmp(member, "AvatarUrl") != 0)
+                                break;
+                            AvatarUrl = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserPrivateAccountInfo : public PlayFabBaseModel
@@ -960,6 +1552,14 @@ namespace PlayFabComboSdk
                 Email(src.Email)
             {}
 
+            UserPrivateAccountInfo(UserPrivateAccountInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                Email(AZStd::move(src.Email))
+            {}
+
+            UserPrivateAccountInfo& operator=(const UserPrivateAccountInfo& src) = default;
+            UserPrivateAccountInfo& operator=(UserPrivateAccountInfo&& src) = default;
+
             UserPrivateAccountInfo(const rapidjson::Value& obj) : UserPrivateAccountInfo()
             {
                 readFromValue(obj);
@@ -986,6 +1586,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserFacebookInfo : public PlayFabBaseModel
@@ -1005,6 +1628,15 @@ namespace PlayFabComboSdk
                 FullName(src.FullName)
             {}
 
+            UserFacebookInfo(UserFacebookInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                FacebookId(AZStd::move(src.FacebookId)),
+                FullName(AZStd::move(src.FullName))
+            {}
+
+            UserFacebookInfo& operator=(const UserFacebookInfo& src) = default;
+            UserFacebookInfo& operator=(UserFacebookInfo&& src) = default;
+
             UserFacebookInfo(const rapidjson::Value& obj) : UserFacebookInfo()
             {
                 readFromValue(obj);
@@ -1037,6 +1669,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FacebookId"):
+                            if (strcmp(member, "FacebookId") != 0)
+                                break;
+                            FacebookId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FullName"):
+                            if (strcmp(member, "FullName") != 0)
+                                break;
+                            FullName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum Currency
@@ -1381,178 +2041,173 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<Currency>(obj.GetInt());
 
-            static std::map<const char *, Currency, PlayFabComboSdk::StringCompare> _CurrencyMap;
-            if (_CurrencyMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _CurrencyMap["AED"] = CurrencyAED;
-                _CurrencyMap["AFN"] = CurrencyAFN;
-                _CurrencyMap["ALL"] = CurrencyALL;
-                _CurrencyMap["AMD"] = CurrencyAMD;
-                _CurrencyMap["ANG"] = CurrencyANG;
-                _CurrencyMap["AOA"] = CurrencyAOA;
-                _CurrencyMap["ARS"] = CurrencyARS;
-                _CurrencyMap["AUD"] = CurrencyAUD;
-                _CurrencyMap["AWG"] = CurrencyAWG;
-                _CurrencyMap["AZN"] = CurrencyAZN;
-                _CurrencyMap["BAM"] = CurrencyBAM;
-                _CurrencyMap["BBD"] = CurrencyBBD;
-                _CurrencyMap["BDT"] = CurrencyBDT;
-                _CurrencyMap["BGN"] = CurrencyBGN;
-                _CurrencyMap["BHD"] = CurrencyBHD;
-                _CurrencyMap["BIF"] = CurrencyBIF;
-                _CurrencyMap["BMD"] = CurrencyBMD;
-                _CurrencyMap["BND"] = CurrencyBND;
-                _CurrencyMap["BOB"] = CurrencyBOB;
-                _CurrencyMap["BRL"] = CurrencyBRL;
-                _CurrencyMap["BSD"] = CurrencyBSD;
-                _CurrencyMap["BTN"] = CurrencyBTN;
-                _CurrencyMap["BWP"] = CurrencyBWP;
-                _CurrencyMap["BYR"] = CurrencyBYR;
-                _CurrencyMap["BZD"] = CurrencyBZD;
-                _CurrencyMap["CAD"] = CurrencyCAD;
-                _CurrencyMap["CDF"] = CurrencyCDF;
-                _CurrencyMap["CHF"] = CurrencyCHF;
-                _CurrencyMap["CLP"] = CurrencyCLP;
-                _CurrencyMap["CNY"] = CurrencyCNY;
-                _CurrencyMap["COP"] = CurrencyCOP;
-                _CurrencyMap["CRC"] = CurrencyCRC;
-                _CurrencyMap["CUC"] = CurrencyCUC;
-                _CurrencyMap["CUP"] = CurrencyCUP;
-                _CurrencyMap["CVE"] = CurrencyCVE;
-                _CurrencyMap["CZK"] = CurrencyCZK;
-                _CurrencyMap["DJF"] = CurrencyDJF;
-                _CurrencyMap["DKK"] = CurrencyDKK;
-                _CurrencyMap["DOP"] = CurrencyDOP;
-                _CurrencyMap["DZD"] = CurrencyDZD;
-                _CurrencyMap["EGP"] = CurrencyEGP;
-                _CurrencyMap["ERN"] = CurrencyERN;
-                _CurrencyMap["ETB"] = CurrencyETB;
-                _CurrencyMap["EUR"] = CurrencyEUR;
-                _CurrencyMap["FJD"] = CurrencyFJD;
-                _CurrencyMap["FKP"] = CurrencyFKP;
-                _CurrencyMap["GBP"] = CurrencyGBP;
-                _CurrencyMap["GEL"] = CurrencyGEL;
-                _CurrencyMap["GGP"] = CurrencyGGP;
-                _CurrencyMap["GHS"] = CurrencyGHS;
-                _CurrencyMap["GIP"] = CurrencyGIP;
-                _CurrencyMap["GMD"] = CurrencyGMD;
-                _CurrencyMap["GNF"] = CurrencyGNF;
-                _CurrencyMap["GTQ"] = CurrencyGTQ;
-                _CurrencyMap["GYD"] = CurrencyGYD;
-                _CurrencyMap["HKD"] = CurrencyHKD;
-                _CurrencyMap["HNL"] = CurrencyHNL;
-                _CurrencyMap["HRK"] = CurrencyHRK;
-                _CurrencyMap["HTG"] = CurrencyHTG;
-                _CurrencyMap["HUF"] = CurrencyHUF;
-                _CurrencyMap["IDR"] = CurrencyIDR;
-                _CurrencyMap["ILS"] = CurrencyILS;
-                _CurrencyMap["IMP"] = CurrencyIMP;
-                _CurrencyMap["INR"] = CurrencyINR;
-                _CurrencyMap["IQD"] = CurrencyIQD;
-                _CurrencyMap["IRR"] = CurrencyIRR;
-                _CurrencyMap["ISK"] = CurrencyISK;
-                _CurrencyMap["JEP"] = CurrencyJEP;
-                _CurrencyMap["JMD"] = CurrencyJMD;
-                _CurrencyMap["JOD"] = CurrencyJOD;
-                _CurrencyMap["JPY"] = CurrencyJPY;
-                _CurrencyMap["KES"] = CurrencyKES;
-                _CurrencyMap["KGS"] = CurrencyKGS;
-                _CurrencyMap["KHR"] = CurrencyKHR;
-                _CurrencyMap["KMF"] = CurrencyKMF;
-                _CurrencyMap["KPW"] = CurrencyKPW;
-                _CurrencyMap["KRW"] = CurrencyKRW;
-                _CurrencyMap["KWD"] = CurrencyKWD;
-                _CurrencyMap["KYD"] = CurrencyKYD;
-                _CurrencyMap["KZT"] = CurrencyKZT;
-                _CurrencyMap["LAK"] = CurrencyLAK;
-                _CurrencyMap["LBP"] = CurrencyLBP;
-                _CurrencyMap["LKR"] = CurrencyLKR;
-                _CurrencyMap["LRD"] = CurrencyLRD;
-                _CurrencyMap["LSL"] = CurrencyLSL;
-                _CurrencyMap["LYD"] = CurrencyLYD;
-                _CurrencyMap["MAD"] = CurrencyMAD;
-                _CurrencyMap["MDL"] = CurrencyMDL;
-                _CurrencyMap["MGA"] = CurrencyMGA;
-                _CurrencyMap["MKD"] = CurrencyMKD;
-                _CurrencyMap["MMK"] = CurrencyMMK;
-                _CurrencyMap["MNT"] = CurrencyMNT;
-                _CurrencyMap["MOP"] = CurrencyMOP;
-                _CurrencyMap["MRO"] = CurrencyMRO;
-                _CurrencyMap["MUR"] = CurrencyMUR;
-                _CurrencyMap["MVR"] = CurrencyMVR;
-                _CurrencyMap["MWK"] = CurrencyMWK;
-                _CurrencyMap["MXN"] = CurrencyMXN;
-                _CurrencyMap["MYR"] = CurrencyMYR;
-                _CurrencyMap["MZN"] = CurrencyMZN;
-                _CurrencyMap["NAD"] = CurrencyNAD;
-                _CurrencyMap["NGN"] = CurrencyNGN;
-                _CurrencyMap["NIO"] = CurrencyNIO;
-                _CurrencyMap["NOK"] = CurrencyNOK;
-                _CurrencyMap["NPR"] = CurrencyNPR;
-                _CurrencyMap["NZD"] = CurrencyNZD;
-                _CurrencyMap["OMR"] = CurrencyOMR;
-                _CurrencyMap["PAB"] = CurrencyPAB;
-                _CurrencyMap["PEN"] = CurrencyPEN;
-                _CurrencyMap["PGK"] = CurrencyPGK;
-                _CurrencyMap["PHP"] = CurrencyPHP;
-                _CurrencyMap["PKR"] = CurrencyPKR;
-                _CurrencyMap["PLN"] = CurrencyPLN;
-                _CurrencyMap["PYG"] = CurrencyPYG;
-                _CurrencyMap["QAR"] = CurrencyQAR;
-                _CurrencyMap["RON"] = CurrencyRON;
-                _CurrencyMap["RSD"] = CurrencyRSD;
-                _CurrencyMap["RUB"] = CurrencyRUB;
-                _CurrencyMap["RWF"] = CurrencyRWF;
-                _CurrencyMap["SAR"] = CurrencySAR;
-                _CurrencyMap["SBD"] = CurrencySBD;
-                _CurrencyMap["SCR"] = CurrencySCR;
-                _CurrencyMap["SDG"] = CurrencySDG;
-                _CurrencyMap["SEK"] = CurrencySEK;
-                _CurrencyMap["SGD"] = CurrencySGD;
-                _CurrencyMap["SHP"] = CurrencySHP;
-                _CurrencyMap["SLL"] = CurrencySLL;
-                _CurrencyMap["SOS"] = CurrencySOS;
-                _CurrencyMap["SPL"] = CurrencySPL;
-                _CurrencyMap["SRD"] = CurrencySRD;
-                _CurrencyMap["STD"] = CurrencySTD;
-                _CurrencyMap["SVC"] = CurrencySVC;
-                _CurrencyMap["SYP"] = CurrencySYP;
-                _CurrencyMap["SZL"] = CurrencySZL;
-                _CurrencyMap["THB"] = CurrencyTHB;
-                _CurrencyMap["TJS"] = CurrencyTJS;
-                _CurrencyMap["TMT"] = CurrencyTMT;
-                _CurrencyMap["TND"] = CurrencyTND;
-                _CurrencyMap["TOP"] = CurrencyTOP;
-                _CurrencyMap["TRY"] = CurrencyTRY;
-                _CurrencyMap["TTD"] = CurrencyTTD;
-                _CurrencyMap["TVD"] = CurrencyTVD;
-                _CurrencyMap["TWD"] = CurrencyTWD;
-                _CurrencyMap["TZS"] = CurrencyTZS;
-                _CurrencyMap["UAH"] = CurrencyUAH;
-                _CurrencyMap["UGX"] = CurrencyUGX;
-                _CurrencyMap["USD"] = CurrencyUSD;
-                _CurrencyMap["UYU"] = CurrencyUYU;
-                _CurrencyMap["UZS"] = CurrencyUZS;
-                _CurrencyMap["VEF"] = CurrencyVEF;
-                _CurrencyMap["VND"] = CurrencyVND;
-                _CurrencyMap["VUV"] = CurrencyVUV;
-                _CurrencyMap["WST"] = CurrencyWST;
-                _CurrencyMap["XAF"] = CurrencyXAF;
-                _CurrencyMap["XCD"] = CurrencyXCD;
-                _CurrencyMap["XDR"] = CurrencyXDR;
-                _CurrencyMap["XOF"] = CurrencyXOF;
-                _CurrencyMap["XPF"] = CurrencyXPF;
-                _CurrencyMap["YER"] = CurrencyYER;
-                _CurrencyMap["ZAR"] = CurrencyZAR;
-                _CurrencyMap["ZMW"] = CurrencyZMW;
-                _CurrencyMap["ZWD"] = CurrencyZWD;
-
-            }
-
-            auto output = _CurrencyMap.find(obj.GetString());
-            if (output != _CurrencyMap.end())
-                return output->second;
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("AED"): if (strcmp(name, "AED") == 0) return CurrencyAED; break;
+            case PlayFabJsonReader::Hash("AFN"): if (strcmp(name, "AFN") == 0) return CurrencyAFN; break;
+            case PlayFabJsonReader::Hash("ALL"): if (strcmp(name, "ALL") == 0) return CurrencyALL; break;
+            case PlayFabJsonReader::Hash("AMD"): if (strcmp(name, "AMD") == 0) return CurrencyAMD; break;
+            case PlayFabJsonReader::Hash("ANG"): if (strcmp(name, "ANG") == 0) return CurrencyANG; break;
+            case PlayFabJsonReader::Hash("AOA"): if (strcmp(name, "AOA") == 0) return CurrencyAOA; break;
+            case PlayFabJsonReader::Hash("ARS"): if (strcmp(name, "ARS") == 0) return CurrencyARS; break;
+            case PlayFabJsonReader::Hash("AUD"): if (strcmp(name, "AUD") == 0) return CurrencyAUD; break;
+            case PlayFabJsonReader::Hash("AWG"): if (strcmp(name, "AWG") == 0) return CurrencyAWG; break;
+            case PlayFabJsonReader::Hash("AZN"): if (strcmp(name, "AZN") == 0) return CurrencyAZN; break;
+            case PlayFabJsonReader::Hash("BAM"): if (strcmp(name, "BAM") == 0) return CurrencyBAM; break;
+            case PlayFabJsonReader::Hash("BBD"): if (strcmp(name, "BBD") == 0) return CurrencyBBD; break;
+            case PlayFabJsonReader::Hash("BDT"): if (strcmp(name, "BDT") == 0) return CurrencyBDT; break;
+            case PlayFabJsonReader::Hash("BGN"): if (strcmp(name, "BGN") == 0) return CurrencyBGN; break;
+            case PlayFabJsonReader::Hash("BHD"): if (strcmp(name, "BHD") == 0) return CurrencyBHD; break;
+            case PlayFabJsonReader::Hash("BIF"): if (strcmp(name, "BIF") == 0) return CurrencyBIF; break;
+            case PlayFabJsonReader::Hash("BMD"): if (strcmp(name, "BMD") == 0) return CurrencyBMD; break;
+            case PlayFabJsonReader::Hash("BND"): if (strcmp(name, "BND") == 0) return CurrencyBND; break;
+            case PlayFabJsonReader::Hash("BOB"): if (strcmp(name, "BOB") == 0) return CurrencyBOB; break;
+            case PlayFabJsonReader::Hash("BRL"): if (strcmp(name, "BRL") == 0) return CurrencyBRL; break;
+            case PlayFabJsonReader::Hash("BSD"): if (strcmp(name, "BSD") == 0) return CurrencyBSD; break;
+            case PlayFabJsonReader::Hash("BTN"): if (strcmp(name, "BTN") == 0) return CurrencyBTN; break;
+            case PlayFabJsonReader::Hash("BWP"): if (strcmp(name, "BWP") == 0) return CurrencyBWP; break;
+            case PlayFabJsonReader::Hash("BYR"): if (strcmp(name, "BYR") == 0) return CurrencyBYR; break;
+            case PlayFabJsonReader::Hash("BZD"): if (strcmp(name, "BZD") == 0) return CurrencyBZD; break;
+            case PlayFabJsonReader::Hash("CAD"): if (strcmp(name, "CAD") == 0) return CurrencyCAD; break;
+            case PlayFabJsonReader::Hash("CDF"): if (strcmp(name, "CDF") == 0) return CurrencyCDF; break;
+            case PlayFabJsonReader::Hash("CHF"): if (strcmp(name, "CHF") == 0) return CurrencyCHF; break;
+            case PlayFabJsonReader::Hash("CLP"): if (strcmp(name, "CLP") == 0) return CurrencyCLP; break;
+            case PlayFabJsonReader::Hash("CNY"): if (strcmp(name, "CNY") == 0) return CurrencyCNY; break;
+            case PlayFabJsonReader::Hash("COP"): if (strcmp(name, "COP") == 0) return CurrencyCOP; break;
+            case PlayFabJsonReader::Hash("CRC"): if (strcmp(name, "CRC") == 0) return CurrencyCRC; break;
+            case PlayFabJsonReader::Hash("CUC"): if (strcmp(name, "CUC") == 0) return CurrencyCUC; break;
+            case PlayFabJsonReader::Hash("CUP"): if (strcmp(name, "CUP") == 0) return CurrencyCUP; break;
+            case PlayFabJsonReader::Hash("CVE"): if (strcmp(name, "CVE") == 0) return CurrencyCVE; break;
+            case PlayFabJsonReader::Hash("CZK"): if (strcmp(name, "CZK") == 0) return CurrencyCZK; break;
+            case PlayFabJsonReader::Hash("DJF"): if (strcmp(name, "DJF") == 0) return CurrencyDJF; break;
+            case PlayFabJsonReader::Hash("DKK"): if (strcmp(name, "DKK") == 0) return CurrencyDKK; break;
+            case PlayFabJsonReader::Hash("DOP"): if (strcmp(name, "DOP") == 0) return CurrencyDOP; break;
+            case PlayFabJsonReader::Hash("DZD"): if (strcmp(name, "DZD") == 0) return CurrencyDZD; break;
+            case PlayFabJsonReader::Hash("EGP"): if (strcmp(name, "EGP") == 0) return CurrencyEGP; break;
+            case PlayFabJsonReader::Hash("ERN"): if (strcmp(name, "ERN") == 0) return CurrencyERN; break;
+            case PlayFabJsonReader::Hash("ETB"): if (strcmp(name, "ETB") == 0) return CurrencyETB; break;
+            case PlayFabJsonReader::Hash("EUR"): if (strcmp(name, "EUR") == 0) return CurrencyEUR; break;
+            case PlayFabJsonReader::Hash("FJD"): if (strcmp(name, "FJD") == 0) return CurrencyFJD; break;
+            case PlayFabJsonReader::Hash("FKP"): if (strcmp(name, "FKP") == 0) return CurrencyFKP; break;
+            case PlayFabJsonReader::Hash("GBP"): if (strcmp(name, "GBP") == 0) return CurrencyGBP; break;
+            case PlayFabJsonReader::Hash("GEL"): if (strcmp(name, "GEL") == 0) return CurrencyGEL; break;
+            case PlayFabJsonReader::Hash("GGP"): if (strcmp(name, "GGP") == 0) return CurrencyGGP; break;
+            case PlayFabJsonReader::Hash("GHS"): if (strcmp(name, "GHS") == 0) return CurrencyGHS; break;
+            case PlayFabJsonReader::Hash("GIP"): if (strcmp(name, "GIP") == 0) return CurrencyGIP; break;
+            case PlayFabJsonReader::Hash("GMD"): if (strcmp(name, "GMD") == 0) return CurrencyGMD; break;
+            case PlayFabJsonReader::Hash("GNF"): if (strcmp(name, "GNF") == 0) return CurrencyGNF; break;
+            case PlayFabJsonReader::Hash("GTQ"): if (strcmp(name, "GTQ") == 0) return CurrencyGTQ; break;
+            case PlayFabJsonReader::Hash("GYD"): if (strcmp(name, "GYD") == 0) return CurrencyGYD; break;
+            case PlayFabJsonReader::Hash("HKD"): if (strcmp(name, "HKD") == 0) return CurrencyHKD; break;
+            case PlayFabJsonReader::Hash("HNL"): if (strcmp(name, "HNL") == 0) return CurrencyHNL; break;
+            case PlayFabJsonReader::Hash("HRK"): if (strcmp(name, "HRK") == 0) return CurrencyHRK; break;
+            case PlayFabJsonReader::Hash("HTG"): if (strcmp(name, "HTG") == 0) return CurrencyHTG; break;
+            case PlayFabJsonReader::Hash("HUF"): if (strcmp(name, "HUF") == 0) return CurrencyHUF; break;
+            case PlayFabJsonReader::Hash("IDR"): if (strcmp(name, "IDR") == 0) return CurrencyIDR; break;
+            case PlayFabJsonReader::Hash("ILS"): if (strcmp(name, "ILS") == 0) return CurrencyILS; break;
+            case PlayFabJsonReader::Hash("IMP"): if (strcmp(name, "IMP") == 0) return CurrencyIMP; break;
+            case PlayFabJsonReader::Hash("INR"): if (strcmp(name, "INR") == 0) return CurrencyINR; break;
+            case PlayFabJsonReader::Hash("IQD"): if (strcmp(name, "IQD") == 0) return CurrencyIQD; break;
+            case PlayFabJsonReader::Hash("IRR"): if (strcmp(name, "IRR") == 0) return CurrencyIRR; break;
+            case PlayFabJsonReader::Hash("ISK"): if (strcmp(name, "ISK") == 0) return CurrencyISK; break;
+            case PlayFabJsonReader::Hash("JEP"): if (strcmp(name, "JEP") == 0) return CurrencyJEP; break;
+            case PlayFabJsonReader::Hash("JMD"): if (strcmp(name, "JMD") == 0) return CurrencyJMD; break;
+            case PlayFabJsonReader::Hash("JOD"): if (strcmp(name, "JOD") == 0) return CurrencyJOD; break;
+            case PlayFabJsonReader::Hash("JPY"): if (strcmp(name, "JPY") == 0) return CurrencyJPY; break;
+            case PlayFabJsonReader::Hash("KES"): if (strcmp(name, "KES") == 0) return CurrencyKES; break;
+            case PlayFabJsonReader::Hash("KGS"): if (strcmp(name, "KGS") == 0) return CurrencyKGS; break;
+            case PlayFabJsonReader::Hash("KHR"): if (strcmp(name, "KHR") == 0) return CurrencyKHR; break;
+            case PlayFabJsonReader::Hash("KMF"): if (strcmp(name, "KMF") == 0) return CurrencyKMF; break;
+            case PlayFabJsonReader::Hash("KPW"): if (strcmp(name, "KPW") == 0) return CurrencyKPW; break;
+            case PlayFabJsonReader::Hash("KRW"): if (strcmp(name, "KRW") == 0) return CurrencyKRW; break;
+            case PlayFabJsonReader::Hash("KWD"): if (strcmp(name, "KWD") == 0) return CurrencyKWD; break;
+            case PlayFabJsonReader::Hash("KYD"): if (strcmp(name, "KYD") == 0) return CurrencyKYD; break;
+            case PlayFabJsonReader::Hash("KZT"): if (strcmp(name, "KZT") == 0) return CurrencyKZT; break;
+            case PlayFabJsonReader::Hash("LAK"): if (strcmp(name, "LAK") == 0) return CurrencyLAK; break;
+            case PlayFabJsonReader::Hash("LBP"): if (strcmp(name, "LBP") == 0) return CurrencyLBP; break;
+            case PlayFabJsonReader::Hash("LKR"): if (strcmp(name, "LKR") == 0) return CurrencyLKR; break;
+            case PlayFabJsonReader::Hash("LRD"): if (strcmp(name, "LRD") == 0) return CurrencyLRD; break;
+            case PlayFabJsonReader::Hash("LSL"): if (strcmp(name, "LSL") == 0) return CurrencyLSL; break;
+            case PlayFabJsonReader::Hash("LYD"): if (strcmp(name, "LYD") == 0) return CurrencyLYD; break;
+            case PlayFabJsonReader::Hash("MAD"): if (strcmp(name, "MAD") == 0) return CurrencyMAD; break;
+            case PlayFabJsonReader::Hash("MDL"): if (strcmp(name, "MDL") == 0) return CurrencyMDL; break;
+            case PlayFabJsonReader::Hash("MGA"): if (strcmp(name, "MGA") == 0) return CurrencyMGA; break;
+            case PlayFabJsonReader::Hash("MKD"): if (strcmp(name, "MKD") == 0) return CurrencyMKD; break;
+            case PlayFabJsonReader::Hash("MMK"): if (strcmp(name, "MMK") == 0) return CurrencyMMK; break;
+            case PlayFabJsonReader::Hash("MNT"): if (strcmp(name, "MNT") == 0) return CurrencyMNT; break;
+            case PlayFabJsonReader::Hash("MOP"): if (strcmp(name, "MOP") == 0) return CurrencyMOP; break;
+            case PlayFabJsonReader::Hash("MRO"): if (strcmp(name, "MRO") == 0) return CurrencyMRO; break;
+            case PlayFabJsonReader::Hash("MUR"): if (strcmp(name, "MUR") == 0) return CurrencyMUR; break;
+            case PlayFabJsonReader::Hash("MVR"): if (strcmp(name, "MVR") == 0) return CurrencyMVR; break;
+            case PlayFabJsonReader::Hash("MWK"): if (strcmp(name, "MWK") == 0) return CurrencyMWK; break;
+            case PlayFabJsonReader::Hash("MXN"): if (strcmp(name, "MXN") == 0) return CurrencyMXN; break;
+            case PlayFabJsonReader::Hash("MYR"): if (strcmp(name, "MYR") == 0) return CurrencyMYR; break;
+            case PlayFabJsonReader::Hash("MZN"): if (strcmp(name, "MZN") == 0) return CurrencyMZN; break;
+            case PlayFabJsonReader::Hash("NAD"): if (strcmp(name, "NAD") == 0) return CurrencyNAD; break;
+            case PlayFabJsonReader::Hash("NGN"): if (strcmp(name, "NGN") == 0) return CurrencyNGN; break;
+            case PlayFabJsonReader::Hash("NIO"): if (strcmp(name, "NIO") == 0) return CurrencyNIO; break;
+            case PlayFabJsonReader::Hash("NOK"): if (strcmp(name, "NOK") == 0) return CurrencyNOK; break;
+            case PlayFabJsonReader::Hash("NPR"): if (strcmp(name, "NPR") == 0) return CurrencyNPR; break;
+            case PlayFabJsonReader::Hash("NZD"): if (strcmp(name, "NZD") == 0) return CurrencyNZD; break;
+            case PlayFabJsonReader::Hash("OMR"): if (strcmp(name, "OMR") == 0) return CurrencyOMR; break;
+            case PlayFabJsonReader::Hash("PAB"): if (strcmp(name, "PAB") == 0) return CurrencyPAB; break;
+            case PlayFabJsonReader::Hash("PEN"): if (strcmp(name, "PEN") == 0) return CurrencyPEN; break;
+            case PlayFabJsonReader::Hash("PGK"): if (strcmp(name, "PGK") == 0) return CurrencyPGK; break;
+            case PlayFabJsonReader::Hash("PHP"): if (strcmp(name, "PHP") == 0) return CurrencyPHP; break;
+            case PlayFabJsonReader::Hash("PKR"): if (strcmp(name, "PKR") == 0) return CurrencyPKR; break;
+            case PlayFabJsonReader::Hash("PLN"): if (strcmp(name, "PLN") == 0) return CurrencyPLN; break;
+            case PlayFabJsonReader::Hash("PYG"): if (strcmp(name, "PYG") == 0) return CurrencyPYG; break;
+            case PlayFabJsonReader::Hash("QAR"): if (strcmp(name, "QAR") == 0) return CurrencyQAR; break;
+            case PlayFabJsonReader::Hash("RON"): if (strcmp(name, "RON") == 0) return CurrencyRON; break;
+            case PlayFabJsonReader::Hash("RSD"): if (strcmp(name, "RSD") == 0) return CurrencyRSD; break;
+            case PlayFabJsonReader::Hash("RUB"): if (strcmp(name, "RUB") == 0) return CurrencyRUB; break;
+            case PlayFabJsonReader::Hash("RWF"): if (strcmp(name, "RWF") == 0) return CurrencyRWF; break;
+            case PlayFabJsonReader::Hash("SAR"): if (strcmp(name, "SAR") == 0) return CurrencySAR; break;
+            case PlayFabJsonReader::Hash("SBD"): if (strcmp(name, "SBD") == 0) return CurrencySBD; break;
+            case PlayFabJsonReader::Hash("SCR"): if (strcmp(name, "SCR") == 0) return CurrencySCR; break;
+            case PlayFabJsonReader::Hash("SDG"): if (strcmp(name, "SDG") == 0) return CurrencySDG; break;
+            case PlayFabJsonReader::Hash("SEK"): if (strcmp(name, "SEK") == 0) return CurrencySEK; break;
+            case PlayFabJsonReader::Hash("SGD"): if (strcmp(name, "SGD") == 0) return CurrencySGD; break;
+            case PlayFabJsonReader::Hash("SHP"): if (strcmp(name, "SHP") == 0) return CurrencySHP; break;
+            case PlayFabJsonReader::Hash("SLL"): if (strcmp(name, "SLL") == 0) return CurrencySLL; break;
+            case PlayFabJsonReader::Hash("SOS"): if (strcmp(name, "SOS") == 0) return CurrencySOS; break;
+            case PlayFabJsonReader::Hash("SPL"): if (strcmp(name, "SPL") == 0) return CurrencySPL; break;
+            case PlayFabJsonReader::Hash("SRD"): if (strcmp(name, "SRD") == 0) return CurrencySRD; break;
+            case PlayFabJsonReader::Hash("STD"): if (strcmp(name, "STD") == 0) return CurrencySTD; break;
+            case PlayFabJsonReader::Hash("SVC"): if (strcmp(name, "SVC") == 0) return CurrencySVC; break;
+            case PlayFabJsonReader::Hash("SYP"): if (strcmp(name, "SYP") == 0) return CurrencySYP; break;
+            case PlayFabJsonReader::Hash("SZL"): if (strcmp(name, "SZL") == 0) return CurrencySZL; break;
+            case PlayFabJsonReader::Hash("THB"): if (strcmp(name, "THB") == 0) return CurrencyTHB; break;
+            case PlayFabJsonReader::Hash("TJS"): if (strcmp(name, "TJS") == 0) return CurrencyTJS; break;
+            case PlayFabJsonReader::Hash("TMT"): if (strcmp(name, "TMT") == 0) return CurrencyTMT; break;
+            case PlayFabJsonReader::Hash("TND"): if (strcmp(name, "TND") == 0) return CurrencyTND; break;
+            case PlayFabJsonReader::Hash("TOP"): if (strcmp(name, "TOP") == 0) return CurrencyTOP; break;
+            case PlayFabJsonReader::Hash("TRY"): if (strcmp(name, "TRY") == 0) return CurrencyTRY; break;
+            case PlayFabJsonReader::Hash("TTD"): if (strcmp(name, "TTD") == 0) return CurrencyTTD; break;
+            case PlayFabJsonReader::Hash("TVD"): if (strcmp(name, "TVD") == 0) return CurrencyTVD; break;
+            case PlayFabJsonReader::Hash("TWD"): if (strcmp(name, "TWD") == 0) return CurrencyTWD; break;
+            case PlayFabJsonReader::Hash("TZS"): if (strcmp(name, "TZS") == 0) return CurrencyTZS; break;
+            case PlayFabJsonReader::Hash("UAH"): if (strcmp(name, "UAH") == 0) return CurrencyUAH; break;
+            case PlayFabJsonReader::Hash("UGX"): if (strcmp(name, "UGX") == 0) return CurrencyUGX; break;
+            case PlayFabJsonReader::Hash("USD"): if (strcmp(name, "USD") == 0) return CurrencyUSD; break;
+            case PlayFabJsonReader::Hash("UYU"): if (strcmp(name, "UYU") == 0) return CurrencyUYU; break;
+            case PlayFabJsonReader::Hash("UZS"): if (strcmp(name, "UZS") == 0) return CurrencyUZS; break;
+            case PlayFabJsonReader::Hash("VEF"): if (strcmp(name, "VEF") == 0) return CurrencyVEF; break;
+            case PlayFabJsonReader::Hash("VND"): if (strcmp(name, "VND") == 0) return CurrencyVND; break;
+            case PlayFabJsonReader::Hash("VUV"): if (strcmp(name, "VUV") == 0) return CurrencyVUV; break;
+            case PlayFabJsonReader::Hash("WST"): if (strcmp(name, "WST") == 0) return CurrencyWST; break;
+            case PlayFabJsonReader::Hash("XAF"): if (strcmp(name, "XAF") == 0) return CurrencyXAF; break;
+            case PlayFabJsonReader::Hash("XCD"): if (strcmp(name, "XCD") == 0) return CurrencyXCD; break;
+            case PlayFabJsonReader::Hash("XDR"): if (strcmp(name, "XDR") == 0) return CurrencyXDR; break;
+            case PlayFabJsonReader::Hash("XOF"): if (strcmp(name, "XOF") == 0) return CurrencyXOF; break;
+            case PlayFabJsonReader::Hash("XPF"): if (strcmp(name, "XPF") == 0) return CurrencyXPF; break;
+            case PlayFabJsonReader::Hash("YER"): if (strcmp(name, "YER") == 0) return CurrencyYER; break;
+            case PlayFabJsonReader::Hash("ZAR"): if (strcmp(name, "ZAR") == 0) return CurrencyZAR; break;
+            case PlayFabJsonReader::Hash("ZMW"): if (strcmp(name, "ZMW") == 0) return CurrencyZMW; break;
+            case PlayFabJsonReader::Hash("ZWD"): if (strcmp(name, "ZWD") == 0) return CurrencyZWD; break;
+            }
 
             return CurrencyAED; // Basically critical fail
         }
@@ -1585,22 +2240,17 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<TitleActivationStatus>(obj.GetInt());
 
-            static std::map<const char *, TitleActivationStatus, PlayFabComboSdk::StringCompare> _TitleActivationStatusMap;
-            if (_TitleActivationStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _TitleActivationStatusMap["None"] = TitleActivationStatusNone;
-                _TitleActivationStatusMap["ActivatedTitleKey"] = TitleActivationStatusActivatedTitleKey;
-                _TitleActivationStatusMap["PendingSteam"] = TitleActivationStatusPendingSteam;
-                _TitleActivationStatusMap["ActivatedSteam"] = TitleActivationStatusActivatedSteam;
-                _TitleActivationStatusMap["RevokedSteam"] = TitleActivationStatusRevokedSteam;
-
+            case PlayFabJsonReader::Hash("None"): if (strcmp(name, "None") == 0) return TitleActivationStatusNone; break;
+            case PlayFabJsonReader::Hash("ActivatedTitleKey"): if (strcmp(name, "ActivatedTitleKey") == 0) return TitleActivationStatusActivatedTitleKey; break;
+            case PlayFabJsonReader::Hash("PendingSteam"): if (strcmp(name, "PendingSteam") == 0) return TitleActivationStatusPendingSteam; break;
+            case PlayFabJsonReader::Hash("ActivatedSteam"): if (strcmp(name, "ActivatedSteam") == 0) return TitleActivationStatusActivatedSteam; break;
+            case PlayFabJsonReader::Hash("RevokedSteam"): if (strcmp(name, "RevokedSteam") == 0) return TitleActivationStatusRevokedSteam; break;
             }
 
-            auto output = _TitleActivationStatusMap.find(obj.GetString());
-            if (output != _TitleActivationStatusMap.end())
-                return output->second;
-
             return TitleActivationStatusNone; // Basically critical fail
         }
 
@@ -1627,6 +2277,17 @@ namespace PlayFabComboSdk
                 SteamActivationStatus(src.SteamActivationStatus)
             {}
 
+            UserSteamInfo(UserSteamInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                SteamId(AZStd::move(src.SteamId)),
+                SteamCountry(AZStd::move(src.SteamCountry)),
+                SteamCurrency(AZStd::move(src.SteamCurrency)),
+                SteamActivationStatus(AZStd::move(src.SteamActivationStatus))
+            {}
+
+            UserSteamInfo& operator=(const UserSteamInfo& src) = default;
+            UserSteamInfo& operator=(UserSteamInfo&& src) = default;
+
             UserSteamInfo(const rapidjson::Value& obj) : UserSteamInfo()
             {
                 readFromValue(obj);
@@ -1671,6 +2332,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SteamId"):
+                            if (strcmp(member, "SteamId") != 0)
+                                break;
+                            SteamId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamCountry"):
+                            if (strcmp(member, "SteamCountry") != 0)
+                                break;
+                            SteamCountry = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamCurrency"):
+                            if (strcmp(member, "SteamCurrency") != 0)
+                                break;
+                            SteamCurrency = readCurrencyFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamActivationStatus"):
+                            if (strcmp(member, "SteamActivationStatus") != 0)
+                                break;
+                            SteamActivationStatus = readTitleActivationStatusFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserGameCenterInfo : public PlayFabBaseModel
@@ -1687,6 +2386,14 @@ namespace PlayFabComboSdk
                 GameCenterId(src.GameCenterId)
             {}
 
+            UserGameCenterInfo(UserGameCenterInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                GameCenterId(AZStd::move(src.GameCenterId))
+            {}
+
+            UserGameCenterInfo& operator=(const UserGameCenterInfo& src) = default;
+            UserGameCenterInfo& operator=(UserGameCenterInfo&& src) = default;
+
             UserGameCenterInfo(const rapidjson::Value& obj) : UserGameCenterInfo()
             {
                 readFromValue(obj);
@@ -1713,6 +2420,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GameCenterId"):
+                            if (strcmp(member, "GameCenterId") != 0)
+                                break;
+                            GameCenterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserIosDeviceInfo : public PlayFabBaseModel
@@ -1729,6 +2459,14 @@ namespace PlayFabComboSdk
                 IosDeviceId(src.IosDeviceId)
             {}
 
+            UserIosDeviceInfo(UserIosDeviceInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                IosDeviceId(AZStd::move(src.IosDeviceId))
+            {}
+
+            UserIosDeviceInfo& operator=(const UserIosDeviceInfo& src) = default;
+            UserIosDeviceInfo& operator=(UserIosDeviceInfo&& src) = default;
+
             UserIosDeviceInfo(const rapidjson::Value& obj) : UserIosDeviceInfo()
             {
                 readFromValue(obj);
@@ -1755,6 +2493,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("IosDeviceId"):
+                            if (strcmp(member, "IosDeviceId") != 0)
+                                break;
+                            IosDeviceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserAndroidDeviceInfo : public PlayFabBaseModel
@@ -1771,6 +2532,14 @@ namespace PlayFabComboSdk
                 AndroidDeviceId(src.AndroidDeviceId)
             {}
 
+            UserAndroidDeviceInfo(UserAndroidDeviceInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                AndroidDeviceId(AZStd::move(src.AndroidDeviceId))
+            {}
+
+            UserAndroidDeviceInfo& operator=(const UserAndroidDeviceInfo& src) = default;
+            UserAndroidDeviceInfo& operator=(UserAndroidDeviceInfo&& src) = default;
+
             UserAndroidDeviceInfo(const rapidjson::Value& obj) : UserAndroidDeviceInfo()
             {
                 readFromValue(obj);
@@ -1797,6 +2566,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("AndroidDeviceId"):
+                            if (strcmp(member, "AndroidDeviceId") != 0)
+                                break;
+                            AndroidDeviceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserKongregateInfo : public PlayFabBaseModel
@@ -1816,6 +2608,15 @@ namespace PlayFabComboSdk
                 KongregateName(src.KongregateName)
             {}
 
+            UserKongregateInfo(UserKongregateInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                KongregateId(AZStd::move(src.KongregateId)),
+                KongregateName(AZStd::move(src.KongregateName))
+            {}
+
+            UserKongregateInfo& operator=(const UserKongregateInfo& src) = default;
+            UserKongregateInfo& operator=(UserKongregateInfo&& src) = default;
+
             UserKongregateInfo(const rapidjson::Value& obj) : UserKongregateInfo()
             {
                 readFromValue(obj);
@@ -1848,6 +2649,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("KongregateId"):
+                            if (strcmp(member, "KongregateId") != 0)
+                                break;
+                            KongregateId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("KongregateName"):
+                            if (strcmp(member, "KongregateName") != 0)
+                                break;
+                            KongregateName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserTwitchInfo : public PlayFabBaseModel
@@ -1867,6 +2696,15 @@ namespace PlayFabComboSdk
                 TwitchUserName(src.TwitchUserName)
             {}
 
+            UserTwitchInfo(UserTwitchInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                TwitchId(AZStd::move(src.TwitchId)),
+                TwitchUserName(AZStd::move(src.TwitchUserName))
+            {}
+
+            UserTwitchInfo& operator=(const UserTwitchInfo& src) = default;
+            UserTwitchInfo& operator=(UserTwitchInfo&& src) = default;
+
             UserTwitchInfo(const rapidjson::Value& obj) : UserTwitchInfo()
             {
                 readFromValue(obj);
@@ -1899,6 +2737,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TwitchId"):
+                            if (strcmp(member, "TwitchId") != 0)
+                                break;
+                            TwitchId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TwitchUserName"):
+                            if (strcmp(member, "TwitchUserName") != 0)
+                                break;
+                            TwitchUserName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserPsnInfo : public PlayFabBaseModel
@@ -1918,6 +2784,15 @@ namespace PlayFabComboSdk
                 PsnOnlineId(src.PsnOnlineId)
             {}
 
+            UserPsnInfo(UserPsnInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                PsnAccountId(AZStd::move(src.PsnAccountId)),
+                PsnOnlineId(AZStd::move(src.PsnOnlineId))
+            {}
+
+            UserPsnInfo& operator=(const UserPsnInfo& src) = default;
+            UserPsnInfo& operator=(UserPsnInfo&& src) = default;
+
             UserPsnInfo(const rapidjson::Value& obj) : UserPsnInfo()
             {
                 readFromValue(obj);
@@ -1950,6 +2825,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PsnAccountId"):
+                            if (strcmp(member, "PsnAccountId") != 0)
+                                break;
+                            PsnAccountId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PsnOnlineId"):
+                            if (strcmp(member, "PsnOnlineId") != 0)
+                                break;
+                            PsnOnlineId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserGoogleInfo : public PlayFabBaseModel
@@ -1975,6 +2878,17 @@ namespace PlayFabComboSdk
                 GoogleGender(src.GoogleGender)
             {}
 
+            UserGoogleInfo(UserGoogleInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                GoogleId(AZStd::move(src.GoogleId)),
+                GoogleEmail(AZStd::move(src.GoogleEmail)),
+                GoogleLocale(AZStd::move(src.GoogleLocale)),
+                GoogleGender(AZStd::move(src.GoogleGender))
+            {}
+
+            UserGoogleInfo& operator=(const UserGoogleInfo& src) = default;
+            UserGoogleInfo& operator=(UserGoogleInfo&& src) = default;
+
             UserGoogleInfo(const rapidjson::Value& obj) : UserGoogleInfo()
             {
                 readFromValue(obj);
@@ -2019,6 +2933,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GoogleId"):
+                            if (strcmp(member, "GoogleId") != 0)
+                                break;
+                            GoogleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleEmail"):
+                            if (strcmp(member, "GoogleEmail") != 0)
+                                break;
+                            GoogleEmail = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleLocale"):
+                            if (strcmp(member, "GoogleLocale") != 0)
+                                break;
+                            GoogleLocale = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleGender"):
+                            if (strcmp(member, "GoogleGender") != 0)
+                                break;
+                            GoogleGender = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserXboxInfo : public PlayFabBaseModel
@@ -2035,6 +2987,14 @@ namespace PlayFabComboSdk
                 XboxUserId(src.XboxUserId)
             {}
 
+            UserXboxInfo(UserXboxInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                XboxUserId(AZStd::move(src.XboxUserId))
+            {}
+
+            UserXboxInfo& operator=(const UserXboxInfo& src) = default;
+            UserXboxInfo& operator=(UserXboxInfo&& src) = default;
+
             UserXboxInfo(const rapidjson::Value& obj) : UserXboxInfo()
             {
                 readFromValue(obj);
@@ -2061,6 +3021,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("XboxUserId"):
+                            if (strcmp(member, "XboxUserId") != 0)
+                                break;
+                            XboxUserId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserCustomIdInfo : public PlayFabBaseModel
@@ -2077,6 +3060,14 @@ namespace PlayFabComboSdk
                 CustomId(src.CustomId)
             {}
 
+            UserCustomIdInfo(UserCustomIdInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                CustomId(AZStd::move(src.CustomId))
+            {}
+
+            UserCustomIdInfo& operator=(const UserCustomIdInfo& src) = default;
+            UserCustomIdInfo& operator=(UserCustomIdInfo&& src) = default;
+
             UserCustomIdInfo(const rapidjson::Value& obj) : UserCustomIdInfo()
             {
                 readFromValue(obj);
@@ -2103,6 +3094,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CustomId"):
+                            if (strcmp(member, "CustomId") != 0)
+                                break;
+                            CustomId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UserAccountInfo : public PlayFabBaseModel
@@ -2164,6 +3178,97 @@ namespace PlayFabComboSdk
                 CustomIdInfo(src.CustomIdInfo ? new UserCustomIdInfo(*src.CustomIdInfo) : nullptr)
             {}
 
+            UserAccountInfo(UserAccountInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Created(AZStd::move(src.Created)),
+                Username(AZStd::move(src.Username)),
+                TitleInfo(src.TitleInfo),
+                PrivateInfo(src.PrivateInfo),
+                FacebookInfo(src.FacebookInfo),
+                SteamInfo(src.SteamInfo),
+                GameCenterInfo(src.GameCenterInfo),
+                IosDeviceInfo(src.IosDeviceInfo),
+                AndroidDeviceInfo(src.AndroidDeviceInfo),
+                KongregateInfo(src.KongregateInfo),
+                TwitchInfo(src.TwitchInfo),
+                PsnInfo(src.PsnInfo),
+                GoogleInfo(src.GoogleInfo),
+                XboxInfo(src.XboxInfo),
+                CustomIdInfo(src.CustomIdInfo)
+            {
+                src.TitleInfo = nullptr;
+                src.PrivateInfo = nullptr;
+                src.FacebookInfo = nullptr;
+                src.SteamInfo = nullptr;
+                src.GameCenterInfo = nullptr;
+                src.IosDeviceInfo = nullptr;
+                src.AndroidDeviceInfo = nullptr;
+                src.KongregateInfo = nullptr;
+                src.TwitchInfo = nullptr;
+                src.PsnInfo = nullptr;
+                src.GoogleInfo = nullptr;
+                src.XboxInfo = nullptr;
+                src.CustomIdInfo = nullptr;
+            }
+
+            UserAccountInfo& operator=(const UserAccountInfo& src)
+            {
+                if (this != &src)
+                    *this = UserAccountInfo(src);
+                return *this;
+            }
+
+            UserAccountInfo& operator=(UserAccountInfo&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    Created = AZStd::move(src.Created);
+                    Username = AZStd::move(src.Username);
+                    if (TitleInfo != nullptr) delete TitleInfo;
+                    TitleInfo = src.TitleInfo;
+                    src.TitleInfo = nullptr;
+                    if (PrivateInfo != nullptr) delete PrivateInfo;
+                    PrivateInfo = src.PrivateInfo;
+                    src.PrivateInfo = nullptr;
+                    if (FacebookInfo != nullptr) delete FacebookInfo;
+                    FacebookInfo = src.FacebookInfo;
+                    src.FacebookInfo = nullptr;
+                    if (SteamInfo != nullptr) delete SteamInfo;
+                    SteamInfo = src.SteamInfo;
+                    src.SteamInfo = nullptr;
+                    if (GameCenterInfo != nullptr) delete GameCenterInfo;
+                    GameCenterInfo = src.GameCenterInfo;
+                    src.GameCenterInfo = nullptr;
+                    if (IosDeviceInfo != nullptr) delete IosDeviceInfo;
+                    IosDeviceInfo = src.IosDeviceInfo;
+                    src.IosDeviceInfo = nullptr;
+                    if (AndroidDeviceInfo != nullptr) delete AndroidDeviceInfo;
+                    AndroidDeviceInfo = src.AndroidDeviceInfo;
+                    src.AndroidDeviceInfo = nullptr;
+                    if (KongregateInfo != nullptr) delete KongregateInfo;
+                    KongregateInfo = src.KongregateInfo;
+                    src.KongregateInfo = nullptr;
+                    if (TwitchInfo != nullptr) delete TwitchInfo;
+                    TwitchInfo = src.TwitchInfo;
+                    src.TwitchInfo = nullptr;
+                    if (PsnInfo != nullptr) delete PsnInfo;
+                    PsnInfo = src.PsnInfo;
+                    src.PsnInfo = nullptr;
+                    if (GoogleInfo != nullptr) delete GoogleInfo;
+                    GoogleInfo = src.GoogleInfo;
+                    src.GoogleInfo = nullptr;
+                    if (XboxInfo != nullptr) delete XboxInfo;
+                    XboxInfo = src.XboxInfo;
+                    src.XboxInfo = nullptr;
+                    if (CustomIdInfo != nullptr) delete CustomIdInfo;
+                    CustomIdInfo = src.CustomIdInfo;
+                    src.CustomIdInfo = nullptr;
+                }
+                return *this;
+            }
+
             UserAccountInfo(const rapidjson::Value& obj) : UserAccountInfo()
             {
                 readFromValue(obj);
@@ -2291,6 +3396,117 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleInfo"):
+                            if (strcmp(member, "TitleInfo") != 0)
+                                break;
+                            TitleInfo = new UserTitleInfo;
+                            TitleInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("PrivateInfo"):
+                            if (strcmp(member, "PrivateInfo") != 0)
+                                break;
+                            PrivateInfo = new UserPrivateAccountInfo;
+                            PrivateInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("FacebookInfo"):
+                            if (strcmp(member, "FacebookInfo") != 0)
+                                break;
+                            FacebookInfo = new UserFacebookInfo;
+                            FacebookInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamInfo"):
+                            if (strcmp(member, "SteamInfo") != 0)
+                                break;
+                            SteamInfo = new UserSteamInfo;
+                            SteamInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("GameCenterInfo"):
+                            if (strcmp(member, "GameCenterInfo") != 0)
+                                break;
+                            GameCenterInfo = new UserGameCenterInfo;
+                            GameCenterInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("IosDeviceInfo"):
+                            if (strcmp(member, "IosDeviceInfo") != 0)
+                                break;
+                            IosDeviceInfo = new UserIosDeviceInfo;
+                            IosDeviceInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("AndroidDeviceInfo"):
+                            if (strcmp(member, "AndroidDeviceInfo") != 0)
+                                break;
+                            AndroidDeviceInfo = new UserAndroidDeviceInfo;
+                            AndroidDeviceInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("KongregateInfo"):
+                            if (strcmp(member, "KongregateInfo") != 0)
+                                break;
+                            KongregateInfo = new UserKongregateInfo;
+                            KongregateInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("TwitchInfo"):
+                            if (strcmp(member, "TwitchInfo") != 0)
+                                break;
+                            TwitchInfo = new UserTwitchInfo;
+                            TwitchInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("PsnInfo"):
+                            if (strcmp(member, "PsnInfo") != 0)
+                                break;
+                            PsnInfo = new UserPsnInfo;
+                            PsnInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("GoogleInfo"):
+                            if (strcmp(member, "GoogleInfo") != 0)
+                                break;
+                            GoogleInfo = new UserGoogleInfo;
+                            GoogleInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("XboxInfo"):
+                            if (strcmp(member, "XboxInfo") != 0)
+                                break;
+                            XboxInfo = new UserXboxInfo;
+                            XboxInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomIdInfo"):
+                            if (strcmp(member, "CustomIdInfo") != 0)
+                                break;
+                            CustomIdInfo = new UserCustomIdInfo;
+                            CustomIdInfo->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AuthenticateSessionTicketResult : public PlayFabBaseModel
@@ -2307,6 +3523,31 @@ namespace PlayFabComboSdk
                 UserInfo(src.UserInfo ? new UserAccountInfo(*src.UserInfo) : nullptr)
             {}
 
+            AuthenticateSessionTicketResult(AuthenticateSessionTicketResult&& src) noexcept :
+                PlayFabBaseModel(),
+                UserInfo(src.UserInfo)
+            {
+                src.UserInfo = nullptr;
+            }
+
+            AuthenticateSessionTicketResult& operator=(const AuthenticateSessionTicketResult& src)
+            {
+                if (this != &src)
+                    *this = AuthenticateSessionTicketResult(src);
+                return *this;
+            }
+
+            AuthenticateSessionTicketResult& operator=(AuthenticateSessionTicketResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (UserInfo != nullptr) delete UserInfo;
+                    UserInfo = src.UserInfo;
+                    src.UserInfo = nullptr;
+                }
+                return *this;
+            }
+
             AuthenticateSessionTicketResult(const rapidjson::Value& obj) : AuthenticateSessionTicketResult()
             {
                 readFromValue(obj);
@@ -2334,9 +3575,33 @@ namespace PlayFabComboSdk
 
                 return true;
             }
-        };
 
-        struct AwardSteamAchievementItem : public PlayFabBaseModel
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("UserInfo"):
+                            if (strcmp(member, "UserInfo") != 0)
+                                break;
+                            UserInfo = new UserAccountInfo;
+                            UserInfo->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
+        };
+
+        struct AwardSteamAchievementItem : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string AchievementName;
@@ -2356,6 +3621,16 @@ namespace PlayFabComboSdk
                 Result(src.Result)
             {}
 
+            AwardSteamAchievementItem(AwardSteamAchievementItem&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                AchievementName(AZStd::move(src.AchievementName)),
+                Result(AZStd::move(src.Result))
+            {}
+
+            AwardSteamAchievementItem& operator=(const AwardSteamAchievementItem& src) = default;
+            AwardSteamAchievementItem& operator=(AwardSteamAchievementItem&& src) = default;
+
             AwardSteamAchievementItem(const rapidjson::Value& obj) : AwardSteamAchievementItem()
             {
                 readFromValue(obj);
@@ -2388,11 +3663,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("AchievementName"):
+                            if (strcmp(member, "AchievementName") != 0)
+                                break;
+                            AchievementName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Result"):
+                            if (strcmp(member, "Result") != 0)
+                                break;
+                            Result = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AwardSteamAchievementRequest : public PlayFabBaseModel
         {
-            std::list<AwardSteamAchievementItem> Achievements;
+            std::vector<AwardSteamAchievementItem> Achievements;
 
             AwardSteamAchievementRequest() :
                 PlayFabBaseModel(),
@@ -2404,6 +3712,14 @@ namespace PlayFabComboSdk
                 Achievements(src.Achievements)
             {}
 
+            AwardSteamAchievementRequest(AwardSteamAchievementRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Achievements(AZStd::move(src.Achievements))
+            {}
+
+            AwardSteamAchievementRequest& operator=(const AwardSteamAchievementRequest& src) = default;
+            AwardSteamAchievementRequest& operator=(AwardSteamAchievementRequest&& src) = default;
+
             AwardSteamAchievementRequest(const rapidjson::Value& obj) : AwardSteamAchievementRequest()
             {
                 readFromValue(obj);
@@ -2418,7 +3734,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Achievements");
                 writer.StartArray();
-                for (std::list<AwardSteamAchievementItem>::iterator iter = Achievements.begin(); iter != Achievements.end(); iter++) {
+                for (std::vector<AwardSteamAchievementItem>::iterator iter = Achievements.begin(); iter != Achievements.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -2430,18 +3746,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Achievements_member = obj.FindMember("Achievements");
                 if (Achievements_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Achievements_member->value;
+                    Achievements.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Achievements.push_back(AwardSteamAchievementItem(memberList[i]));
+                        Achievements.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Achievements"):
+                            if (strcmp(member, "Achievements") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Achievements.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Achievements.emplace_back();
+                                    Achievements.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct AwardSteamAchievementResult : public PlayFabBaseModel
         {
-            std::list<AwardSteamAchievementItem> AchievementResults;
+            std::vector<AwardSteamAchievementItem> AchievementResults;
 
             AwardSteamAchievementResult() :
                 PlayFabBaseModel(),
@@ -2453,6 +3801,14 @@ namespace PlayFabComboSdk
                 AchievementResults(src.AchievementResults)
             {}
 
+            AwardSteamAchievementResult(AwardSteamAchievementResult&& src) noexcept :
+                PlayFabBaseModel(),
+                AchievementResults(AZStd::move(src.AchievementResults))
+            {}
+
+            AwardSteamAchievementResult& operator=(const AwardSteamAchievementResult& src) = default;
+            AwardSteamAchievementResult& operator=(AwardSteamAchievementResult&& src) = default;
+
             AwardSteamAchievementResult(const rapidjson::Value& obj) : AwardSteamAchievementResult()
             {
                 readFromValue(obj);
@@ -2468,7 +3824,7 @@ namespace PlayFabComboSdk
                 if (!AchievementResults.empty()) {
                     writer.String("AchievementResults");
                     writer.StartArray();
-                    for (std::list<AwardSteamAchievementItem>::iterator iter = AchievementResults.begin(); iter != AchievementResults.end(); iter++) {
+                    for (std::vector<AwardSteamAchievementItem>::iterator iter = AchievementResults.begin(); iter != AchievementResults.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -2481,13 +3837,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator AchievementResults_member = obj.FindMember("AchievementResults");
                 if (AchievementResults_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = AchievementResults_member->value;
+                    AchievementResults.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        AchievementResults.push_back(AwardSteamAchievementItem(memberList[i]));
+                        AchievementResults.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("AchievementResults"):
+                            if (strcmp(member, "AchievementResults") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                AchievementResults.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    AchievementResults.emplace_back();
+                                    AchievementResults.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanInfo : public PlayFabBaseModel
@@ -2525,6 +3913,21 @@ namespace PlayFabComboSdk
                 Active(src.Active)
             {}
 
+            BanInfo(BanInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                BanId(AZStd::move(src.BanId)),
+                IPAddress(AZStd::move(src.IPAddress)),
+                MACAddress(AZStd::move(src.MACAddress)),
+                Created(AZStd::move(src.Created)),
+                Expires(AZStd::move(src.Expires)),
+                Reason(AZStd::move(src.Reason)),
+                Active(AZStd::move(src.Active))
+            {}
+
+            BanInfo& operator=(const BanInfo& src) = default;
+            BanInfo& operator=(BanInfo&& src) = default;
+
             BanInfo(const rapidjson::Value& obj) : BanInfo()
             {
                 readFromValue(obj);
@@ -2591,6 +3994,64 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BanId"):
+                            if (strcmp(member, "BanId") != 0)
+                                break;
+                            BanId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IPAddress"):
+                            if (strcmp(member, "IPAddress") != 0)
+                                break;
+                            IPAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MACAddress"):
+                            if (strcmp(member, "MACAddress") != 0)
+                                break;
+                            MACAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expires"):
+                            if (strcmp(member, "Expires") != 0)
+                                break;
+                            Expires = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Active"):
+                            if (strcmp(member, "Active") != 0)
+                                break;
+                            Active = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanRequest : public PlayFabBaseModel
@@ -2619,6 +4080,18 @@ namespace PlayFabComboSdk
                 DurationInHours(src.DurationInHours)
             {}
 
+            BanRequest(BanRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                IPAddress(AZStd::move(src.IPAddress)),
+                MACAddress(AZStd::move(src.MACAddress)),
+                Reason(AZStd::move(src.Reason)),
+                DurationInHours(AZStd::move(src.DurationInHours))
+            {}
+
+            BanRequest& operator=(const BanRequest& src) = default;
+            BanRequest& operator=(BanRequest&& src) = default;
+
             BanRequest(const rapidjson::Value& obj) : BanRequest()
             {
                 readFromValue(obj);
@@ -2667,11 +4140,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IPAddress"):
+                            if (strcmp(member, "IPAddress") != 0)
+                                break;
+                            IPAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MACAddress"):
+                            if (strcmp(member, "MACAddress") != 0)
+                                break;
+                            MACAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DurationInHours"):
+                            if (strcmp(member, "DurationInHours") != 0)
+                                break;
+                            DurationInHours = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanUsersRequest : public PlayFabBaseModel
         {
-            std::list<BanRequest> Bans;
+            std::vector<BanRequest> Bans;
 
             BanUsersRequest() :
                 PlayFabBaseModel(),
@@ -2683,6 +4199,14 @@ namespace PlayFabComboSdk
                 Bans(src.Bans)
             {}
 
+            BanUsersRequest(BanUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Bans(AZStd::move(src.Bans))
+            {}
+
+            BanUsersRequest& operator=(const BanUsersRequest& src) = default;
+            BanUsersRequest& operator=(BanUsersRequest&& src) = default;
+
             BanUsersRequest(const rapidjson::Value& obj) : BanUsersRequest()
             {
                 readFromValue(obj);
@@ -2697,7 +4221,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Bans");
                 writer.StartArray();
-                for (std::list<BanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
+                for (std::vector<BanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -2709,18 +4233,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Bans_member = obj.FindMember("Bans");
                 if (Bans_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Bans_member->value;
+                    Bans.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Bans.push_back(BanRequest(memberList[i]));
+                        Bans.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Bans"):
+                            if (strcmp(member, "Bans") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Bans.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Bans.emplace_back();
+                                    Bans.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct BanUsersResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             BanUsersResult() :
                 PlayFabBaseModel(),
@@ -2732,6 +4288,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            BanUsersResult(BanUsersResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            BanUsersResult& operator=(const BanUsersResult& src) = default;
+            BanUsersResult& operator=(BanUsersResult&& src) = default;
+
             BanUsersResult(const rapidjson::Value& obj) : BanUsersResult()
             {
                 readFromValue(obj);
@@ -2747,7 +4311,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -2760,13 +4324,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItemConsumableInfo : public PlayFabBaseModel
@@ -2789,6 +4385,16 @@ namespace PlayFabComboSdk
                 UsagePeriodGroup(src.UsagePeriodGroup)
             {}
 
+            CatalogItemConsumableInfo(CatalogItemConsumableInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                UsageCount(AZStd::move(src.UsageCount)),
+                UsagePeriod(AZStd::move(src.UsagePeriod)),
+                UsagePeriodGroup(AZStd::move(src.UsagePeriodGroup))
+            {}
+
+            CatalogItemConsumableInfo& operator=(const CatalogItemConsumableInfo& src) = default;
+            CatalogItemConsumableInfo& operator=(CatalogItemConsumableInfo&& src) = default;
+
             CatalogItemConsumableInfo(const rapidjson::Value& obj) : CatalogItemConsumableInfo()
             {
                 readFromValue(obj);
@@ -2827,14 +4433,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("UsageCount"):
+                            if (strcmp(member, "UsageCount") != 0)
+                                break;
+                            UsageCount = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsagePeriod"):
+                            if (strcmp(member, "UsagePeriod") != 0)
+                                break;
+                            UsagePeriod = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsagePeriodGroup"):
+                            if (strcmp(member, "UsagePeriodGroup") != 0)
+                                break;
+                            UsagePeriodGroup = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItemContainerInfo : public PlayFabBaseModel
         {
             AZStd::string KeyItemId;
-            std::list<AZStd::string> ItemContents;
-            std::list<AZStd::string> ResultTableContents;
-            std::map<AZStd::string, Uint32> VirtualCurrencyContents;
+            std::vector<AZStd::string> ItemContents;
+            std::vector<AZStd::string> ResultTableContents;
+            PlayFabStringMap<Uint32> VirtualCurrencyContents;
 
             CatalogItemContainerInfo() :
                 PlayFabBaseModel(),
@@ -2852,6 +4491,17 @@ namespace PlayFabComboSdk
                 VirtualCurrencyContents(src.VirtualCurrencyContents)
             {}
 
+            CatalogItemContainerInfo(CatalogItemContainerInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                KeyItemId(AZStd::move(src.KeyItemId)),
+                ItemContents(AZStd::move(src.ItemContents)),
+                ResultTableContents(AZStd::move(src.ResultTableContents)),
+                VirtualCurrencyContents(AZStd::move(src.VirtualCurrencyContents))
+            {}
+
+            CatalogItemContainerInfo& operator=(const CatalogItemContainerInfo& src) = default;
+            CatalogItemContainerInfo& operator=(CatalogItemContainerInfo&& src) = default;
+
             CatalogItemContainerInfo(const rapidjson::Value& obj) : CatalogItemContainerInfo()
             {
                 readFromValue(obj);
@@ -2871,7 +4521,7 @@ namespace PlayFabComboSdk
                 if (!ItemContents.empty()) {
                     writer.String("ItemContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = ItemContents.begin(); iter != ItemContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = ItemContents.begin(); iter != ItemContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -2879,7 +4529,7 @@ namespace PlayFabComboSdk
                 if (!ResultTableContents.empty()) {
                     writer.String("ResultTableContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = ResultTableContents.begin(); iter != ResultTableContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = ResultTableContents.begin(); iter != ResultTableContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -2887,7 +4537,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyContents.empty()) {
                     writer.String("VirtualCurrencyContents");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = VirtualCurrencyContents.begin(); iter != VirtualCurrencyContents.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = VirtualCurrencyContents.begin(); iter != VirtualCurrencyContents.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -2903,15 +4553,17 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemContents_member = obj.FindMember("ItemContents");
                 if (ItemContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemContents_member->value;
+                    ItemContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemContents.push_back(memberList[i].GetString());
+                        ItemContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator ResultTableContents_member = obj.FindMember("ResultTableContents");
                 if (ResultTableContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ResultTableContents_member->value;
+                    ResultTableContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ResultTableContents.push_back(memberList[i].GetString());
+                        ResultTableContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrencyContents_member = obj.FindMember("VirtualCurrencyContents");
@@ -2923,13 +4575,72 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("KeyItemId"):
+                            if (strcmp(member, "KeyItemId") != 0)
+                                break;
+                            KeyItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemContents"):
+                            if (strcmp(member, "ItemContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("ResultTableContents"):
+                            if (strcmp(member, "ResultTableContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ResultTableContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ResultTableContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyContents"):
+                            if (strcmp(member, "VirtualCurrencyContents") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyContents[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItemBundleInfo : public PlayFabBaseModel
         {
-            std::list<AZStd::string> BundledItems;
-            std::list<AZStd::string> BundledResultTables;
-            std::map<AZStd::string, Uint32> BundledVirtualCurrencies;
+            std::vector<AZStd::string> BundledItems;
+            std::vector<AZStd::string> BundledResultTables;
+            PlayFabStringMap<Uint32> BundledVirtualCurrencies;
 
             CatalogItemBundleInfo() :
                 PlayFabBaseModel(),
@@ -2945,6 +4656,16 @@ namespace PlayFabComboSdk
                 BundledVirtualCurrencies(src.BundledVirtualCurrencies)
             {}
 
+            CatalogItemBundleInfo(CatalogItemBundleInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                BundledItems(AZStd::move(src.BundledItems)),
+                BundledResultTables(AZStd::move(src.BundledResultTables)),
+                BundledVirtualCurrencies(AZStd::move(src.BundledVirtualCurrencies))
+            {}
+
+            CatalogItemBundleInfo& operator=(const CatalogItemBundleInfo& src) = default;
+            CatalogItemBundleInfo& operator=(CatalogItemBundleInfo&& src) = default;
+
             CatalogItemBundleInfo(const rapidjson::Value& obj) : CatalogItemBundleInfo()
             {
                 readFromValue(obj);
@@ -2960,7 +4681,7 @@ namespace PlayFabComboSdk
                 if (!BundledItems.empty()) {
                     writer.String("BundledItems");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundledItems.begin(); iter != BundledItems.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundledItems.begin(); iter != BundledItems.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -2968,7 +4689,7 @@ namespace PlayFabComboSdk
                 if (!BundledResultTables.empty()) {
                     writer.String("BundledResultTables");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundledResultTables.begin(); iter != BundledResultTables.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundledResultTables.begin(); iter != BundledResultTables.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -2976,7 +4697,7 @@ namespace PlayFabComboSdk
                 if (!BundledVirtualCurrencies.empty()) {
                     writer.String("BundledVirtualCurrencies");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = BundledVirtualCurrencies.begin(); iter != BundledVirtualCurrencies.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = BundledVirtualCurrencies.begin(); iter != BundledVirtualCurrencies.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -2990,15 +4711,17 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundledItems_member = obj.FindMember("BundledItems");
                 if (BundledItems_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundledItems_member->value;
+                    BundledItems.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundledItems.push_back(memberList[i].GetString());
+                        BundledItems.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator BundledResultTables_member = obj.FindMember("BundledResultTables");
                 if (BundledResultTables_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundledResultTables_member->value;
+                    BundledResultTables.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundledResultTables.push_back(memberList[i].GetString());
+                        BundledResultTables.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator BundledVirtualCurrencies_member = obj.FindMember("BundledVirtualCurrencies");
@@ -3010,6 +4733,60 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BundledItems"):
+                            if (strcmp(member, "BundledItems") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundledItems.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundledItems.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("BundledResultTables"):
+                            if (strcmp(member, "BundledResultTables") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundledResultTables.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundledResultTables.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("BundledVirtualCurrencies"):
+                            if (strcmp(member, "BundledVirtualCurrencies") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    BundledVirtualCurrencies[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CatalogItem : public PlayFabBaseModel
@@ -3019,9 +4796,9 @@ namespace PlayFabComboSdk
             AZStd::string CatalogVersion;
             AZStd::string DisplayName;
             AZStd::string Description;
-            std::map<AZStd::string, Uint32> VirtualCurrencyPrices;
-            std::map<AZStd::string, Uint32> RealCurrencyPrices;
-            std::list<AZStd::string> Tags;
+            PlayFabStringMap<Uint32> VirtualCurrencyPrices;
+            PlayFabStringMap<Uint32> RealCurrencyPrices;
+            std::vector<AZStd::string> Tags;
             AZStd::string CustomData;
             CatalogItemConsumableInfo* Consumable;
             CatalogItemContainerInfo* Container;
@@ -3077,6 +4854,71 @@ namespace PlayFabComboSdk
                 InitialLimitedEditionCount(src.InitialLimitedEditionCount)
             {}
 
+            CatalogItem(CatalogItem&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                Description(AZStd::move(src.Description)),
+                VirtualCurrencyPrices(AZStd::move(src.VirtualCurrencyPrices)),
+                RealCurrencyPrices(AZStd::move(src.RealCurrencyPrices)),
+                Tags(AZStd::move(src.Tags)),
+                CustomData(AZStd::move(src.CustomData)),
+                Consumable(src.Consumable),
+                Container(src.Container),
+                Bundle(src.Bundle),
+                CanBecomeCharacter(AZStd::move(src.CanBecomeCharacter)),
+                IsStackable(AZStd::move(src.IsStackable)),
+                IsTradable(AZStd::move(src.IsTradable)),
+                ItemImageUrl(AZStd::move(src.ItemImageUrl)),
+                IsLimitedEdition(AZStd::move(src.IsLimitedEdition)),
+                InitialLimitedEditionCount(AZStd::move(src.InitialLimitedEditionCount))
+            {
+                src.Consumable = nullptr;
+                src.Container = nullptr;
+                src.Bundle = nullptr;
+            }
+
+            CatalogItem& operator=(const CatalogItem& src)
+            {
+                if (this != &src)
+                    *this = CatalogItem(src);
+                return *this;
+            }
+
+            CatalogItem& operator=(CatalogItem&& src)
+            {
+                if (this != &src)
+                {
+                    ItemId = AZStd::move(src.ItemId);
+                    ItemClass = AZStd::move(src.ItemClass);
+                    CatalogVersion = AZStd::move(src.CatalogVersion);
+                    DisplayName = AZStd::move(src.DisplayName);
+                    Description = AZStd::move(src.Description);
+                    VirtualCurrencyPrices = AZStd::move(src.VirtualCurrencyPrices);
+                    RealCurrencyPrices = AZStd::move(src.RealCurrencyPrices);
+                    Tags = AZStd::move(src.Tags);
+                    CustomData = AZStd::move(src.CustomData);
+                    if (Consumable != nullptr) delete Consumable;
+                    Consumable = src.Consumable;
+                    src.Consumable = nullptr;
+                    if (Container != nullptr) delete Container;
+                    Container = src.Container;
+                    src.Container = nullptr;
+                    if (Bundle != nullptr) delete Bundle;
+                    Bundle = src.Bundle;
+                    src.Bundle = nullptr;
+                    CanBecomeCharacter = AZStd::move(src.CanBecomeCharacter);
+                    IsStackable = AZStd::move(src.IsStackable);
+                    IsTradable = AZStd::move(src.IsTradable);
+                    ItemImageUrl = AZStd::move(src.ItemImageUrl);
+                    IsLimitedEdition = AZStd::move(src.IsLimitedEdition);
+                    InitialLimitedEditionCount = AZStd::move(src.InitialLimitedEditionCount);
+                }
+                return *this;
+            }
+
             CatalogItem(const rapidjson::Value& obj) : CatalogItem()
             {
                 readFromValue(obj);
@@ -3113,7 +4955,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyPrices.empty()) {
                     writer.String("VirtualCurrencyPrices");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = VirtualCurrencyPrices.begin(); iter != VirtualCurrencyPrices.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = VirtualCurrencyPrices.begin(); iter != VirtualCurrencyPrices.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -3122,7 +4964,7 @@ namespace PlayFabComboSdk
                 if (!RealCurrencyPrices.empty()) {
                     writer.String("RealCurrencyPrices");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = RealCurrencyPrices.begin(); iter != RealCurrencyPrices.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = RealCurrencyPrices.begin(); iter != RealCurrencyPrices.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -3131,7 +4973,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -3196,8 +5038,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -3223,6 +5066,138 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Description"):
+                            if (strcmp(member, "Description") != 0)
+                                break;
+                            Description = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyPrices"):
+                            if (strcmp(member, "VirtualCurrencyPrices") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyPrices[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("RealCurrencyPrices"):
+                            if (strcmp(member, "RealCurrencyPrices") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    RealCurrencyPrices[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            CustomData = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Consumable"):
+                            if (strcmp(member, "Consumable") != 0)
+                                break;
+                            Consumable = new CatalogItemConsumableInfo;
+                            Consumable->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Container"):
+                            if (strcmp(member, "Container") != 0)
+                                break;
+                            Container = new CatalogItemContainerInfo;
+                            Container->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Bundle"):
+                            if (strcmp(member, "Bundle") != 0)
+                                break;
+                            Bundle = new CatalogItemBundleInfo;
+                            Bundle->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("CanBecomeCharacter"):
+                            if (strcmp(member, "CanBecomeCharacter") != 0)
+                                break;
+                            CanBecomeCharacter = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsStackable"):
+                            if (strcmp(member, "IsStackable") != 0)
+                                break;
+                            IsStackable = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsTradable"):
+                            if (strcmp(member, "IsTradable") != 0)
+                                break;
+                            IsTradable = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemImageUrl"):
+                            if (strcmp(member, "ItemImageUrl") != 0)
+                                break;
+                            ItemImageUrl = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IsLimitedEdition"):
+                            if (strcmp(member, "IsLimitedEdition") != 0)
+                                break;
+                            IsLimitedEdition = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("InitialLimitedEditionCount"):
+                            if (strcmp(member, "InitialLimitedEditionCount") != 0)
+                                break;
+                            InitialLimitedEditionCount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ItemInstance : public PlayFabBaseModel
@@ -3240,8 +5215,8 @@ namespace PlayFabComboSdk
             AZStd::string DisplayName;
             AZStd::string UnitCurrency;
             Uint32 UnitPrice;
-            std::list<AZStd::string> BundleContents;
-            std::map<AZStd::string, AZStd::string> CustomData;
+            std::vector<AZStd::string> BundleContents;
+            PlayFabStringMap<AZStd::string> CustomData;
 
             ItemInstance() :
                 PlayFabBaseModel(),
@@ -3281,6 +5256,28 @@ namespace PlayFabComboSdk
                 CustomData(src.CustomData)
             {}
 
+            ItemInstance(ItemInstance&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                PurchaseDate(AZStd::move(src.PurchaseDate)),
+                Expiration(AZStd::move(src.Expiration)),
+                RemainingUses(AZStd::move(src.RemainingUses)),
+                UsesIncrementedBy(AZStd::move(src.UsesIncrementedBy)),
+                Annotation(AZStd::move(src.Annotation)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                BundleParent(AZStd::move(src.BundleParent)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                UnitCurrency(AZStd::move(src.UnitCurrency)),
+                UnitPrice(AZStd::move(src.UnitPrice)),
+                BundleContents(AZStd::move(src.BundleContents)),
+                CustomData(AZStd::move(src.CustomData))
+            {}
+
+            ItemInstance& operator=(const ItemInstance& src) = default;
+            ItemInstance& operator=(ItemInstance&& src) = default;
+
             ItemInstance(const rapidjson::Value& obj) : ItemInstance()
             {
                 readFromValue(obj);
@@ -3346,7 +5343,7 @@ namespace PlayFabComboSdk
                 if (!BundleContents.empty()) {
                     writer.String("BundleContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -3354,7 +5351,7 @@ namespace PlayFabComboSdk
                 if (!CustomData.empty()) {
                     writer.String("CustomData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -3394,8 +5391,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundleContents_member = obj.FindMember("BundleContents");
                 if (BundleContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundleContents_member->value;
+                    BundleContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundleContents.push_back(memberList[i].GetString());
+                        BundleContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -3407,12 +5405,119 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PurchaseDate"):
+                            if (strcmp(member, "PurchaseDate") != 0)
+                                break;
+                            PurchaseDate = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expiration"):
+                            if (strcmp(member, "Expiration") != 0)
+                                break;
+                            Expiration = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsesIncrementedBy"):
+                            if (strcmp(member, "UsesIncrementedBy") != 0)
+                                break;
+                            UsesIncrementedBy = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleParent"):
+                            if (strcmp(member, "BundleParent") != 0)
+                                break;
+                            BundleParent = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitCurrency"):
+                            if (strcmp(member, "UnitCurrency") != 0)
+                                break;
+                            UnitCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitPrice"):
+                            if (strcmp(member, "UnitPrice") != 0)
+                                break;
+                            UnitPrice = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleContents"):
+                            if (strcmp(member, "BundleContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundleContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundleContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CustomData[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CharacterInventory : public PlayFabBaseModel
         {
             AZStd::string CharacterId;
-            std::list<ItemInstance> Inventory;
+            std::vector<ItemInstance> Inventory;
 
             CharacterInventory() :
                 PlayFabBaseModel(),
@@ -3426,6 +5531,15 @@ namespace PlayFabComboSdk
                 Inventory(src.Inventory)
             {}
 
+            CharacterInventory(CharacterInventory&& src) noexcept :
+                PlayFabBaseModel(),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Inventory(AZStd::move(src.Inventory))
+            {}
+
+            CharacterInventory& operator=(const CharacterInventory& src) = default;
+            CharacterInventory& operator=(CharacterInventory&& src) = default;
+
             CharacterInventory(const rapidjson::Value& obj) : CharacterInventory()
             {
                 readFromValue(obj);
@@ -3445,7 +5559,7 @@ namespace PlayFabComboSdk
                 if (!Inventory.empty()) {
                     writer.String("Inventory");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -3460,13 +5574,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Inventory_member = obj.FindMember("Inventory");
                 if (Inventory_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Inventory_member->value;
+                    Inventory.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Inventory.push_back(ItemInstance(memberList[i]));
+                        Inventory.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Inventory"):
+                            if (strcmp(member, "Inventory") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Inventory.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Inventory.emplace_back();
+                                    Inventory.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CharacterLeaderboardEntry : public PlayFabBaseModel
@@ -3501,6 +5652,20 @@ namespace PlayFabComboSdk
                 Position(src.Position)
             {}
 
+            CharacterLeaderboardEntry(CharacterLeaderboardEntry&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CharacterName(AZStd::move(src.CharacterName)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                CharacterType(AZStd::move(src.CharacterType)),
+                StatValue(AZStd::move(src.StatValue)),
+                Position(AZStd::move(src.Position))
+            {}
+
+            CharacterLeaderboardEntry& operator=(const CharacterLeaderboardEntry& src) = default;
+            CharacterLeaderboardEntry& operator=(CharacterLeaderboardEntry&& src) = default;
+
             CharacterLeaderboardEntry(const rapidjson::Value& obj) : CharacterLeaderboardEntry()
             {
                 readFromValue(obj);
@@ -3559,6 +5724,59 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterName"):
+                            if (strcmp(member, "CharacterName") != 0)
+                                break;
+                            CharacterName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterType"):
+                            if (strcmp(member, "CharacterType") != 0)
+                                break;
+                            CharacterType = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatValue"):
+                            if (strcmp(member, "StatValue") != 0)
+                                break;
+                            StatValue = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Position"):
+                            if (strcmp(member, "Position") != 0)
+                                break;
+                            Position = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CharacterResult : public PlayFabBaseModel
@@ -3581,6 +5799,16 @@ namespace PlayFabComboSdk
                 CharacterType(src.CharacterType)
             {}
 
+            CharacterResult(CharacterResult&& src) noexcept :
+                PlayFabBaseModel(),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CharacterName(AZStd::move(src.CharacterName)),
+                CharacterType(AZStd::move(src.CharacterType))
+            {}
+
+            CharacterResult& operator=(const CharacterResult& src) = default;
+            CharacterResult& operator=(CharacterResult&& src) = default;
+
             CharacterResult(const rapidjson::Value& obj) : CharacterResult()
             {
                 readFromValue(obj);
@@ -3619,6 +5847,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterName"):
+                            if (strcmp(member, "CharacterName") != 0)
+                                break;
+                            CharacterName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterType"):
+                            if (strcmp(member, "CharacterType") != 0)
+                                break;
+                            CharacterType = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum CloudScriptRevisionOption
@@ -3645,20 +5906,15 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<CloudScriptRevisionOption>(obj.GetInt());
 
-            static std::map<const char *, CloudScriptRevisionOption, PlayFabComboSdk::StringCompare> _CloudScriptRevisionOptionMap;
-            if (_CloudScriptRevisionOptionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _CloudScriptRevisionOptionMap["Live"] = CloudScriptRevisionOptionLive;
-                _CloudScriptRevisionOptionMap["Latest"] = CloudScriptRevisionOptionLatest;
-                _CloudScriptRevisionOptionMap["Specific"] = CloudScriptRevisionOptionSpecific;
-
+            case PlayFabJsonReader::Hash("Live"): if (strcmp(name, "Live") == 0) return CloudScriptRevisionOptionLive; break;
+            case PlayFabJsonReader::Hash("Latest"): if (strcmp(name, "Latest") == 0) return CloudScriptRevisionOptionLatest; break;
+            case PlayFabJsonReader::Hash("Specific"): if (strcmp(name, "Specific") == 0) return CloudScriptRevisionOptionSpecific; break;
             }
 
-            auto output = _CloudScriptRevisionOptionMap.find(obj.GetString());
-            if (output != _CloudScriptRevisionOptionMap.end())
-                return output->second;
-
             return CloudScriptRevisionOptionLive; // Basically critical fail
         }
 
@@ -3685,6 +5941,17 @@ namespace PlayFabComboSdk
                 CharacterId(src.CharacterId)
             {}
 
+            ConsumeItemRequest(ConsumeItemRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                ConsumeCount(AZStd::move(src.ConsumeCount)),
+                CharacterId(AZStd::move(src.CharacterId))
+            {}
+
+            ConsumeItemRequest& operator=(const ConsumeItemRequest& src) = default;
+            ConsumeItemRequest& operator=(ConsumeItemRequest&& src) = default;
+
             ConsumeItemRequest(const rapidjson::Value& obj) : ConsumeItemRequest()
             {
                 readFromValue(obj);
@@ -3723,6 +5990,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ConsumeCount"):
+                            if (strcmp(member, "ConsumeCount") != 0)
+                                break;
+                            ConsumeCount = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ConsumeItemResult : public PlayFabBaseModel
@@ -3742,6 +6047,15 @@ namespace PlayFabComboSdk
                 RemainingUses(src.RemainingUses)
             {}
 
+            ConsumeItemResult(ConsumeItemResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                RemainingUses(AZStd::move(src.RemainingUses))
+            {}
+
+            ConsumeItemResult& operator=(const ConsumeItemResult& src) = default;
+            ConsumeItemResult& operator=(ConsumeItemResult&& src) = default;
+
             ConsumeItemResult(const rapidjson::Value& obj) : ConsumeItemResult()
             {
                 readFromValue(obj);
@@ -3772,6 +6086,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum EmailVerificationStatus
@@ -3798,20 +6140,15 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<EmailVerificationStatus>(obj.GetInt());
 
-            static std::map<const char *, EmailVerificationStatus, PlayFabComboSdk::StringCompare> _EmailVerificationStatusMap;
-            if (_EmailVerificationStatusMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _EmailVerificationStatusMap["Unverified"] = EmailVerificationStatusUnverified;
-                _EmailVerificationStatusMap["Pending"] = EmailVerificationStatusPending;
-                _EmailVerificationStatusMap["Confirmed"] = EmailVerificationStatusConfirmed;
-
+            case PlayFabJsonReader::Hash("Unverified"): if (strcmp(name, "Unverified") == 0) return EmailVerificationStatusUnverified; break;
+            case PlayFabJsonReader::Hash("Pending"): if (strcmp(name, "Pending") == 0) return EmailVerificationStatusPending; break;
+            case PlayFabJsonReader::Hash("Confirmed"): if (strcmp(name, "Confirmed") == 0) return EmailVerificationStatusConfirmed; break;
             }
 
-            auto output = _EmailVerificationStatusMap.find(obj.GetString());
-            if (output != _EmailVerificationStatusMap.end())
-                return output->second;
-
             return EmailVerificationStatusUnverified; // Basically critical fail
         }
 
@@ -3835,6 +6172,16 @@ namespace PlayFabComboSdk
                 VerificationStatus(src.VerificationStatus)
             {}
 
+            ContactEmailInfo(ContactEmailInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                EmailAddress(AZStd::move(src.EmailAddress)),
+                VerificationStatus(AZStd::move(src.VerificationStatus))
+            {}
+
+            ContactEmailInfo& operator=(const ContactEmailInfo& src) = default;
+            ContactEmailInfo& operator=(ContactEmailInfo&& src) = default;
+
             ContactEmailInfo(const rapidjson::Value& obj) : ContactEmailInfo()
             {
                 readFromValue(obj);
@@ -3873,6 +6220,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("EmailAddress"):
+                            if (strcmp(member, "EmailAddress") != 0)
+                                break;
+                            EmailAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VerificationStatus"):
+                            if (strcmp(member, "VerificationStatus") != 0)
+                                break;
+                            VerificationStatus = readEmailVerificationStatusFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum ContinentCode
@@ -3907,24 +6287,19 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<ContinentCode>(obj.GetInt());
 
-            static std::map<const char *, ContinentCode, PlayFabComboSdk::StringCompare> _ContinentCodeMap;
-            if (_ContinentCodeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ContinentCodeMap["AF"] = ContinentCodeAF;
-                _ContinentCodeMap["AN"] = ContinentCodeAN;
-                _ContinentCodeMap["AS"] = ContinentCodeAS;
-                _ContinentCodeMap["EU"] = ContinentCodeEU;
-                _ContinentCodeMap["NA"] = ContinentCodeNA;
-                _ContinentCodeMap["OC"] = ContinentCodeOC;
-                _ContinentCodeMap["SA"] = ContinentCodeSA;
-
+            case PlayFabJsonReader::Hash("AF"): if (strcmp(name, "AF") == 0) return ContinentCodeAF; break;
+            case PlayFabJsonReader::Hash("AN"): if (strcmp(name, "AN") == 0) return ContinentCodeAN; break;
+            case PlayFabJsonReader::Hash("AS"): if (strcmp(name, "AS") == 0) return ContinentCodeAS; break;
+            case PlayFabJsonReader::Hash("EU"): if (strcmp(name, "EU") == 0) return ContinentCodeEU; break;
+            case PlayFabJsonReader::Hash("NA"): if (strcmp(name, "NA") == 0) return ContinentCodeNA; break;
+            case PlayFabJsonReader::Hash("OC"): if (strcmp(name, "OC") == 0) return ContinentCodeOC; break;
+            case PlayFabJsonReader::Hash("SA"): if (strcmp(name, "SA") == 0) return ContinentCodeSA; break;
             }
 
-            auto output = _ContinentCodeMap.find(obj.GetString());
-            if (output != _ContinentCodeMap.end())
-                return output->second;
-
             return ContinentCodeAF; // Basically critical fail
         }
 
@@ -4444,265 +6819,260 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<CountryCode>(obj.GetInt());
 
-            static std::map<const char *, CountryCode, PlayFabComboSdk::StringCompare> _CountryCodeMap;
-            if (_CountryCodeMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _CountryCodeMap["AF"] = CountryCodeAF;
-                _CountryCodeMap["AX"] = CountryCodeAX;
-                _CountryCodeMap["AL"] = CountryCodeAL;
-                _CountryCodeMap["DZ"] = CountryCodeDZ;
-                _CountryCodeMap["AS"] = CountryCodeAS;
-                _CountryCodeMap["AD"] = CountryCodeAD;
-                _CountryCodeMap["AO"] = CountryCodeAO;
-                _CountryCodeMap["AI"] = CountryCodeAI;
-                _CountryCodeMap["AQ"] = CountryCodeAQ;
-                _CountryCodeMap["AG"] = CountryCodeAG;
-                _CountryCodeMap["AR"] = CountryCodeAR;
-                _CountryCodeMap["AM"] = CountryCodeAM;
-                _CountryCodeMap["AW"] = CountryCodeAW;
-                _CountryCodeMap["AU"] = CountryCodeAU;
-                _CountryCodeMap["AT"] = CountryCodeAT;
-                _CountryCodeMap["AZ"] = CountryCodeAZ;
-                _CountryCodeMap["BS"] = CountryCodeBS;
-                _CountryCodeMap["BH"] = CountryCodeBH;
-                _CountryCodeMap["BD"] = CountryCodeBD;
-                _CountryCodeMap["BB"] = CountryCodeBB;
-                _CountryCodeMap["BY"] = CountryCodeBY;
-                _CountryCodeMap["BE"] = CountryCodeBE;
-                _CountryCodeMap["BZ"] = CountryCodeBZ;
-                _CountryCodeMap["BJ"] = CountryCodeBJ;
-                _CountryCodeMap["BM"] = CountryCodeBM;
-                _CountryCodeMap["BT"] = CountryCodeBT;
-                _CountryCodeMap["BO"] = CountryCodeBO;
-                _CountryCodeMap["BQ"] = CountryCodeBQ;
-                _CountryCodeMap["BA"] = CountryCodeBA;
-                _CountryCodeMap["BW"] = CountryCodeBW;
-                _CountryCodeMap["BV"] = CountryCodeBV;
-                _CountryCodeMap["BR"] = CountryCodeBR;
-                _CountryCodeMap["IO"] = CountryCodeIO;
-                _CountryCodeMap["BN"] = CountryCodeBN;
-                _CountryCodeMap["BG"] = CountryCodeBG;
-                _CountryCodeMap["BF"] = CountryCodeBF;
-                _CountryCodeMap["BI"] = CountryCodeBI;
-                _CountryCodeMap["KH"] = CountryCodeKH;
-                _CountryCodeMap["CM"] = CountryCodeCM;
-                _CountryCodeMap["CA"] = CountryCodeCA;
-                _CountryCodeMap["CV"] = CountryCodeCV;
-                _CountryCodeMap["KY"] = CountryCodeKY;
-                _CountryCodeMap["CF"] = CountryCodeCF;
-                _CountryCodeMap["TD"] = CountryCodeTD;
-                _CountryCodeMap["CL"] = CountryCodeCL;
-                _CountryCodeMap["CN"] = CountryCodeCN;
-                _CountryCodeMap["CX"] = CountryCodeCX;
-                _CountryCodeMap["CC"] = CountryCodeCC;
-                _CountryCodeMap["CO"] = CountryCodeCO;
-                _CountryCodeMap["KM"] = CountryCodeKM;
-                _CountryCodeMap["CG"] = CountryCodeCG;
-                _CountryCodeMap["CD"] = CountryCodeCD;
-                _CountryCodeMap["CK"] = CountryCodeCK;
-                _CountryCodeMap["CR"] = CountryCodeCR;
-                _CountryCodeMap["CI"] = CountryCodeCI;
-                _CountryCodeMap["HR"] = CountryCodeHR;
-                _CountryCodeMap["CU"] = CountryCodeCU;
-                _CountryCodeMap["CW"] = CountryCodeCW;
-                _CountryCodeMap["CY"] = CountryCodeCY;
-                _CountryCodeMap["CZ"] = CountryCodeCZ;
-                _CountryCodeMap["DK"] = CountryCodeDK;
-                _CountryCodeMap["DJ"] = CountryCodeDJ;
-                _CountryCodeMap["DM"] = CountryCodeDM;
-                _CountryCodeMap["DO"] = CountryCodeDO;
-                _CountryCodeMap["EC"] = CountryCodeEC;
-                _CountryCodeMap["EG"] = CountryCodeEG;
-                _CountryCodeMap["SV"] = CountryCodeSV;
-                _CountryCodeMap["GQ"] = CountryCodeGQ;
-                _CountryCodeMap["ER"] = CountryCodeER;
-                _CountryCodeMap["EE"] = CountryCodeEE;
-                _CountryCodeMap["ET"] = CountryCodeET;
-                _CountryCodeMap["FK"] = CountryCodeFK;
-                _CountryCodeMap["FO"] = CountryCodeFO;
-                _CountryCodeMap["FJ"] = CountryCodeFJ;
-                _CountryCodeMap["FI"] = CountryCodeFI;
-                _CountryCodeMap["FR"] = CountryCodeFR;
-                _CountryCodeMap["GF"] = CountryCodeGF;
-                _CountryCodeMap["PF"] = CountryCodePF;
-                _CountryCodeMap["TF"] = CountryCodeTF;
-                _CountryCodeMap["GA"] = CountryCodeGA;
-                _CountryCodeMap["GM"] = CountryCodeGM;
-                _CountryCodeMap["GE"] = CountryCodeGE;
-                _CountryCodeMap["DE"] = CountryCodeDE;
-                _CountryCodeMap["GH"] = CountryCodeGH;
-                _CountryCodeMap["GI"] = CountryCodeGI;
-                _CountryCodeMap["GR"] = CountryCodeGR;
-                _CountryCodeMap["GL"] = CountryCodeGL;
-                _CountryCodeMap["GD"] = CountryCodeGD;
-                _CountryCodeMap["GP"] = CountryCodeGP;
-                _CountryCodeMap["GU"] = CountryCodeGU;
-                _CountryCodeMap["GT"] = CountryCodeGT;
-                _CountryCodeMap["GG"] = CountryCodeGG;
-                _CountryCodeMap["GN"] = CountryCodeGN;
-                _CountryCodeMap["GW"] = CountryCodeGW;
-                _CountryCodeMap["GY"] = CountryCodeGY;
-                _CountryCodeMap["HT"] = CountryCodeHT;
-                _CountryCodeMap["HM"] = CountryCodeHM;
-                _CountryCodeMap["VA"] = CountryCodeVA;
-                _CountryCodeMap["HN"] = CountryCodeHN;
-                _CountryCodeMap["HK"] = CountryCodeHK;
-                _CountryCodeMap["HU"] = CountryCodeHU;
-                _CountryCodeMap["IS"] = CountryCodeIS;
-                _CountryCodeMap["IN"] = CountryCodeIN;
-                _CountryCodeMap["ID"] = CountryCodeID;
-                _CountryCodeMap["IR"] = CountryCodeIR;
-                _CountryCodeMap["IQ"] = CountryCodeIQ;
-                _CountryCodeMap["IE"] = CountryCodeIE;
-                _CountryCodeMap["IM"] = CountryCodeIM;
-                _CountryCodeMap["IL"] = CountryCodeIL;
-                _CountryCodeMap["IT"] = CountryCodeIT;
-                _CountryCodeMap["JM"] = CountryCodeJM;
-                _CountryCodeMap["JP"] = CountryCodeJP;
-                _CountryCodeMap["JE"] = CountryCodeJE;
-                _CountryCodeMap["JO"] = CountryCodeJO;
-                _CountryCodeMap["KZ"] = CountryCodeKZ;
-                _CountryCodeMap["KE"] = CountryCodeKE;
-                _CountryCodeMap["KI"] = CountryCodeKI;
-                _CountryCodeMap["KP"] = CountryCodeKP;
-                _CountryCodeMap["KR"] = CountryCodeKR;
-                _CountryCodeMap["KW"] = CountryCodeKW;
-                _CountryCodeMap["KG"] = CountryCodeKG;
-                _CountryCodeMap["LA"] = CountryCodeLA;
-                _CountryCodeMap["LV"] = CountryCodeLV;
-                _CountryCodeMap["LB"] = CountryCodeLB;
-                _CountryCodeMap["LS"] = CountryCodeLS;
-                _CountryCodeMap["LR"] = CountryCodeLR;
-                _CountryCodeMap["LY"] = CountryCodeLY;
-                _CountryCodeMap["LI"] = CountryCodeLI;
-                _CountryCodeMap["LT"] = CountryCodeLT;
-                _CountryCodeMap["LU"] = CountryCodeLU;
-                _CountryCodeMap["MO"] = CountryCodeMO;
-                _CountryCodeMap["MK"] = CountryCodeMK;
-                _CountryCodeMap["MG"] = CountryCodeMG;
-                _CountryCodeMap["MW"] = CountryCodeMW;
-                _CountryCodeMap["MY"] = CountryCodeMY;
-                _CountryCodeMap["MV"] = CountryCodeMV;
-                _CountryCodeMap["ML"] = CountryCodeML;
-                _CountryCodeMap["MT"] = CountryCodeMT;
-                _CountryCodeMap["MH"] = CountryCodeMH;
-                _CountryCodeMap["MQ"] = CountryCodeMQ;
-                _CountryCodeMap["MR"] = CountryCodeMR;
-                _CountryCodeMap["MU"] = CountryCodeMU;
-                _CountryCodeMap["YT"] = CountryCodeYT;
-                _CountryCodeMap["MX"] = CountryCodeMX;
-                _CountryCodeMap["FM"] = CountryCodeFM;
-                _CountryCodeMap["MD"] = CountryCodeMD;
-                _CountryCodeMap["MC"] = CountryCodeMC;
-                _CountryCodeMap["MN"] = CountryCodeMN;
-                _CountryCodeMap["ME"] = CountryCodeME;
-                _CountryCodeMap["MS"] = CountryCodeMS;
-                _CountryCodeMap["MA"] = CountryCodeMA;
-                _CountryCodeMap["MZ"] = CountryCodeMZ;
-                _CountryCodeMap["MM"] = CountryCodeMM;
-                _CountryCodeMap["NA"] = CountryCodeNA;
-                _CountryCodeMap["NR"] = CountryCodeNR;
-                _CountryCodeMap["NP"] = CountryCodeNP;
-                _CountryCodeMap["NL"] = CountryCodeNL;
-                _CountryCodeMap["NC"] = CountryCodeNC;
-                _CountryCodeMap["NZ"] = CountryCodeNZ;
-                _CountryCodeMap["NI"] = CountryCodeNI;
-                _CountryCodeMap["NE"] = CountryCodeNE;
-                _CountryCodeMap["NG"] = CountryCodeNG;
-                _CountryCodeMap["NU"] = CountryCodeNU;
-                _CountryCodeMap["NF"] = CountryCodeNF;
-                _CountryCodeMap["MP"] = CountryCodeMP;
-                _CountryCodeMap["NO"] = CountryCodeNO;
-                _CountryCodeMap["OM"] = CountryCodeOM;
-                _CountryCodeMap["PK"] = CountryCodePK;
-                _CountryCodeMap["PW"] = CountryCodePW;
-                _CountryCodeMap["PS"] = CountryCodePS;
-                _CountryCodeMap["PA"] = CountryCodePA;
-                _CountryCodeMap["PG"] = CountryCodePG;
-                _CountryCodeMap["PY"] = CountryCodePY;
-                _CountryCodeMap["PE"] = CountryCodePE;
-                _CountryCodeMap["PH"] = CountryCodePH;
-                _CountryCodeMap["PN"] = CountryCodePN;
-                _CountryCodeMap["PL"] = CountryCodePL;
-                _CountryCodeMap["PT"] = CountryCodePT;
-                _CountryCodeMap["PR"] = CountryCodePR;
-                _CountryCodeMap["QA"] = CountryCodeQA;
-                _CountryCodeMap["RE"] = CountryCodeRE;
-                _CountryCodeMap["RO"] = CountryCodeRO;
-                _CountryCodeMap["RU"] = CountryCodeRU;
-                _CountryCodeMap["RW"] = CountryCodeRW;
-                _CountryCodeMap["BL"] = CountryCodeBL;
-                _CountryCodeMap["SH"] = CountryCodeSH;
-                _CountryCodeMap["KN"] = CountryCodeKN;
-                _CountryCodeMap["LC"] = CountryCodeLC;
-                _CountryCodeMap["MF"] = CountryCodeMF;
-                _CountryCodeMap["PM"] = CountryCodePM;
-                _CountryCodeMap["VC"] = CountryCodeVC;
-                _CountryCodeMap["WS"] = CountryCodeWS;
-                _CountryCodeMap["SM"] = CountryCodeSM;
-                _CountryCodeMap["ST"] = CountryCodeST;
-                _CountryCodeMap["SA"] = CountryCodeSA;
-                _CountryCodeMap["SN"] = CountryCodeSN;
-                _CountryCodeMap["RS"] = CountryCodeRS;
-                _CountryCodeMap["SC"] = CountryCodeSC;
-                _CountryCodeMap["SL"] = CountryCodeSL;
-                _CountryCodeMap["SG"] = CountryCodeSG;
-                _CountryCodeMap["SX"] = CountryCodeSX;
-                _CountryCodeMap["SK"] = CountryCodeSK;
-                _CountryCodeMap["SI"] = CountryCodeSI;
-                _CountryCodeMap["SB"] = CountryCodeSB;
-                _CountryCodeMap["SO"] = CountryCodeSO;
-                _CountryCodeMap["ZA"] = CountryCodeZA;
-                _CountryCodeMap["GS"] = CountryCodeGS;
-                _CountryCodeMap["SS"] = CountryCodeSS;
-                _CountryCodeMap["ES"] = CountryCodeES;
-                _CountryCodeMap["LK"] = CountryCodeLK;
-                _CountryCodeMap["SD"] = CountryCodeSD;
-                _CountryCodeMap["SR"] = CountryCodeSR;
-                _CountryCodeMap["SJ"] = CountryCodeSJ;
-                _CountryCodeMap["SZ"] = CountryCodeSZ;
-                _CountryCodeMap["SE"] = CountryCodeSE;
-                _CountryCodeMap["CH"] = CountryCodeCH;
-                _CountryCodeMap["SY"] = CountryCodeSY;
-                _CountryCodeMap["TW"] = CountryCodeTW;
-                _CountryCodeMap["TJ"] = CountryCodeTJ;
-                _CountryCodeMap["TZ"] = CountryCodeTZ;
-                _CountryCodeMap["TH"] = CountryCodeTH;
-                _CountryCodeMap["TL"] = CountryCodeTL;
-                _CountryCodeMap["TG"] = CountryCodeTG;
-                _CountryCodeMap["TK"] = CountryCodeTK;
-                _CountryCodeMap["TO"] = CountryCodeTO;
-                _CountryCodeMap["TT"] = CountryCodeTT;
-                _CountryCodeMap["TN"] = CountryCodeTN;
-                _CountryCodeMap["TR"] = CountryCodeTR;
-                _CountryCodeMap["TM"] = CountryCodeTM;
-                _CountryCodeMap["TC"] = CountryCodeTC;
-                _CountryCodeMap["TV"] = CountryCodeTV;
-                _CountryCodeMap["UG"] = CountryCodeUG;
-                _CountryCodeMap["UA"] = CountryCodeUA;
-                _CountryCodeMap["AE"] = CountryCodeAE;
-                _CountryCodeMap["GB"] = CountryCodeGB;
-                _CountryCodeMap["US"] = CountryCodeUS;
-                _CountryCodeMap["UM"] = CountryCodeUM;
-                _CountryCodeMap["UY"] = CountryCodeUY;
-                _CountryCodeMap["UZ"] = CountryCodeUZ;
-                _CountryCodeMap["VU"] = CountryCodeVU;
-                _CountryCodeMap["VE"] = CountryCodeVE;
-                _CountryCodeMap["VN"] = CountryCodeVN;
-                _CountryCodeMap["VG"] = CountryCodeVG;
-                _CountryCodeMap["VI"] = CountryCodeVI;
-                _CountryCodeMap["WF"] = CountryCodeWF;
-                _CountryCodeMap["EH"] = CountryCodeEH;
-                _CountryCodeMap["YE"] = CountryCodeYE;
-                _CountryCodeMap["ZM"] = CountryCodeZM;
-                _CountryCodeMap["ZW"] = CountryCodeZW;
-
-            }
-
-            auto output = _CountryCodeMap.find(obj.GetString());
-            if (output != _CountryCodeMap.end())
-                return output->second;
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("AF"): if (strcmp(name, "AF") == 0) return CountryCodeAF; break;
+            case PlayFabJsonReader::Hash("AX"): if (strcmp(name, "AX") == 0) return CountryCodeAX; break;
+            case PlayFabJsonReader::Hash("AL"): if (strcmp(name, "AL") == 0) return CountryCodeAL; break;
+            case PlayFabJsonReader::Hash("DZ"): if (strcmp(name, "DZ") == 0) return CountryCodeDZ; break;
+            case PlayFabJsonReader::Hash("AS"): if (strcmp(name, "AS") == 0) return CountryCodeAS; break;
+            case PlayFabJsonReader::Hash("AD"): if (strcmp(name, "AD") == 0) return CountryCodeAD; break;
+            case PlayFabJsonReader::Hash("AO"): if (strcmp(name, "AO") == 0) return CountryCodeAO; break;
+            case PlayFabJsonReader::Hash("AI"): if (strcmp(name, "AI") == 0) return CountryCodeAI; break;
+            case PlayFabJsonReader::Hash("AQ"): if (strcmp(name, "AQ") == 0) return CountryCodeAQ; break;
+            case PlayFabJsonReader::Hash("AG"): if (strcmp(name, "AG") == 0) return CountryCodeAG; break;
+            case PlayFabJsonReader::Hash("AR"): if (strcmp(name, "AR") == 0) return CountryCodeAR; break;
+            case PlayFabJsonReader::Hash("AM"): if (strcmp(name, "AM") == 0) return CountryCodeAM; break;
+            case PlayFabJsonReader::Hash("AW"): if (strcmp(name, "AW") == 0) return CountryCodeAW; break;
+            case PlayFabJsonReader::Hash("AU"): if (strcmp(name, "AU") == 0) return CountryCodeAU; break;
+            case PlayFabJsonReader::Hash("AT"): if (strcmp(name, "AT") == 0) return CountryCodeAT; break;
+            case PlayFabJsonReader::Hash("AZ"): if (strcmp(name, "AZ") == 0) return CountryCodeAZ; break;
+            case PlayFabJsonReader::Hash("BS"): if (strcmp(name, "BS") == 0) return CountryCodeBS; break;
+            case PlayFabJsonReader::Hash("BH"): if (strcmp(name, "BH") == 0) return CountryCodeBH; break;
+            case PlayFabJsonReader::Hash("BD"): if (strcmp(name, "BD") == 0) return CountryCodeBD; break;
+            case PlayFabJsonReader::Hash("BB"): if (strcmp(name, "BB") == 0) return CountryCodeBB; break;
+            case PlayFabJsonReader::Hash("BY"): if (strcmp(name, "BY") == 0) return CountryCodeBY; break;
+            case PlayFabJsonReader::Hash("BE"): if (strcmp(name, "BE") == 0) return CountryCodeBE; break;
+            case PlayFabJsonReader::Hash("BZ"): if (strcmp(name, "BZ") == 0) return CountryCodeBZ; break;
+            case PlayFabJsonReader::Hash("BJ"): if (strcmp(name, "BJ") == 0) return CountryCodeBJ; break;
+            case PlayFabJsonReader::Hash("BM"): if (strcmp(name, "BM") == 0) return CountryCodeBM; break;
+            case PlayFabJsonReader::Hash("BT"): if (strcmp(name, "BT") == 0) return CountryCodeBT; break;
+            case PlayFabJsonReader::Hash("BO"): if (strcmp(name, "BO") == 0) return CountryCodeBO; break;
+            case PlayFabJsonReader::Hash("BQ"): if (strcmp(name, "BQ") == 0) return CountryCodeBQ; break;
+            case PlayFabJsonReader::Hash("BA"): if (strcmp(name, "BA") == 0) return CountryCodeBA; break;
+            case PlayFabJsonReader::Hash("BW"): if (strcmp(name, "BW") == 0) return CountryCodeBW; break;
+            case PlayFabJsonReader::Hash("BV"): if (strcmp(name, "BV") == 0) return CountryCodeBV; break;
+            case PlayFabJsonReader::Hash("BR"): if (strcmp(name, "BR") == 0) return CountryCodeBR; break;
+            case PlayFabJsonReader::Hash("IO"): if (strcmp(name, "IO") == 0) return CountryCodeIO; break;
+            case PlayFabJsonReader::Hash("BN"): if (strcmp(name, "BN") == 0) return CountryCodeBN; break;
+            case PlayFabJsonReader::Hash("BG"): if (strcmp(name, "BG") == 0) return CountryCodeBG; break;
+            case PlayFabJsonReader::Hash("BF"): if (strcmp(name, "BF") == 0) return CountryCodeBF; break;
+            case PlayFabJsonReader::Hash("BI"): if (strcmp(name, "BI") == 0) return CountryCodeBI; break;
+            case PlayFabJsonReader::Hash("KH"): if (strcmp(name, "KH") == 0) return CountryCodeKH; break;
+            case PlayFabJsonReader::Hash("CM"): if (strcmp(name, "CM") == 0) return CountryCodeCM; break;
+            case PlayFabJsonReader::Hash("CA"): if (strcmp(name, "CA") == 0) return CountryCodeCA; break;
+            case PlayFabJsonReader::Hash("CV"): if (strcmp(name, "CV") == 0) return CountryCodeCV; break;
+            case PlayFabJsonReader::Hash("KY"): if (strcmp(name, "KY") == 0) return CountryCodeKY; break;
+            case PlayFabJsonReader::Hash("CF"): if (strcmp(name, "CF") == 0) return CountryCodeCF; break;
+            case PlayFabJsonReader::Hash("TD"): if (strcmp(name, "TD") == 0) return CountryCodeTD; break;
+            case PlayFabJsonReader::Hash("CL"): if (strcmp(name, "CL") == 0) return CountryCodeCL; break;
+            case PlayFabJsonReader::Hash("CN"): if (strcmp(name, "CN") == 0) return CountryCodeCN; break;
+            case PlayFabJsonReader::Hash("CX"): if (strcmp(name, "CX") == 0) return CountryCodeCX; break;
+            case PlayFabJsonReader::Hash("CC"): if (strcmp(name, "CC") == 0) return CountryCodeCC; break;
+            case PlayFabJsonReader::Hash("CO"): if (strcmp(name, "CO") == 0) return CountryCodeCO; break;
+            case PlayFabJsonReader::Hash("KM"): if (strcmp(name, "KM") == 0) return CountryCodeKM; break;
+            case PlayFabJsonReader::Hash("CG"): if (strcmp(name, "CG") == 0) return CountryCodeCG; break;
+            case PlayFabJsonReader::Hash("CD"): if (strcmp(name, "CD") == 0) return CountryCodeCD; break;
+            case PlayFabJsonReader::Hash("CK"): if (strcmp(name, "CK") == 0) return CountryCodeCK; break;
+            case PlayFabJsonReader::Hash("CR"): if (strcmp(name, "CR") == 0) return CountryCodeCR; break;
+            case PlayFabJsonReader::Hash("CI"): if (strcmp(name, "CI") == 0) return CountryCodeCI; break;
+            case PlayFabJsonReader::Hash("HR"): if (strcmp(name, "HR") == 0) return CountryCodeHR; break;
+            case PlayFabJsonReader::Hash("CU"): if (strcmp(name, "CU") == 0) return CountryCodeCU; break;
+            case PlayFabJsonReader::Hash("CW"): if (strcmp(name, "CW") == 0) return CountryCodeCW; break;
+            case PlayFabJsonReader::Hash("CY"): if (strcmp(name, "CY") == 0) return CountryCodeCY; break;
+            case PlayFabJsonReader::Hash("CZ"): if (strcmp(name, "CZ") == 0) return CountryCodeCZ; break;
+            case PlayFabJsonReader::Hash("DK"): if (strcmp(name, "DK") == 0) return CountryCodeDK; break;
+            case PlayFabJsonReader::Hash("DJ"): if (strcmp(name, "DJ") == 0) return CountryCodeDJ; break;
+            case PlayFabJsonReader::Hash("DM"): if (strcmp(name, "DM") == 0) return CountryCodeDM; break;
+            case PlayFabJsonReader::Hash("DO"): if (strcmp(name, "DO") == 0) return CountryCodeDO; break;
+            case PlayFabJsonReader::Hash("EC"): if (strcmp(name, "EC") == 0) return CountryCodeEC; break;
+            case PlayFabJsonReader::Hash("EG"): if (strcmp(name, "EG") == 0) return CountryCodeEG; break;
+            case PlayFabJsonReader::Hash("SV"): if (strcmp(name, "SV") == 0) return CountryCodeSV; break;
+            case PlayFabJsonReader::Hash("GQ"): if (strcmp(name, "GQ") == 0) return CountryCodeGQ; break;
+            case PlayFabJsonReader::Hash("ER"): if (strcmp(name, "ER") == 0) return CountryCodeER; break;
+            case PlayFabJsonReader::Hash("EE"): if (strcmp(name, "EE") == 0) return CountryCodeEE; break;
+            case PlayFabJsonReader::Hash("ET"): if (strcmp(name, "ET") == 0) return CountryCodeET; break;
+            case PlayFabJsonReader::Hash("FK"): if (strcmp(name, "FK") == 0) return CountryCodeFK; break;
+            case PlayFabJsonReader::Hash("FO"): if (strcmp(name, "FO") == 0) return CountryCodeFO; break;
+            case PlayFabJsonReader::Hash("FJ"): if (strcmp(name, "FJ") == 0) return CountryCodeFJ; break;
+            case PlayFabJsonReader::Hash("FI"): if (strcmp(name, "FI") == 0) return CountryCodeFI; break;
+            case PlayFabJsonReader::Hash("FR"): if (strcmp(name, "FR") == 0) return CountryCodeFR; break;
+            case PlayFabJsonReader::Hash("GF"): if (strcmp(name, "GF") == 0) return CountryCodeGF; break;
+            case PlayFabJsonReader::Hash("PF"): if (strcmp(name, "PF") == 0) return CountryCodePF; break;
+            case PlayFabJsonReader::Hash("TF"): if (strcmp(name, "TF") == 0) return CountryCodeTF; break;
+            case PlayFabJsonReader::Hash("GA"): if (strcmp(name, "GA") == 0) return CountryCodeGA; break;
+            case PlayFabJsonReader::Hash("GM"): if (strcmp(name, "GM") == 0) return CountryCodeGM; break;
+            case PlayFabJsonReader::Hash("GE"): if (strcmp(name, "GE") == 0) return CountryCodeGE; break;
+            case PlayFabJsonReader::Hash("DE"): if (strcmp(name, "DE") == 0) return CountryCodeDE; break;
+            case PlayFabJsonReader::Hash("GH"): if (strcmp(name, "GH") == 0) return CountryCodeGH; break;
+            case PlayFabJsonReader::Hash("GI"): if (strcmp(name, "GI") == 0) return CountryCodeGI; break;
+            case PlayFabJsonReader::Hash("GR"): if (strcmp(name, "GR") == 0) return CountryCodeGR; break;
+            case PlayFabJsonReader::Hash("GL"): if (strcmp(name, "GL") == 0) return CountryCodeGL; break;
+            case PlayFabJsonReader::Hash("GD"): if (strcmp(name, "GD") == 0) return CountryCodeGD; break;
+            case PlayFabJsonReader::Hash("GP"): if (strcmp(name, "GP") == 0) return CountryCodeGP; break;
+            case PlayFabJsonReader::Hash("GU"): if (strcmp(name, "GU") == 0) return CountryCodeGU; break;
+            case PlayFabJsonReader::Hash("GT"): if (strcmp(name, "GT") == 0) return CountryCodeGT; break;
+            case PlayFabJsonReader::Hash("GG"): if (strcmp(name, "GG") == 0) return CountryCodeGG; break;
+            case PlayFabJsonReader::Hash("GN"): if (strcmp(name, "GN") == 0) return CountryCodeGN; break;
+            case PlayFabJsonReader::Hash("GW"): if (strcmp(name, "GW") == 0) return CountryCodeGW; break;
+            case PlayFabJsonReader::Hash("GY"): if (strcmp(name, "GY") == 0) return CountryCodeGY; break;
+            case PlayFabJsonReader::Hash("HT"): if (strcmp(name, "HT") == 0) return CountryCodeHT; break;
+            case PlayFabJsonReader::Hash("HM"): if (strcmp(name, "HM") == 0) return CountryCodeHM; break;
+            case PlayFabJsonReader::Hash("VA"): if (strcmp(name, "VA") == 0) return CountryCodeVA; break;
+            case PlayFabJsonReader::Hash("HN"): if (strcmp(name, "HN") == 0) return CountryCodeHN; break;
+            case PlayFabJsonReader::Hash("HK"): if (strcmp(name, "HK") == 0) return CountryCodeHK; break;
+            case PlayFabJsonReader::Hash("HU"): if (strcmp(name, "HU") == 0) return CountryCodeHU; break;
+            case PlayFabJsonReader::Hash("IS"): if (strcmp(name, "IS") == 0) return CountryCodeIS; break;
+            case PlayFabJsonReader::Hash("IN"): if (strcmp(name, "IN") == 0) return CountryCodeIN; break;
+            case PlayFabJsonReader::Hash("ID"): if (strcmp(name, "ID") == 0) return CountryCodeID; break;
+            case PlayFabJsonReader::Hash("IR"): if (strcmp(name, "IR") == 0) return CountryCodeIR; break;
+            case PlayFabJsonReader::Hash("IQ"): if (strcmp(name, "IQ") == 0) return CountryCodeIQ; break;
+            case PlayFabJsonReader::Hash("IE"): if (strcmp(name, "IE") == 0) return CountryCodeIE; break;
+            case PlayFabJsonReader::Hash("IM"): if (strcmp(name, "IM") == 0) return CountryCodeIM; break;
+            case PlayFabJsonReader::Hash("IL"): if (strcmp(name, "IL") == 0) return CountryCodeIL; break;
+            case PlayFabJsonReader::Hash("IT"): if (strcmp(name, "IT") == 0) return CountryCodeIT; break;
+            case PlayFabJsonReader::Hash("JM"): if (strcmp(name, "JM") == 0) return CountryCodeJM; break;
+            case PlayFabJsonReader::Hash("JP"): if (strcmp(name, "JP") == 0) return CountryCodeJP; break;
+            case PlayFabJsonReader::Hash("JE"): if (strcmp(name, "JE") == 0) return CountryCodeJE; break;
+            case PlayFabJsonReader::Hash("JO"): if (strcmp(name, "JO") == 0) return CountryCodeJO; break;
+            case PlayFabJsonReader::Hash("KZ"): if (strcmp(name, "KZ") == 0) return CountryCodeKZ; break;
+            case PlayFabJsonReader::Hash("KE"): if (strcmp(name, "KE") == 0) return CountryCodeKE; break;
+            case PlayFabJsonReader::Hash("KI"): if (strcmp(name, "KI") == 0) return CountryCodeKI; break;
+            case PlayFabJsonReader::Hash("KP"): if (strcmp(name, "KP") == 0) return CountryCodeKP; break;
+            case PlayFabJsonReader::Hash("KR"): if (strcmp(name, "KR") == 0) return CountryCodeKR; break;
+            case PlayFabJsonReader::Hash("KW"): if (strcmp(name, "KW") == 0) return CountryCodeKW; break;
+            case PlayFabJsonReader::Hash("KG"): if (strcmp(name, "KG") == 0) return CountryCodeKG; break;
+            case PlayFabJsonReader::Hash("LA"): if (strcmp(name, "LA") == 0) return CountryCodeLA; break;
+            case PlayFabJsonReader::Hash("LV"): if (strcmp(name, "LV") == 0) return CountryCodeLV; break;
+            case PlayFabJsonReader::Hash("LB"): if (strcmp(name, "LB") == 0) return CountryCodeLB; break;
+            case PlayFabJsonReader::Hash("LS"): if (strcmp(name, "LS") == 0) return CountryCodeLS; break;
+            case PlayFabJsonReader::Hash("LR"): if (strcmp(name, "LR") == 0) return CountryCodeLR; break;
+            case PlayFabJsonReader::Hash("LY"): if (strcmp(name, "LY") == 0) return CountryCodeLY; break;
+            case PlayFabJsonReader::Hash("LI"): if (strcmp(name, "LI") == 0) return CountryCodeLI; break;
+            case PlayFabJsonReader::Hash("LT"): if (strcmp(name, "LT") == 0) return CountryCodeLT; break;
+            case PlayFabJsonReader::Hash("LU"): if (strcmp(name, "LU") == 0) return CountryCodeLU; break;
+            case PlayFabJsonReader::Hash("MO"): if (strcmp(name, "MO") == 0) return CountryCodeMO; break;
+            case PlayFabJsonReader::Hash("MK"): if (strcmp(name, "MK") == 0) return CountryCodeMK; break;
+            case PlayFabJsonReader::Hash("MG"): if (strcmp(name, "MG") == 0) return CountryCodeMG; break;
+            case PlayFabJsonReader::Hash("MW"): if (strcmp(name, "MW") == 0) return CountryCodeMW; break;
+            case PlayFabJsonReader::Hash("MY"): if (strcmp(name, "MY") == 0) return CountryCodeMY; break;
+            case PlayFabJsonReader::Hash("MV"): if (strcmp(name, "MV") == 0) return CountryCodeMV; break;
+            case PlayFabJsonReader::Hash("ML"): if (strcmp(name, "ML") == 0) return CountryCodeML; break;
+            case PlayFabJsonReader::Hash("MT"): if (strcmp(name, "MT") == 0) return CountryCodeMT; break;
+            case PlayFabJsonReader::Hash("MH"): if (strcmp(name, "MH") == 0) return CountryCodeMH; break;
+            case PlayFabJsonReader::Hash("MQ"): if (strcmp(name, "MQ") == 0) return CountryCodeMQ; break;
+            case PlayFabJsonReader::Hash("MR"): if (strcmp(name, "MR") == 0) return CountryCodeMR; break;
+            case PlayFabJsonReader::Hash("MU"): if (strcmp(name, "MU") == 0) return CountryCodeMU; break;
+            case PlayFabJsonReader::Hash("YT"): if (strcmp(name, "YT") == 0) return CountryCodeYT; break;
+            case PlayFabJsonReader::Hash("MX"): if (strcmp(name, "MX") == 0) return CountryCodeMX; break;
+            case PlayFabJsonReader::Hash("FM"): if (strcmp(name, "FM") == 0) return CountryCodeFM; break;
+            case PlayFabJsonReader::Hash("MD"): if (strcmp(name, "MD") == 0) return CountryCodeMD; break;
+            case PlayFabJsonReader::Hash("MC"): if (strcmp(name, "MC") == 0) return CountryCodeMC; break;
+            case PlayFabJsonReader::Hash("MN"): if (strcmp(name, "MN") == 0) return CountryCodeMN; break;
+            case PlayFabJsonReader::Hash("ME"): if (strcmp(name, "ME") == 0) return CountryCodeME; break;
+            case PlayFabJsonReader::Hash("MS"): if (strcmp(name, "MS") == 0) return CountryCodeMS; break;
+            case PlayFabJsonReader::Hash("MA"): if (strcmp(name, "MA") == 0) return CountryCodeMA; break;
+            case PlayFabJsonReader::Hash("MZ"): if (strcmp(name, "MZ") == 0) return CountryCodeMZ; break;
+            case PlayFabJsonReader::Hash("MM"): if (strcmp(name, "MM") == 0) return CountryCodeMM; break;
+            case PlayFabJsonReader::Hash("NA"): if (strcmp(name, "NA") == 0) return CountryCodeNA; break;
+            case PlayFabJsonReader::Hash("NR"): if (strcmp(name, "NR") == 0) return CountryCodeNR; break;
+            case PlayFabJsonReader::Hash("NP"): if (strcmp(name, "NP") == 0) return CountryCodeNP; break;
+            case PlayFabJsonReader::Hash("NL"): if (strcmp(name, "NL") == 0) return CountryCodeNL; break;
+            case PlayFabJsonReader::Hash("NC"): if (strcmp(name, "NC") == 0) return CountryCodeNC; break;
+            case PlayFabJsonReader::Hash("NZ"): if (strcmp(name, "NZ") == 0) return CountryCodeNZ; break;
+            case PlayFabJsonReader::Hash("NI"): if (strcmp(name, "NI") == 0) return CountryCodeNI; break;
+            case PlayFabJsonReader::Hash("NE"): if (strcmp(name, "NE") == 0) return CountryCodeNE; break;
+            case PlayFabJsonReader::Hash("NG"): if (strcmp(name, "NG") == 0) return CountryCodeNG; break;
+            case PlayFabJsonReader::Hash("NU"): if (strcmp(name, "NU") == 0) return CountryCodeNU; break;
+            case PlayFabJsonReader::Hash("NF"): if (strcmp(name, "NF") == 0) return CountryCodeNF; break;
+            case PlayFabJsonReader::Hash("MP"): if (strcmp(name, "MP") == 0) return CountryCodeMP; break;
+            case PlayFabJsonReader::Hash("NO"): if (strcmp(name, "NO") == 0) return CountryCodeNO; break;
+            case PlayFabJsonReader::Hash("OM"): if (strcmp(name, "OM") == 0) return CountryCodeOM; break;
+            case PlayFabJsonReader::Hash("PK"): if (strcmp(name, "PK") == 0) return CountryCodePK; break;
+            case PlayFabJsonReader::Hash("PW"): if (strcmp(name, "PW") == 0) return CountryCodePW; break;
+            case PlayFabJsonReader::Hash("PS"): if (strcmp(name, "PS") == 0) return CountryCodePS; break;
+            case PlayFabJsonReader::Hash("PA"): if (strcmp(name, "PA") == 0) return CountryCodePA; break;
+            case PlayFabJsonReader::Hash("PG"): if (strcmp(name, "PG") == 0) return CountryCodePG; break;
+            case PlayFabJsonReader::Hash("PY"): if (strcmp(name, "PY") == 0) return CountryCodePY; break;
+            case PlayFabJsonReader::Hash("PE"): if (strcmp(name, "PE") == 0) return CountryCodePE; break;
+            case PlayFabJsonReader::Hash("PH"): if (strcmp(name, "PH") == 0) return CountryCodePH; break;
+            case PlayFabJsonReader::Hash("PN"): if (strcmp(name, "PN") == 0) return CountryCodePN; break;
+            case PlayFabJsonReader::Hash("PL"): if (strcmp(name, "PL") == 0) return CountryCodePL; break;
+            case PlayFabJsonReader::Hash("PT"): if (strcmp(name, "PT") == 0) return CountryCodePT; break;
+            case PlayFabJsonReader::Hash("PR"): if (strcmp(name, "PR") == 0) return CountryCodePR; break;
+            case PlayFabJsonReader::Hash("QA"): if (strcmp(name, "QA") == 0) return CountryCodeQA; break;
+            case PlayFabJsonReader::Hash("RE"): if (strcmp(name, "RE") == 0) return CountryCodeRE; break;
+            case PlayFabJsonReader::Hash("RO"): if (strcmp(name, "RO") == 0) return CountryCodeRO; break;
+            case PlayFabJsonReader::Hash("RU"): if (strcmp(name, "RU") == 0) return CountryCodeRU; break;
+            case PlayFabJsonReader::Hash("RW"): if (strcmp(name, "RW") == 0) return CountryCodeRW; break;
+            case PlayFabJsonReader::Hash("BL"): if (strcmp(name, "BL") == 0) return CountryCodeBL; break;
+            case PlayFabJsonReader::Hash("SH"): if (strcmp(name, "SH") == 0) return CountryCodeSH; break;
+            case PlayFabJsonReader::Hash("KN"): if (strcmp(name, "KN") == 0) return CountryCodeKN; break;
+            case PlayFabJsonReader::Hash("LC"): if (strcmp(name, "LC") == 0) return CountryCodeLC; break;
+            case PlayFabJsonReader::Hash("MF"): if (strcmp(name, "MF") == 0) return CountryCodeMF; break;
+            case PlayFabJsonReader::Hash("PM"): if (strcmp(name, "PM") == 0) return CountryCodePM; break;
+            case PlayFabJsonReader::Hash("VC"): if (strcmp(name, "VC") == 0) return CountryCodeVC; break;
+            case PlayFabJsonReader::Hash("WS"): if (strcmp(name, "WS") == 0) return CountryCodeWS; break;
+            case PlayFabJsonReader::Hash("SM"): if (strcmp(name, "SM") == 0) return CountryCodeSM; break;
+            case PlayFabJsonReader::Hash("ST"): if (strcmp(name, "ST") == 0) return CountryCodeST; break;
+            case PlayFabJsonReader::Hash("SA"): if (strcmp(name, "SA") == 0) return CountryCodeSA; break;
+            case PlayFabJsonReader::Hash("SN"): if (strcmp(name, "SN") == 0) return CountryCodeSN; break;
+            case PlayFabJsonReader::Hash("RS"): if (strcmp(name, "RS") == 0) return CountryCodeRS; break;
+            case PlayFabJsonReader::Hash("SC"): if (strcmp(name, "SC") == 0) return CountryCodeSC; break;
+            case PlayFabJsonReader::Hash("SL"): if (strcmp(name, "SL") == 0) return CountryCodeSL; break;
+            case PlayFabJsonReader::Hash("SG"): if (strcmp(name, "SG") == 0) return CountryCodeSG; break;
+            case PlayFabJsonReader::Hash("SX"): if (strcmp(name, "SX") == 0) return CountryCodeSX; break;
+            case PlayFabJsonReader::Hash("SK"): if (strcmp(name, "SK") == 0) return CountryCodeSK; break;
+            case PlayFabJsonReader::Hash("SI"): if (strcmp(name, "SI") == 0) return CountryCodeSI; break;
+            case PlayFabJsonReader::Hash("SB"): if (strcmp(name, "SB") == 0) return CountryCodeSB; break;
+            case PlayFabJsonReader::Hash("SO"): if (strcmp(name, "SO") == 0) return CountryCodeSO; break;
+            case PlayFabJsonReader::Hash("ZA"): if (strcmp(name, "ZA") == 0) return CountryCodeZA; break;
+            case PlayFabJsonReader::Hash("GS"): if (strcmp(name, "GS") == 0) return CountryCodeGS; break;
+            case PlayFabJsonReader::Hash("SS"): if (strcmp(name, "SS") == 0) return CountryCodeSS; break;
+            case PlayFabJsonReader::Hash("ES"): if (strcmp(name, "ES") == 0) return CountryCodeES; break;
+            case PlayFabJsonReader::Hash("LK"): if (strcmp(name, "LK") == 0) return CountryCodeLK; break;
+            case PlayFabJsonReader::Hash("SD"): if (strcmp(name, "SD") == 0) return CountryCodeSD; break;
+            case PlayFabJsonReader::Hash("SR"): if (strcmp(name, "SR") == 0) return CountryCodeSR; break;
+            case PlayFabJsonReader::Hash("SJ"): if (strcmp(name, "SJ") == 0) return CountryCodeSJ; break;
+            case PlayFabJsonReader::Hash("SZ"): if (strcmp(name, "SZ") == 0) return CountryCodeSZ; break;
+            case PlayFabJsonReader::Hash("SE"): if (strcmp(name, "SE") == 0) return CountryCodeSE; break;
+            case PlayFabJsonReader::Hash("CH"): if (strcmp(name, "CH") == 0) return CountryCodeCH; break;
+            case PlayFabJsonReader::Hash("SY"): if (strcmp(name, "SY") == 0) return CountryCodeSY; break;
+            case PlayFabJsonReader::Hash("TW"): if (strcmp(name, "TW") == 0) return CountryCodeTW; break;
+            case PlayFabJsonReader::Hash("TJ"): if (strcmp(name, "TJ") == 0) return CountryCodeTJ; break;
+            case PlayFabJsonReader::Hash("TZ"): if (strcmp(name, "TZ") == 0) return CountryCodeTZ; break;
+            case PlayFabJsonReader::Hash("TH"): if (strcmp(name, "TH") == 0) return CountryCodeTH; break;
+            case PlayFabJsonReader::Hash("TL"): if (strcmp(name, "TL") == 0) return CountryCodeTL; break;
+            case PlayFabJsonReader::Hash("TG"): if (strcmp(name, "TG") == 0) return CountryCodeTG; break;
+            case PlayFabJsonReader::Hash("TK"): if (strcmp(name, "TK") == 0) return CountryCodeTK; break;
+            case PlayFabJsonReader::Hash("TO"): if (strcmp(name, "TO") == 0) return CountryCodeTO; break;
+            case PlayFabJsonReader::Hash("TT"): if (strcmp(name, "TT") == 0) return CountryCodeTT; break;
+            case PlayFabJsonReader::Hash("TN"): if (strcmp(name, "TN") == 0) return CountryCodeTN; break;
+            case PlayFabJsonReader::Hash("TR"): if (strcmp(name, "TR") == 0) return CountryCodeTR; break;
+            case PlayFabJsonReader::Hash("TM"): if (strcmp(name, "TM") == 0) return CountryCodeTM; break;
+            case PlayFabJsonReader::Hash("TC"): if (strcmp(name, "TC") == 0) return CountryCodeTC; break;
+            case PlayFabJsonReader::Hash("TV"): if (strcmp(name, "TV") == 0) return CountryCodeTV; break;
+            case PlayFabJsonReader::Hash("UG"): if (strcmp(name, "UG") == 0) return CountryCodeUG; break;
+            case PlayFabJsonReader::Hash("UA"): if (strcmp(name, "UA") == 0) return CountryCodeUA; break;
+            case PlayFabJsonReader::Hash("AE"): if (strcmp(name, "AE") == 0) return CountryCodeAE; break;
+            case PlayFabJsonReader::Hash("GB"): if (strcmp(name, "GB") == 0) return CountryCodeGB; break;
+            case PlayFabJsonReader::Hash("US"): if (strcmp(name, "US") == 0) return CountryCodeUS; break;
+            case PlayFabJsonReader::Hash("UM"): if (strcmp(name, "UM") == 0) return CountryCodeUM; break;
+            case PlayFabJsonReader::Hash("UY"): if (strcmp(name, "UY") == 0) return CountryCodeUY; break;
+            case PlayFabJsonReader::Hash("UZ"): if (strcmp(name, "UZ") == 0) return CountryCodeUZ; break;
+            case PlayFabJsonReader::Hash("VU"): if (strcmp(name, "VU") == 0) return CountryCodeVU; break;
+            case PlayFabJsonReader::Hash("VE"): if (strcmp(name, "VE") == 0) return CountryCodeVE; break;
+            case PlayFabJsonReader::Hash("VN"): if (strcmp(name, "VN") == 0) return CountryCodeVN; break;
+            case PlayFabJsonReader::Hash("VG"): if (strcmp(name, "VG") == 0) return CountryCodeVG; break;
+            case PlayFabJsonReader::Hash("VI"): if (strcmp(name, "VI") == 0) return CountryCodeVI; break;
+            case PlayFabJsonReader::Hash("WF"): if (strcmp(name, "WF") == 0) return CountryCodeWF; break;
+            case PlayFabJsonReader::Hash("EH"): if (strcmp(name, "EH") == 0) return CountryCodeEH; break;
+            case PlayFabJsonReader::Hash("YE"): if (strcmp(name, "YE") == 0) return CountryCodeYE; break;
+            case PlayFabJsonReader::Hash("ZM"): if (strcmp(name, "ZM") == 0) return CountryCodeZM; break;
+            case PlayFabJsonReader::Hash("ZW"): if (strcmp(name, "ZW") == 0) return CountryCodeZW; break;
+            }
 
             return CountryCodeAF; // Basically critical fail
         }
@@ -4721,6 +7091,14 @@ namespace PlayFabComboSdk
                 SharedGroupId(src.SharedGroupId)
             {}
 
+            CreateSharedGroupRequest(CreateSharedGroupRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId))
+            {}
+
+            CreateSharedGroupRequest& operator=(const CreateSharedGroupRequest& src) = default;
+            CreateSharedGroupRequest& operator=(CreateSharedGroupRequest&& src) = default;
+
             CreateSharedGroupRequest(const rapidjson::Value& obj) : CreateSharedGroupRequest()
             {
                 readFromValue(obj);
@@ -4747,6 +7125,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct CreateSharedGroupResult : public PlayFabBaseModel
@@ -4763,6 +7164,14 @@ namespace PlayFabComboSdk
                 SharedGroupId(src.SharedGroupId)
             {}
 
+            CreateSharedGroupResult(CreateSharedGroupResult&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId))
+            {}
+
+            CreateSharedGroupResult& operator=(const CreateSharedGroupResult& src) = default;
+            CreateSharedGroupResult& operator=(CreateSharedGroupResult&& src) = default;
+
             CreateSharedGroupResult(const rapidjson::Value& obj) : CreateSharedGroupResult()
             {
                 readFromValue(obj);
@@ -4789,6 +7198,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteCharacterFromUserRequest : public PlayFabBaseModel
@@ -4811,6 +7243,16 @@ namespace PlayFabComboSdk
                 SaveCharacterInventory(src.SaveCharacterInventory)
             {}
 
+            DeleteCharacterFromUserRequest(DeleteCharacterFromUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                SaveCharacterInventory(AZStd::move(src.SaveCharacterInventory))
+            {}
+
+            DeleteCharacterFromUserRequest& operator=(const DeleteCharacterFromUserRequest& src) = default;
+            DeleteCharacterFromUserRequest& operator=(DeleteCharacterFromUserRequest&& src) = default;
+
             DeleteCharacterFromUserRequest(const rapidjson::Value& obj) : DeleteCharacterFromUserRequest()
             {
                 readFromValue(obj);
@@ -4843,6 +7285,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SaveCharacterInventory"):
+                            if (strcmp(member, "SaveCharacterInventory") != 0)
+                                break;
+                            SaveCharacterInventory = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteCharacterFromUserResult : public PlayFabBaseModel
@@ -4856,6 +7331,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeleteCharacterFromUserResult(DeleteCharacterFromUserResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeleteCharacterFromUserResult& operator=(const DeleteCharacterFromUserResult& src) = default;
+            DeleteCharacterFromUserResult& operator=(DeleteCharacterFromUserResult&& src) = default;
+
             DeleteCharacterFromUserResult(const rapidjson::Value& obj) : DeleteCharacterFromUserResult()
             {
                 readFromValue(obj);
@@ -4876,6 +7358,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct DeleteSharedGroupRequest : public PlayFabBaseModel
@@ -4892,6 +7380,14 @@ namespace PlayFabComboSdk
                 SharedGroupId(src.SharedGroupId)
             {}
 
+            DeleteSharedGroupRequest(DeleteSharedGroupRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId))
+            {}
+
+            DeleteSharedGroupRequest& operator=(const DeleteSharedGroupRequest& src) = default;
+            DeleteSharedGroupRequest& operator=(DeleteSharedGroupRequest&& src) = default;
+
             DeleteSharedGroupRequest(const rapidjson::Value& obj) : DeleteSharedGroupRequest()
             {
                 readFromValue(obj);
@@ -4916,11 +7412,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteUsersRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> PlayFabIds;
+            std::vector<AZStd::string> PlayFabIds;
             AZStd::string TitleId;
 
             DeleteUsersRequest() :
@@ -4935,6 +7454,15 @@ namespace PlayFabComboSdk
                 TitleId(src.TitleId)
             {}
 
+            DeleteUsersRequest(DeleteUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabIds(AZStd::move(src.PlayFabIds)),
+                TitleId(AZStd::move(src.TitleId))
+            {}
+
+            DeleteUsersRequest& operator=(const DeleteUsersRequest& src) = default;
+            DeleteUsersRequest& operator=(DeleteUsersRequest&& src) = default;
+
             DeleteUsersRequest(const rapidjson::Value& obj) : DeleteUsersRequest()
             {
                 readFromValue(obj);
@@ -4949,7 +7477,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("PlayFabIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -4963,8 +7491,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayFabIds_member = obj.FindMember("PlayFabIds");
                 if (PlayFabIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayFabIds_member->value;
+                    PlayFabIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayFabIds.push_back(memberList[i].GetString());
+                        PlayFabIds.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator TitleId_member = obj.FindMember("TitleId");
@@ -4972,6 +7501,41 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabIds"):
+                            if (strcmp(member, "PlayFabIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayFabIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayFabIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeleteUsersResult : public PlayFabBaseModel
@@ -4985,6 +7549,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeleteUsersResult(DeleteUsersResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeleteUsersResult& operator=(const DeleteUsersResult& src) = default;
+            DeleteUsersResult& operator=(DeleteUsersResult&& src) = default;
+
             DeleteUsersResult(const rapidjson::Value& obj) : DeleteUsersResult()
             {
                 readFromValue(obj);
@@ -5005,6 +7576,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct DeregisterGameRequest : public PlayFabBaseModel
@@ -5021,6 +7598,14 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            DeregisterGameRequest(DeregisterGameRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            DeregisterGameRequest& operator=(const DeregisterGameRequest& src) = default;
+            DeregisterGameRequest& operator=(DeregisterGameRequest&& src) = default;
+
             DeregisterGameRequest(const rapidjson::Value& obj) : DeregisterGameRequest()
             {
                 readFromValue(obj);
@@ -5045,6 +7630,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct DeregisterGameResponse : public PlayFabBaseModel
@@ -5058,6 +7666,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            DeregisterGameResponse(DeregisterGameResponse&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            DeregisterGameResponse& operator=(const DeregisterGameResponse& src) = default;
+            DeregisterGameResponse& operator=(DeregisterGameResponse&& src) = default;
+
             DeregisterGameResponse(const rapidjson::Value& obj) : DeregisterGameResponse()
             {
                 readFromValue(obj);
@@ -5078,6 +7693,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct EmptyResult : public PlayFabBaseModel
@@ -5091,6 +7712,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            EmptyResult(EmptyResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            EmptyResult& operator=(const EmptyResult& src) = default;
+            EmptyResult& operator=(EmptyResult&& src) = default;
+
             EmptyResult(const rapidjson::Value& obj) : EmptyResult()
             {
                 readFromValue(obj);
@@ -5111,6 +7739,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct EvaluateRandomResultTableRequest : public PlayFabBaseModel
@@ -5130,6 +7764,15 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            EvaluateRandomResultTableRequest(EvaluateRandomResultTableRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                TableId(AZStd::move(src.TableId)),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            EvaluateRandomResultTableRequest& operator=(const EvaluateRandomResultTableRequest& src) = default;
+            EvaluateRandomResultTableRequest& operator=(EvaluateRandomResultTableRequest&& src) = default;
+
             EvaluateRandomResultTableRequest(const rapidjson::Value& obj) : EvaluateRandomResultTableRequest()
             {
                 readFromValue(obj);
@@ -5160,6 +7803,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TableId"):
+                            if (strcmp(member, "TableId") != 0)
+                                break;
+                            TableId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct EvaluateRandomResultTableResult : public PlayFabBaseModel
@@ -5176,6 +7847,14 @@ namespace PlayFabComboSdk
                 ResultItemId(src.ResultItemId)
             {}
 
+            EvaluateRandomResultTableResult(EvaluateRandomResultTableResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ResultItemId(AZStd::move(src.ResultItemId))
+            {}
+
+            EvaluateRandomResultTableResult& operator=(const EvaluateRandomResultTableResult& src) = default;
+            EvaluateRandomResultTableResult& operator=(EvaluateRandomResultTableResult&& src) = default;
+
             EvaluateRandomResultTableResult(const rapidjson::Value& obj) : EvaluateRandomResultTableResult()
             {
                 readFromValue(obj);
@@ -5202,6 +7881,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ResultItemId"):
+                            if (strcmp(member, "ResultItemId") != 0)
+                                break;
+                            ResultItemId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct LogStatement : public PlayFabBaseModel
@@ -5224,6 +7926,16 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            LogStatement(LogStatement&& src) noexcept :
+                PlayFabBaseModel(),
+                Level(AZStd::move(src.Level)),
+                Message(AZStd::move(src.Message)),
+                Data(AZStd::move(src.Data))
+            {}
+
+            LogStatement& operator=(const LogStatement& src) = default;
+            LogStatement& operator=(LogStatement&& src) = default;
+
             LogStatement(const rapidjson::Value& obj) : LogStatement()
             {
                 readFromValue(obj);
@@ -5262,6 +7974,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Level"):
+                            if (strcmp(member, "Level") != 0)
+                                break;
+                            Level = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Message"):
+                            if (strcmp(member, "Message") != 0)
+                                break;
+                            Message = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            Data.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ScriptExecutionError : public PlayFabBaseModel
@@ -5284,6 +8029,16 @@ namespace PlayFabComboSdk
                 StackTrace(src.StackTrace)
             {}
 
+            ScriptExecutionError(ScriptExecutionError&& src) noexcept :
+                PlayFabBaseModel(),
+                Error(AZStd::move(src.Error)),
+                Message(AZStd::move(src.Message)),
+                StackTrace(AZStd::move(src.StackTrace))
+            {}
+
+            ScriptExecutionError& operator=(const ScriptExecutionError& src) = default;
+            ScriptExecutionError& operator=(ScriptExecutionError&& src) = default;
+
             ScriptExecutionError(const rapidjson::Value& obj) : ScriptExecutionError()
             {
                 readFromValue(obj);
@@ -5322,6 +8077,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Error"):
+                            if (strcmp(member, "Error") != 0)
+                                break;
+                            Error = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Message"):
+                            if (strcmp(member, "Message") != 0)
+                                break;
+                            Message = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StackTrace"):
+                            if (strcmp(member, "StackTrace") != 0)
+                                break;
+                            StackTrace = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ExecuteCloudScriptResult : public PlayFabBaseModel
@@ -5330,7 +8118,7 @@ namespace PlayFabComboSdk
             Int32 Revision;
             MultitypeVar FunctionResult;
             OptionalBool FunctionResultTooLarge;
-            std::list<LogStatement> Logs;
+            std::vector<LogStatement> Logs;
             OptionalBool LogsTooLarge;
             double ExecutionTimeSeconds;
             double ProcessorTimeSeconds;
@@ -5371,6 +8159,53 @@ namespace PlayFabComboSdk
                 Error(src.Error ? new ScriptExecutionError(*src.Error) : nullptr)
             {}
 
+            ExecuteCloudScriptResult(ExecuteCloudScriptResult&& src) noexcept :
+                PlayFabBaseModel(),
+                FunctionName(AZStd::move(src.FunctionName)),
+                Revision(AZStd::move(src.Revision)),
+                FunctionResult(AZStd::move(src.FunctionResult)),
+                FunctionResultTooLarge(AZStd::move(src.FunctionResultTooLarge)),
+                Logs(AZStd::move(src.Logs)),
+                LogsTooLarge(AZStd::move(src.LogsTooLarge)),
+                ExecutionTimeSeconds(AZStd::move(src.ExecutionTimeSeconds)),
+                ProcessorTimeSeconds(AZStd::move(src.ProcessorTimeSeconds)),
+                MemoryConsumedBytes(AZStd::move(src.MemoryConsumedBytes)),
+                APIRequestsIssued(AZStd::move(src.APIRequestsIssued)),
+                HttpRequestsIssued(AZStd::move(src.HttpRequestsIssued)),
+                Error(src.Error)
+            {
+                src.Error = nullptr;
+            }
+
+            ExecuteCloudScriptResult& operator=(const ExecuteCloudScriptResult& src)
+            {
+                if (this != &src)
+                    *this = ExecuteCloudScriptResult(src);
+                return *this;
+            }
+
+            ExecuteCloudScriptResult& operator=(ExecuteCloudScriptResult&& src)
+            {
+                if (this != &src)
+                {
+                    FunctionName = AZStd::move(src.FunctionName);
+                    Revision = AZStd::move(src.Revision);
+                    FunctionResult = AZStd::move(src.FunctionResult);
+                    FunctionResultTooLarge = AZStd::move(src.FunctionResultTooLarge);
+                    Logs = AZStd::move(src.Logs);
+                    LogsTooLarge = AZStd::move(src.LogsTooLarge);
+                    ExecutionTimeSeconds = AZStd::move(src.ExecutionTimeSeconds);
+                    ProcessorTimeSeconds = AZStd::move(src.ProcessorTimeSeconds);
+                    MemoryConsumedBytes = AZStd::move(src.MemoryConsumedBytes);
+                    APIRequestsIssued = AZStd::move(src.APIRequestsIssued);
+                    HttpRequestsIssued = AZStd::move(src.HttpRequestsIssued);
+                    if (Error != nullptr) delete Error;
+                    Error = src.Error;
+                    src.Error = nullptr;
+                }
+                return *this;
+            }
+
             ExecuteCloudScriptResult(const rapidjson::Value& obj) : ExecuteCloudScriptResult()
             {
                 readFromValue(obj);
@@ -5401,7 +8236,7 @@ namespace PlayFabComboSdk
                 if (!Logs.empty()) {
                     writer.String("Logs");
                     writer.StartArray();
-                    for (std::list<LogStatement>::iterator iter = Logs.begin(); iter != Logs.end(); iter++) {
+                    for (std::vector<LogStatement>::iterator iter = Logs.begin(); iter != Logs.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -5440,8 +8275,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Logs_member = obj.FindMember("Logs");
                 if (Logs_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Logs_member->value;
+                    Logs.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Logs.push_back(LogStatement(memberList[i]));
+                        Logs.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator LogsTooLarge_member = obj.FindMember("LogsTooLarge");
@@ -5461,6 +8297,93 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FunctionName"):
+                            if (strcmp(member, "FunctionName") != 0)
+                                break;
+                            FunctionName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Revision"):
+                            if (strcmp(member, "Revision") != 0)
+                                break;
+                            Revision = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("FunctionResult"):
+                            if (strcmp(member, "FunctionResult") != 0)
+                                break;
+                            FunctionResult.readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("FunctionResultTooLarge"):
+                            if (strcmp(member, "FunctionResultTooLarge") != 0)
+                                break;
+                            FunctionResultTooLarge = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Logs"):
+                            if (strcmp(member, "Logs") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Logs.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Logs.emplace_back();
+                                    Logs.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("LogsTooLarge"):
+                            if (strcmp(member, "LogsTooLarge") != 0)
+                                break;
+                            LogsTooLarge = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ExecutionTimeSeconds"):
+                            if (strcmp(member, "ExecutionTimeSeconds") != 0)
+                                break;
+                            ExecutionTimeSeconds = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProcessorTimeSeconds"):
+                            if (strcmp(member, "ProcessorTimeSeconds") != 0)
+                                break;
+                            ProcessorTimeSeconds = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("MemoryConsumedBytes"):
+                            if (strcmp(member, "MemoryConsumedBytes") != 0)
+                                break;
+                            MemoryConsumedBytes = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("APIRequestsIssued"):
+                            if (strcmp(member, "APIRequestsIssued") != 0)
+                                break;
+                            APIRequestsIssued = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("HttpRequestsIssued"):
+                            if (strcmp(member, "HttpRequestsIssued") != 0)
+                                break;
+                            HttpRequestsIssued = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Error"):
+                            if (strcmp(member, "Error") != 0)
+                                break;
+                            Error = new ScriptExecutionError;
+                            Error->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ExecuteCloudScriptServerRequest : public PlayFabBaseModel
@@ -5492,6 +8415,19 @@ namespace PlayFabComboSdk
                 GeneratePlayStreamEvent(src.GeneratePlayStreamEvent)
             {}
 
+            ExecuteCloudScriptServerRequest(ExecuteCloudScriptServerRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                FunctionName(AZStd::move(src.FunctionName)),
+                FunctionParameter(AZStd::move(src.FunctionParameter)),
+                RevisionSelection(AZStd::move(src.RevisionSelection)),
+                SpecificRevision(AZStd::move(src.SpecificRevision)),
+                GeneratePlayStreamEvent(AZStd::move(src.GeneratePlayStreamEvent))
+            {}
+
+            ExecuteCloudScriptServerRequest& operator=(const ExecuteCloudScriptServerRequest& src) = default;
+            ExecuteCloudScriptServerRequest& operator=(ExecuteCloudScriptServerRequest&& src) = default;
+
             ExecuteCloudScriptServerRequest(const rapidjson::Value& obj) : ExecuteCloudScriptServerRequest()
             {
                 readFromValue(obj);
@@ -5544,6 +8480,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FunctionName"):
+                            if (strcmp(member, "FunctionName") != 0)
+                                break;
+                            FunctionName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FunctionParameter"):
+                            if (strcmp(member, "FunctionParameter") != 0)
+                                break;
+                            FunctionParameter.readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("RevisionSelection"):
+                            if (strcmp(member, "RevisionSelection") != 0)
+                                break;
+                            RevisionSelection = readCloudScriptRevisionOptionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("SpecificRevision"):
+                            if (strcmp(member, "SpecificRevision") != 0)
+                                break;
+                            SpecificRevision = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("GeneratePlayStreamEvent"):
+                            if (strcmp(member, "GeneratePlayStreamEvent") != 0)
+                                break;
+                            GeneratePlayStreamEvent = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct FacebookPlayFabIdPair : public PlayFabBaseModel
@@ -5563,6 +8547,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            FacebookPlayFabIdPair(FacebookPlayFabIdPair&& src) noexcept :
+                PlayFabBaseModel(),
+                FacebookId(AZStd::move(src.FacebookId)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            FacebookPlayFabIdPair& operator=(const FacebookPlayFabIdPair& src) = default;
+            FacebookPlayFabIdPair& operator=(FacebookPlayFabIdPair&& src) = default;
+
             FacebookPlayFabIdPair(const rapidjson::Value& obj) : FacebookPlayFabIdPair()
             {
                 readFromValue(obj);
@@ -5595,6 +8588,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FacebookId"):
+                            if (strcmp(member, "FacebookId") != 0)
+                                break;
+                            FacebookId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum LoginIdentityProvider
@@ -5643,31 +8664,26 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<LoginIdentityProvider>(obj.GetInt());
 
-            static std::map<const char *, LoginIdentityProvider, PlayFabComboSdk::StringCompare> _LoginIdentityProviderMap;
-            if (_LoginIdentityProviderMap.size() == 0)
-            {
-                // Auto-generate the map on the first use
-                _LoginIdentityProviderMap["Unknown"] = LoginIdentityProviderUnknown;
-                _LoginIdentityProviderMap["PlayFab"] = LoginIdentityProviderPlayFab;
-                _LoginIdentityProviderMap["Custom"] = LoginIdentityProviderCustom;
-                _LoginIdentityProviderMap["GameCenter"] = LoginIdentityProviderGameCenter;
-                _LoginIdentityProviderMap["GooglePlay"] = LoginIdentityProviderGooglePlay;
-                _LoginIdentityProviderMap["Steam"] = LoginIdentityProviderSteam;
-                _LoginIdentityProviderMap["XBoxLive"] = LoginIdentityProviderXBoxLive;
-                _LoginIdentityProviderMap["PSN"] = LoginIdentityProviderPSN;
-                _LoginIdentityProviderMap["Kongregate"] = LoginIdentityProviderKongregate;
-                _LoginIdentityProviderMap["Facebook"] = LoginIdentityProviderFacebook;
-                _LoginIdentityProviderMap["IOSDevice"] = LoginIdentityProviderIOSDevice;
-                _LoginIdentityProviderMap["AndroidDevice"] = LoginIdentityProviderAndroidDevice;
-                _LoginIdentityProviderMap["Twitch"] = LoginIdentityProviderTwitch;
-                _LoginIdentityProviderMap["WindowsHello"] = LoginIdentityProviderWindowsHello;
-
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
+            {
+            case PlayFabJsonReader::Hash("Unknown"): if (strcmp(name, "Unknown") == 0) return LoginIdentityProviderUnknown; break;
+            case PlayFabJsonReader::Hash("PlayFab"): if (strcmp(name, "PlayFab") == 0) return LoginIdentityProviderPlayFab; break;
+            case PlayFabJsonReader::Hash("Custom"): if (strcmp(name, "Custom") == 0) return LoginIdentityProviderCustom; break;
+            case PlayFabJsonReader::Hash("GameCenter"): if (strcmp(name, "GameCenter") == 0) return LoginIdentityProviderGameCenter; break;
+            case PlayFabJsonReader::Hash("GooglePlay"): if (strcmp(name, "GooglePlay") == 0) return LoginIdentityProviderGooglePlay; break;
+            case PlayFabJsonReader::Hash("Steam"): if (strcmp(name, "Steam") == 0) return LoginIdentityProviderSteam; break;
+            case PlayFabJsonReader::Hash("XBoxLive"): if (strcmp(name, "XBoxLive") == 0) return LoginIdentityProviderXBoxLive; break;
+            case PlayFabJsonReader::Hash("PSN"): if (strcmp(name, "PSN") == 0) return LoginIdentityProviderPSN; break;
+            case PlayFabJsonReader::Hash("Kongregate"): if (strcmp(name, "Kongregate") == 0) return LoginIdentityProviderKongregate; break;
+            case PlayFabJsonReader::Hash("Facebook"): if (strcmp(name, "Facebook") == 0) return LoginIdentityProviderFacebook; break;
+            case PlayFabJsonReader::Hash("IOSDevice"): if (strcmp(name, "IOSDevice") == 0) return LoginIdentityProviderIOSDevice; break;
+            case PlayFabJsonReader::Hash("AndroidDevice"): if (strcmp(name, "AndroidDevice") == 0) return LoginIdentityProviderAndroidDevice; break;
+            case PlayFabJsonReader::Hash("Twitch"): if (strcmp(name, "Twitch") == 0) return LoginIdentityProviderTwitch; break;
+            case PlayFabJsonReader::Hash("WindowsHello"): if (strcmp(name, "WindowsHello") == 0) return LoginIdentityProviderWindowsHello; break;
             }
 
-            auto output = _LoginIdentityProviderMap.find(obj.GetString());
-            if (output != _LoginIdentityProviderMap.end())
-                return output->second;
-
             return LoginIdentityProviderUnknown; // Basically critical fail
         }
 
@@ -5697,6 +8713,18 @@ namespace PlayFabComboSdk
                 Longitude(src.Longitude)
             {}
 
+            LocationModel(LocationModel&& src) noexcept :
+                PlayFabBaseModel(),
+                pfContinentCode(AZStd::move(src.pfContinentCode)),
+                pfCountryCode(AZStd::move(src.pfCountryCode)),
+                City(AZStd::move(src.City)),
+                Latitude(AZStd::move(src.Latitude)),
+                Longitude(AZStd::move(src.Longitude))
+            {}
+
+            LocationModel& operator=(const LocationModel& src) = default;
+            LocationModel& operator=(LocationModel&& src) = default;
+
             LocationModel(const rapidjson::Value& obj) : LocationModel()
             {
                 readFromValue(obj);
@@ -5747,6 +8775,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ContinentCode"):
+                            if (strcmp(member, "ContinentCode") != 0)
+                                break;
+                            pfContinentCode = readContinentCodeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CountryCode"):
+                            if (strcmp(member, "CountryCode") != 0)
+                                break;
+                            pfCountryCode = readCountryCodeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("City"):
+                            if (strcmp(member, "City") != 0)
+                                break;
+                            City = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Latitude"):
+                            if (strcmp(member, "Latitude") != 0)
+                                break;
+                            Latitude = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("Longitude"):
+                            if (strcmp(member, "Longitude") != 0)
+                                break;
+                            Longitude = reader.GetValue().GetDouble();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct TagModel : public PlayFabBaseModel
@@ -5763,6 +8834,14 @@ namespace PlayFabComboSdk
                 TagValue(src.TagValue)
             {}
 
+            TagModel(TagModel&& src) noexcept :
+                PlayFabBaseModel(),
+                TagValue(AZStd::move(src.TagValue))
+            {}
+
+            TagModel& operator=(const TagModel& src) = default;
+            TagModel& operator=(TagModel&& src) = default;
+
             TagModel(const rapidjson::Value& obj) : TagModel()
             {
                 readFromValue(obj);
@@ -5789,6 +8868,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TagValue"):
+                            if (strcmp(member, "TagValue") != 0)
+                                break;
+                            TagValue = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum PushNotificationPlatform
@@ -5813,19 +8915,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<PushNotificationPlatform>(obj.GetInt());
 
-            static std::map<const char *, PushNotificationPlatform, PlayFabComboSdk::StringCompare> _PushNotificationPlatformMap;
-            if (_PushNotificationPlatformMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _PushNotificationPlatformMap["ApplePushNotificationService"] = PushNotificationPlatformApplePushNotificationService;
-                _PushNotificationPlatformMap["GoogleCloudMessaging"] = PushNotificationPlatformGoogleCloudMessaging;
-
+            case PlayFabJsonReader::Hash("ApplePushNotificationService"): if (strcmp(name, "ApplePushNotificationService") == 0) return PushNotificationPlatformApplePushNotificationService; break;
+            case PlayFabJsonReader::Hash("GoogleCloudMessaging"): if (strcmp(name, "GoogleCloudMessaging") == 0) return PushNotificationPlatformGoogleCloudMessaging; break;
             }
 
-            auto output = _PushNotificationPlatformMap.find(obj.GetString());
-            if (output != _PushNotificationPlatformMap.end())
-                return output->second;
-
             return PushNotificationPlatformApplePushNotificationService; // Basically critical fail
         }
 
@@ -5846,6 +8943,15 @@ namespace PlayFabComboSdk
                 NotificationEndpointARN(src.NotificationEndpointARN)
             {}
 
+            PushNotificationRegistrationModel(PushNotificationRegistrationModel&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                NotificationEndpointARN(AZStd::move(src.NotificationEndpointARN))
+            {}
+
+            PushNotificationRegistrationModel& operator=(const PushNotificationRegistrationModel& src) = default;
+            PushNotificationRegistrationModel& operator=(PushNotificationRegistrationModel&& src) = default;
+
             PushNotificationRegistrationModel(const rapidjson::Value& obj) : PushNotificationRegistrationModel()
             {
                 readFromValue(obj);
@@ -5878,6 +8984,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readPushNotificationPlatformFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("NotificationEndpointARN"):
+                            if (strcmp(member, "NotificationEndpointARN") != 0)
+                                break;
+                            NotificationEndpointARN = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct LinkedPlatformAccountModel : public PlayFabBaseModel
@@ -5903,6 +9037,17 @@ namespace PlayFabComboSdk
                 Email(src.Email)
             {}
 
+            LinkedPlatformAccountModel(LinkedPlatformAccountModel&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                PlatformUserId(AZStd::move(src.PlatformUserId)),
+                Username(AZStd::move(src.Username)),
+                Email(AZStd::move(src.Email))
+            {}
+
+            LinkedPlatformAccountModel& operator=(const LinkedPlatformAccountModel& src) = default;
+            LinkedPlatformAccountModel& operator=(LinkedPlatformAccountModel&& src) = default;
+
             LinkedPlatformAccountModel(const rapidjson::Value& obj) : LinkedPlatformAccountModel()
             {
                 readFromValue(obj);
@@ -5947,6 +9092,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readLoginIdentityProviderFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PlatformUserId"):
+                            if (strcmp(member, "PlatformUserId") != 0)
+                                break;
+                            PlatformUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ValueToDateModel : public PlayFabBaseModel
@@ -5969,6 +9152,16 @@ namespace PlayFabComboSdk
                 TotalValueAsDecimal(src.TotalValueAsDecimal)
             {}
 
+            ValueToDateModel(ValueToDateModel&& src) noexcept :
+                PlayFabBaseModel(),
+                Currency(AZStd::move(src.Currency)),
+                TotalValue(AZStd::move(src.TotalValue)),
+                TotalValueAsDecimal(AZStd::move(src.TotalValueAsDecimal))
+            {}
+
+            ValueToDateModel& operator=(const ValueToDateModel& src) = default;
+            ValueToDateModel& operator=(ValueToDateModel&& src) = default;
+
             ValueToDateModel(const rapidjson::Value& obj) : ValueToDateModel()
             {
                 readFromValue(obj);
@@ -6005,6 +9198,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Currency"):
+                            if (strcmp(member, "Currency") != 0)
+                                break;
+                            Currency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalValue"):
+                            if (strcmp(member, "TotalValue") != 0)
+                                break;
+                            TotalValue = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalValueAsDecimal"):
+                            if (strcmp(member, "TotalValueAsDecimal") != 0)
+                                break;
+                            TotalValueAsDecimal = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct VirtualCurrencyBalanceModel : public PlayFabBaseModel
@@ -6024,6 +9250,15 @@ namespace PlayFabComboSdk
                 TotalValue(src.TotalValue)
             {}
 
+            VirtualCurrencyBalanceModel(VirtualCurrencyBalanceModel&& src) noexcept :
+                PlayFabBaseModel(),
+                Currency(AZStd::move(src.Currency)),
+                TotalValue(AZStd::move(src.TotalValue))
+            {}
+
+            VirtualCurrencyBalanceModel& operator=(const VirtualCurrencyBalanceModel& src) = default;
+            VirtualCurrencyBalanceModel& operator=(VirtualCurrencyBalanceModel&& src) = default;
+
             VirtualCurrencyBalanceModel(const rapidjson::Value& obj) : VirtualCurrencyBalanceModel()
             {
                 readFromValue(obj);
@@ -6054,6 +9289,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Currency"):
+                            if (strcmp(member, "Currency") != 0)
+                                break;
+                            Currency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalValue"):
+                            if (strcmp(member, "TotalValue") != 0)
+                                break;
+                            TotalValue = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct StatisticModel : public PlayFabBaseModel
@@ -6076,6 +9339,16 @@ namespace PlayFabComboSdk
                 Value(src.Value)
             {}
 
+            StatisticModel(StatisticModel&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Version(AZStd::move(src.Version)),
+                Value(AZStd::move(src.Value))
+            {}
+
+            StatisticModel& operator=(const StatisticModel& src) = default;
+            StatisticModel& operator=(StatisticModel&& src) = default;
+
             StatisticModel(const rapidjson::Value& obj) : StatisticModel()
             {
                 readFromValue(obj);
@@ -6110,6 +9383,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerProfileModel : public PlayFabBaseModel
@@ -6121,17 +9427,17 @@ namespace PlayFabComboSdk
             Boxed<LoginIdentityProvider> Origination;
             OptionalTime LastLogin;
             OptionalTime BannedUntil;
-            std::list<LocationModel> Locations;
+            std::vector<LocationModel> Locations;
             AZStd::string DisplayName;
             AZStd::string AvatarUrl;
-            std::list<TagModel> Tags;
-            std::list<PushNotificationRegistrationModel> PushNotificationRegistrations;
-            std::list<LinkedPlatformAccountModel> LinkedAccounts;
-            std::list<AdCampaignAttributionModel> AdCampaignAttributions;
+            std::vector<TagModel> Tags;
+            std::vector<PushNotificationRegistrationModel> PushNotificationRegistrations;
+            std::vector<LinkedPlatformAccountModel> LinkedAccounts;
+            std::vector<AdCampaignAttributionModel> AdCampaignAttributions;
             OptionalUint32 TotalValueToDateInUSD;
-            std::list<ValueToDateModel> ValuesToDate;
-            std::list<VirtualCurrencyBalanceModel> VirtualCurrencyBalances;
-            std::list<StatisticModel> Statistics;
+            std::vector<ValueToDateModel> ValuesToDate;
+            std::vector<VirtualCurrencyBalanceModel> VirtualCurrencyBalances;
+            std::vector<StatisticModel> Statistics;
 
             PlayerProfileModel() :
                 PlayFabBaseModel(),
@@ -6177,6 +9483,31 @@ namespace PlayFabComboSdk
                 Statistics(src.Statistics)
             {}
 
+            PlayerProfileModel(PlayerProfileModel&& src) noexcept :
+                PlayFabBaseModel(),
+                PublisherId(AZStd::move(src.PublisherId)),
+                TitleId(AZStd::move(src.TitleId)),
+                PlayerId(AZStd::move(src.PlayerId)),
+                Created(AZStd::move(src.Created)),
+                Origination(AZStd::move(src.Origination)),
+                LastLogin(AZStd::move(src.LastLogin)),
+                BannedUntil(AZStd::move(src.BannedUntil)),
+                Locations(AZStd::move(src.Locations)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                AvatarUrl(AZStd::move(src.AvatarUrl)),
+                Tags(AZStd::move(src.Tags)),
+                PushNotificationRegistrations(AZStd::move(src.PushNotificationRegistrations)),
+                LinkedAccounts(AZStd::move(src.LinkedAccounts)),
+                AdCampaignAttributions(AZStd::move(src.AdCampaignAttributions)),
+                TotalValueToDateInUSD(AZStd::move(src.TotalValueToDateInUSD)),
+                ValuesToDate(AZStd::move(src.ValuesToDate)),
+                VirtualCurrencyBalances(AZStd::move(src.VirtualCurrencyBalances)),
+                Statistics(AZStd::move(src.Statistics))
+            {}
+
+            PlayerProfileModel& operator=(const PlayerProfileModel& src) = default;
+            PlayerProfileModel& operator=(PlayerProfileModel&& src) = default;
+
             PlayerProfileModel(const rapidjson::Value& obj) : PlayerProfileModel()
             {
                 readFromValue(obj);
@@ -6220,7 +9551,7 @@ namespace PlayFabComboSdk
                 if (!Locations.empty()) {
                     writer.String("Locations");
                     writer.StartArray();
-                    for (std::list<LocationModel>::iterator iter = Locations.begin(); iter != Locations.end(); iter++) {
+                    for (std::vector<LocationModel>::iterator iter = Locations.begin(); iter != Locations.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6236,7 +9567,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartArray();
-                    for (std::list<TagModel>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                    for (std::vector<TagModel>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6244,7 +9575,7 @@ namespace PlayFabComboSdk
                 if (!PushNotificationRegistrations.empty()) {
                     writer.String("PushNotificationRegistrations");
                     writer.StartArray();
-                    for (std::list<PushNotificationRegistrationModel>::iterator iter = PushNotificationRegistrations.begin(); iter != PushNotificationRegistrations.end(); iter++) {
+                    for (std::vector<PushNotificationRegistrationModel>::iterator iter = PushNotificationRegistrations.begin(); iter != PushNotificationRegistrations.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6252,7 +9583,7 @@ namespace PlayFabComboSdk
                 if (!LinkedAccounts.empty()) {
                     writer.String("LinkedAccounts");
                     writer.StartArray();
-                    for (std::list<LinkedPlatformAccountModel>::iterator iter = LinkedAccounts.begin(); iter != LinkedAccounts.end(); iter++) {
+                    for (std::vector<LinkedPlatformAccountModel>::iterator iter = LinkedAccounts.begin(); iter != LinkedAccounts.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6260,7 +9591,7 @@ namespace PlayFabComboSdk
                 if (!AdCampaignAttributions.empty()) {
                     writer.String("AdCampaignAttributions");
                     writer.StartArray();
-                    for (std::list<AdCampaignAttributionModel>::iterator iter = AdCampaignAttributions.begin(); iter != AdCampaignAttributions.end(); iter++) {
+                    for (std::vector<AdCampaignAttributionModel>::iterator iter = AdCampaignAttributions.begin(); iter != AdCampaignAttributions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6272,7 +9603,7 @@ namespace PlayFabComboSdk
                 if (!ValuesToDate.empty()) {
                     writer.String("ValuesToDate");
                     writer.StartArray();
-                    for (std::list<ValueToDateModel>::iterator iter = ValuesToDate.begin(); iter != ValuesToDate.end(); iter++) {
+                    for (std::vector<ValueToDateModel>::iterator iter = ValuesToDate.begin(); iter != ValuesToDate.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6280,7 +9611,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyBalances.empty()) {
                     writer.String("VirtualCurrencyBalances");
                     writer.StartArray();
-                    for (std::list<VirtualCurrencyBalanceModel>::iterator iter = VirtualCurrencyBalances.begin(); iter != VirtualCurrencyBalances.end(); iter++) {
+                    for (std::vector<VirtualCurrencyBalanceModel>::iterator iter = VirtualCurrencyBalances.begin(); iter != VirtualCurrencyBalances.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6288,7 +9619,7 @@ namespace PlayFabComboSdk
                 if (!Statistics.empty()) {
                     writer.String("Statistics");
                     writer.StartArray();
-                    for (std::list<StatisticModel>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
+                    for (std::vector<StatisticModel>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6315,8 +9646,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Locations_member = obj.FindMember("Locations");
                 if (Locations_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Locations_member->value;
+                    Locations.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Locations.push_back(LocationModel(memberList[i]));
+                        Locations.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator DisplayName_member = obj.FindMember("DisplayName");
@@ -6326,29 +9658,33 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(TagModel(memberList[i]));
+                        Tags.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator PushNotificationRegistrations_member = obj.FindMember("PushNotificationRegistrations");
                 if (PushNotificationRegistrations_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PushNotificationRegistrations_member->value;
+                    PushNotificationRegistrations.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PushNotificationRegistrations.push_back(PushNotificationRegistrationModel(memberList[i]));
+                        PushNotificationRegistrations.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator LinkedAccounts_member = obj.FindMember("LinkedAccounts");
                 if (LinkedAccounts_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = LinkedAccounts_member->value;
+                    LinkedAccounts.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        LinkedAccounts.push_back(LinkedPlatformAccountModel(memberList[i]));
+                        LinkedAccounts.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator AdCampaignAttributions_member = obj.FindMember("AdCampaignAttributions");
                 if (AdCampaignAttributions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = AdCampaignAttributions_member->value;
+                    AdCampaignAttributions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        AdCampaignAttributions.push_back(AdCampaignAttributionModel(memberList[i]));
+                        AdCampaignAttributions.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator TotalValueToDateInUSD_member = obj.FindMember("TotalValueToDateInUSD");
@@ -6356,27 +9692,202 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ValuesToDate_member = obj.FindMember("ValuesToDate");
                 if (ValuesToDate_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ValuesToDate_member->value;
+                    ValuesToDate.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ValuesToDate.push_back(ValueToDateModel(memberList[i]));
+                        ValuesToDate.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrencyBalances_member = obj.FindMember("VirtualCurrencyBalances");
                 if (VirtualCurrencyBalances_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = VirtualCurrencyBalances_member->value;
+                    VirtualCurrencyBalances.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        VirtualCurrencyBalances.push_back(VirtualCurrencyBalanceModel(memberList[i]));
+                        VirtualCurrencyBalances.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator Statistics_member = obj.FindMember("Statistics");
                 if (Statistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statistics_member->value;
+                    Statistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statistics.push_back(StatisticModel(memberList[i]));
+                        Statistics.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PublisherId"):
+                            if (strcmp(member, "PublisherId") != 0)
+                                break;
+                            PublisherId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerId"):
+                            if (strcmp(member, "PlayerId") != 0)
+                                break;
+                            PlayerId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Origination"):
+                            if (strcmp(member, "Origination") != 0)
+                                break;
+                            Origination = readLoginIdentityProviderFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("LastLogin"):
+                            if (strcmp(member, "LastLogin") != 0)
+                                break;
+                            LastLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("BannedUntil"):
+                            if (strcmp(member, "BannedUntil") != 0)
+                                break;
+                            BannedUntil = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Locations"):
+                            if (strcmp(member, "Locations") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Locations.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Locations.emplace_back();
+                                    Locations.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("AvatarUrl"):
+                            if (strcmp(member, "AvatarUrl") != 0)
+                                break;
+                            AvatarUrl = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.emplace_back();
+                                    Tags.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PushNotificationRegistrations"):
+                            if (strcmp(member, "PushNotificationRegistrations") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PushNotificationRegistrations.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PushNotificationRegistrations.emplace_back();
+                                    PushNotificationRegistrations.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("LinkedAccounts"):
+                            if (strcmp(member, "LinkedAccounts") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                LinkedAccounts.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    LinkedAccounts.emplace_back();
+                                    LinkedAccounts.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("AdCampaignAttributions"):
+                            if (strcmp(member, "AdCampaignAttributions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                AdCampaignAttributions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    AdCampaignAttributions.emplace_back();
+                                    AdCampaignAttributions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalValueToDateInUSD"):
+                            if (strcmp(member, "TotalValueToDateInUSD") != 0)
+                                break;
+                            TotalValueToDateInUSD = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ValuesToDate"):
+                            if (strcmp(member, "ValuesToDate") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ValuesToDate.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ValuesToDate.emplace_back();
+                                    ValuesToDate.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyBalances"):
+                            if (strcmp(member, "VirtualCurrencyBalances") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                VirtualCurrencyBalances.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    VirtualCurrencyBalances.emplace_back();
+                                    VirtualCurrencyBalances.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Statistics"):
+                            if (strcmp(member, "Statistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statistics.emplace_back();
+                                    Statistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct FriendInfo : public PlayFabBaseModel
@@ -6384,7 +9895,7 @@ namespace PlayFabComboSdk
             AZStd::string FriendPlayFabId;
             AZStd::string Username;
             AZStd::string TitleDisplayName;
-            std::list<AZStd::string> Tags;
+            std::vector<AZStd::string> Tags;
             AZStd::string CurrentMatchmakerLobbyId;
             UserFacebookInfo* FacebookInfo;
             UserSteamInfo* SteamInfo;
@@ -6417,6 +9928,56 @@ namespace PlayFabComboSdk
                 Profile(src.Profile ? new PlayerProfileModel(*src.Profile) : nullptr)
             {}
 
+            FriendInfo(FriendInfo&& src) noexcept :
+                PlayFabBaseModel(),
+                FriendPlayFabId(AZStd::move(src.FriendPlayFabId)),
+                Username(AZStd::move(src.Username)),
+                TitleDisplayName(AZStd::move(src.TitleDisplayName)),
+                Tags(AZStd::move(src.Tags)),
+                CurrentMatchmakerLobbyId(AZStd::move(src.CurrentMatchmakerLobbyId)),
+                FacebookInfo(src.FacebookInfo),
+                SteamInfo(src.SteamInfo),
+                GameCenterInfo(src.GameCenterInfo),
+                Profile(src.Profile)
+            {
+                src.FacebookInfo = nullptr;
+                src.SteamInfo = nullptr;
+                src.GameCenterInfo = nullptr;
+                src.Profile = nullptr;
+            }
+
+            FriendInfo& operator=(const FriendInfo& src)
+            {
+                if (this != &src)
+                    *this = FriendInfo(src);
+                return *this;
+            }
+
+            FriendInfo& operator=(FriendInfo&& src)
+            {
+                if (this != &src)
+                {
+                    FriendPlayFabId = AZStd::move(src.FriendPlayFabId);
+                    Username = AZStd::move(src.Username);
+                    TitleDisplayName = AZStd::move(src.TitleDisplayName);
+                    Tags = AZStd::move(src.Tags);
+                    CurrentMatchmakerLobbyId = AZStd::move(src.CurrentMatchmakerLobbyId);
+                    if (FacebookInfo != nullptr) delete FacebookInfo;
+                    FacebookInfo = src.FacebookInfo;
+                    src.FacebookInfo = nullptr;
+                    if (SteamInfo != nullptr) delete SteamInfo;
+                    SteamInfo = src.SteamInfo;
+                    src.SteamInfo = nullptr;
+                    if (GameCenterInfo != nullptr) delete GameCenterInfo;
+                    GameCenterInfo = src.GameCenterInfo;
+                    src.GameCenterInfo = nullptr;
+                    if (Profile != nullptr) delete Profile;
+                    Profile = src.Profile;
+                    src.Profile = nullptr;
+                }
+                return *this;
+            }
+
             FriendInfo(const rapidjson::Value& obj) : FriendInfo()
             {
                 readFromValue(obj);
@@ -6448,7 +10009,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -6487,8 +10048,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CurrentMatchmakerLobbyId_member = obj.FindMember("CurrentMatchmakerLobbyId");
@@ -6504,6 +10066,80 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FriendPlayFabId"):
+                            if (strcmp(member, "FriendPlayFabId") != 0)
+                                break;
+                            FriendPlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleDisplayName"):
+                            if (strcmp(member, "TitleDisplayName") != 0)
+                                break;
+                            TitleDisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CurrentMatchmakerLobbyId"):
+                            if (strcmp(member, "CurrentMatchmakerLobbyId") != 0)
+                                break;
+                            CurrentMatchmakerLobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FacebookInfo"):
+                            if (strcmp(member, "FacebookInfo") != 0)
+                                break;
+                            FacebookInfo = new UserFacebookInfo;
+                            FacebookInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("SteamInfo"):
+                            if (strcmp(member, "SteamInfo") != 0)
+                                break;
+                            SteamInfo = new UserSteamInfo;
+                            SteamInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("GameCenterInfo"):
+                            if (strcmp(member, "GameCenterInfo") != 0)
+                                break;
+                            GameCenterInfo = new UserGameCenterInfo;
+                            GameCenterInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Profile"):
+                            if (strcmp(member, "Profile") != 0)
+                                break;
+                            Profile = new PlayerProfileModel;
+                            Profile->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum GameInstanceState
@@ -6528,19 +10164,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<GameInstanceState>(obj.GetInt());
 
-            static std::map<const char *, GameInstanceState, PlayFabComboSdk::StringCompare> _GameInstanceStateMap;
-            if (_GameInstanceStateMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _GameInstanceStateMap["Open"] = GameInstanceStateOpen;
-                _GameInstanceStateMap["Closed"] = GameInstanceStateClosed;
-
+            case PlayFabJsonReader::Hash("Open"): if (strcmp(name, "Open") == 0) return GameInstanceStateOpen; break;
+            case PlayFabJsonReader::Hash("Closed"): if (strcmp(name, "Closed") == 0) return GameInstanceStateClosed; break;
             }
 
-            auto output = _GameInstanceStateMap.find(obj.GetString());
-            if (output != _GameInstanceStateMap.end())
-                return output->second;
-
             return GameInstanceStateOpen; // Basically critical fail
         }
 
@@ -6561,6 +10192,15 @@ namespace PlayFabComboSdk
                 Id(src.Id)
             {}
 
+            GetActionGroupResult(GetActionGroupResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Name(AZStd::move(src.Name)),
+                Id(AZStd::move(src.Id))
+            {}
+
+            GetActionGroupResult& operator=(const GetActionGroupResult& src) = default;
+            GetActionGroupResult& operator=(GetActionGroupResult&& src) = default;
+
             GetActionGroupResult(const rapidjson::Value& obj) : GetActionGroupResult()
             {
                 readFromValue(obj);
@@ -6591,6 +10231,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetAllActionGroupsRequest : public PlayFabBaseModel
@@ -6604,6 +10272,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetAllActionGroupsRequest(GetAllActionGroupsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetAllActionGroupsRequest& operator=(const GetAllActionGroupsRequest& src) = default;
+            GetAllActionGroupsRequest& operator=(GetAllActionGroupsRequest&& src) = default;
+
             GetAllActionGroupsRequest(const rapidjson::Value& obj) : GetAllActionGroupsRequest()
             {
                 readFromValue(obj);
@@ -6624,11 +10299,17 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetAllActionGroupsResult : public PlayFabBaseModel
         {
-            std::list<GetActionGroupResult> ActionGroups;
+            std::vector<GetActionGroupResult> ActionGroups;
 
             GetAllActionGroupsResult() :
                 PlayFabBaseModel(),
@@ -6640,6 +10321,14 @@ namespace PlayFabComboSdk
                 ActionGroups(src.ActionGroups)
             {}
 
+            GetAllActionGroupsResult(GetAllActionGroupsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ActionGroups(AZStd::move(src.ActionGroups))
+            {}
+
+            GetAllActionGroupsResult& operator=(const GetAllActionGroupsResult& src) = default;
+            GetAllActionGroupsResult& operator=(GetAllActionGroupsResult&& src) = default;
+
             GetAllActionGroupsResult(const rapidjson::Value& obj) : GetAllActionGroupsResult()
             {
                 readFromValue(obj);
@@ -6654,7 +10343,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("ActionGroups");
                 writer.StartArray();
-                for (std::list<GetActionGroupResult>::iterator iter = ActionGroups.begin(); iter != ActionGroups.end(); iter++) {
+                for (std::vector<GetActionGroupResult>::iterator iter = ActionGroups.begin(); iter != ActionGroups.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -6666,13 +10355,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ActionGroups_member = obj.FindMember("ActionGroups");
                 if (ActionGroups_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ActionGroups_member->value;
+                    ActionGroups.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ActionGroups.push_back(GetActionGroupResult(memberList[i]));
+                        ActionGroups.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ActionGroups"):
+                            if (strcmp(member, "ActionGroups") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ActionGroups.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ActionGroups.emplace_back();
+                                    ActionGroups.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetAllSegmentsRequest : public PlayFabBaseModel
@@ -6686,6 +10407,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetAllSegmentsRequest(GetAllSegmentsRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetAllSegmentsRequest& operator=(const GetAllSegmentsRequest& src) = default;
+            GetAllSegmentsRequest& operator=(GetAllSegmentsRequest&& src) = default;
+
             GetAllSegmentsRequest(const rapidjson::Value& obj) : GetAllSegmentsRequest()
             {
                 readFromValue(obj);
@@ -6706,6 +10434,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetSegmentResult : public PlayFabBaseModel
@@ -6728,6 +10462,16 @@ namespace PlayFabComboSdk
                 ABTestParent(src.ABTestParent)
             {}
 
+            GetSegmentResult(GetSegmentResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Id(AZStd::move(src.Id)),
+                Name(AZStd::move(src.Name)),
+                ABTestParent(AZStd::move(src.ABTestParent))
+            {}
+
+            GetSegmentResult& operator=(const GetSegmentResult& src) = default;
+            GetSegmentResult& operator=(GetSegmentResult&& src) = default;
+
             GetSegmentResult(const rapidjson::Value& obj) : GetSegmentResult()
             {
                 readFromValue(obj);
@@ -6764,11 +10508,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ABTestParent"):
+                            if (strcmp(member, "ABTestParent") != 0)
+                                break;
+                            ABTestParent = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetAllSegmentsResult : public PlayFabBaseModel
         {
-            std::list<GetSegmentResult> Segments;
+            std::vector<GetSegmentResult> Segments;
 
             GetAllSegmentsResult() :
                 PlayFabBaseModel(),
@@ -6780,6 +10557,14 @@ namespace PlayFabComboSdk
                 Segments(src.Segments)
             {}
 
+            GetAllSegmentsResult(GetAllSegmentsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Segments(AZStd::move(src.Segments))
+            {}
+
+            GetAllSegmentsResult& operator=(const GetAllSegmentsResult& src) = default;
+            GetAllSegmentsResult& operator=(GetAllSegmentsResult&& src) = default;
+
             GetAllSegmentsResult(const rapidjson::Value& obj) : GetAllSegmentsResult()
             {
                 readFromValue(obj);
@@ -6795,7 +10580,7 @@ namespace PlayFabComboSdk
                 if (!Segments.empty()) {
                     writer.String("Segments");
                     writer.StartArray();
-                    for (std::list<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
+                    for (std::vector<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6808,13 +10593,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Segments_member = obj.FindMember("Segments");
                 if (Segments_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Segments_member->value;
+                    Segments.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Segments.push_back(GetSegmentResult(memberList[i]));
+                        Segments.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Segments"):
+                            if (strcmp(member, "Segments") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Segments.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Segments.emplace_back();
+                                    Segments.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCatalogItemsRequest : public PlayFabBaseModel
@@ -6831,6 +10648,14 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            GetCatalogItemsRequest(GetCatalogItemsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            GetCatalogItemsRequest& operator=(const GetCatalogItemsRequest& src) = default;
+            GetCatalogItemsRequest& operator=(GetCatalogItemsRequest&& src) = default;
+
             GetCatalogItemsRequest(const rapidjson::Value& obj) : GetCatalogItemsRequest()
             {
                 readFromValue(obj);
@@ -6857,11 +10682,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCatalogItemsResult : public PlayFabBaseModel
         {
-            std::list<CatalogItem> Catalog;
+            std::vector<CatalogItem> Catalog;
 
             GetCatalogItemsResult() :
                 PlayFabBaseModel(),
@@ -6873,6 +10721,14 @@ namespace PlayFabComboSdk
                 Catalog(src.Catalog)
             {}
 
+            GetCatalogItemsResult(GetCatalogItemsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Catalog(AZStd::move(src.Catalog))
+            {}
+
+            GetCatalogItemsResult& operator=(const GetCatalogItemsResult& src) = default;
+            GetCatalogItemsResult& operator=(GetCatalogItemsResult&& src) = default;
+
             GetCatalogItemsResult(const rapidjson::Value& obj) : GetCatalogItemsResult()
             {
                 readFromValue(obj);
@@ -6888,7 +10744,7 @@ namespace PlayFabComboSdk
                 if (!Catalog.empty()) {
                     writer.String("Catalog");
                     writer.StartArray();
-                    for (std::list<CatalogItem>::iterator iter = Catalog.begin(); iter != Catalog.end(); iter++) {
+                    for (std::vector<CatalogItem>::iterator iter = Catalog.begin(); iter != Catalog.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -6901,20 +10757,52 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Catalog_member = obj.FindMember("Catalog");
                 if (Catalog_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Catalog_member->value;
+                    Catalog.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Catalog.push_back(CatalogItem(memberList[i]));
+                        Catalog.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Catalog"):
+                            if (strcmp(member, "Catalog") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Catalog.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Catalog.emplace_back();
+                                    Catalog.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string CharacterId;
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
             OptionalUint32 IfChangedFromDataVersion;
 
             GetCharacterDataRequest() :
@@ -6933,6 +10821,17 @@ namespace PlayFabComboSdk
                 IfChangedFromDataVersion(src.IfChangedFromDataVersion)
             {}
 
+            GetCharacterDataRequest(GetCharacterDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Keys(AZStd::move(src.Keys)),
+                IfChangedFromDataVersion(AZStd::move(src.IfChangedFromDataVersion))
+            {}
+
+            GetCharacterDataRequest& operator=(const GetCharacterDataRequest& src) = default;
+            GetCharacterDataRequest& operator=(GetCharacterDataRequest&& src) = default;
+
             GetCharacterDataRequest(const rapidjson::Value& obj) : GetCharacterDataRequest()
             {
                 readFromValue(obj);
@@ -6952,7 +10851,7 @@ namespace PlayFabComboSdk
                 if (!Keys.empty()) {
                     writer.String("Keys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -6973,8 +10872,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator IfChangedFromDataVersion_member = obj.FindMember("IfChangedFromDataVersion");
@@ -6982,6 +10882,51 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("IfChangedFromDataVersion"):
+                            if (strcmp(member, "IfChangedFromDataVersion") != 0)
+                                break;
+                            IfChangedFromDataVersion = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum UserDataPermission
@@ -7006,19 +10951,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<UserDataPermission>(obj.GetInt());
 
-            static std::map<const char *, UserDataPermission, PlayFabComboSdk::StringCompare> _UserDataPermissionMap;
-            if (_UserDataPermissionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _UserDataPermissionMap["Private"] = UserDataPermissionPrivate;
-                _UserDataPermissionMap["Public"] = UserDataPermissionPublic;
-
+            case PlayFabJsonReader::Hash("Private"): if (strcmp(name, "Private") == 0) return UserDataPermissionPrivate; break;
+            case PlayFabJsonReader::Hash("Public"): if (strcmp(name, "Public") == 0) return UserDataPermissionPublic; break;
             }
 
-            auto output = _UserDataPermissionMap.find(obj.GetString());
-            if (output != _UserDataPermissionMap.end())
-                return output->second;
-
             return UserDataPermissionPrivate; // Basically critical fail
         }
 
@@ -7042,6 +10982,16 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            UserDataRecord(UserDataRecord&& src) noexcept :
+                PlayFabBaseModel(),
+                Value(AZStd::move(src.Value)),
+                LastUpdated(AZStd::move(src.LastUpdated)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            UserDataRecord& operator=(const UserDataRecord& src) = default;
+            UserDataRecord& operator=(UserDataRecord&& src) = default;
+
             UserDataRecord(const rapidjson::Value& obj) : UserDataRecord()
             {
                 readFromValue(obj);
@@ -7078,13 +11028,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
-        };
 
-        struct GetCharacterDataResult : public PlayFabBaseModel
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("LastUpdated"):
+                            if (strcmp(member, "LastUpdated") != 0)
+                                break;
+                            LastUpdated = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
+        };
+
+        struct GetCharacterDataResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             Uint32 DataVersion;
-            std::map<AZStd::string, UserDataRecord> Data;
+            PlayFabStringMap<UserDataRecord> Data;
             AZStd::string CharacterId;
 
             GetCharacterDataResult() :
@@ -7103,6 +11086,17 @@ namespace PlayFabComboSdk
                 CharacterId(src.CharacterId)
             {}
 
+            GetCharacterDataResult(GetCharacterDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                DataVersion(AZStd::move(src.DataVersion)),
+                Data(AZStd::move(src.Data)),
+                CharacterId(AZStd::move(src.CharacterId))
+            {}
+
+            GetCharacterDataResult& operator=(const GetCharacterDataResult& src) = default;
+            GetCharacterDataResult& operator=(GetCharacterDataResult&& src) = default;
+
             GetCharacterDataResult(const rapidjson::Value& obj) : GetCharacterDataResult()
             {
                 readFromValue(obj);
@@ -7124,7 +11118,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, UserDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<UserDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -7154,6 +11148,51 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DataVersion"):
+                            if (strcmp(member, "DataVersion") != 0)
+                                break;
+                            DataVersion = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterInventoryRequest : public PlayFabBaseModel
@@ -7176,6 +11215,16 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            GetCharacterInventoryRequest(GetCharacterInventoryRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            GetCharacterInventoryRequest& operator=(const GetCharacterInventoryRequest& src) = default;
+            GetCharacterInventoryRequest& operator=(GetCharacterInventoryRequest&& src) = default;
+
             GetCharacterInventoryRequest(const rapidjson::Value& obj) : GetCharacterInventoryRequest()
             {
                 readFromValue(obj);
@@ -7210,6 +11259,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct VirtualCurrencyRechargeTime : public PlayFabBaseModel
@@ -7232,6 +11314,16 @@ namespace PlayFabComboSdk
                 RechargeMax(src.RechargeMax)
             {}
 
+            VirtualCurrencyRechargeTime(VirtualCurrencyRechargeTime&& src) noexcept :
+                PlayFabBaseModel(),
+                SecondsToRecharge(AZStd::move(src.SecondsToRecharge)),
+                RechargeTime(AZStd::move(src.RechargeTime)),
+                RechargeMax(AZStd::move(src.RechargeMax))
+            {}
+
+            VirtualCurrencyRechargeTime& operator=(const VirtualCurrencyRechargeTime& src) = default;
+            VirtualCurrencyRechargeTime& operator=(VirtualCurrencyRechargeTime&& src) = default;
+
             VirtualCurrencyRechargeTime(const rapidjson::Value& obj) : VirtualCurrencyRechargeTime()
             {
                 readFromValue(obj);
@@ -7264,15 +11356,48 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SecondsToRecharge"):
+                            if (strcmp(member, "SecondsToRecharge") != 0)
+                                break;
+                            SecondsToRecharge = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeTime"):
+                            if (strcmp(member, "RechargeTime") != 0)
+                                break;
+                            RechargeTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RechargeMax"):
+                            if (strcmp(member, "RechargeMax") != 0)
+                                break;
+                            RechargeMax = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterInventoryResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string CharacterId;
-            std::list<ItemInstance> Inventory;
-            std::map<AZStd::string, Int32> VirtualCurrency;
-            std::map<AZStd::string, VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
+            std::vector<ItemInstance> Inventory;
+            PlayFabStringMap<Int32> VirtualCurrency;
+            PlayFabStringMap<VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
 
             GetCharacterInventoryResult() :
                 PlayFabBaseModel(),
@@ -7292,6 +11417,18 @@ namespace PlayFabComboSdk
                 VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+            GetCharacterInventoryResult(GetCharacterInventoryResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Inventory(AZStd::move(src.Inventory)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                VirtualCurrencyRechargeTimes(AZStd::move(src.VirtualCurrencyRechargeTimes))
+            {}
+
+            GetCharacterInventoryResult& operator=(const GetCharacterInventoryResult& src) = default;
+            GetCharacterInventoryResult& operator=(GetCharacterInventoryResult&& src) = default;
+
             GetCharacterInventoryResult(const rapidjson::Value& obj) : GetCharacterInventoryResult()
             {
                 readFromValue(obj);
@@ -7315,7 +11452,7 @@ namespace PlayFabComboSdk
                 if (!Inventory.empty()) {
                     writer.String("Inventory");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7323,7 +11460,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrency.empty()) {
                     writer.String("VirtualCurrency");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -7332,7 +11469,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyRechargeTimes.empty()) {
                     writer.String("VirtualCurrencyRechargeTimes");
                     writer.StartObject();
-                    for (std::map<AZStd::string, VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
+                    for (PlayFabStringMap<VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -7350,8 +11487,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Inventory_member = obj.FindMember("Inventory");
                 if (Inventory_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Inventory_member->value;
+                    Inventory.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Inventory.push_back(ItemInstance(memberList[i]));
+                        Inventory.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrency_member = obj.FindMember("VirtualCurrency");
@@ -7369,6 +11507,71 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Inventory"):
+                            if (strcmp(member, "Inventory") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Inventory.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Inventory.emplace_back();
+                                    Inventory.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrency[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+                            if (strcmp(member, "VirtualCurrencyRechargeTimes") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyRechargeTimes[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterLeaderboardRequest : public PlayFabBaseModel
@@ -7397,6 +11600,18 @@ namespace PlayFabComboSdk
                 MaxResultsCount(src.MaxResultsCount)
             {}
 
+            GetCharacterLeaderboardRequest(GetCharacterLeaderboardRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CharacterType(AZStd::move(src.CharacterType)),
+                StatisticName(AZStd::move(src.StatisticName)),
+                StartPosition(AZStd::move(src.StartPosition)),
+                MaxResultsCount(AZStd::move(src.MaxResultsCount))
+            {}
+
+            GetCharacterLeaderboardRequest& operator=(const GetCharacterLeaderboardRequest& src) = default;
+            GetCharacterLeaderboardRequest& operator=(GetCharacterLeaderboardRequest&& src) = default;
+
             GetCharacterLeaderboardRequest(const rapidjson::Value& obj) : GetCharacterLeaderboardRequest()
             {
                 readFromValue(obj);
@@ -7439,11 +11654,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterType"):
+                            if (strcmp(member, "CharacterType") != 0)
+                                break;
+                            CharacterType = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StartPosition"):
+                            if (strcmp(member, "StartPosition") != 0)
+                                break;
+                            StartPosition = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxResultsCount"):
+                            if (strcmp(member, "MaxResultsCount") != 0)
+                                break;
+                            MaxResultsCount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterLeaderboardResult : public PlayFabBaseModel
         {
-            std::list<CharacterLeaderboardEntry> Leaderboard;
+            std::vector<CharacterLeaderboardEntry> Leaderboard;
 
             GetCharacterLeaderboardResult() :
                 PlayFabBaseModel(),
@@ -7455,6 +11713,14 @@ namespace PlayFabComboSdk
                 Leaderboard(src.Leaderboard)
             {}
 
+            GetCharacterLeaderboardResult(GetCharacterLeaderboardResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Leaderboard(AZStd::move(src.Leaderboard))
+            {}
+
+            GetCharacterLeaderboardResult& operator=(const GetCharacterLeaderboardResult& src) = default;
+            GetCharacterLeaderboardResult& operator=(GetCharacterLeaderboardResult&& src) = default;
+
             GetCharacterLeaderboardResult(const rapidjson::Value& obj) : GetCharacterLeaderboardResult()
             {
                 readFromValue(obj);
@@ -7470,7 +11736,7 @@ namespace PlayFabComboSdk
                 if (!Leaderboard.empty()) {
                     writer.String("Leaderboard");
                     writer.StartArray();
-                    for (std::list<CharacterLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
+                    for (std::vector<CharacterLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -7483,13 +11749,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Leaderboard_member = obj.FindMember("Leaderboard");
                 if (Leaderboard_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Leaderboard_member->value;
+                    Leaderboard.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Leaderboard.push_back(CharacterLeaderboardEntry(memberList[i]));
+                        Leaderboard.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Leaderboard"):
+                            if (strcmp(member, "Leaderboard") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Leaderboard.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Leaderboard.emplace_back();
+                                    Leaderboard.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterStatisticsRequest : public PlayFabBaseModel
@@ -7509,6 +11807,15 @@ namespace PlayFabComboSdk
                 CharacterId(src.CharacterId)
             {}
 
+            GetCharacterStatisticsRequest(GetCharacterStatisticsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId))
+            {}
+
+            GetCharacterStatisticsRequest& operator=(const GetCharacterStatisticsRequest& src) = default;
+            GetCharacterStatisticsRequest& operator=(GetCharacterStatisticsRequest&& src) = default;
+
             GetCharacterStatisticsRequest(const rapidjson::Value& obj) : GetCharacterStatisticsRequest()
             {
                 readFromValue(obj);
@@ -7537,13 +11844,41 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetCharacterStatisticsResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string CharacterId;
-            std::map<AZStd::string, Int32> CharacterStatistics;
+            PlayFabStringMap<Int32> CharacterStatistics;
 
             GetCharacterStatisticsResult() :
                 PlayFabBaseModel(),
@@ -7559,6 +11894,16 @@ namespace PlayFabComboSdk
                 CharacterStatistics(src.CharacterStatistics)
             {}
 
+            GetCharacterStatisticsResult(GetCharacterStatisticsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CharacterStatistics(AZStd::move(src.CharacterStatistics))
+            {}
+
+            GetCharacterStatisticsResult& operator=(const GetCharacterStatisticsResult& src) = default;
+            GetCharacterStatisticsResult& operator=(GetCharacterStatisticsResult&& src) = default;
+
             GetCharacterStatisticsResult(const rapidjson::Value& obj) : GetCharacterStatisticsResult()
             {
                 readFromValue(obj);
@@ -7582,7 +11927,7 @@ namespace PlayFabComboSdk
                 if (!CharacterStatistics.empty()) {
                     writer.String("CharacterStatistics");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = CharacterStatistics.begin(); iter != CharacterStatistics.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = CharacterStatistics.begin(); iter != CharacterStatistics.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -7606,6 +11951,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterStatistics"):
+                            if (strcmp(member, "CharacterStatistics") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CharacterStatistics[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetContentDownloadUrlRequest : public PlayFabBaseModel
@@ -7628,6 +12013,16 @@ namespace PlayFabComboSdk
                 ThruCDN(src.ThruCDN)
             {}
 
+            GetContentDownloadUrlRequest(GetContentDownloadUrlRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                HttpMethod(AZStd::move(src.HttpMethod)),
+                ThruCDN(AZStd::move(src.ThruCDN))
+            {}
+
+            GetContentDownloadUrlRequest& operator=(const GetContentDownloadUrlRequest& src) = default;
+            GetContentDownloadUrlRequest& operator=(GetContentDownloadUrlRequest&& src) = default;
+
             GetContentDownloadUrlRequest(const rapidjson::Value& obj) : GetContentDownloadUrlRequest()
             {
                 readFromValue(obj);
@@ -7664,6 +12059,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("HttpMethod"):
+                            if (strcmp(member, "HttpMethod") != 0)
+                                break;
+                            HttpMethod = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ThruCDN"):
+                            if (strcmp(member, "ThruCDN") != 0)
+                                break;
+                            ThruCDN = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetContentDownloadUrlResult : public PlayFabBaseModel
@@ -7680,6 +12108,14 @@ namespace PlayFabComboSdk
                 URL(src.URL)
             {}
 
+            GetContentDownloadUrlResult(GetContentDownloadUrlResult&& src) noexcept :
+                PlayFabBaseModel(),
+                URL(AZStd::move(src.URL))
+            {}
+
+            GetContentDownloadUrlResult& operator=(const GetContentDownloadUrlResult& src) = default;
+            GetContentDownloadUrlResult& operator=(GetContentDownloadUrlResult&& src) = default;
+
             GetContentDownloadUrlResult(const rapidjson::Value& obj) : GetContentDownloadUrlResult()
             {
                 readFromValue(obj);
@@ -7706,6 +12142,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("URL"):
+                            if (strcmp(member, "URL") != 0)
+                                break;
+                            URL = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerProfileViewConstraints : public PlayFabBaseModel
@@ -7761,6 +12220,27 @@ namespace PlayFabComboSdk
                 ShowAvatarUrl(src.ShowAvatarUrl)
             {}
 
+            PlayerProfileViewConstraints(PlayerProfileViewConstraints&& src) noexcept :
+                PlayFabBaseModel(),
+                ShowDisplayName(AZStd::move(src.ShowDisplayName)),
+                ShowCreated(AZStd::move(src.ShowCreated)),
+                ShowOrigination(AZStd::move(src.ShowOrigination)),
+                ShowLastLogin(AZStd::move(src.ShowLastLogin)),
+                ShowBannedUntil(AZStd::move(src.ShowBannedUntil)),
+                ShowStatistics(AZStd::move(src.ShowStatistics)),
+                ShowCampaignAttributions(AZStd::move(src.ShowCampaignAttributions)),
+                ShowPushNotificationRegistrations(AZStd::move(src.ShowPushNotificationRegistrations)),
+                ShowLinkedAccounts(AZStd::move(src.ShowLinkedAccounts)),
+                ShowTotalValueToDateInUsd(AZStd::move(src.ShowTotalValueToDateInUsd)),
+                ShowValuesToDate(AZStd::move(src.ShowValuesToDate)),
+                ShowTags(AZStd::move(src.ShowTags)),
+                ShowLocations(AZStd::move(src.ShowLocations)),
+                ShowAvatarUrl(AZStd::move(src.ShowAvatarUrl))
+            {}
+
+            PlayerProfileViewConstraints& operator=(const PlayerProfileViewConstraints& src) = default;
+            PlayerProfileViewConstraints& operator=(PlayerProfileViewConstraints&& src) = default;
+
             PlayerProfileViewConstraints(const rapidjson::Value& obj) : PlayerProfileViewConstraints()
             {
                 readFromValue(obj);
@@ -7837,6 +12317,94 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ShowDisplayName"):
+                            if (strcmp(member, "ShowDisplayName") != 0)
+                                break;
+                            ShowDisplayName = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowCreated"):
+                            if (strcmp(member, "ShowCreated") != 0)
+                                break;
+                            ShowCreated = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowOrigination"):
+                            if (strcmp(member, "ShowOrigination") != 0)
+                                break;
+                            ShowOrigination = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowLastLogin"):
+                            if (strcmp(member, "ShowLastLogin") != 0)
+                                break;
+                            ShowLastLogin = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowBannedUntil"):
+                            if (strcmp(member, "ShowBannedUntil") != 0)
+                                break;
+                            ShowBannedUntil = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowStatistics"):
+                            if (strcmp(member, "ShowStatistics") != 0)
+                                break;
+                            ShowStatistics = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowCampaignAttributions"):
+                            if (strcmp(member, "ShowCampaignAttributions") != 0)
+                                break;
+                            ShowCampaignAttributions = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowPushNotificationRegistrations"):
+                            if (strcmp(member, "ShowPushNotificationRegistrations") != 0)
+                                break;
+                            ShowPushNotificationRegistrations = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowLinkedAccounts"):
+                            if (strcmp(member, "ShowLinkedAccounts") != 0)
+                                break;
+                            ShowLinkedAccounts = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowTotalValueToDateInUsd"):
+                            if (strcmp(member, "ShowTotalValueToDateInUsd") != 0)
+                                break;
+                            ShowTotalValueToDateInUsd = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowValuesToDate"):
+                            if (strcmp(member, "ShowValuesToDate") != 0)
+                                break;
+                            ShowValuesToDate = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowTags"):
+                            if (strcmp(member, "ShowTags") != 0)
+                                break;
+                            ShowTags = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowLocations"):
+                            if (strcmp(member, "ShowLocations") != 0)
+                                break;
+                            ShowLocations = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ShowAvatarUrl"):
+                            if (strcmp(member, "ShowAvatarUrl") != 0)
+                                break;
+                            ShowAvatarUrl = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetFriendLeaderboardRequest : public PlayFabBaseModel
@@ -7874,6 +12442,45 @@ namespace PlayFabComboSdk
                 ProfileConstraints(src.ProfileConstraints ? new PlayerProfileViewConstraints(*src.ProfileConstraints) : nullptr)
             {}
 
+            GetFriendLeaderboardRequest(GetFriendLeaderboardRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                StatisticName(AZStd::move(src.StatisticName)),
+                StartPosition(AZStd::move(src.StartPosition)),
+                MaxResultsCount(AZStd::move(src.MaxResultsCount)),
+                IncludeSteamFriends(AZStd::move(src.IncludeSteamFriends)),
+                IncludeFacebookFriends(AZStd::move(src.IncludeFacebookFriends)),
+                Version(AZStd::move(src.Version)),
+                ProfileConstraints(src.ProfileConstraints)
+            {
+                src.ProfileConstraints = nullptr;
+            }
+
+            GetFriendLeaderboardRequest& operator=(const GetFriendLeaderboardRequest& src)
+            {
+                if (this != &src)
+                    *this = GetFriendLeaderboardRequest(src);
+                return *this;
+            }
+
+            GetFriendLeaderboardRequest& operator=(GetFriendLeaderboardRequest&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    StatisticName = AZStd::move(src.StatisticName);
+                    StartPosition = AZStd::move(src.StartPosition);
+                    MaxResultsCount = AZStd::move(src.MaxResultsCount);
+                    IncludeSteamFriends = AZStd::move(src.IncludeSteamFriends);
+                    IncludeFacebookFriends = AZStd::move(src.IncludeFacebookFriends);
+                    Version = AZStd::move(src.Version);
+                    if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                    ProfileConstraints = src.ProfileConstraints;
+                    src.ProfileConstraints = nullptr;
+                }
+                return *this;
+            }
+
             GetFriendLeaderboardRequest(const rapidjson::Value& obj) : GetFriendLeaderboardRequest()
             {
                 readFromValue(obj);
@@ -7935,6 +12542,65 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StartPosition"):
+                            if (strcmp(member, "StartPosition") != 0)
+                                break;
+                            StartPosition = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxResultsCount"):
+                            if (strcmp(member, "MaxResultsCount") != 0)
+                                break;
+                            MaxResultsCount = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("IncludeSteamFriends"):
+                            if (strcmp(member, "IncludeSteamFriends") != 0)
+                                break;
+                            IncludeSteamFriends = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("IncludeFacebookFriends"):
+                            if (strcmp(member, "IncludeFacebookFriends") != 0)
+                                break;
+                            IncludeFacebookFriends = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProfileConstraints"):
+                            if (strcmp(member, "ProfileConstraints") != 0)
+                                break;
+                            ProfileConstraints = new PlayerProfileViewConstraints;
+                            ProfileConstraints->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetFriendsListRequest : public PlayFabBaseModel
@@ -7960,6 +12626,37 @@ namespace PlayFabComboSdk
                 ProfileConstraints(src.ProfileConstraints ? new PlayerProfileViewConstraints(*src.ProfileConstraints) : nullptr)
             {}
 
+            GetFriendsListRequest(GetFriendsListRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                IncludeSteamFriends(AZStd::move(src.IncludeSteamFriends)),
+                IncludeFacebookFriends(AZStd::move(src.IncludeFacebookFriends)),
+                ProfileConstraints(src.ProfileConstraints)
+            {
+                src.ProfileConstraints = nullptr;
+            }
+
+            GetFriendsListRequest& operator=(const GetFriendsListRequest& src)
+            {
+                if (this != &src)
+                    *this = GetFriendsListRequest(src);
+                return *this;
+            }
+
+            GetFriendsListRequest& operator=(GetFriendsListRequest&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    IncludeSteamFriends = AZStd::move(src.IncludeSteamFriends);
+                    IncludeFacebookFriends = AZStd::move(src.IncludeFacebookFriends);
+                    if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                    ProfileConstraints = src.ProfileConstraints;
+                    src.ProfileConstraints = nullptr;
+                }
+                return *this;
+            }
+
             GetFriendsListRequest(const rapidjson::Value& obj) : GetFriendsListRequest()
             {
                 readFromValue(obj);
@@ -8003,11 +12700,50 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("IncludeSteamFriends"):
+                            if (strcmp(member, "IncludeSteamFriends") != 0)
+                                break;
+                            IncludeSteamFriends = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("IncludeFacebookFriends"):
+                            if (strcmp(member, "IncludeFacebookFriends") != 0)
+                                break;
+                            IncludeFacebookFriends = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProfileConstraints"):
+                            if (strcmp(member, "ProfileConstraints") != 0)
+                                break;
+                            ProfileConstraints = new PlayerProfileViewConstraints;
+                            ProfileConstraints->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetFriendsListResult : public PlayFabBaseModel
         {
-            std::list<FriendInfo> Friends;
+            std::vector<FriendInfo> Friends;
 
             GetFriendsListResult() :
                 PlayFabBaseModel(),
@@ -8019,6 +12755,14 @@ namespace PlayFabComboSdk
                 Friends(src.Friends)
             {}
 
+            GetFriendsListResult(GetFriendsListResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Friends(AZStd::move(src.Friends))
+            {}
+
+            GetFriendsListResult& operator=(const GetFriendsListResult& src) = default;
+            GetFriendsListResult& operator=(GetFriendsListResult&& src) = default;
+
             GetFriendsListResult(const rapidjson::Value& obj) : GetFriendsListResult()
             {
                 readFromValue(obj);
@@ -8034,7 +12778,7 @@ namespace PlayFabComboSdk
                 if (!Friends.empty()) {
                     writer.String("Friends");
                     writer.StartArray();
-                    for (std::list<FriendInfo>::iterator iter = Friends.begin(); iter != Friends.end(); iter++) {
+                    for (std::vector<FriendInfo>::iterator iter = Friends.begin(); iter != Friends.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -8047,13 +12791,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Friends_member = obj.FindMember("Friends");
                 if (Friends_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Friends_member->value;
+                    Friends.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Friends.push_back(FriendInfo(memberList[i]));
+                        Friends.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Friends"):
+                            if (strcmp(member, "Friends") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Friends.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Friends.emplace_back();
+                                    Friends.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardAroundCharacterRequest : public PlayFabBaseModel
@@ -8082,6 +12858,18 @@ namespace PlayFabComboSdk
                 MaxResultsCount(src.MaxResultsCount)
             {}
 
+            GetLeaderboardAroundCharacterRequest(GetLeaderboardAroundCharacterRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CharacterType(AZStd::move(src.CharacterType)),
+                MaxResultsCount(AZStd::move(src.MaxResultsCount))
+            {}
+
+            GetLeaderboardAroundCharacterRequest& operator=(const GetLeaderboardAroundCharacterRequest& src) = default;
+            GetLeaderboardAroundCharacterRequest& operator=(GetLeaderboardAroundCharacterRequest&& src) = default;
+
             GetLeaderboardAroundCharacterRequest(const rapidjson::Value& obj) : GetLeaderboardAroundCharacterRequest()
             {
                 readFromValue(obj);
@@ -8124,11 +12912,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterType"):
+                            if (strcmp(member, "CharacterType") != 0)
+                                break;
+                            CharacterType = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxResultsCount"):
+                            if (strcmp(member, "MaxResultsCount") != 0)
+                                break;
+                            MaxResultsCount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardAroundCharacterResult : public PlayFabBaseModel
         {
-            std::list<CharacterLeaderboardEntry> Leaderboard;
+            std::vector<CharacterLeaderboardEntry> Leaderboard;
 
             GetLeaderboardAroundCharacterResult() :
                 PlayFabBaseModel(),
@@ -8140,6 +12971,14 @@ namespace PlayFabComboSdk
                 Leaderboard(src.Leaderboard)
             {}
 
+            GetLeaderboardAroundCharacterResult(GetLeaderboardAroundCharacterResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Leaderboard(AZStd::move(src.Leaderboard))
+            {}
+
+            GetLeaderboardAroundCharacterResult& operator=(const GetLeaderboardAroundCharacterResult& src) = default;
+            GetLeaderboardAroundCharacterResult& operator=(GetLeaderboardAroundCharacterResult&& src) = default;
+
             GetLeaderboardAroundCharacterResult(const rapidjson::Value& obj) : GetLeaderboardAroundCharacterResult()
             {
                 readFromValue(obj);
@@ -8155,7 +12994,7 @@ namespace PlayFabComboSdk
                 if (!Leaderboard.empty()) {
                     writer.String("Leaderboard");
                     writer.StartArray();
-                    for (std::list<CharacterLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
+                    for (std::vector<CharacterLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -8168,13 +13007,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Leaderboard_member = obj.FindMember("Leaderboard");
                 if (Leaderboard_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Leaderboard_member->value;
+                    Leaderboard.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Leaderboard.push_back(CharacterLeaderboardEntry(memberList[i]));
+                        Leaderboard.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Leaderboard"):
+                            if (strcmp(member, "Leaderboard") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Leaderboard.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Leaderboard.emplace_back();
+                                    Leaderboard.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardAroundUserRequest : public PlayFabBaseModel
@@ -8203,6 +13074,39 @@ namespace PlayFabComboSdk
                 Version(src.Version)
             {}
 
+            GetLeaderboardAroundUserRequest(GetLeaderboardAroundUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                MaxResultsCount(AZStd::move(src.MaxResultsCount)),
+                ProfileConstraints(src.ProfileConstraints),
+                Version(AZStd::move(src.Version))
+            {
+                src.ProfileConstraints = nullptr;
+            }
+
+            GetLeaderboardAroundUserRequest& operator=(const GetLeaderboardAroundUserRequest& src)
+            {
+                if (this != &src)
+                    *this = GetLeaderboardAroundUserRequest(src);
+                return *this;
+            }
+
+            GetLeaderboardAroundUserRequest& operator=(GetLeaderboardAroundUserRequest&& src)
+            {
+                if (this != &src)
+                {
+                    StatisticName = AZStd::move(src.StatisticName);
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    MaxResultsCount = AZStd::move(src.MaxResultsCount);
+                    if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                    ProfileConstraints = src.ProfileConstraints;
+                    src.ProfileConstraints = nullptr;
+                    Version = AZStd::move(src.Version);
+                }
+                return *this;
+            }
+
             GetLeaderboardAroundUserRequest(const rapidjson::Value& obj) : GetLeaderboardAroundUserRequest()
             {
                 readFromValue(obj);
@@ -8248,6 +13152,50 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxResultsCount"):
+                            if (strcmp(member, "MaxResultsCount") != 0)
+                                break;
+                            MaxResultsCount = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProfileConstraints"):
+                            if (strcmp(member, "ProfileConstraints") != 0)
+                                break;
+                            ProfileConstraints = new PlayerProfileViewConstraints;
+                            ProfileConstraints->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerLeaderboardEntry : public PlayFabBaseModel
@@ -8276,6 +13224,39 @@ namespace PlayFabComboSdk
                 Profile(src.Profile ? new PlayerProfileModel(*src.Profile) : nullptr)
             {}
 
+            PlayerLeaderboardEntry(PlayerLeaderboardEntry&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                StatValue(AZStd::move(src.StatValue)),
+                Position(AZStd::move(src.Position)),
+                Profile(src.Profile)
+            {
+                src.Profile = nullptr;
+            }
+
+            PlayerLeaderboardEntry& operator=(const PlayerLeaderboardEntry& src)
+            {
+                if (this != &src)
+                    *this = PlayerLeaderboardEntry(src);
+                return *this;
+            }
+
+            PlayerLeaderboardEntry& operator=(PlayerLeaderboardEntry&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    DisplayName = AZStd::move(src.DisplayName);
+                    StatValue = AZStd::move(src.StatValue);
+                    Position = AZStd::move(src.Position);
+                    if (Profile != nullptr) delete Profile;
+                    Profile = src.Profile;
+                    src.Profile = nullptr;
+                }
+                return *this;
+            }
+
             PlayerLeaderboardEntry(const rapidjson::Value& obj) : PlayerLeaderboardEntry()
             {
                 readFromValue(obj);
@@ -8323,11 +13304,55 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatValue"):
+                            if (strcmp(member, "StatValue") != 0)
+                                break;
+                            StatValue = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Position"):
+                            if (strcmp(member, "Position") != 0)
+                                break;
+                            Position = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Profile"):
+                            if (strcmp(member, "Profile") != 0)
+                                break;
+                            Profile = new PlayerProfileModel;
+                            Profile->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardAroundUserResult : public PlayFabBaseModel
         {
-            std::list<PlayerLeaderboardEntry> Leaderboard;
+            std::vector<PlayerLeaderboardEntry> Leaderboard;
             Int32 Version;
             OptionalTime NextReset;
 
@@ -8345,6 +13370,16 @@ namespace PlayFabComboSdk
                 NextReset(src.NextReset)
             {}
 
+            GetLeaderboardAroundUserResult(GetLeaderboardAroundUserResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Leaderboard(AZStd::move(src.Leaderboard)),
+                Version(AZStd::move(src.Version)),
+                NextReset(AZStd::move(src.NextReset))
+            {}
+
+            GetLeaderboardAroundUserResult& operator=(const GetLeaderboardAroundUserResult& src) = default;
+            GetLeaderboardAroundUserResult& operator=(GetLeaderboardAroundUserResult&& src) = default;
+
             GetLeaderboardAroundUserResult(const rapidjson::Value& obj) : GetLeaderboardAroundUserResult()
             {
                 readFromValue(obj);
@@ -8360,7 +13395,7 @@ namespace PlayFabComboSdk
                 if (!Leaderboard.empty()) {
                     writer.String("Leaderboard");
                     writer.StartArray();
-                    for (std::list<PlayerLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
+                    for (std::vector<PlayerLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -8379,8 +13414,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Leaderboard_member = obj.FindMember("Leaderboard");
                 if (Leaderboard_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Leaderboard_member->value;
+                    Leaderboard.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Leaderboard.push_back(PlayerLeaderboardEntry(memberList[i]));
+                        Leaderboard.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator Version_member = obj.FindMember("Version");
@@ -8390,6 +13426,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Leaderboard"):
+                            if (strcmp(member, "Leaderboard") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Leaderboard.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Leaderboard.emplace_back();
+                                    Leaderboard.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("NextReset"):
+                            if (strcmp(member, "NextReset") != 0)
+                                break;
+                            NextReset = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardForUsersCharactersRequest : public PlayFabBaseModel
@@ -8412,6 +13489,16 @@ namespace PlayFabComboSdk
                 MaxResultsCount(src.MaxResultsCount)
             {}
 
+            GetLeaderboardForUsersCharactersRequest(GetLeaderboardForUsersCharactersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                MaxResultsCount(AZStd::move(src.MaxResultsCount))
+            {}
+
+            GetLeaderboardForUsersCharactersRequest& operator=(const GetLeaderboardForUsersCharactersRequest& src) = default;
+            GetLeaderboardForUsersCharactersRequest& operator=(GetLeaderboardForUsersCharactersRequest&& src) = default;
+
             GetLeaderboardForUsersCharactersRequest(const rapidjson::Value& obj) : GetLeaderboardForUsersCharactersRequest()
             {
                 readFromValue(obj);
@@ -8444,11 +13531,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxResultsCount"):
+                            if (strcmp(member, "MaxResultsCount") != 0)
+                                break;
+                            MaxResultsCount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardForUsersCharactersResult : public PlayFabBaseModel
         {
-            std::list<CharacterLeaderboardEntry> Leaderboard;
+            std::vector<CharacterLeaderboardEntry> Leaderboard;
 
             GetLeaderboardForUsersCharactersResult() :
                 PlayFabBaseModel(),
@@ -8460,6 +13580,14 @@ namespace PlayFabComboSdk
                 Leaderboard(src.Leaderboard)
             {}
 
+            GetLeaderboardForUsersCharactersResult(GetLeaderboardForUsersCharactersResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Leaderboard(AZStd::move(src.Leaderboard))
+            {}
+
+            GetLeaderboardForUsersCharactersResult& operator=(const GetLeaderboardForUsersCharactersResult& src) = default;
+            GetLeaderboardForUsersCharactersResult& operator=(GetLeaderboardForUsersCharactersResult&& src) = default;
+
             GetLeaderboardForUsersCharactersResult(const rapidjson::Value& obj) : GetLeaderboardForUsersCharactersResult()
             {
                 readFromValue(obj);
@@ -8475,7 +13603,7 @@ namespace PlayFabComboSdk
                 if (!Leaderboard.empty()) {
                     writer.String("Leaderboard");
                     writer.StartArray();
-                    for (std::list<CharacterLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
+                    for (std::vector<CharacterLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -8488,13 +13616,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Leaderboard_member = obj.FindMember("Leaderboard");
                 if (Leaderboard_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Leaderboard_member->value;
+                    Leaderboard.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Leaderboard.push_back(CharacterLeaderboardEntry(memberList[i]));
+                        Leaderboard.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Leaderboard"):
+                            if (strcmp(member, "Leaderboard") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Leaderboard.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Leaderboard.emplace_back();
+                                    Leaderboard.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardRequest : public PlayFabBaseModel
@@ -8523,6 +13683,39 @@ namespace PlayFabComboSdk
                 Version(src.Version)
             {}
 
+            GetLeaderboardRequest(GetLeaderboardRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                StartPosition(AZStd::move(src.StartPosition)),
+                MaxResultsCount(AZStd::move(src.MaxResultsCount)),
+                ProfileConstraints(src.ProfileConstraints),
+                Version(AZStd::move(src.Version))
+            {
+                src.ProfileConstraints = nullptr;
+            }
+
+            GetLeaderboardRequest& operator=(const GetLeaderboardRequest& src)
+            {
+                if (this != &src)
+                    *this = GetLeaderboardRequest(src);
+                return *this;
+            }
+
+            GetLeaderboardRequest& operator=(GetLeaderboardRequest&& src)
+            {
+                if (this != &src)
+                {
+                    StatisticName = AZStd::move(src.StatisticName);
+                    StartPosition = AZStd::move(src.StartPosition);
+                    MaxResultsCount = AZStd::move(src.MaxResultsCount);
+                    if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                    ProfileConstraints = src.ProfileConstraints;
+                    src.ProfileConstraints = nullptr;
+                    Version = AZStd::move(src.Version);
+                }
+                return *this;
+            }
+
             GetLeaderboardRequest(const rapidjson::Value& obj) : GetLeaderboardRequest()
             {
                 readFromValue(obj);
@@ -8568,11 +13761,55 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StartPosition"):
+                            if (strcmp(member, "StartPosition") != 0)
+                                break;
+                            StartPosition = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxResultsCount"):
+                            if (strcmp(member, "MaxResultsCount") != 0)
+                                break;
+                            MaxResultsCount = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProfileConstraints"):
+                            if (strcmp(member, "ProfileConstraints") != 0)
+                                break;
+                            ProfileConstraints = new PlayerProfileViewConstraints;
+                            ProfileConstraints->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetLeaderboardResult : public PlayFabBaseModel
         {
-            std::list<PlayerLeaderboardEntry> Leaderboard;
+            std::vector<PlayerLeaderboardEntry> Leaderboard;
             Int32 Version;
             OptionalTime NextReset;
 
@@ -8590,6 +13827,16 @@ namespace PlayFabComboSdk
                 NextReset(src.NextReset)
             {}
 
+            GetLeaderboardResult(GetLeaderboardResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Leaderboard(AZStd::move(src.Leaderboard)),
+                Version(AZStd::move(src.Version)),
+                NextReset(AZStd::move(src.NextReset))
+            {}
+
+            GetLeaderboardResult& operator=(const GetLeaderboardResult& src) = default;
+            GetLeaderboardResult& operator=(GetLeaderboardResult&& src) = default;
+
             GetLeaderboardResult(const rapidjson::Value& obj) : GetLeaderboardResult()
             {
                 readFromValue(obj);
@@ -8605,7 +13852,7 @@ namespace PlayFabComboSdk
                 if (!Leaderboard.empty()) {
                     writer.String("Leaderboard");
                     writer.StartArray();
-                    for (std::list<PlayerLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
+                    for (std::vector<PlayerLeaderboardEntry>::iterator iter = Leaderboard.begin(); iter != Leaderboard.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -8624,8 +13871,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Leaderboard_member = obj.FindMember("Leaderboard");
                 if (Leaderboard_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Leaderboard_member->value;
+                    Leaderboard.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Leaderboard.push_back(PlayerLeaderboardEntry(memberList[i]));
+                        Leaderboard.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator Version_member = obj.FindMember("Version");
@@ -8635,6 +13883,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Leaderboard"):
+                            if (strcmp(member, "Leaderboard") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Leaderboard.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Leaderboard.emplace_back();
+                                    Leaderboard.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("NextReset"):
+                            if (strcmp(member, "NextReset") != 0)
+                                break;
+                            NextReset = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerCombinedInfoRequestParams : public PlayFabBaseModel
@@ -8643,15 +13932,15 @@ namespace PlayFabComboSdk
             bool GetUserInventory;
             bool GetUserVirtualCurrency;
             bool GetUserData;
-            std::list<AZStd::string> UserDataKeys;
+            std::vector<AZStd::string> UserDataKeys;
             bool GetUserReadOnlyData;
-            std::list<AZStd::string> UserReadOnlyDataKeys;
+            std::vector<AZStd::string> UserReadOnlyDataKeys;
             bool GetCharacterInventories;
             bool GetCharacterList;
             bool GetTitleData;
-            std::list<AZStd::string> TitleDataKeys;
+            std::vector<AZStd::string> TitleDataKeys;
             bool GetPlayerStatistics;
-            std::list<AZStd::string> PlayerStatisticNames;
+            std::vector<AZStd::string> PlayerStatisticNames;
             bool GetPlayerProfile;
             PlayerProfileViewConstraints* ProfileConstraints;
 
@@ -8693,19 +13982,72 @@ namespace PlayFabComboSdk
                 ProfileConstraints(src.ProfileConstraints ? new PlayerProfileViewConstraints(*src.ProfileConstraints) : nullptr)
             {}
 
-            GetPlayerCombinedInfoRequestParams(const rapidjson::Value& obj) : GetPlayerCombinedInfoRequestParams()
+            GetPlayerCombinedInfoRequestParams(GetPlayerCombinedInfoRequestParams&& src) noexcept :
+                PlayFabBaseModel(),
+                GetUserAccountInfo(AZStd::move(src.GetUserAccountInfo)),
+                GetUserInventory(AZStd::move(src.GetUserInventory)),
+                GetUserVirtualCurrency(AZStd::move(src.GetUserVirtualCurrency)),
+                GetUserData(AZStd::move(src.GetUserData)),
+                UserDataKeys(AZStd::move(src.UserDataKeys)),
+                GetUserReadOnlyData(AZStd::move(src.GetUserReadOnlyData)),
+                UserReadOnlyDataKeys(AZStd::move(src.UserReadOnlyDataKeys)),
+                GetCharacterInventories(AZStd::move(src.GetCharacterInventories)),
+                GetCharacterList(AZStd::move(src.GetCharacterList)),
+                GetTitleData(AZStd::move(src.GetTitleData)),
+                TitleDataKeys(AZStd::move(src.TitleDataKeys)),
+                GetPlayerStatistics(AZStd::move(src.GetPlayerStatistics)),
+                PlayerStatisticNames(AZStd::move(src.PlayerStatisticNames)),
+                GetPlayerProfile(AZStd::move(src.GetPlayerProfile)),
+                ProfileConstraints(src.ProfileConstraints)
             {
-                readFromValue(obj);
+                src.ProfileConstraints = nullptr;
             }
 
-            ~GetPlayerCombinedInfoRequestParams()
+            GetPlayerCombinedInfoRequestParams& operator=(const GetPlayerCombinedInfoRequestParams& src)
             {
-                if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                if (this != &src)
+                    *this = GetPlayerCombinedInfoRequestParams(src);
+                return *this;
             }
 
-            void writeJSON(PFStringJsonWriter& writer) override
+            GetPlayerCombinedInfoRequestParams& operator=(GetPlayerCombinedInfoRequestParams&& src)
             {
-                writer.StartObject();
+                if (this != &src)
+                {
+                    GetUserAccountInfo = AZStd::move(src.GetUserAccountInfo);
+                    GetUserInventory = AZStd::move(src.GetUserInventory);
+                    GetUserVirtualCurrency = AZStd::move(src.GetUserVirtualCurrency);
+                    GetUserData = AZStd::move(src.GetUserData);
+                    UserDataKeys = AZStd::move(src.UserDataKeys);
+                    GetUserReadOnlyData = AZStd::move(src.GetUserReadOnlyData);
+                    UserReadOnlyDataKeys = AZStd::move(src.UserReadOnlyDataKeys);
+                    GetCharacterInventories = AZStd::move(src.GetCharacterInventories);
+                    GetCharacterList = AZStd::move(src.GetCharacterList);
+                    GetTitleData = AZStd::move(src.GetTitleData);
+                    TitleDataKeys = AZStd::move(src.TitleDataKeys);
+                    GetPlayerStatistics = AZStd::move(src.GetPlayerStatistics);
+                    PlayerStatisticNames = AZStd::move(src.PlayerStatisticNames);
+                    GetPlayerProfile = AZStd::move(src.GetPlayerProfile);
+                    if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                    ProfileConstraints = src.ProfileConstraints;
+                    src.ProfileConstraints = nullptr;
+                }
+                return *this;
+            }
+
+            GetPlayerCombinedInfoRequestParams(const rapidjson::Value& obj) : GetPlayerCombinedInfoRequestParams()
+            {
+                readFromValue(obj);
+            }
+
+            ~GetPlayerCombinedInfoRequestParams()
+            {
+                if (ProfileConstraints != nullptr) delete ProfileConstraints;
+            }
+
+            void writeJSON(PFStringJsonWriter& writer) override
+            {
+                writer.StartObject();
                 writer.String("GetUserAccountInfo");
                 writer.Bool(GetUserAccountInfo);
                 writer.String("GetUserInventory");
@@ -8717,7 +14059,7 @@ namespace PlayFabComboSdk
                 if (!UserDataKeys.empty()) {
                     writer.String("UserDataKeys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = UserDataKeys.begin(); iter != UserDataKeys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = UserDataKeys.begin(); iter != UserDataKeys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -8727,7 +14069,7 @@ namespace PlayFabComboSdk
                 if (!UserReadOnlyDataKeys.empty()) {
                     writer.String("UserReadOnlyDataKeys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = UserReadOnlyDataKeys.begin(); iter != UserReadOnlyDataKeys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = UserReadOnlyDataKeys.begin(); iter != UserReadOnlyDataKeys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -8741,7 +14083,7 @@ namespace PlayFabComboSdk
                 if (!TitleDataKeys.empty()) {
                     writer.String("TitleDataKeys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = TitleDataKeys.begin(); iter != TitleDataKeys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = TitleDataKeys.begin(); iter != TitleDataKeys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -8751,7 +14093,7 @@ namespace PlayFabComboSdk
                 if (!PlayerStatisticNames.empty()) {
                     writer.String("PlayerStatisticNames");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = PlayerStatisticNames.begin(); iter != PlayerStatisticNames.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = PlayerStatisticNames.begin(); iter != PlayerStatisticNames.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -8778,8 +14120,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator UserDataKeys_member = obj.FindMember("UserDataKeys");
                 if (UserDataKeys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = UserDataKeys_member->value;
+                    UserDataKeys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        UserDataKeys.push_back(memberList[i].GetString());
+                        UserDataKeys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator GetUserReadOnlyData_member = obj.FindMember("GetUserReadOnlyData");
@@ -8787,8 +14130,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator UserReadOnlyDataKeys_member = obj.FindMember("UserReadOnlyDataKeys");
                 if (UserReadOnlyDataKeys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = UserReadOnlyDataKeys_member->value;
+                    UserReadOnlyDataKeys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        UserReadOnlyDataKeys.push_back(memberList[i].GetString());
+                        UserReadOnlyDataKeys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator GetCharacterInventories_member = obj.FindMember("GetCharacterInventories");
@@ -8800,8 +14144,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator TitleDataKeys_member = obj.FindMember("TitleDataKeys");
                 if (TitleDataKeys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = TitleDataKeys_member->value;
+                    TitleDataKeys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        TitleDataKeys.push_back(memberList[i].GetString());
+                        TitleDataKeys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator GetPlayerStatistics_member = obj.FindMember("GetPlayerStatistics");
@@ -8809,8 +14154,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayerStatisticNames_member = obj.FindMember("PlayerStatisticNames");
                 if (PlayerStatisticNames_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayerStatisticNames_member->value;
+                    PlayerStatisticNames.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayerStatisticNames.push_back(memberList[i].GetString());
+                        PlayerStatisticNames.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator GetPlayerProfile_member = obj.FindMember("GetPlayerProfile");
@@ -8820,6 +14166,128 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GetUserAccountInfo"):
+                            if (strcmp(member, "GetUserAccountInfo") != 0)
+                                break;
+                            GetUserAccountInfo = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("GetUserInventory"):
+                            if (strcmp(member, "GetUserInventory") != 0)
+                                break;
+                            GetUserInventory = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("GetUserVirtualCurrency"):
+                            if (strcmp(member, "GetUserVirtualCurrency") != 0)
+                                break;
+                            GetUserVirtualCurrency = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("GetUserData"):
+                            if (strcmp(member, "GetUserData") != 0)
+                                break;
+                            GetUserData = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("UserDataKeys"):
+                            if (strcmp(member, "UserDataKeys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                UserDataKeys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    UserDataKeys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("GetUserReadOnlyData"):
+                            if (strcmp(member, "GetUserReadOnlyData") != 0)
+                                break;
+                            GetUserReadOnlyData = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("UserReadOnlyDataKeys"):
+                            if (strcmp(member, "UserReadOnlyDataKeys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                UserReadOnlyDataKeys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    UserReadOnlyDataKeys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("GetCharacterInventories"):
+                            if (strcmp(member, "GetCharacterInventories") != 0)
+                                break;
+                            GetCharacterInventories = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("GetCharacterList"):
+                            if (strcmp(member, "GetCharacterList") != 0)
+                                break;
+                            GetCharacterList = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("GetTitleData"):
+                            if (strcmp(member, "GetTitleData") != 0)
+                                break;
+                            GetTitleData = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleDataKeys"):
+                            if (strcmp(member, "TitleDataKeys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                TitleDataKeys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    TitleDataKeys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("GetPlayerStatistics"):
+                            if (strcmp(member, "GetPlayerStatistics") != 0)
+                                break;
+                            GetPlayerStatistics = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerStatisticNames"):
+                            if (strcmp(member, "PlayerStatisticNames") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayerStatisticNames.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayerStatisticNames.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("GetPlayerProfile"):
+                            if (strcmp(member, "GetPlayerProfile") != 0)
+                                break;
+                            GetPlayerProfile = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProfileConstraints"):
+                            if (strcmp(member, "ProfileConstraints") != 0)
+                                break;
+                            ProfileConstraints = new PlayerProfileViewConstraints;
+                            ProfileConstraints->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerCombinedInfoRequest : public PlayFabBaseModel
@@ -8839,6 +14307,15 @@ namespace PlayFabComboSdk
                 InfoRequestParameters(src.InfoRequestParameters)
             {}
 
+            GetPlayerCombinedInfoRequest(GetPlayerCombinedInfoRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                InfoRequestParameters(AZStd::move(src.InfoRequestParameters))
+            {}
+
+            GetPlayerCombinedInfoRequest& operator=(const GetPlayerCombinedInfoRequest& src) = default;
+            GetPlayerCombinedInfoRequest& operator=(GetPlayerCombinedInfoRequest&& src) = default;
+
             GetPlayerCombinedInfoRequest(const rapidjson::Value& obj) : GetPlayerCombinedInfoRequest()
             {
                 readFromValue(obj);
@@ -8867,6 +14344,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("InfoRequestParameters"):
+                            if (strcmp(member, "InfoRequestParameters") != 0)
+                                break;
+                            InfoRequestParameters.readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct StatisticValue : public PlayFabBaseModel
@@ -8889,6 +14394,16 @@ namespace PlayFabComboSdk
                 Version(src.Version)
             {}
 
+            StatisticValue(StatisticValue&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                Value(AZStd::move(src.Value)),
+                Version(AZStd::move(src.Version))
+            {}
+
+            StatisticValue& operator=(const StatisticValue& src) = default;
+            StatisticValue& operator=(StatisticValue&& src) = default;
+
             StatisticValue(const rapidjson::Value& obj) : StatisticValue()
             {
                 readFromValue(obj);
@@ -8923,22 +14438,55 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerCombinedInfoResultPayload : public PlayFabBaseModel
         {
             UserAccountInfo* AccountInfo;
-            std::list<ItemInstance> UserInventory;
-            std::map<AZStd::string, Int32> UserVirtualCurrency;
-            std::map<AZStd::string, VirtualCurrencyRechargeTime> UserVirtualCurrencyRechargeTimes;
-            std::map<AZStd::string, UserDataRecord> UserData;
+            std::vector<ItemInstance> UserInventory;
+            PlayFabStringMap<Int32> UserVirtualCurrency;
+            PlayFabStringMap<VirtualCurrencyRechargeTime> UserVirtualCurrencyRechargeTimes;
+            PlayFabStringMap<UserDataRecord> UserData;
             Uint32 UserDataVersion;
-            std::map<AZStd::string, UserDataRecord> UserReadOnlyData;
+            PlayFabStringMap<UserDataRecord> UserReadOnlyData;
             Uint32 UserReadOnlyDataVersion;
-            std::list<CharacterResult> CharacterList;
-            std::list<CharacterInventory> CharacterInventories;
-            std::map<AZStd::string, AZStd::string> TitleData;
-            std::list<StatisticValue> PlayerStatistics;
+            std::vector<CharacterResult> CharacterList;
+            std::vector<CharacterInventory> CharacterInventories;
+            PlayFabStringMap<AZStd::string> TitleData;
+            std::vector<StatisticValue> PlayerStatistics;
             PlayerProfileModel* PlayerProfile;
 
             GetPlayerCombinedInfoResultPayload() :
@@ -8975,6 +14523,58 @@ namespace PlayFabComboSdk
                 PlayerProfile(src.PlayerProfile ? new PlayerProfileModel(*src.PlayerProfile) : nullptr)
             {}
 
+            GetPlayerCombinedInfoResultPayload(GetPlayerCombinedInfoResultPayload&& src) noexcept :
+                PlayFabBaseModel(),
+                AccountInfo(src.AccountInfo),
+                UserInventory(AZStd::move(src.UserInventory)),
+                UserVirtualCurrency(AZStd::move(src.UserVirtualCurrency)),
+                UserVirtualCurrencyRechargeTimes(AZStd::move(src.UserVirtualCurrencyRechargeTimes)),
+                UserData(AZStd::move(src.UserData)),
+                UserDataVersion(AZStd::move(src.UserDataVersion)),
+                UserReadOnlyData(AZStd::move(src.UserReadOnlyData)),
+                UserReadOnlyDataVersion(AZStd::move(src.UserReadOnlyDataVersion)),
+                CharacterList(AZStd::move(src.CharacterList)),
+                CharacterInventories(AZStd::move(src.CharacterInventories)),
+                TitleData(AZStd::move(src.TitleData)),
+                PlayerStatistics(AZStd::move(src.PlayerStatistics)),
+                PlayerProfile(src.PlayerProfile)
+            {
+                src.AccountInfo = nullptr;
+                src.PlayerProfile = nullptr;
+            }
+
+            GetPlayerCombinedInfoResultPayload& operator=(const GetPlayerCombinedInfoResultPayload& src)
+            {
+                if (this != &src)
+                    *this = GetPlayerCombinedInfoResultPayload(src);
+                return *this;
+            }
+
+            GetPlayerCombinedInfoResultPayload& operator=(GetPlayerCombinedInfoResultPayload&& src)
+            {
+                if (this != &src)
+                {
+                    if (AccountInfo != nullptr) delete AccountInfo;
+                    AccountInfo = src.AccountInfo;
+                    src.AccountInfo = nullptr;
+                    UserInventory = AZStd::move(src.UserInventory);
+                    UserVirtualCurrency = AZStd::move(src.UserVirtualCurrency);
+                    UserVirtualCurrencyRechargeTimes = AZStd::move(src.UserVirtualCurrencyRechargeTimes);
+                    UserData = AZStd::move(src.UserData);
+                    UserDataVersion = AZStd::move(src.UserDataVersion);
+                    UserReadOnlyData = AZStd::move(src.UserReadOnlyData);
+                    UserReadOnlyDataVersion = AZStd::move(src.UserReadOnlyDataVersion);
+                    CharacterList = AZStd::move(src.CharacterList);
+                    CharacterInventories = AZStd::move(src.CharacterInventories);
+                    TitleData = AZStd::move(src.TitleData);
+                    PlayerStatistics = AZStd::move(src.PlayerStatistics);
+                    if (PlayerProfile != nullptr) delete PlayerProfile;
+                    PlayerProfile = src.PlayerProfile;
+                    src.PlayerProfile = nullptr;
+                }
+                return *this;
+            }
+
             GetPlayerCombinedInfoResultPayload(const rapidjson::Value& obj) : GetPlayerCombinedInfoResultPayload()
             {
                 readFromValue(obj);
@@ -8996,7 +14596,7 @@ namespace PlayFabComboSdk
                 if (!UserInventory.empty()) {
                     writer.String("UserInventory");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = UserInventory.begin(); iter != UserInventory.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = UserInventory.begin(); iter != UserInventory.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9004,7 +14604,7 @@ namespace PlayFabComboSdk
                 if (!UserVirtualCurrency.empty()) {
                     writer.String("UserVirtualCurrency");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = UserVirtualCurrency.begin(); iter != UserVirtualCurrency.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = UserVirtualCurrency.begin(); iter != UserVirtualCurrency.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -9013,7 +14613,7 @@ namespace PlayFabComboSdk
                 if (!UserVirtualCurrencyRechargeTimes.empty()) {
                     writer.String("UserVirtualCurrencyRechargeTimes");
                     writer.StartObject();
-                    for (std::map<AZStd::string, VirtualCurrencyRechargeTime>::iterator iter = UserVirtualCurrencyRechargeTimes.begin(); iter != UserVirtualCurrencyRechargeTimes.end(); ++iter) {
+                    for (PlayFabStringMap<VirtualCurrencyRechargeTime>::iterator iter = UserVirtualCurrencyRechargeTimes.begin(); iter != UserVirtualCurrencyRechargeTimes.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -9022,7 +14622,7 @@ namespace PlayFabComboSdk
                 if (!UserData.empty()) {
                     writer.String("UserData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, UserDataRecord>::iterator iter = UserData.begin(); iter != UserData.end(); ++iter) {
+                    for (PlayFabStringMap<UserDataRecord>::iterator iter = UserData.begin(); iter != UserData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -9033,7 +14633,7 @@ namespace PlayFabComboSdk
                 if (!UserReadOnlyData.empty()) {
                     writer.String("UserReadOnlyData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, UserDataRecord>::iterator iter = UserReadOnlyData.begin(); iter != UserReadOnlyData.end(); ++iter) {
+                    for (PlayFabStringMap<UserDataRecord>::iterator iter = UserReadOnlyData.begin(); iter != UserReadOnlyData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -9044,7 +14644,7 @@ namespace PlayFabComboSdk
                 if (!CharacterList.empty()) {
                     writer.String("CharacterList");
                     writer.StartArray();
-                    for (std::list<CharacterResult>::iterator iter = CharacterList.begin(); iter != CharacterList.end(); iter++) {
+                    for (std::vector<CharacterResult>::iterator iter = CharacterList.begin(); iter != CharacterList.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9052,7 +14652,7 @@ namespace PlayFabComboSdk
                 if (!CharacterInventories.empty()) {
                     writer.String("CharacterInventories");
                     writer.StartArray();
-                    for (std::list<CharacterInventory>::iterator iter = CharacterInventories.begin(); iter != CharacterInventories.end(); iter++) {
+                    for (std::vector<CharacterInventory>::iterator iter = CharacterInventories.begin(); iter != CharacterInventories.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9060,7 +14660,7 @@ namespace PlayFabComboSdk
                 if (!TitleData.empty()) {
                     writer.String("TitleData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = TitleData.begin(); iter != TitleData.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = TitleData.begin(); iter != TitleData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -9069,7 +14669,7 @@ namespace PlayFabComboSdk
                 if (!PlayerStatistics.empty()) {
                     writer.String("PlayerStatistics");
                     writer.StartArray();
-                    for (std::list<StatisticValue>::iterator iter = PlayerStatistics.begin(); iter != PlayerStatistics.end(); iter++) {
+                    for (std::vector<StatisticValue>::iterator iter = PlayerStatistics.begin(); iter != PlayerStatistics.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9088,8 +14688,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator UserInventory_member = obj.FindMember("UserInventory");
                 if (UserInventory_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = UserInventory_member->value;
+                    UserInventory.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        UserInventory.push_back(ItemInstance(memberList[i]));
+                        UserInventory.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator UserVirtualCurrency_member = obj.FindMember("UserVirtualCurrency");
@@ -9123,15 +14724,17 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator CharacterList_member = obj.FindMember("CharacterList");
                 if (CharacterList_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = CharacterList_member->value;
+                    CharacterList.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        CharacterList.push_back(CharacterResult(memberList[i]));
+                        CharacterList.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator CharacterInventories_member = obj.FindMember("CharacterInventories");
                 if (CharacterInventories_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = CharacterInventories_member->value;
+                    CharacterInventories.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        CharacterInventories.push_back(CharacterInventory(memberList[i]));
+                        CharacterInventories.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator TitleData_member = obj.FindMember("TitleData");
@@ -9143,8 +14746,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayerStatistics_member = obj.FindMember("PlayerStatistics");
                 if (PlayerStatistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayerStatistics_member->value;
+                    PlayerStatistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayerStatistics.push_back(StatisticValue(memberList[i]));
+                        PlayerStatistics.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator PlayerProfile_member = obj.FindMember("PlayerProfile");
@@ -9152,6 +14756,158 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("AccountInfo"):
+                            if (strcmp(member, "AccountInfo") != 0)
+                                break;
+                            AccountInfo = new UserAccountInfo;
+                            AccountInfo->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("UserInventory"):
+                            if (strcmp(member, "UserInventory") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                UserInventory.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    UserInventory.emplace_back();
+                                    UserInventory.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("UserVirtualCurrency"):
+                            if (strcmp(member, "UserVirtualCurrency") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    UserVirtualCurrency[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("UserVirtualCurrencyRechargeTimes"):
+                            if (strcmp(member, "UserVirtualCurrencyRechargeTimes") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    UserVirtualCurrencyRechargeTimes[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("UserData"):
+                            if (strcmp(member, "UserData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    UserData[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("UserDataVersion"):
+                            if (strcmp(member, "UserDataVersion") != 0)
+                                break;
+                            UserDataVersion = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("UserReadOnlyData"):
+                            if (strcmp(member, "UserReadOnlyData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    UserReadOnlyData[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("UserReadOnlyDataVersion"):
+                            if (strcmp(member, "UserReadOnlyDataVersion") != 0)
+                                break;
+                            UserReadOnlyDataVersion = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterList"):
+                            if (strcmp(member, "CharacterList") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                CharacterList.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    CharacterList.emplace_back();
+                                    CharacterList.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterInventories"):
+                            if (strcmp(member, "CharacterInventories") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                CharacterInventories.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    CharacterInventories.emplace_back();
+                                    CharacterInventories.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleData"):
+                            if (strcmp(member, "TitleData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    TitleData[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerStatistics"):
+                            if (strcmp(member, "PlayerStatistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayerStatistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayerStatistics.emplace_back();
+                                    PlayerStatistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerProfile"):
+                            if (strcmp(member, "PlayerProfile") != 0)
+                                break;
+                            PlayerProfile = new PlayerProfileModel;
+                            PlayerProfile->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerCombinedInfoResult : public PlayFabBaseModel
@@ -9171,6 +14927,33 @@ namespace PlayFabComboSdk
                 InfoResultPayload(src.InfoResultPayload ? new GetPlayerCombinedInfoResultPayload(*src.InfoResultPayload) : nullptr)
             {}
 
+            GetPlayerCombinedInfoResult(GetPlayerCombinedInfoResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                InfoResultPayload(src.InfoResultPayload)
+            {
+                src.InfoResultPayload = nullptr;
+            }
+
+            GetPlayerCombinedInfoResult& operator=(const GetPlayerCombinedInfoResult& src)
+            {
+                if (this != &src)
+                    *this = GetPlayerCombinedInfoResult(src);
+                return *this;
+            }
+
+            GetPlayerCombinedInfoResult& operator=(GetPlayerCombinedInfoResult&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    if (InfoResultPayload != nullptr) delete InfoResultPayload;
+                    InfoResultPayload = src.InfoResultPayload;
+                    src.InfoResultPayload = nullptr;
+                }
+                return *this;
+            }
+
             GetPlayerCombinedInfoResult(const rapidjson::Value& obj) : GetPlayerCombinedInfoResult()
             {
                 readFromValue(obj);
@@ -9204,6 +14987,35 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("InfoResultPayload"):
+                            if (strcmp(member, "InfoResultPayload") != 0)
+                                break;
+                            InfoResultPayload = new GetPlayerCombinedInfoResultPayload;
+                            InfoResultPayload->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerProfileRequest : public PlayFabBaseModel
@@ -9223,6 +15035,33 @@ namespace PlayFabComboSdk
                 ProfileConstraints(src.ProfileConstraints ? new PlayerProfileViewConstraints(*src.ProfileConstraints) : nullptr)
             {}
 
+            GetPlayerProfileRequest(GetPlayerProfileRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                ProfileConstraints(src.ProfileConstraints)
+            {
+                src.ProfileConstraints = nullptr;
+            }
+
+            GetPlayerProfileRequest& operator=(const GetPlayerProfileRequest& src)
+            {
+                if (this != &src)
+                    *this = GetPlayerProfileRequest(src);
+                return *this;
+            }
+
+            GetPlayerProfileRequest& operator=(GetPlayerProfileRequest&& src)
+            {
+                if (this != &src)
+                {
+                    PlayFabId = AZStd::move(src.PlayFabId);
+                    if (ProfileConstraints != nullptr) delete ProfileConstraints;
+                    ProfileConstraints = src.ProfileConstraints;
+                    src.ProfileConstraints = nullptr;
+                }
+                return *this;
+            }
+
             GetPlayerProfileRequest(const rapidjson::Value& obj) : GetPlayerProfileRequest()
             {
                 readFromValue(obj);
@@ -9254,6 +15093,35 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ProfileConstraints"):
+                            if (strcmp(member, "ProfileConstraints") != 0)
+                                break;
+                            ProfileConstraints = new PlayerProfileViewConstraints;
+                            ProfileConstraints->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerProfileResult : public PlayFabBaseModel
@@ -9270,6 +15138,31 @@ namespace PlayFabComboSdk
                 PlayerProfile(src.PlayerProfile ? new PlayerProfileModel(*src.PlayerProfile) : nullptr)
             {}
 
+            GetPlayerProfileResult(GetPlayerProfileResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayerProfile(src.PlayerProfile)
+            {
+                src.PlayerProfile = nullptr;
+            }
+
+            GetPlayerProfileResult& operator=(const GetPlayerProfileResult& src)
+            {
+                if (this != &src)
+                    *this = GetPlayerProfileResult(src);
+                return *this;
+            }
+
+            GetPlayerProfileResult& operator=(GetPlayerProfileResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (PlayerProfile != nullptr) delete PlayerProfile;
+                    PlayerProfile = src.PlayerProfile;
+                    src.PlayerProfile = nullptr;
+                }
+                return *this;
+            }
+
             GetPlayerProfileResult(const rapidjson::Value& obj) : GetPlayerProfileResult()
             {
                 readFromValue(obj);
@@ -9297,11 +15190,35 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayerProfile"):
+                            if (strcmp(member, "PlayerProfile") != 0)
+                                break;
+                            PlayerProfile = new PlayerProfileModel;
+                            PlayerProfile->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerSegmentsResult : public PlayFabBaseModel
         {
-            std::list<GetSegmentResult> Segments;
+            std::vector<GetSegmentResult> Segments;
 
             GetPlayerSegmentsResult() :
                 PlayFabBaseModel(),
@@ -9313,6 +15230,14 @@ namespace PlayFabComboSdk
                 Segments(src.Segments)
             {}
 
+            GetPlayerSegmentsResult(GetPlayerSegmentsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Segments(AZStd::move(src.Segments))
+            {}
+
+            GetPlayerSegmentsResult& operator=(const GetPlayerSegmentsResult& src) = default;
+            GetPlayerSegmentsResult& operator=(GetPlayerSegmentsResult&& src) = default;
+
             GetPlayerSegmentsResult(const rapidjson::Value& obj) : GetPlayerSegmentsResult()
             {
                 readFromValue(obj);
@@ -9328,7 +15253,7 @@ namespace PlayFabComboSdk
                 if (!Segments.empty()) {
                     writer.String("Segments");
                     writer.StartArray();
-                    for (std::list<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
+                    for (std::vector<GetSegmentResult>::iterator iter = Segments.begin(); iter != Segments.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9341,13 +15266,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Segments_member = obj.FindMember("Segments");
                 if (Segments_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Segments_member->value;
+                    Segments.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Segments.push_back(GetSegmentResult(memberList[i]));
+                        Segments.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Segments"):
+                            if (strcmp(member, "Segments") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Segments.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Segments.emplace_back();
+                                    Segments.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayersInSegmentRequest : public PlayFabBaseModel
@@ -9373,6 +15330,17 @@ namespace PlayFabComboSdk
                 ContinuationToken(src.ContinuationToken)
             {}
 
+            GetPlayersInSegmentRequest(GetPlayersInSegmentRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SegmentId(AZStd::move(src.SegmentId)),
+                SecondsToLive(AZStd::move(src.SecondsToLive)),
+                MaxBatchSize(AZStd::move(src.MaxBatchSize)),
+                ContinuationToken(AZStd::move(src.ContinuationToken))
+            {}
+
+            GetPlayersInSegmentRequest& operator=(const GetPlayersInSegmentRequest& src) = default;
+            GetPlayersInSegmentRequest& operator=(GetPlayersInSegmentRequest&& src) = default;
+
             GetPlayersInSegmentRequest(const rapidjson::Value& obj) : GetPlayersInSegmentRequest()
             {
                 readFromValue(obj);
@@ -9415,6 +15383,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SegmentId"):
+                            if (strcmp(member, "SegmentId") != 0)
+                                break;
+                            SegmentId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("SecondsToLive"):
+                            if (strcmp(member, "SecondsToLive") != 0)
+                                break;
+                            SecondsToLive = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("MaxBatchSize"):
+                            if (strcmp(member, "MaxBatchSize") != 0)
+                                break;
+                            MaxBatchSize = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContinuationToken"):
+                            if (strcmp(member, "ContinuationToken") != 0)
+                                break;
+                            ContinuationToken = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerLocation : public PlayFabBaseModel
@@ -9443,6 +15449,18 @@ namespace PlayFabComboSdk
                 Longitude(src.Longitude)
             {}
 
+            PlayerLocation(PlayerLocation&& src) noexcept :
+                PlayFabBaseModel(),
+                pfContinentCode(AZStd::move(src.pfContinentCode)),
+                pfCountryCode(AZStd::move(src.pfCountryCode)),
+                City(AZStd::move(src.City)),
+                Latitude(AZStd::move(src.Latitude)),
+                Longitude(AZStd::move(src.Longitude))
+            {}
+
+            PlayerLocation& operator=(const PlayerLocation& src) = default;
+            PlayerLocation& operator=(PlayerLocation&& src) = default;
+
             PlayerLocation(const rapidjson::Value& obj) : PlayerLocation()
             {
                 readFromValue(obj);
@@ -9489,6 +15507,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ContinentCode"):
+                            if (strcmp(member, "ContinentCode") != 0)
+                                break;
+                            pfContinentCode = readContinentCodeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("CountryCode"):
+                            if (strcmp(member, "CountryCode") != 0)
+                                break;
+                            pfCountryCode = readCountryCodeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("City"):
+                            if (strcmp(member, "City") != 0)
+                                break;
+                            City = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Latitude"):
+                            if (strcmp(member, "Latitude") != 0)
+                                break;
+                            Latitude = reader.GetValue().GetDouble();
+                            continue;
+                        case PlayFabJsonReader::Hash("Longitude"):
+                            if (strcmp(member, "Longitude") != 0)
+                                break;
+                            Longitude = reader.GetValue().GetDouble();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PushNotificationRegistration : public PlayFabBaseModel
@@ -9508,6 +15569,15 @@ namespace PlayFabComboSdk
                 NotificationEndpointARN(src.NotificationEndpointARN)
             {}
 
+            PushNotificationRegistration(PushNotificationRegistration&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                NotificationEndpointARN(AZStd::move(src.NotificationEndpointARN))
+            {}
+
+            PushNotificationRegistration& operator=(const PushNotificationRegistration& src) = default;
+            PushNotificationRegistration& operator=(PushNotificationRegistration&& src) = default;
+
             PushNotificationRegistration(const rapidjson::Value& obj) : PushNotificationRegistration()
             {
                 readFromValue(obj);
@@ -9540,6 +15610,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readPushNotificationPlatformFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("NotificationEndpointARN"):
+                            if (strcmp(member, "NotificationEndpointARN") != 0)
+                                break;
+                            NotificationEndpointARN = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerLinkedAccount : public PlayFabBaseModel
@@ -9565,6 +15663,17 @@ namespace PlayFabComboSdk
                 Email(src.Email)
             {}
 
+            PlayerLinkedAccount(PlayerLinkedAccount&& src) noexcept :
+                PlayFabBaseModel(),
+                Platform(AZStd::move(src.Platform)),
+                PlatformUserId(AZStd::move(src.PlatformUserId)),
+                Username(AZStd::move(src.Username)),
+                Email(AZStd::move(src.Email))
+            {}
+
+            PlayerLinkedAccount& operator=(const PlayerLinkedAccount& src) = default;
+            PlayerLinkedAccount& operator=(PlayerLinkedAccount&& src) = default;
+
             PlayerLinkedAccount(const rapidjson::Value& obj) : PlayerLinkedAccount()
             {
                 readFromValue(obj);
@@ -9609,6 +15718,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Platform"):
+                            if (strcmp(member, "Platform") != 0)
+                                break;
+                            Platform = readLoginIdentityProviderFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("PlatformUserId"):
+                            if (strcmp(member, "PlatformUserId") != 0)
+                                break;
+                            PlatformUserId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Username"):
+                            if (strcmp(member, "Username") != 0)
+                                break;
+                            Username = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Email"):
+                            if (strcmp(member, "Email") != 0)
+                                break;
+                            Email = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerStatistic : public PlayFabBaseModel
@@ -9634,6 +15781,17 @@ namespace PlayFabComboSdk
                 Name(src.Name)
             {}
 
+            PlayerStatistic(PlayerStatistic&& src) noexcept :
+                PlayFabBaseModel(),
+                Id(AZStd::move(src.Id)),
+                StatisticVersion(AZStd::move(src.StatisticVersion)),
+                StatisticValue(AZStd::move(src.StatisticValue)),
+                Name(AZStd::move(src.Name))
+            {}
+
+            PlayerStatistic& operator=(const PlayerStatistic& src) = default;
+            PlayerStatistic& operator=(PlayerStatistic&& src) = default;
+
             PlayerStatistic(const rapidjson::Value& obj) : PlayerStatistic()
             {
                 readFromValue(obj);
@@ -9674,6 +15832,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Id"):
+                            if (strcmp(member, "Id") != 0)
+                                break;
+                            Id = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticVersion"):
+                            if (strcmp(member, "StatisticVersion") != 0)
+                                break;
+                            StatisticVersion = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticValue"):
+                            if (strcmp(member, "StatisticValue") != 0)
+                                break;
+                            StatisticValue = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Name"):
+                            if (strcmp(member, "Name") != 0)
+                                break;
+                            Name = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerProfile : public PlayFabBaseModel
@@ -9687,17 +15883,17 @@ namespace PlayFabComboSdk
             OptionalTime LastLogin;
             OptionalTime BannedUntil;
             AZStd::string AvatarUrl;
-            std::map<AZStd::string, Int32> Statistics;
+            PlayFabStringMap<Int32> Statistics;
             OptionalUint32 TotalValueToDateInUSD;
-            std::map<AZStd::string, Uint32> ValuesToDate;
-            std::list<AZStd::string> Tags;
-            std::map<AZStd::string, PlayerLocation> Locations;
-            std::map<AZStd::string, Int32> VirtualCurrencyBalances;
-            std::list<AdCampaignAttribution> AdCampaignAttributions;
-            std::list<PushNotificationRegistration> PushNotificationRegistrations;
-            std::list<PlayerLinkedAccount> LinkedAccounts;
-            std::list<PlayerStatistic> PlayerStatistics;
-            std::list<ContactEmailInfo> ContactEmailAddresses;
+            PlayFabStringMap<Uint32> ValuesToDate;
+            std::vector<AZStd::string> Tags;
+            PlayFabStringMap<PlayerLocation> Locations;
+            PlayFabStringMap<Int32> VirtualCurrencyBalances;
+            std::vector<AdCampaignAttribution> AdCampaignAttributions;
+            std::vector<PushNotificationRegistration> PushNotificationRegistrations;
+            std::vector<PlayerLinkedAccount> LinkedAccounts;
+            std::vector<PlayerStatistic> PlayerStatistics;
+            std::vector<ContactEmailInfo> ContactEmailAddresses;
 
             PlayerProfile() :
                 PlayFabBaseModel(),
@@ -9747,6 +15943,33 @@ namespace PlayFabComboSdk
                 ContactEmailAddresses(src.ContactEmailAddresses)
             {}
 
+            PlayerProfile(PlayerProfile&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayerId(AZStd::move(src.PlayerId)),
+                TitleId(AZStd::move(src.TitleId)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                PublisherId(AZStd::move(src.PublisherId)),
+                Origination(AZStd::move(src.Origination)),
+                Created(AZStd::move(src.Created)),
+                LastLogin(AZStd::move(src.LastLogin)),
+                BannedUntil(AZStd::move(src.BannedUntil)),
+                AvatarUrl(AZStd::move(src.AvatarUrl)),
+                Statistics(AZStd::move(src.Statistics)),
+                TotalValueToDateInUSD(AZStd::move(src.TotalValueToDateInUSD)),
+                ValuesToDate(AZStd::move(src.ValuesToDate)),
+                Tags(AZStd::move(src.Tags)),
+                Locations(AZStd::move(src.Locations)),
+                VirtualCurrencyBalances(AZStd::move(src.VirtualCurrencyBalances)),
+                AdCampaignAttributions(AZStd::move(src.AdCampaignAttributions)),
+                PushNotificationRegistrations(AZStd::move(src.PushNotificationRegistrations)),
+                LinkedAccounts(AZStd::move(src.LinkedAccounts)),
+                PlayerStatistics(AZStd::move(src.PlayerStatistics)),
+                ContactEmailAddresses(AZStd::move(src.ContactEmailAddresses))
+            {}
+
+            PlayerProfile& operator=(const PlayerProfile& src) = default;
+            PlayerProfile& operator=(PlayerProfile&& src) = default;
+
             PlayerProfile(const rapidjson::Value& obj) : PlayerProfile()
             {
                 readFromValue(obj);
@@ -9798,7 +16021,7 @@ namespace PlayFabComboSdk
                 if (!Statistics.empty()) {
                     writer.String("Statistics");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = Statistics.begin(); iter != Statistics.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = Statistics.begin(); iter != Statistics.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -9811,7 +16034,7 @@ namespace PlayFabComboSdk
                 if (!ValuesToDate.empty()) {
                     writer.String("ValuesToDate");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = ValuesToDate.begin(); iter != ValuesToDate.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = ValuesToDate.begin(); iter != ValuesToDate.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -9820,7 +16043,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -9828,7 +16051,7 @@ namespace PlayFabComboSdk
                 if (!Locations.empty()) {
                     writer.String("Locations");
                     writer.StartObject();
-                    for (std::map<AZStd::string, PlayerLocation>::iterator iter = Locations.begin(); iter != Locations.end(); ++iter) {
+                    for (PlayFabStringMap<PlayerLocation>::iterator iter = Locations.begin(); iter != Locations.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -9837,7 +16060,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyBalances.empty()) {
                     writer.String("VirtualCurrencyBalances");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = VirtualCurrencyBalances.begin(); iter != VirtualCurrencyBalances.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = VirtualCurrencyBalances.begin(); iter != VirtualCurrencyBalances.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -9846,7 +16069,7 @@ namespace PlayFabComboSdk
                 if (!AdCampaignAttributions.empty()) {
                     writer.String("AdCampaignAttributions");
                     writer.StartArray();
-                    for (std::list<AdCampaignAttribution>::iterator iter = AdCampaignAttributions.begin(); iter != AdCampaignAttributions.end(); iter++) {
+                    for (std::vector<AdCampaignAttribution>::iterator iter = AdCampaignAttributions.begin(); iter != AdCampaignAttributions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9854,7 +16077,7 @@ namespace PlayFabComboSdk
                 if (!PushNotificationRegistrations.empty()) {
                     writer.String("PushNotificationRegistrations");
                     writer.StartArray();
-                    for (std::list<PushNotificationRegistration>::iterator iter = PushNotificationRegistrations.begin(); iter != PushNotificationRegistrations.end(); iter++) {
+                    for (std::vector<PushNotificationRegistration>::iterator iter = PushNotificationRegistrations.begin(); iter != PushNotificationRegistrations.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9862,7 +16085,7 @@ namespace PlayFabComboSdk
                 if (!LinkedAccounts.empty()) {
                     writer.String("LinkedAccounts");
                     writer.StartArray();
-                    for (std::list<PlayerLinkedAccount>::iterator iter = LinkedAccounts.begin(); iter != LinkedAccounts.end(); iter++) {
+                    for (std::vector<PlayerLinkedAccount>::iterator iter = LinkedAccounts.begin(); iter != LinkedAccounts.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9870,7 +16093,7 @@ namespace PlayFabComboSdk
                 if (!PlayerStatistics.empty()) {
                     writer.String("PlayerStatistics");
                     writer.StartArray();
-                    for (std::list<PlayerStatistic>::iterator iter = PlayerStatistics.begin(); iter != PlayerStatistics.end(); iter++) {
+                    for (std::vector<PlayerStatistic>::iterator iter = PlayerStatistics.begin(); iter != PlayerStatistics.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9878,7 +16101,7 @@ namespace PlayFabComboSdk
                 if (!ContactEmailAddresses.empty()) {
                     writer.String("ContactEmailAddresses");
                     writer.StartArray();
-                    for (std::list<ContactEmailInfo>::iterator iter = ContactEmailAddresses.begin(); iter != ContactEmailAddresses.end(); iter++) {
+                    for (std::vector<ContactEmailInfo>::iterator iter = ContactEmailAddresses.begin(); iter != ContactEmailAddresses.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -9923,8 +16146,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator Locations_member = obj.FindMember("Locations");
@@ -9942,48 +16166,246 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator AdCampaignAttributions_member = obj.FindMember("AdCampaignAttributions");
                 if (AdCampaignAttributions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = AdCampaignAttributions_member->value;
+                    AdCampaignAttributions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        AdCampaignAttributions.push_back(AdCampaignAttribution(memberList[i]));
+                        AdCampaignAttributions.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator PushNotificationRegistrations_member = obj.FindMember("PushNotificationRegistrations");
                 if (PushNotificationRegistrations_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PushNotificationRegistrations_member->value;
+                    PushNotificationRegistrations.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PushNotificationRegistrations.push_back(PushNotificationRegistration(memberList[i]));
+                        PushNotificationRegistrations.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator LinkedAccounts_member = obj.FindMember("LinkedAccounts");
                 if (LinkedAccounts_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = LinkedAccounts_member->value;
+                    LinkedAccounts.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        LinkedAccounts.push_back(PlayerLinkedAccount(memberList[i]));
+                        LinkedAccounts.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator PlayerStatistics_member = obj.FindMember("PlayerStatistics");
                 if (PlayerStatistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayerStatistics_member->value;
+                    PlayerStatistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayerStatistics.push_back(PlayerStatistic(memberList[i]));
+                        PlayerStatistics.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator ContactEmailAddresses_member = obj.FindMember("ContactEmailAddresses");
                 if (ContactEmailAddresses_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ContactEmailAddresses_member->value;
+                    ContactEmailAddresses.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ContactEmailAddresses.push_back(ContactEmailInfo(memberList[i]));
+                        ContactEmailAddresses.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayerId"):
+                            if (strcmp(member, "PlayerId") != 0)
+                                break;
+                            PlayerId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TitleId"):
+                            if (strcmp(member, "TitleId") != 0)
+                                break;
+                            TitleId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PublisherId"):
+                            if (strcmp(member, "PublisherId") != 0)
+                                break;
+                            PublisherId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Origination"):
+                            if (strcmp(member, "Origination") != 0)
+                                break;
+                            Origination = readLoginIdentityProviderFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Created"):
+                            if (strcmp(member, "Created") != 0)
+                                break;
+                            Created = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("LastLogin"):
+                            if (strcmp(member, "LastLogin") != 0)
+                                break;
+                            LastLogin = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("BannedUntil"):
+                            if (strcmp(member, "BannedUntil") != 0)
+                                break;
+                            BannedUntil = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("AvatarUrl"):
+                            if (strcmp(member, "AvatarUrl") != 0)
+                                break;
+                            AvatarUrl = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statistics"):
+                            if (strcmp(member, "Statistics") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Statistics[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("TotalValueToDateInUSD"):
+                            if (strcmp(member, "TotalValueToDateInUSD") != 0)
+                                break;
+                            TotalValueToDateInUSD = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ValuesToDate"):
+                            if (strcmp(member, "ValuesToDate") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    ValuesToDate[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Locations"):
+                            if (strcmp(member, "Locations") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Locations[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyBalances"):
+                            if (strcmp(member, "VirtualCurrencyBalances") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyBalances[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("AdCampaignAttributions"):
+                            if (strcmp(member, "AdCampaignAttributions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                AdCampaignAttributions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    AdCampaignAttributions.emplace_back();
+                                    AdCampaignAttributions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PushNotificationRegistrations"):
+                            if (strcmp(member, "PushNotificationRegistrations") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PushNotificationRegistrations.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PushNotificationRegistrations.emplace_back();
+                                    PushNotificationRegistrations.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("LinkedAccounts"):
+                            if (strcmp(member, "LinkedAccounts") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                LinkedAccounts.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    LinkedAccounts.emplace_back();
+                                    LinkedAccounts.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerStatistics"):
+                            if (strcmp(member, "PlayerStatistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayerStatistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayerStatistics.emplace_back();
+                                    PlayerStatistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("ContactEmailAddresses"):
+                            if (strcmp(member, "ContactEmailAddresses") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ContactEmailAddresses.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ContactEmailAddresses.emplace_back();
+                                    ContactEmailAddresses.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayersInSegmentResult : public PlayFabBaseModel
         {
             Int32 ProfilesInSegment;
             AZStd::string ContinuationToken;
-            std::list<PlayerProfile> PlayerProfiles;
+            std::vector<PlayerProfile> PlayerProfiles;
 
             GetPlayersInSegmentResult() :
                 PlayFabBaseModel(),
@@ -9999,6 +16421,16 @@ namespace PlayFabComboSdk
                 PlayerProfiles(src.PlayerProfiles)
             {}
 
+            GetPlayersInSegmentResult(GetPlayersInSegmentResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ProfilesInSegment(AZStd::move(src.ProfilesInSegment)),
+                ContinuationToken(AZStd::move(src.ContinuationToken)),
+                PlayerProfiles(AZStd::move(src.PlayerProfiles))
+            {}
+
+            GetPlayersInSegmentResult& operator=(const GetPlayersInSegmentResult& src) = default;
+            GetPlayersInSegmentResult& operator=(GetPlayersInSegmentResult&& src) = default;
+
             GetPlayersInSegmentResult(const rapidjson::Value& obj) : GetPlayersInSegmentResult()
             {
                 readFromValue(obj);
@@ -10020,7 +16452,7 @@ namespace PlayFabComboSdk
                 if (!PlayerProfiles.empty()) {
                     writer.String("PlayerProfiles");
                     writer.StartArray();
-                    for (std::list<PlayerProfile>::iterator iter = PlayerProfiles.begin(); iter != PlayerProfiles.end(); iter++) {
+                    for (std::vector<PlayerProfile>::iterator iter = PlayerProfiles.begin(); iter != PlayerProfiles.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10037,13 +16469,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayerProfiles_member = obj.FindMember("PlayerProfiles");
                 if (PlayerProfiles_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayerProfiles_member->value;
+                    PlayerProfiles.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayerProfiles.push_back(PlayerProfile(memberList[i]));
+                        PlayerProfiles.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ProfilesInSegment"):
+                            if (strcmp(member, "ProfilesInSegment") != 0)
+                                break;
+                            ProfilesInSegment = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContinuationToken"):
+                            if (strcmp(member, "ContinuationToken") != 0)
+                                break;
+                            ContinuationToken = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayerProfiles"):
+                            if (strcmp(member, "PlayerProfiles") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayerProfiles.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayerProfiles.emplace_back();
+                                    PlayerProfiles.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayersSegmentsRequest : public PlayFabBaseModel
@@ -10060,6 +16534,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            GetPlayersSegmentsRequest(GetPlayersSegmentsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetPlayersSegmentsRequest& operator=(const GetPlayersSegmentsRequest& src) = default;
+            GetPlayersSegmentsRequest& operator=(GetPlayersSegmentsRequest&& src) = default;
+
             GetPlayersSegmentsRequest(const rapidjson::Value& obj) : GetPlayersSegmentsRequest()
             {
                 readFromValue(obj);
@@ -10084,6 +16566,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct StatisticNameVersion : public PlayFabBaseModel
@@ -10103,6 +16608,15 @@ namespace PlayFabComboSdk
                 Version(src.Version)
             {}
 
+            StatisticNameVersion(StatisticNameVersion&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                Version(AZStd::move(src.Version))
+            {}
+
+            StatisticNameVersion& operator=(const StatisticNameVersion& src) = default;
+            StatisticNameVersion& operator=(StatisticNameVersion&& src) = default;
+
             StatisticNameVersion(const rapidjson::Value& obj) : StatisticNameVersion()
             {
                 readFromValue(obj);
@@ -10131,13 +16645,41 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticsRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<AZStd::string> StatisticNames;
-            std::list<StatisticNameVersion> StatisticNameVersions;
+            std::vector<AZStd::string> StatisticNames;
+            std::vector<StatisticNameVersion> StatisticNameVersions;
 
             GetPlayerStatisticsRequest() :
                 PlayFabBaseModel(),
@@ -10153,6 +16695,16 @@ namespace PlayFabComboSdk
                 StatisticNameVersions(src.StatisticNameVersions)
             {}
 
+            GetPlayerStatisticsRequest(GetPlayerStatisticsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                StatisticNames(AZStd::move(src.StatisticNames)),
+                StatisticNameVersions(AZStd::move(src.StatisticNameVersions))
+            {}
+
+            GetPlayerStatisticsRequest& operator=(const GetPlayerStatisticsRequest& src) = default;
+            GetPlayerStatisticsRequest& operator=(GetPlayerStatisticsRequest&& src) = default;
+
             GetPlayerStatisticsRequest(const rapidjson::Value& obj) : GetPlayerStatisticsRequest()
             {
                 readFromValue(obj);
@@ -10170,7 +16722,7 @@ namespace PlayFabComboSdk
                 if (!StatisticNames.empty()) {
                     writer.String("StatisticNames");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = StatisticNames.begin(); iter != StatisticNames.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = StatisticNames.begin(); iter != StatisticNames.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -10178,7 +16730,7 @@ namespace PlayFabComboSdk
                 if (!StatisticNameVersions.empty()) {
                     writer.String("StatisticNameVersions");
                     writer.StartArray();
-                    for (std::list<StatisticNameVersion>::iterator iter = StatisticNameVersions.begin(); iter != StatisticNameVersions.end(); iter++) {
+                    for (std::vector<StatisticNameVersion>::iterator iter = StatisticNameVersions.begin(); iter != StatisticNameVersions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10193,26 +16745,76 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator StatisticNames_member = obj.FindMember("StatisticNames");
                 if (StatisticNames_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = StatisticNames_member->value;
+                    StatisticNames.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        StatisticNames.push_back(memberList[i].GetString());
+                        StatisticNames.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator StatisticNameVersions_member = obj.FindMember("StatisticNameVersions");
                 if (StatisticNameVersions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = StatisticNameVersions_member->value;
+                    StatisticNameVersions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        StatisticNameVersions.push_back(StatisticNameVersion(memberList[i]));
+                        StatisticNameVersions.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticNames"):
+                            if (strcmp(member, "StatisticNames") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                StatisticNames.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    StatisticNames.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("StatisticNameVersions"):
+                            if (strcmp(member, "StatisticNameVersions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                StatisticNameVersions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    StatisticNameVersions.emplace_back();
+                                    StatisticNameVersions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticsResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<StatisticValue> Statistics;
+            std::vector<StatisticValue> Statistics;
 
             GetPlayerStatisticsResult() :
                 PlayFabBaseModel(),
@@ -10226,6 +16828,15 @@ namespace PlayFabComboSdk
                 Statistics(src.Statistics)
             {}
 
+            GetPlayerStatisticsResult(GetPlayerStatisticsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Statistics(AZStd::move(src.Statistics))
+            {}
+
+            GetPlayerStatisticsResult& operator=(const GetPlayerStatisticsResult& src) = default;
+            GetPlayerStatisticsResult& operator=(GetPlayerStatisticsResult&& src) = default;
+
             GetPlayerStatisticsResult(const rapidjson::Value& obj) : GetPlayerStatisticsResult()
             {
                 readFromValue(obj);
@@ -10245,7 +16856,7 @@ namespace PlayFabComboSdk
                 if (!Statistics.empty()) {
                     writer.String("Statistics");
                     writer.StartArray();
-                    for (std::list<StatisticValue>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
+                    for (std::vector<StatisticValue>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10260,13 +16871,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Statistics_member = obj.FindMember("Statistics");
                 if (Statistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statistics_member->value;
+                    Statistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statistics.push_back(StatisticValue(memberList[i]));
+                        Statistics.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statistics"):
+                            if (strcmp(member, "Statistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statistics.emplace_back();
+                                    Statistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticVersionsRequest : public PlayFabBaseModel
@@ -10283,6 +16931,14 @@ namespace PlayFabComboSdk
                 StatisticName(src.StatisticName)
             {}
 
+            GetPlayerStatisticVersionsRequest(GetPlayerStatisticVersionsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName))
+            {}
+
+            GetPlayerStatisticVersionsRequest& operator=(const GetPlayerStatisticVersionsRequest& src) = default;
+            GetPlayerStatisticVersionsRequest& operator=(GetPlayerStatisticVersionsRequest&& src) = default;
+
             GetPlayerStatisticVersionsRequest(const rapidjson::Value& obj) : GetPlayerStatisticVersionsRequest()
             {
                 readFromValue(obj);
@@ -10309,6 +16965,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PlayerStatisticVersion : public PlayFabBaseModel
@@ -10340,6 +17019,19 @@ namespace PlayFabComboSdk
                 DeactivationTime(src.DeactivationTime)
             {}
 
+            PlayerStatisticVersion(PlayerStatisticVersion&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                Version(AZStd::move(src.Version)),
+                ScheduledActivationTime(AZStd::move(src.ScheduledActivationTime)),
+                ActivationTime(AZStd::move(src.ActivationTime)),
+                ScheduledDeactivationTime(AZStd::move(src.ScheduledDeactivationTime)),
+                DeactivationTime(AZStd::move(src.DeactivationTime))
+            {}
+
+            PlayerStatisticVersion& operator=(const PlayerStatisticVersion& src) = default;
+            PlayerStatisticVersion& operator=(PlayerStatisticVersion&& src) = default;
+
             PlayerStatisticVersion(const rapidjson::Value& obj) : PlayerStatisticVersion()
             {
                 readFromValue(obj);
@@ -10392,11 +17084,59 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledActivationTime"):
+                            if (strcmp(member, "ScheduledActivationTime") != 0)
+                                break;
+                            ScheduledActivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ActivationTime"):
+                            if (strcmp(member, "ActivationTime") != 0)
+                                break;
+                            ActivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ScheduledDeactivationTime"):
+                            if (strcmp(member, "ScheduledDeactivationTime") != 0)
+                                break;
+                            ScheduledDeactivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("DeactivationTime"):
+                            if (strcmp(member, "DeactivationTime") != 0)
+                                break;
+                            DeactivationTime = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerStatisticVersionsResult : public PlayFabBaseModel
         {
-            std::list<PlayerStatisticVersion> StatisticVersions;
+            std::vector<PlayerStatisticVersion> StatisticVersions;
 
             GetPlayerStatisticVersionsResult() :
                 PlayFabBaseModel(),
@@ -10408,6 +17148,14 @@ namespace PlayFabComboSdk
                 StatisticVersions(src.StatisticVersions)
             {}
 
+            GetPlayerStatisticVersionsResult(GetPlayerStatisticVersionsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticVersions(AZStd::move(src.StatisticVersions))
+            {}
+
+            GetPlayerStatisticVersionsResult& operator=(const GetPlayerStatisticVersionsResult& src) = default;
+            GetPlayerStatisticVersionsResult& operator=(GetPlayerStatisticVersionsResult&& src) = default;
+
             GetPlayerStatisticVersionsResult(const rapidjson::Value& obj) : GetPlayerStatisticVersionsResult()
             {
                 readFromValue(obj);
@@ -10423,7 +17171,7 @@ namespace PlayFabComboSdk
                 if (!StatisticVersions.empty()) {
                     writer.String("StatisticVersions");
                     writer.StartArray();
-                    for (std::list<PlayerStatisticVersion>::iterator iter = StatisticVersions.begin(); iter != StatisticVersions.end(); iter++) {
+                    for (std::vector<PlayerStatisticVersion>::iterator iter = StatisticVersions.begin(); iter != StatisticVersions.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10436,13 +17184,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator StatisticVersions_member = obj.FindMember("StatisticVersions");
                 if (StatisticVersions_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = StatisticVersions_member->value;
+                    StatisticVersions.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        StatisticVersions.push_back(PlayerStatisticVersion(memberList[i]));
+                        StatisticVersions.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticVersions"):
+                            if (strcmp(member, "StatisticVersions") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                StatisticVersions.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    StatisticVersions.emplace_back();
+                                    StatisticVersions.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerTagsRequest : public PlayFabBaseModel
@@ -10462,6 +17242,15 @@ namespace PlayFabComboSdk
                 Namespace(src.Namespace)
             {}
 
+            GetPlayerTagsRequest(GetPlayerTagsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Namespace(AZStd::move(src.Namespace))
+            {}
+
+            GetPlayerTagsRequest& operator=(const GetPlayerTagsRequest& src) = default;
+            GetPlayerTagsRequest& operator=(GetPlayerTagsRequest&& src) = default;
+
             GetPlayerTagsRequest(const rapidjson::Value& obj) : GetPlayerTagsRequest()
             {
                 readFromValue(obj);
@@ -10492,12 +17281,40 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Namespace"):
+                            if (strcmp(member, "Namespace") != 0)
+                                break;
+                            Namespace = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayerTagsResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<AZStd::string> Tags;
+            std::vector<AZStd::string> Tags;
 
             GetPlayerTagsResult() :
                 PlayFabBaseModel(),
@@ -10511,6 +17328,15 @@ namespace PlayFabComboSdk
                 Tags(src.Tags)
             {}
 
+            GetPlayerTagsResult(GetPlayerTagsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Tags(AZStd::move(src.Tags))
+            {}
+
+            GetPlayerTagsResult& operator=(const GetPlayerTagsResult& src) = default;
+            GetPlayerTagsResult& operator=(GetPlayerTagsResult&& src) = default;
+
             GetPlayerTagsResult(const rapidjson::Value& obj) : GetPlayerTagsResult()
             {
                 readFromValue(obj);
@@ -10527,7 +17353,7 @@ namespace PlayFabComboSdk
                 writer.String(PlayFabId.c_str());
                 writer.String("Tags");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -10541,18 +17367,54 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayFabIDsFromFacebookIDsRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> FacebookIDs;
+            std::vector<AZStd::string> FacebookIDs;
 
             GetPlayFabIDsFromFacebookIDsRequest() :
                 PlayFabBaseModel(),
@@ -10564,9 +17426,17 @@ namespace PlayFabComboSdk
                 FacebookIDs(src.FacebookIDs)
             {}
 
-            GetPlayFabIDsFromFacebookIDsRequest(const rapidjson::Value& obj) : GetPlayFabIDsFromFacebookIDsRequest()
-            {
-                readFromValue(obj);
+            GetPlayFabIDsFromFacebookIDsRequest(GetPlayFabIDsFromFacebookIDsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                FacebookIDs(AZStd::move(src.FacebookIDs))
+            {}
+
+            GetPlayFabIDsFromFacebookIDsRequest& operator=(const GetPlayFabIDsFromFacebookIDsRequest& src) = default;
+            GetPlayFabIDsFromFacebookIDsRequest& operator=(GetPlayFabIDsFromFacebookIDsRequest&& src) = default;
+
+            GetPlayFabIDsFromFacebookIDsRequest(const rapidjson::Value& obj) : GetPlayFabIDsFromFacebookIDsRequest()
+            {
+                readFromValue(obj);
             }
 
             ~GetPlayFabIDsFromFacebookIDsRequest()
@@ -10578,7 +17448,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("FacebookIDs");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = FacebookIDs.begin(); iter != FacebookIDs.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = FacebookIDs.begin(); iter != FacebookIDs.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -10590,18 +17460,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator FacebookIDs_member = obj.FindMember("FacebookIDs");
                 if (FacebookIDs_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = FacebookIDs_member->value;
+                    FacebookIDs.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        FacebookIDs.push_back(memberList[i].GetString());
+                        FacebookIDs.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FacebookIDs"):
+                            if (strcmp(member, "FacebookIDs") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                FacebookIDs.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    FacebookIDs.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayFabIDsFromFacebookIDsResult : public PlayFabBaseModel
         {
-            std::list<FacebookPlayFabIdPair> Data;
+            std::vector<FacebookPlayFabIdPair> Data;
 
             GetPlayFabIDsFromFacebookIDsResult() :
                 PlayFabBaseModel(),
@@ -10613,6 +17514,14 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetPlayFabIDsFromFacebookIDsResult(GetPlayFabIDsFromFacebookIDsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetPlayFabIDsFromFacebookIDsResult& operator=(const GetPlayFabIDsFromFacebookIDsResult& src) = default;
+            GetPlayFabIDsFromFacebookIDsResult& operator=(GetPlayFabIDsFromFacebookIDsResult&& src) = default;
+
             GetPlayFabIDsFromFacebookIDsResult(const rapidjson::Value& obj) : GetPlayFabIDsFromFacebookIDsResult()
             {
                 readFromValue(obj);
@@ -10628,7 +17537,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartArray();
-                    for (std::list<FacebookPlayFabIdPair>::iterator iter = Data.begin(); iter != Data.end(); iter++) {
+                    for (std::vector<FacebookPlayFabIdPair>::iterator iter = Data.begin(); iter != Data.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10641,18 +17550,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Data_member = obj.FindMember("Data");
                 if (Data_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Data_member->value;
+                    Data.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Data.push_back(FacebookPlayFabIdPair(memberList[i]));
+                        Data.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Data.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Data.emplace_back();
+                                    Data.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayFabIDsFromSteamIDsRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> SteamStringIDs;
+            std::vector<AZStd::string> SteamStringIDs;
 
             GetPlayFabIDsFromSteamIDsRequest() :
                 PlayFabBaseModel(),
@@ -10664,6 +17605,14 @@ namespace PlayFabComboSdk
                 SteamStringIDs(src.SteamStringIDs)
             {}
 
+            GetPlayFabIDsFromSteamIDsRequest(GetPlayFabIDsFromSteamIDsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SteamStringIDs(AZStd::move(src.SteamStringIDs))
+            {}
+
+            GetPlayFabIDsFromSteamIDsRequest& operator=(const GetPlayFabIDsFromSteamIDsRequest& src) = default;
+            GetPlayFabIDsFromSteamIDsRequest& operator=(GetPlayFabIDsFromSteamIDsRequest&& src) = default;
+
             GetPlayFabIDsFromSteamIDsRequest(const rapidjson::Value& obj) : GetPlayFabIDsFromSteamIDsRequest()
             {
                 readFromValue(obj);
@@ -10679,7 +17628,7 @@ namespace PlayFabComboSdk
                 if (!SteamStringIDs.empty()) {
                     writer.String("SteamStringIDs");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = SteamStringIDs.begin(); iter != SteamStringIDs.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = SteamStringIDs.begin(); iter != SteamStringIDs.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -10692,13 +17641,44 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator SteamStringIDs_member = obj.FindMember("SteamStringIDs");
                 if (SteamStringIDs_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = SteamStringIDs_member->value;
+                    SteamStringIDs.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        SteamStringIDs.push_back(memberList[i].GetString());
+                        SteamStringIDs.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SteamStringIDs"):
+                            if (strcmp(member, "SteamStringIDs") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                SteamStringIDs.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    SteamStringIDs.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SteamPlayFabIdPair : public PlayFabBaseModel
@@ -10718,6 +17698,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            SteamPlayFabIdPair(SteamPlayFabIdPair&& src) noexcept :
+                PlayFabBaseModel(),
+                SteamStringId(AZStd::move(src.SteamStringId)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            SteamPlayFabIdPair& operator=(const SteamPlayFabIdPair& src) = default;
+            SteamPlayFabIdPair& operator=(SteamPlayFabIdPair&& src) = default;
+
             SteamPlayFabIdPair(const rapidjson::Value& obj) : SteamPlayFabIdPair()
             {
                 readFromValue(obj);
@@ -10750,11 +17739,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SteamStringId"):
+                            if (strcmp(member, "SteamStringId") != 0)
+                                break;
+                            SteamStringId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPlayFabIDsFromSteamIDsResult : public PlayFabBaseModel
         {
-            std::list<SteamPlayFabIdPair> Data;
+            std::vector<SteamPlayFabIdPair> Data;
 
             GetPlayFabIDsFromSteamIDsResult() :
                 PlayFabBaseModel(),
@@ -10766,6 +17783,14 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetPlayFabIDsFromSteamIDsResult(GetPlayFabIDsFromSteamIDsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetPlayFabIDsFromSteamIDsResult& operator=(const GetPlayFabIDsFromSteamIDsResult& src) = default;
+            GetPlayFabIDsFromSteamIDsResult& operator=(GetPlayFabIDsFromSteamIDsResult&& src) = default;
+
             GetPlayFabIDsFromSteamIDsResult(const rapidjson::Value& obj) : GetPlayFabIDsFromSteamIDsResult()
             {
                 readFromValue(obj);
@@ -10781,7 +17806,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartArray();
-                    for (std::list<SteamPlayFabIdPair>::iterator iter = Data.begin(); iter != Data.end(); iter++) {
+                    for (std::vector<SteamPlayFabIdPair>::iterator iter = Data.begin(); iter != Data.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -10794,18 +17819,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Data_member = obj.FindMember("Data");
                 if (Data_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Data_member->value;
+                    Data.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Data.push_back(SteamPlayFabIdPair(memberList[i]));
+                        Data.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Data.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Data.emplace_back();
+                                    Data.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPublisherDataRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
 
             GetPublisherDataRequest() :
                 PlayFabBaseModel(),
@@ -10817,6 +17874,14 @@ namespace PlayFabComboSdk
                 Keys(src.Keys)
             {}
 
+            GetPublisherDataRequest(GetPublisherDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Keys(AZStd::move(src.Keys))
+            {}
+
+            GetPublisherDataRequest& operator=(const GetPublisherDataRequest& src) = default;
+            GetPublisherDataRequest& operator=(GetPublisherDataRequest&& src) = default;
+
             GetPublisherDataRequest(const rapidjson::Value& obj) : GetPublisherDataRequest()
             {
                 readFromValue(obj);
@@ -10831,7 +17896,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Keys");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -10843,18 +17908,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetPublisherDataResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, AZStd::string> Data;
+            PlayFabStringMap<AZStd::string> Data;
 
             GetPublisherDataResult() :
                 PlayFabBaseModel(),
@@ -10866,6 +17962,14 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetPublisherDataResult(GetPublisherDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetPublisherDataResult& operator=(const GetPublisherDataResult& src) = default;
+            GetPublisherDataResult& operator=(GetPublisherDataResult&& src) = default;
+
             GetPublisherDataResult(const rapidjson::Value& obj) : GetPublisherDataResult()
             {
                 readFromValue(obj);
@@ -10881,7 +17985,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -10901,12 +18005,42 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetRandomResultTablesRequest : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
-            std::list<AZStd::string> TableIDs;
+            std::vector<AZStd::string> TableIDs;
 
             GetRandomResultTablesRequest() :
                 PlayFabBaseModel(),
@@ -10920,6 +18054,15 @@ namespace PlayFabComboSdk
                 TableIDs(src.TableIDs)
             {}
 
+            GetRandomResultTablesRequest(GetRandomResultTablesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                TableIDs(AZStd::move(src.TableIDs))
+            {}
+
+            GetRandomResultTablesRequest& operator=(const GetRandomResultTablesRequest& src) = default;
+            GetRandomResultTablesRequest& operator=(GetRandomResultTablesRequest&& src) = default;
+
             GetRandomResultTablesRequest(const rapidjson::Value& obj) : GetRandomResultTablesRequest()
             {
                 readFromValue(obj);
@@ -10938,7 +18081,7 @@ namespace PlayFabComboSdk
                 }
                 writer.String("TableIDs");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = TableIDs.begin(); iter != TableIDs.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = TableIDs.begin(); iter != TableIDs.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -10952,13 +18095,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator TableIDs_member = obj.FindMember("TableIDs");
                 if (TableIDs_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = TableIDs_member->value;
+                    TableIDs.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        TableIDs.push_back(memberList[i].GetString());
+                        TableIDs.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TableIDs"):
+                            if (strcmp(member, "TableIDs") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                TableIDs.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    TableIDs.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum ResultTableNodeType
@@ -10983,19 +18162,14 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<ResultTableNodeType>(obj.GetInt());
 
-            static std::map<const char *, ResultTableNodeType, PlayFabComboSdk::StringCompare> _ResultTableNodeTypeMap;
-            if (_ResultTableNodeTypeMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _ResultTableNodeTypeMap["ItemId"] = ResultTableNodeTypeItemId;
-                _ResultTableNodeTypeMap["TableId"] = ResultTableNodeTypeTableId;
-
+            case PlayFabJsonReader::Hash("ItemId"): if (strcmp(name, "ItemId") == 0) return ResultTableNodeTypeItemId; break;
+            case PlayFabJsonReader::Hash("TableId"): if (strcmp(name, "TableId") == 0) return ResultTableNodeTypeTableId; break;
             }
 
-            auto output = _ResultTableNodeTypeMap.find(obj.GetString());
-            if (output != _ResultTableNodeTypeMap.end())
-                return output->second;
-
             return ResultTableNodeTypeItemId; // Basically critical fail
         }
 
@@ -11019,6 +18193,16 @@ namespace PlayFabComboSdk
                 Weight(src.Weight)
             {}
 
+            ResultTableNode(ResultTableNode&& src) noexcept :
+                PlayFabBaseModel(),
+                ResultItemType(AZStd::move(src.ResultItemType)),
+                ResultItem(AZStd::move(src.ResultItem)),
+                Weight(AZStd::move(src.Weight))
+            {}
+
+            ResultTableNode& operator=(const ResultTableNode& src) = default;
+            ResultTableNode& operator=(ResultTableNode&& src) = default;
+
             ResultTableNode(const rapidjson::Value& obj) : ResultTableNode()
             {
                 readFromValue(obj);
@@ -11051,13 +18235,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ResultItemType"):
+                            if (strcmp(member, "ResultItemType") != 0)
+                                break;
+                            ResultItemType = readResultTableNodeTypeFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("ResultItem"):
+                            if (strcmp(member, "ResultItem") != 0)
+                                break;
+                            ResultItem = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Weight"):
+                            if (strcmp(member, "Weight") != 0)
+                                break;
+                            Weight = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RandomResultTableListing : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
             AZStd::string TableId;
-            std::list<ResultTableNode> Nodes;
+            std::vector<ResultTableNode> Nodes;
 
             RandomResultTableListing() :
                 PlayFabBaseModel(),
@@ -11073,6 +18290,16 @@ namespace PlayFabComboSdk
                 Nodes(src.Nodes)
             {}
 
+            RandomResultTableListing(RandomResultTableListing&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                TableId(AZStd::move(src.TableId)),
+                Nodes(AZStd::move(src.Nodes))
+            {}
+
+            RandomResultTableListing& operator=(const RandomResultTableListing& src) = default;
+            RandomResultTableListing& operator=(RandomResultTableListing&& src) = default;
+
             RandomResultTableListing(const rapidjson::Value& obj) : RandomResultTableListing()
             {
                 readFromValue(obj);
@@ -11093,7 +18320,7 @@ namespace PlayFabComboSdk
                 writer.String(TableId.c_str());
                 writer.String("Nodes");
                 writer.StartArray();
-                for (std::list<ResultTableNode>::iterator iter = Nodes.begin(); iter != Nodes.end(); iter++) {
+                for (std::vector<ResultTableNode>::iterator iter = Nodes.begin(); iter != Nodes.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -11109,18 +18336,60 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Nodes_member = obj.FindMember("Nodes");
                 if (Nodes_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Nodes_member->value;
+                    Nodes.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Nodes.push_back(ResultTableNode(memberList[i]));
+                        Nodes.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TableId"):
+                            if (strcmp(member, "TableId") != 0)
+                                break;
+                            TableId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Nodes"):
+                            if (strcmp(member, "Nodes") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Nodes.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Nodes.emplace_back();
+                                    Nodes.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetRandomResultTablesResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, RandomResultTableListing> Tables;
+            PlayFabStringMap<RandomResultTableListing> Tables;
 
             GetRandomResultTablesResult() :
                 PlayFabBaseModel(),
@@ -11132,6 +18401,14 @@ namespace PlayFabComboSdk
                 Tables(src.Tables)
             {}
 
+            GetRandomResultTablesResult(GetRandomResultTablesResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Tables(AZStd::move(src.Tables))
+            {}
+
+            GetRandomResultTablesResult& operator=(const GetRandomResultTablesResult& src) = default;
+            GetRandomResultTablesResult& operator=(GetRandomResultTablesResult&& src) = default;
+
             GetRandomResultTablesResult(const rapidjson::Value& obj) : GetRandomResultTablesResult()
             {
                 readFromValue(obj);
@@ -11147,7 +18424,7 @@ namespace PlayFabComboSdk
                 if (!Tables.empty()) {
                     writer.String("Tables");
                     writer.StartObject();
-                    for (std::map<AZStd::string, RandomResultTableListing>::iterator iter = Tables.begin(); iter != Tables.end(); ++iter) {
+                    for (PlayFabStringMap<RandomResultTableListing>::iterator iter = Tables.begin(); iter != Tables.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -11167,12 +18444,42 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Tables"):
+                            if (strcmp(member, "Tables") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Tables[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetSharedGroupDataRequest : public PlayFabBaseModel
         {
             AZStd::string SharedGroupId;
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
             OptionalBool GetMembers;
 
             GetSharedGroupDataRequest() :
@@ -11189,6 +18496,16 @@ namespace PlayFabComboSdk
                 GetMembers(src.GetMembers)
             {}
 
+            GetSharedGroupDataRequest(GetSharedGroupDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId)),
+                Keys(AZStd::move(src.Keys)),
+                GetMembers(AZStd::move(src.GetMembers))
+            {}
+
+            GetSharedGroupDataRequest& operator=(const GetSharedGroupDataRequest& src) = default;
+            GetSharedGroupDataRequest& operator=(GetSharedGroupDataRequest&& src) = default;
+
             GetSharedGroupDataRequest(const rapidjson::Value& obj) : GetSharedGroupDataRequest()
             {
                 readFromValue(obj);
@@ -11206,7 +18523,7 @@ namespace PlayFabComboSdk
                 if (!Keys.empty()) {
                     writer.String("Keys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -11225,8 +18542,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator GetMembers_member = obj.FindMember("GetMembers");
@@ -11234,6 +18552,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("GetMembers"):
+                            if (strcmp(member, "GetMembers") != 0)
+                                break;
+                            GetMembers = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SharedGroupDataRecord : public PlayFabBaseModel
@@ -11259,6 +18617,17 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            SharedGroupDataRecord(SharedGroupDataRecord&& src) noexcept :
+                PlayFabBaseModel(),
+                Value(AZStd::move(src.Value)),
+                LastUpdatedBy(AZStd::move(src.LastUpdatedBy)),
+                LastUpdated(AZStd::move(src.LastUpdated)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            SharedGroupDataRecord& operator=(const SharedGroupDataRecord& src) = default;
+            SharedGroupDataRecord& operator=(SharedGroupDataRecord&& src) = default;
+
             SharedGroupDataRecord(const rapidjson::Value& obj) : SharedGroupDataRecord()
             {
                 readFromValue(obj);
@@ -11301,12 +18670,50 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("LastUpdatedBy"):
+                            if (strcmp(member, "LastUpdatedBy") != 0)
+                                break;
+                            LastUpdatedBy = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("LastUpdated"):
+                            if (strcmp(member, "LastUpdated") != 0)
+                                break;
+                            LastUpdated = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetSharedGroupDataResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, SharedGroupDataRecord> Data;
-            std::list<AZStd::string> Members;
+            PlayFabStringMap<SharedGroupDataRecord> Data;
+            std::vector<AZStd::string> Members;
 
             GetSharedGroupDataResult() :
                 PlayFabBaseModel(),
@@ -11320,6 +18727,15 @@ namespace PlayFabComboSdk
                 Members(src.Members)
             {}
 
+            GetSharedGroupDataResult(GetSharedGroupDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data)),
+                Members(AZStd::move(src.Members))
+            {}
+
+            GetSharedGroupDataResult& operator=(const GetSharedGroupDataResult& src) = default;
+            GetSharedGroupDataResult& operator=(GetSharedGroupDataResult&& src) = default;
+
             GetSharedGroupDataResult(const rapidjson::Value& obj) : GetSharedGroupDataResult()
             {
                 readFromValue(obj);
@@ -11335,7 +18751,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, SharedGroupDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<SharedGroupDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -11344,7 +18760,7 @@ namespace PlayFabComboSdk
                 if (!Members.empty()) {
                     writer.String("Members");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Members.begin(); iter != Members.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Members.begin(); iter != Members.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -11363,13 +18779,56 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Members_member = obj.FindMember("Members");
                 if (Members_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Members_member->value;
+                    Members.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Members.push_back(memberList[i].GetString());
+                        Members.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Members"):
+                            if (strcmp(member, "Members") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Members.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Members.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTimeRequest : public PlayFabBaseModel
@@ -11383,6 +18842,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            GetTimeRequest(GetTimeRequest&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            GetTimeRequest& operator=(const GetTimeRequest& src) = default;
+            GetTimeRequest& operator=(GetTimeRequest&& src) = default;
+
             GetTimeRequest(const rapidjson::Value& obj) : GetTimeRequest()
             {
                 readFromValue(obj);
@@ -11403,6 +18869,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct GetTimeResult : public PlayFabBaseModel
@@ -11419,6 +18891,14 @@ namespace PlayFabComboSdk
                 Time(src.Time)
             {}
 
+            GetTimeResult(GetTimeResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Time(AZStd::move(src.Time))
+            {}
+
+            GetTimeResult& operator=(const GetTimeResult& src) = default;
+            GetTimeResult& operator=(GetTimeResult&& src) = default;
+
             GetTimeResult(const rapidjson::Value& obj) : GetTimeResult()
             {
                 readFromValue(obj);
@@ -11443,11 +18923,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Time"):
+                            if (strcmp(member, "Time") != 0)
+                                break;
+                            Time = readDatetime(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTitleDataRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
 
             GetTitleDataRequest() :
                 PlayFabBaseModel(),
@@ -11459,6 +18962,14 @@ namespace PlayFabComboSdk
                 Keys(src.Keys)
             {}
 
+            GetTitleDataRequest(GetTitleDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Keys(AZStd::move(src.Keys))
+            {}
+
+            GetTitleDataRequest& operator=(const GetTitleDataRequest& src) = default;
+            GetTitleDataRequest& operator=(GetTitleDataRequest&& src) = default;
+
             GetTitleDataRequest(const rapidjson::Value& obj) : GetTitleDataRequest()
             {
                 readFromValue(obj);
@@ -11474,7 +18985,7 @@ namespace PlayFabComboSdk
                 if (!Keys.empty()) {
                     writer.String("Keys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -11487,18 +18998,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTitleDataResult : public PlayFabBaseModel
         {
-            std::map<AZStd::string, AZStd::string> Data;
+            PlayFabStringMap<AZStd::string> Data;
 
             GetTitleDataResult() :
                 PlayFabBaseModel(),
@@ -11510,6 +19052,14 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetTitleDataResult(GetTitleDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetTitleDataResult& operator=(const GetTitleDataResult& src) = default;
+            GetTitleDataResult& operator=(GetTitleDataResult&& src) = default;
+
             GetTitleDataResult(const rapidjson::Value& obj) : GetTitleDataResult()
             {
                 readFromValue(obj);
@@ -11525,7 +19075,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -11545,6 +19095,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTitleNewsRequest : public PlayFabBaseModel
@@ -11561,6 +19141,14 @@ namespace PlayFabComboSdk
                 Count(src.Count)
             {}
 
+            GetTitleNewsRequest(GetTitleNewsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Count(AZStd::move(src.Count))
+            {}
+
+            GetTitleNewsRequest& operator=(const GetTitleNewsRequest& src) = default;
+            GetTitleNewsRequest& operator=(GetTitleNewsRequest&& src) = default;
+
             GetTitleNewsRequest(const rapidjson::Value& obj) : GetTitleNewsRequest()
             {
                 readFromValue(obj);
@@ -11587,6 +19175,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Count"):
+                            if (strcmp(member, "Count") != 0)
+                                break;
+                            Count = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct TitleNewsItem : public PlayFabBaseModel
@@ -11612,6 +19223,17 @@ namespace PlayFabComboSdk
                 Body(src.Body)
             {}
 
+            TitleNewsItem(TitleNewsItem&& src) noexcept :
+                PlayFabBaseModel(),
+                Timestamp(AZStd::move(src.Timestamp)),
+                NewsId(AZStd::move(src.NewsId)),
+                Title(AZStd::move(src.Title)),
+                Body(AZStd::move(src.Body))
+            {}
+
+            TitleNewsItem& operator=(const TitleNewsItem& src) = default;
+            TitleNewsItem& operator=(TitleNewsItem&& src) = default;
+
             TitleNewsItem(const rapidjson::Value& obj) : TitleNewsItem()
             {
                 readFromValue(obj);
@@ -11654,11 +19276,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("NewsId"):
+                            if (strcmp(member, "NewsId") != 0)
+                                break;
+                            NewsId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Title"):
+                            if (strcmp(member, "Title") != 0)
+                                break;
+                            Title = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Body"):
+                            if (strcmp(member, "Body") != 0)
+                                break;
+                            Body = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetTitleNewsResult : public PlayFabBaseModel
         {
-            std::list<TitleNewsItem> News;
+            std::vector<TitleNewsItem> News;
 
             GetTitleNewsResult() :
                 PlayFabBaseModel(),
@@ -11670,6 +19330,14 @@ namespace PlayFabComboSdk
                 News(src.News)
             {}
 
+            GetTitleNewsResult(GetTitleNewsResult&& src) noexcept :
+                PlayFabBaseModel(),
+                News(AZStd::move(src.News))
+            {}
+
+            GetTitleNewsResult& operator=(const GetTitleNewsResult& src) = default;
+            GetTitleNewsResult& operator=(GetTitleNewsResult&& src) = default;
+
             GetTitleNewsResult(const rapidjson::Value& obj) : GetTitleNewsResult()
             {
                 readFromValue(obj);
@@ -11685,7 +19353,7 @@ namespace PlayFabComboSdk
                 if (!News.empty()) {
                     writer.String("News");
                     writer.StartArray();
-                    for (std::list<TitleNewsItem>::iterator iter = News.begin(); iter != News.end(); iter++) {
+                    for (std::vector<TitleNewsItem>::iterator iter = News.begin(); iter != News.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -11698,13 +19366,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator News_member = obj.FindMember("News");
                 if (News_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = News_member->value;
+                    News.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        News.push_back(TitleNewsItem(memberList[i]));
+                        News.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("News"):
+                            if (strcmp(member, "News") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                News.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    News.emplace_back();
+                                    News.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserAccountInfoRequest : public PlayFabBaseModel
@@ -11721,6 +19421,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            GetUserAccountInfoRequest(GetUserAccountInfoRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetUserAccountInfoRequest& operator=(const GetUserAccountInfoRequest& src) = default;
+            GetUserAccountInfoRequest& operator=(GetUserAccountInfoRequest&& src) = default;
+
             GetUserAccountInfoRequest(const rapidjson::Value& obj) : GetUserAccountInfoRequest()
             {
                 readFromValue(obj);
@@ -11745,6 +19453,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserAccountInfoResult : public PlayFabBaseModel
@@ -11761,6 +19492,31 @@ namespace PlayFabComboSdk
                 UserInfo(src.UserInfo ? new UserAccountInfo(*src.UserInfo) : nullptr)
             {}
 
+            GetUserAccountInfoResult(GetUserAccountInfoResult&& src) noexcept :
+                PlayFabBaseModel(),
+                UserInfo(src.UserInfo)
+            {
+                src.UserInfo = nullptr;
+            }
+
+            GetUserAccountInfoResult& operator=(const GetUserAccountInfoResult& src)
+            {
+                if (this != &src)
+                    *this = GetUserAccountInfoResult(src);
+                return *this;
+            }
+
+            GetUserAccountInfoResult& operator=(GetUserAccountInfoResult&& src)
+            {
+                if (this != &src)
+                {
+                    if (UserInfo != nullptr) delete UserInfo;
+                    UserInfo = src.UserInfo;
+                    src.UserInfo = nullptr;
+                }
+                return *this;
+            }
+
             GetUserAccountInfoResult(const rapidjson::Value& obj) : GetUserAccountInfoResult()
             {
                 readFromValue(obj);
@@ -11788,6 +19544,30 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("UserInfo"):
+                            if (strcmp(member, "UserInfo") != 0)
+                                break;
+                            UserInfo = new UserAccountInfo;
+                            UserInfo->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserBansRequest : public PlayFabBaseModel
@@ -11804,6 +19584,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            GetUserBansRequest(GetUserBansRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetUserBansRequest& operator=(const GetUserBansRequest& src) = default;
+            GetUserBansRequest& operator=(GetUserBansRequest&& src) = default;
+
             GetUserBansRequest(const rapidjson::Value& obj) : GetUserBansRequest()
             {
                 readFromValue(obj);
@@ -11828,11 +19616,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserBansResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             GetUserBansResult() :
                 PlayFabBaseModel(),
@@ -11844,6 +19655,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            GetUserBansResult(GetUserBansResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            GetUserBansResult& operator=(const GetUserBansResult& src) = default;
+            GetUserBansResult& operator=(GetUserBansResult&& src) = default;
+
             GetUserBansResult(const rapidjson::Value& obj) : GetUserBansResult()
             {
                 readFromValue(obj);
@@ -11859,7 +19678,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -11872,19 +19691,51 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<AZStd::string> Keys;
+            std::vector<AZStd::string> Keys;
             OptionalUint32 IfChangedFromDataVersion;
 
             GetUserDataRequest() :
@@ -11901,6 +19752,16 @@ namespace PlayFabComboSdk
                 IfChangedFromDataVersion(src.IfChangedFromDataVersion)
             {}
 
+            GetUserDataRequest(GetUserDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Keys(AZStd::move(src.Keys)),
+                IfChangedFromDataVersion(AZStd::move(src.IfChangedFromDataVersion))
+            {}
+
+            GetUserDataRequest& operator=(const GetUserDataRequest& src) = default;
+            GetUserDataRequest& operator=(GetUserDataRequest&& src) = default;
+
             GetUserDataRequest(const rapidjson::Value& obj) : GetUserDataRequest()
             {
                 readFromValue(obj);
@@ -11918,7 +19779,7 @@ namespace PlayFabComboSdk
                 if (!Keys.empty()) {
                     writer.String("Keys");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = Keys.begin(); iter != Keys.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -11937,8 +19798,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Keys_member = obj.FindMember("Keys");
                 if (Keys_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Keys_member->value;
+                    Keys.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Keys.push_back(memberList[i].GetString());
+                        Keys.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator IfChangedFromDataVersion_member = obj.FindMember("IfChangedFromDataVersion");
@@ -11946,13 +19808,53 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Keys"):
+                            if (strcmp(member, "Keys") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Keys.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Keys.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("IfChangedFromDataVersion"):
+                            if (strcmp(member, "IfChangedFromDataVersion") != 0)
+                                break;
+                            IfChangedFromDataVersion = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserDataResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             Uint32 DataVersion;
-            std::map<AZStd::string, UserDataRecord> Data;
+            PlayFabStringMap<UserDataRecord> Data;
 
             GetUserDataResult() :
                 PlayFabBaseModel(),
@@ -11968,6 +19870,16 @@ namespace PlayFabComboSdk
                 Data(src.Data)
             {}
 
+            GetUserDataResult(GetUserDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                DataVersion(AZStd::move(src.DataVersion)),
+                Data(AZStd::move(src.Data))
+            {}
+
+            GetUserDataResult& operator=(const GetUserDataResult& src) = default;
+            GetUserDataResult& operator=(GetUserDataResult&& src) = default;
+
             GetUserDataResult(const rapidjson::Value& obj) : GetUserDataResult()
             {
                 readFromValue(obj);
@@ -11989,7 +19901,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, UserDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<UserDataRecord>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -12013,6 +19925,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DataVersion"):
+                            if (strcmp(member, "DataVersion") != 0)
+                                break;
+                            DataVersion = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserInventoryRequest : public PlayFabBaseModel
@@ -12029,8 +19981,16 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
-            GetUserInventoryRequest(const rapidjson::Value& obj) : GetUserInventoryRequest()
-            {
+            GetUserInventoryRequest(GetUserInventoryRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            GetUserInventoryRequest& operator=(const GetUserInventoryRequest& src) = default;
+            GetUserInventoryRequest& operator=(GetUserInventoryRequest&& src) = default;
+
+            GetUserInventoryRequest(const rapidjson::Value& obj) : GetUserInventoryRequest()
+            {
                 readFromValue(obj);
             }
 
@@ -12053,14 +20013,37 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GetUserInventoryResult : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<ItemInstance> Inventory;
-            std::map<AZStd::string, Int32> VirtualCurrency;
-            std::map<AZStd::string, VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
+            std::vector<ItemInstance> Inventory;
+            PlayFabStringMap<Int32> VirtualCurrency;
+            PlayFabStringMap<VirtualCurrencyRechargeTime> VirtualCurrencyRechargeTimes;
 
             GetUserInventoryResult() :
                 PlayFabBaseModel(),
@@ -12078,6 +20061,17 @@ namespace PlayFabComboSdk
                 VirtualCurrencyRechargeTimes(src.VirtualCurrencyRechargeTimes)
             {}
 
+            GetUserInventoryResult(GetUserInventoryResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Inventory(AZStd::move(src.Inventory)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                VirtualCurrencyRechargeTimes(AZStd::move(src.VirtualCurrencyRechargeTimes))
+            {}
+
+            GetUserInventoryResult& operator=(const GetUserInventoryResult& src) = default;
+            GetUserInventoryResult& operator=(GetUserInventoryResult&& src) = default;
+
             GetUserInventoryResult(const rapidjson::Value& obj) : GetUserInventoryResult()
             {
                 readFromValue(obj);
@@ -12097,7 +20091,7 @@ namespace PlayFabComboSdk
                 if (!Inventory.empty()) {
                     writer.String("Inventory");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = Inventory.begin(); iter != Inventory.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -12105,7 +20099,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrency.empty()) {
                     writer.String("VirtualCurrency");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -12114,7 +20108,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrencyRechargeTimes.empty()) {
                     writer.String("VirtualCurrencyRechargeTimes");
                     writer.StartObject();
-                    for (std::map<AZStd::string, VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
+                    for (PlayFabStringMap<VirtualCurrencyRechargeTime>::iterator iter = VirtualCurrencyRechargeTimes.begin(); iter != VirtualCurrencyRechargeTimes.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -12130,8 +20124,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Inventory_member = obj.FindMember("Inventory");
                 if (Inventory_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Inventory_member->value;
+                    Inventory.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Inventory.push_back(ItemInstance(memberList[i]));
+                        Inventory.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrency_member = obj.FindMember("VirtualCurrency");
@@ -12149,6 +20144,66 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Inventory"):
+                            if (strcmp(member, "Inventory") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Inventory.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Inventory.emplace_back();
+                                    Inventory.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrency[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+                            if (strcmp(member, "VirtualCurrencyRechargeTimes") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrencyRechargeTimes[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantCharacterToUserRequest : public PlayFabBaseModel
@@ -12171,6 +20226,16 @@ namespace PlayFabComboSdk
                 CharacterType(src.CharacterType)
             {}
 
+            GrantCharacterToUserRequest(GrantCharacterToUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterName(AZStd::move(src.CharacterName)),
+                CharacterType(AZStd::move(src.CharacterType))
+            {}
+
+            GrantCharacterToUserRequest& operator=(const GrantCharacterToUserRequest& src) = default;
+            GrantCharacterToUserRequest& operator=(GrantCharacterToUserRequest&& src) = default;
+
             GrantCharacterToUserRequest(const rapidjson::Value& obj) : GrantCharacterToUserRequest()
             {
                 readFromValue(obj);
@@ -12203,6 +20268,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterName"):
+                            if (strcmp(member, "CharacterName") != 0)
+                                break;
+                            CharacterName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterType"):
+                            if (strcmp(member, "CharacterType") != 0)
+                                break;
+                            CharacterType = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantCharacterToUserResult : public PlayFabBaseModel
@@ -12219,6 +20317,14 @@ namespace PlayFabComboSdk
                 CharacterId(src.CharacterId)
             {}
 
+            GrantCharacterToUserResult(GrantCharacterToUserResult&& src) noexcept :
+                PlayFabBaseModel(),
+                CharacterId(AZStd::move(src.CharacterId))
+            {}
+
+            GrantCharacterToUserResult& operator=(const GrantCharacterToUserResult& src) = default;
+            GrantCharacterToUserResult& operator=(GrantCharacterToUserResult&& src) = default;
+
             GrantCharacterToUserResult(const rapidjson::Value& obj) : GrantCharacterToUserResult()
             {
                 readFromValue(obj);
@@ -12245,6 +20351,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantedItemInstance : public PlayFabBaseModel
@@ -12265,8 +20394,8 @@ namespace PlayFabComboSdk
             AZStd::string DisplayName;
             AZStd::string UnitCurrency;
             Uint32 UnitPrice;
-            std::list<AZStd::string> BundleContents;
-            std::map<AZStd::string, AZStd::string> CustomData;
+            std::vector<AZStd::string> BundleContents;
+            PlayFabStringMap<AZStd::string> CustomData;
 
             GrantedItemInstance() :
                 PlayFabBaseModel(),
@@ -12312,6 +20441,31 @@ namespace PlayFabComboSdk
                 CustomData(src.CustomData)
             {}
 
+            GrantedItemInstance(GrantedItemInstance&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Result(AZStd::move(src.Result)),
+                ItemId(AZStd::move(src.ItemId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                ItemClass(AZStd::move(src.ItemClass)),
+                PurchaseDate(AZStd::move(src.PurchaseDate)),
+                Expiration(AZStd::move(src.Expiration)),
+                RemainingUses(AZStd::move(src.RemainingUses)),
+                UsesIncrementedBy(AZStd::move(src.UsesIncrementedBy)),
+                Annotation(AZStd::move(src.Annotation)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                BundleParent(AZStd::move(src.BundleParent)),
+                DisplayName(AZStd::move(src.DisplayName)),
+                UnitCurrency(AZStd::move(src.UnitCurrency)),
+                UnitPrice(AZStd::move(src.UnitPrice)),
+                BundleContents(AZStd::move(src.BundleContents)),
+                CustomData(AZStd::move(src.CustomData))
+            {}
+
+            GrantedItemInstance& operator=(const GrantedItemInstance& src) = default;
+            GrantedItemInstance& operator=(GrantedItemInstance&& src) = default;
+
             GrantedItemInstance(const rapidjson::Value& obj) : GrantedItemInstance()
             {
                 readFromValue(obj);
@@ -12387,7 +20541,7 @@ namespace PlayFabComboSdk
                 if (!BundleContents.empty()) {
                     writer.String("BundleContents");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = BundleContents.begin(); iter != BundleContents.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -12395,7 +20549,7 @@ namespace PlayFabComboSdk
                 if (!CustomData.empty()) {
                     writer.String("CustomData");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = CustomData.begin(); iter != CustomData.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -12441,8 +20595,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BundleContents_member = obj.FindMember("BundleContents");
                 if (BundleContents_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BundleContents_member->value;
+                    BundleContents.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BundleContents.push_back(memberList[i].GetString());
+                        BundleContents.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator CustomData_member = obj.FindMember("CustomData");
@@ -12454,6 +20609,128 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Result"):
+                            if (strcmp(member, "Result") != 0)
+                                break;
+                            Result = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemClass"):
+                            if (strcmp(member, "ItemClass") != 0)
+                                break;
+                            ItemClass = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PurchaseDate"):
+                            if (strcmp(member, "PurchaseDate") != 0)
+                                break;
+                            PurchaseDate = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Expiration"):
+                            if (strcmp(member, "Expiration") != 0)
+                                break;
+                            Expiration = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsesIncrementedBy"):
+                            if (strcmp(member, "UsesIncrementedBy") != 0)
+                                break;
+                            UsesIncrementedBy = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleParent"):
+                            if (strcmp(member, "BundleParent") != 0)
+                                break;
+                            BundleParent = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("DisplayName"):
+                            if (strcmp(member, "DisplayName") != 0)
+                                break;
+                            DisplayName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitCurrency"):
+                            if (strcmp(member, "UnitCurrency") != 0)
+                                break;
+                            UnitCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnitPrice"):
+                            if (strcmp(member, "UnitPrice") != 0)
+                                break;
+                            UnitPrice = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("BundleContents"):
+                            if (strcmp(member, "BundleContents") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BundleContents.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BundleContents.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CustomData[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToCharacterRequest : public PlayFabBaseModel
@@ -12462,7 +20739,7 @@ namespace PlayFabComboSdk
             AZStd::string CharacterId;
             AZStd::string PlayFabId;
             AZStd::string Annotation;
-            std::list<AZStd::string> ItemIds;
+            std::vector<AZStd::string> ItemIds;
 
             GrantItemsToCharacterRequest() :
                 PlayFabBaseModel(),
@@ -12482,6 +20759,18 @@ namespace PlayFabComboSdk
                 ItemIds(src.ItemIds)
             {}
 
+            GrantItemsToCharacterRequest(GrantItemsToCharacterRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Annotation(AZStd::move(src.Annotation)),
+                ItemIds(AZStd::move(src.ItemIds))
+            {}
+
+            GrantItemsToCharacterRequest& operator=(const GrantItemsToCharacterRequest& src) = default;
+            GrantItemsToCharacterRequest& operator=(GrantItemsToCharacterRequest&& src) = default;
+
             GrantItemsToCharacterRequest(const rapidjson::Value& obj) : GrantItemsToCharacterRequest()
             {
                 readFromValue(obj);
@@ -12509,7 +20798,7 @@ namespace PlayFabComboSdk
                 if (!ItemIds.empty()) {
                     writer.String("ItemIds");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = ItemIds.begin(); iter != ItemIds.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = ItemIds.begin(); iter != ItemIds.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -12530,18 +20819,69 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemIds_member = obj.FindMember("ItemIds");
                 if (ItemIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemIds_member->value;
+                    ItemIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemIds.push_back(memberList[i].GetString());
+                        ItemIds.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemIds"):
+                            if (strcmp(member, "ItemIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToCharacterResult : public PlayFabBaseModel
         {
-            std::list<GrantedItemInstance> ItemGrantResults;
+            std::vector<GrantedItemInstance> ItemGrantResults;
 
             GrantItemsToCharacterResult() :
                 PlayFabBaseModel(),
@@ -12553,6 +20893,14 @@ namespace PlayFabComboSdk
                 ItemGrantResults(src.ItemGrantResults)
             {}
 
+            GrantItemsToCharacterResult(GrantItemsToCharacterResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemGrantResults(AZStd::move(src.ItemGrantResults))
+            {}
+
+            GrantItemsToCharacterResult& operator=(const GrantItemsToCharacterResult& src) = default;
+            GrantItemsToCharacterResult& operator=(GrantItemsToCharacterResult&& src) = default;
+
             GrantItemsToCharacterResult(const rapidjson::Value& obj) : GrantItemsToCharacterResult()
             {
                 readFromValue(obj);
@@ -12568,7 +20916,7 @@ namespace PlayFabComboSdk
                 if (!ItemGrantResults.empty()) {
                     writer.String("ItemGrantResults");
                     writer.StartArray();
-                    for (std::list<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
+                    for (std::vector<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -12581,13 +20929,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemGrantResults_member = obj.FindMember("ItemGrantResults");
                 if (ItemGrantResults_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemGrantResults_member->value;
+                    ItemGrantResults.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemGrantResults.push_back(GrantedItemInstance(memberList[i]));
+                        ItemGrantResults.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemGrantResults"):
+                            if (strcmp(member, "ItemGrantResults") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemGrantResults.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemGrantResults.emplace_back();
+                                    ItemGrantResults.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToUserRequest : public PlayFabBaseModel
@@ -12595,7 +20975,7 @@ namespace PlayFabComboSdk
             AZStd::string CatalogVersion;
             AZStd::string PlayFabId;
             AZStd::string Annotation;
-            std::list<AZStd::string> ItemIds;
+            std::vector<AZStd::string> ItemIds;
 
             GrantItemsToUserRequest() :
                 PlayFabBaseModel(),
@@ -12613,6 +20993,17 @@ namespace PlayFabComboSdk
                 ItemIds(src.ItemIds)
             {}
 
+            GrantItemsToUserRequest(GrantItemsToUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Annotation(AZStd::move(src.Annotation)),
+                ItemIds(AZStd::move(src.ItemIds))
+            {}
+
+            GrantItemsToUserRequest& operator=(const GrantItemsToUserRequest& src) = default;
+            GrantItemsToUserRequest& operator=(GrantItemsToUserRequest&& src) = default;
+
             GrantItemsToUserRequest(const rapidjson::Value& obj) : GrantItemsToUserRequest()
             {
                 readFromValue(obj);
@@ -12637,7 +21028,7 @@ namespace PlayFabComboSdk
                 }
                 writer.String("ItemIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = ItemIds.begin(); iter != ItemIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = ItemIds.begin(); iter != ItemIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -12655,18 +21046,64 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemIds_member = obj.FindMember("ItemIds");
                 if (ItemIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemIds_member->value;
+                    ItemIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemIds.push_back(memberList[i].GetString());
+                        ItemIds.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemIds"):
+                            if (strcmp(member, "ItemIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToUserResult : public PlayFabBaseModel
         {
-            std::list<GrantedItemInstance> ItemGrantResults;
+            std::vector<GrantedItemInstance> ItemGrantResults;
 
             GrantItemsToUserResult() :
                 PlayFabBaseModel(),
@@ -12678,6 +21115,14 @@ namespace PlayFabComboSdk
                 ItemGrantResults(src.ItemGrantResults)
             {}
 
+            GrantItemsToUserResult(GrantItemsToUserResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemGrantResults(AZStd::move(src.ItemGrantResults))
+            {}
+
+            GrantItemsToUserResult& operator=(const GrantItemsToUserResult& src) = default;
+            GrantItemsToUserResult& operator=(GrantItemsToUserResult&& src) = default;
+
             GrantItemsToUserResult(const rapidjson::Value& obj) : GrantItemsToUserResult()
             {
                 readFromValue(obj);
@@ -12693,7 +21138,7 @@ namespace PlayFabComboSdk
                 if (!ItemGrantResults.empty()) {
                     writer.String("ItemGrantResults");
                     writer.StartArray();
-                    for (std::list<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
+                    for (std::vector<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -12706,13 +21151,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemGrantResults_member = obj.FindMember("ItemGrantResults");
                 if (ItemGrantResults_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemGrantResults_member->value;
+                    ItemGrantResults.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemGrantResults.push_back(GrantedItemInstance(memberList[i]));
+                        ItemGrantResults.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemGrantResults"):
+                            if (strcmp(member, "ItemGrantResults") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemGrantResults.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemGrantResults.emplace_back();
+                                    ItemGrantResults.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ItemGrant : public PlayFabBaseModel
@@ -12721,8 +21198,8 @@ namespace PlayFabComboSdk
             AZStd::string ItemId;
             AZStd::string Annotation;
             AZStd::string CharacterId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
 
             ItemGrant() :
                 PlayFabBaseModel(),
@@ -12744,6 +21221,19 @@ namespace PlayFabComboSdk
                 KeysToRemove(src.KeysToRemove)
             {}
 
+            ItemGrant(ItemGrant&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                ItemId(AZStd::move(src.ItemId)),
+                Annotation(AZStd::move(src.Annotation)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove))
+            {}
+
+            ItemGrant& operator=(const ItemGrant& src) = default;
+            ItemGrant& operator=(ItemGrant&& src) = default;
+
             ItemGrant(const rapidjson::Value& obj) : ItemGrant()
             {
                 readFromValue(obj);
@@ -12771,7 +21261,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -12780,7 +21270,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -12807,19 +21297,82 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemId"):
+                            if (strcmp(member, "ItemId") != 0)
+                                break;
+                            ItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Annotation"):
+                            if (strcmp(member, "Annotation") != 0)
+                                break;
+                            Annotation = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToUsersRequest : public PlayFabBaseModel
         {
             AZStd::string CatalogVersion;
-            std::list<ItemGrant> ItemGrants;
+            std::vector<ItemGrant> ItemGrants;
 
             GrantItemsToUsersRequest() :
                 PlayFabBaseModel(),
@@ -12833,6 +21386,15 @@ namespace PlayFabComboSdk
                 ItemGrants(src.ItemGrants)
             {}
 
+            GrantItemsToUsersRequest(GrantItemsToUsersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                ItemGrants(AZStd::move(src.ItemGrants))
+            {}
+
+            GrantItemsToUsersRequest& operator=(const GrantItemsToUsersRequest& src) = default;
+            GrantItemsToUsersRequest& operator=(GrantItemsToUsersRequest&& src) = default;
+
             GrantItemsToUsersRequest(const rapidjson::Value& obj) : GrantItemsToUsersRequest()
             {
                 readFromValue(obj);
@@ -12851,7 +21413,7 @@ namespace PlayFabComboSdk
                 }
                 writer.String("ItemGrants");
                 writer.StartArray();
-                for (std::list<ItemGrant>::iterator iter = ItemGrants.begin(); iter != ItemGrants.end(); iter++) {
+                for (std::vector<ItemGrant>::iterator iter = ItemGrants.begin(); iter != ItemGrants.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -12865,18 +21427,55 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemGrants_member = obj.FindMember("ItemGrants");
                 if (ItemGrants_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemGrants_member->value;
+                    ItemGrants.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemGrants.push_back(ItemGrant(memberList[i]));
+                        ItemGrants.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemGrants"):
+                            if (strcmp(member, "ItemGrants") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemGrants.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemGrants.emplace_back();
+                                    ItemGrants.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct GrantItemsToUsersResult : public PlayFabBaseModel
         {
-            std::list<GrantedItemInstance> ItemGrantResults;
+            std::vector<GrantedItemInstance> ItemGrantResults;
 
             GrantItemsToUsersResult() :
                 PlayFabBaseModel(),
@@ -12888,6 +21487,14 @@ namespace PlayFabComboSdk
                 ItemGrantResults(src.ItemGrantResults)
             {}
 
+            GrantItemsToUsersResult(GrantItemsToUsersResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemGrantResults(AZStd::move(src.ItemGrantResults))
+            {}
+
+            GrantItemsToUsersResult& operator=(const GrantItemsToUsersResult& src) = default;
+            GrantItemsToUsersResult& operator=(GrantItemsToUsersResult&& src) = default;
+
             GrantItemsToUsersResult(const rapidjson::Value& obj) : GrantItemsToUsersResult()
             {
                 readFromValue(obj);
@@ -12903,7 +21510,7 @@ namespace PlayFabComboSdk
                 if (!ItemGrantResults.empty()) {
                     writer.String("ItemGrantResults");
                     writer.StartArray();
-                    for (std::list<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
+                    for (std::vector<GrantedItemInstance>::iterator iter = ItemGrantResults.begin(); iter != ItemGrantResults.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -12916,13 +21523,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator ItemGrantResults_member = obj.FindMember("ItemGrantResults");
                 if (ItemGrantResults_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = ItemGrantResults_member->value;
+                    ItemGrantResults.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        ItemGrantResults.push_back(GrantedItemInstance(memberList[i]));
+                        ItemGrantResults.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemGrantResults"):
+                            if (strcmp(member, "ItemGrantResults") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                ItemGrantResults.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    ItemGrantResults.emplace_back();
+                                    ItemGrantResults.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ListUsersCharactersRequest : public PlayFabBaseModel
@@ -12939,6 +21578,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            ListUsersCharactersRequest(ListUsersCharactersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            ListUsersCharactersRequest& operator=(const ListUsersCharactersRequest& src) = default;
+            ListUsersCharactersRequest& operator=(ListUsersCharactersRequest&& src) = default;
+
             ListUsersCharactersRequest(const rapidjson::Value& obj) : ListUsersCharactersRequest()
             {
                 readFromValue(obj);
@@ -12963,11 +21610,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ListUsersCharactersResult : public PlayFabBaseModel
         {
-            std::list<CharacterResult> Characters;
+            std::vector<CharacterResult> Characters;
 
             ListUsersCharactersResult() :
                 PlayFabBaseModel(),
@@ -12979,6 +21649,14 @@ namespace PlayFabComboSdk
                 Characters(src.Characters)
             {}
 
+            ListUsersCharactersResult(ListUsersCharactersResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Characters(AZStd::move(src.Characters))
+            {}
+
+            ListUsersCharactersResult& operator=(const ListUsersCharactersResult& src) = default;
+            ListUsersCharactersResult& operator=(ListUsersCharactersResult&& src) = default;
+
             ListUsersCharactersResult(const rapidjson::Value& obj) : ListUsersCharactersResult()
             {
                 readFromValue(obj);
@@ -12994,7 +21672,7 @@ namespace PlayFabComboSdk
                 if (!Characters.empty()) {
                     writer.String("Characters");
                     writer.StartArray();
-                    for (std::list<CharacterResult>::iterator iter = Characters.begin(); iter != Characters.end(); iter++) {
+                    for (std::vector<CharacterResult>::iterator iter = Characters.begin(); iter != Characters.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -13007,13 +21685,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Characters_member = obj.FindMember("Characters");
                 if (Characters_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Characters_member->value;
+                    Characters.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Characters.push_back(CharacterResult(memberList[i]));
+                        Characters.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Characters"):
+                            if (strcmp(member, "Characters") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Characters.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Characters.emplace_back();
+                                    Characters.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyCharacterVirtualCurrencyResult : public PlayFabBaseModel
@@ -13033,6 +21743,15 @@ namespace PlayFabComboSdk
                 Balance(src.Balance)
             {}
 
+            ModifyCharacterVirtualCurrencyResult(ModifyCharacterVirtualCurrencyResult&& src) noexcept :
+                PlayFabBaseModel(),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Balance(AZStd::move(src.Balance))
+            {}
+
+            ModifyCharacterVirtualCurrencyResult& operator=(const ModifyCharacterVirtualCurrencyResult& src) = default;
+            ModifyCharacterVirtualCurrencyResult& operator=(ModifyCharacterVirtualCurrencyResult&& src) = default;
+
             ModifyCharacterVirtualCurrencyResult(const rapidjson::Value& obj) : ModifyCharacterVirtualCurrencyResult()
             {
                 readFromValue(obj);
@@ -13063,6 +21782,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Balance"):
+                            if (strcmp(member, "Balance") != 0)
+                                break;
+                            Balance = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyItemUsesRequest : public PlayFabBaseModel
@@ -13085,6 +21832,16 @@ namespace PlayFabComboSdk
                 UsesToAdd(src.UsesToAdd)
             {}
 
+            ModifyItemUsesRequest(ModifyItemUsesRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                UsesToAdd(AZStd::move(src.UsesToAdd))
+            {}
+
+            ModifyItemUsesRequest& operator=(const ModifyItemUsesRequest& src) = default;
+            ModifyItemUsesRequest& operator=(ModifyItemUsesRequest&& src) = default;
+
             ModifyItemUsesRequest(const rapidjson::Value& obj) : ModifyItemUsesRequest()
             {
                 readFromValue(obj);
@@ -13117,6 +21874,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UsesToAdd"):
+                            if (strcmp(member, "UsesToAdd") != 0)
+                                break;
+                            UsesToAdd = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyItemUsesResult : public PlayFabBaseModel
@@ -13136,6 +21926,15 @@ namespace PlayFabComboSdk
                 RemainingUses(src.RemainingUses)
             {}
 
+            ModifyItemUsesResult(ModifyItemUsesResult&& src) noexcept :
+                PlayFabBaseModel(),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                RemainingUses(AZStd::move(src.RemainingUses))
+            {}
+
+            ModifyItemUsesResult& operator=(const ModifyItemUsesResult& src) = default;
+            ModifyItemUsesResult& operator=(ModifyItemUsesResult&& src) = default;
+
             ModifyItemUsesResult(const rapidjson::Value& obj) : ModifyItemUsesResult()
             {
                 readFromValue(obj);
@@ -13166,6 +21965,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("RemainingUses"):
+                            if (strcmp(member, "RemainingUses") != 0)
+                                break;
+                            RemainingUses = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ModifyUserVirtualCurrencyResult : public PlayFabBaseModel
@@ -13191,6 +22018,17 @@ namespace PlayFabComboSdk
                 Balance(src.Balance)
             {}
 
+            ModifyUserVirtualCurrencyResult(ModifyUserVirtualCurrencyResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                BalanceChange(AZStd::move(src.BalanceChange)),
+                Balance(AZStd::move(src.Balance))
+            {}
+
+            ModifyUserVirtualCurrencyResult& operator=(const ModifyUserVirtualCurrencyResult& src) = default;
+            ModifyUserVirtualCurrencyResult& operator=(ModifyUserVirtualCurrencyResult&& src) = default;
+
             ModifyUserVirtualCurrencyResult(const rapidjson::Value& obj) : ModifyUserVirtualCurrencyResult()
             {
                 readFromValue(obj);
@@ -13231,6 +22069,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("BalanceChange"):
+                            if (strcmp(member, "BalanceChange") != 0)
+                                break;
+                            BalanceChange = reader.GetValue().GetInt();
+                            continue;
+                        case PlayFabJsonReader::Hash("Balance"):
+                            if (strcmp(member, "Balance") != 0)
+                                break;
+                            Balance = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct MoveItemToCharacterFromCharacterRequest : public PlayFabBaseModel
@@ -13256,6 +22132,17 @@ namespace PlayFabComboSdk
                 ItemInstanceId(src.ItemInstanceId)
             {}
 
+            MoveItemToCharacterFromCharacterRequest(MoveItemToCharacterFromCharacterRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                GivingCharacterId(AZStd::move(src.GivingCharacterId)),
+                ReceivingCharacterId(AZStd::move(src.ReceivingCharacterId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId))
+            {}
+
+            MoveItemToCharacterFromCharacterRequest& operator=(const MoveItemToCharacterFromCharacterRequest& src) = default;
+            MoveItemToCharacterFromCharacterRequest& operator=(MoveItemToCharacterFromCharacterRequest&& src) = default;
+
             MoveItemToCharacterFromCharacterRequest(const rapidjson::Value& obj) : MoveItemToCharacterFromCharacterRequest()
             {
                 readFromValue(obj);
@@ -13292,6 +22179,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GivingCharacterId"):
+                            if (strcmp(member, "GivingCharacterId") != 0)
+                                break;
+                            GivingCharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ReceivingCharacterId"):
+                            if (strcmp(member, "ReceivingCharacterId") != 0)
+                                break;
+                            ReceivingCharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct MoveItemToCharacterFromCharacterResult : public PlayFabBaseModel
@@ -13305,6 +22230,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            MoveItemToCharacterFromCharacterResult(MoveItemToCharacterFromCharacterResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            MoveItemToCharacterFromCharacterResult& operator=(const MoveItemToCharacterFromCharacterResult& src) = default;
+            MoveItemToCharacterFromCharacterResult& operator=(MoveItemToCharacterFromCharacterResult&& src) = default;
+
             MoveItemToCharacterFromCharacterResult(const rapidjson::Value& obj) : MoveItemToCharacterFromCharacterResult()
             {
                 readFromValue(obj);
@@ -13325,6 +22257,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct MoveItemToCharacterFromUserRequest : public PlayFabBaseModel
@@ -13347,6 +22285,16 @@ namespace PlayFabComboSdk
                 ItemInstanceId(src.ItemInstanceId)
             {}
 
+            MoveItemToCharacterFromUserRequest(MoveItemToCharacterFromUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId))
+            {}
+
+            MoveItemToCharacterFromUserRequest& operator=(const MoveItemToCharacterFromUserRequest& src) = default;
+            MoveItemToCharacterFromUserRequest& operator=(MoveItemToCharacterFromUserRequest&& src) = default;
+
             MoveItemToCharacterFromUserRequest(const rapidjson::Value& obj) : MoveItemToCharacterFromUserRequest()
             {
                 readFromValue(obj);
@@ -13379,6 +22327,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct MoveItemToCharacterFromUserResult : public PlayFabBaseModel
@@ -13392,6 +22373,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            MoveItemToCharacterFromUserResult(MoveItemToCharacterFromUserResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            MoveItemToCharacterFromUserResult& operator=(const MoveItemToCharacterFromUserResult& src) = default;
+            MoveItemToCharacterFromUserResult& operator=(MoveItemToCharacterFromUserResult&& src) = default;
+
             MoveItemToCharacterFromUserResult(const rapidjson::Value& obj) : MoveItemToCharacterFromUserResult()
             {
                 readFromValue(obj);
@@ -13412,6 +22400,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct MoveItemToUserFromCharacterRequest : public PlayFabBaseModel
@@ -13434,6 +22428,16 @@ namespace PlayFabComboSdk
                 ItemInstanceId(src.ItemInstanceId)
             {}
 
+            MoveItemToUserFromCharacterRequest(MoveItemToUserFromCharacterRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId))
+            {}
+
+            MoveItemToUserFromCharacterRequest& operator=(const MoveItemToUserFromCharacterRequest& src) = default;
+            MoveItemToUserFromCharacterRequest& operator=(MoveItemToUserFromCharacterRequest&& src) = default;
+
             MoveItemToUserFromCharacterRequest(const rapidjson::Value& obj) : MoveItemToUserFromCharacterRequest()
             {
                 readFromValue(obj);
@@ -13466,6 +22470,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct MoveItemToUserFromCharacterResult : public PlayFabBaseModel
@@ -13479,6 +22516,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            MoveItemToUserFromCharacterResult(MoveItemToUserFromCharacterResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            MoveItemToUserFromCharacterResult& operator=(const MoveItemToUserFromCharacterResult& src) = default;
+            MoveItemToUserFromCharacterResult& operator=(MoveItemToUserFromCharacterResult&& src) = default;
+
             MoveItemToUserFromCharacterResult(const rapidjson::Value& obj) : MoveItemToUserFromCharacterResult()
             {
                 readFromValue(obj);
@@ -13499,6 +22543,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct NotifyMatchmakerPlayerLeftRequest : public PlayFabBaseModel
@@ -13518,6 +22568,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            NotifyMatchmakerPlayerLeftRequest(NotifyMatchmakerPlayerLeftRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            NotifyMatchmakerPlayerLeftRequest& operator=(const NotifyMatchmakerPlayerLeftRequest& src) = default;
+            NotifyMatchmakerPlayerLeftRequest& operator=(NotifyMatchmakerPlayerLeftRequest&& src) = default;
+
             NotifyMatchmakerPlayerLeftRequest(const rapidjson::Value& obj) : NotifyMatchmakerPlayerLeftRequest()
             {
                 readFromValue(obj);
@@ -13546,6 +22605,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         enum PlayerConnectionState
@@ -13574,21 +22661,16 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<PlayerConnectionState>(obj.GetInt());
 
-            static std::map<const char *, PlayerConnectionState, PlayFabComboSdk::StringCompare> _PlayerConnectionStateMap;
-            if (_PlayerConnectionStateMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _PlayerConnectionStateMap["Unassigned"] = PlayerConnectionStateUnassigned;
-                _PlayerConnectionStateMap["Connecting"] = PlayerConnectionStateConnecting;
-                _PlayerConnectionStateMap["Participating"] = PlayerConnectionStateParticipating;
-                _PlayerConnectionStateMap["Participated"] = PlayerConnectionStateParticipated;
-
+            case PlayFabJsonReader::Hash("Unassigned"): if (strcmp(name, "Unassigned") == 0) return PlayerConnectionStateUnassigned; break;
+            case PlayFabJsonReader::Hash("Connecting"): if (strcmp(name, "Connecting") == 0) return PlayerConnectionStateConnecting; break;
+            case PlayFabJsonReader::Hash("Participating"): if (strcmp(name, "Participating") == 0) return PlayerConnectionStateParticipating; break;
+            case PlayFabJsonReader::Hash("Participated"): if (strcmp(name, "Participated") == 0) return PlayerConnectionStateParticipated; break;
             }
 
-            auto output = _PlayerConnectionStateMap.find(obj.GetString());
-            if (output != _PlayerConnectionStateMap.end())
-                return output->second;
-
             return PlayerConnectionStateUnassigned; // Basically critical fail
         }
 
@@ -13606,6 +22688,14 @@ namespace PlayFabComboSdk
                 PlayerState(src.PlayerState)
             {}
 
+            NotifyMatchmakerPlayerLeftResult(NotifyMatchmakerPlayerLeftResult&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayerState(AZStd::move(src.PlayerState))
+            {}
+
+            NotifyMatchmakerPlayerLeftResult& operator=(const NotifyMatchmakerPlayerLeftResult& src) = default;
+            NotifyMatchmakerPlayerLeftResult& operator=(NotifyMatchmakerPlayerLeftResult&& src) = default;
+
             NotifyMatchmakerPlayerLeftResult(const rapidjson::Value& obj) : NotifyMatchmakerPlayerLeftResult()
             {
                 readFromValue(obj);
@@ -13632,6 +22722,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayerState"):
+                            if (strcmp(member, "PlayerState") != 0)
+                                break;
+                            PlayerState = readPlayerConnectionStateFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct PushNotificationPackage : public PlayFabBaseModel
@@ -13663,6 +22776,19 @@ namespace PlayFabComboSdk
                 CustomData(src.CustomData)
             {}
 
+            PushNotificationPackage(PushNotificationPackage&& src) noexcept :
+                PlayFabBaseModel(),
+                ScheduleDate(AZStd::move(src.ScheduleDate)),
+                Title(AZStd::move(src.Title)),
+                Message(AZStd::move(src.Message)),
+                Icon(AZStd::move(src.Icon)),
+                Sound(AZStd::move(src.Sound)),
+                CustomData(AZStd::move(src.CustomData))
+            {}
+
+            PushNotificationPackage& operator=(const PushNotificationPackage& src) = default;
+            PushNotificationPackage& operator=(PushNotificationPackage&& src) = default;
+
             PushNotificationPackage(const rapidjson::Value& obj) : PushNotificationPackage()
             {
                 readFromValue(obj);
@@ -13715,6 +22841,54 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ScheduleDate"):
+                            if (strcmp(member, "ScheduleDate") != 0)
+                                break;
+                            ScheduleDate = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Title"):
+                            if (strcmp(member, "Title") != 0)
+                                break;
+                            Title = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Message"):
+                            if (strcmp(member, "Message") != 0)
+                                break;
+                            Message = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Icon"):
+                            if (strcmp(member, "Icon") != 0)
+                                break;
+                            Icon = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Sound"):
+                            if (strcmp(member, "Sound") != 0)
+                                break;
+                            Sound = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CustomData"):
+                            if (strcmp(member, "CustomData") != 0)
+                                break;
+                            CustomData = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RedeemCouponRequest : public PlayFabBaseModel
@@ -13740,6 +22914,17 @@ namespace PlayFabComboSdk
                 CharacterId(src.CharacterId)
             {}
 
+            RedeemCouponRequest(RedeemCouponRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                CouponCode(AZStd::move(src.CouponCode)),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CatalogVersion(AZStd::move(src.CatalogVersion)),
+                CharacterId(AZStd::move(src.CharacterId))
+            {}
+
+            RedeemCouponRequest& operator=(const RedeemCouponRequest& src) = default;
+            RedeemCouponRequest& operator=(RedeemCouponRequest&& src) = default;
+
             RedeemCouponRequest(const rapidjson::Value& obj) : RedeemCouponRequest()
             {
                 readFromValue(obj);
@@ -13780,11 +22965,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("CouponCode"):
+                            if (strcmp(member, "CouponCode") != 0)
+                                break;
+                            CouponCode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RedeemCouponResult : public PlayFabBaseModel
         {
-            std::list<ItemInstance> GrantedItems;
+            std::vector<ItemInstance> GrantedItems;
 
             RedeemCouponResult() :
                 PlayFabBaseModel(),
@@ -13796,9 +23019,17 @@ namespace PlayFabComboSdk
                 GrantedItems(src.GrantedItems)
             {}
 
-            RedeemCouponResult(const rapidjson::Value& obj) : RedeemCouponResult()
-            {
-                readFromValue(obj);
+            RedeemCouponResult(RedeemCouponResult&& src) noexcept :
+                PlayFabBaseModel(),
+                GrantedItems(AZStd::move(src.GrantedItems))
+            {}
+
+            RedeemCouponResult& operator=(const RedeemCouponResult& src) = default;
+            RedeemCouponResult& operator=(RedeemCouponResult&& src) = default;
+
+            RedeemCouponResult(const rapidjson::Value& obj) : RedeemCouponResult()
+            {
+                readFromValue(obj);
             }
 
             ~RedeemCouponResult()
@@ -13811,7 +23042,7 @@ namespace PlayFabComboSdk
                 if (!GrantedItems.empty()) {
                     writer.String("GrantedItems");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = GrantedItems.begin(); iter != GrantedItems.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = GrantedItems.begin(); iter != GrantedItems.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -13824,13 +23055,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator GrantedItems_member = obj.FindMember("GrantedItems");
                 if (GrantedItems_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = GrantedItems_member->value;
+                    GrantedItems.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        GrantedItems.push_back(ItemInstance(memberList[i]));
+                        GrantedItems.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("GrantedItems"):
+                            if (strcmp(member, "GrantedItems") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                GrantedItems.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    GrantedItems.emplace_back();
+                                    GrantedItems.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RedeemMatchmakerTicketRequest : public PlayFabBaseModel
@@ -13850,6 +23113,15 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            RedeemMatchmakerTicketRequest(RedeemMatchmakerTicketRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Ticket(AZStd::move(src.Ticket)),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            RedeemMatchmakerTicketRequest& operator=(const RedeemMatchmakerTicketRequest& src) = default;
+            RedeemMatchmakerTicketRequest& operator=(RedeemMatchmakerTicketRequest&& src) = default;
+
             RedeemMatchmakerTicketRequest(const rapidjson::Value& obj) : RedeemMatchmakerTicketRequest()
             {
                 readFromValue(obj);
@@ -13878,6 +23150,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Ticket"):
+                            if (strcmp(member, "Ticket") != 0)
+                                break;
+                            Ticket = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RedeemMatchmakerTicketResult : public PlayFabBaseModel
@@ -13900,6 +23200,35 @@ namespace PlayFabComboSdk
                 UserInfo(src.UserInfo ? new UserAccountInfo(*src.UserInfo) : nullptr)
             {}
 
+            RedeemMatchmakerTicketResult(RedeemMatchmakerTicketResult&& src) noexcept :
+                PlayFabBaseModel(),
+                TicketIsValid(AZStd::move(src.TicketIsValid)),
+                Error(AZStd::move(src.Error)),
+                UserInfo(src.UserInfo)
+            {
+                src.UserInfo = nullptr;
+            }
+
+            RedeemMatchmakerTicketResult& operator=(const RedeemMatchmakerTicketResult& src)
+            {
+                if (this != &src)
+                    *this = RedeemMatchmakerTicketResult(src);
+                return *this;
+            }
+
+            RedeemMatchmakerTicketResult& operator=(RedeemMatchmakerTicketResult&& src)
+            {
+                if (this != &src)
+                {
+                    TicketIsValid = AZStd::move(src.TicketIsValid);
+                    Error = AZStd::move(src.Error);
+                    if (UserInfo != nullptr) delete UserInfo;
+                    UserInfo = src.UserInfo;
+                    src.UserInfo = nullptr;
+                }
+                return *this;
+            }
+
             RedeemMatchmakerTicketResult(const rapidjson::Value& obj) : RedeemMatchmakerTicketResult()
             {
                 readFromValue(obj);
@@ -13937,6 +23266,40 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("TicketIsValid"):
+                            if (strcmp(member, "TicketIsValid") != 0)
+                                break;
+                            TicketIsValid = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Error"):
+                            if (strcmp(member, "Error") != 0)
+                                break;
+                            Error = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UserInfo"):
+                            if (strcmp(member, "UserInfo") != 0)
+                                break;
+                            UserInfo = new UserAccountInfo;
+                            UserInfo->readFromReader(reader);
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RefreshGameServerInstanceHeartbeatRequest : public PlayFabBaseModel
@@ -13953,6 +23316,14 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            RefreshGameServerInstanceHeartbeatRequest(RefreshGameServerInstanceHeartbeatRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            RefreshGameServerInstanceHeartbeatRequest& operator=(const RefreshGameServerInstanceHeartbeatRequest& src) = default;
+            RefreshGameServerInstanceHeartbeatRequest& operator=(RefreshGameServerInstanceHeartbeatRequest&& src) = default;
+
             RefreshGameServerInstanceHeartbeatRequest(const rapidjson::Value& obj) : RefreshGameServerInstanceHeartbeatRequest()
             {
                 readFromValue(obj);
@@ -13977,6 +23348,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RefreshGameServerInstanceHeartbeatResult : public PlayFabBaseModel
@@ -13990,6 +23384,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RefreshGameServerInstanceHeartbeatResult(RefreshGameServerInstanceHeartbeatResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RefreshGameServerInstanceHeartbeatResult& operator=(const RefreshGameServerInstanceHeartbeatResult& src) = default;
+            RefreshGameServerInstanceHeartbeatResult& operator=(RefreshGameServerInstanceHeartbeatResult&& src) = default;
+
             RefreshGameServerInstanceHeartbeatResult(const rapidjson::Value& obj) : RefreshGameServerInstanceHeartbeatResult()
             {
                 readFromValue(obj);
@@ -14010,6 +23411,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         enum Region
@@ -14044,24 +23451,19 @@ namespace PlayFabComboSdk
             if (obj.IsNumber())
                 return static_cast<Region>(obj.GetInt());
 
-            static std::map<const char *, Region, PlayFabComboSdk::StringCompare> _RegionMap;
-            if (_RegionMap.size() == 0)
+            // Compile time hashes of the names, so there is no table to build or lock, and strcmp only confirms the one candidate
+            const char* name = obj.GetString();
+            switch (PlayFabJsonReader::Hash(name))
             {
-                // Auto-generate the map on the first use
-                _RegionMap["USCentral"] = RegionUSCentral;
-                _RegionMap["USEast"] = RegionUSEast;
-                _RegionMap["EUWest"] = RegionEUWest;
-                _RegionMap["Singapore"] = RegionSingapore;
-                _RegionMap["Japan"] = RegionJapan;
-                _RegionMap["Brazil"] = RegionBrazil;
-                _RegionMap["Australia"] = RegionAustralia;
-
+            case PlayFabJsonReader::Hash("USCentral"): if (strcmp(name, "USCentral") == 0) return RegionUSCentral; break;
+            case PlayFabJsonReader::Hash("USEast"): if (strcmp(name, "USEast") == 0) return RegionUSEast; break;
+            case PlayFabJsonReader::Hash("EUWest"): if (strcmp(name, "EUWest") == 0) return RegionEUWest; break;
+            case PlayFabJsonReader::Hash("Singapore"): if (strcmp(name, "Singapore") == 0) return RegionSingapore; break;
+            case PlayFabJsonReader::Hash("Japan"): if (strcmp(name, "Japan") == 0) return RegionJapan; break;
+            case PlayFabJsonReader::Hash("Brazil"): if (strcmp(name, "Brazil") == 0) return RegionBrazil; break;
+            case PlayFabJsonReader::Hash("Australia"): if (strcmp(name, "Australia") == 0) return RegionAustralia; break;
             }
 
-            auto output = _RegionMap.find(obj.GetString());
-            if (output != _RegionMap.end())
-                return output->second;
-
             return RegionUSCentral; // Basically critical fail
         }
 
@@ -14073,7 +23475,7 @@ namespace PlayFabComboSdk
             AZStd::string Build;
             Region pfRegion;
             AZStd::string GameMode;
-            std::map<AZStd::string, AZStd::string> Tags;
+            PlayFabStringMap<AZStd::string> Tags;
 
             RegisterGameRequest() :
                 PlayFabBaseModel(),
@@ -14097,6 +23499,20 @@ namespace PlayFabComboSdk
                 Tags(src.Tags)
             {}
 
+            RegisterGameRequest(RegisterGameRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                ServerHost(AZStd::move(src.ServerHost)),
+                ServerPort(AZStd::move(src.ServerPort)),
+                Build(AZStd::move(src.Build)),
+                pfRegion(AZStd::move(src.pfRegion)),
+                GameMode(AZStd::move(src.GameMode)),
+                Tags(AZStd::move(src.Tags))
+            {}
+
+            RegisterGameRequest& operator=(const RegisterGameRequest& src) = default;
+            RegisterGameRequest& operator=(RegisterGameRequest&& src) = default;
+
             RegisterGameRequest(const rapidjson::Value& obj) : RegisterGameRequest()
             {
                 readFromValue(obj);
@@ -14126,7 +23542,7 @@ namespace PlayFabComboSdk
                 if (!Tags.empty()) {
                     writer.String("Tags");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -14158,6 +23574,66 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerHost"):
+                            if (strcmp(member, "ServerHost") != 0)
+                                break;
+                            ServerHost = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ServerPort"):
+                            if (strcmp(member, "ServerPort") != 0)
+                                break;
+                            ServerPort = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Build"):
+                            if (strcmp(member, "Build") != 0)
+                                break;
+                            Build = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Region"):
+                            if (strcmp(member, "Region") != 0)
+                                break;
+                            pfRegion = readRegionFromValue(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("GameMode"):
+                            if (strcmp(member, "GameMode") != 0)
+                                break;
+                            GameMode = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Tags[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RegisterGameResponse : public PlayFabBaseModel
@@ -14174,6 +23650,14 @@ namespace PlayFabComboSdk
                 LobbyId(src.LobbyId)
             {}
 
+            RegisterGameResponse(RegisterGameResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId))
+            {}
+
+            RegisterGameResponse& operator=(const RegisterGameResponse& src) = default;
+            RegisterGameResponse& operator=(RegisterGameResponse&& src) = default;
+
             RegisterGameResponse(const rapidjson::Value& obj) : RegisterGameResponse()
             {
                 readFromValue(obj);
@@ -14200,6 +23684,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemoveFriendRequest : public PlayFabBaseModel
@@ -14219,6 +23726,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            RemoveFriendRequest(RemoveFriendRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                FriendPlayFabId(AZStd::move(src.FriendPlayFabId)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            RemoveFriendRequest& operator=(const RemoveFriendRequest& src) = default;
+            RemoveFriendRequest& operator=(RemoveFriendRequest&& src) = default;
+
             RemoveFriendRequest(const rapidjson::Value& obj) : RemoveFriendRequest()
             {
                 readFromValue(obj);
@@ -14247,6 +23763,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("FriendPlayFabId"):
+                            if (strcmp(member, "FriendPlayFabId") != 0)
+                                break;
+                            FriendPlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemovePlayerTagRequest : public PlayFabBaseModel
@@ -14266,6 +23810,15 @@ namespace PlayFabComboSdk
                 TagName(src.TagName)
             {}
 
+            RemovePlayerTagRequest(RemovePlayerTagRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                TagName(AZStd::move(src.TagName))
+            {}
+
+            RemovePlayerTagRequest& operator=(const RemovePlayerTagRequest& src) = default;
+            RemovePlayerTagRequest& operator=(RemovePlayerTagRequest&& src) = default;
+
             RemovePlayerTagRequest(const rapidjson::Value& obj) : RemovePlayerTagRequest()
             {
                 readFromValue(obj);
@@ -14294,6 +23847,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("TagName"):
+                            if (strcmp(member, "TagName") != 0)
+                                break;
+                            TagName = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemovePlayerTagResult : public PlayFabBaseModel
@@ -14307,6 +23888,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RemovePlayerTagResult(RemovePlayerTagResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RemovePlayerTagResult& operator=(const RemovePlayerTagResult& src) = default;
+            RemovePlayerTagResult& operator=(RemovePlayerTagResult&& src) = default;
+
             RemovePlayerTagResult(const rapidjson::Value& obj) : RemovePlayerTagResult()
             {
                 readFromValue(obj);
@@ -14327,12 +23915,18 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct RemoveSharedGroupMembersRequest : public PlayFabBaseModel
         {
             AZStd::string SharedGroupId;
-            std::list<AZStd::string> PlayFabIds;
+            std::vector<AZStd::string> PlayFabIds;
 
             RemoveSharedGroupMembersRequest() :
                 PlayFabBaseModel(),
@@ -14346,6 +23940,15 @@ namespace PlayFabComboSdk
                 PlayFabIds(src.PlayFabIds)
             {}
 
+            RemoveSharedGroupMembersRequest(RemoveSharedGroupMembersRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId)),
+                PlayFabIds(AZStd::move(src.PlayFabIds))
+            {}
+
+            RemoveSharedGroupMembersRequest& operator=(const RemoveSharedGroupMembersRequest& src) = default;
+            RemoveSharedGroupMembersRequest& operator=(RemoveSharedGroupMembersRequest&& src) = default;
+
             RemoveSharedGroupMembersRequest(const rapidjson::Value& obj) : RemoveSharedGroupMembersRequest()
             {
                 readFromValue(obj);
@@ -14362,7 +23965,7 @@ namespace PlayFabComboSdk
                 writer.String(SharedGroupId.c_str());
                 writer.String("PlayFabIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = PlayFabIds.begin(); iter != PlayFabIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -14376,13 +23979,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator PlayFabIds_member = obj.FindMember("PlayFabIds");
                 if (PlayFabIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = PlayFabIds_member->value;
+                    PlayFabIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        PlayFabIds.push_back(memberList[i].GetString());
+                        PlayFabIds.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabIds"):
+                            if (strcmp(member, "PlayFabIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                PlayFabIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    PlayFabIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RemoveSharedGroupMembersResult : public PlayFabBaseModel
@@ -14396,6 +24035,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RemoveSharedGroupMembersResult(RemoveSharedGroupMembersResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RemoveSharedGroupMembersResult& operator=(const RemoveSharedGroupMembersResult& src) = default;
+            RemoveSharedGroupMembersResult& operator=(RemoveSharedGroupMembersResult&& src) = default;
+
             RemoveSharedGroupMembersResult(const rapidjson::Value& obj) : RemoveSharedGroupMembersResult()
             {
                 readFromValue(obj);
@@ -14416,6 +24062,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct ReportPlayerServerRequest : public PlayFabBaseModel
@@ -14438,6 +24090,16 @@ namespace PlayFabComboSdk
                 Comment(src.Comment)
             {}
 
+            ReportPlayerServerRequest(ReportPlayerServerRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                ReporterId(AZStd::move(src.ReporterId)),
+                ReporteeId(AZStd::move(src.ReporteeId)),
+                Comment(AZStd::move(src.Comment))
+            {}
+
+            ReportPlayerServerRequest& operator=(const ReportPlayerServerRequest& src) = default;
+            ReportPlayerServerRequest& operator=(ReportPlayerServerRequest&& src) = default;
+
             ReportPlayerServerRequest(const rapidjson::Value& obj) : ReportPlayerServerRequest()
             {
                 readFromValue(obj);
@@ -14472,6 +24134,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("ReporterId"):
+                            if (strcmp(member, "ReporterId") != 0)
+                                break;
+                            ReporterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ReporteeId"):
+                            if (strcmp(member, "ReporteeId") != 0)
+                                break;
+                            ReporteeId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Comment"):
+                            if (strcmp(member, "Comment") != 0)
+                                break;
+                            Comment = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct ReportPlayerServerResult : public PlayFabBaseModel
@@ -14491,6 +24186,15 @@ namespace PlayFabComboSdk
                 SubmissionsRemaining(src.SubmissionsRemaining)
             {}
 
+            ReportPlayerServerResult(ReportPlayerServerResult&& src) noexcept :
+                PlayFabBaseModel(),
+                Updated(AZStd::move(src.Updated)),
+                SubmissionsRemaining(AZStd::move(src.SubmissionsRemaining))
+            {}
+
+            ReportPlayerServerResult& operator=(const ReportPlayerServerResult& src) = default;
+            ReportPlayerServerResult& operator=(ReportPlayerServerResult&& src) = default;
+
             ReportPlayerServerResult(const rapidjson::Value& obj) : ReportPlayerServerResult()
             {
                 readFromValue(obj);
@@ -14521,6 +24225,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Updated"):
+                            if (strcmp(member, "Updated") != 0)
+                                break;
+                            Updated = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("SubmissionsRemaining"):
+                            if (strcmp(member, "SubmissionsRemaining") != 0)
+                                break;
+                            SubmissionsRemaining = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeAllBansForUserRequest : public PlayFabBaseModel
@@ -14537,6 +24269,14 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            RevokeAllBansForUserRequest(RevokeAllBansForUserRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            RevokeAllBansForUserRequest& operator=(const RevokeAllBansForUserRequest& src) = default;
+            RevokeAllBansForUserRequest& operator=(RevokeAllBansForUserRequest&& src) = default;
+
             RevokeAllBansForUserRequest(const rapidjson::Value& obj) : RevokeAllBansForUserRequest()
             {
                 readFromValue(obj);
@@ -14561,11 +24301,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeAllBansForUserResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             RevokeAllBansForUserResult() :
                 PlayFabBaseModel(),
@@ -14577,6 +24340,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            RevokeAllBansForUserResult(RevokeAllBansForUserResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            RevokeAllBansForUserResult& operator=(const RevokeAllBansForUserResult& src) = default;
+            RevokeAllBansForUserResult& operator=(RevokeAllBansForUserResult&& src) = default;
+
             RevokeAllBansForUserResult(const rapidjson::Value& obj) : RevokeAllBansForUserResult()
             {
                 readFromValue(obj);
@@ -14592,7 +24363,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14605,18 +24376,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeBansRequest : public PlayFabBaseModel
         {
-            std::list<AZStd::string> BanIds;
+            std::vector<AZStd::string> BanIds;
 
             RevokeBansRequest() :
                 PlayFabBaseModel(),
@@ -14628,6 +24431,14 @@ namespace PlayFabComboSdk
                 BanIds(src.BanIds)
             {}
 
+            RevokeBansRequest(RevokeBansRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BanIds(AZStd::move(src.BanIds))
+            {}
+
+            RevokeBansRequest& operator=(const RevokeBansRequest& src) = default;
+            RevokeBansRequest& operator=(RevokeBansRequest&& src) = default;
+
             RevokeBansRequest(const rapidjson::Value& obj) : RevokeBansRequest()
             {
                 readFromValue(obj);
@@ -14642,7 +24453,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("BanIds");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = BanIds.begin(); iter != BanIds.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = BanIds.begin(); iter != BanIds.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -14654,18 +24465,49 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanIds_member = obj.FindMember("BanIds");
                 if (BanIds_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanIds_member->value;
+                    BanIds.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanIds.push_back(memberList[i].GetString());
+                        BanIds.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanIds"):
+                            if (strcmp(member, "BanIds") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanIds.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanIds.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeBansResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             RevokeBansResult() :
                 PlayFabBaseModel(),
@@ -14677,6 +24519,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            RevokeBansResult(RevokeBansResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            RevokeBansResult& operator=(const RevokeBansResult& src) = default;
+            RevokeBansResult& operator=(RevokeBansResult&& src) = default;
+
             RevokeBansResult(const rapidjson::Value& obj) : RevokeBansResult()
             {
                 readFromValue(obj);
@@ -14692,7 +24542,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -14705,13 +24555,45 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeInventoryItemRequest : public PlayFabBaseModel
@@ -14734,6 +24616,16 @@ namespace PlayFabComboSdk
                 ItemInstanceId(src.ItemInstanceId)
             {}
 
+            RevokeInventoryItemRequest(RevokeInventoryItemRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId))
+            {}
+
+            RevokeInventoryItemRequest& operator=(const RevokeInventoryItemRequest& src) = default;
+            RevokeInventoryItemRequest& operator=(RevokeInventoryItemRequest&& src) = default;
+
             RevokeInventoryItemRequest(const rapidjson::Value& obj) : RevokeInventoryItemRequest()
             {
                 readFromValue(obj);
@@ -14768,6 +24660,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct RevokeInventoryResult : public PlayFabBaseModel
@@ -14781,6 +24706,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            RevokeInventoryResult(RevokeInventoryResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            RevokeInventoryResult& operator=(const RevokeInventoryResult& src) = default;
+            RevokeInventoryResult& operator=(RevokeInventoryResult&& src) = default;
+
             RevokeInventoryResult(const rapidjson::Value& obj) : RevokeInventoryResult()
             {
                 readFromValue(obj);
@@ -14801,6 +24733,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SendPushNotificationRequest : public PlayFabBaseModel
@@ -14826,6 +24764,37 @@ namespace PlayFabComboSdk
                 Subject(src.Subject)
             {}
 
+            SendPushNotificationRequest(SendPushNotificationRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Recipient(AZStd::move(src.Recipient)),
+                Message(AZStd::move(src.Message)),
+                Package(src.Package),
+                Subject(AZStd::move(src.Subject))
+            {
+                src.Package = nullptr;
+            }
+
+            SendPushNotificationRequest& operator=(const SendPushNotificationRequest& src)
+            {
+                if (this != &src)
+                    *this = SendPushNotificationRequest(src);
+                return *this;
+            }
+
+            SendPushNotificationRequest& operator=(SendPushNotificationRequest&& src)
+            {
+                if (this != &src)
+                {
+                    Recipient = AZStd::move(src.Recipient);
+                    Message = AZStd::move(src.Message);
+                    if (Package != nullptr) delete Package;
+                    Package = src.Package;
+                    src.Package = nullptr;
+                    Subject = AZStd::move(src.Subject);
+                }
+                return *this;
+            }
+
             SendPushNotificationRequest(const rapidjson::Value& obj) : SendPushNotificationRequest()
             {
                 readFromValue(obj);
@@ -14869,6 +24838,45 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Recipient"):
+                            if (strcmp(member, "Recipient") != 0)
+                                break;
+                            Recipient = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Message"):
+                            if (strcmp(member, "Message") != 0)
+                                break;
+                            Message = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Package"):
+                            if (strcmp(member, "Package") != 0)
+                                break;
+                            Package = new PushNotificationPackage;
+                            Package->readFromReader(reader);
+                            continue;
+                        case PlayFabJsonReader::Hash("Subject"):
+                            if (strcmp(member, "Subject") != 0)
+                                break;
+                            Subject = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SendPushNotificationResult : public PlayFabBaseModel
@@ -14882,6 +24890,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SendPushNotificationResult(SendPushNotificationResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SendPushNotificationResult& operator=(const SendPushNotificationResult& src) = default;
+            SendPushNotificationResult& operator=(SendPushNotificationResult&& src) = default;
+
             SendPushNotificationResult(const rapidjson::Value& obj) : SendPushNotificationResult()
             {
                 readFromValue(obj);
@@ -14902,13 +24917,19 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetFriendTagsRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string FriendPlayFabId;
-            std::list<AZStd::string> Tags;
+            std::vector<AZStd::string> Tags;
 
             SetFriendTagsRequest() :
                 PlayFabBaseModel(),
@@ -14924,6 +24945,16 @@ namespace PlayFabComboSdk
                 Tags(src.Tags)
             {}
 
+            SetFriendTagsRequest(SetFriendTagsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                FriendPlayFabId(AZStd::move(src.FriendPlayFabId)),
+                Tags(AZStd::move(src.Tags))
+            {}
+
+            SetFriendTagsRequest& operator=(const SetFriendTagsRequest& src) = default;
+            SetFriendTagsRequest& operator=(SetFriendTagsRequest&& src) = default;
+
             SetFriendTagsRequest(const rapidjson::Value& obj) : SetFriendTagsRequest()
             {
                 readFromValue(obj);
@@ -14942,7 +24973,7 @@ namespace PlayFabComboSdk
                 writer.String(FriendPlayFabId.c_str());
                 writer.String("Tags");
                 writer.StartArray();
-                for (std::list<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
+                for (std::vector<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); iter++) {
                     writer.String(iter->c_str());
                 }
                 writer.EndArray();
@@ -14958,13 +24989,54 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Tags_member = obj.FindMember("Tags");
                 if (Tags_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Tags_member->value;
+                    Tags.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Tags.push_back(memberList[i].GetString());
+                        Tags.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("FriendPlayFabId"):
+                            if (strcmp(member, "FriendPlayFabId") != 0)
+                                break;
+                            FriendPlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Tags.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Tags.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetGameServerInstanceDataRequest : public PlayFabBaseModel
@@ -14984,6 +25056,15 @@ namespace PlayFabComboSdk
                 GameServerData(src.GameServerData)
             {}
 
+            SetGameServerInstanceDataRequest(SetGameServerInstanceDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                GameServerData(AZStd::move(src.GameServerData))
+            {}
+
+            SetGameServerInstanceDataRequest& operator=(const SetGameServerInstanceDataRequest& src) = default;
+            SetGameServerInstanceDataRequest& operator=(SetGameServerInstanceDataRequest&& src) = default;
+
             SetGameServerInstanceDataRequest(const rapidjson::Value& obj) : SetGameServerInstanceDataRequest()
             {
                 readFromValue(obj);
@@ -15012,6 +25093,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GameServerData"):
+                            if (strcmp(member, "GameServerData") != 0)
+                                break;
+                            GameServerData = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetGameServerInstanceDataResult : public PlayFabBaseModel
@@ -15025,6 +25134,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetGameServerInstanceDataResult(SetGameServerInstanceDataResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetGameServerInstanceDataResult& operator=(const SetGameServerInstanceDataResult& src) = default;
+            SetGameServerInstanceDataResult& operator=(SetGameServerInstanceDataResult&& src) = default;
+
             SetGameServerInstanceDataResult(const rapidjson::Value& obj) : SetGameServerInstanceDataResult()
             {
                 readFromValue(obj);
@@ -15045,6 +25161,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetGameServerInstanceStateRequest : public PlayFabBaseModel
@@ -15064,6 +25186,15 @@ namespace PlayFabComboSdk
                 State(src.State)
             {}
 
+            SetGameServerInstanceStateRequest(SetGameServerInstanceStateRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                State(AZStd::move(src.State))
+            {}
+
+            SetGameServerInstanceStateRequest& operator=(const SetGameServerInstanceStateRequest& src) = default;
+            SetGameServerInstanceStateRequest& operator=(SetGameServerInstanceStateRequest&& src) = default;
+
             SetGameServerInstanceStateRequest(const rapidjson::Value& obj) : SetGameServerInstanceStateRequest()
             {
                 readFromValue(obj);
@@ -15092,6 +25223,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("State"):
+                            if (strcmp(member, "State") != 0)
+                                break;
+                            State = readGameInstanceStateFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetGameServerInstanceStateResult : public PlayFabBaseModel
@@ -15105,6 +25264,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetGameServerInstanceStateResult(SetGameServerInstanceStateResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetGameServerInstanceStateResult& operator=(const SetGameServerInstanceStateResult& src) = default;
+            SetGameServerInstanceStateResult& operator=(SetGameServerInstanceStateResult&& src) = default;
+
             SetGameServerInstanceStateResult(const rapidjson::Value& obj) : SetGameServerInstanceStateResult()
             {
                 readFromValue(obj);
@@ -15125,12 +25291,18 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetGameServerInstanceTagsRequest : public PlayFabBaseModel
         {
             AZStd::string LobbyId;
-            std::map<AZStd::string, AZStd::string> Tags;
+            PlayFabStringMap<AZStd::string> Tags;
 
             SetGameServerInstanceTagsRequest() :
                 PlayFabBaseModel(),
@@ -15144,6 +25316,15 @@ namespace PlayFabComboSdk
                 Tags(src.Tags)
             {}
 
+            SetGameServerInstanceTagsRequest(SetGameServerInstanceTagsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                LobbyId(AZStd::move(src.LobbyId)),
+                Tags(AZStd::move(src.Tags))
+            {}
+
+            SetGameServerInstanceTagsRequest& operator=(const SetGameServerInstanceTagsRequest& src) = default;
+            SetGameServerInstanceTagsRequest& operator=(SetGameServerInstanceTagsRequest&& src) = default;
+
             SetGameServerInstanceTagsRequest(const rapidjson::Value& obj) : SetGameServerInstanceTagsRequest()
             {
                 readFromValue(obj);
@@ -15160,7 +25341,7 @@ namespace PlayFabComboSdk
                 writer.String(LobbyId.c_str());
                 writer.String("Tags");
                 writer.StartObject();
-                for (std::map<AZStd::string, AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); ++iter) {
+                for (PlayFabStringMap<AZStd::string>::iterator iter = Tags.begin(); iter != Tags.end(); ++iter) {
                     writer.String(iter->first.c_str());
                     writer.String(iter->second.c_str());
                 }
@@ -15181,6 +25362,41 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("LobbyId"):
+                            if (strcmp(member, "LobbyId") != 0)
+                                break;
+                            LobbyId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Tags"):
+                            if (strcmp(member, "Tags") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Tags[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetGameServerInstanceTagsResult : public PlayFabBaseModel
@@ -15194,6 +25410,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetGameServerInstanceTagsResult(SetGameServerInstanceTagsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetGameServerInstanceTagsResult& operator=(const SetGameServerInstanceTagsResult& src) = default;
+            SetGameServerInstanceTagsResult& operator=(SetGameServerInstanceTagsResult&& src) = default;
+
             SetGameServerInstanceTagsResult(const rapidjson::Value& obj) : SetGameServerInstanceTagsResult()
             {
                 readFromValue(obj);
@@ -15214,6 +25437,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetPlayerSecretRequest : public PlayFabBaseModel
@@ -15233,6 +25462,15 @@ namespace PlayFabComboSdk
                 PlayFabId(src.PlayFabId)
             {}
 
+            SetPlayerSecretRequest(SetPlayerSecretRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayerSecret(AZStd::move(src.PlayerSecret)),
+                PlayFabId(AZStd::move(src.PlayFabId))
+            {}
+
+            SetPlayerSecretRequest& operator=(const SetPlayerSecretRequest& src) = default;
+            SetPlayerSecretRequest& operator=(SetPlayerSecretRequest&& src) = default;
+
             SetPlayerSecretRequest(const rapidjson::Value& obj) : SetPlayerSecretRequest()
             {
                 readFromValue(obj);
@@ -15261,6 +25499,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayerSecret"):
+                            if (strcmp(member, "PlayerSecret") != 0)
+                                break;
+                            PlayerSecret = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetPlayerSecretResult : public PlayFabBaseModel
@@ -15274,6 +25540,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetPlayerSecretResult(SetPlayerSecretResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetPlayerSecretResult& operator=(const SetPlayerSecretResult& src) = default;
+            SetPlayerSecretResult& operator=(SetPlayerSecretResult&& src) = default;
+
             SetPlayerSecretResult(const rapidjson::Value& obj) : SetPlayerSecretResult()
             {
                 readFromValue(obj);
@@ -15294,6 +25567,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetPublisherDataRequest : public PlayFabBaseModel
@@ -15313,6 +25592,15 @@ namespace PlayFabComboSdk
                 Value(src.Value)
             {}
 
+            SetPublisherDataRequest(SetPublisherDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                Value(AZStd::move(src.Value))
+            {}
+
+            SetPublisherDataRequest& operator=(const SetPublisherDataRequest& src) = default;
+            SetPublisherDataRequest& operator=(SetPublisherDataRequest&& src) = default;
+
             SetPublisherDataRequest(const rapidjson::Value& obj) : SetPublisherDataRequest()
             {
                 readFromValue(obj);
@@ -15343,6 +25631,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetPublisherDataResult : public PlayFabBaseModel
@@ -15356,6 +25672,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetPublisherDataResult(SetPublisherDataResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetPublisherDataResult& operator=(const SetPublisherDataResult& src) = default;
+            SetPublisherDataResult& operator=(SetPublisherDataResult&& src) = default;
+
             SetPublisherDataResult(const rapidjson::Value& obj) : SetPublisherDataResult()
             {
                 readFromValue(obj);
@@ -15376,6 +25699,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct SetTitleDataRequest : public PlayFabBaseModel
@@ -15395,6 +25724,15 @@ namespace PlayFabComboSdk
                 Value(src.Value)
             {}
 
+            SetTitleDataRequest(SetTitleDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Key(AZStd::move(src.Key)),
+                Value(AZStd::move(src.Value))
+            {}
+
+            SetTitleDataRequest& operator=(const SetTitleDataRequest& src) = default;
+            SetTitleDataRequest& operator=(SetTitleDataRequest&& src) = default;
+
             SetTitleDataRequest(const rapidjson::Value& obj) : SetTitleDataRequest()
             {
                 readFromValue(obj);
@@ -15425,6 +25763,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Key"):
+                            if (strcmp(member, "Key") != 0)
+                                break;
+                            Key = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SetTitleDataResult : public PlayFabBaseModel
@@ -15438,6 +25804,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            SetTitleDataResult(SetTitleDataResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            SetTitleDataResult& operator=(const SetTitleDataResult& src) = default;
+            SetTitleDataResult& operator=(SetTitleDataResult&& src) = default;
+
             SetTitleDataResult(const rapidjson::Value& obj) : SetTitleDataResult()
             {
                 readFromValue(obj);
@@ -15458,6 +25831,12 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct StatisticUpdate : public PlayFabBaseModel
@@ -15480,6 +25859,16 @@ namespace PlayFabComboSdk
                 Value(src.Value)
             {}
 
+            StatisticUpdate(StatisticUpdate&& src) noexcept :
+                PlayFabBaseModel(),
+                StatisticName(AZStd::move(src.StatisticName)),
+                Version(AZStd::move(src.Version)),
+                Value(AZStd::move(src.Value))
+            {}
+
+            StatisticUpdate& operator=(const StatisticUpdate& src) = default;
+            StatisticUpdate& operator=(StatisticUpdate&& src) = default;
+
             StatisticUpdate(const rapidjson::Value& obj) : StatisticUpdate()
             {
                 readFromValue(obj);
@@ -15514,6 +25903,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("StatisticName"):
+                            if (strcmp(member, "StatisticName") != 0)
+                                break;
+                            StatisticName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Version"):
+                            if (strcmp(member, "Version") != 0)
+                                break;
+                            Version = reader.GetValue().GetUint();
+                            continue;
+                        case PlayFabJsonReader::Hash("Value"):
+                            if (strcmp(member, "Value") != 0)
+                                break;
+                            Value = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SubtractCharacterVirtualCurrencyRequest : public PlayFabBaseModel
@@ -15539,6 +25961,17 @@ namespace PlayFabComboSdk
                 Amount(src.Amount)
             {}
 
+            SubtractCharacterVirtualCurrencyRequest(SubtractCharacterVirtualCurrencyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Amount(AZStd::move(src.Amount))
+            {}
+
+            SubtractCharacterVirtualCurrencyRequest& operator=(const SubtractCharacterVirtualCurrencyRequest& src) = default;
+            SubtractCharacterVirtualCurrencyRequest& operator=(SubtractCharacterVirtualCurrencyRequest&& src) = default;
+
             SubtractCharacterVirtualCurrencyRequest(const rapidjson::Value& obj) : SubtractCharacterVirtualCurrencyRequest()
             {
                 readFromValue(obj);
@@ -15575,6 +26008,44 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Amount"):
+                            if (strcmp(member, "Amount") != 0)
+                                break;
+                            Amount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct SubtractUserVirtualCurrencyRequest : public PlayFabBaseModel
@@ -15597,6 +26068,16 @@ namespace PlayFabComboSdk
                 Amount(src.Amount)
             {}
 
+            SubtractUserVirtualCurrencyRequest(SubtractUserVirtualCurrencyRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency)),
+                Amount(AZStd::move(src.Amount))
+            {}
+
+            SubtractUserVirtualCurrencyRequest& operator=(const SubtractUserVirtualCurrencyRequest& src) = default;
+            SubtractUserVirtualCurrencyRequest& operator=(SubtractUserVirtualCurrencyRequest&& src) = default;
+
             SubtractUserVirtualCurrencyRequest(const rapidjson::Value& obj) : SubtractUserVirtualCurrencyRequest()
             {
                 readFromValue(obj);
@@ -15629,6 +26110,39 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            VirtualCurrency = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Amount"):
+                            if (strcmp(member, "Amount") != 0)
+                                break;
+                            Amount = reader.GetValue().GetInt();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UnlockContainerInstanceRequest : public PlayFabBaseModel
@@ -15657,6 +26171,18 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            UnlockContainerInstanceRequest(UnlockContainerInstanceRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ContainerItemInstanceId(AZStd::move(src.ContainerItemInstanceId)),
+                KeyItemInstanceId(AZStd::move(src.KeyItemInstanceId)),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            UnlockContainerInstanceRequest& operator=(const UnlockContainerInstanceRequest& src) = default;
+            UnlockContainerInstanceRequest& operator=(UnlockContainerInstanceRequest&& src) = default;
+
             UnlockContainerInstanceRequest(const rapidjson::Value& obj) : UnlockContainerInstanceRequest()
             {
                 readFromValue(obj);
@@ -15703,6 +26229,49 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContainerItemInstanceId"):
+                            if (strcmp(member, "ContainerItemInstanceId") != 0)
+                                break;
+                            ContainerItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("KeyItemInstanceId"):
+                            if (strcmp(member, "KeyItemInstanceId") != 0)
+                                break;
+                            KeyItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UnlockContainerItemRequest : public PlayFabBaseModel
@@ -15728,6 +26297,17 @@ namespace PlayFabComboSdk
                 CatalogVersion(src.CatalogVersion)
             {}
 
+            UnlockContainerItemRequest(UnlockContainerItemRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ContainerItemId(AZStd::move(src.ContainerItemId)),
+                CatalogVersion(AZStd::move(src.CatalogVersion))
+            {}
+
+            UnlockContainerItemRequest& operator=(const UnlockContainerItemRequest& src) = default;
+            UnlockContainerItemRequest& operator=(UnlockContainerItemRequest&& src) = default;
+
             UnlockContainerItemRequest(const rapidjson::Value& obj) : UnlockContainerItemRequest()
             {
                 readFromValue(obj);
@@ -15768,14 +26348,52 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ContainerItemId"):
+                            if (strcmp(member, "ContainerItemId") != 0)
+                                break;
+                            ContainerItemId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CatalogVersion"):
+                            if (strcmp(member, "CatalogVersion") != 0)
+                                break;
+                            CatalogVersion = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UnlockContainerItemResult : public PlayFabBaseModel
         {
             AZStd::string UnlockedItemInstanceId;
             AZStd::string UnlockedWithItemInstanceId;
-            std::list<ItemInstance> GrantedItems;
-            std::map<AZStd::string, Uint32> VirtualCurrency;
+            std::vector<ItemInstance> GrantedItems;
+            PlayFabStringMap<Uint32> VirtualCurrency;
 
             UnlockContainerItemResult() :
                 PlayFabBaseModel(),
@@ -15793,6 +26411,17 @@ namespace PlayFabComboSdk
                 VirtualCurrency(src.VirtualCurrency)
             {}
 
+            UnlockContainerItemResult(UnlockContainerItemResult&& src) noexcept :
+                PlayFabBaseModel(),
+                UnlockedItemInstanceId(AZStd::move(src.UnlockedItemInstanceId)),
+                UnlockedWithItemInstanceId(AZStd::move(src.UnlockedWithItemInstanceId)),
+                GrantedItems(AZStd::move(src.GrantedItems)),
+                VirtualCurrency(AZStd::move(src.VirtualCurrency))
+            {}
+
+            UnlockContainerItemResult& operator=(const UnlockContainerItemResult& src) = default;
+            UnlockContainerItemResult& operator=(UnlockContainerItemResult&& src) = default;
+
             UnlockContainerItemResult(const rapidjson::Value& obj) : UnlockContainerItemResult()
             {
                 readFromValue(obj);
@@ -15816,7 +26445,7 @@ namespace PlayFabComboSdk
                 if (!GrantedItems.empty()) {
                     writer.String("GrantedItems");
                     writer.StartArray();
-                    for (std::list<ItemInstance>::iterator iter = GrantedItems.begin(); iter != GrantedItems.end(); iter++) {
+                    for (std::vector<ItemInstance>::iterator iter = GrantedItems.begin(); iter != GrantedItems.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -15824,7 +26453,7 @@ namespace PlayFabComboSdk
                 if (!VirtualCurrency.empty()) {
                     writer.String("VirtualCurrency");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Uint32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
+                    for (PlayFabStringMap<Uint32>::iterator iter = VirtualCurrency.begin(); iter != VirtualCurrency.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Uint(iter->second);
                     }
@@ -15842,8 +26471,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator GrantedItems_member = obj.FindMember("GrantedItems");
                 if (GrantedItems_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = GrantedItems_member->value;
+                    GrantedItems.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        GrantedItems.push_back(ItemInstance(memberList[i]));
+                        GrantedItems.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator VirtualCurrency_member = obj.FindMember("VirtualCurrency");
@@ -15855,6 +26485,59 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("UnlockedItemInstanceId"):
+                            if (strcmp(member, "UnlockedItemInstanceId") != 0)
+                                break;
+                            UnlockedItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("UnlockedWithItemInstanceId"):
+                            if (strcmp(member, "UnlockedWithItemInstanceId") != 0)
+                                break;
+                            UnlockedWithItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("GrantedItems"):
+                            if (strcmp(member, "GrantedItems") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                GrantedItems.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    GrantedItems.emplace_back();
+                                    GrantedItems.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("VirtualCurrency"):
+                            if (strcmp(member, "VirtualCurrency") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    VirtualCurrency[key] = reader.GetValue().GetUint();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateAvatarUrlRequest : public PlayFabBaseModel
@@ -15874,6 +26557,15 @@ namespace PlayFabComboSdk
                 ImageUrl(src.ImageUrl)
             {}
 
+            UpdateAvatarUrlRequest(UpdateAvatarUrlRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                ImageUrl(AZStd::move(src.ImageUrl))
+            {}
+
+            UpdateAvatarUrlRequest& operator=(const UpdateAvatarUrlRequest& src) = default;
+            UpdateAvatarUrlRequest& operator=(UpdateAvatarUrlRequest&& src) = default;
+
             UpdateAvatarUrlRequest(const rapidjson::Value& obj) : UpdateAvatarUrlRequest()
             {
                 readFromValue(obj);
@@ -15902,6 +26594,34 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ImageUrl"):
+                            if (strcmp(member, "ImageUrl") != 0)
+                                break;
+                            ImageUrl = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateBanRequest : public PlayFabBaseModel
@@ -15936,6 +26656,20 @@ namespace PlayFabComboSdk
                 Active(src.Active)
             {}
 
+            UpdateBanRequest(UpdateBanRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                BanId(AZStd::move(src.BanId)),
+                Reason(AZStd::move(src.Reason)),
+                Expires(AZStd::move(src.Expires)),
+                IPAddress(AZStd::move(src.IPAddress)),
+                MACAddress(AZStd::move(src.MACAddress)),
+                Permanent(AZStd::move(src.Permanent)),
+                Active(AZStd::move(src.Active))
+            {}
+
+            UpdateBanRequest& operator=(const UpdateBanRequest& src) = default;
+            UpdateBanRequest& operator=(UpdateBanRequest&& src) = default;
+
             UpdateBanRequest(const rapidjson::Value& obj) : UpdateBanRequest()
             {
                 readFromValue(obj);
@@ -15996,11 +26730,64 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanId"):
+                            if (strcmp(member, "BanId") != 0)
+                                break;
+                            BanId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Reason"):
+                            if (strcmp(member, "Reason") != 0)
+                                break;
+                            Reason = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Expires"):
+                            if (strcmp(member, "Expires") != 0)
+                                break;
+                            Expires = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("IPAddress"):
+                            if (strcmp(member, "IPAddress") != 0)
+                                break;
+                            IPAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("MACAddress"):
+                            if (strcmp(member, "MACAddress") != 0)
+                                break;
+                            MACAddress = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Permanent"):
+                            if (strcmp(member, "Permanent") != 0)
+                                break;
+                            Permanent = reader.GetValue().GetBool();
+                            continue;
+                        case PlayFabJsonReader::Hash("Active"):
+                            if (strcmp(member, "Active") != 0)
+                                break;
+                            Active = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateBansRequest : public PlayFabBaseModel
         {
-            std::list<UpdateBanRequest> Bans;
+            std::vector<UpdateBanRequest> Bans;
 
             UpdateBansRequest() :
                 PlayFabBaseModel(),
@@ -16012,6 +26799,14 @@ namespace PlayFabComboSdk
                 Bans(src.Bans)
             {}
 
+            UpdateBansRequest(UpdateBansRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                Bans(AZStd::move(src.Bans))
+            {}
+
+            UpdateBansRequest& operator=(const UpdateBansRequest& src) = default;
+            UpdateBansRequest& operator=(UpdateBansRequest&& src) = default;
+
             UpdateBansRequest(const rapidjson::Value& obj) : UpdateBansRequest()
             {
                 readFromValue(obj);
@@ -16026,7 +26821,7 @@ namespace PlayFabComboSdk
                 writer.StartObject();
                 writer.String("Bans");
                 writer.StartArray();
-                for (std::list<UpdateBanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
+                for (std::vector<UpdateBanRequest>::iterator iter = Bans.begin(); iter != Bans.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -16038,18 +26833,50 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Bans_member = obj.FindMember("Bans");
                 if (Bans_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Bans_member->value;
+                    Bans.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Bans.push_back(UpdateBanRequest(memberList[i]));
+                        Bans.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("Bans"):
+                            if (strcmp(member, "Bans") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Bans.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Bans.emplace_back();
+                                    Bans.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateBansResult : public PlayFabBaseModel
         {
-            std::list<BanInfo> BanData;
+            std::vector<BanInfo> BanData;
 
             UpdateBansResult() :
                 PlayFabBaseModel(),
@@ -16061,6 +26888,14 @@ namespace PlayFabComboSdk
                 BanData(src.BanData)
             {}
 
+            UpdateBansResult(UpdateBansResult&& src) noexcept :
+                PlayFabBaseModel(),
+                BanData(AZStd::move(src.BanData))
+            {}
+
+            UpdateBansResult& operator=(const UpdateBansResult& src) = default;
+            UpdateBansResult& operator=(UpdateBansResult&& src) = default;
+
             UpdateBansResult(const rapidjson::Value& obj) : UpdateBansResult()
             {
                 readFromValue(obj);
@@ -16076,7 +26911,7 @@ namespace PlayFabComboSdk
                 if (!BanData.empty()) {
                     writer.String("BanData");
                     writer.StartArray();
-                    for (std::list<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
+                    for (std::vector<BanInfo>::iterator iter = BanData.begin(); iter != BanData.end(); iter++) {
                         iter->writeJSON(writer);
                     }
                     writer.EndArray();
@@ -16089,21 +26924,53 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator BanData_member = obj.FindMember("BanData");
                 if (BanData_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = BanData_member->value;
+                    BanData.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        BanData.push_back(BanInfo(memberList[i]));
+                        BanData.emplace_back(memberList[i]);
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("BanData"):
+                            if (strcmp(member, "BanData") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                BanData.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    BanData.emplace_back();
+                                    BanData.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCharacterDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string CharacterId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
             Boxed<UserDataPermission> Permission;
 
             UpdateCharacterDataRequest() :
@@ -16124,6 +26991,18 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            UpdateCharacterDataRequest(UpdateCharacterDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            UpdateCharacterDataRequest& operator=(const UpdateCharacterDataRequest& src) = default;
+            UpdateCharacterDataRequest& operator=(UpdateCharacterDataRequest&& src) = default;
+
             UpdateCharacterDataRequest(const rapidjson::Value& obj) : UpdateCharacterDataRequest()
             {
                 readFromValue(obj);
@@ -16143,7 +27022,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -16152,7 +27031,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -16179,8 +27058,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator Permission_member = obj.FindMember("Permission");
@@ -16188,6 +27068,63 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCharacterDataResult : public PlayFabBaseModel
@@ -16204,6 +27141,14 @@ namespace PlayFabComboSdk
                 DataVersion(src.DataVersion)
             {}
 
+            UpdateCharacterDataResult(UpdateCharacterDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                DataVersion(AZStd::move(src.DataVersion))
+            {}
+
+            UpdateCharacterDataResult& operator=(const UpdateCharacterDataResult& src) = default;
+            UpdateCharacterDataResult& operator=(UpdateCharacterDataResult&& src) = default;
+
             UpdateCharacterDataResult(const rapidjson::Value& obj) : UpdateCharacterDataResult()
             {
                 readFromValue(obj);
@@ -16228,13 +27173,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DataVersion"):
+                            if (strcmp(member, "DataVersion") != 0)
+                                break;
+                            DataVersion = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCharacterStatisticsRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
             AZStd::string CharacterId;
-            std::map<AZStd::string, Int32> CharacterStatistics;
+            PlayFabStringMap<Int32> CharacterStatistics;
 
             UpdateCharacterStatisticsRequest() :
                 PlayFabBaseModel(),
@@ -16250,6 +27218,16 @@ namespace PlayFabComboSdk
                 CharacterStatistics(src.CharacterStatistics)
             {}
 
+            UpdateCharacterStatisticsRequest(UpdateCharacterStatisticsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                CharacterStatistics(AZStd::move(src.CharacterStatistics))
+            {}
+
+            UpdateCharacterStatisticsRequest& operator=(const UpdateCharacterStatisticsRequest& src) = default;
+            UpdateCharacterStatisticsRequest& operator=(UpdateCharacterStatisticsRequest&& src) = default;
+
             UpdateCharacterStatisticsRequest(const rapidjson::Value& obj) : UpdateCharacterStatisticsRequest()
             {
                 readFromValue(obj);
@@ -16269,7 +27247,7 @@ namespace PlayFabComboSdk
                 if (!CharacterStatistics.empty()) {
                     writer.String("CharacterStatistics");
                     writer.StartObject();
-                    for (std::map<AZStd::string, Int32>::iterator iter = CharacterStatistics.begin(); iter != CharacterStatistics.end(); ++iter) {
+                    for (PlayFabStringMap<Int32>::iterator iter = CharacterStatistics.begin(); iter != CharacterStatistics.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.Int(iter->second);
                     }
@@ -16293,6 +27271,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterStatistics"):
+                            if (strcmp(member, "CharacterStatistics") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    CharacterStatistics[key] = reader.GetValue().GetInt();
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateCharacterStatisticsResult : public PlayFabBaseModel
@@ -16306,6 +27324,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdateCharacterStatisticsResult(UpdateCharacterStatisticsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdateCharacterStatisticsResult& operator=(const UpdateCharacterStatisticsResult& src) = default;
+            UpdateCharacterStatisticsResult& operator=(UpdateCharacterStatisticsResult&& src) = default;
+
             UpdateCharacterStatisticsResult(const rapidjson::Value& obj) : UpdateCharacterStatisticsResult()
             {
                 readFromValue(obj);
@@ -16326,12 +27351,18 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdatePlayerStatisticsRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::list<StatisticUpdate> Statistics;
+            std::vector<StatisticUpdate> Statistics;
             OptionalBool ForceUpdate;
 
             UpdatePlayerStatisticsRequest() :
@@ -16348,6 +27379,16 @@ namespace PlayFabComboSdk
                 ForceUpdate(src.ForceUpdate)
             {}
 
+            UpdatePlayerStatisticsRequest(UpdatePlayerStatisticsRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Statistics(AZStd::move(src.Statistics)),
+                ForceUpdate(AZStd::move(src.ForceUpdate))
+            {}
+
+            UpdatePlayerStatisticsRequest& operator=(const UpdatePlayerStatisticsRequest& src) = default;
+            UpdatePlayerStatisticsRequest& operator=(UpdatePlayerStatisticsRequest&& src) = default;
+
             UpdatePlayerStatisticsRequest(const rapidjson::Value& obj) : UpdatePlayerStatisticsRequest()
             {
                 readFromValue(obj);
@@ -16364,7 +27405,7 @@ namespace PlayFabComboSdk
                 writer.String(PlayFabId.c_str());
                 writer.String("Statistics");
                 writer.StartArray();
-                for (std::list<StatisticUpdate>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
+                for (std::vector<StatisticUpdate>::iterator iter = Statistics.begin(); iter != Statistics.end(); iter++) {
                     iter->writeJSON(writer);
                 }
                 writer.EndArray();
@@ -16382,8 +27423,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator Statistics_member = obj.FindMember("Statistics");
                 if (Statistics_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = Statistics_member->value;
+                    Statistics.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        Statistics.push_back(StatisticUpdate(memberList[i]));
+                        Statistics.emplace_back(memberList[i]);
                     }
                 }
                 const Value::ConstMemberIterator ForceUpdate_member = obj.FindMember("ForceUpdate");
@@ -16391,6 +27433,47 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Statistics"):
+                            if (strcmp(member, "Statistics") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                Statistics.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    Statistics.emplace_back();
+                                    Statistics.back().readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("ForceUpdate"):
+                            if (strcmp(member, "ForceUpdate") != 0)
+                                break;
+                            ForceUpdate = reader.GetValue().GetBool();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdatePlayerStatisticsResult : public PlayFabBaseModel
@@ -16404,6 +27487,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdatePlayerStatisticsResult(UpdatePlayerStatisticsResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdatePlayerStatisticsResult& operator=(const UpdatePlayerStatisticsResult& src) = default;
+            UpdatePlayerStatisticsResult& operator=(UpdatePlayerStatisticsResult&& src) = default;
+
             UpdatePlayerStatisticsResult(const rapidjson::Value& obj) : UpdatePlayerStatisticsResult()
             {
                 readFromValue(obj);
@@ -16424,13 +27514,19 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdateSharedGroupDataRequest : public PlayFabBaseModel
         {
             AZStd::string SharedGroupId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
             Boxed<UserDataPermission> Permission;
 
             UpdateSharedGroupDataRequest() :
@@ -16449,6 +27545,17 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            UpdateSharedGroupDataRequest(UpdateSharedGroupDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                SharedGroupId(AZStd::move(src.SharedGroupId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            UpdateSharedGroupDataRequest& operator=(const UpdateSharedGroupDataRequest& src) = default;
+            UpdateSharedGroupDataRequest& operator=(UpdateSharedGroupDataRequest&& src) = default;
+
             UpdateSharedGroupDataRequest(const rapidjson::Value& obj) : UpdateSharedGroupDataRequest()
             {
                 readFromValue(obj);
@@ -16466,7 +27573,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -16475,7 +27582,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -16500,8 +27607,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator Permission_member = obj.FindMember("Permission");
@@ -16509,6 +27617,58 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("SharedGroupId"):
+                            if (strcmp(member, "SharedGroupId") != 0)
+                                break;
+                            SharedGroupId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateSharedGroupDataResult : public PlayFabBaseModel
@@ -16522,6 +27682,13 @@ namespace PlayFabComboSdk
                 PlayFabBaseModel()
             {}
 
+            UpdateSharedGroupDataResult(UpdateSharedGroupDataResult&& src) noexcept :
+                PlayFabBaseModel()
+            {}
+
+            UpdateSharedGroupDataResult& operator=(const UpdateSharedGroupDataResult& src) = default;
+            UpdateSharedGroupDataResult& operator=(UpdateSharedGroupDataResult&& src) = default;
+
             UpdateSharedGroupDataResult(const rapidjson::Value& obj) : UpdateSharedGroupDataResult()
             {
                 readFromValue(obj);
@@ -16542,13 +27709,19 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                reader.Skip();
+                return true;
+            }
         };
 
         struct UpdateUserDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
             Boxed<UserDataPermission> Permission;
 
             UpdateUserDataRequest() :
@@ -16567,6 +27740,17 @@ namespace PlayFabComboSdk
                 Permission(src.Permission)
             {}
 
+            UpdateUserDataRequest(UpdateUserDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove)),
+                Permission(AZStd::move(src.Permission))
+            {}
+
+            UpdateUserDataRequest& operator=(const UpdateUserDataRequest& src) = default;
+            UpdateUserDataRequest& operator=(UpdateUserDataRequest&& src) = default;
+
             UpdateUserDataRequest(const rapidjson::Value& obj) : UpdateUserDataRequest()
             {
                 readFromValue(obj);
@@ -16584,7 +27768,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -16593,7 +27777,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -16618,8 +27802,9 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
                 const Value::ConstMemberIterator Permission_member = obj.FindMember("Permission");
@@ -16627,6 +27812,58 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("Permission"):
+                            if (strcmp(member, "Permission") != 0)
+                                break;
+                            Permission = readUserDataPermissionFromValue(reader.GetValue());
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserDataResult : public PlayFabBaseModel
@@ -16643,6 +27880,14 @@ namespace PlayFabComboSdk
                 DataVersion(src.DataVersion)
             {}
 
+            UpdateUserDataResult(UpdateUserDataResult&& src) noexcept :
+                PlayFabBaseModel(),
+                DataVersion(AZStd::move(src.DataVersion))
+            {}
+
+            UpdateUserDataResult& operator=(const UpdateUserDataResult& src) = default;
+            UpdateUserDataResult& operator=(UpdateUserDataResult&& src) = default;
+
             UpdateUserDataResult(const rapidjson::Value& obj) : UpdateUserDataResult()
             {
                 readFromValue(obj);
@@ -16667,13 +27912,36 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("DataVersion"):
+                            if (strcmp(member, "DataVersion") != 0)
+                                break;
+                            DataVersion = reader.GetValue().GetUint();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserInternalDataRequest : public PlayFabBaseModel
         {
             AZStd::string PlayFabId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
 
             UpdateUserInternalDataRequest() :
                 PlayFabBaseModel(),
@@ -16689,6 +27957,16 @@ namespace PlayFabComboSdk
                 KeysToRemove(src.KeysToRemove)
             {}
 
+            UpdateUserInternalDataRequest(UpdateUserInternalDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove))
+            {}
+
+            UpdateUserInternalDataRequest& operator=(const UpdateUserInternalDataRequest& src) = default;
+            UpdateUserInternalDataRequest& operator=(UpdateUserInternalDataRequest&& src) = default;
+
             UpdateUserInternalDataRequest(const rapidjson::Value& obj) : UpdateUserInternalDataRequest()
             {
                 readFromValue(obj);
@@ -16706,7 +27984,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -16715,7 +27993,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -16736,13 +28014,61 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct UpdateUserInventoryItemDataRequest : public PlayFabBaseModel
@@ -16750,8 +28076,8 @@ namespace PlayFabComboSdk
             AZStd::string PlayFabId;
             AZStd::string CharacterId;
             AZStd::string ItemInstanceId;
-            std::map<AZStd::string, AZStd::string> Data;
-            std::list<AZStd::string> KeysToRemove;
+            PlayFabStringMap<AZStd::string> Data;
+            std::vector<AZStd::string> KeysToRemove;
 
             UpdateUserInventoryItemDataRequest() :
                 PlayFabBaseModel(),
@@ -16771,6 +28097,18 @@ namespace PlayFabComboSdk
                 KeysToRemove(src.KeysToRemove)
             {}
 
+            UpdateUserInventoryItemDataRequest(UpdateUserInventoryItemDataRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                ItemInstanceId(AZStd::move(src.ItemInstanceId)),
+                Data(AZStd::move(src.Data)),
+                KeysToRemove(AZStd::move(src.KeysToRemove))
+            {}
+
+            UpdateUserInventoryItemDataRequest& operator=(const UpdateUserInventoryItemDataRequest& src) = default;
+            UpdateUserInventoryItemDataRequest& operator=(UpdateUserInventoryItemDataRequest&& src) = default;
+
             UpdateUserInventoryItemDataRequest(const rapidjson::Value& obj) : UpdateUserInventoryItemDataRequest()
             {
                 readFromValue(obj);
@@ -16794,7 +28132,7 @@ namespace PlayFabComboSdk
                 if (!Data.empty()) {
                     writer.String("Data");
                     writer.StartObject();
-                    for (std::map<AZStd::string, AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
+                    for (PlayFabStringMap<AZStd::string>::iterator iter = Data.begin(); iter != Data.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         writer.String(iter->second.c_str());
                     }
@@ -16803,7 +28141,7 @@ namespace PlayFabComboSdk
                 if (!KeysToRemove.empty()) {
                     writer.String("KeysToRemove");
                     writer.StartArray();
-                    for (std::list<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
+                    for (std::vector<AZStd::string>::iterator iter = KeysToRemove.begin(); iter != KeysToRemove.end(); iter++) {
                         writer.String(iter->c_str());
                     }
                     writer.EndArray();
@@ -16828,13 +28166,71 @@ namespace PlayFabComboSdk
                 const Value::ConstMemberIterator KeysToRemove_member = obj.FindMember("KeysToRemove");
                 if (KeysToRemove_member != obj.MemberEnd()) {
                     const rapidjson::Value& memberList = KeysToRemove_member->value;
+                    KeysToRemove.reserve(memberList.Size());
                     for (SizeType i = 0; i < memberList.Size(); i++) {
-                        KeysToRemove.push_back(memberList[i].GetString());
+                        KeysToRemove.emplace_back(memberList[i].GetString());
                     }
                 }
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("ItemInstanceId"):
+                            if (strcmp(member, "ItemInstanceId") != 0)
+                                break;
+                            ItemInstanceId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Data"):
+                            if (strcmp(member, "Data") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Data[key] = reader.GetValue().GetString();
+                                }
+                            }
+                            continue;
+                        case PlayFabJsonReader::Hash("KeysToRemove"):
+                            if (strcmp(member, "KeysToRemove") != 0)
+                                break;
+                            if (reader.StartArray())
+                            {
+                                KeysToRemove.reserve(reader.GetArraySize());
+                                while (reader.NextElement())
+                                {
+                                    KeysToRemove.push_back(reader.GetValue().GetString());
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct WriteEventResponse : public PlayFabBaseModel
@@ -16851,6 +28247,14 @@ namespace PlayFabComboSdk
                 EventId(src.EventId)
             {}
 
+            WriteEventResponse(WriteEventResponse&& src) noexcept :
+                PlayFabBaseModel(),
+                EventId(AZStd::move(src.EventId))
+            {}
+
+            WriteEventResponse& operator=(const WriteEventResponse& src) = default;
+            WriteEventResponse& operator=(WriteEventResponse&& src) = default;
+
             WriteEventResponse(const rapidjson::Value& obj) : WriteEventResponse()
             {
                 readFromValue(obj);
@@ -16877,6 +28281,29 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("EventId"):
+                            if (strcmp(member, "EventId") != 0)
+                                break;
+                            EventId = reader.GetValue().GetString();
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct WriteServerCharacterEventRequest : public PlayFabBaseModel
@@ -16885,7 +28312,7 @@ namespace PlayFabComboSdk
             AZStd::string CharacterId;
             AZStd::string EventName;
             OptionalTime Timestamp;
-            std::map<AZStd::string, MultitypeVar> Body;
+            PlayFabStringMap<MultitypeVar> Body;
 
             WriteServerCharacterEventRequest() :
                 PlayFabBaseModel(),
@@ -16905,6 +28332,18 @@ namespace PlayFabComboSdk
                 Body(src.Body)
             {}
 
+            WriteServerCharacterEventRequest(WriteServerCharacterEventRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                CharacterId(AZStd::move(src.CharacterId)),
+                EventName(AZStd::move(src.EventName)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                Body(AZStd::move(src.Body))
+            {}
+
+            WriteServerCharacterEventRequest& operator=(const WriteServerCharacterEventRequest& src) = default;
+            WriteServerCharacterEventRequest& operator=(WriteServerCharacterEventRequest&& src) = default;
+
             WriteServerCharacterEventRequest(const rapidjson::Value& obj) : WriteServerCharacterEventRequest()
             {
                 readFromValue(obj);
@@ -16930,7 +28369,7 @@ namespace PlayFabComboSdk
                 if (!Body.empty()) {
                     writer.String("Body");
                     writer.StartObject();
-                    for (std::map<AZStd::string, MultitypeVar>::iterator iter = Body.begin(); iter != Body.end(); ++iter) {
+                    for (PlayFabStringMap<MultitypeVar>::iterator iter = Body.begin(); iter != Body.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -16958,6 +28397,56 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("CharacterId"):
+                            if (strcmp(member, "CharacterId") != 0)
+                                break;
+                            CharacterId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("EventName"):
+                            if (strcmp(member, "EventName") != 0)
+                                break;
+                            EventName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Body"):
+                            if (strcmp(member, "Body") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Body[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct WriteServerPlayerEventRequest : public PlayFabBaseModel
@@ -16965,7 +28454,7 @@ namespace PlayFabComboSdk
             AZStd::string PlayFabId;
             AZStd::string EventName;
             OptionalTime Timestamp;
-            std::map<AZStd::string, MultitypeVar> Body;
+            PlayFabStringMap<MultitypeVar> Body;
 
             WriteServerPlayerEventRequest() :
                 PlayFabBaseModel(),
@@ -16983,6 +28472,17 @@ namespace PlayFabComboSdk
                 Body(src.Body)
             {}
 
+            WriteServerPlayerEventRequest(WriteServerPlayerEventRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                PlayFabId(AZStd::move(src.PlayFabId)),
+                EventName(AZStd::move(src.EventName)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                Body(AZStd::move(src.Body))
+            {}
+
+            WriteServerPlayerEventRequest& operator=(const WriteServerPlayerEventRequest& src) = default;
+            WriteServerPlayerEventRequest& operator=(WriteServerPlayerEventRequest&& src) = default;
+
             WriteServerPlayerEventRequest(const rapidjson::Value& obj) : WriteServerPlayerEventRequest()
             {
                 readFromValue(obj);
@@ -17006,7 +28506,7 @@ namespace PlayFabComboSdk
                 if (!Body.empty()) {
                     writer.String("Body");
                     writer.StartObject();
-                    for (std::map<AZStd::string, MultitypeVar>::iterator iter = Body.begin(); iter != Body.end(); ++iter) {
+                    for (PlayFabStringMap<MultitypeVar>::iterator iter = Body.begin(); iter != Body.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -17032,13 +28532,58 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("PlayFabId"):
+                            if (strcmp(member, "PlayFabId") != 0)
+                                break;
+                            PlayFabId = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("EventName"):
+                            if (strcmp(member, "EventName") != 0)
+                                break;
+                            EventName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Body"):
+                            if (strcmp(member, "Body") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Body[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
         struct WriteTitleEventRequest : public PlayFabBaseModel
         {
             AZStd::string EventName;
             OptionalTime Timestamp;
-            std::map<AZStd::string, MultitypeVar> Body;
+            PlayFabStringMap<MultitypeVar> Body;
 
             WriteTitleEventRequest() :
                 PlayFabBaseModel(),
@@ -17054,6 +28599,16 @@ namespace PlayFabComboSdk
                 Body(src.Body)
             {}
 
+            WriteTitleEventRequest(WriteTitleEventRequest&& src) noexcept :
+                PlayFabBaseModel(),
+                EventName(AZStd::move(src.EventName)),
+                Timestamp(AZStd::move(src.Timestamp)),
+                Body(AZStd::move(src.Body))
+            {}
+
+            WriteTitleEventRequest& operator=(const WriteTitleEventRequest& src) = default;
+            WriteTitleEventRequest& operator=(WriteTitleEventRequest&& src) = default;
+
             WriteTitleEventRequest(const rapidjson::Value& obj) : WriteTitleEventRequest()
             {
                 readFromValue(obj);
@@ -17075,7 +28630,7 @@ namespace PlayFabComboSdk
                 if (!Body.empty()) {
                     writer.String("Body");
                     writer.StartObject();
-                    for (std::map<AZStd::string, MultitypeVar>::iterator iter = Body.begin(); iter != Body.end(); ++iter) {
+                    for (PlayFabStringMap<MultitypeVar>::iterator iter = Body.begin(); iter != Body.end(); ++iter) {
                         writer.String(iter->first.c_str());
                         iter->second.writeJSON(writer);
                     }
@@ -17099,6 +28654,46 @@ namespace PlayFabComboSdk
 
                 return true;
             }
+
+            bool readFromReader(PlayFabJsonReader& reader) override
+            {
+                if (!reader.StartObject())
+                    return false;
+                const char* member;
+                while (reader.NextMember(member))
+                {
+                    if (!reader.IsNull())
+                    {
+                        switch (reader.GetMemberHash())
+                        {
+                        case PlayFabJsonReader::Hash("EventName"):
+                            if (strcmp(member, "EventName") != 0)
+                                break;
+                            EventName = reader.GetValue().GetString();
+                            continue;
+                        case PlayFabJsonReader::Hash("Timestamp"):
+                            if (strcmp(member, "Timestamp") != 0)
+                                break;
+                            Timestamp = readDatetime(reader.GetValue());
+                            continue;
+                        case PlayFabJsonReader::Hash("Body"):
+                            if (strcmp(member, "Body") != 0)
+                                break;
+                            if (reader.StartObject())
+                            {
+                                const char* key;
+                                while (reader.NextMember(key))
+                                {
+                                    Body[key].readFromReader(reader);
+                                }
+                            }
+                            continue;
+                        }
+                    }
+                    reader.Skip();
+                }
+                return true;
+            }
         };
 
 
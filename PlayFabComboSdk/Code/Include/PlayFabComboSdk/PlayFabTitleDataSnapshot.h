@@ -0,0 +1,46 @@
+#pragma once
+
+#include <PlayFabComboSdk/PlayFabFlatMap.h>
+
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace PlayFabComboSdk
+{
+    // The key value stores kept by the title data cache, see PlayFabCombo_TitleDataRequests
+    enum PlayFabTitleDataSource
+    {
+        PlayFabTitleDataPublic, // GetTitleData
+        PlayFabTitleDataInternal, // GetTitleInternalData, which needs the server secret key
+        PlayFabTitleDataSourceCount
+    };
+
+    // An immutable copy of the cached title data, published whole each time a refresh changes a value.
+    // Handed out through a PlayFabTitleDataSnapshotPtr, which keeps it alive for as long as it is held, however many newer snapshots replace it.
+    struct PlayFabTitleDataSnapshot
+    {
+        PlayFabTitleDataSnapshot() : version(0) {}
+
+        // The value for key, or nullptr if the title has no such key. Does not allocate.
+        const AZStd::string* Find(const char* key) const
+        {
+            PlayFabFlatMap<AZStd::string>::const_iterator found = values.find(key);
+            return found == values.end() ? nullptr : &found->second;
+        }
+
+        AZ::u64 version; // 0 until the first fetch completes, then incremented for every snapshot published
+        AZStd::chrono::system_clock::time_point fetchedTime; // When the response this snapshot was built from arrived
+        PlayFabFlatMap<AZStd::string> values;
+    };
+
+    typedef AZStd::shared_ptr<const PlayFabTitleDataSnapshot> PlayFabTitleDataSnapshotPtr;
+
+    // Title data cache counters for one source, see PlayFabCombo_TitleDataRequests::GetTitleDataCacheStats
+    struct PlayFabTitleDataCacheStats
+    {
+        AZ::u64 refreshes; // Fetches completed
+        AZ::u64 failedRefreshes; // Fetches which returned an error, and are tried again after a shorter delay
+        AZ::u64 publishedSnapshots; // Refreshes which changed a value, and so replaced the snapshot
+        AZ::u64 changedKeys; // Keys added, changed or removed, summed over every published snapshot
+    };
+}
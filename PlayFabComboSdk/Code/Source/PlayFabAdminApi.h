@@ -3,6 +3,7 @@
 #include <PlayFabComboSdk/PlayFabError.h>
 #include <PlayFabComboSdk/PlayFabAdminDataModels.h>
 #include <PlayFabComboSdk/PlayFabHttp.h>
+#include <PlayFabComboSdk/PlayFabLazyModel.h>
 
 namespace PlayFabComboSdk
 {
@@ -11,104 +12,201 @@ namespace PlayFabComboSdk
     public:
 
         // ------------ Generated Api calls
-        static void CreatePlayerSharedSecret(AdminModels::CreatePlayerSharedSecretRequest& request, ProcessApiCallback<AdminModels::CreatePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeletePlayerSharedSecret(AdminModels::DeletePlayerSharedSecretRequest& request, ProcessApiCallback<AdminModels::DeletePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerSharedSecrets(ProcessApiCallback<AdminModels::GetPlayerSharedSecretsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPolicy(AdminModels::GetPolicyRequest& request, ProcessApiCallback<AdminModels::GetPolicyResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetPlayerSecret(AdminModels::SetPlayerSecretRequest& request, ProcessApiCallback<AdminModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdatePlayerSharedSecret(AdminModels::UpdatePlayerSharedSecretRequest& request, ProcessApiCallback<AdminModels::UpdatePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdatePolicy(AdminModels::UpdatePolicyRequest& request, ProcessApiCallback<AdminModels::UpdatePolicyResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void BanUsers(AdminModels::BanUsersRequest& request, ProcessApiCallback<AdminModels::BanUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeletePlayer(AdminModels::DeletePlayerRequest& request, ProcessApiCallback<AdminModels::DeletePlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserAccountInfo(AdminModels::LookupUserAccountInfoRequest& request, ProcessApiCallback<AdminModels::LookupUserAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserBans(AdminModels::GetUserBansRequest& request, ProcessApiCallback<AdminModels::GetUserBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ResetUsers(AdminModels::ResetUsersRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RevokeAllBansForUser(AdminModels::RevokeAllBansForUserRequest& request, ProcessApiCallback<AdminModels::RevokeAllBansForUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RevokeBans(AdminModels::RevokeBansRequest& request, ProcessApiCallback<AdminModels::RevokeBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SendAccountRecoveryEmail(AdminModels::SendAccountRecoveryEmailRequest& request, ProcessApiCallback<AdminModels::SendAccountRecoveryEmailResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateBans(AdminModels::UpdateBansRequest& request, ProcessApiCallback<AdminModels::UpdateBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserTitleDisplayName(AdminModels::UpdateUserTitleDisplayNameRequest& request, ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void CreatePlayerStatisticDefinition(AdminModels::CreatePlayerStatisticDefinitionRequest& request, ProcessApiCallback<AdminModels::CreatePlayerStatisticDefinitionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteUsers(AdminModels::DeleteUsersRequest& request, ProcessApiCallback<AdminModels::DeleteUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetDataReport(AdminModels::GetDataReportRequest& request, ProcessApiCallback<AdminModels::GetDataReportResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerStatisticDefinitions(ProcessApiCallback<AdminModels::GetPlayerStatisticDefinitionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerStatisticVersions(AdminModels::GetPlayerStatisticVersionsRequest& request, ProcessApiCallback<AdminModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserInternalData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherInternalData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherReadOnlyData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserReadOnlyData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void IncrementPlayerStatisticVersion(AdminModels::IncrementPlayerStatisticVersionRequest& request, ProcessApiCallback<AdminModels::IncrementPlayerStatisticVersionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RefundPurchase(AdminModels::RefundPurchaseRequest& request, ProcessApiCallback<AdminModels::RefundPurchaseResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ResetUserStatistics(AdminModels::ResetUserStatisticsRequest& request, ProcessApiCallback<AdminModels::ResetUserStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ResolvePurchaseDispute(AdminModels::ResolvePurchaseDisputeRequest& request, ProcessApiCallback<AdminModels::ResolvePurchaseDisputeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdatePlayerStatisticDefinition(AdminModels::UpdatePlayerStatisticDefinitionRequest& request, ProcessApiCallback<AdminModels::UpdatePlayerStatisticDefinitionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserInternalData(AdminModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherInternalData(AdminModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherReadOnlyData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserReadOnlyData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddNews(AdminModels::AddNewsRequest& request, ProcessApiCallback<AdminModels::AddNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddVirtualCurrencyTypes(AdminModels::AddVirtualCurrencyTypesRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteStore(AdminModels::DeleteStoreRequest& request, ProcessApiCallback<AdminModels::DeleteStoreResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCatalogItems(AdminModels::GetCatalogItemsRequest& request, ProcessApiCallback<AdminModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPublisherData(AdminModels::GetPublisherDataRequest& request, ProcessApiCallback<AdminModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetRandomResultTables(AdminModels::GetRandomResultTablesRequest& request, ProcessApiCallback<AdminModels::GetRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetStoreItems(AdminModels::GetStoreItemsRequest& request, ProcessApiCallback<AdminModels::GetStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleData(AdminModels::GetTitleDataRequest& request, ProcessApiCallback<AdminModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleInternalData(AdminModels::GetTitleDataRequest& request, ProcessApiCallback<AdminModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ListVirtualCurrencyTypes(ProcessApiCallback<AdminModels::ListVirtualCurrencyTypesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveVirtualCurrencyTypes(AdminModels::RemoveVirtualCurrencyTypesRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetCatalogItems(AdminModels::UpdateCatalogItemsRequest& request, ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetStoreItems(AdminModels::UpdateStoreItemsRequest& request, ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetTitleData(AdminModels::SetTitleDataRequest& request, ProcessApiCallback<AdminModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetTitleInternalData(AdminModels::SetTitleDataRequest& request, ProcessApiCallback<AdminModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetupPushNotification(AdminModels::SetupPushNotificationRequest& request, ProcessApiCallback<AdminModels::SetupPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCatalogItems(AdminModels::UpdateCatalogItemsRequest& request, ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateRandomResultTables(AdminModels::UpdateRandomResultTablesRequest& request, ProcessApiCallback<AdminModels::UpdateRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateStoreItems(AdminModels::UpdateStoreItemsRequest& request, ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddUserVirtualCurrency(AdminModels::AddUserVirtualCurrencyRequest& request, ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserInventory(AdminModels::GetUserInventoryRequest& request, ProcessApiCallback<AdminModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GrantItemsToUsers(AdminModels::GrantItemsToUsersRequest& request, ProcessApiCallback<AdminModels::GrantItemsToUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RevokeInventoryItem(AdminModels::RevokeInventoryItemRequest& request, ProcessApiCallback<AdminModels::RevokeInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SubtractUserVirtualCurrency(AdminModels::SubtractUserVirtualCurrencyRequest& request, ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetMatchmakerGameInfo(AdminModels::GetMatchmakerGameInfoRequest& request, ProcessApiCallback<AdminModels::GetMatchmakerGameInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetMatchmakerGameModes(AdminModels::GetMatchmakerGameModesRequest& request, ProcessApiCallback<AdminModels::GetMatchmakerGameModesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ModifyMatchmakerGameModes(AdminModels::ModifyMatchmakerGameModesRequest& request, ProcessApiCallback<AdminModels::ModifyMatchmakerGameModesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddServerBuild(AdminModels::AddServerBuildRequest& request, ProcessApiCallback<AdminModels::AddServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetServerBuildInfo(AdminModels::GetServerBuildInfoRequest& request, ProcessApiCallback<AdminModels::GetServerBuildInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetServerBuildUploadUrl(AdminModels::GetServerBuildUploadURLRequest& request, ProcessApiCallback<AdminModels::GetServerBuildUploadURLResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ListServerBuilds(ProcessApiCallback<AdminModels::ListBuildsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ModifyServerBuild(AdminModels::ModifyServerBuildRequest& request, ProcessApiCallback<AdminModels::ModifyServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveServerBuild(AdminModels::RemoveServerBuildRequest& request, ProcessApiCallback<AdminModels::RemoveServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetPublisherData(AdminModels::SetPublisherDataRequest& request, ProcessApiCallback<AdminModels::SetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCloudScriptRevision(AdminModels::GetCloudScriptRevisionRequest& request, ProcessApiCallback<AdminModels::GetCloudScriptRevisionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCloudScriptVersions(ProcessApiCallback<AdminModels::GetCloudScriptVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetPublishedRevision(AdminModels::SetPublishedRevisionRequest& request, ProcessApiCallback<AdminModels::SetPublishedRevisionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCloudScript(AdminModels::UpdateCloudScriptRequest& request, ProcessApiCallback<AdminModels::UpdateCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteContent(AdminModels::DeleteContentRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetContentList(AdminModels::GetContentListRequest& request, ProcessApiCallback<AdminModels::GetContentListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetContentUploadUrl(AdminModels::GetContentUploadUrlRequest& request, ProcessApiCallback<AdminModels::GetContentUploadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ResetCharacterStatistics(AdminModels::ResetCharacterStatisticsRequest& request, ProcessApiCallback<AdminModels::ResetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddPlayerTag(AdminModels::AddPlayerTagRequest& request, ProcessApiCallback<AdminModels::AddPlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAllActionGroups(ProcessApiCallback<AdminModels::GetAllActionGroupsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAllSegments(ProcessApiCallback<AdminModels::GetAllSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerSegments(AdminModels::GetPlayersSegmentsRequest& request, ProcessApiCallback<AdminModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayersInSegment(AdminModels::GetPlayersInSegmentRequest& request, ProcessApiCallback<AdminModels::GetPlayersInSegmentResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerTags(AdminModels::GetPlayerTagsRequest& request, ProcessApiCallback<AdminModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemovePlayerTag(AdminModels::RemovePlayerTagRequest& request, ProcessApiCallback<AdminModels::RemovePlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AbortTaskInstance(AdminModels::AbortTaskInstanceRequest& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void CreateActionsOnPlayersInSegmentTask(AdminModels::CreateActionsOnPlayerSegmentTaskRequest& request, ProcessApiCallback<AdminModels::CreateTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void CreateCloudScriptTask(AdminModels::CreateCloudScriptTaskRequest& request, ProcessApiCallback<AdminModels::CreateTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteTask(AdminModels::DeleteTaskRequest& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetActionsOnPlayersInSegmentTaskInstance(AdminModels::GetTaskInstanceRequest& request, ProcessApiCallback<AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCloudScriptTaskInstance(AdminModels::GetTaskInstanceRequest& request, ProcessApiCallback<AdminModels::GetCloudScriptTaskInstanceResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTaskInstances(AdminModels::GetTaskInstancesRequest& request, ProcessApiCallback<AdminModels::GetTaskInstancesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTasks(AdminModels::GetTasksRequest& request, ProcessApiCallback<AdminModels::GetTasksResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RunTask(AdminModels::RunTaskRequest& request, ProcessApiCallback<AdminModels::RunTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateTask(AdminModels::UpdateTaskRequest& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+        static void CreatePlayerSharedSecret(AdminModels::CreatePlayerSharedSecretRequest& request, ProcessApiCallback<AdminModels::CreatePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeletePlayerSharedSecret(AdminModels::DeletePlayerSharedSecretRequest& request, ProcessApiCallback<AdminModels::DeletePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerSharedSecrets(ProcessApiCallback<AdminModels::GetPlayerSharedSecretsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPolicy(AdminModels::GetPolicyRequest& request, ProcessApiCallback<AdminModels::GetPolicyResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetPlayerSecret(AdminModels::SetPlayerSecretRequest& request, ProcessApiCallback<AdminModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdatePlayerSharedSecret(AdminModels::UpdatePlayerSharedSecretRequest& request, ProcessApiCallback<AdminModels::UpdatePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdatePolicy(AdminModels::UpdatePolicyRequest& request, ProcessApiCallback<AdminModels::UpdatePolicyResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void BanUsers(AdminModels::BanUsersRequest& request, ProcessApiCallback<AdminModels::BanUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeletePlayer(AdminModels::DeletePlayerRequest& request, ProcessApiCallback<AdminModels::DeletePlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserAccountInfo(AdminModels::LookupUserAccountInfoRequest& request, ProcessApiCallback<AdminModels::LookupUserAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserBans(AdminModels::GetUserBansRequest& request, ProcessApiCallback<AdminModels::GetUserBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ResetUsers(AdminModels::ResetUsersRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RevokeAllBansForUser(AdminModels::RevokeAllBansForUserRequest& request, ProcessApiCallback<AdminModels::RevokeAllBansForUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RevokeBans(AdminModels::RevokeBansRequest& request, ProcessApiCallback<AdminModels::RevokeBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SendAccountRecoveryEmail(AdminModels::SendAccountRecoveryEmailRequest& request, ProcessApiCallback<AdminModels::SendAccountRecoveryEmailResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateBans(AdminModels::UpdateBansRequest& request, ProcessApiCallback<AdminModels::UpdateBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserTitleDisplayName(AdminModels::UpdateUserTitleDisplayNameRequest& request, ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void CreatePlayerStatisticDefinition(AdminModels::CreatePlayerStatisticDefinitionRequest& request, ProcessApiCallback<AdminModels::CreatePlayerStatisticDefinitionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteUsers(AdminModels::DeleteUsersRequest& request, ProcessApiCallback<AdminModels::DeleteUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetDataReport(AdminModels::GetDataReportRequest& request, ProcessApiCallback<AdminModels::GetDataReportResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerStatisticDefinitions(ProcessApiCallback<AdminModels::GetPlayerStatisticDefinitionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerStatisticVersions(AdminModels::GetPlayerStatisticVersionsRequest& request, ProcessApiCallback<AdminModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInternalData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherInternalData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherReadOnlyData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserReadOnlyData(AdminModels::GetUserDataRequest& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void IncrementPlayerStatisticVersion(AdminModels::IncrementPlayerStatisticVersionRequest& request, ProcessApiCallback<AdminModels::IncrementPlayerStatisticVersionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RefundPurchase(AdminModels::RefundPurchaseRequest& request, ProcessApiCallback<AdminModels::RefundPurchaseResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ResetUserStatistics(AdminModels::ResetUserStatisticsRequest& request, ProcessApiCallback<AdminModels::ResetUserStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ResolvePurchaseDispute(AdminModels::ResolvePurchaseDisputeRequest& request, ProcessApiCallback<AdminModels::ResolvePurchaseDisputeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdatePlayerStatisticDefinition(AdminModels::UpdatePlayerStatisticDefinitionRequest& request, ProcessApiCallback<AdminModels::UpdatePlayerStatisticDefinitionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserInternalData(AdminModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherInternalData(AdminModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherReadOnlyData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserReadOnlyData(AdminModels::UpdateUserDataRequest& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddNews(AdminModels::AddNewsRequest& request, ProcessApiCallback<AdminModels::AddNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddVirtualCurrencyTypes(AdminModels::AddVirtualCurrencyTypesRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteStore(AdminModels::DeleteStoreRequest& request, ProcessApiCallback<AdminModels::DeleteStoreResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCatalogItems(AdminModels::GetCatalogItemsRequest& request, ProcessApiCallback<AdminModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPublisherData(AdminModels::GetPublisherDataRequest& request, ProcessApiCallback<AdminModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetRandomResultTables(AdminModels::GetRandomResultTablesRequest& request, ProcessApiCallback<AdminModels::GetRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetStoreItems(AdminModels::GetStoreItemsRequest& request, ProcessApiCallback<AdminModels::GetStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleData(AdminModels::GetTitleDataRequest& request, ProcessApiCallback<AdminModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleInternalData(AdminModels::GetTitleDataRequest& request, ProcessApiCallback<AdminModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ListVirtualCurrencyTypes(ProcessApiCallback<AdminModels::ListVirtualCurrencyTypesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveVirtualCurrencyTypes(AdminModels::RemoveVirtualCurrencyTypesRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetCatalogItems(AdminModels::UpdateCatalogItemsRequest& request, ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetStoreItems(AdminModels::UpdateStoreItemsRequest& request, ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetTitleData(AdminModels::SetTitleDataRequest& request, ProcessApiCallback<AdminModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetTitleInternalData(AdminModels::SetTitleDataRequest& request, ProcessApiCallback<AdminModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetupPushNotification(AdminModels::SetupPushNotificationRequest& request, ProcessApiCallback<AdminModels::SetupPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCatalogItems(AdminModels::UpdateCatalogItemsRequest& request, ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateRandomResultTables(AdminModels::UpdateRandomResultTablesRequest& request, ProcessApiCallback<AdminModels::UpdateRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateStoreItems(AdminModels::UpdateStoreItemsRequest& request, ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddUserVirtualCurrency(AdminModels::AddUserVirtualCurrencyRequest& request, ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInventory(AdminModels::GetUserInventoryRequest& request, ProcessApiCallback<AdminModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GrantItemsToUsers(AdminModels::GrantItemsToUsersRequest& request, ProcessApiCallback<AdminModels::GrantItemsToUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RevokeInventoryItem(AdminModels::RevokeInventoryItemRequest& request, ProcessApiCallback<AdminModels::RevokeInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SubtractUserVirtualCurrency(AdminModels::SubtractUserVirtualCurrencyRequest& request, ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetMatchmakerGameInfo(AdminModels::GetMatchmakerGameInfoRequest& request, ProcessApiCallback<AdminModels::GetMatchmakerGameInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetMatchmakerGameModes(AdminModels::GetMatchmakerGameModesRequest& request, ProcessApiCallback<AdminModels::GetMatchmakerGameModesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ModifyMatchmakerGameModes(AdminModels::ModifyMatchmakerGameModesRequest& request, ProcessApiCallback<AdminModels::ModifyMatchmakerGameModesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddServerBuild(AdminModels::AddServerBuildRequest& request, ProcessApiCallback<AdminModels::AddServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetServerBuildInfo(AdminModels::GetServerBuildInfoRequest& request, ProcessApiCallback<AdminModels::GetServerBuildInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetServerBuildUploadUrl(AdminModels::GetServerBuildUploadURLRequest& request, ProcessApiCallback<AdminModels::GetServerBuildUploadURLResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ListServerBuilds(ProcessApiCallback<AdminModels::ListBuildsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ModifyServerBuild(AdminModels::ModifyServerBuildRequest& request, ProcessApiCallback<AdminModels::ModifyServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveServerBuild(AdminModels::RemoveServerBuildRequest& request, ProcessApiCallback<AdminModels::RemoveServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetPublisherData(AdminModels::SetPublisherDataRequest& request, ProcessApiCallback<AdminModels::SetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCloudScriptRevision(AdminModels::GetCloudScriptRevisionRequest& request, ProcessApiCallback<AdminModels::GetCloudScriptRevisionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCloudScriptVersions(ProcessApiCallback<AdminModels::GetCloudScriptVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetPublishedRevision(AdminModels::SetPublishedRevisionRequest& request, ProcessApiCallback<AdminModels::SetPublishedRevisionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCloudScript(AdminModels::UpdateCloudScriptRequest& request, ProcessApiCallback<AdminModels::UpdateCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteContent(AdminModels::DeleteContentRequest& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetContentList(AdminModels::GetContentListRequest& request, ProcessApiCallback<AdminModels::GetContentListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetContentUploadUrl(AdminModels::GetContentUploadUrlRequest& request, ProcessApiCallback<AdminModels::GetContentUploadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ResetCharacterStatistics(AdminModels::ResetCharacterStatisticsRequest& request, ProcessApiCallback<AdminModels::ResetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddPlayerTag(AdminModels::AddPlayerTagRequest& request, ProcessApiCallback<AdminModels::AddPlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAllActionGroups(ProcessApiCallback<AdminModels::GetAllActionGroupsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAllSegments(ProcessApiCallback<AdminModels::GetAllSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerSegments(AdminModels::GetPlayersSegmentsRequest& request, ProcessApiCallback<AdminModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayersInSegment(AdminModels::GetPlayersInSegmentRequest& request, ProcessApiCallback<AdminModels::GetPlayersInSegmentResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerTags(AdminModels::GetPlayerTagsRequest& request, ProcessApiCallback<AdminModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemovePlayerTag(AdminModels::RemovePlayerTagRequest& request, ProcessApiCallback<AdminModels::RemovePlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AbortTaskInstance(AdminModels::AbortTaskInstanceRequest& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void CreateActionsOnPlayersInSegmentTask(AdminModels::CreateActionsOnPlayerSegmentTaskRequest& request, ProcessApiCallback<AdminModels::CreateTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void CreateCloudScriptTask(AdminModels::CreateCloudScriptTaskRequest& request, ProcessApiCallback<AdminModels::CreateTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteTask(AdminModels::DeleteTaskRequest& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetActionsOnPlayersInSegmentTaskInstance(AdminModels::GetTaskInstanceRequest& request, ProcessApiCallback<AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCloudScriptTaskInstance(AdminModels::GetTaskInstanceRequest& request, ProcessApiCallback<AdminModels::GetCloudScriptTaskInstanceResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTaskInstances(AdminModels::GetTaskInstancesRequest& request, ProcessApiCallback<AdminModels::GetTaskInstancesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTasks(AdminModels::GetTasksRequest& request, ProcessApiCallback<AdminModels::GetTasksResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RunTask(AdminModels::RunTaskRequest& request, ProcessApiCallback<AdminModels::RunTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateTask(AdminModels::UpdateTaskRequest& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+
+        // ------------ Generated Api calls taking a temporary or moved request, which is serialized in place as the lvalue calls do
+        static void CreatePlayerSharedSecret(AdminModels::CreatePlayerSharedSecretRequest&& request, ProcessApiCallback<AdminModels::CreatePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CreatePlayerSharedSecret(request, callback, errorCallback, customData, priority); }
+        static void DeletePlayerSharedSecret(AdminModels::DeletePlayerSharedSecretRequest&& request, ProcessApiCallback<AdminModels::DeletePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeletePlayerSharedSecret(request, callback, errorCallback, customData, priority); }
+        static void GetPolicy(AdminModels::GetPolicyRequest&& request, ProcessApiCallback<AdminModels::GetPolicyResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPolicy(request, callback, errorCallback, customData, priority); }
+        static void SetPlayerSecret(AdminModels::SetPlayerSecretRequest&& request, ProcessApiCallback<AdminModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetPlayerSecret(request, callback, errorCallback, customData, priority); }
+        static void UpdatePlayerSharedSecret(AdminModels::UpdatePlayerSharedSecretRequest&& request, ProcessApiCallback<AdminModels::UpdatePlayerSharedSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdatePlayerSharedSecret(request, callback, errorCallback, customData, priority); }
+        static void UpdatePolicy(AdminModels::UpdatePolicyRequest&& request, ProcessApiCallback<AdminModels::UpdatePolicyResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdatePolicy(request, callback, errorCallback, customData, priority); }
+        static void BanUsers(AdminModels::BanUsersRequest&& request, ProcessApiCallback<AdminModels::BanUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { BanUsers(request, callback, errorCallback, customData, priority); }
+        static void DeletePlayer(AdminModels::DeletePlayerRequest&& request, ProcessApiCallback<AdminModels::DeletePlayerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeletePlayer(request, callback, errorCallback, customData, priority); }
+        static void GetUserAccountInfo(AdminModels::LookupUserAccountInfoRequest&& request, ProcessApiCallback<AdminModels::LookupUserAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserAccountInfo(request, callback, errorCallback, customData, priority); }
+        static void GetUserBans(AdminModels::GetUserBansRequest&& request, ProcessApiCallback<AdminModels::GetUserBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserBans(request, callback, errorCallback, customData, priority); }
+        static void ResetUsers(AdminModels::ResetUsersRequest&& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ResetUsers(request, callback, errorCallback, customData, priority); }
+        static void RevokeAllBansForUser(AdminModels::RevokeAllBansForUserRequest&& request, ProcessApiCallback<AdminModels::RevokeAllBansForUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RevokeAllBansForUser(request, callback, errorCallback, customData, priority); }
+        static void RevokeBans(AdminModels::RevokeBansRequest&& request, ProcessApiCallback<AdminModels::RevokeBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RevokeBans(request, callback, errorCallback, customData, priority); }
+        static void SendAccountRecoveryEmail(AdminModels::SendAccountRecoveryEmailRequest&& request, ProcessApiCallback<AdminModels::SendAccountRecoveryEmailResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SendAccountRecoveryEmail(request, callback, errorCallback, customData, priority); }
+        static void UpdateBans(AdminModels::UpdateBansRequest&& request, ProcessApiCallback<AdminModels::UpdateBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateBans(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserTitleDisplayName(AdminModels::UpdateUserTitleDisplayNameRequest&& request, ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserTitleDisplayName(request, callback, errorCallback, customData, priority); }
+        static void CreatePlayerStatisticDefinition(AdminModels::CreatePlayerStatisticDefinitionRequest&& request, ProcessApiCallback<AdminModels::CreatePlayerStatisticDefinitionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CreatePlayerStatisticDefinition(request, callback, errorCallback, customData, priority); }
+        static void DeleteUsers(AdminModels::DeleteUsersRequest&& request, ProcessApiCallback<AdminModels::DeleteUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteUsers(request, callback, errorCallback, customData, priority); }
+        static void GetDataReport(AdminModels::GetDataReportRequest&& request, ProcessApiCallback<AdminModels::GetDataReportResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetDataReport(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerStatisticVersions(AdminModels::GetPlayerStatisticVersionsRequest&& request, ProcessApiCallback<AdminModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerStatisticVersions(request, callback, errorCallback, customData, priority); }
+        static void GetUserData(AdminModels::GetUserDataRequest&& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserData(request, callback, errorCallback, customData, priority); }
+        static void GetUserInternalData(AdminModels::GetUserDataRequest&& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserInternalData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherData(AdminModels::GetUserDataRequest&& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherInternalData(AdminModels::GetUserDataRequest&& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherInternalData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherReadOnlyData(AdminModels::GetUserDataRequest&& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void GetUserReadOnlyData(AdminModels::GetUserDataRequest&& request, ProcessApiCallback<AdminModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void IncrementPlayerStatisticVersion(AdminModels::IncrementPlayerStatisticVersionRequest&& request, ProcessApiCallback<AdminModels::IncrementPlayerStatisticVersionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { IncrementPlayerStatisticVersion(request, callback, errorCallback, customData, priority); }
+        static void RefundPurchase(AdminModels::RefundPurchaseRequest&& request, ProcessApiCallback<AdminModels::RefundPurchaseResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RefundPurchase(request, callback, errorCallback, customData, priority); }
+        static void ResetUserStatistics(AdminModels::ResetUserStatisticsRequest&& request, ProcessApiCallback<AdminModels::ResetUserStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ResetUserStatistics(request, callback, errorCallback, customData, priority); }
+        static void ResolvePurchaseDispute(AdminModels::ResolvePurchaseDisputeRequest&& request, ProcessApiCallback<AdminModels::ResolvePurchaseDisputeResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ResolvePurchaseDispute(request, callback, errorCallback, customData, priority); }
+        static void UpdatePlayerStatisticDefinition(AdminModels::UpdatePlayerStatisticDefinitionRequest&& request, ProcessApiCallback<AdminModels::UpdatePlayerStatisticDefinitionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdatePlayerStatisticDefinition(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserData(AdminModels::UpdateUserDataRequest&& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserInternalData(AdminModels::UpdateUserInternalDataRequest&& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserInternalData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherData(AdminModels::UpdateUserDataRequest&& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherInternalData(AdminModels::UpdateUserInternalDataRequest&& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherInternalData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherReadOnlyData(AdminModels::UpdateUserDataRequest&& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserReadOnlyData(AdminModels::UpdateUserDataRequest&& request, ProcessApiCallback<AdminModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void AddNews(AdminModels::AddNewsRequest&& request, ProcessApiCallback<AdminModels::AddNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddNews(request, callback, errorCallback, customData, priority); }
+        static void AddVirtualCurrencyTypes(AdminModels::AddVirtualCurrencyTypesRequest&& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddVirtualCurrencyTypes(request, callback, errorCallback, customData, priority); }
+        static void DeleteStore(AdminModels::DeleteStoreRequest&& request, ProcessApiCallback<AdminModels::DeleteStoreResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteStore(request, callback, errorCallback, customData, priority); }
+        static void GetCatalogItems(AdminModels::GetCatalogItemsRequest&& request, ProcessApiCallback<AdminModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCatalogItems(request, callback, errorCallback, customData, priority); }
+        static void GetPublisherData(AdminModels::GetPublisherDataRequest&& request, ProcessApiCallback<AdminModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetRandomResultTables(AdminModels::GetRandomResultTablesRequest&& request, ProcessApiCallback<AdminModels::GetRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetRandomResultTables(request, callback, errorCallback, customData, priority); }
+        static void GetStoreItems(AdminModels::GetStoreItemsRequest&& request, ProcessApiCallback<AdminModels::GetStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetStoreItems(request, callback, errorCallback, customData, priority); }
+        static void GetTitleData(AdminModels::GetTitleDataRequest&& request, ProcessApiCallback<AdminModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleData(request, callback, errorCallback, customData, priority); }
+        static void GetTitleInternalData(AdminModels::GetTitleDataRequest&& request, ProcessApiCallback<AdminModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleInternalData(request, callback, errorCallback, customData, priority); }
+        static void RemoveVirtualCurrencyTypes(AdminModels::RemoveVirtualCurrencyTypesRequest&& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveVirtualCurrencyTypes(request, callback, errorCallback, customData, priority); }
+        static void SetCatalogItems(AdminModels::UpdateCatalogItemsRequest&& request, ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetCatalogItems(request, callback, errorCallback, customData, priority); }
+        static void SetStoreItems(AdminModels::UpdateStoreItemsRequest&& request, ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetStoreItems(request, callback, errorCallback, customData, priority); }
+        static void SetTitleData(AdminModels::SetTitleDataRequest&& request, ProcessApiCallback<AdminModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetTitleData(request, callback, errorCallback, customData, priority); }
+        static void SetTitleInternalData(AdminModels::SetTitleDataRequest&& request, ProcessApiCallback<AdminModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetTitleInternalData(request, callback, errorCallback, customData, priority); }
+        static void SetupPushNotification(AdminModels::SetupPushNotificationRequest&& request, ProcessApiCallback<AdminModels::SetupPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetupPushNotification(request, callback, errorCallback, customData, priority); }
+        static void UpdateCatalogItems(AdminModels::UpdateCatalogItemsRequest&& request, ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCatalogItems(request, callback, errorCallback, customData, priority); }
+        static void UpdateRandomResultTables(AdminModels::UpdateRandomResultTablesRequest&& request, ProcessApiCallback<AdminModels::UpdateRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateRandomResultTables(request, callback, errorCallback, customData, priority); }
+        static void UpdateStoreItems(AdminModels::UpdateStoreItemsRequest&& request, ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateStoreItems(request, callback, errorCallback, customData, priority); }
+        static void AddUserVirtualCurrency(AdminModels::AddUserVirtualCurrencyRequest&& request, ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddUserVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void GetUserInventory(AdminModels::GetUserInventoryRequest&& request, ProcessApiCallback<AdminModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserInventory(request, callback, errorCallback, customData, priority); }
+        static void GrantItemsToUsers(AdminModels::GrantItemsToUsersRequest&& request, ProcessApiCallback<AdminModels::GrantItemsToUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GrantItemsToUsers(request, callback, errorCallback, customData, priority); }
+        static void RevokeInventoryItem(AdminModels::RevokeInventoryItemRequest&& request, ProcessApiCallback<AdminModels::RevokeInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RevokeInventoryItem(request, callback, errorCallback, customData, priority); }
+        static void SubtractUserVirtualCurrency(AdminModels::SubtractUserVirtualCurrencyRequest&& request, ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SubtractUserVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void GetMatchmakerGameInfo(AdminModels::GetMatchmakerGameInfoRequest&& request, ProcessApiCallback<AdminModels::GetMatchmakerGameInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetMatchmakerGameInfo(request, callback, errorCallback, customData, priority); }
+        static void GetMatchmakerGameModes(AdminModels::GetMatchmakerGameModesRequest&& request, ProcessApiCallback<AdminModels::GetMatchmakerGameModesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetMatchmakerGameModes(request, callback, errorCallback, customData, priority); }
+        static void ModifyMatchmakerGameModes(AdminModels::ModifyMatchmakerGameModesRequest&& request, ProcessApiCallback<AdminModels::ModifyMatchmakerGameModesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ModifyMatchmakerGameModes(request, callback, errorCallback, customData, priority); }
+        static void AddServerBuild(AdminModels::AddServerBuildRequest&& request, ProcessApiCallback<AdminModels::AddServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddServerBuild(request, callback, errorCallback, customData, priority); }
+        static void GetServerBuildInfo(AdminModels::GetServerBuildInfoRequest&& request, ProcessApiCallback<AdminModels::GetServerBuildInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetServerBuildInfo(request, callback, errorCallback, customData, priority); }
+        static void GetServerBuildUploadUrl(AdminModels::GetServerBuildUploadURLRequest&& request, ProcessApiCallback<AdminModels::GetServerBuildUploadURLResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetServerBuildUploadUrl(request, callback, errorCallback, customData, priority); }
+        static void ModifyServerBuild(AdminModels::ModifyServerBuildRequest&& request, ProcessApiCallback<AdminModels::ModifyServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ModifyServerBuild(request, callback, errorCallback, customData, priority); }
+        static void RemoveServerBuild(AdminModels::RemoveServerBuildRequest&& request, ProcessApiCallback<AdminModels::RemoveServerBuildResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveServerBuild(request, callback, errorCallback, customData, priority); }
+        static void SetPublisherData(AdminModels::SetPublisherDataRequest&& request, ProcessApiCallback<AdminModels::SetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetCloudScriptRevision(AdminModels::GetCloudScriptRevisionRequest&& request, ProcessApiCallback<AdminModels::GetCloudScriptRevisionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCloudScriptRevision(request, callback, errorCallback, customData, priority); }
+        static void SetPublishedRevision(AdminModels::SetPublishedRevisionRequest&& request, ProcessApiCallback<AdminModels::SetPublishedRevisionResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetPublishedRevision(request, callback, errorCallback, customData, priority); }
+        static void UpdateCloudScript(AdminModels::UpdateCloudScriptRequest&& request, ProcessApiCallback<AdminModels::UpdateCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCloudScript(request, callback, errorCallback, customData, priority); }
+        static void DeleteContent(AdminModels::DeleteContentRequest&& request, ProcessApiCallback<AdminModels::BlankResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteContent(request, callback, errorCallback, customData, priority); }
+        static void GetContentList(AdminModels::GetContentListRequest&& request, ProcessApiCallback<AdminModels::GetContentListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetContentList(request, callback, errorCallback, customData, priority); }
+        static void GetContentUploadUrl(AdminModels::GetContentUploadUrlRequest&& request, ProcessApiCallback<AdminModels::GetContentUploadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetContentUploadUrl(request, callback, errorCallback, customData, priority); }
+        static void ResetCharacterStatistics(AdminModels::ResetCharacterStatisticsRequest&& request, ProcessApiCallback<AdminModels::ResetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ResetCharacterStatistics(request, callback, errorCallback, customData, priority); }
+        static void AddPlayerTag(AdminModels::AddPlayerTagRequest&& request, ProcessApiCallback<AdminModels::AddPlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddPlayerTag(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerSegments(AdminModels::GetPlayersSegmentsRequest&& request, ProcessApiCallback<AdminModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerSegments(request, callback, errorCallback, customData, priority); }
+        static void GetPlayersInSegment(AdminModels::GetPlayersInSegmentRequest&& request, ProcessApiCallback<AdminModels::GetPlayersInSegmentResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayersInSegment(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerTags(AdminModels::GetPlayerTagsRequest&& request, ProcessApiCallback<AdminModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerTags(request, callback, errorCallback, customData, priority); }
+        static void RemovePlayerTag(AdminModels::RemovePlayerTagRequest&& request, ProcessApiCallback<AdminModels::RemovePlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemovePlayerTag(request, callback, errorCallback, customData, priority); }
+        static void AbortTaskInstance(AdminModels::AbortTaskInstanceRequest&& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AbortTaskInstance(request, callback, errorCallback, customData, priority); }
+        static void CreateActionsOnPlayersInSegmentTask(AdminModels::CreateActionsOnPlayerSegmentTaskRequest&& request, ProcessApiCallback<AdminModels::CreateTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CreateActionsOnPlayersInSegmentTask(request, callback, errorCallback, customData, priority); }
+        static void CreateCloudScriptTask(AdminModels::CreateCloudScriptTaskRequest&& request, ProcessApiCallback<AdminModels::CreateTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CreateCloudScriptTask(request, callback, errorCallback, customData, priority); }
+        static void DeleteTask(AdminModels::DeleteTaskRequest&& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteTask(request, callback, errorCallback, customData, priority); }
+        static void GetActionsOnPlayersInSegmentTaskInstance(AdminModels::GetTaskInstanceRequest&& request, ProcessApiCallback<AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetActionsOnPlayersInSegmentTaskInstance(request, callback, errorCallback, customData, priority); }
+        static void GetCloudScriptTaskInstance(AdminModels::GetTaskInstanceRequest&& request, ProcessApiCallback<AdminModels::GetCloudScriptTaskInstanceResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCloudScriptTaskInstance(request, callback, errorCallback, customData, priority); }
+        static void GetTaskInstances(AdminModels::GetTaskInstancesRequest&& request, ProcessApiCallback<AdminModels::GetTaskInstancesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTaskInstances(request, callback, errorCallback, customData, priority); }
+        static void GetTasks(AdminModels::GetTasksRequest&& request, ProcessApiCallback<AdminModels::GetTasksResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTasks(request, callback, errorCallback, customData, priority); }
+        static void RunTask(AdminModels::RunTaskRequest&& request, ProcessApiCallback<AdminModels::RunTaskResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RunTask(request, callback, errorCallback, customData, priority); }
+        static void UpdateTask(AdminModels::UpdateTaskRequest&& request, ProcessApiCallback<AdminModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateTask(request, callback, errorCallback, customData, priority); }
+
+        // ------------ Lazily decoded variants of the calls with the largest results, see PlayFabLazyModel
+        static void GetCatalogItemsLazy(AdminModels::GetCatalogItemsRequest& request, ProcessApiCallback<PlayFabLazyModel<AdminModels::GetCatalogItemsResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInventoryLazy(AdminModels::GetUserInventoryRequest& request, ProcessApiCallback<PlayFabLazyModel<AdminModels::GetUserInventoryResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
 
     private:
         // ------------ Private constructor, to enforce all-static class
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <PlayFabComboSdk/PlayFabCatalogSnapshot.h>
+#include "PlayFabSnapshotPublisher.h"
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabComboSdk
+{
+    // Decoded catalogs kept in memory, one per catalog version, and refreshed in the background, see PlayFabCombo_CatalogRequests.
+    // The snapshots are reached through one published set, keyed by catalog version. A refresh indexes the new catalog on the thread which
+    // received it, then publishes a new set in place of the old one, so lookups never take the cache's lock or allocate.
+    // A replaced set or snapshot is freed once the last reader holding it lets go.
+    class PlayFabCatalogCache
+        : private AZ::TickBus::Handler
+    {
+    public:
+        // Send the api call for catalogVersion, which must end in ApplyFetchResult or ApplyFetchFailure. Returns false if it could not be sent.
+        typedef bool(*FetchFunction)(const AZStd::string& catalogVersion);
+
+        static PlayFabCatalogCache* catalogCache;
+
+        PlayFabCatalogCache(FetchFunction fetchFunction, int refreshIntervalSeconds);
+        ~PlayFabCatalogCache();
+
+        void Start(const AZStd::string& catalogVersion);
+        void Stop(const AZStd::string& catalogVersion);
+        void Refresh(const AZStd::string& catalogVersion);
+        void SetRefreshInterval(int seconds);
+
+        PlayFabCatalogSnapshotPtr GetSnapshot(const char* catalogVersion) const
+        {
+            PlayFabSnapshotPublisher<SnapshotSet>::Handle published = m_published.Get();
+            SnapshotSet::const_iterator found = published->find(catalogVersion);
+            return found == published->end() ? nullptr : found->second;
+        }
+        PlayFabCatalogCacheStats GetStats(const AZStd::string& catalogVersion);
+
+        // Start the fetches which are due
+        void Update(AZStd::chrono::system_clock::time_point now);
+        // Index catalog, taking its items, and publish it as the snapshot of catalogVersion
+        void ApplyFetchResult(const AZStd::string& catalogVersion, std::vector<PlayFabCatalogItem>&& catalog);
+        void ApplyFetchFailure(const AZStd::string& catalogVersion);
+
+    private:
+        typedef PlayFabFlatMap<PlayFabCatalogSnapshotPtr> SnapshotSet;
+
+        static const int FailureRetrySeconds = 30; // Delay before fetching again after an error, when the refresh interval is longer
+
+        struct CatalogState
+        {
+            bool active;
+            bool fetching; // At most one fetch per catalog version is in flight
+            bool refreshRequested; // Fetch on the next update, rather than at nextRefreshTime
+            AZStd::chrono::system_clock::time_point nextRefreshTime;
+            PlayFabCatalogCacheStats stats;
+        };
+
+        // Build the indexes of a catalog, and measure its size and lookup time
+        static AZStd::shared_ptr<PlayFabCatalogSnapshot> BuildSnapshot(const AZStd::string& catalogVersion, std::vector<PlayFabCatalogItem>&& catalog, PlayFabCatalogCacheStats& stats);
+        static AZ::u64 EstimateItemBytes(const PlayFabCatalogItem& item);
+
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        const FetchFunction m_fetchFunction;
+
+        PlayFabSnapshotPublisher<SnapshotSet> m_published; // Only ever replaced, under m_mutex
+
+        AZStd::mutex m_mutex; // Guards everything but lookups through m_published
+        PlayFabFlatMap<CatalogState> m_catalogs;
+        int m_refreshIntervalSeconds;
+    };
+}
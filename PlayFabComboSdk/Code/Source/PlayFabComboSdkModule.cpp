@@ -3,12 +3,22 @@
 
 #include <platform_impl.h> // Resharper says this is unused, but it's still required in some less direct way
 #include "PlayFabCombo_SettingsSysComponent.h"
+#include "PlayFabCombo_TitleDataSysComponent.h"
+#include "PlayFabCombo_CatalogSysComponent.h"
+#include "PlayFabCombo_StatisticsSysComponent.h"
+#include "PlayFabCombo_UserDataSysComponent.h"
+#include "PlayFabCombo_TelemetrySysComponent.h"
 #include "PlayFabCombo_AdminSysComponent.h"
 #include "PlayFabCombo_MatchmakerSysComponent.h"
 #include "PlayFabCombo_ServerSysComponent.h"
 #include "PlayFabCombo_ClientSysComponent.h"
 
 #include "PlayFabSettings.h"
+#include "PlayFabTitleDataCache.h"
+#include "PlayFabCatalogCache.h"
+#include "PlayFabStatisticsAggregator.h"
+#include "PlayFabUserDataWriteBuffer.h"
+#include "PlayFabTelemetryPipeline.h"
 #include <PlayFabComboSdk/PlayFabError.h>
 #include <PlayFabClientApi.h>
 
@@ -17,6 +27,9 @@
 
 namespace PlayFabComboSdk
 {
+    // How long the shutdown flush waits for telemetry in flight to complete before sending the next round
+    static const int ShutdownFlushRoundMs = 10;
+
     static void ExampleGlobalErrorHandler(const PlayFabError& error, void* customData)
     {
         AZ_TracePrintf("PlayFab", "==================================================================");
@@ -48,6 +61,11 @@ namespace PlayFabComboSdk
             // Push results of [MyComponent]::CreateDescriptor() into m_descriptors here.
             m_descriptors.insert(m_descriptors.end(), {
                 PlayFabCombo_SettingsSysComponent::CreateDescriptor(),
+                PlayFabCombo_TitleDataSysComponent::CreateDescriptor(),
+                PlayFabCombo_CatalogSysComponent::CreateDescriptor(),
+                PlayFabCombo_StatisticsSysComponent::CreateDescriptor(),
+                PlayFabCombo_UserDataSysComponent::CreateDescriptor(),
+                PlayFabCombo_TelemetrySysComponent::CreateDescriptor(),
                 PlayFabCombo_AdminSysComponent::CreateDescriptor(),
                 PlayFabCombo_MatchmakerSysComponent::CreateDescriptor(),
                 PlayFabCombo_ServerSysComponent::CreateDescriptor(),
@@ -63,6 +81,11 @@ namespace PlayFabComboSdk
         {
             return AZ::ComponentTypeList{
                 azrtti_typeid<PlayFabCombo_SettingsSysComponent>(),
+                azrtti_typeid<PlayFabCombo_TitleDataSysComponent>(),
+                azrtti_typeid<PlayFabCombo_CatalogSysComponent>(),
+                azrtti_typeid<PlayFabCombo_StatisticsSysComponent>(),
+                azrtti_typeid<PlayFabCombo_UserDataSysComponent>(),
+                azrtti_typeid<PlayFabCombo_TelemetrySysComponent>(),
                 azrtti_typeid<PlayFabCombo_AdminSysComponent>(),
                 azrtti_typeid<PlayFabCombo_MatchmakerSysComponent>(),
                 azrtti_typeid<PlayFabCombo_ServerSysComponent>(),
@@ -82,9 +105,124 @@ namespace PlayFabComboSdk
             {
                 // Initialise the settings
                 PlayFabSettings::playFabSettings = new PlayFabSettings();
+
+                // Optional http tuning, which must be set before the request manager starts
+                auto maxConnectionsCvar = gEnv->pConsole->GetCVar("playfab_http_max_connections");
+                if (maxConnectionsCvar)
+                    PlayFabSettings::playFabSettings->httpMaxConnections = maxConnectionsCvar->GetIVal();
+                auto idleTimeoutCvar = gEnv->pConsole->GetCVar("playfab_http_idle_timeout_ms");
+                if (idleTimeoutCvar)
+                    PlayFabSettings::playFabSettings->httpIdleTimeoutMs = idleTimeoutCvar->GetIVal();
+                auto workerThreadsCvar = gEnv->pConsole->GetCVar("playfab_http_worker_threads");
+                if (workerThreadsCvar)
+                    PlayFabSettings::playFabSettings->httpWorkerThreads = workerThreadsCvar->GetIVal();
+                auto backgroundMaxWaitCvar = gEnv->pConsole->GetCVar("playfab_http_background_max_wait_ms");
+                if (backgroundMaxWaitCvar)
+                    PlayFabSettings::playFabSettings->httpBackgroundMaxWaitMs = backgroundMaxWaitCvar->GetIVal();
+                auto maxRetriesCvar = gEnv->pConsole->GetCVar("playfab_http_max_retries");
+                if (maxRetriesCvar)
+                    PlayFabSettings::playFabSettings->httpMaxRetries = maxRetriesCvar->GetIVal();
+                auto retryBaseDelayCvar = gEnv->pConsole->GetCVar("playfab_http_retry_base_delay_ms");
+                if (retryBaseDelayCvar)
+                    PlayFabSettings::playFabSettings->httpRetryBaseDelayMs = retryBaseDelayCvar->GetIVal();
+                auto retryMaxDelayCvar = gEnv->pConsole->GetCVar("playfab_http_retry_max_delay_ms");
+                if (retryMaxDelayCvar)
+                    PlayFabSettings::playFabSettings->httpRetryMaxDelayMs = retryMaxDelayCvar->GetIVal();
+                auto retryBudgetCvar = gEnv->pConsole->GetCVar("playfab_http_retry_budget_percent");
+                if (retryBudgetCvar)
+                    PlayFabSettings::playFabSettings->httpRetryBudgetPercent = retryBudgetCvar->GetIVal();
+
+                // Optional body compression
+                auto compressRequestsCvar = gEnv->pConsole->GetCVar("playfab_http_compress_requests");
+                if (compressRequestsCvar)
+                    PlayFabSettings::playFabSettings->httpCompressRequests = compressRequestsCvar->GetIVal() != 0;
+                auto compressionThresholdCvar = gEnv->pConsole->GetCVar("playfab_http_compression_threshold");
+                if (compressionThresholdCvar)
+                    PlayFabSettings::playFabSettings->httpCompressionThreshold = compressionThresholdCvar->GetIVal();
+                auto acceptCompressedCvar = gEnv->pConsole->GetCVar("playfab_http_accept_compressed");
+                if (acceptCompressedCvar)
+                    PlayFabSettings::playFabSettings->httpAcceptCompressedResponses = acceptCompressedCvar->GetIVal() != 0;
+
+                // Optional streaming response decode
+                auto streamingDecodeCvar = gEnv->pConsole->GetCVar("playfab_json_streaming_decode");
+                if (streamingDecodeCvar)
+                    PlayFabSettings::playFabSettings->jsonStreamingDecode = streamingDecodeCvar->GetIVal() != 0;
+
+                // Optional client side rate limiting
+                auto rateLimitCvar = gEnv->pConsole->GetCVar("playfab_rate_limit_per_second");
+                if (rateLimitCvar)
+                    PlayFabSettings::playFabSettings->rateLimitTitlePerSecond = rateLimitCvar->GetFVal();
+                auto rateLimitBurstCvar = gEnv->pConsole->GetCVar("playfab_rate_limit_burst");
+                if (rateLimitBurstCvar)
+                    PlayFabSettings::playFabSettings->rateLimitTitleBurst = rateLimitBurstCvar->GetFVal();
+                auto rateLimitMaxDelayCvar = gEnv->pConsole->GetCVar("playfab_rate_limit_max_delay_ms");
+                if (rateLimitMaxDelayCvar)
+                    PlayFabSettings::playFabSettings->rateLimitMaxDelayMs = rateLimitMaxDelayCvar->GetIVal();
+
+                // Optional main thread callback delivery
+                auto callbacksOnMainThreadCvar = gEnv->pConsole->GetCVar("playfab_callbacks_main_thread");
+                if (callbacksOnMainThreadCvar)
+                    PlayFabSettings::playFabSettings->callbacksOnMainThread = callbacksOnMainThreadCvar->GetIVal() != 0;
+                auto callbackBudgetCvar = gEnv->pConsole->GetCVar("playfab_callback_budget_us");
+                if (callbackBudgetCvar)
+                    PlayFabSettings::playFabSettings->callbackBudgetUs = callbackBudgetCvar->GetIVal();
+
                 // Start the http request manager thread
                 PlayFabRequestManager::playFabHttp = new PlayFabRequestManager();
 
+                // Title data cache, which fetches nothing until a source is started through the title data bus
+                auto titleDataRefreshCvar = gEnv->pConsole->GetCVar("playfab_title_data_refresh_seconds");
+                if (titleDataRefreshCvar)
+                    PlayFabSettings::playFabSettings->titleDataRefreshSeconds = titleDataRefreshCvar->GetIVal();
+                PlayFabTitleDataCache::titleDataCache = new PlayFabTitleDataCache(&PlayFabCombo_TitleDataSysComponent::FetchTitleData, PlayFabSettings::playFabSettings->titleDataRefreshSeconds);
+
+                // Catalog cache, which fetches nothing until a catalog version is started through the catalog bus
+                auto catalogRefreshCvar = gEnv->pConsole->GetCVar("playfab_catalog_refresh_seconds");
+                if (catalogRefreshCvar)
+                    PlayFabSettings::playFabSettings->catalogRefreshSeconds = catalogRefreshCvar->GetIVal();
+                PlayFabCatalogCache::catalogCache = new PlayFabCatalogCache(&PlayFabCombo_CatalogSysComponent::FetchCatalog, PlayFabSettings::playFabSettings->catalogRefreshSeconds);
+
+                // Statistics aggregator, which sends nothing until updates are queued through the statistics bus
+                auto statisticsFlushCvar = gEnv->pConsole->GetCVar("playfab_statistics_flush_seconds");
+                if (statisticsFlushCvar)
+                    PlayFabSettings::playFabSettings->statisticsFlushSeconds = statisticsFlushCvar->GetIVal();
+                PlayFabStatisticsAggregator::statisticsAggregator = new PlayFabStatisticsAggregator(&PlayFabCombo_StatisticsSysComponent::SendStatistics, PlayFabSettings::playFabSettings->statisticsFlushSeconds);
+
+                // User data write buffer, which sends nothing until changes are queued through the user data bus
+                auto userDataFlushCvar = gEnv->pConsole->GetCVar("playfab_user_data_flush_seconds");
+                if (userDataFlushCvar)
+                    PlayFabSettings::playFabSettings->userDataFlushSeconds = userDataFlushCvar->GetIVal();
+                auto userDataMaxKeysCvar = gEnv->pConsole->GetCVar("playfab_user_data_max_keys_per_request");
+                if (userDataMaxKeysCvar)
+                    PlayFabSettings::playFabSettings->userDataMaxKeysPerRequest = userDataMaxKeysCvar->GetIVal();
+                PlayFabUserDataWriteBuffer::userDataWriteBuffer = new PlayFabUserDataWriteBuffer(&PlayFabCombo_UserDataSysComponent::SendUserData, PlayFabSettings::playFabSettings->userDataFlushSeconds, PlayFabSettings::playFabSettings->userDataMaxKeysPerRequest);
+
+                // Telemetry pipeline, whose flusher sends nothing until events are queued through the telemetry bus
+                auto telemetryCapacityCvar = gEnv->pConsole->GetCVar("playfab_telemetry_capacity");
+                if (telemetryCapacityCvar)
+                    PlayFabSettings::playFabSettings->telemetryCapacity = telemetryCapacityCvar->GetIVal();
+                auto telemetryRateCvar = gEnv->pConsole->GetCVar("playfab_telemetry_events_per_second");
+                if (telemetryRateCvar)
+                    PlayFabSettings::playFabSettings->telemetryEventsPerSecond = telemetryRateCvar->GetFVal();
+                auto telemetryMaxInFlightCvar = gEnv->pConsole->GetCVar("playfab_telemetry_max_in_flight");
+                if (telemetryMaxInFlightCvar)
+                    PlayFabSettings::playFabSettings->telemetryMaxInFlight = telemetryMaxInFlightCvar->GetIVal();
+                auto telemetryDropPolicyCvar = gEnv->pConsole->GetCVar("playfab_telemetry_drop_policy");
+                if (telemetryDropPolicyCvar)
+                    PlayFabSettings::playFabSettings->telemetryDropPolicy = telemetryDropPolicyCvar->GetIVal();
+                auto telemetrySampleRateCvar = gEnv->pConsole->GetCVar("playfab_telemetry_sample_rate");
+                if (telemetrySampleRateCvar)
+                    PlayFabSettings::playFabSettings->telemetrySampleRate = telemetrySampleRateCvar->GetIVal();
+                PlayFabTelemetryPipeline::telemetryPipeline = new PlayFabTelemetryPipeline(&PlayFabCombo_TelemetrySysComponent::SendTelemetryEvent, PlayFabSettings::playFabSettings->telemetryCapacity,
+                    PlayFabSettings::playFabSettings->telemetryEventsPerSecond, PlayFabSettings::playFabSettings->telemetryMaxInFlight,
+                    PlayFabSettings::playFabSettings->telemetryDropPolicy == PlayFabTelemetrySample ? PlayFabTelemetrySample : PlayFabTelemetryDropOldest, PlayFabSettings::playFabSettings->telemetrySampleRate);
+                PlayFabTelemetryPipeline::telemetryPipeline->StartFlusher();
+
+                // How long shutdown waits for the final flush of the write buffers
+                auto shutdownFlushWaitCvar = gEnv->pConsole->GetCVar("playfab_shutdown_flush_wait_ms");
+                if (shutdownFlushWaitCvar)
+                    PlayFabSettings::playFabSettings->shutdownFlushWaitMs = shutdownFlushWaitCvar->GetIVal();
+
                 // Set the game title id
                 auto titleIdCvar = gEnv->pConsole->GetCVar("playfab_title_id");
                 if (titleIdCvar)
@@ -104,12 +242,38 @@ namespace PlayFabComboSdk
             case ESYSTEM_EVENT_FAST_SHUTDOWN:
                 // #THIRD_KIND_PLAYFAB_SHUTDOWN_FIXES: - Changed statics to pointers, so they can be deleted before the system allocator is destroyed.
 
-                // Log out and clear the auth token
+                // The telemetry flusher thread sends through the request manager, so it stops first
+                if (PlayFabTelemetryPipeline::telemetryPipeline)
+                    PlayFabTelemetryPipeline::telemetryPipeline->StopFlusher();
+
+                // Send the statistics, user data and telemetry still waiting in their buffers, while the request manager can still deliver them
+                if (PlayFabStatisticsAggregator::statisticsAggregator && PlayFabUserDataWriteBuffer::userDataWriteBuffer && PlayFabTelemetryPipeline::telemetryPipeline && PlayFabRequestManager::playFabHttp)
+                {
+                    PlayFabStatisticsAggregator::statisticsAggregator->FlushAll();
+                    PlayFabUserDataWriteBuffer::userDataWriteBuffer->FlushAll();
+
+                    // Telemetry keeps to its in flight limit, so it is sent in rounds as earlier events complete, within the same wait
+                    auto deadline = AZStd::chrono::system_clock::now() + AZStd::chrono::milliseconds(PlayFabSettings::playFabSettings->shutdownFlushWaitMs);
+                    while (!PlayFabTelemetryPipeline::telemetryPipeline->Flush() && AZStd::chrono::system_clock::now() < deadline)
+                        PlayFabRequestManager::playFabHttp->WaitForPendingCalls(ShutdownFlushRoundMs);
+                    int remainingMs = static_cast<int>(AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(deadline - AZStd::chrono::system_clock::now()).count());
+                    if (!PlayFabRequestManager::playFabHttp->WaitForPendingCalls(AZStd::GetMax(remainingMs, 0)))
+                        AZ_TracePrintf("PlayFab", "*** PlayFab Requests were still pending after waiting %d ms at shutdown, and have been dropped", PlayFabSettings::playFabSettings->shutdownFlushWaitMs);
+                }
+
+                // Log out and clear the auth token, after the flush so telemetry written as the player can still be sent
                 PlayFabClientApi::ForgetClientCredentials();
 
                 // Shut down the http handler thread
                 SAFE_DELETE(PlayFabRequestManager::playFabHttp);
 
+                // After the request manager, so no fetch can complete into a deleted cache
+                SAFE_DELETE(PlayFabTitleDataCache::titleDataCache);
+                SAFE_DELETE(PlayFabCatalogCache::catalogCache);
+                SAFE_DELETE(PlayFabStatisticsAggregator::statisticsAggregator);
+                SAFE_DELETE(PlayFabUserDataWriteBuffer::userDataWriteBuffer);
+                SAFE_DELETE(PlayFabTelemetryPipeline::telemetryPipeline);
+
                 // Destroy the settings
                 SAFE_DELETE(PlayFabSettings::playFabSettings);
 
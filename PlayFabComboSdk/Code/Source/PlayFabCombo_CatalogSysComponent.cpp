@@ -0,0 +1,148 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabCombo_CatalogSysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabClientApi.h"
+#include "PlayFabSettings.h"
+#include "PlayFabCatalogCache.h"
+#include <PlayFabComboSdk/PlayFabLazyModel.h>
+
+namespace PlayFabComboSdk
+{
+    // Fetch results, delivered to the cache which is deleted only after the request manager. customData is the catalog version, allocated for the fetch.
+    static void OnCatalogFetched(const PlayFabLazyModel<ServerModels::GetCatalogItemsResult>& result, void* customData)
+    {
+        // Decoded straight into a model the cache takes the items from, rather than copying them out of a shared result
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        ServerModels::GetCatalogItemsResult decoded;
+        result.Decode(decoded);
+        PlayFabCatalogCache::catalogCache->ApplyFetchResult(*catalogVersion, AZStd::move(decoded.Catalog));
+        delete catalogVersion;
+    }
+
+    static void OnClientCatalogFetched(const PlayFabLazyModel<ClientModels::GetCatalogItemsResult>& result, void* customData)
+    {
+        // The client and server catalog items have the same json, so the client response decodes into the server models the cache keeps
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        ServerModels::GetCatalogItemsResult decoded;
+        result.Decode(decoded);
+        PlayFabCatalogCache::catalogCache->ApplyFetchResult(*catalogVersion, AZStd::move(decoded.Catalog));
+        delete catalogVersion;
+    }
+
+    static void OnCatalogFetchFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        PlayFabCatalogCache::catalogCache->ApplyFetchFailure(*catalogVersion);
+        delete catalogVersion;
+    }
+
+    void PlayFabCombo_CatalogSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabCombo_CatalogSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabCombo_CatalogSysComponent>("PlayFabCombo_Catalog", "Provides cached, indexed catalogs within the PlayFab Combo SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabCombo_CatalogSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabCombo_CatalogService"));
+    }
+
+    void PlayFabCombo_CatalogSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabCombo_CatalogService"));
+    }
+
+    void PlayFabCombo_CatalogSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabCombo_CatalogSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabCombo_CatalogSysComponent::Init()
+    {
+    }
+
+    void PlayFabCombo_CatalogSysComponent::Activate()
+    {
+        PlayFabCombo_CatalogRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabCombo_CatalogSysComponent::Deactivate()
+    {
+        PlayFabCombo_CatalogRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabCombo_CatalogSysComponent::FetchCatalog(const AZStd::string& catalogVersion)
+    {
+        // Without the server secret key, the catalog is read as the logged in player
+        if (PlayFabSettings::playFabSettings->developerSecretKey.empty())
+        {
+            ClientModels::GetCatalogItemsRequest clientRequest;
+            clientRequest.CatalogVersion = catalogVersion;
+            PlayFabClientApi::GetCatalogItemsLazy(clientRequest, OnClientCatalogFetched, OnCatalogFetchFailed, new AZStd::string(catalogVersion), PlayFabRequestPriorityBackground);
+            return true;
+        }
+
+        ServerModels::GetCatalogItemsRequest request;
+        request.CatalogVersion = catalogVersion;
+
+        // Nothing is waiting on a refresh, the cache keeps serving the previous snapshot
+        PlayFabServerApi::GetCatalogItemsLazy(request, OnCatalogFetched, OnCatalogFetchFailed, new AZStd::string(catalogVersion), PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabCombo_CatalogSysComponent::StartCatalogCache(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Start(catalogVersion);
+    }
+
+    void PlayFabCombo_CatalogSysComponent::StopCatalogCache(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Stop(catalogVersion);
+    }
+
+    void PlayFabCombo_CatalogSysComponent::RefreshCatalog(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Refresh(catalogVersion);
+    }
+
+    void PlayFabCombo_CatalogSysComponent::SetCatalogRefreshInterval(int seconds)
+    {
+        PlayFabCatalogCache::catalogCache->SetRefreshInterval(seconds);
+    }
+
+    PlayFabCatalogSnapshotPtr PlayFabCombo_CatalogSysComponent::GetCatalogSnapshot(const char* catalogVersion)
+    {
+        return PlayFabCatalogCache::catalogCache->GetSnapshot(catalogVersion);
+    }
+
+    PlayFabCatalogCacheStats PlayFabCombo_CatalogSysComponent::GetCatalogCacheStats(AZStd::string catalogVersion)
+    {
+        return PlayFabCatalogCache::catalogCache->GetStats(catalogVersion);
+    }
+}
@@ -0,0 +1,42 @@
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabComboSdk/PlayFabCombo_Catalogbus.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_CatalogSysComponent
+        : public AZ::Component
+        , protected PlayFabCombo_CatalogRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabCombo_CatalogSysComponent, "{525A86F9-CFF4-4868-A55F-24F5E76823C2}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabCatalogCache::FetchFunction for this gem's apis
+        static bool FetchCatalog(const AZStd::string& catalogVersion);
+
+        void StartCatalogCache(AZStd::string catalogVersion) override;
+        void StopCatalogCache(AZStd::string catalogVersion) override;
+        void RefreshCatalog(AZStd::string catalogVersion) override;
+        void SetCatalogRefreshInterval(int seconds) override;
+        PlayFabCatalogSnapshotPtr GetCatalogSnapshot(const char* catalogVersion) override;
+        PlayFabCatalogCacheStats GetCatalogCacheStats(AZStd::string catalogVersion) override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
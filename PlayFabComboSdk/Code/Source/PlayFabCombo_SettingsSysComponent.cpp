@@ -7,6 +7,7 @@
 #include "PlayFabCombo_SettingsSysComponent.h"
 
 #include "PlayFabSettings.h"
+#include "PlayFabRateLimiter.h"
 
 namespace PlayFabComboSdk
 {
@@ -91,4 +92,25 @@ namespace PlayFabComboSdk
         return PlayFabSettings::playFabSettings->developerSecretKey;
     }
 
+    // Rate limit Section
+    void PlayFabCombo_SettingsSysComponent::SetTitleRateLimit(float ratePerSecond, float burst)
+    {
+        PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetTitleLimit(ratePerSecond, burst);
+    }
+
+    void PlayFabCombo_SettingsSysComponent::SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst)
+    {
+        PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetEndpointLimit(callPath, ratePerSecond, burst);
+    }
+
+    PlayFabRateLimitState PlayFabCombo_SettingsSysComponent::GetTitleRateLimitState()
+    {
+        return PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetTitleState();
+    }
+
+    PlayFabRateLimitState PlayFabCombo_SettingsSysComponent::GetEndpointRateLimitState(AZStd::string callPath)
+    {
+        return PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetEndpointState(callPath);
+    }
+
 }
@@ -31,6 +31,12 @@ namespace PlayFabComboSdk
         void SetDevSecretKey(AZStd::string newSecretKey) override;
         AZStd::string GetDevSecretKey() override;
 
+        // Rate limit Section
+        void SetTitleRateLimit(float ratePerSecond, float burst) override;
+        void SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst) override;
+        PlayFabRateLimitState GetTitleRateLimitState() override;
+        PlayFabRateLimitState GetEndpointRateLimitState(AZStd::string callPath) override;
+
     protected:
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
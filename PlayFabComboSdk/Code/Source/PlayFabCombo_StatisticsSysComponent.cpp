@@ -0,0 +1,133 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabCombo_StatisticsSysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabAdminApi.h"
+#include "PlayFabStatisticsAggregator.h"
+
+namespace PlayFabComboSdk
+{
+    // Delivered to the aggregator, which is deleted only after the request manager. customData is the request as sent, so the aggregator can merge it back if it fails.
+    static void OnStatisticsSent(const ServerModels::UpdatePlayerStatisticsResult& result, void* customData)
+    {
+        (void)result;
+        ServerModels::UpdatePlayerStatisticsRequest* request = static_cast<ServerModels::UpdatePlayerStatisticsRequest*>(customData);
+        PlayFabStatisticsAggregator::statisticsAggregator->OnSendCompleted(*request, true);
+        delete request;
+    }
+
+    static void OnStatisticsSendFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        ServerModels::UpdatePlayerStatisticsRequest* request = static_cast<ServerModels::UpdatePlayerStatisticsRequest*>(customData);
+        PlayFabStatisticsAggregator::statisticsAggregator->OnSendCompleted(*request, false);
+        delete request;
+    }
+
+    static void OnStatisticDefinitionsFetched(const AdminModels::GetPlayerStatisticDefinitionsResult& result, void* customData)
+    {
+        (void)customData;
+        PlayFabStatisticsAggregator::statisticsAggregator->SetAggregations(result.Statistics);
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabCombo_StatisticsSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabCombo_StatisticsSysComponent>("PlayFabCombo_Statistics", "Aggregates player statistic updates into batched calls within the PlayFab Combo SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabCombo_StatisticsService"));
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabCombo_StatisticsService"));
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::Init()
+    {
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::Activate()
+    {
+        PlayFabCombo_StatisticsRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::Deactivate()
+    {
+        PlayFabCombo_StatisticsRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabCombo_StatisticsSysComponent::SendStatistics(ServerModels::UpdatePlayerStatisticsRequest& request)
+    {
+        ServerModels::UpdatePlayerStatisticsRequest* sent = new ServerModels::UpdatePlayerStatisticsRequest(request);
+        PlayFabServerApi::UpdatePlayerStatistics(AZStd::move(request), OnStatisticsSent, OnStatisticsSendFailed, sent, PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::QueueStatisticUpdate(AZStd::string playFabId, ServerModels::StatisticUpdate update)
+    {
+        PlayFabStatisticsAggregator::statisticsAggregator->Queue(playFabId, update);
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::SetStatisticAggregation(AZStd::string statisticName, AdminModels::StatisticAggregationMethod method)
+    {
+        PlayFabStatisticsAggregator::statisticsAggregator->SetAggregation(statisticName, method);
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::LoadStatisticAggregations()
+    {
+        PlayFabAdminApi::GetPlayerStatisticDefinitions(OnStatisticDefinitionsFetched, nullptr, nullptr, PlayFabRequestPriorityBackground);
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::FlushStatistics(AZStd::string playFabId)
+    {
+        PlayFabStatisticsAggregator::statisticsAggregator->Flush(playFabId);
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::FlushAllStatistics()
+    {
+        PlayFabStatisticsAggregator::statisticsAggregator->FlushAll();
+    }
+
+    void PlayFabCombo_StatisticsSysComponent::SetStatisticsFlushInterval(int seconds)
+    {
+        PlayFabStatisticsAggregator::statisticsAggregator->SetFlushInterval(seconds);
+    }
+
+    PlayFabStatisticsAggregatorStats PlayFabCombo_StatisticsSysComponent::GetStatisticsAggregatorStats()
+    {
+        return PlayFabStatisticsAggregator::statisticsAggregator->GetStats();
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabComboSdk/PlayFabCombo_Statisticsbus.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_StatisticsSysComponent
+        : public AZ::Component
+        , protected PlayFabCombo_StatisticsRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabCombo_StatisticsSysComponent, "{525A86F9-CFF4-4868-A55F-24F5E76823C3}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabStatisticsAggregator::SendFunction for this gem's apis
+        static bool SendStatistics(ServerModels::UpdatePlayerStatisticsRequest& request);
+
+        void QueueStatisticUpdate(AZStd::string playFabId, ServerModels::StatisticUpdate update) override;
+        void SetStatisticAggregation(AZStd::string statisticName, AdminModels::StatisticAggregationMethod method) override;
+        void LoadStatisticAggregations() override;
+        void FlushStatistics(AZStd::string playFabId) override;
+        void FlushAllStatistics() override;
+        void SetStatisticsFlushInterval(int seconds) override;
+        PlayFabStatisticsAggregatorStats GetStatisticsAggregatorStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
@@ -0,0 +1,196 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabCombo_TelemetrySysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabClientApi.h"
+#include "PlayFabSettings.h"
+#include "PlayFabTelemetryPipeline.h"
+
+namespace PlayFabComboSdk
+{
+    // Delivered to the telemetry pipeline, which is deleted only after the request manager
+    static void OnTelemetryEventSent(const ServerModels::WriteEventResponse& result, void* customData)
+    {
+        (void)result;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(true);
+    }
+
+    static void OnClientTelemetryEventSent(const ClientModels::WriteEventResponse& result, void* customData)
+    {
+        (void)result;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(true);
+    }
+
+    static void OnTelemetryEventSendFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(false);
+    }
+
+    static bool SendClientTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        switch (event.type)
+        {
+        case PlayFabTelemetryPlayerEvent:
+        {
+            ClientModels::WriteClientPlayerEventRequest request;
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabClientApi::WritePlayerEvent(AZStd::move(request), OnClientTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryCharacterEvent:
+        {
+            ClientModels::WriteClientCharacterEventRequest request;
+            request.CharacterId = AZStd::move(event.characterId);
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabClientApi::WriteCharacterEvent(AZStd::move(request), OnClientTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryTitleEvent:
+        {
+            ClientModels::WriteTitleEventRequest request;
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabClientApi::WriteTitleEvent(AZStd::move(request), OnClientTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabCombo_TelemetrySysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabCombo_TelemetrySysComponent>("PlayFabCombo_Telemetry", "Buffers and rate limits telemetry events within the PlayFab Combo SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabCombo_TelemetryService"));
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabCombo_TelemetryService"));
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::Init()
+    {
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::Activate()
+    {
+        PlayFabCombo_TelemetryRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::Deactivate()
+    {
+        PlayFabCombo_TelemetryRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabCombo_TelemetrySysComponent::SendTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        // Without the server secret key, player and character events are written for the logged in player
+        if (PlayFabSettings::playFabSettings->developerSecretKey.empty())
+            return SendClientTelemetryEvent(event);
+
+        switch (event.type)
+        {
+        case PlayFabTelemetryPlayerEvent:
+        {
+            ServerModels::WriteServerPlayerEventRequest request;
+            request.PlayFabId = AZStd::move(event.playFabId);
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabServerApi::WritePlayerEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryCharacterEvent:
+        {
+            ServerModels::WriteServerCharacterEventRequest request;
+            request.PlayFabId = AZStd::move(event.playFabId);
+            request.CharacterId = AZStd::move(event.characterId);
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabServerApi::WriteCharacterEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryTitleEvent:
+        {
+            ServerModels::WriteTitleEventRequest request;
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabServerApi::WriteTitleEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    bool PlayFabCombo_TelemetrySysComponent::QueueTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        return PlayFabTelemetryPipeline::telemetryPipeline->Queue(event);
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate)
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->SetDropPolicy(policy, sampleRate);
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::SetTelemetrySendRate(float eventsPerSecond)
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->SetSendRate(eventsPerSecond);
+    }
+
+    void PlayFabCombo_TelemetrySysComponent::FlushTelemetry()
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->Flush();
+    }
+
+    PlayFabTelemetryStats PlayFabCombo_TelemetrySysComponent::GetTelemetryStats()
+    {
+        return PlayFabTelemetryPipeline::telemetryPipeline->GetStats();
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabComboSdk/PlayFabCombo_Telemetrybus.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_TelemetrySysComponent
+        : public AZ::Component
+        , protected PlayFabCombo_TelemetryRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabCombo_TelemetrySysComponent, "{525A86F9-CFF4-4868-A55F-24F5E76823C5}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabTelemetryPipeline::SendFunction for this gem's apis
+        static bool SendTelemetryEvent(PlayFabTelemetryEvent& event);
+
+        bool QueueTelemetryEvent(PlayFabTelemetryEvent& event) override;
+        void SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate) override;
+        void SetTelemetrySendRate(float eventsPerSecond) override;
+        void FlushTelemetry() override;
+        PlayFabTelemetryStats GetTelemetryStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
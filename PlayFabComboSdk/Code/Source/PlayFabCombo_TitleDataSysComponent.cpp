@@ -0,0 +1,142 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabCombo_TitleDataSysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabClientApi.h"
+#include "PlayFabSettings.h"
+#include "PlayFabTitleDataCache.h"
+
+namespace PlayFabComboSdk
+{
+    // Fetch results, delivered to the cache which is deleted only after the request manager
+    static void OnTitleDataFetched(const ServerModels::GetTitleDataResult& result, void* customData)
+    {
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchResult(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)), result.Data);
+    }
+
+    static void OnClientTitleDataFetched(const ClientModels::GetTitleDataResult& result, void* customData)
+    {
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchResult(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)), result.Data);
+    }
+
+    static void OnTitleDataFetchFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchFailure(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)));
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabCombo_TitleDataSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabCombo_TitleDataSysComponent>("PlayFabCombo_TitleData", "Provides cached title data within the PlayFab Combo SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabCombo_TitleDataService"));
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabCombo_TitleDataService"));
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::Init()
+    {
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::Activate()
+    {
+        PlayFabCombo_TitleDataRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::Deactivate()
+    {
+        PlayFabCombo_TitleDataRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabCombo_TitleDataSysComponent::FetchTitleData(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys)
+    {
+        void* customData = reinterpret_cast<void*>(static_cast<intptr_t>(source));
+
+        // Without the server secret key, public title data is read as the logged in player, and internal title data cannot be read at all
+        if (PlayFabSettings::playFabSettings->developerSecretKey.empty())
+        {
+            if (source != PlayFabTitleDataPublic)
+                return false;
+            ClientModels::GetTitleDataRequest clientRequest;
+            clientRequest.Keys.assign(keys.begin(), keys.end());
+            PlayFabClientApi::GetTitleData(clientRequest, OnClientTitleDataFetched, OnTitleDataFetchFailed, customData, PlayFabRequestPriorityBackground);
+            return true;
+        }
+
+        ServerModels::GetTitleDataRequest request;
+        request.Keys.assign(keys.begin(), keys.end());
+
+        // Nothing is waiting on a refresh, the cache keeps serving the previous snapshot
+        if (source == PlayFabTitleDataPublic)
+            PlayFabServerApi::GetTitleData(request, OnTitleDataFetched, OnTitleDataFetchFailed, customData, PlayFabRequestPriorityBackground);
+        else
+            PlayFabServerApi::GetTitleInternalData(request, OnTitleDataFetched, OnTitleDataFetchFailed, customData, PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::StartTitleDataCache(PlayFabTitleDataSource source, AZStd::vector<AZStd::string> keys)
+    {
+        PlayFabTitleDataCache::titleDataCache->Start(source, keys);
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::StopTitleDataCache(PlayFabTitleDataSource source)
+    {
+        PlayFabTitleDataCache::titleDataCache->Stop(source);
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::RefreshTitleData(PlayFabTitleDataSource source)
+    {
+        PlayFabTitleDataCache::titleDataCache->Refresh(source);
+    }
+
+    void PlayFabCombo_TitleDataSysComponent::SetTitleDataRefreshInterval(int seconds)
+    {
+        PlayFabTitleDataCache::titleDataCache->SetRefreshInterval(seconds);
+    }
+
+    PlayFabTitleDataSnapshotPtr PlayFabCombo_TitleDataSysComponent::GetTitleDataSnapshot(PlayFabTitleDataSource source)
+    {
+        return PlayFabTitleDataCache::titleDataCache->GetSnapshot(source);
+    }
+
+    PlayFabTitleDataCacheStats PlayFabCombo_TitleDataSysComponent::GetTitleDataCacheStats(PlayFabTitleDataSource source)
+    {
+        return PlayFabTitleDataCache::titleDataCache->GetStats(source);
+    }
+}
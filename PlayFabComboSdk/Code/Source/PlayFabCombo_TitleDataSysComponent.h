@@ -0,0 +1,42 @@
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabComboSdk/PlayFabCombo_TitleDatabus.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_TitleDataSysComponent
+        : public AZ::Component
+        , protected PlayFabCombo_TitleDataRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabCombo_TitleDataSysComponent, "{525A86F9-CFF4-4868-A55F-24F5E76823C1}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabTitleDataCache::FetchFunction for this gem's apis
+        static bool FetchTitleData(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys);
+
+        void StartTitleDataCache(PlayFabTitleDataSource source, AZStd::vector<AZStd::string> keys) override;
+        void StopTitleDataCache(PlayFabTitleDataSource source) override;
+        void RefreshTitleData(PlayFabTitleDataSource source) override;
+        void SetTitleDataRefreshInterval(int seconds) override;
+        PlayFabTitleDataSnapshotPtr GetTitleDataSnapshot(PlayFabTitleDataSource source) override;
+        PlayFabTitleDataCacheStats GetTitleDataCacheStats(PlayFabTitleDataSource source) override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
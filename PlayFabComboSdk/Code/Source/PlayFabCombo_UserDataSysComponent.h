@@ -0,0 +1,40 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabComboSdk/PlayFabCombo_UserDatabus.h>
+
+namespace PlayFabComboSdk
+{
+    class PlayFabCombo_UserDataSysComponent
+        : public AZ::Component
+        , protected PlayFabCombo_UserDataRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabCombo_UserDataSysComponent, "{525A86F9-CFF4-4868-A55F-24F5E76823C4}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabUserDataWriteBuffer::SendFunction for this gem's apis
+        static bool SendUserData(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest& request);
+
+        void QueueUserDataUpdate(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest request) override;
+        void FlushUserData(AZStd::string playFabId) override;
+        void FlushAllUserData() override;
+        void SetUserDataFlushInterval(int seconds) override;
+        PlayFabUserDataWriteStats GetUserDataWriteStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
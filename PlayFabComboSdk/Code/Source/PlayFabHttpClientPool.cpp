@@ -0,0 +1,140 @@
+#include "StdAfx.h"
+#include "PlayFabHttpClientPool.h"
+
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabComboSdk;
+
+PlayFabHttpClientPool::PlayFabHttpClientPool(int maxConnectionsPerHost, int idleTimeoutMs)
+    : m_maxConnectionsPerHost(maxConnectionsPerHost > 0 ? maxConnectionsPerHost : 1)
+    , m_backgroundConnectionLimit(AZStd::GetMax(1, m_maxConnectionsPerHost - 1))
+    , m_idleTimeout(idleTimeoutMs)
+    , m_shutdown(false)
+    , m_stats()
+{
+}
+
+PlayFabHttpClientPool::~PlayFabHttpClientPool()
+{
+    Shutdown();
+}
+
+std::shared_ptr<Aws::Http::HttpClient> PlayFabHttpClientPool::AcquireClient(const AZStd::string& host, PlayFabRequestPriority priority)
+{
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_poolMutex);
+        EvictIdleClients(AZStd::chrono::system_clock::now());
+
+        HostPool& hostPool = m_hosts[host];
+        int connectionLimit = priority == PlayFabRequestPriorityBackground ? m_backgroundConnectionLimit : m_maxConnectionsPerHost;
+        hostPool.waitingCount[priority]++;
+        while (!m_shutdown)
+        {
+            bool higherPriorityWaiting = false;
+            for (int i = 0; i < priority; ++i)
+                higherPriorityWaiting = higherPriorityWaiting || hostPool.waitingCount[i] > 0;
+
+            // Idle clients are counted within the limit, so below it there is always either one to reuse or room for a new one
+            if (!higherPriorityWaiting && hostPool.activeCount < connectionLimit)
+            {
+                hostPool.waitingCount[priority]--;
+                hostPool.activeCount++;
+                if (!hostPool.idleClients.empty())
+                {
+                    std::shared_ptr<Aws::Http::HttpClient> client = hostPool.idleClients.back().client;
+                    hostPool.idleClients.pop_back();
+                    m_stats.reusedConnections++;
+                    return client;
+                }
+
+                // The slot is reserved, so do the (comparatively slow) client construction outside of the lock
+                m_stats.clientsCreated++;
+                break;
+            }
+
+            m_clientReleased.wait(lock);
+        }
+
+        if (m_shutdown)
+        {
+            hostPool.waitingCount[priority]--;
+            return nullptr;
+        }
+    }
+
+    Aws::Client::ClientConfiguration config;
+    config.maxConnections = 1; // Each pooled client owns exactly one keep-alive connection
+    return Aws::Http::CreateHttpClient(config);
+}
+
+void PlayFabHttpClientPool::ReleaseClient(const AZStd::string& host, const std::shared_ptr<Aws::Http::HttpClient>& client, bool healthy)
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_poolMutex);
+        HostPool& hostPool = m_hosts[host];
+        hostPool.activeCount--;
+
+        if (!healthy)
+            m_stats.droppedUnhealthyConnections++;
+        else if (client && !m_shutdown)
+        {
+            PooledClient pooled;
+            pooled.client = client;
+            pooled.lastUsed = AZStd::chrono::system_clock::now();
+            hostPool.idleClients.push_back(pooled);
+        }
+    }
+    // Every waiter, as the one allowed to take the connection depends on the priorities waiting
+    m_clientReleased.notify_all();
+}
+
+void PlayFabHttpClientPool::Shutdown()
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_poolMutex);
+        m_shutdown = true;
+        for (auto& hostPool : m_hosts)
+            hostPool.second.idleClients.clear();
+    }
+    m_clientReleased.notify_all();
+}
+
+PlayFabConnectionStats PlayFabHttpClientPool::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_poolMutex);
+    PlayFabConnectionStats stats = m_stats;
+    stats.activeConnections = 0;
+    stats.idleConnections = 0;
+    for (auto& hostPool : m_hosts)
+    {
+        stats.activeConnections += hostPool.second.activeCount;
+        stats.idleConnections += static_cast<int>(hostPool.second.idleClients.size());
+    }
+    return stats;
+}
+
+bool PlayFabHttpClientPool::IsHealthyResponse(const std::shared_ptr<Aws::Http::HttpResponse>& response)
+{
+    return response && static_cast<int>(response->GetResponseCode()) > 0;
+}
+
+void PlayFabHttpClientPool::EvictIdleClients(AZStd::chrono::system_clock::time_point now)
+{
+    for (auto& hostPool : m_hosts)
+    {
+        // Idle clients are kept in least-recently-used order, so expired ones are always at the front
+        AZStd::vector<PooledClient>& idleClients = hostPool.second.idleClients;
+        size_t expiredCount = 0;
+        while (expiredCount < idleClients.size() && now - idleClients[expiredCount].lastUsed > m_idleTimeout)
+            expiredCount++;
+
+        if (expiredCount > 0)
+        {
+            idleClients.erase(idleClients.begin(), idleClients.begin() + expiredCount);
+            m_stats.evictedIdleConnections += expiredCount;
+        }
+    }
+}
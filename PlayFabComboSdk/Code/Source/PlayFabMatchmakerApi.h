@@ -11,11 +11,18 @@ namespace PlayFabComboSdk
     public:
 
         // ------------ Generated Api calls
-        static void AuthUser(MatchmakerModels::AuthUserRequest& request, ProcessApiCallback<MatchmakerModels::AuthUserResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void PlayerJoined(MatchmakerModels::PlayerJoinedRequest& request, ProcessApiCallback<MatchmakerModels::PlayerJoinedResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void PlayerLeft(MatchmakerModels::PlayerLeftRequest& request, ProcessApiCallback<MatchmakerModels::PlayerLeftResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void StartGame(MatchmakerModels::StartGameRequest& request, ProcessApiCallback<MatchmakerModels::StartGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UserInfo(MatchmakerModels::UserInfoRequest& request, ProcessApiCallback<MatchmakerModels::UserInfoResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+        static void AuthUser(MatchmakerModels::AuthUserRequest& request, ProcessApiCallback<MatchmakerModels::AuthUserResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void PlayerJoined(MatchmakerModels::PlayerJoinedRequest& request, ProcessApiCallback<MatchmakerModels::PlayerJoinedResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void PlayerLeft(MatchmakerModels::PlayerLeftRequest& request, ProcessApiCallback<MatchmakerModels::PlayerLeftResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void StartGame(MatchmakerModels::StartGameRequest& request, ProcessApiCallback<MatchmakerModels::StartGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UserInfo(MatchmakerModels::UserInfoRequest& request, ProcessApiCallback<MatchmakerModels::UserInfoResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+
+        // ------------ Generated Api calls taking a temporary or moved request, which is serialized in place as the lvalue calls do
+        static void AuthUser(MatchmakerModels::AuthUserRequest&& request, ProcessApiCallback<MatchmakerModels::AuthUserResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AuthUser(request, callback, errorCallback, customData, priority); }
+        static void PlayerJoined(MatchmakerModels::PlayerJoinedRequest&& request, ProcessApiCallback<MatchmakerModels::PlayerJoinedResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { PlayerJoined(request, callback, errorCallback, customData, priority); }
+        static void PlayerLeft(MatchmakerModels::PlayerLeftRequest&& request, ProcessApiCallback<MatchmakerModels::PlayerLeftResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { PlayerLeft(request, callback, errorCallback, customData, priority); }
+        static void StartGame(MatchmakerModels::StartGameRequest&& request, ProcessApiCallback<MatchmakerModels::StartGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { StartGame(request, callback, errorCallback, customData, priority); }
+        static void UserInfo(MatchmakerModels::UserInfoRequest&& request, ProcessApiCallback<MatchmakerModels::UserInfoResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UserInfo(request, callback, errorCallback, customData, priority); }
 
     private:
         // ------------ Private constructor, to enforce all-static class
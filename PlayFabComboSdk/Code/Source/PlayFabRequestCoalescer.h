@@ -0,0 +1,31 @@
+#pragma once
+
+#include <PlayFabComboSdk/PlayFabHttp.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace PlayFabComboSdk
+{
+    // Single-flight for read apis: while a request is in flight, any byte-identical request (same url, auth and body)
+    // is attached to it instead of being sent, and receives the same decoded response through its own callbacks.
+    // This turns a crowd of players joining at once, each asking for the same title data, into a single http call.
+    class PlayFabRequestCoalescer
+    {
+    public:
+        // Allow-listed read apis, which have no side effects and no per-call tokens, so one response can serve every identical caller
+        static bool IsCoalescable(const AZStd::string& callPath);
+
+        // Attach the request to an identical one in flight and return true (it is then owned by that request),
+        // or return false after registering it to lead any identical requests which follow
+        bool JoinOrLead(PlayFabRequest* request);
+        // Stop attaching followers to a request whose response is about to be delivered. Its followers are in mFollowers.
+        void Finish(PlayFabRequest* request);
+
+        AZStd::unordered_map<AZStd::string, PlayFabCoalescingStats> GetStats(); // Keyed by api path
+
+    private:
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZStd::string, PlayFabRequest*> m_leaders; // Keyed by PlayFabRequest::mCoalesceKey
+        AZStd::unordered_map<AZStd::string, PlayFabCoalescingStats> m_stats;
+    };
+}
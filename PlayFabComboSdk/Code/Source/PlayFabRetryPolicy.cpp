@@ -0,0 +1,149 @@
+#include "StdAfx.h"
+#include "PlayFabRetryPolicy.h"
+
+#include <PlayFabComboSdk/PlayFabJsonReader.h>
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabComboSdk;
+
+// The budget is held in hundredths of a retry, and can bank up to this many retries for a burst of failures
+static const int MaxBudgetRetries = 10;
+
+PlayFabRetryPolicy::PlayFabRetryPolicy(int maxRetries, int baseDelayMs, int maxDelayMs, int budgetPercent)
+    : m_maxRetries(maxRetries)
+    , m_baseDelayMs(baseDelayMs > 0 ? baseDelayMs : 1)
+    , m_maxDelayMs(AZStd::GetMax(maxDelayMs, m_baseDelayMs))
+    , m_budgetPercent(budgetPercent)
+    , m_budget(MaxBudgetRetries * 100)
+    , m_random(std::random_device()())
+{
+}
+
+bool PlayFabRetryPolicy::IsIdempotent(const AZStd::string& callPath)
+{
+    size_t nameStart = callPath.rfind('/');
+    AZStd::string name = nameStart == AZStd::string::npos ? callPath : callPath.substr(nameStart + 1);
+    return name.find("Get") == 0
+        || name.find("Login") == 0
+        || name == "AuthenticateSessionTicket"
+        || name == "AuthUser"
+        || name == "RefreshGameServerInstanceHeartbeat";
+}
+
+bool PlayFabRetryPolicy::IsIdempotent(PlayFabRequest* request)
+{
+    if (!IsIdempotent(request->mCallPath))
+        return false;
+
+    // A login which may create the account is not: if the lost attempt created it, the retry logs in to it instead,
+    // and the caller never sees NewlyCreated and skips its first time setup
+    size_t nameStart = request->mCallPath.rfind('/');
+    if (request->mCallPath.compare(nameStart == AZStd::string::npos ? 0 : nameStart + 1, 5, "Login") != 0)
+        return true;
+    AZStd::string body(request->GetRequestBody(), request->GetRequestBodySize()); // Parsed in place, so a copy
+    PlayFabJsonReader reader;
+    if (!reader.Parse(&body[0]))
+        return false;
+    if (!reader.SeekMember("CreateAccount"))
+        return true;
+    const rapidjson::Value& createAccount = reader.GetValue();
+    return !createAccount.IsBool() || !createAccount.GetBool();
+}
+
+bool PlayFabRetryPolicy::IsTransientFailure(PlayFabRequest* request)
+{
+    if (!request->httpResponse)
+        return true; // The connection failed, nothing was received
+    if (request->mError != nullptr && request->mError->ErrorCode == PlayFabErrorResponseNotInflated)
+        return true; // Most likely cut short in transit
+
+    int httpCode = static_cast<int>(request->mHttpCode);
+    if (httpCode <= 0 || httpCode == 408 || httpCode == 429 || httpCode == 500 || httpCode == 502 || httpCode == 503 || httpCode == 504)
+        return true;
+
+    // PlayFab reports throttling and its own outages through the error code, not always the http status
+    if (request->mResponseSize != 0 && request->mResponseJson != nullptr && request->mResponseJson->GetParseError() == rapidjson::kParseErrorNone)
+    {
+        auto errorCodeJson = request->mResponseJson->FindMember("errorCode");
+        if (errorCodeJson != request->mResponseJson->MemberEnd() && errorCodeJson->value.IsNumber())
+        {
+            switch (errorCodeJson->value.GetInt())
+            {
+            case PlayFabErrorServiceUnavailable:
+            case PlayFabErrorDownstreamServiceUnavailable:
+            case PlayFabErrorAPIRequestLimitExceeded:
+            case PlayFabErrorAPIClientRequestRateLimitExceeded:
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void PlayFabRetryPolicy::OnNewRequest()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_budget = AZStd::GetMin(m_budget + m_budgetPercent, MaxBudgetRetries * 100);
+}
+
+bool PlayFabRetryPolicy::ShouldRetry(PlayFabRequest* request, int& delayMs)
+{
+    if (!IsTransientFailure(request) || !IsIdempotent(request))
+        return false;
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabRetryStats& stats = m_stats[request->mCallPath];
+    if (request->mRetryCount >= m_maxRetries)
+    {
+        stats.exhausted++;
+        return false;
+    }
+    if (m_budget < 100)
+    {
+        stats.budgetRejected++;
+        return false;
+    }
+
+    delayMs = NextDelayMs(request->mRetryDelayMs);
+    return true;
+}
+
+bool PlayFabRetryPolicy::CommitRetry(PlayFabRequest* request)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabRetryStats& stats = m_stats[request->mCallPath];
+    if (m_budget < 100)
+    {
+        stats.budgetRejected++;
+        return false;
+    }
+
+    m_budget -= 100;
+    stats.retries++;
+    return true;
+}
+
+void PlayFabRetryPolicy::RecordResult(PlayFabRequest* request)
+{
+    // A retried request which then failed for good, with a 400 or InvalidParams say, was not recovered. mHttpCode is only OK once a response arrived.
+    if (request->mRetryCount == 0 || request->mHttpCode != Aws::Http::HttpResponseCode::OK)
+        return;
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_stats[request->mCallPath].recovered++;
+}
+
+AZStd::unordered_map<AZStd::string, PlayFabRetryStats> PlayFabRetryPolicy::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+int PlayFabRetryPolicy::NextDelayMs(int previousDelayMs)
+{
+    int upper = AZStd::GetMin(AZStd::GetMax(previousDelayMs, m_baseDelayMs) * 3, m_maxDelayMs);
+    std::uniform_int_distribution<int> distribution(m_baseDelayMs, AZStd::GetMax(upper, m_baseDelayMs));
+    return distribution(m_random);
+}
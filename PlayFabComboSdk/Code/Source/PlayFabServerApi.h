@@ -3,6 +3,7 @@
 #include <PlayFabComboSdk/PlayFabError.h>
 #include <PlayFabComboSdk/PlayFabServerDataModels.h>
 #include <PlayFabComboSdk/PlayFabHttp.h>
+#include <PlayFabComboSdk/PlayFabLazyModel.h>
 
 namespace PlayFabComboSdk
 {
@@ -11,115 +12,228 @@ namespace PlayFabComboSdk
     public:
 
         // ------------ Generated Api calls
-        static void AuthenticateSessionTicket(ServerModels::AuthenticateSessionTicketRequest& request, ProcessApiCallback<ServerModels::AuthenticateSessionTicketResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetPlayerSecret(ServerModels::SetPlayerSecretRequest& request, ProcessApiCallback<ServerModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void BanUsers(ServerModels::BanUsersRequest& request, ProcessApiCallback<ServerModels::BanUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerProfile(ServerModels::GetPlayerProfileRequest& request, ProcessApiCallback<ServerModels::GetPlayerProfileResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromFacebookIDs(ServerModels::GetPlayFabIDsFromFacebookIDsRequest& request, ProcessApiCallback<ServerModels::GetPlayFabIDsFromFacebookIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayFabIDsFromSteamIDs(ServerModels::GetPlayFabIDsFromSteamIDsRequest& request, ProcessApiCallback<ServerModels::GetPlayFabIDsFromSteamIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserAccountInfo(ServerModels::GetUserAccountInfoRequest& request, ProcessApiCallback<ServerModels::GetUserAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserBans(ServerModels::GetUserBansRequest& request, ProcessApiCallback<ServerModels::GetUserBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RevokeAllBansForUser(ServerModels::RevokeAllBansForUserRequest& request, ProcessApiCallback<ServerModels::RevokeAllBansForUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RevokeBans(ServerModels::RevokeBansRequest& request, ProcessApiCallback<ServerModels::RevokeBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SendPushNotification(ServerModels::SendPushNotificationRequest& request, ProcessApiCallback<ServerModels::SendPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateAvatarUrl(ServerModels::UpdateAvatarUrlRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateBans(ServerModels::UpdateBansRequest& request, ProcessApiCallback<ServerModels::UpdateBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteUsers(ServerModels::DeleteUsersRequest& request, ProcessApiCallback<ServerModels::DeleteUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetFriendLeaderboard(ServerModels::GetFriendLeaderboardRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboard(ServerModels::GetLeaderboardRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboardAroundUser(ServerModels::GetLeaderboardAroundUserRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardAroundUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerCombinedInfo(ServerModels::GetPlayerCombinedInfoRequest& request, ProcessApiCallback<ServerModels::GetPlayerCombinedInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerStatistics(ServerModels::GetPlayerStatisticsRequest& request, ProcessApiCallback<ServerModels::GetPlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerStatisticVersions(ServerModels::GetPlayerStatisticVersionsRequest& request, ProcessApiCallback<ServerModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserInternalData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherInternalData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserPublisherReadOnlyData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserReadOnlyData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdatePlayerStatistics(ServerModels::UpdatePlayerStatisticsRequest& request, ProcessApiCallback<ServerModels::UpdatePlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserInternalData(ServerModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherInternalData(ServerModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserPublisherReadOnlyData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserReadOnlyData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCatalogItems(ServerModels::GetCatalogItemsRequest& request, ProcessApiCallback<ServerModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPublisherData(ServerModels::GetPublisherDataRequest& request, ProcessApiCallback<ServerModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTime(ProcessApiCallback<ServerModels::GetTimeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleData(ServerModels::GetTitleDataRequest& request, ProcessApiCallback<ServerModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleInternalData(ServerModels::GetTitleDataRequest& request, ProcessApiCallback<ServerModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetTitleNews(ServerModels::GetTitleNewsRequest& request, ProcessApiCallback<ServerModels::GetTitleNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetPublisherData(ServerModels::SetPublisherDataRequest& request, ProcessApiCallback<ServerModels::SetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetTitleData(ServerModels::SetTitleDataRequest& request, ProcessApiCallback<ServerModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetTitleInternalData(ServerModels::SetTitleDataRequest& request, ProcessApiCallback<ServerModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddCharacterVirtualCurrency(ServerModels::AddCharacterVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyCharacterVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddUserVirtualCurrency(ServerModels::AddUserVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ConsumeItem(ServerModels::ConsumeItemRequest& request, ProcessApiCallback<ServerModels::ConsumeItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void EvaluateRandomResultTable(ServerModels::EvaluateRandomResultTableRequest& request, ProcessApiCallback<ServerModels::EvaluateRandomResultTableResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterInventory(ServerModels::GetCharacterInventoryRequest& request, ProcessApiCallback<ServerModels::GetCharacterInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetRandomResultTables(ServerModels::GetRandomResultTablesRequest& request, ProcessApiCallback<ServerModels::GetRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetUserInventory(ServerModels::GetUserInventoryRequest& request, ProcessApiCallback<ServerModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GrantItemsToCharacter(ServerModels::GrantItemsToCharacterRequest& request, ProcessApiCallback<ServerModels::GrantItemsToCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GrantItemsToUser(ServerModels::GrantItemsToUserRequest& request, ProcessApiCallback<ServerModels::GrantItemsToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GrantItemsToUsers(ServerModels::GrantItemsToUsersRequest& request, ProcessApiCallback<ServerModels::GrantItemsToUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ModifyItemUses(ServerModels::ModifyItemUsesRequest& request, ProcessApiCallback<ServerModels::ModifyItemUsesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void MoveItemToCharacterFromCharacter(ServerModels::MoveItemToCharacterFromCharacterRequest& request, ProcessApiCallback<ServerModels::MoveItemToCharacterFromCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void MoveItemToCharacterFromUser(ServerModels::MoveItemToCharacterFromUserRequest& request, ProcessApiCallback<ServerModels::MoveItemToCharacterFromUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void MoveItemToUserFromCharacter(ServerModels::MoveItemToUserFromCharacterRequest& request, ProcessApiCallback<ServerModels::MoveItemToUserFromCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RedeemCoupon(ServerModels::RedeemCouponRequest& request, ProcessApiCallback<ServerModels::RedeemCouponResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ReportPlayer(ServerModels::ReportPlayerServerRequest& request, ProcessApiCallback<ServerModels::ReportPlayerServerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RevokeInventoryItem(ServerModels::RevokeInventoryItemRequest& request, ProcessApiCallback<ServerModels::RevokeInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SubtractCharacterVirtualCurrency(ServerModels::SubtractCharacterVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyCharacterVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SubtractUserVirtualCurrency(ServerModels::SubtractUserVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlockContainerInstance(ServerModels::UnlockContainerInstanceRequest& request, ProcessApiCallback<ServerModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UnlockContainerItem(ServerModels::UnlockContainerItemRequest& request, ProcessApiCallback<ServerModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateUserInventoryItemCustomData(ServerModels::UpdateUserInventoryItemDataRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddFriend(ServerModels::AddFriendRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetFriendsList(ServerModels::GetFriendsListRequest& request, ProcessApiCallback<ServerModels::GetFriendsListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveFriend(ServerModels::RemoveFriendRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetFriendTags(ServerModels::SetFriendTagsRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeregisterGame(ServerModels::DeregisterGameRequest& request, ProcessApiCallback<ServerModels::DeregisterGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void NotifyMatchmakerPlayerLeft(ServerModels::NotifyMatchmakerPlayerLeftRequest& request, ProcessApiCallback<ServerModels::NotifyMatchmakerPlayerLeftResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RedeemMatchmakerTicket(ServerModels::RedeemMatchmakerTicketRequest& request, ProcessApiCallback<ServerModels::RedeemMatchmakerTicketResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RefreshGameServerInstanceHeartbeat(ServerModels::RefreshGameServerInstanceHeartbeatRequest& request, ProcessApiCallback<ServerModels::RefreshGameServerInstanceHeartbeatResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RegisterGame(ServerModels::RegisterGameRequest& request, ProcessApiCallback<ServerModels::RegisterGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetGameServerInstanceData(ServerModels::SetGameServerInstanceDataRequest& request, ProcessApiCallback<ServerModels::SetGameServerInstanceDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetGameServerInstanceState(ServerModels::SetGameServerInstanceStateRequest& request, ProcessApiCallback<ServerModels::SetGameServerInstanceStateResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void SetGameServerInstanceTags(ServerModels::SetGameServerInstanceTagsRequest& request, ProcessApiCallback<ServerModels::SetGameServerInstanceTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void WriteCharacterEvent(ServerModels::WriteServerCharacterEventRequest& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void WritePlayerEvent(ServerModels::WriteServerPlayerEventRequest& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void WriteTitleEvent(ServerModels::WriteTitleEventRequest& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddSharedGroupMembers(ServerModels::AddSharedGroupMembersRequest& request, ProcessApiCallback<ServerModels::AddSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void CreateSharedGroup(ServerModels::CreateSharedGroupRequest& request, ProcessApiCallback<ServerModels::CreateSharedGroupResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteSharedGroup(ServerModels::DeleteSharedGroupRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetSharedGroupData(ServerModels::GetSharedGroupDataRequest& request, ProcessApiCallback<ServerModels::GetSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemoveSharedGroupMembers(ServerModels::RemoveSharedGroupMembersRequest& request, ProcessApiCallback<ServerModels::RemoveSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateSharedGroupData(ServerModels::UpdateSharedGroupDataRequest& request, ProcessApiCallback<ServerModels::UpdateSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void ExecuteCloudScript(ServerModels::ExecuteCloudScriptServerRequest& request, ProcessApiCallback<ServerModels::ExecuteCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetContentDownloadUrl(ServerModels::GetContentDownloadUrlRequest& request, ProcessApiCallback<ServerModels::GetContentDownloadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void DeleteCharacterFromUser(ServerModels::DeleteCharacterFromUserRequest& request, ProcessApiCallback<ServerModels::DeleteCharacterFromUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAllUsersCharacters(ServerModels::ListUsersCharactersRequest& request, ProcessApiCallback<ServerModels::ListUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterLeaderboard(ServerModels::GetCharacterLeaderboardRequest& request, ProcessApiCallback<ServerModels::GetCharacterLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterStatistics(ServerModels::GetCharacterStatisticsRequest& request, ProcessApiCallback<ServerModels::GetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboardAroundCharacter(ServerModels::GetLeaderboardAroundCharacterRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardAroundCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetLeaderboardForUserCharacters(ServerModels::GetLeaderboardForUsersCharactersRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardForUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GrantCharacterToUser(ServerModels::GrantCharacterToUserRequest& request, ProcessApiCallback<ServerModels::GrantCharacterToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCharacterStatistics(ServerModels::UpdateCharacterStatisticsRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterData(ServerModels::GetCharacterDataRequest& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterInternalData(ServerModels::GetCharacterDataRequest& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetCharacterReadOnlyData(ServerModels::GetCharacterDataRequest& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCharacterData(ServerModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCharacterInternalData(ServerModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void UpdateCharacterReadOnlyData(ServerModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AddPlayerTag(ServerModels::AddPlayerTagRequest& request, ProcessApiCallback<ServerModels::AddPlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAllActionGroups(ProcessApiCallback<ServerModels::GetAllActionGroupsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetAllSegments(ProcessApiCallback<ServerModels::GetAllSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerSegments(ServerModels::GetPlayersSegmentsRequest& request, ProcessApiCallback<ServerModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayersInSegment(ServerModels::GetPlayersInSegmentRequest& request, ProcessApiCallback<ServerModels::GetPlayersInSegmentResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void GetPlayerTags(ServerModels::GetPlayerTagsRequest& request, ProcessApiCallback<ServerModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void RemovePlayerTag(ServerModels::RemovePlayerTagRequest& request, ProcessApiCallback<ServerModels::RemovePlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
-        static void AwardSteamAchievement(ServerModels::AwardSteamAchievementRequest& request, ProcessApiCallback<ServerModels::AwardSteamAchievementResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr);
+        static void AuthenticateSessionTicket(ServerModels::AuthenticateSessionTicketRequest& request, ProcessApiCallback<ServerModels::AuthenticateSessionTicketResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetPlayerSecret(ServerModels::SetPlayerSecretRequest& request, ProcessApiCallback<ServerModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void BanUsers(ServerModels::BanUsersRequest& request, ProcessApiCallback<ServerModels::BanUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerProfile(ServerModels::GetPlayerProfileRequest& request, ProcessApiCallback<ServerModels::GetPlayerProfileResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromFacebookIDs(ServerModels::GetPlayFabIDsFromFacebookIDsRequest& request, ProcessApiCallback<ServerModels::GetPlayFabIDsFromFacebookIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayFabIDsFromSteamIDs(ServerModels::GetPlayFabIDsFromSteamIDsRequest& request, ProcessApiCallback<ServerModels::GetPlayFabIDsFromSteamIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserAccountInfo(ServerModels::GetUserAccountInfoRequest& request, ProcessApiCallback<ServerModels::GetUserAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserBans(ServerModels::GetUserBansRequest& request, ProcessApiCallback<ServerModels::GetUserBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RevokeAllBansForUser(ServerModels::RevokeAllBansForUserRequest& request, ProcessApiCallback<ServerModels::RevokeAllBansForUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RevokeBans(ServerModels::RevokeBansRequest& request, ProcessApiCallback<ServerModels::RevokeBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SendPushNotification(ServerModels::SendPushNotificationRequest& request, ProcessApiCallback<ServerModels::SendPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateAvatarUrl(ServerModels::UpdateAvatarUrlRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateBans(ServerModels::UpdateBansRequest& request, ProcessApiCallback<ServerModels::UpdateBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteUsers(ServerModels::DeleteUsersRequest& request, ProcessApiCallback<ServerModels::DeleteUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetFriendLeaderboard(ServerModels::GetFriendLeaderboardRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboard(ServerModels::GetLeaderboardRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboardAroundUser(ServerModels::GetLeaderboardAroundUserRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardAroundUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerCombinedInfo(ServerModels::GetPlayerCombinedInfoRequest& request, ProcessApiCallback<ServerModels::GetPlayerCombinedInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerStatistics(ServerModels::GetPlayerStatisticsRequest& request, ProcessApiCallback<ServerModels::GetPlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerStatisticVersions(ServerModels::GetPlayerStatisticVersionsRequest& request, ProcessApiCallback<ServerModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInternalData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherInternalData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserPublisherReadOnlyData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserReadOnlyData(ServerModels::GetUserDataRequest& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdatePlayerStatistics(ServerModels::UpdatePlayerStatisticsRequest& request, ProcessApiCallback<ServerModels::UpdatePlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserInternalData(ServerModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherInternalData(ServerModels::UpdateUserInternalDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserPublisherReadOnlyData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserReadOnlyData(ServerModels::UpdateUserDataRequest& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCatalogItems(ServerModels::GetCatalogItemsRequest& request, ProcessApiCallback<ServerModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPublisherData(ServerModels::GetPublisherDataRequest& request, ProcessApiCallback<ServerModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTime(ProcessApiCallback<ServerModels::GetTimeResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleData(ServerModels::GetTitleDataRequest& request, ProcessApiCallback<ServerModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleInternalData(ServerModels::GetTitleDataRequest& request, ProcessApiCallback<ServerModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetTitleNews(ServerModels::GetTitleNewsRequest& request, ProcessApiCallback<ServerModels::GetTitleNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetPublisherData(ServerModels::SetPublisherDataRequest& request, ProcessApiCallback<ServerModels::SetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetTitleData(ServerModels::SetTitleDataRequest& request, ProcessApiCallback<ServerModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetTitleInternalData(ServerModels::SetTitleDataRequest& request, ProcessApiCallback<ServerModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddCharacterVirtualCurrency(ServerModels::AddCharacterVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyCharacterVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddUserVirtualCurrency(ServerModels::AddUserVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ConsumeItem(ServerModels::ConsumeItemRequest& request, ProcessApiCallback<ServerModels::ConsumeItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void EvaluateRandomResultTable(ServerModels::EvaluateRandomResultTableRequest& request, ProcessApiCallback<ServerModels::EvaluateRandomResultTableResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterInventory(ServerModels::GetCharacterInventoryRequest& request, ProcessApiCallback<ServerModels::GetCharacterInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetRandomResultTables(ServerModels::GetRandomResultTablesRequest& request, ProcessApiCallback<ServerModels::GetRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInventory(ServerModels::GetUserInventoryRequest& request, ProcessApiCallback<ServerModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GrantItemsToCharacter(ServerModels::GrantItemsToCharacterRequest& request, ProcessApiCallback<ServerModels::GrantItemsToCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GrantItemsToUser(ServerModels::GrantItemsToUserRequest& request, ProcessApiCallback<ServerModels::GrantItemsToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GrantItemsToUsers(ServerModels::GrantItemsToUsersRequest& request, ProcessApiCallback<ServerModels::GrantItemsToUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ModifyItemUses(ServerModels::ModifyItemUsesRequest& request, ProcessApiCallback<ServerModels::ModifyItemUsesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void MoveItemToCharacterFromCharacter(ServerModels::MoveItemToCharacterFromCharacterRequest& request, ProcessApiCallback<ServerModels::MoveItemToCharacterFromCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void MoveItemToCharacterFromUser(ServerModels::MoveItemToCharacterFromUserRequest& request, ProcessApiCallback<ServerModels::MoveItemToCharacterFromUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void MoveItemToUserFromCharacter(ServerModels::MoveItemToUserFromCharacterRequest& request, ProcessApiCallback<ServerModels::MoveItemToUserFromCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RedeemCoupon(ServerModels::RedeemCouponRequest& request, ProcessApiCallback<ServerModels::RedeemCouponResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ReportPlayer(ServerModels::ReportPlayerServerRequest& request, ProcessApiCallback<ServerModels::ReportPlayerServerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RevokeInventoryItem(ServerModels::RevokeInventoryItemRequest& request, ProcessApiCallback<ServerModels::RevokeInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SubtractCharacterVirtualCurrency(ServerModels::SubtractCharacterVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyCharacterVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SubtractUserVirtualCurrency(ServerModels::SubtractUserVirtualCurrencyRequest& request, ProcessApiCallback<ServerModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlockContainerInstance(ServerModels::UnlockContainerInstanceRequest& request, ProcessApiCallback<ServerModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UnlockContainerItem(ServerModels::UnlockContainerItemRequest& request, ProcessApiCallback<ServerModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateUserInventoryItemCustomData(ServerModels::UpdateUserInventoryItemDataRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddFriend(ServerModels::AddFriendRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetFriendsList(ServerModels::GetFriendsListRequest& request, ProcessApiCallback<ServerModels::GetFriendsListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveFriend(ServerModels::RemoveFriendRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetFriendTags(ServerModels::SetFriendTagsRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeregisterGame(ServerModels::DeregisterGameRequest& request, ProcessApiCallback<ServerModels::DeregisterGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void NotifyMatchmakerPlayerLeft(ServerModels::NotifyMatchmakerPlayerLeftRequest& request, ProcessApiCallback<ServerModels::NotifyMatchmakerPlayerLeftResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RedeemMatchmakerTicket(ServerModels::RedeemMatchmakerTicketRequest& request, ProcessApiCallback<ServerModels::RedeemMatchmakerTicketResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RefreshGameServerInstanceHeartbeat(ServerModels::RefreshGameServerInstanceHeartbeatRequest& request, ProcessApiCallback<ServerModels::RefreshGameServerInstanceHeartbeatResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RegisterGame(ServerModels::RegisterGameRequest& request, ProcessApiCallback<ServerModels::RegisterGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetGameServerInstanceData(ServerModels::SetGameServerInstanceDataRequest& request, ProcessApiCallback<ServerModels::SetGameServerInstanceDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetGameServerInstanceState(ServerModels::SetGameServerInstanceStateRequest& request, ProcessApiCallback<ServerModels::SetGameServerInstanceStateResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void SetGameServerInstanceTags(ServerModels::SetGameServerInstanceTagsRequest& request, ProcessApiCallback<ServerModels::SetGameServerInstanceTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void WriteCharacterEvent(ServerModels::WriteServerCharacterEventRequest& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void WritePlayerEvent(ServerModels::WriteServerPlayerEventRequest& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void WriteTitleEvent(ServerModels::WriteTitleEventRequest& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddSharedGroupMembers(ServerModels::AddSharedGroupMembersRequest& request, ProcessApiCallback<ServerModels::AddSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void CreateSharedGroup(ServerModels::CreateSharedGroupRequest& request, ProcessApiCallback<ServerModels::CreateSharedGroupResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteSharedGroup(ServerModels::DeleteSharedGroupRequest& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetSharedGroupData(ServerModels::GetSharedGroupDataRequest& request, ProcessApiCallback<ServerModels::GetSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemoveSharedGroupMembers(ServerModels::RemoveSharedGroupMembersRequest& request, ProcessApiCallback<ServerModels::RemoveSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateSharedGroupData(ServerModels::UpdateSharedGroupDataRequest& request, ProcessApiCallback<ServerModels::UpdateSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void ExecuteCloudScript(ServerModels::ExecuteCloudScriptServerRequest& request, ProcessApiCallback<ServerModels::ExecuteCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetContentDownloadUrl(ServerModels::GetContentDownloadUrlRequest& request, ProcessApiCallback<ServerModels::GetContentDownloadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void DeleteCharacterFromUser(ServerModels::DeleteCharacterFromUserRequest& request, ProcessApiCallback<ServerModels::DeleteCharacterFromUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAllUsersCharacters(ServerModels::ListUsersCharactersRequest& request, ProcessApiCallback<ServerModels::ListUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterLeaderboard(ServerModels::GetCharacterLeaderboardRequest& request, ProcessApiCallback<ServerModels::GetCharacterLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterStatistics(ServerModels::GetCharacterStatisticsRequest& request, ProcessApiCallback<ServerModels::GetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboardAroundCharacter(ServerModels::GetLeaderboardAroundCharacterRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardAroundCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetLeaderboardForUserCharacters(ServerModels::GetLeaderboardForUsersCharactersRequest& request, ProcessApiCallback<ServerModels::GetLeaderboardForUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GrantCharacterToUser(ServerModels::GrantCharacterToUserRequest& request, ProcessApiCallback<ServerModels::GrantCharacterToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCharacterStatistics(ServerModels::UpdateCharacterStatisticsRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterData(ServerModels::GetCharacterDataRequest& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterInternalData(ServerModels::GetCharacterDataRequest& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCharacterReadOnlyData(ServerModels::GetCharacterDataRequest& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCharacterData(ServerModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCharacterInternalData(ServerModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void UpdateCharacterReadOnlyData(ServerModels::UpdateCharacterDataRequest& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AddPlayerTag(ServerModels::AddPlayerTagRequest& request, ProcessApiCallback<ServerModels::AddPlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAllActionGroups(ProcessApiCallback<ServerModels::GetAllActionGroupsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetAllSegments(ProcessApiCallback<ServerModels::GetAllSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerSegments(ServerModels::GetPlayersSegmentsRequest& request, ProcessApiCallback<ServerModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayersInSegment(ServerModels::GetPlayersInSegmentRequest& request, ProcessApiCallback<ServerModels::GetPlayersInSegmentResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetPlayerTags(ServerModels::GetPlayerTagsRequest& request, ProcessApiCallback<ServerModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void RemovePlayerTag(ServerModels::RemovePlayerTagRequest& request, ProcessApiCallback<ServerModels::RemovePlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void AwardSteamAchievement(ServerModels::AwardSteamAchievementRequest& request, ProcessApiCallback<ServerModels::AwardSteamAchievementResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+
+        // ------------ Generated Api calls taking a temporary or moved request, which is serialized in place as the lvalue calls do
+        static void AuthenticateSessionTicket(ServerModels::AuthenticateSessionTicketRequest&& request, ProcessApiCallback<ServerModels::AuthenticateSessionTicketResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AuthenticateSessionTicket(request, callback, errorCallback, customData, priority); }
+        static void SetPlayerSecret(ServerModels::SetPlayerSecretRequest&& request, ProcessApiCallback<ServerModels::SetPlayerSecretResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetPlayerSecret(request, callback, errorCallback, customData, priority); }
+        static void BanUsers(ServerModels::BanUsersRequest&& request, ProcessApiCallback<ServerModels::BanUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { BanUsers(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerProfile(ServerModels::GetPlayerProfileRequest&& request, ProcessApiCallback<ServerModels::GetPlayerProfileResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerProfile(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromFacebookIDs(ServerModels::GetPlayFabIDsFromFacebookIDsRequest&& request, ProcessApiCallback<ServerModels::GetPlayFabIDsFromFacebookIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromFacebookIDs(request, callback, errorCallback, customData, priority); }
+        static void GetPlayFabIDsFromSteamIDs(ServerModels::GetPlayFabIDsFromSteamIDsRequest&& request, ProcessApiCallback<ServerModels::GetPlayFabIDsFromSteamIDsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayFabIDsFromSteamIDs(request, callback, errorCallback, customData, priority); }
+        static void GetUserAccountInfo(ServerModels::GetUserAccountInfoRequest&& request, ProcessApiCallback<ServerModels::GetUserAccountInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserAccountInfo(request, callback, errorCallback, customData, priority); }
+        static void GetUserBans(ServerModels::GetUserBansRequest&& request, ProcessApiCallback<ServerModels::GetUserBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserBans(request, callback, errorCallback, customData, priority); }
+        static void RevokeAllBansForUser(ServerModels::RevokeAllBansForUserRequest&& request, ProcessApiCallback<ServerModels::RevokeAllBansForUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RevokeAllBansForUser(request, callback, errorCallback, customData, priority); }
+        static void RevokeBans(ServerModels::RevokeBansRequest&& request, ProcessApiCallback<ServerModels::RevokeBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RevokeBans(request, callback, errorCallback, customData, priority); }
+        static void SendPushNotification(ServerModels::SendPushNotificationRequest&& request, ProcessApiCallback<ServerModels::SendPushNotificationResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SendPushNotification(request, callback, errorCallback, customData, priority); }
+        static void UpdateAvatarUrl(ServerModels::UpdateAvatarUrlRequest&& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateAvatarUrl(request, callback, errorCallback, customData, priority); }
+        static void UpdateBans(ServerModels::UpdateBansRequest&& request, ProcessApiCallback<ServerModels::UpdateBansResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateBans(request, callback, errorCallback, customData, priority); }
+        static void DeleteUsers(ServerModels::DeleteUsersRequest&& request, ProcessApiCallback<ServerModels::DeleteUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteUsers(request, callback, errorCallback, customData, priority); }
+        static void GetFriendLeaderboard(ServerModels::GetFriendLeaderboardRequest&& request, ProcessApiCallback<ServerModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetFriendLeaderboard(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboard(ServerModels::GetLeaderboardRequest&& request, ProcessApiCallback<ServerModels::GetLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboard(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboardAroundUser(ServerModels::GetLeaderboardAroundUserRequest&& request, ProcessApiCallback<ServerModels::GetLeaderboardAroundUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboardAroundUser(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerCombinedInfo(ServerModels::GetPlayerCombinedInfoRequest&& request, ProcessApiCallback<ServerModels::GetPlayerCombinedInfoResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerCombinedInfo(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerStatistics(ServerModels::GetPlayerStatisticsRequest&& request, ProcessApiCallback<ServerModels::GetPlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerStatistics(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerStatisticVersions(ServerModels::GetPlayerStatisticVersionsRequest&& request, ProcessApiCallback<ServerModels::GetPlayerStatisticVersionsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerStatisticVersions(request, callback, errorCallback, customData, priority); }
+        static void GetUserData(ServerModels::GetUserDataRequest&& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserData(request, callback, errorCallback, customData, priority); }
+        static void GetUserInternalData(ServerModels::GetUserDataRequest&& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserInternalData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherData(ServerModels::GetUserDataRequest&& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherInternalData(ServerModels::GetUserDataRequest&& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherInternalData(request, callback, errorCallback, customData, priority); }
+        static void GetUserPublisherReadOnlyData(ServerModels::GetUserDataRequest&& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserPublisherReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void GetUserReadOnlyData(ServerModels::GetUserDataRequest&& request, ProcessApiCallback<ServerModels::GetUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void UpdatePlayerStatistics(ServerModels::UpdatePlayerStatisticsRequest&& request, ProcessApiCallback<ServerModels::UpdatePlayerStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdatePlayerStatistics(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserData(ServerModels::UpdateUserDataRequest&& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserInternalData(ServerModels::UpdateUserInternalDataRequest&& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserInternalData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherData(ServerModels::UpdateUserDataRequest&& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherInternalData(ServerModels::UpdateUserInternalDataRequest&& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherInternalData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserPublisherReadOnlyData(ServerModels::UpdateUserDataRequest&& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserPublisherReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserReadOnlyData(ServerModels::UpdateUserDataRequest&& request, ProcessApiCallback<ServerModels::UpdateUserDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void GetCatalogItems(ServerModels::GetCatalogItemsRequest&& request, ProcessApiCallback<ServerModels::GetCatalogItemsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCatalogItems(request, callback, errorCallback, customData, priority); }
+        static void GetPublisherData(ServerModels::GetPublisherDataRequest&& request, ProcessApiCallback<ServerModels::GetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPublisherData(request, callback, errorCallback, customData, priority); }
+        static void GetTitleData(ServerModels::GetTitleDataRequest&& request, ProcessApiCallback<ServerModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleData(request, callback, errorCallback, customData, priority); }
+        static void GetTitleInternalData(ServerModels::GetTitleDataRequest&& request, ProcessApiCallback<ServerModels::GetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleInternalData(request, callback, errorCallback, customData, priority); }
+        static void GetTitleNews(ServerModels::GetTitleNewsRequest&& request, ProcessApiCallback<ServerModels::GetTitleNewsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetTitleNews(request, callback, errorCallback, customData, priority); }
+        static void SetPublisherData(ServerModels::SetPublisherDataRequest&& request, ProcessApiCallback<ServerModels::SetPublisherDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetPublisherData(request, callback, errorCallback, customData, priority); }
+        static void SetTitleData(ServerModels::SetTitleDataRequest&& request, ProcessApiCallback<ServerModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetTitleData(request, callback, errorCallback, customData, priority); }
+        static void SetTitleInternalData(ServerModels::SetTitleDataRequest&& request, ProcessApiCallback<ServerModels::SetTitleDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetTitleInternalData(request, callback, errorCallback, customData, priority); }
+        static void AddCharacterVirtualCurrency(ServerModels::AddCharacterVirtualCurrencyRequest&& request, ProcessApiCallback<ServerModels::ModifyCharacterVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddCharacterVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void AddUserVirtualCurrency(ServerModels::AddUserVirtualCurrencyRequest&& request, ProcessApiCallback<ServerModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddUserVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void ConsumeItem(ServerModels::ConsumeItemRequest&& request, ProcessApiCallback<ServerModels::ConsumeItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ConsumeItem(request, callback, errorCallback, customData, priority); }
+        static void EvaluateRandomResultTable(ServerModels::EvaluateRandomResultTableRequest&& request, ProcessApiCallback<ServerModels::EvaluateRandomResultTableResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { EvaluateRandomResultTable(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterInventory(ServerModels::GetCharacterInventoryRequest&& request, ProcessApiCallback<ServerModels::GetCharacterInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterInventory(request, callback, errorCallback, customData, priority); }
+        static void GetRandomResultTables(ServerModels::GetRandomResultTablesRequest&& request, ProcessApiCallback<ServerModels::GetRandomResultTablesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetRandomResultTables(request, callback, errorCallback, customData, priority); }
+        static void GetUserInventory(ServerModels::GetUserInventoryRequest&& request, ProcessApiCallback<ServerModels::GetUserInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetUserInventory(request, callback, errorCallback, customData, priority); }
+        static void GrantItemsToCharacter(ServerModels::GrantItemsToCharacterRequest&& request, ProcessApiCallback<ServerModels::GrantItemsToCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GrantItemsToCharacter(request, callback, errorCallback, customData, priority); }
+        static void GrantItemsToUser(ServerModels::GrantItemsToUserRequest&& request, ProcessApiCallback<ServerModels::GrantItemsToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GrantItemsToUser(request, callback, errorCallback, customData, priority); }
+        static void GrantItemsToUsers(ServerModels::GrantItemsToUsersRequest&& request, ProcessApiCallback<ServerModels::GrantItemsToUsersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GrantItemsToUsers(request, callback, errorCallback, customData, priority); }
+        static void ModifyItemUses(ServerModels::ModifyItemUsesRequest&& request, ProcessApiCallback<ServerModels::ModifyItemUsesResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ModifyItemUses(request, callback, errorCallback, customData, priority); }
+        static void MoveItemToCharacterFromCharacter(ServerModels::MoveItemToCharacterFromCharacterRequest&& request, ProcessApiCallback<ServerModels::MoveItemToCharacterFromCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { MoveItemToCharacterFromCharacter(request, callback, errorCallback, customData, priority); }
+        static void MoveItemToCharacterFromUser(ServerModels::MoveItemToCharacterFromUserRequest&& request, ProcessApiCallback<ServerModels::MoveItemToCharacterFromUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { MoveItemToCharacterFromUser(request, callback, errorCallback, customData, priority); }
+        static void MoveItemToUserFromCharacter(ServerModels::MoveItemToUserFromCharacterRequest&& request, ProcessApiCallback<ServerModels::MoveItemToUserFromCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { MoveItemToUserFromCharacter(request, callback, errorCallback, customData, priority); }
+        static void RedeemCoupon(ServerModels::RedeemCouponRequest&& request, ProcessApiCallback<ServerModels::RedeemCouponResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RedeemCoupon(request, callback, errorCallback, customData, priority); }
+        static void ReportPlayer(ServerModels::ReportPlayerServerRequest&& request, ProcessApiCallback<ServerModels::ReportPlayerServerResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ReportPlayer(request, callback, errorCallback, customData, priority); }
+        static void RevokeInventoryItem(ServerModels::RevokeInventoryItemRequest&& request, ProcessApiCallback<ServerModels::RevokeInventoryResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RevokeInventoryItem(request, callback, errorCallback, customData, priority); }
+        static void SubtractCharacterVirtualCurrency(ServerModels::SubtractCharacterVirtualCurrencyRequest&& request, ProcessApiCallback<ServerModels::ModifyCharacterVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SubtractCharacterVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void SubtractUserVirtualCurrency(ServerModels::SubtractUserVirtualCurrencyRequest&& request, ProcessApiCallback<ServerModels::ModifyUserVirtualCurrencyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SubtractUserVirtualCurrency(request, callback, errorCallback, customData, priority); }
+        static void UnlockContainerInstance(ServerModels::UnlockContainerInstanceRequest&& request, ProcessApiCallback<ServerModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlockContainerInstance(request, callback, errorCallback, customData, priority); }
+        static void UnlockContainerItem(ServerModels::UnlockContainerItemRequest&& request, ProcessApiCallback<ServerModels::UnlockContainerItemResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UnlockContainerItem(request, callback, errorCallback, customData, priority); }
+        static void UpdateUserInventoryItemCustomData(ServerModels::UpdateUserInventoryItemDataRequest&& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateUserInventoryItemCustomData(request, callback, errorCallback, customData, priority); }
+        static void AddFriend(ServerModels::AddFriendRequest&& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddFriend(request, callback, errorCallback, customData, priority); }
+        static void GetFriendsList(ServerModels::GetFriendsListRequest&& request, ProcessApiCallback<ServerModels::GetFriendsListResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetFriendsList(request, callback, errorCallback, customData, priority); }
+        static void RemoveFriend(ServerModels::RemoveFriendRequest&& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveFriend(request, callback, errorCallback, customData, priority); }
+        static void SetFriendTags(ServerModels::SetFriendTagsRequest&& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetFriendTags(request, callback, errorCallback, customData, priority); }
+        static void DeregisterGame(ServerModels::DeregisterGameRequest&& request, ProcessApiCallback<ServerModels::DeregisterGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeregisterGame(request, callback, errorCallback, customData, priority); }
+        static void NotifyMatchmakerPlayerLeft(ServerModels::NotifyMatchmakerPlayerLeftRequest&& request, ProcessApiCallback<ServerModels::NotifyMatchmakerPlayerLeftResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { NotifyMatchmakerPlayerLeft(request, callback, errorCallback, customData, priority); }
+        static void RedeemMatchmakerTicket(ServerModels::RedeemMatchmakerTicketRequest&& request, ProcessApiCallback<ServerModels::RedeemMatchmakerTicketResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RedeemMatchmakerTicket(request, callback, errorCallback, customData, priority); }
+        static void RefreshGameServerInstanceHeartbeat(ServerModels::RefreshGameServerInstanceHeartbeatRequest&& request, ProcessApiCallback<ServerModels::RefreshGameServerInstanceHeartbeatResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RefreshGameServerInstanceHeartbeat(request, callback, errorCallback, customData, priority); }
+        static void RegisterGame(ServerModels::RegisterGameRequest&& request, ProcessApiCallback<ServerModels::RegisterGameResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RegisterGame(request, callback, errorCallback, customData, priority); }
+        static void SetGameServerInstanceData(ServerModels::SetGameServerInstanceDataRequest&& request, ProcessApiCallback<ServerModels::SetGameServerInstanceDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetGameServerInstanceData(request, callback, errorCallback, customData, priority); }
+        static void SetGameServerInstanceState(ServerModels::SetGameServerInstanceStateRequest&& request, ProcessApiCallback<ServerModels::SetGameServerInstanceStateResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetGameServerInstanceState(request, callback, errorCallback, customData, priority); }
+        static void SetGameServerInstanceTags(ServerModels::SetGameServerInstanceTagsRequest&& request, ProcessApiCallback<ServerModels::SetGameServerInstanceTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { SetGameServerInstanceTags(request, callback, errorCallback, customData, priority); }
+        static void WriteCharacterEvent(ServerModels::WriteServerCharacterEventRequest&& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { WriteCharacterEvent(request, callback, errorCallback, customData, priority); }
+        static void WritePlayerEvent(ServerModels::WriteServerPlayerEventRequest&& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { WritePlayerEvent(request, callback, errorCallback, customData, priority); }
+        static void WriteTitleEvent(ServerModels::WriteTitleEventRequest&& request, ProcessApiCallback<ServerModels::WriteEventResponse> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { WriteTitleEvent(request, callback, errorCallback, customData, priority); }
+        static void AddSharedGroupMembers(ServerModels::AddSharedGroupMembersRequest&& request, ProcessApiCallback<ServerModels::AddSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddSharedGroupMembers(request, callback, errorCallback, customData, priority); }
+        static void CreateSharedGroup(ServerModels::CreateSharedGroupRequest&& request, ProcessApiCallback<ServerModels::CreateSharedGroupResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { CreateSharedGroup(request, callback, errorCallback, customData, priority); }
+        static void DeleteSharedGroup(ServerModels::DeleteSharedGroupRequest&& request, ProcessApiCallback<ServerModels::EmptyResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteSharedGroup(request, callback, errorCallback, customData, priority); }
+        static void GetSharedGroupData(ServerModels::GetSharedGroupDataRequest&& request, ProcessApiCallback<ServerModels::GetSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetSharedGroupData(request, callback, errorCallback, customData, priority); }
+        static void RemoveSharedGroupMembers(ServerModels::RemoveSharedGroupMembersRequest&& request, ProcessApiCallback<ServerModels::RemoveSharedGroupMembersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemoveSharedGroupMembers(request, callback, errorCallback, customData, priority); }
+        static void UpdateSharedGroupData(ServerModels::UpdateSharedGroupDataRequest&& request, ProcessApiCallback<ServerModels::UpdateSharedGroupDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateSharedGroupData(request, callback, errorCallback, customData, priority); }
+        static void ExecuteCloudScript(ServerModels::ExecuteCloudScriptServerRequest&& request, ProcessApiCallback<ServerModels::ExecuteCloudScriptResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { ExecuteCloudScript(request, callback, errorCallback, customData, priority); }
+        static void GetContentDownloadUrl(ServerModels::GetContentDownloadUrlRequest&& request, ProcessApiCallback<ServerModels::GetContentDownloadUrlResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetContentDownloadUrl(request, callback, errorCallback, customData, priority); }
+        static void DeleteCharacterFromUser(ServerModels::DeleteCharacterFromUserRequest&& request, ProcessApiCallback<ServerModels::DeleteCharacterFromUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { DeleteCharacterFromUser(request, callback, errorCallback, customData, priority); }
+        static void GetAllUsersCharacters(ServerModels::ListUsersCharactersRequest&& request, ProcessApiCallback<ServerModels::ListUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetAllUsersCharacters(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterLeaderboard(ServerModels::GetCharacterLeaderboardRequest&& request, ProcessApiCallback<ServerModels::GetCharacterLeaderboardResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterLeaderboard(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterStatistics(ServerModels::GetCharacterStatisticsRequest&& request, ProcessApiCallback<ServerModels::GetCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterStatistics(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboardAroundCharacter(ServerModels::GetLeaderboardAroundCharacterRequest&& request, ProcessApiCallback<ServerModels::GetLeaderboardAroundCharacterResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboardAroundCharacter(request, callback, errorCallback, customData, priority); }
+        static void GetLeaderboardForUserCharacters(ServerModels::GetLeaderboardForUsersCharactersRequest&& request, ProcessApiCallback<ServerModels::GetLeaderboardForUsersCharactersResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetLeaderboardForUserCharacters(request, callback, errorCallback, customData, priority); }
+        static void GrantCharacterToUser(ServerModels::GrantCharacterToUserRequest&& request, ProcessApiCallback<ServerModels::GrantCharacterToUserResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GrantCharacterToUser(request, callback, errorCallback, customData, priority); }
+        static void UpdateCharacterStatistics(ServerModels::UpdateCharacterStatisticsRequest&& request, ProcessApiCallback<ServerModels::UpdateCharacterStatisticsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCharacterStatistics(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterData(ServerModels::GetCharacterDataRequest&& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterData(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterInternalData(ServerModels::GetCharacterDataRequest&& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterInternalData(request, callback, errorCallback, customData, priority); }
+        static void GetCharacterReadOnlyData(ServerModels::GetCharacterDataRequest&& request, ProcessApiCallback<ServerModels::GetCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetCharacterReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void UpdateCharacterData(ServerModels::UpdateCharacterDataRequest&& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCharacterData(request, callback, errorCallback, customData, priority); }
+        static void UpdateCharacterInternalData(ServerModels::UpdateCharacterDataRequest&& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCharacterInternalData(request, callback, errorCallback, customData, priority); }
+        static void UpdateCharacterReadOnlyData(ServerModels::UpdateCharacterDataRequest&& request, ProcessApiCallback<ServerModels::UpdateCharacterDataResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { UpdateCharacterReadOnlyData(request, callback, errorCallback, customData, priority); }
+        static void AddPlayerTag(ServerModels::AddPlayerTagRequest&& request, ProcessApiCallback<ServerModels::AddPlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AddPlayerTag(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerSegments(ServerModels::GetPlayersSegmentsRequest&& request, ProcessApiCallback<ServerModels::GetPlayerSegmentsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerSegments(request, callback, errorCallback, customData, priority); }
+        static void GetPlayersInSegment(ServerModels::GetPlayersInSegmentRequest&& request, ProcessApiCallback<ServerModels::GetPlayersInSegmentResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayersInSegment(request, callback, errorCallback, customData, priority); }
+        static void GetPlayerTags(ServerModels::GetPlayerTagsRequest&& request, ProcessApiCallback<ServerModels::GetPlayerTagsResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { GetPlayerTags(request, callback, errorCallback, customData, priority); }
+        static void RemovePlayerTag(ServerModels::RemovePlayerTagRequest&& request, ProcessApiCallback<ServerModels::RemovePlayerTagResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { RemovePlayerTag(request, callback, errorCallback, customData, priority); }
+        static void AwardSteamAchievement(ServerModels::AwardSteamAchievementRequest&& request, ProcessApiCallback<ServerModels::AwardSteamAchievementResult> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault) { AwardSteamAchievement(request, callback, errorCallback, customData, priority); }
+
+        // ------------ Lazily decoded variants of the calls with the largest results, see PlayFabLazyModel
+        static void GetPlayerCombinedInfoLazy(ServerModels::GetPlayerCombinedInfoRequest& request, ProcessApiCallback<PlayFabLazyModel<ServerModels::GetPlayerCombinedInfoResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetCatalogItemsLazy(ServerModels::GetCatalogItemsRequest& request, ProcessApiCallback<PlayFabLazyModel<ServerModels::GetCatalogItemsResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
+        static void GetUserInventoryLazy(ServerModels::GetUserInventoryRequest& request, ProcessApiCallback<PlayFabLazyModel<ServerModels::GetUserInventoryResult>> callback = nullptr, ErrorCallback errorCallback = nullptr, void* customData = nullptr, PlayFabRequestPriority priority = PlayFabRequestPriorityDefault);
 
     private:
         // ------------ Private constructor, to enforce all-static class
@@ -0,0 +1,180 @@
+#include "StdAfx.h"
+#include "PlayFabTelemetryPipeline.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+#include <functional>
+#include <time.h>
+
+using namespace PlayFabComboSdk;
+
+PlayFabTelemetryPipeline* PlayFabTelemetryPipeline::telemetryPipeline = nullptr;
+
+PlayFabTelemetryPipeline::PlayFabTelemetryPipeline(SendFunction sendFunction, int capacity, float eventsPerSecond, int maxInFlight, PlayFabTelemetryDropPolicy dropPolicy, int sampleRate)
+    : m_sendFunction(sendFunction)
+    , m_ring(static_cast<size_t>(AZStd::GetMax(capacity, 2)))
+    , m_maxInFlight(AZStd::GetMax(maxInFlight, 0))
+    , m_dropPolicy(dropPolicy)
+    , m_sampleRate(AZStd::GetMax(sampleRate, 1))
+    , m_sampleCounter(0)
+    , m_producedEvents(0)
+    , m_sentEvents(0)
+    , m_failedEvents(0)
+    , m_droppedOldest(0)
+    , m_droppedSampled(0)
+    , m_droppedFull(0)
+    , m_inFlightEvents(0)
+    , m_eventsPerSecond(AZStd::GetMax(eventsPerSecond, 0.0f))
+    , m_tokens(0.0f)
+    , m_lastUpdateTime(AZStd::chrono::system_clock::now())
+    , m_stopping(false)
+{
+}
+
+PlayFabTelemetryPipeline::~PlayFabTelemetryPipeline()
+{
+    StopFlusher();
+
+    // The module flushes before shutting the request manager down, so only events queued after that, or left when its wait ran out, are lost
+    if (m_ring.Size() > 0)
+        AZ_TracePrintf("PlayFab", "*** PlayFab %d telemetry events were not sent by the shutdown flush, and have been dropped", static_cast<int>(m_ring.Size()));
+}
+
+void PlayFabTelemetryPipeline::StartFlusher()
+{
+    if (m_flusher.joinable())
+        return;
+    auto function = std::bind(&PlayFabTelemetryPipeline::FlusherFunction, this);
+    m_flusher = AZStd::thread(function);
+}
+
+void PlayFabTelemetryPipeline::StopFlusher()
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_flusherMutex);
+        m_stopping = true;
+    }
+    m_flusherWake.notify_all();
+    if (m_flusher.joinable())
+        m_flusher.join();
+}
+
+bool PlayFabTelemetryPipeline::Queue(PlayFabTelemetryEvent& event)
+{
+    m_producedEvents.fetch_add(1, AZStd::memory_order_relaxed);
+    if (event.timestamp.isNull())
+        event.timestamp = time(nullptr);
+
+    if (m_dropPolicy.load(AZStd::memory_order_relaxed) == PlayFabTelemetrySample && m_ring.Size() * 100 >= m_ring.Capacity() * SampleThresholdPercent)
+    {
+        if (m_sampleCounter.fetch_add(1, AZStd::memory_order_relaxed) % m_sampleRate.load(AZStd::memory_order_relaxed) != 0)
+        {
+            m_droppedSampled.fetch_add(1, AZStd::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    while (!m_ring.TryPush(event))
+    {
+        if (m_dropPolicy.load(AZStd::memory_order_relaxed) != PlayFabTelemetryDropOldest)
+        {
+            m_droppedFull.fetch_add(1, AZStd::memory_order_relaxed);
+            return false;
+        }
+
+        // Another producer may take the freed slot first, in which case the next oldest event goes too
+        PlayFabTelemetryEvent oldest;
+        if (m_ring.TryPop(oldest))
+            m_droppedOldest.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+    return true;
+}
+
+void PlayFabTelemetryPipeline::SetDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate)
+{
+    m_dropPolicy.store(policy, AZStd::memory_order_relaxed);
+    m_sampleRate.store(AZStd::GetMax(sampleRate, 1), AZStd::memory_order_relaxed);
+}
+
+void PlayFabTelemetryPipeline::SetSendRate(float eventsPerSecond)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_sendMutex);
+    m_eventsPerSecond = AZStd::GetMax(eventsPerSecond, 0.0f);
+}
+
+bool PlayFabTelemetryPipeline::Flush()
+{
+    PlayFabTelemetryEvent event;
+    while ((m_maxInFlight == 0 || m_inFlightEvents.load(AZStd::memory_order_relaxed) < m_maxInFlight) && m_ring.TryPop(event))
+        Send(event);
+    return m_ring.Size() == 0;
+}
+
+PlayFabTelemetryStats PlayFabTelemetryPipeline::GetStats()
+{
+    PlayFabTelemetryStats stats;
+    stats.producedEvents = m_producedEvents.load(AZStd::memory_order_relaxed);
+    stats.sentEvents = m_sentEvents.load(AZStd::memory_order_relaxed);
+    stats.failedEvents = m_failedEvents.load(AZStd::memory_order_relaxed);
+    stats.droppedOldest = m_droppedOldest.load(AZStd::memory_order_relaxed);
+    stats.droppedSampled = m_droppedSampled.load(AZStd::memory_order_relaxed);
+    stats.droppedFull = m_droppedFull.load(AZStd::memory_order_relaxed);
+    stats.queuedEvents = static_cast<int>(m_ring.Size());
+    stats.capacity = static_cast<int>(m_ring.Capacity());
+    stats.inFlightEvents = m_inFlightEvents.load(AZStd::memory_order_relaxed);
+    return stats;
+}
+
+void PlayFabTelemetryPipeline::Update(AZStd::chrono::system_clock::time_point now)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_sendMutex);
+    if (now > m_lastUpdateTime)
+    {
+        float elapsedSeconds = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_lastUpdateTime).count() / 1000000.0f;
+        m_tokens = AZStd::GetMin(m_tokens + elapsedSeconds * m_eventsPerSecond, AZStd::GetMax(m_eventsPerSecond, 1.0f));
+        m_lastUpdateTime = now;
+    }
+
+    PlayFabTelemetryEvent event;
+    while (m_tokens >= 1.0f && (m_maxInFlight == 0 || m_inFlightEvents.load(AZStd::memory_order_relaxed) < m_maxInFlight) && m_ring.TryPop(event))
+    {
+        m_tokens -= 1.0f;
+        Send(event);
+    }
+}
+
+void PlayFabTelemetryPipeline::OnSendCompleted(bool succeeded)
+{
+    m_inFlightEvents.fetch_sub(1, AZStd::memory_order_relaxed);
+    if (!succeeded)
+        m_failedEvents.fetch_add(1, AZStd::memory_order_relaxed);
+}
+
+void PlayFabTelemetryPipeline::Send(PlayFabTelemetryEvent& event)
+{
+    // Counted in flight first, as the call may complete before the send function returns
+    m_inFlightEvents.fetch_add(1, AZStd::memory_order_relaxed);
+    if (m_sendFunction(event))
+        m_sentEvents.fetch_add(1, AZStd::memory_order_relaxed);
+    else
+    {
+        m_inFlightEvents.fetch_sub(1, AZStd::memory_order_relaxed);
+        m_failedEvents.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+}
+
+void PlayFabTelemetryPipeline::FlusherFunction()
+{
+    // Woken by the period rather than by each event, so producers never touch a lock or a condition variable
+    AZStd::unique_lock<AZStd::mutex> lock(m_flusherMutex);
+    while (!m_stopping)
+    {
+        m_flusherWake.wait_for(lock, AZStd::chrono::milliseconds(FlushPeriodMs));
+        if (m_stopping)
+            break;
+        lock.unlock();
+        Update(AZStd::chrono::system_clock::now());
+        lock.lock();
+    }
+}
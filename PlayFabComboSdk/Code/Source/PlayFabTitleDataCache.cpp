@@ -0,0 +1,162 @@
+#include "StdAfx.h"
+#include "PlayFabTitleDataCache.h"
+
+#include <PlayFabComboSdk/PlayFabCombo_TitleDatabus.h>
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabComboSdk;
+
+PlayFabTitleDataCache* PlayFabTitleDataCache::titleDataCache = nullptr;
+
+PlayFabTitleDataCache::SourceState::SourceState()
+    : current(AZStd::make_shared<const PlayFabTitleDataSnapshot>())
+    , active(false)
+    , fetching(false)
+    , refreshRequested(false)
+    , stats()
+{
+}
+
+PlayFabTitleDataCache::PlayFabTitleDataCache(FetchFunction fetchFunction, int refreshIntervalSeconds)
+    : m_fetchFunction(fetchFunction)
+    , m_refreshIntervalSeconds(AZStd::GetMax(refreshIntervalSeconds, 1))
+{
+    AZ::TickBus::Handler::BusConnect();
+}
+
+PlayFabTitleDataCache::~PlayFabTitleDataCache()
+{
+    AZ::TickBus::Handler::BusDisconnect();
+}
+
+void PlayFabTitleDataCache::Start(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    SourceState& state = m_sources[source];
+    state.active = true;
+    state.refreshRequested = true;
+    state.keys = keys;
+}
+
+void PlayFabTitleDataCache::Stop(PlayFabTitleDataSource source)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_sources[source].active = false;
+    m_sources[source].refreshRequested = false;
+}
+
+void PlayFabTitleDataCache::Refresh(PlayFabTitleDataSource source)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_sources[source].refreshRequested = true;
+}
+
+void PlayFabTitleDataCache::SetRefreshInterval(int seconds)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_refreshIntervalSeconds = AZStd::GetMax(seconds, 1);
+}
+
+PlayFabTitleDataCacheStats PlayFabTitleDataCache::GetStats(PlayFabTitleDataSource source)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    return m_sources[source].stats;
+}
+
+void PlayFabTitleDataCache::Update(AZStd::chrono::system_clock::time_point now)
+{
+    AZStd::vector<AZStd::string> fetchKeys[PlayFabTitleDataSourceCount];
+    bool fetch[PlayFabTitleDataSourceCount] = {};
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (int source = 0; source < PlayFabTitleDataSourceCount; ++source)
+        {
+            SourceState& state = m_sources[source];
+            if (state.active && !state.fetching && (state.refreshRequested || now >= state.nextRefreshTime))
+            {
+                state.fetching = true;
+                state.refreshRequested = false;
+                fetchKeys[source] = state.keys;
+                fetch[source] = true;
+            }
+        }
+    }
+
+    // Sent outside the lock, as a request rejected by the rate limiter fails straight away
+    for (int source = 0; source < PlayFabTitleDataSourceCount; ++source)
+    {
+        if (fetch[source] && !m_fetchFunction(static_cast<PlayFabTitleDataSource>(source), fetchKeys[source]))
+        {
+            AZ_TracePrintf("PlayFab", "*** PlayFab Title data source %d is not available in this gem, and will not be cached", source);
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_sources[source].active = false;
+            m_sources[source].fetching = false;
+        }
+    }
+}
+
+void PlayFabTitleDataCache::ApplyFetchResult(PlayFabTitleDataSource source, const PlayFabStringMap<AZStd::string>& data)
+{
+    AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
+    AZStd::vector<AZStd::string> changedKeys;
+    PlayFabTitleDataSnapshotPtr published;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        SourceState& state = m_sources[source];
+        state.fetching = false;
+        state.nextRefreshTime = now + AZStd::chrono::seconds(m_refreshIntervalSeconds);
+        state.stats.refreshes++;
+
+        PlayFabTitleDataSnapshotPtr previous = state.current.Get();
+        for (const auto& entry : data)
+        {
+            const AZStd::string* previousValue = previous->Find(entry.first.c_str());
+            if (previousValue == nullptr || *previousValue != entry.second)
+                changedKeys.push_back(entry.first);
+        }
+        for (const auto& entry : previous->values)
+        {
+            if (data.find(entry.first) == data.end())
+                changedKeys.push_back(entry.first);
+        }
+
+        // The first result is always published, so version 0 only ever means nothing has been fetched yet
+        if (changedKeys.empty() && previous->version != 0)
+            return;
+
+        AZStd::shared_ptr<PlayFabTitleDataSnapshot> snapshot = AZStd::make_shared<PlayFabTitleDataSnapshot>();
+        snapshot->version = previous->version + 1;
+        snapshot->fetchedTime = now;
+        snapshot->values.reserve(data.size());
+        for (const auto& entry : data)
+            snapshot->values.insert(PlayFabFlatMap<AZStd::string>::value_type(entry.first, entry.second));
+
+        state.current.Publish(snapshot);
+        state.stats.publishedSnapshots++;
+        state.stats.changedKeys += changedKeys.size();
+        published = snapshot;
+    }
+
+    // Held by published, so the snapshot stays valid for the handlers even if another refresh replaces it meanwhile
+    if (!changedKeys.empty())
+        PlayFabCombo_TitleDataNotificationBus::Broadcast(&PlayFabCombo_TitleDataNotifications::OnTitleDataChanged, source, *published, changedKeys);
+}
+
+void PlayFabTitleDataCache::ApplyFetchFailure(PlayFabTitleDataSource source)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    SourceState& state = m_sources[source];
+    state.fetching = false;
+    state.nextRefreshTime = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(AZStd::GetMin(m_refreshIntervalSeconds, static_cast<int>(FailureRetrySeconds)));
+    state.stats.failedRefreshes++;
+}
+
+void PlayFabTitleDataCache::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+{
+    (void)deltaTime;
+    (void)time;
+    Update(AZStd::chrono::system_clock::now());
+}
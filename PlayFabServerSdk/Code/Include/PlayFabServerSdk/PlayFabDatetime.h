@@ -0,0 +1,148 @@
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace PlayFabServerSdk
+{
+    // ISO-8601 timestamps as PlayFab sends them, such as "2017-04-12T18:03:45.123Z", to and from UTC milliseconds since 1970.
+    // Plain arithmetic on the caller's buffers, with no libc time, locale or timezone calls, so these are reentrant and never take a lock.
+    namespace PlayFabDatetime
+    {
+        static const size_t FormattedLength = 24; // "YYYY-MM-DDTHH:MM:SS.mmmZ"
+        static const AZ::s64 MinMilliseconds = -62167219200000LL; // 0000-01-01T00:00:00.000Z
+        static const AZ::s64 MaxMilliseconds = 253402300799999LL; // 9999-12-31T23:59:59.999Z
+
+        // Days since 1970-01-01 of a proleptic Gregorian date, using 400 year eras so there are no loops or tables
+        inline AZ::s64 DaysFromCivil(AZ::s64 year, unsigned month, unsigned day)
+        {
+            year -= month <= 2;
+            const AZ::s64 era = (year >= 0 ? year : year - 399) / 400;
+            const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+            const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // Counted from March, so the leap day is last
+            const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+            return era * 146097 + static_cast<AZ::s64>(dayOfEra) - 719468;
+        }
+
+        // Inverse of DaysFromCivil
+        inline void CivilFromDays(AZ::s64 days, AZ::s64& year, unsigned& month, unsigned& day)
+        {
+            days += 719468;
+            const AZ::s64 era = (days >= 0 ? days : days - 146096) / 146097;
+            const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+            const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+            const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+            const unsigned monthFromMarch = (5 * dayOfYear + 2) / 153;
+            day = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+            month = monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9;
+            year = static_cast<AZ::s64>(yearOfEra) + era * 400 + (month <= 2);
+        }
+
+        // Read count digits at text, returning false if any of them is not a digit
+        inline bool ParseDigits(const char* text, int count, unsigned& value)
+        {
+            value = 0;
+            unsigned invalid = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                unsigned digit = static_cast<unsigned>(text[i] - '0');
+                invalid |= digit > 9;
+                value = value * 10 + digit;
+            }
+            return invalid == 0;
+        }
+
+        // Parse "YYYY-MM-DD", optionally followed by "THH:MM", ":SS", a fraction of any length (read to the millisecond), and "Z" or a "+HH:MM" offset.
+        // A time with no zone is taken as UTC, which is how PlayFab writes them. Returns false, leaving epochMilliseconds unchanged, if the text is not a valid timestamp.
+        inline bool Parse(const char* text, size_t length, AZ::s64& epochMilliseconds)
+        {
+            unsigned year, month, day, hour = 0, minute = 0, second = 0, milliseconds = 0;
+            if (length < 10 || text[4] != '-' || text[7] != '-'
+                || !ParseDigits(text, 4, year) || !ParseDigits(text + 5, 2, month) || !ParseDigits(text + 8, 2, day))
+                return false;
+
+            size_t position = 10;
+            if (position < length && (text[position] == 'T' || text[position] == 't' || text[position] == ' '))
+            {
+                if (length < position + 6 || text[position + 3] != ':'
+                    || !ParseDigits(text + position + 1, 2, hour) || !ParseDigits(text + position + 4, 2, minute))
+                    return false;
+                position += 6;
+                if (position < length && text[position] == ':')
+                {
+                    if (length < position + 3 || !ParseDigits(text + position + 1, 2, second))
+                        return false;
+                    position += 3;
+                    if (position < length && (text[position] == '.' || text[position] == ','))
+                    {
+                        // Digits past the third are dropped, so .1 is 100ms and .1234567 is 123ms
+                        position++;
+                        size_t fractionStart = position;
+                        unsigned scale = 100;
+                        while (position < length && static_cast<unsigned>(text[position] - '0') <= 9)
+                        {
+                            milliseconds += (text[position] - '0') * scale;
+                            scale /= 10;
+                            position++;
+                        }
+                        if (position == fractionStart)
+                            return false;
+                    }
+                }
+            }
+
+            int offsetMinutes = 0;
+            if (position < length && (text[position] == 'Z' || text[position] == 'z'))
+                position++;
+            else if (position < length && (text[position] == '+' || text[position] == '-'))
+            {
+                unsigned offsetHours, offsetMins;
+                if (length < position + 6 || text[position + 3] != ':'
+                    || !ParseDigits(text + position + 1, 2, offsetHours) || !ParseDigits(text + position + 4, 2, offsetMins))
+                    return false;
+                offsetMinutes = static_cast<int>(offsetHours * 60 + offsetMins) * (text[position] == '-' ? -1 : 1);
+                position += 6;
+            }
+
+            static const unsigned char daysInMonth[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            if (position != length || month - 1 > 11 || day - 1 >= daysInMonth[month - 1] || hour > 23 || minute > 59 || second > 60)
+                return false;
+            if (month == 2 && day == 29 && (year % 4 != 0 || (year % 100 == 0 && year % 400 != 0)))
+                return false;
+
+            AZ::s64 seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600 + (static_cast<int>(minute) - offsetMinutes) * 60 + second;
+            epochMilliseconds = seconds * 1000 + milliseconds;
+            return true;
+        }
+
+        // Write "YYYY-MM-DDTHH:MM:SS.mmmZ" and a null terminator into buffer, which must hold FormattedLength + 1 characters.
+        // Times outside years 0000 to 9999 are clamped to that range. Returns FormattedLength.
+        inline size_t Format(AZ::s64 epochMilliseconds, char* buffer)
+        {
+            epochMilliseconds = epochMilliseconds < MinMilliseconds ? MinMilliseconds : (epochMilliseconds > MaxMilliseconds ? MaxMilliseconds : epochMilliseconds);
+
+            // Floor division, so times before 1970 still have a positive time of day
+            AZ::s64 days = (epochMilliseconds >= 0 ? epochMilliseconds : epochMilliseconds - 86399999) / 86400000;
+            unsigned millisecondOfDay = static_cast<unsigned>(epochMilliseconds - days * 86400000);
+            AZ::s64 year;
+            unsigned month, day;
+            CivilFromDays(days, year, month, day);
+
+            unsigned fields[] = { static_cast<unsigned>(year), month, day, millisecondOfDay / 3600000, millisecondOfDay / 60000 % 60, millisecondOfDay / 1000 % 60, millisecondOfDay % 1000 };
+            static const char separators[] = "--T::.";
+            static const int widths[] = { 4, 2, 2, 2, 2, 2, 3 };
+            char* out = buffer;
+            for (int field = 0; field < 7; ++field)
+            {
+                for (int digit = widths[field] - 1; digit >= 0; --digit)
+                {
+                    out[digit] = static_cast<char>('0' + fields[field] % 10);
+                    fields[field] /= 10;
+                }
+                out += widths[field];
+                *out++ = field < 6 ? separators[field] : 'Z';
+            }
+            *out = '\0';
+            return FormattedLength;
+        }
+    }
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "PlayFabBaseModel.h"
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/string.h>
+
+#include <string.h>
+
+namespace PlayFabServerSdk
+{
+    // The tokens of a response and the text they point into, kept after the request is finished for the lazy models which decode from them
+    class PlayFabRetainedResponse
+    {
+    public:
+        // Take over the tokens of reader, with a copy of the length characters of text they were parsed from in place
+        PlayFabRetainedResponse(PlayFabJsonReader& reader, const char* text, size_t length)
+            : m_text(new char[length + 1])
+        {
+            memcpy(m_text, text, length);
+            m_text[length] = '\0';
+            m_reader.Swap(reader);
+            m_reader.Relocate(text, m_text);
+        }
+
+        // Tokens for a value of a parsed Document, which is written back out to text to tokenize it
+        explicit PlayFabRetainedResponse(const rapidjson::Value& value)
+        {
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            value.Accept(writer);
+            m_text = new char[buffer.GetSize() + 1];
+            memcpy(m_text, buffer.GetString(), buffer.GetSize());
+            m_text[buffer.GetSize()] = '\0';
+            m_reader.Parse(m_text);
+        }
+
+        ~PlayFabRetainedResponse() { delete[] m_text; }
+
+        PlayFabJsonReader& GetReader() { return m_reader; }
+        // Held while the reader is positioned and read from, as every lazy model of the response moves the same cursor
+        AZStd::mutex& GetCursorMutex() { return m_cursorMutex; }
+
+    private:
+        // Disable copy constructor and assignment by making them private
+        PlayFabRetainedResponse(const PlayFabRetainedResponse&);
+        PlayFabRetainedResponse& operator=(const PlayFabRetainedResponse&);
+
+        char* m_text;
+        PlayFabJsonReader m_reader;
+        AZStd::mutex m_cursorMutex;
+    };
+
+    // A model which decodes each of its members from a retained response the first time it is asked for, and keeps it.
+    // The result of the ...Lazy api calls, so a caller reading one member of a large result only pays to decode that member.
+    // Copies, and the lazy models GetObject returns, share the retained response and its one reader cursor. Each access locks the cursor
+    // while it seeks and reads, so they can be used from different threads. Like the models, one lazy model must not be used from several threads at once.
+    template <typename ModelType>
+    class PlayFabLazyModel
+    {
+    public:
+        // Nothing to decode, the model stays default constructed
+        PlayFabLazyModel() : m_position(0), m_decodedAll(true) {}
+
+        // The object at position in response
+        PlayFabLazyModel(AZStd::shared_ptr<PlayFabRetainedResponse> response, size_t position)
+            : m_response(AZStd::move(response))
+            , m_position(position)
+            , m_decodedAll(false)
+        {}
+
+        // The data object of a response which PlayFabBaseModel::DecodeRequest accepted
+        explicit PlayFabLazyModel(PlayFabRequest* request)
+            : m_position(0)
+            , m_decodedAll(false)
+        {
+            if (request->mResponseReader != nullptr)
+            {
+                m_position = request->mResponseReader->GetPosition();
+                m_response = AZStd::make_shared<PlayFabRetainedResponse>(*request->mResponseReader, request->mResponseText, request->mResponseSize);
+            }
+            else
+                m_response = AZStd::make_shared<PlayFabRetainedResponse>(request->mResponseJson->FindMember("data")->value);
+        }
+
+        // The model with member decoded. Only the members asked for so far are set, the others keep their default values.
+        const ModelType& Get(const char* member) const
+        {
+            if (IsDecoded(member))
+                return m_model;
+            AZStd::lock_guard<AZStd::mutex> lock(m_response->GetCursorMutex());
+            PlayFabJsonReader& reader = m_response->GetReader();
+            reader.Seek(m_position);
+            reader.FilterMember(member);
+            m_model.readFromReader(reader);
+            m_decodedMembers.push_back(member);
+            return m_model;
+        }
+
+        // The model with every member decoded
+        const ModelType& Get() const
+        {
+            if (!m_decodedAll)
+            {
+                // Decoded afresh, as decoding a member a second time would append to its arrays again
+                m_model = ModelType();
+                Decode(m_model);
+                m_decodedAll = true;
+                m_decodedMembers.clear();
+            }
+            return m_model;
+        }
+
+        // Decode every member into a default constructed model the caller owns, rather than the one kept here.
+        // The model can be of any type with the same json shape, such as the same result from another api.
+        template <typename TargetType>
+        void Decode(TargetType& model) const
+        {
+            if (!m_response)
+                return;
+            AZStd::lock_guard<AZStd::mutex> lock(m_response->GetCursorMutex());
+            PlayFabJsonReader& reader = m_response->GetReader();
+            reader.Seek(m_position);
+            model.readFromReader(reader);
+        }
+
+        bool IsDecoded(const char* member) const
+        {
+            for (const AZStd::string& decoded : m_decodedMembers)
+            {
+                if (decoded == member)
+                    return true;
+            }
+            return m_decodedAll;
+        }
+
+        // A lazy model of the object in member, which decodes that object's members on first access in the same way. Decodes nothing itself.
+        // If member is missing or not an object, the lazy model returned is empty. It shares this model's retained response, and so its cursor.
+        template <typename MemberType>
+        PlayFabLazyModel<MemberType> GetObject(const char* member) const
+        {
+            if (!m_response)
+                return PlayFabLazyModel<MemberType>();
+            AZStd::lock_guard<AZStd::mutex> lock(m_response->GetCursorMutex());
+            PlayFabJsonReader& reader = m_response->GetReader();
+            reader.Seek(m_position);
+            if (!reader.FindMember(member) || !reader.IsObject())
+                return PlayFabLazyModel<MemberType>();
+            return PlayFabLazyModel<MemberType>(m_response, reader.GetPosition());
+        }
+
+        // Internal callback of the ...Lazy api calls
+        static void OnResult(PlayFabRequest* request)
+        {
+            if (PlayFabBaseModel::DecodeRequest(request))
+                PlayFabRequestManager::playFabHttp->DispatchResult(request, new PlayFabLazyModel<ModelType>(request));
+        }
+
+    private:
+        AZStd::shared_ptr<PlayFabRetainedResponse> m_response;
+        size_t m_position; // Of the model's object in the retained tokens
+        mutable ModelType m_model;
+        mutable AZStd::vector<AZStd::string> m_decodedMembers;
+        mutable bool m_decodedAll;
+    };
+}
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <PlayFabServerSdk/PlayFabHttp.h>
 
 namespace PlayFabServerSdk
 {
@@ -23,6 +24,12 @@ namespace PlayFabServerSdk
         virtual void SetDevSecretKey(AZStd::string newSecretKey) = 0;
         virtual AZStd::string GetDevSecretKey() = 0;
 
+        // Client side rate limits. A rate of 0 removes the limit.
+        virtual void SetTitleRateLimit(float ratePerSecond, float burst) = 0;
+        virtual void SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst) = 0; // callPath is the api path, such as "/Server/WriteTitleEvent"
+        virtual PlayFabRateLimitState GetTitleRateLimitState() = 0;
+        virtual PlayFabRateLimitState GetEndpointRateLimitState(AZStd::string callPath) = 0;
+
     };
 
     using PlayFabServer_SettingsRequestBus = AZ::EBus<PlayFabServer_SettingsRequests>;
@@ -0,0 +1,70 @@
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <PlayFabServerSdk/PlayFabServerDataModels.h>
+#include <PlayFabServerSdk/PlayFabAdminDataModels.h>
+
+namespace PlayFabServerSdk
+{
+    // Statistics aggregator counters since startup, see PlayFabServer_StatisticsRequests::GetStatisticsAggregatorStats
+    struct PlayFabStatisticsAggregatorStats
+    {
+        AZ::u64 queuedUpdates; // Every update passed to QueueStatisticUpdate
+        AZ::u64 sentStatistics; // Aggregated updates sent, at most one per player, statistic and version in each request
+        AZ::u64 sentRequests; // UpdatePlayerStatistics calls made, at most one per player per flush, including any which then returned an error
+        AZ::u64 failedRequests; // Calls which could not be sent, or returned an error once their retries were spent. Their statistics are queued again, see requeuedStatistics.
+        AZ::u64 requeuedStatistics; // Updates of failed calls merged back into the pending updates of their players
+        AZ::u64 lostStatistics; // Updates dropped after their player's calls failed every send attempt, each reported by OnStatisticUpdatesLost
+        int pendingPlayers; // Players with updates waiting for their flush
+        int pendingStatistics;
+    };
+
+    class PlayFabServer_StatisticsRequests
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        // Add update to the statistics waiting to be sent for playFabId, merged with any pending update of the same statistic and version by its
+        // aggregation method. The player's statistics are sent in one UpdatePlayerStatistics call once the flush interval has passed since their first update.
+        virtual void QueueStatisticUpdate(AZStd::string playFabId, ServerModels::StatisticUpdate update) = 0;
+        // How updates of statisticName are merged, which must match its definition on PlayFab. Statistics never set here are merged as Last,
+        // the method of a statistic created by UpdatePlayerStatistics.
+        virtual void SetStatisticAggregation(AZStd::string statisticName, AdminModels::StatisticAggregationMethod method) = 0;
+        // Fetch every statistic definition through the admin api, and use their aggregation methods
+        virtual void LoadStatisticAggregations() = 0;
+
+        // Send the pending updates of playFabId now, for a player leaving or the end of a match. If the player's previous call has not completed
+        // they are sent as soon as it does, so two calls for a player are never in flight together.
+        virtual void FlushStatistics(AZStd::string playFabId) = 0;
+        // Send every pending update now, in the same way. This is also done when the gem shuts down.
+        virtual void FlushAllStatistics() = 0;
+        virtual void SetStatisticsFlushInterval(int seconds) = 0;
+
+        virtual PlayFabStatisticsAggregatorStats GetStatisticsAggregatorStats() = 0;
+
+    };
+
+    using PlayFabServer_StatisticsRequestBus = AZ::EBus<PlayFabServer_StatisticsRequests>;
+
+    class PlayFabServer_StatisticsNotifications
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using MutexType = AZStd::recursive_mutex; // Sent from whichever thread delivered the failed call
+
+        // Aggregated statistics updates of playFabId were dropped, after every attempt to send them failed.
+        // Sent on the main thread when PlayFabSettings::callbacksOnMainThread is set, otherwise on an http worker.
+        virtual void OnStatisticUpdatesLost(const AZStd::string& playFabId, const std::vector<ServerModels::StatisticUpdate>& statistics) { (void)playFabId; (void)statistics; }
+
+    };
+
+    using PlayFabServer_StatisticsNotificationBus = AZ::EBus<PlayFabServer_StatisticsNotifications>;
+} // namespace PlayFabServerSdk
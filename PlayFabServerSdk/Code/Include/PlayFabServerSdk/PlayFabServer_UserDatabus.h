@@ -0,0 +1,83 @@
+
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <PlayFabServerSdk/PlayFabServerDataModels.h>
+
+namespace PlayFabServerSdk
+{
+    // The UpdateUser*Data api a buffered write is sent through
+    enum PlayFabUserDataKind
+    {
+        PlayFabUserData,
+        PlayFabUserInternalData,
+        PlayFabUserReadOnlyData,
+        PlayFabUserPublisherData,
+        PlayFabUserPublisherInternalData,
+        PlayFabUserPublisherReadOnlyData,
+        PlayFabUserDataKindCount
+    };
+
+    // User data write buffer counters since startup, see PlayFabServer_UserDataRequests::GetUserDataWriteStats.
+    // queuedKeys / sentKeys is how many writes each sent key replaced, queuedUpdates / sentRequests how many calls each request replaced.
+    struct PlayFabUserDataWriteStats
+    {
+        AZ::u64 queuedUpdates; // Every update passed to QueueUserDataUpdate, each of which would otherwise have been one call
+        AZ::u64 queuedKeys; // Keys written or removed by those updates
+        AZ::u64 coalescedKeys; // Keys which replaced a pending write or removal of the same key, so the earlier one was never sent
+        AZ::u64 sentKeys;
+        AZ::u64 sentRequests; // UpdateUser*Data calls made, including any which then returned an error
+        AZ::u64 splitRequests; // Calls beyond the first for one player and kind, for keys with another permission or beyond the keys per call limit
+        AZ::u64 failedRequests; // Calls which could not be sent, or returned an error once their retries were spent. Their keys are queued again, see requeuedKeys.
+        AZ::u64 requeuedKeys; // Keys of failed calls queued again, as no newer change to them had been queued since
+        AZ::u64 lostKeys; // Keys dropped after failing every send attempt, each reported by OnUserDataWriteLost
+        int pendingPlayers; // Players with keys waiting for their flush
+        int pendingKeys;
+    };
+
+    class PlayFabServer_UserDataRequests
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        // Buffer the writes and removals of request for its PlayFabId, to be sent through the api of kind. A key written or removed again before the
+        // flush replaces the pending change, as the last write would win on PlayFab. Permission is kept per key, and ignored for the internal kinds.
+        // The flush interval runs from the first pending change of each player and kind, and the next flush waits for the previous one to complete,
+        // so changes to a key reach PlayFab in order.
+        virtual void QueueUserDataUpdate(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest request) = 0;
+
+        // Send the pending changes of playFabId now. Those of a kind whose previous flush has not completed are sent as soon as it does,
+        // so two writes to a key are never in flight together.
+        virtual void FlushUserData(AZStd::string playFabId) = 0;
+        // Send every pending change now, in the same way. This is also done when the gem shuts down.
+        virtual void FlushAllUserData() = 0;
+        virtual void SetUserDataFlushInterval(int seconds) = 0;
+
+        virtual PlayFabUserDataWriteStats GetUserDataWriteStats() = 0;
+
+    };
+
+    using PlayFabServer_UserDataRequestBus = AZ::EBus<PlayFabServer_UserDataRequests>;
+
+    class PlayFabServer_UserDataNotifications
+        : public AZ::EBusTraits
+    {
+
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        using MutexType = AZStd::recursive_mutex; // Sent from whichever thread delivered the failed call
+
+        // Buffered changes to keys of playFabId were dropped, after every attempt to send them failed.
+        // Sent on the main thread when PlayFabSettings::callbacksOnMainThread is set, otherwise on an http worker.
+        virtual void OnUserDataWriteLost(PlayFabUserDataKind kind, const AZStd::string& playFabId, const AZStd::vector<AZStd::string>& keys) { (void)kind; (void)playFabId; (void)keys; }
+
+    };
+
+    using PlayFabServer_UserDataNotificationBus = AZ::EBus<PlayFabServer_UserDataNotifications>;
+} // namespace PlayFabServerSdk
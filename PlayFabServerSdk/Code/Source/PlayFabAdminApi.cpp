@@ -11,12 +11,13 @@ void PlayFabAdminApi::CreatePlayerSharedSecret(
     AdminModels::CreatePlayerSharedSecretRequest& request,
     ProcessApiCallback<AdminModels::CreatePlayerSharedSecretResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreatePlayerSharedSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnCreatePlayerSharedSecretResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreatePlayerSharedSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnCreatePlayerSharedSecretResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnCreatePlayerSharedSecretResult(PlayFabRequest* request)
@@ -24,16 +25,10 @@ void PlayFabAdminApi::OnCreatePlayerSharedSecretResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::CreatePlayerSharedSecretResult* outResult = new AdminModels::CreatePlayerSharedSecretResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::CreatePlayerSharedSecretResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::CreatePlayerSharedSecretResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -41,12 +36,13 @@ void PlayFabAdminApi::DeletePlayerSharedSecret(
     AdminModels::DeletePlayerSharedSecretRequest& request,
     ProcessApiCallback<AdminModels::DeletePlayerSharedSecretResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeletePlayerSharedSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnDeletePlayerSharedSecretResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeletePlayerSharedSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnDeletePlayerSharedSecretResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnDeletePlayerSharedSecretResult(PlayFabRequest* request)
@@ -54,16 +50,10 @@ void PlayFabAdminApi::OnDeletePlayerSharedSecretResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::DeletePlayerSharedSecretResult* outResult = new AdminModels::DeletePlayerSharedSecretResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::DeletePlayerSharedSecretResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::DeletePlayerSharedSecretResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -71,12 +61,13 @@ void PlayFabAdminApi::GetPlayerSharedSecrets(
 
     ProcessApiCallback<AdminModels::GetPlayerSharedSecretsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerSharedSecrets"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnGetPlayerSharedSecretsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPlayerSharedSecretsResult(PlayFabRequest* request)
@@ -84,16 +75,10 @@ void PlayFabAdminApi::OnGetPlayerSharedSecretsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPlayerSharedSecretsResult* outResult = new AdminModels::GetPlayerSharedSecretsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPlayerSharedSecretsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPlayerSharedSecretsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -101,12 +86,13 @@ void PlayFabAdminApi::GetPolicy(
     AdminModels::GetPolicyRequest& request,
     ProcessApiCallback<AdminModels::GetPolicyResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPolicy"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetPolicyResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPolicy"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetPolicyResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPolicyResult(PlayFabRequest* request)
@@ -114,16 +100,10 @@ void PlayFabAdminApi::OnGetPolicyResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPolicyResponse* outResult = new AdminModels::GetPolicyResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPolicyResponse> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPolicyResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -131,12 +111,13 @@ void PlayFabAdminApi::SetPlayerSecret(
     AdminModels::SetPlayerSecretRequest& request,
     ProcessApiCallback<AdminModels::SetPlayerSecretResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetPlayerSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetPlayerSecretResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetPlayerSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetPlayerSecretResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetPlayerSecretResult(PlayFabRequest* request)
@@ -144,16 +125,10 @@ void PlayFabAdminApi::OnSetPlayerSecretResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SetPlayerSecretResult* outResult = new AdminModels::SetPlayerSecretResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SetPlayerSecretResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SetPlayerSecretResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -161,12 +136,13 @@ void PlayFabAdminApi::UpdatePlayerSharedSecret(
     AdminModels::UpdatePlayerSharedSecretRequest& request,
     ProcessApiCallback<AdminModels::UpdatePlayerSharedSecretResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdatePlayerSharedSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdatePlayerSharedSecretResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdatePlayerSharedSecret"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdatePlayerSharedSecretResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdatePlayerSharedSecretResult(PlayFabRequest* request)
@@ -174,16 +150,10 @@ void PlayFabAdminApi::OnUpdatePlayerSharedSecretResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdatePlayerSharedSecretResult* outResult = new AdminModels::UpdatePlayerSharedSecretResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdatePlayerSharedSecretResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdatePlayerSharedSecretResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -191,12 +161,13 @@ void PlayFabAdminApi::UpdatePolicy(
     AdminModels::UpdatePolicyRequest& request,
     ProcessApiCallback<AdminModels::UpdatePolicyResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdatePolicy"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdatePolicyResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdatePolicy"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdatePolicyResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdatePolicyResult(PlayFabRequest* request)
@@ -204,16 +175,10 @@ void PlayFabAdminApi::OnUpdatePolicyResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdatePolicyResponse* outResult = new AdminModels::UpdatePolicyResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdatePolicyResponse> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdatePolicyResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -221,12 +186,13 @@ void PlayFabAdminApi::BanUsers(
     AdminModels::BanUsersRequest& request,
     ProcessApiCallback<AdminModels::BanUsersResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/BanUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnBanUsersResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/BanUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnBanUsersResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnBanUsersResult(PlayFabRequest* request)
@@ -234,16 +200,10 @@ void PlayFabAdminApi::OnBanUsersResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::BanUsersResult* outResult = new AdminModels::BanUsersResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::BanUsersResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::BanUsersResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -251,12 +211,13 @@ void PlayFabAdminApi::DeletePlayer(
     AdminModels::DeletePlayerRequest& request,
     ProcessApiCallback<AdminModels::DeletePlayerResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeletePlayer"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnDeletePlayerResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeletePlayer"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnDeletePlayerResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnDeletePlayerResult(PlayFabRequest* request)
@@ -264,16 +225,10 @@ void PlayFabAdminApi::OnDeletePlayerResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::DeletePlayerResult* outResult = new AdminModels::DeletePlayerResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::DeletePlayerResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::DeletePlayerResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -281,12 +236,13 @@ void PlayFabAdminApi::GetUserAccountInfo(
     AdminModels::LookupUserAccountInfoRequest& request,
     ProcessApiCallback<AdminModels::LookupUserAccountInfoResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserAccountInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserAccountInfoResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserAccountInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserAccountInfoResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserAccountInfoResult(PlayFabRequest* request)
@@ -294,16 +250,10 @@ void PlayFabAdminApi::OnGetUserAccountInfoResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::LookupUserAccountInfoResult* outResult = new AdminModels::LookupUserAccountInfoResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::LookupUserAccountInfoResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::LookupUserAccountInfoResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -311,12 +261,13 @@ void PlayFabAdminApi::GetUserBans(
     AdminModels::GetUserBansRequest& request,
     ProcessApiCallback<AdminModels::GetUserBansResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserBans"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserBansResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserBans"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserBansResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserBansResult(PlayFabRequest* request)
@@ -324,16 +275,10 @@ void PlayFabAdminApi::OnGetUserBansResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserBansResult* outResult = new AdminModels::GetUserBansResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserBansResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserBansResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -341,12 +286,13 @@ void PlayFabAdminApi::ResetUsers(
     AdminModels::ResetUsersRequest& request,
     ProcessApiCallback<AdminModels::BlankResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResetUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnResetUsersResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResetUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnResetUsersResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnResetUsersResult(PlayFabRequest* request)
@@ -354,16 +300,10 @@ void PlayFabAdminApi::OnResetUsersResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::BlankResult* outResult = new AdminModels::BlankResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::BlankResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::BlankResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -371,12 +311,13 @@ void PlayFabAdminApi::RevokeAllBansForUser(
     AdminModels::RevokeAllBansForUserRequest& request,
     ProcessApiCallback<AdminModels::RevokeAllBansForUserResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RevokeAllBansForUser"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRevokeAllBansForUserResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RevokeAllBansForUser"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRevokeAllBansForUserResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRevokeAllBansForUserResult(PlayFabRequest* request)
@@ -384,16 +325,10 @@ void PlayFabAdminApi::OnRevokeAllBansForUserResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RevokeAllBansForUserResult* outResult = new AdminModels::RevokeAllBansForUserResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RevokeAllBansForUserResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RevokeAllBansForUserResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -401,12 +336,13 @@ void PlayFabAdminApi::RevokeBans(
     AdminModels::RevokeBansRequest& request,
     ProcessApiCallback<AdminModels::RevokeBansResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RevokeBans"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRevokeBansResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RevokeBans"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRevokeBansResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRevokeBansResult(PlayFabRequest* request)
@@ -414,16 +350,10 @@ void PlayFabAdminApi::OnRevokeBansResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RevokeBansResult* outResult = new AdminModels::RevokeBansResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RevokeBansResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RevokeBansResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -431,12 +361,13 @@ void PlayFabAdminApi::SendAccountRecoveryEmail(
     AdminModels::SendAccountRecoveryEmailRequest& request,
     ProcessApiCallback<AdminModels::SendAccountRecoveryEmailResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SendAccountRecoveryEmail"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSendAccountRecoveryEmailResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SendAccountRecoveryEmail"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSendAccountRecoveryEmailResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSendAccountRecoveryEmailResult(PlayFabRequest* request)
@@ -444,16 +375,10 @@ void PlayFabAdminApi::OnSendAccountRecoveryEmailResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SendAccountRecoveryEmailResult* outResult = new AdminModels::SendAccountRecoveryEmailResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SendAccountRecoveryEmailResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SendAccountRecoveryEmailResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -461,12 +386,13 @@ void PlayFabAdminApi::UpdateBans(
     AdminModels::UpdateBansRequest& request,
     ProcessApiCallback<AdminModels::UpdateBansResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateBans"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateBansResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateBans"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateBansResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateBansResult(PlayFabRequest* request)
@@ -474,16 +400,10 @@ void PlayFabAdminApi::OnUpdateBansResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateBansResult* outResult = new AdminModels::UpdateBansResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateBansResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateBansResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -491,12 +411,13 @@ void PlayFabAdminApi::UpdateUserTitleDisplayName(
     AdminModels::UpdateUserTitleDisplayNameRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserTitleDisplayName"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserTitleDisplayNameResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserTitleDisplayName"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserTitleDisplayNameResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserTitleDisplayNameResult(PlayFabRequest* request)
@@ -504,16 +425,10 @@ void PlayFabAdminApi::OnUpdateUserTitleDisplayNameResult(PlayFabRequest* request
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserTitleDisplayNameResult* outResult = new AdminModels::UpdateUserTitleDisplayNameResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserTitleDisplayNameResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -521,12 +436,13 @@ void PlayFabAdminApi::CreatePlayerStatisticDefinition(
     AdminModels::CreatePlayerStatisticDefinitionRequest& request,
     ProcessApiCallback<AdminModels::CreatePlayerStatisticDefinitionResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreatePlayerStatisticDefinition"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnCreatePlayerStatisticDefinitionResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreatePlayerStatisticDefinition"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnCreatePlayerStatisticDefinitionResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnCreatePlayerStatisticDefinitionResult(PlayFabRequest* request)
@@ -534,16 +450,10 @@ void PlayFabAdminApi::OnCreatePlayerStatisticDefinitionResult(PlayFabRequest* re
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::CreatePlayerStatisticDefinitionResult* outResult = new AdminModels::CreatePlayerStatisticDefinitionResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::CreatePlayerStatisticDefinitionResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::CreatePlayerStatisticDefinitionResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -551,12 +461,13 @@ void PlayFabAdminApi::DeleteUsers(
     AdminModels::DeleteUsersRequest& request,
     ProcessApiCallback<AdminModels::DeleteUsersResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnDeleteUsersResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnDeleteUsersResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnDeleteUsersResult(PlayFabRequest* request)
@@ -564,16 +475,10 @@ void PlayFabAdminApi::OnDeleteUsersResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::DeleteUsersResult* outResult = new AdminModels::DeleteUsersResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::DeleteUsersResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::DeleteUsersResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -581,12 +486,13 @@ void PlayFabAdminApi::GetDataReport(
     AdminModels::GetDataReportRequest& request,
     ProcessApiCallback<AdminModels::GetDataReportResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetDataReport"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetDataReportResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetDataReport"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetDataReportResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetDataReportResult(PlayFabRequest* request)
@@ -594,16 +500,10 @@ void PlayFabAdminApi::OnGetDataReportResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetDataReportResult* outResult = new AdminModels::GetDataReportResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetDataReportResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetDataReportResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -611,12 +511,13 @@ void PlayFabAdminApi::GetPlayerStatisticDefinitions(
 
     ProcessApiCallback<AdminModels::GetPlayerStatisticDefinitionsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerStatisticDefinitions"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnGetPlayerStatisticDefinitionsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPlayerStatisticDefinitionsResult(PlayFabRequest* request)
@@ -624,16 +525,10 @@ void PlayFabAdminApi::OnGetPlayerStatisticDefinitionsResult(PlayFabRequest* requ
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPlayerStatisticDefinitionsResult* outResult = new AdminModels::GetPlayerStatisticDefinitionsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPlayerStatisticDefinitionsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPlayerStatisticDefinitionsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -641,12 +536,13 @@ void PlayFabAdminApi::GetPlayerStatisticVersions(
     AdminModels::GetPlayerStatisticVersionsRequest& request,
     ProcessApiCallback<AdminModels::GetPlayerStatisticVersionsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerStatisticVersions"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetPlayerStatisticVersionsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerStatisticVersions"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetPlayerStatisticVersionsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPlayerStatisticVersionsResult(PlayFabRequest* request)
@@ -654,16 +550,10 @@ void PlayFabAdminApi::OnGetPlayerStatisticVersionsResult(PlayFabRequest* request
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPlayerStatisticVersionsResult* outResult = new AdminModels::GetPlayerStatisticVersionsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPlayerStatisticVersionsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPlayerStatisticVersionsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -671,12 +561,13 @@ void PlayFabAdminApi::GetUserData(
     AdminModels::GetUserDataRequest& request,
     ProcessApiCallback<AdminModels::GetUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserDataResult(PlayFabRequest* request)
@@ -684,16 +575,10 @@ void PlayFabAdminApi::OnGetUserDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserDataResult* outResult = new AdminModels::GetUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -701,12 +586,13 @@ void PlayFabAdminApi::GetUserInternalData(
     AdminModels::GetUserDataRequest& request,
     ProcessApiCallback<AdminModels::GetUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserInternalDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserInternalDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserInternalDataResult(PlayFabRequest* request)
@@ -714,16 +600,10 @@ void PlayFabAdminApi::OnGetUserInternalDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserDataResult* outResult = new AdminModels::GetUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -731,12 +611,13 @@ void PlayFabAdminApi::GetUserPublisherData(
     AdminModels::GetUserDataRequest& request,
     ProcessApiCallback<AdminModels::GetUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserPublisherDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserPublisherDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserPublisherDataResult(PlayFabRequest* request)
@@ -744,16 +625,10 @@ void PlayFabAdminApi::OnGetUserPublisherDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserDataResult* outResult = new AdminModels::GetUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -761,12 +636,13 @@ void PlayFabAdminApi::GetUserPublisherInternalData(
     AdminModels::GetUserDataRequest& request,
     ProcessApiCallback<AdminModels::GetUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserPublisherInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserPublisherInternalDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserPublisherInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserPublisherInternalDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserPublisherInternalDataResult(PlayFabRequest* request)
@@ -774,16 +650,10 @@ void PlayFabAdminApi::OnGetUserPublisherInternalDataResult(PlayFabRequest* reque
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserDataResult* outResult = new AdminModels::GetUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -791,12 +661,13 @@ void PlayFabAdminApi::GetUserPublisherReadOnlyData(
     AdminModels::GetUserDataRequest& request,
     ProcessApiCallback<AdminModels::GetUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserPublisherReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserPublisherReadOnlyDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserPublisherReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserPublisherReadOnlyDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserPublisherReadOnlyDataResult(PlayFabRequest* request)
@@ -804,16 +675,10 @@ void PlayFabAdminApi::OnGetUserPublisherReadOnlyDataResult(PlayFabRequest* reque
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserDataResult* outResult = new AdminModels::GetUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -821,12 +686,13 @@ void PlayFabAdminApi::GetUserReadOnlyData(
     AdminModels::GetUserDataRequest& request,
     ProcessApiCallback<AdminModels::GetUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserReadOnlyDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserReadOnlyDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserReadOnlyDataResult(PlayFabRequest* request)
@@ -834,16 +700,10 @@ void PlayFabAdminApi::OnGetUserReadOnlyDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserDataResult* outResult = new AdminModels::GetUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -851,12 +711,13 @@ void PlayFabAdminApi::IncrementPlayerStatisticVersion(
     AdminModels::IncrementPlayerStatisticVersionRequest& request,
     ProcessApiCallback<AdminModels::IncrementPlayerStatisticVersionResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/IncrementPlayerStatisticVersion"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnIncrementPlayerStatisticVersionResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/IncrementPlayerStatisticVersion"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnIncrementPlayerStatisticVersionResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnIncrementPlayerStatisticVersionResult(PlayFabRequest* request)
@@ -864,16 +725,10 @@ void PlayFabAdminApi::OnIncrementPlayerStatisticVersionResult(PlayFabRequest* re
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::IncrementPlayerStatisticVersionResult* outResult = new AdminModels::IncrementPlayerStatisticVersionResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::IncrementPlayerStatisticVersionResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::IncrementPlayerStatisticVersionResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -881,12 +736,13 @@ void PlayFabAdminApi::RefundPurchase(
     AdminModels::RefundPurchaseRequest& request,
     ProcessApiCallback<AdminModels::RefundPurchaseResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RefundPurchase"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRefundPurchaseResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RefundPurchase"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRefundPurchaseResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRefundPurchaseResult(PlayFabRequest* request)
@@ -894,16 +750,10 @@ void PlayFabAdminApi::OnRefundPurchaseResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RefundPurchaseResponse* outResult = new AdminModels::RefundPurchaseResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RefundPurchaseResponse> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RefundPurchaseResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -911,12 +761,13 @@ void PlayFabAdminApi::ResetUserStatistics(
     AdminModels::ResetUserStatisticsRequest& request,
     ProcessApiCallback<AdminModels::ResetUserStatisticsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResetUserStatistics"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnResetUserStatisticsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResetUserStatistics"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnResetUserStatisticsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnResetUserStatisticsResult(PlayFabRequest* request)
@@ -924,16 +775,10 @@ void PlayFabAdminApi::OnResetUserStatisticsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ResetUserStatisticsResult* outResult = new AdminModels::ResetUserStatisticsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ResetUserStatisticsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ResetUserStatisticsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -941,12 +786,13 @@ void PlayFabAdminApi::ResolvePurchaseDispute(
     AdminModels::ResolvePurchaseDisputeRequest& request,
     ProcessApiCallback<AdminModels::ResolvePurchaseDisputeResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResolvePurchaseDispute"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnResolvePurchaseDisputeResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResolvePurchaseDispute"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnResolvePurchaseDisputeResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnResolvePurchaseDisputeResult(PlayFabRequest* request)
@@ -954,16 +800,10 @@ void PlayFabAdminApi::OnResolvePurchaseDisputeResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ResolvePurchaseDisputeResponse* outResult = new AdminModels::ResolvePurchaseDisputeResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ResolvePurchaseDisputeResponse> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ResolvePurchaseDisputeResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -971,12 +811,13 @@ void PlayFabAdminApi::UpdatePlayerStatisticDefinition(
     AdminModels::UpdatePlayerStatisticDefinitionRequest& request,
     ProcessApiCallback<AdminModels::UpdatePlayerStatisticDefinitionResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdatePlayerStatisticDefinition"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdatePlayerStatisticDefinitionResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdatePlayerStatisticDefinition"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdatePlayerStatisticDefinitionResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdatePlayerStatisticDefinitionResult(PlayFabRequest* request)
@@ -984,16 +825,10 @@ void PlayFabAdminApi::OnUpdatePlayerStatisticDefinitionResult(PlayFabRequest* re
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdatePlayerStatisticDefinitionResult* outResult = new AdminModels::UpdatePlayerStatisticDefinitionResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdatePlayerStatisticDefinitionResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdatePlayerStatisticDefinitionResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1001,12 +836,13 @@ void PlayFabAdminApi::UpdateUserData(
     AdminModels::UpdateUserDataRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserDataResult(PlayFabRequest* request)
@@ -1014,16 +850,10 @@ void PlayFabAdminApi::OnUpdateUserDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserDataResult* outResult = new AdminModels::UpdateUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1031,12 +861,13 @@ void PlayFabAdminApi::UpdateUserInternalData(
     AdminModels::UpdateUserInternalDataRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserInternalDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserInternalDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserInternalDataResult(PlayFabRequest* request)
@@ -1044,16 +875,10 @@ void PlayFabAdminApi::OnUpdateUserInternalDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserDataResult* outResult = new AdminModels::UpdateUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1061,12 +886,13 @@ void PlayFabAdminApi::UpdateUserPublisherData(
     AdminModels::UpdateUserDataRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserPublisherDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserPublisherDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserPublisherDataResult(PlayFabRequest* request)
@@ -1074,16 +900,10 @@ void PlayFabAdminApi::OnUpdateUserPublisherDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserDataResult* outResult = new AdminModels::UpdateUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1091,12 +911,13 @@ void PlayFabAdminApi::UpdateUserPublisherInternalData(
     AdminModels::UpdateUserInternalDataRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserPublisherInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserPublisherInternalDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserPublisherInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserPublisherInternalDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserPublisherInternalDataResult(PlayFabRequest* request)
@@ -1104,16 +925,10 @@ void PlayFabAdminApi::OnUpdateUserPublisherInternalDataResult(PlayFabRequest* re
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserDataResult* outResult = new AdminModels::UpdateUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1121,12 +936,13 @@ void PlayFabAdminApi::UpdateUserPublisherReadOnlyData(
     AdminModels::UpdateUserDataRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserPublisherReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserPublisherReadOnlyDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserPublisherReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserPublisherReadOnlyDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserPublisherReadOnlyDataResult(PlayFabRequest* request)
@@ -1134,16 +950,10 @@ void PlayFabAdminApi::OnUpdateUserPublisherReadOnlyDataResult(PlayFabRequest* re
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserDataResult* outResult = new AdminModels::UpdateUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1151,12 +961,13 @@ void PlayFabAdminApi::UpdateUserReadOnlyData(
     AdminModels::UpdateUserDataRequest& request,
     ProcessApiCallback<AdminModels::UpdateUserDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateUserReadOnlyDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateUserReadOnlyData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateUserReadOnlyDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateUserReadOnlyDataResult(PlayFabRequest* request)
@@ -1164,16 +975,10 @@ void PlayFabAdminApi::OnUpdateUserReadOnlyDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateUserDataResult* outResult = new AdminModels::UpdateUserDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateUserDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateUserDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1181,12 +986,13 @@ void PlayFabAdminApi::AddNews(
     AdminModels::AddNewsRequest& request,
     ProcessApiCallback<AdminModels::AddNewsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddNews"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAddNewsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddNews"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAddNewsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnAddNewsResult(PlayFabRequest* request)
@@ -1194,16 +1000,10 @@ void PlayFabAdminApi::OnAddNewsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::AddNewsResult* outResult = new AdminModels::AddNewsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::AddNewsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::AddNewsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1211,12 +1011,13 @@ void PlayFabAdminApi::AddVirtualCurrencyTypes(
     AdminModels::AddVirtualCurrencyTypesRequest& request,
     ProcessApiCallback<AdminModels::BlankResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddVirtualCurrencyTypes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAddVirtualCurrencyTypesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddVirtualCurrencyTypes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAddVirtualCurrencyTypesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnAddVirtualCurrencyTypesResult(PlayFabRequest* request)
@@ -1224,16 +1025,10 @@ void PlayFabAdminApi::OnAddVirtualCurrencyTypesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::BlankResult* outResult = new AdminModels::BlankResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::BlankResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::BlankResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1241,12 +1036,13 @@ void PlayFabAdminApi::DeleteStore(
     AdminModels::DeleteStoreRequest& request,
     ProcessApiCallback<AdminModels::DeleteStoreResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteStore"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnDeleteStoreResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteStore"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnDeleteStoreResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnDeleteStoreResult(PlayFabRequest* request)
@@ -1254,16 +1050,10 @@ void PlayFabAdminApi::OnDeleteStoreResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::DeleteStoreResult* outResult = new AdminModels::DeleteStoreResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::DeleteStoreResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::DeleteStoreResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1271,12 +1061,13 @@ void PlayFabAdminApi::GetCatalogItems(
     AdminModels::GetCatalogItemsRequest& request,
     ProcessApiCallback<AdminModels::GetCatalogItemsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetCatalogItemsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetCatalogItemsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetCatalogItemsResult(PlayFabRequest* request)
@@ -1284,16 +1075,10 @@ void PlayFabAdminApi::OnGetCatalogItemsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetCatalogItemsResult* outResult = new AdminModels::GetCatalogItemsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetCatalogItemsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetCatalogItemsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1301,12 +1086,13 @@ void PlayFabAdminApi::GetPublisherData(
     AdminModels::GetPublisherDataRequest& request,
     ProcessApiCallback<AdminModels::GetPublisherDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetPublisherDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetPublisherDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPublisherDataResult(PlayFabRequest* request)
@@ -1314,16 +1100,10 @@ void PlayFabAdminApi::OnGetPublisherDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPublisherDataResult* outResult = new AdminModels::GetPublisherDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPublisherDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPublisherDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1331,12 +1111,13 @@ void PlayFabAdminApi::GetRandomResultTables(
     AdminModels::GetRandomResultTablesRequest& request,
     ProcessApiCallback<AdminModels::GetRandomResultTablesResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetRandomResultTables"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetRandomResultTablesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetRandomResultTables"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetRandomResultTablesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetRandomResultTablesResult(PlayFabRequest* request)
@@ -1344,16 +1125,10 @@ void PlayFabAdminApi::OnGetRandomResultTablesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetRandomResultTablesResult* outResult = new AdminModels::GetRandomResultTablesResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetRandomResultTablesResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetRandomResultTablesResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1361,12 +1136,13 @@ void PlayFabAdminApi::GetStoreItems(
     AdminModels::GetStoreItemsRequest& request,
     ProcessApiCallback<AdminModels::GetStoreItemsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetStoreItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetStoreItemsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetStoreItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetStoreItemsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetStoreItemsResult(PlayFabRequest* request)
@@ -1374,16 +1150,10 @@ void PlayFabAdminApi::OnGetStoreItemsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetStoreItemsResult* outResult = new AdminModels::GetStoreItemsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetStoreItemsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetStoreItemsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1391,12 +1161,13 @@ void PlayFabAdminApi::GetTitleData(
     AdminModels::GetTitleDataRequest& request,
     ProcessApiCallback<AdminModels::GetTitleDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTitleData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetTitleDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTitleData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetTitleDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetTitleDataResult(PlayFabRequest* request)
@@ -1404,16 +1175,10 @@ void PlayFabAdminApi::OnGetTitleDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetTitleDataResult* outResult = new AdminModels::GetTitleDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetTitleDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetTitleDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1421,12 +1186,13 @@ void PlayFabAdminApi::GetTitleInternalData(
     AdminModels::GetTitleDataRequest& request,
     ProcessApiCallback<AdminModels::GetTitleDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTitleInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetTitleInternalDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTitleInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetTitleInternalDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetTitleInternalDataResult(PlayFabRequest* request)
@@ -1434,16 +1200,10 @@ void PlayFabAdminApi::OnGetTitleInternalDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetTitleDataResult* outResult = new AdminModels::GetTitleDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetTitleDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetTitleDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1451,12 +1211,13 @@ void PlayFabAdminApi::ListVirtualCurrencyTypes(
 
     ProcessApiCallback<AdminModels::ListVirtualCurrencyTypesResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ListVirtualCurrencyTypes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnListVirtualCurrencyTypesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnListVirtualCurrencyTypesResult(PlayFabRequest* request)
@@ -1464,16 +1225,10 @@ void PlayFabAdminApi::OnListVirtualCurrencyTypesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ListVirtualCurrencyTypesResult* outResult = new AdminModels::ListVirtualCurrencyTypesResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ListVirtualCurrencyTypesResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ListVirtualCurrencyTypesResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1481,12 +1236,13 @@ void PlayFabAdminApi::RemoveVirtualCurrencyTypes(
     AdminModels::RemoveVirtualCurrencyTypesRequest& request,
     ProcessApiCallback<AdminModels::BlankResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RemoveVirtualCurrencyTypes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRemoveVirtualCurrencyTypesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RemoveVirtualCurrencyTypes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRemoveVirtualCurrencyTypesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRemoveVirtualCurrencyTypesResult(PlayFabRequest* request)
@@ -1494,16 +1250,10 @@ void PlayFabAdminApi::OnRemoveVirtualCurrencyTypesResult(PlayFabRequest* request
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::BlankResult* outResult = new AdminModels::BlankResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::BlankResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::BlankResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1511,12 +1261,13 @@ void PlayFabAdminApi::SetCatalogItems(
     AdminModels::UpdateCatalogItemsRequest& request,
     ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetCatalogItemsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetCatalogItemsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetCatalogItemsResult(PlayFabRequest* request)
@@ -1524,16 +1275,10 @@ void PlayFabAdminApi::OnSetCatalogItemsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateCatalogItemsResult* outResult = new AdminModels::UpdateCatalogItemsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateCatalogItemsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1541,12 +1286,13 @@ void PlayFabAdminApi::SetStoreItems(
     AdminModels::UpdateStoreItemsRequest& request,
     ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetStoreItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetStoreItemsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetStoreItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetStoreItemsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetStoreItemsResult(PlayFabRequest* request)
@@ -1554,16 +1300,10 @@ void PlayFabAdminApi::OnSetStoreItemsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateStoreItemsResult* outResult = new AdminModels::UpdateStoreItemsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateStoreItemsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateStoreItemsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1571,12 +1311,13 @@ void PlayFabAdminApi::SetTitleData(
     AdminModels::SetTitleDataRequest& request,
     ProcessApiCallback<AdminModels::SetTitleDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetTitleData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetTitleDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetTitleData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetTitleDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetTitleDataResult(PlayFabRequest* request)
@@ -1584,16 +1325,10 @@ void PlayFabAdminApi::OnSetTitleDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SetTitleDataResult* outResult = new AdminModels::SetTitleDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SetTitleDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SetTitleDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1601,12 +1336,13 @@ void PlayFabAdminApi::SetTitleInternalData(
     AdminModels::SetTitleDataRequest& request,
     ProcessApiCallback<AdminModels::SetTitleDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetTitleInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetTitleInternalDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetTitleInternalData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetTitleInternalDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetTitleInternalDataResult(PlayFabRequest* request)
@@ -1614,16 +1350,10 @@ void PlayFabAdminApi::OnSetTitleInternalDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SetTitleDataResult* outResult = new AdminModels::SetTitleDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SetTitleDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SetTitleDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1631,12 +1361,13 @@ void PlayFabAdminApi::SetupPushNotification(
     AdminModels::SetupPushNotificationRequest& request,
     ProcessApiCallback<AdminModels::SetupPushNotificationResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetupPushNotification"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetupPushNotificationResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetupPushNotification"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetupPushNotificationResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetupPushNotificationResult(PlayFabRequest* request)
@@ -1644,16 +1375,10 @@ void PlayFabAdminApi::OnSetupPushNotificationResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SetupPushNotificationResult* outResult = new AdminModels::SetupPushNotificationResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SetupPushNotificationResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SetupPushNotificationResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1661,12 +1386,13 @@ void PlayFabAdminApi::UpdateCatalogItems(
     AdminModels::UpdateCatalogItemsRequest& request,
     ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateCatalogItemsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateCatalogItemsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateCatalogItemsResult(PlayFabRequest* request)
@@ -1674,16 +1400,10 @@ void PlayFabAdminApi::OnUpdateCatalogItemsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateCatalogItemsResult* outResult = new AdminModels::UpdateCatalogItemsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateCatalogItemsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateCatalogItemsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1691,12 +1411,13 @@ void PlayFabAdminApi::UpdateRandomResultTables(
     AdminModels::UpdateRandomResultTablesRequest& request,
     ProcessApiCallback<AdminModels::UpdateRandomResultTablesResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateRandomResultTables"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateRandomResultTablesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateRandomResultTables"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateRandomResultTablesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateRandomResultTablesResult(PlayFabRequest* request)
@@ -1704,16 +1425,10 @@ void PlayFabAdminApi::OnUpdateRandomResultTablesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateRandomResultTablesResult* outResult = new AdminModels::UpdateRandomResultTablesResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateRandomResultTablesResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateRandomResultTablesResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1721,12 +1436,13 @@ void PlayFabAdminApi::UpdateStoreItems(
     AdminModels::UpdateStoreItemsRequest& request,
     ProcessApiCallback<AdminModels::UpdateStoreItemsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateStoreItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateStoreItemsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateStoreItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateStoreItemsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateStoreItemsResult(PlayFabRequest* request)
@@ -1734,16 +1450,10 @@ void PlayFabAdminApi::OnUpdateStoreItemsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateStoreItemsResult* outResult = new AdminModels::UpdateStoreItemsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateStoreItemsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateStoreItemsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1751,12 +1461,13 @@ void PlayFabAdminApi::AddUserVirtualCurrency(
     AdminModels::AddUserVirtualCurrencyRequest& request,
     ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddUserVirtualCurrency"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAddUserVirtualCurrencyResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddUserVirtualCurrency"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAddUserVirtualCurrencyResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnAddUserVirtualCurrencyResult(PlayFabRequest* request)
@@ -1764,16 +1475,10 @@ void PlayFabAdminApi::OnAddUserVirtualCurrencyResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ModifyUserVirtualCurrencyResult* outResult = new AdminModels::ModifyUserVirtualCurrencyResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1781,12 +1486,13 @@ void PlayFabAdminApi::GetUserInventory(
     AdminModels::GetUserInventoryRequest& request,
     ProcessApiCallback<AdminModels::GetUserInventoryResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserInventory"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetUserInventoryResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserInventory"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetUserInventoryResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetUserInventoryResult(PlayFabRequest* request)
@@ -1794,16 +1500,10 @@ void PlayFabAdminApi::OnGetUserInventoryResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetUserInventoryResult* outResult = new AdminModels::GetUserInventoryResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetUserInventoryResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetUserInventoryResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1811,12 +1511,13 @@ void PlayFabAdminApi::GrantItemsToUsers(
     AdminModels::GrantItemsToUsersRequest& request,
     ProcessApiCallback<AdminModels::GrantItemsToUsersResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GrantItemsToUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGrantItemsToUsersResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GrantItemsToUsers"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGrantItemsToUsersResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGrantItemsToUsersResult(PlayFabRequest* request)
@@ -1824,16 +1525,10 @@ void PlayFabAdminApi::OnGrantItemsToUsersResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GrantItemsToUsersResult* outResult = new AdminModels::GrantItemsToUsersResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GrantItemsToUsersResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GrantItemsToUsersResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1841,12 +1536,13 @@ void PlayFabAdminApi::RevokeInventoryItem(
     AdminModels::RevokeInventoryItemRequest& request,
     ProcessApiCallback<AdminModels::RevokeInventoryResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RevokeInventoryItem"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRevokeInventoryItemResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RevokeInventoryItem"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRevokeInventoryItemResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRevokeInventoryItemResult(PlayFabRequest* request)
@@ -1854,16 +1550,10 @@ void PlayFabAdminApi::OnRevokeInventoryItemResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RevokeInventoryResult* outResult = new AdminModels::RevokeInventoryResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RevokeInventoryResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RevokeInventoryResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1871,12 +1561,13 @@ void PlayFabAdminApi::SubtractUserVirtualCurrency(
     AdminModels::SubtractUserVirtualCurrencyRequest& request,
     ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SubtractUserVirtualCurrency"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSubtractUserVirtualCurrencyResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SubtractUserVirtualCurrency"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSubtractUserVirtualCurrencyResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSubtractUserVirtualCurrencyResult(PlayFabRequest* request)
@@ -1884,16 +1575,10 @@ void PlayFabAdminApi::OnSubtractUserVirtualCurrencyResult(PlayFabRequest* reques
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ModifyUserVirtualCurrencyResult* outResult = new AdminModels::ModifyUserVirtualCurrencyResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ModifyUserVirtualCurrencyResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1901,12 +1586,13 @@ void PlayFabAdminApi::GetMatchmakerGameInfo(
     AdminModels::GetMatchmakerGameInfoRequest& request,
     ProcessApiCallback<AdminModels::GetMatchmakerGameInfoResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetMatchmakerGameInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetMatchmakerGameInfoResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetMatchmakerGameInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetMatchmakerGameInfoResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetMatchmakerGameInfoResult(PlayFabRequest* request)
@@ -1914,16 +1600,10 @@ void PlayFabAdminApi::OnGetMatchmakerGameInfoResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetMatchmakerGameInfoResult* outResult = new AdminModels::GetMatchmakerGameInfoResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetMatchmakerGameInfoResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetMatchmakerGameInfoResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1931,12 +1611,13 @@ void PlayFabAdminApi::GetMatchmakerGameModes(
     AdminModels::GetMatchmakerGameModesRequest& request,
     ProcessApiCallback<AdminModels::GetMatchmakerGameModesResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetMatchmakerGameModes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetMatchmakerGameModesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetMatchmakerGameModes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetMatchmakerGameModesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetMatchmakerGameModesResult(PlayFabRequest* request)
@@ -1944,16 +1625,10 @@ void PlayFabAdminApi::OnGetMatchmakerGameModesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetMatchmakerGameModesResult* outResult = new AdminModels::GetMatchmakerGameModesResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetMatchmakerGameModesResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetMatchmakerGameModesResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1961,12 +1636,13 @@ void PlayFabAdminApi::ModifyMatchmakerGameModes(
     AdminModels::ModifyMatchmakerGameModesRequest& request,
     ProcessApiCallback<AdminModels::ModifyMatchmakerGameModesResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ModifyMatchmakerGameModes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnModifyMatchmakerGameModesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ModifyMatchmakerGameModes"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnModifyMatchmakerGameModesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnModifyMatchmakerGameModesResult(PlayFabRequest* request)
@@ -1974,16 +1650,10 @@ void PlayFabAdminApi::OnModifyMatchmakerGameModesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ModifyMatchmakerGameModesResult* outResult = new AdminModels::ModifyMatchmakerGameModesResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ModifyMatchmakerGameModesResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ModifyMatchmakerGameModesResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -1991,12 +1661,13 @@ void PlayFabAdminApi::AddServerBuild(
     AdminModels::AddServerBuildRequest& request,
     ProcessApiCallback<AdminModels::AddServerBuildResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddServerBuild"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAddServerBuildResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddServerBuild"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAddServerBuildResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnAddServerBuildResult(PlayFabRequest* request)
@@ -2004,16 +1675,10 @@ void PlayFabAdminApi::OnAddServerBuildResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::AddServerBuildResult* outResult = new AdminModels::AddServerBuildResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::AddServerBuildResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::AddServerBuildResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2021,12 +1686,13 @@ void PlayFabAdminApi::GetServerBuildInfo(
     AdminModels::GetServerBuildInfoRequest& request,
     ProcessApiCallback<AdminModels::GetServerBuildInfoResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetServerBuildInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetServerBuildInfoResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetServerBuildInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetServerBuildInfoResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetServerBuildInfoResult(PlayFabRequest* request)
@@ -2034,16 +1700,10 @@ void PlayFabAdminApi::OnGetServerBuildInfoResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetServerBuildInfoResult* outResult = new AdminModels::GetServerBuildInfoResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetServerBuildInfoResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetServerBuildInfoResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2051,12 +1711,13 @@ void PlayFabAdminApi::GetServerBuildUploadUrl(
     AdminModels::GetServerBuildUploadURLRequest& request,
     ProcessApiCallback<AdminModels::GetServerBuildUploadURLResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetServerBuildUploadUrl"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetServerBuildUploadUrlResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetServerBuildUploadUrl"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetServerBuildUploadUrlResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetServerBuildUploadUrlResult(PlayFabRequest* request)
@@ -2064,16 +1725,10 @@ void PlayFabAdminApi::OnGetServerBuildUploadUrlResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetServerBuildUploadURLResult* outResult = new AdminModels::GetServerBuildUploadURLResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetServerBuildUploadURLResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetServerBuildUploadURLResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2081,12 +1736,13 @@ void PlayFabAdminApi::ListServerBuilds(
 
     ProcessApiCallback<AdminModels::ListBuildsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ListServerBuilds"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnListServerBuildsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnListServerBuildsResult(PlayFabRequest* request)
@@ -2094,16 +1750,10 @@ void PlayFabAdminApi::OnListServerBuildsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ListBuildsResult* outResult = new AdminModels::ListBuildsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ListBuildsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ListBuildsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2111,12 +1761,13 @@ void PlayFabAdminApi::ModifyServerBuild(
     AdminModels::ModifyServerBuildRequest& request,
     ProcessApiCallback<AdminModels::ModifyServerBuildResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ModifyServerBuild"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnModifyServerBuildResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ModifyServerBuild"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnModifyServerBuildResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnModifyServerBuildResult(PlayFabRequest* request)
@@ -2124,16 +1775,10 @@ void PlayFabAdminApi::OnModifyServerBuildResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ModifyServerBuildResult* outResult = new AdminModels::ModifyServerBuildResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ModifyServerBuildResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ModifyServerBuildResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2141,12 +1786,13 @@ void PlayFabAdminApi::RemoveServerBuild(
     AdminModels::RemoveServerBuildRequest& request,
     ProcessApiCallback<AdminModels::RemoveServerBuildResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RemoveServerBuild"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRemoveServerBuildResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RemoveServerBuild"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRemoveServerBuildResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRemoveServerBuildResult(PlayFabRequest* request)
@@ -2154,16 +1800,10 @@ void PlayFabAdminApi::OnRemoveServerBuildResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RemoveServerBuildResult* outResult = new AdminModels::RemoveServerBuildResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RemoveServerBuildResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RemoveServerBuildResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2171,12 +1811,13 @@ void PlayFabAdminApi::SetPublisherData(
     AdminModels::SetPublisherDataRequest& request,
     ProcessApiCallback<AdminModels::SetPublisherDataResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetPublisherDataResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetPublisherData"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetPublisherDataResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetPublisherDataResult(PlayFabRequest* request)
@@ -2184,16 +1825,10 @@ void PlayFabAdminApi::OnSetPublisherDataResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SetPublisherDataResult* outResult = new AdminModels::SetPublisherDataResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SetPublisherDataResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SetPublisherDataResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2201,12 +1836,13 @@ void PlayFabAdminApi::GetCloudScriptRevision(
     AdminModels::GetCloudScriptRevisionRequest& request,
     ProcessApiCallback<AdminModels::GetCloudScriptRevisionResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCloudScriptRevision"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetCloudScriptRevisionResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCloudScriptRevision"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetCloudScriptRevisionResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetCloudScriptRevisionResult(PlayFabRequest* request)
@@ -2214,16 +1850,10 @@ void PlayFabAdminApi::OnGetCloudScriptRevisionResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetCloudScriptRevisionResult* outResult = new AdminModels::GetCloudScriptRevisionResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetCloudScriptRevisionResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetCloudScriptRevisionResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2231,12 +1861,13 @@ void PlayFabAdminApi::GetCloudScriptVersions(
 
     ProcessApiCallback<AdminModels::GetCloudScriptVersionsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCloudScriptVersions"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnGetCloudScriptVersionsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetCloudScriptVersionsResult(PlayFabRequest* request)
@@ -2244,16 +1875,10 @@ void PlayFabAdminApi::OnGetCloudScriptVersionsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetCloudScriptVersionsResult* outResult = new AdminModels::GetCloudScriptVersionsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetCloudScriptVersionsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetCloudScriptVersionsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2261,12 +1886,13 @@ void PlayFabAdminApi::SetPublishedRevision(
     AdminModels::SetPublishedRevisionRequest& request,
     ProcessApiCallback<AdminModels::SetPublishedRevisionResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetPublishedRevision"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnSetPublishedRevisionResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/SetPublishedRevision"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnSetPublishedRevisionResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnSetPublishedRevisionResult(PlayFabRequest* request)
@@ -2274,16 +1900,10 @@ void PlayFabAdminApi::OnSetPublishedRevisionResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::SetPublishedRevisionResult* outResult = new AdminModels::SetPublishedRevisionResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::SetPublishedRevisionResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::SetPublishedRevisionResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2291,12 +1911,13 @@ void PlayFabAdminApi::UpdateCloudScript(
     AdminModels::UpdateCloudScriptRequest& request,
     ProcessApiCallback<AdminModels::UpdateCloudScriptResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateCloudScript"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateCloudScriptResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateCloudScript"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateCloudScriptResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateCloudScriptResult(PlayFabRequest* request)
@@ -2304,16 +1925,10 @@ void PlayFabAdminApi::OnUpdateCloudScriptResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::UpdateCloudScriptResult* outResult = new AdminModels::UpdateCloudScriptResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::UpdateCloudScriptResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::UpdateCloudScriptResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2321,12 +1936,13 @@ void PlayFabAdminApi::DeleteContent(
     AdminModels::DeleteContentRequest& request,
     ProcessApiCallback<AdminModels::BlankResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteContent"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnDeleteContentResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteContent"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnDeleteContentResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnDeleteContentResult(PlayFabRequest* request)
@@ -2334,16 +1950,10 @@ void PlayFabAdminApi::OnDeleteContentResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::BlankResult* outResult = new AdminModels::BlankResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::BlankResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::BlankResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2351,12 +1961,13 @@ void PlayFabAdminApi::GetContentList(
     AdminModels::GetContentListRequest& request,
     ProcessApiCallback<AdminModels::GetContentListResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetContentList"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetContentListResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetContentList"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetContentListResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetContentListResult(PlayFabRequest* request)
@@ -2364,16 +1975,10 @@ void PlayFabAdminApi::OnGetContentListResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetContentListResult* outResult = new AdminModels::GetContentListResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetContentListResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetContentListResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2381,12 +1986,13 @@ void PlayFabAdminApi::GetContentUploadUrl(
     AdminModels::GetContentUploadUrlRequest& request,
     ProcessApiCallback<AdminModels::GetContentUploadUrlResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetContentUploadUrl"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetContentUploadUrlResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetContentUploadUrl"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetContentUploadUrlResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetContentUploadUrlResult(PlayFabRequest* request)
@@ -2394,16 +2000,10 @@ void PlayFabAdminApi::OnGetContentUploadUrlResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetContentUploadUrlResult* outResult = new AdminModels::GetContentUploadUrlResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetContentUploadUrlResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetContentUploadUrlResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2411,12 +2011,13 @@ void PlayFabAdminApi::ResetCharacterStatistics(
     AdminModels::ResetCharacterStatisticsRequest& request,
     ProcessApiCallback<AdminModels::ResetCharacterStatisticsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResetCharacterStatistics"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnResetCharacterStatisticsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/ResetCharacterStatistics"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnResetCharacterStatisticsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnResetCharacterStatisticsResult(PlayFabRequest* request)
@@ -2424,16 +2025,10 @@ void PlayFabAdminApi::OnResetCharacterStatisticsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::ResetCharacterStatisticsResult* outResult = new AdminModels::ResetCharacterStatisticsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::ResetCharacterStatisticsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::ResetCharacterStatisticsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2441,12 +2036,13 @@ void PlayFabAdminApi::AddPlayerTag(
     AdminModels::AddPlayerTagRequest& request,
     ProcessApiCallback<AdminModels::AddPlayerTagResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddPlayerTag"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAddPlayerTagResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AddPlayerTag"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAddPlayerTagResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnAddPlayerTagResult(PlayFabRequest* request)
@@ -2454,16 +2050,10 @@ void PlayFabAdminApi::OnAddPlayerTagResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::AddPlayerTagResult* outResult = new AdminModels::AddPlayerTagResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::AddPlayerTagResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::AddPlayerTagResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2471,12 +2061,13 @@ void PlayFabAdminApi::GetAllActionGroups(
 
     ProcessApiCallback<AdminModels::GetAllActionGroupsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetAllActionGroups"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnGetAllActionGroupsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetAllActionGroupsResult(PlayFabRequest* request)
@@ -2484,16 +2075,10 @@ void PlayFabAdminApi::OnGetAllActionGroupsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetAllActionGroupsResult* outResult = new AdminModels::GetAllActionGroupsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetAllActionGroupsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetAllActionGroupsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2501,12 +2086,13 @@ void PlayFabAdminApi::GetAllSegments(
 
     ProcessApiCallback<AdminModels::GetAllSegmentsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
     PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetAllSegments"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, "", customData, callback, errorCallback, OnGetAllSegmentsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetAllSegmentsResult(PlayFabRequest* request)
@@ -2514,16 +2100,10 @@ void PlayFabAdminApi::OnGetAllSegmentsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetAllSegmentsResult* outResult = new AdminModels::GetAllSegmentsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetAllSegmentsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetAllSegmentsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2531,12 +2111,13 @@ void PlayFabAdminApi::GetPlayerSegments(
     AdminModels::GetPlayersSegmentsRequest& request,
     ProcessApiCallback<AdminModels::GetPlayerSegmentsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerSegments"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetPlayerSegmentsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerSegments"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetPlayerSegmentsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPlayerSegmentsResult(PlayFabRequest* request)
@@ -2544,16 +2125,10 @@ void PlayFabAdminApi::OnGetPlayerSegmentsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPlayerSegmentsResult* outResult = new AdminModels::GetPlayerSegmentsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPlayerSegmentsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPlayerSegmentsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2561,12 +2136,13 @@ void PlayFabAdminApi::GetPlayersInSegment(
     AdminModels::GetPlayersInSegmentRequest& request,
     ProcessApiCallback<AdminModels::GetPlayersInSegmentResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayersInSegment"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetPlayersInSegmentResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayersInSegment"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetPlayersInSegmentResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPlayersInSegmentResult(PlayFabRequest* request)
@@ -2574,16 +2150,10 @@ void PlayFabAdminApi::OnGetPlayersInSegmentResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPlayersInSegmentResult* outResult = new AdminModels::GetPlayersInSegmentResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPlayersInSegmentResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPlayersInSegmentResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2591,12 +2161,13 @@ void PlayFabAdminApi::GetPlayerTags(
     AdminModels::GetPlayerTagsRequest& request,
     ProcessApiCallback<AdminModels::GetPlayerTagsResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerTags"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetPlayerTagsResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetPlayerTags"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetPlayerTagsResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetPlayerTagsResult(PlayFabRequest* request)
@@ -2604,16 +2175,10 @@ void PlayFabAdminApi::OnGetPlayerTagsResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetPlayerTagsResult* outResult = new AdminModels::GetPlayerTagsResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetPlayerTagsResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetPlayerTagsResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2621,12 +2186,13 @@ void PlayFabAdminApi::RemovePlayerTag(
     AdminModels::RemovePlayerTagRequest& request,
     ProcessApiCallback<AdminModels::RemovePlayerTagResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RemovePlayerTag"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRemovePlayerTagResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RemovePlayerTag"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRemovePlayerTagResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRemovePlayerTagResult(PlayFabRequest* request)
@@ -2634,16 +2200,10 @@ void PlayFabAdminApi::OnRemovePlayerTagResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RemovePlayerTagResult* outResult = new AdminModels::RemovePlayerTagResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RemovePlayerTagResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RemovePlayerTagResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2651,12 +2211,13 @@ void PlayFabAdminApi::AbortTaskInstance(
     AdminModels::AbortTaskInstanceRequest& request,
     ProcessApiCallback<AdminModels::EmptyResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AbortTaskInstance"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAbortTaskInstanceResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/AbortTaskInstance"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAbortTaskInstanceResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnAbortTaskInstanceResult(PlayFabRequest* request)
@@ -2664,16 +2225,10 @@ void PlayFabAdminApi::OnAbortTaskInstanceResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::EmptyResult* outResult = new AdminModels::EmptyResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::EmptyResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::EmptyResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2681,12 +2236,13 @@ void PlayFabAdminApi::CreateActionsOnPlayersInSegmentTask(
     AdminModels::CreateActionsOnPlayerSegmentTaskRequest& request,
     ProcessApiCallback<AdminModels::CreateTaskResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreateActionsOnPlayersInSegmentTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnCreateActionsOnPlayersInSegmentTaskResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreateActionsOnPlayersInSegmentTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnCreateActionsOnPlayersInSegmentTaskResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnCreateActionsOnPlayersInSegmentTaskResult(PlayFabRequest* request)
@@ -2694,16 +2250,10 @@ void PlayFabAdminApi::OnCreateActionsOnPlayersInSegmentTaskResult(PlayFabRequest
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::CreateTaskResult* outResult = new AdminModels::CreateTaskResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::CreateTaskResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::CreateTaskResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2711,12 +2261,13 @@ void PlayFabAdminApi::CreateCloudScriptTask(
     AdminModels::CreateCloudScriptTaskRequest& request,
     ProcessApiCallback<AdminModels::CreateTaskResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreateCloudScriptTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnCreateCloudScriptTaskResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/CreateCloudScriptTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnCreateCloudScriptTaskResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnCreateCloudScriptTaskResult(PlayFabRequest* request)
@@ -2724,16 +2275,10 @@ void PlayFabAdminApi::OnCreateCloudScriptTaskResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::CreateTaskResult* outResult = new AdminModels::CreateTaskResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::CreateTaskResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::CreateTaskResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2741,12 +2286,13 @@ void PlayFabAdminApi::DeleteTask(
     AdminModels::DeleteTaskRequest& request,
     ProcessApiCallback<AdminModels::EmptyResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnDeleteTaskResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/DeleteTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnDeleteTaskResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnDeleteTaskResult(PlayFabRequest* request)
@@ -2754,16 +2300,10 @@ void PlayFabAdminApi::OnDeleteTaskResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::EmptyResult* outResult = new AdminModels::EmptyResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::EmptyResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::EmptyResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2771,12 +2311,13 @@ void PlayFabAdminApi::GetActionsOnPlayersInSegmentTaskInstance(
     AdminModels::GetTaskInstanceRequest& request,
     ProcessApiCallback<AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetActionsOnPlayersInSegmentTaskInstanceResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetActionsOnPlayersInSegmentTaskInstance"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetActionsOnPlayersInSegmentTaskInstanceResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetActionsOnPlayersInSegmentTaskInstanceResult(PlayFabRequest* request)
@@ -2784,16 +2325,10 @@ void PlayFabAdminApi::OnGetActionsOnPlayersInSegmentTaskInstanceResult(PlayFabRe
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult* outResult = new AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetActionsOnPlayersInSegmentTaskInstanceResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2801,12 +2336,13 @@ void PlayFabAdminApi::GetCloudScriptTaskInstance(
     AdminModels::GetTaskInstanceRequest& request,
     ProcessApiCallback<AdminModels::GetCloudScriptTaskInstanceResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCloudScriptTaskInstance"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetCloudScriptTaskInstanceResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCloudScriptTaskInstance"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetCloudScriptTaskInstanceResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetCloudScriptTaskInstanceResult(PlayFabRequest* request)
@@ -2814,16 +2350,10 @@ void PlayFabAdminApi::OnGetCloudScriptTaskInstanceResult(PlayFabRequest* request
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetCloudScriptTaskInstanceResult* outResult = new AdminModels::GetCloudScriptTaskInstanceResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetCloudScriptTaskInstanceResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetCloudScriptTaskInstanceResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2831,12 +2361,13 @@ void PlayFabAdminApi::GetTaskInstances(
     AdminModels::GetTaskInstancesRequest& request,
     ProcessApiCallback<AdminModels::GetTaskInstancesResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTaskInstances"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetTaskInstancesResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTaskInstances"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetTaskInstancesResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetTaskInstancesResult(PlayFabRequest* request)
@@ -2844,16 +2375,10 @@ void PlayFabAdminApi::OnGetTaskInstancesResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetTaskInstancesResult* outResult = new AdminModels::GetTaskInstancesResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetTaskInstancesResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetTaskInstancesResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2861,12 +2386,13 @@ void PlayFabAdminApi::GetTasks(
     AdminModels::GetTasksRequest& request,
     ProcessApiCallback<AdminModels::GetTasksResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTasks"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnGetTasksResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetTasks"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnGetTasksResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnGetTasksResult(PlayFabRequest* request)
@@ -2874,16 +2400,10 @@ void PlayFabAdminApi::OnGetTasksResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::GetTasksResult* outResult = new AdminModels::GetTasksResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::GetTasksResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::GetTasksResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2891,12 +2411,13 @@ void PlayFabAdminApi::RunTask(
     AdminModels::RunTaskRequest& request,
     ProcessApiCallback<AdminModels::RunTaskResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RunTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnRunTaskResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/RunTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnRunTaskResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnRunTaskResult(PlayFabRequest* request)
@@ -2904,16 +2425,10 @@ void PlayFabAdminApi::OnRunTaskResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::RunTaskResult* outResult = new AdminModels::RunTaskResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::RunTaskResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::RunTaskResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -2921,12 +2436,13 @@ void PlayFabAdminApi::UpdateTask(
     AdminModels::UpdateTaskRequest& request,
     ProcessApiCallback<AdminModels::EmptyResult> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUpdateTaskResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/UpdateTask"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUpdateTaskResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabAdminApi::OnUpdateTaskResult(PlayFabRequest* request)
@@ -2934,16 +2450,37 @@ void PlayFabAdminApi::OnUpdateTaskResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         AdminModels::EmptyResult* outResult = new AdminModels::EmptyResult;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<AdminModels::EmptyResult> successCallback = reinterpret_cast<ProcessApiCallback<AdminModels::EmptyResult>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
+void PlayFabAdminApi::GetCatalogItemsLazy(
+    AdminModels::GetCatalogItemsRequest& request,
+    ProcessApiCallback<PlayFabLazyModel<AdminModels::GetCatalogItemsResult>> callback,
+    ErrorCallback errorCallback,
+    void* customData,
+    PlayFabRequestPriority priority
+)
+{
+
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetCatalogItems"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, PlayFabLazyModel<AdminModels::GetCatalogItemsResult>::OnResult);
+    newRequest->mStreamResponse = true;
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
+}
+
+void PlayFabAdminApi::GetUserInventoryLazy(
+    AdminModels::GetUserInventoryRequest& request,
+    ProcessApiCallback<PlayFabLazyModel<AdminModels::GetUserInventoryResult>> callback,
+    ErrorCallback errorCallback,
+    void* customData,
+    PlayFabRequestPriority priority
+)
+{
+
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Admin/GetUserInventory"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, PlayFabLazyModel<AdminModels::GetUserInventoryResult>::OnResult);
+    newRequest->mStreamResponse = true;
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
+}
@@ -0,0 +1,78 @@
+#include "StdAfx.h"
+#include "PlayFabBufferPool.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabServerSdk;
+
+PlayFabBufferPool::PlayFabBufferPool(int maxBuffersPerClass)
+    : m_maxBuffersPerClass(maxBuffersPerClass > 0 ? maxBuffersPerClass : 1)
+    , m_stats()
+{
+}
+
+PlayFabBufferPool::~PlayFabBufferPool()
+{
+    for (auto& buffers : m_freeBuffers)
+    {
+        for (char* buffer : buffers)
+            delete[] buffer;
+    }
+}
+
+int PlayFabBufferPool::GetSizeClass(size_t size)
+{
+    int sizeClass = 0;
+    while (sizeClass < SizeClassCount && (static_cast<size_t>(1) << (MinSizeClassShift + sizeClass)) < size)
+        sizeClass++;
+    return sizeClass;
+}
+
+char* PlayFabBufferPool::Acquire(size_t size, size_t& capacity)
+{
+    int sizeClass = GetSizeClass(size);
+    capacity = sizeClass < SizeClassCount ? static_cast<size_t>(1) << (MinSizeClassShift + sizeClass) : size;
+
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_stats.acquiredBuffers++;
+        m_stats.largestResponseBytes = AZStd::GetMax(m_stats.largestResponseBytes, static_cast<AZ::u64>(size));
+        if (sizeClass < SizeClassCount && !m_freeBuffers[sizeClass].empty())
+        {
+            char* buffer = m_freeBuffers[sizeClass].back();
+            m_freeBuffers[sizeClass].pop_back();
+            m_stats.reusedBuffers++;
+            m_stats.pooledBytes -= capacity;
+            return buffer;
+        }
+        m_stats.allocatedBytes += capacity;
+    }
+
+    // Allocated outside the lock, other workers need not wait on it
+    return new char[capacity];
+}
+
+void PlayFabBufferPool::Release(char* buffer, size_t capacity)
+{
+    if (buffer == nullptr)
+        return;
+
+    int sizeClass = GetSizeClass(capacity);
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (sizeClass < SizeClassCount && m_freeBuffers[sizeClass].size() < m_maxBuffersPerClass)
+        {
+            m_freeBuffers[sizeClass].push_back(buffer);
+            m_stats.pooledBytes += capacity;
+            return;
+        }
+    }
+    delete[] buffer;
+}
+
+PlayFabResponseBufferStats PlayFabBufferPool::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    return m_stats;
+}
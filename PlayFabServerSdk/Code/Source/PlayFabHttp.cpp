@@ -1,6 +1,16 @@
 #include "StdAfx.h"
 #include <PlayFabServerSdk/PlayFabHttp.h>
 #include "PlayFabSettings.h"
+#include "PlayFabHttpClientPool.h"
+#include "PlayFabRequestQueue.h"
+#include "PlayFabRetryPolicy.h"
+#include "PlayFabRateLimiter.h"
+#include "PlayFabRequestCoalescer.h"
+#include "PlayFabCompression.h"
+#include "PlayFabBufferPool.h"
+#include "PlayFabJsonArenaPool.h"
+#include "PlayFabRequestBodyPool.h"
+#include <PlayFabServerSdk/PlayFabBaseModel.h>
 
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpRequest.h>
@@ -9,6 +19,8 @@
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/http/HttpClientFactory.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/algorithm.h>
 
 using namespace PlayFabServerSdk;
 using namespace rapidjson;
@@ -17,40 +29,114 @@ using namespace rapidjson;
 //#define PLAYFAB_DEBUG_HTTP_LOG              // Enable to log requests and responses to the tty
 //#define PLAYFAB_DEBUG_DELAY_RESPONSE 5000   // Enable to introduce an artificial delay on responses (time in milliseconds)
 
+// The host part of a url, which is what keep-alive connections are pooled by
+static AZStd::string GetHostFromURI(const AZStd::string& URI)
+{
+    size_t hostStart = URI.find("://");
+    hostStart = (hostStart == AZStd::string::npos) ? 0 : hostStart + 3;
+    size_t hostEnd = URI.find('/', hostStart);
+    return URI.substr(hostStart, hostEnd == AZStd::string::npos ? AZStd::string::npos : hostEnd - hostStart);
+}
+
+// The path part of a url, which identifies the api being called
+static AZStd::string GetCallPathFromURI(const AZStd::string& URI)
+{
+    size_t hostStart = URI.find("://");
+    hostStart = (hostStart == AZStd::string::npos) ? 0 : hostStart + 3;
+    size_t pathStart = URI.find('/', hostStart);
+    return pathStart == AZStd::string::npos ? AZStd::string("/") : URI.substr(pathStart);
+}
+
+// Fail a request without sending it, because the client side rate limit would have delayed it too long
+static void ReportRateLimited(PlayFabRequest* request)
+{
+    request->mError = new PlayFabError;
+    request->mError->HttpCode = 429;
+    request->mError->HttpStatus = "TooManyRequests";
+    request->mError->ErrorCode = PlayFabErrorRateLimitedLocally;
+    request->mError->ErrorName = "RateLimitedLocally";
+    request->mError->ErrorMessage = "Request not sent, the client side rate limit for " + request->mCallPath + " has been reached";
+    PlayFabRequestManager::playFabHttp->DispatchCallbacks(request);
+}
+
+static bool EndsWith(const AZStd::string& text, const char* suffix)
+{
+    size_t suffixLength = strlen(suffix);
+    return text.length() >= suffixLength && text.compare(text.length() - suffixLength, suffixLength, suffix) == 0;
+}
+
+// A body to serialize a request into, recycled when the request manager is running
+static PlayFabRequestBody* AcquireRequestBody()
+{
+    if (PlayFabRequestManager::playFabHttp != nullptr)
+        return PlayFabRequestManager::playFabHttp->GetRequestBodyPool()->Acquire();
+    return new PlayFabRequestBody();
+}
+
 ///////////////////// PlayFabRequest /////////////////////
-PlayFabRequest::PlayFabRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const AZStd::string& authKey, const AZStd::string& authValue, const AZStd::string& requestJsonBody, void* customData, void* mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback)
-    : mURI(URI)
+PlayFabRequest::PlayFabRequest(AZStd::string URI, Aws::Http::HttpMethod method, AZStd::string authKey, AZStd::string authValue, const AZStd::string& requestJsonBody, void* customData, void* mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback)
+    : mURI(AZStd::move(URI))
+    , mCallPath(GetCallPathFromURI(mURI))
+    , mPriority(PlayFabRequestPriorityGameplay)
+    , mRetryCount(0)
+    , mRetryDelayMs(0)
     , mMethod(method)
-    , mAuthKey(authKey)
-    , mAuthValue(authValue)
-    , mRequestJsonBody(requestJsonBody)
+    , mAuthKey(AZStd::move(authKey))
+    , mAuthValue(AZStd::move(authValue))
+    , mRequestBody(AcquireRequestBody())
     , mCustomData(customData)
     , mResponseText(nullptr)
     , mResponseSize(0)
     , mResponseJson(nullptr)
+    , mResponseBufferPool(nullptr)
+    , mResponseArena(nullptr)
+    , mResponseReader(nullptr)
+    , mResponseCapacity(0)
+    , mStreamResponse(false)
     , mError(nullptr)
     , mHttpCode(Aws::Http::HttpResponseCode::BAD_REQUEST)
     , mInternalCallback(internalCallback)
     , mResultCallback(mResultCallback)
     , mErrorCallback(mErrorCallback)
+    , mResult(nullptr)
+    , mResultInvoker(nullptr)
+    , mResultDeleter(nullptr)
+{
+    if (!requestJsonBody.empty())
+        memcpy(mRequestBody->buffer.Push(requestJsonBody.length()), requestJsonBody.c_str(), requestJsonBody.length());
+}
+
+PlayFabRequest::PlayFabRequest(AZStd::string URI, Aws::Http::HttpMethod method, AZStd::string authKey, AZStd::string authValue, PlayFabBaseModel& requestModel, void* customData, void* mResultCallback, ErrorCallback mErrorCallback, const HttpCallback& internalCallback)
+    : PlayFabRequest(AZStd::move(URI), method, AZStd::move(authKey), AZStd::move(authValue), AZStd::string(), customData, mResultCallback, mErrorCallback, internalCallback)
 {
+    requestModel.writeJSON(mRequestBody->writer);
 }
 
 PlayFabRequest::~PlayFabRequest()
 {
-    if (mResponseText != nullptr)
-        delete mResponseText;
+    ReleaseResponseBody();
+    ReleaseRequestBody();
     if (mError != nullptr)
         delete mError;
-    if (mResponseJson != nullptr)
-        delete mResponseJson;
+    if (mResult != nullptr && mResultDeleter != nullptr)
+        mResultDeleter(mResult);
+    for (PlayFabRequest* follower : mFollowers)
+        delete follower;
 }
 
 void PlayFabRequest::HandleErrorReport()
 {
+    if (mError != nullptr)
+    {
+        // Already described when the response was read, see PlayFabRequestManager::ReadResponse
+        PlayFabRequestManager::playFabHttp->DispatchCallbacks(this);
+        return;
+    }
+
     mError = new PlayFabError;
 
     if (mResponseSize != 0 // Not a null response
+        && mResponseJson != nullptr // Not streamed, which is only done for successful responses
         && mResponseJson->GetParseError() == kParseErrorNone) // Proper json response
     {
         // If we have a proper json response, try to parse that json into our error-result format
@@ -87,89 +173,430 @@ void PlayFabRequest::HandleErrorReport()
         mError->HttpStatus = mResponseSize == 0 ? "RequestTimeout" : "ServiceUnavailable";
         mError->ErrorCode = mResponseSize == 0 ? PlayFabErrorConnectionTimeout : PlayFabErrorServiceUnavailable;
         mError->ErrorName = mResponseSize == 0 ? "ConnectionTimeout" : "ServiceUnavailable";
-        // For text returns, use the non-json response if possible, else default to no response
-        mError->ErrorMessage = mError->HttpStatus = mResponseSize == 0 ? "Request Timeout or null response" : mResponseText;
+        // For text returns, use the non-json response if possible, else default to no response. Streamed text was parsed in place, so is no longer intact.
+        if (mResponseSize == 0)
+            mError->ErrorMessage = mError->HttpStatus = "Request Timeout or null response";
+        else
+            mError->ErrorMessage = mError->HttpStatus = mResponseReader != nullptr ? "Unexpected response format" : mResponseText;
     }
 
-    // Send the error callbacks
-    if (PlayFabSettings::playFabSettings->globalErrorHandler != nullptr)
-        PlayFabSettings::playFabSettings->globalErrorHandler(*mError, mCustomData);
-    if (mErrorCallback != nullptr)
-        mErrorCallback(*mError, mCustomData);
+    // Send the error callbacks, the request manager deletes this request once they have run
+    PlayFabRequestManager::playFabHttp->DispatchCallbacks(this);
+}
+
+AZ::u64 PlayFabRequest::GetQueueWaitMicroseconds() const
+{
+    return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(mSentTime - mQueuedTime).count();
+}
+
+AZ::u64 PlayFabRequest::GetNetworkMicroseconds() const
+{
+    return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(mCompletedTime - mSentTime).count();
+}
+
+void PlayFabRequest::ResetResponse()
+{
+    httpResponse.reset();
+    ReleaseResponseBody();
+    mResponseSize = 0;
+    delete mError;
+    mError = nullptr;
+    mHttpCode = Aws::Http::HttpResponseCode::BAD_REQUEST;
+}
+
+void PlayFabRequest::ReleaseResponseBody()
+{
+    // The Document or reader may point into the text, so they go first
+    if (mResponseArena != nullptr)
+        mResponseArena->pool->Release(mResponseArena);
+    else
+        delete mResponseJson;
+    mResponseJson = nullptr;
+    mResponseArena = nullptr;
+    mResponseReader = nullptr;
+    if (mResponseBufferPool != nullptr)
+        mResponseBufferPool->Release(mResponseText, mResponseCapacity);
+    else
+        delete[] mResponseText;
+    mResponseText = nullptr;
+    mResponseBufferPool = nullptr;
+    mResponseCapacity = 0;
+}
+
+void PlayFabRequest::ReleaseRequestBody()
+{
+    PlayFabRequestBodyPool::Release(mRequestBody);
+    mRequestBody = nullptr;
+}
+
+const char* PlayFabRequest::GetRequestBody() const
+{
+    return mRequestBody != nullptr ? mRequestBody->buffer.GetString() : "";
+}
+
+size_t PlayFabRequest::GetRequestBodySize() const
+{
+    return mRequestBody != nullptr ? mRequestBody->buffer.GetSize() : 0;
 }
 
 ///////////////////// PlayFabRequestManager /////////////////////
 PlayFabRequestManager * PlayFabRequestManager::playFabHttp = nullptr;
 
 PlayFabRequestManager::PlayFabRequestManager()
+    : m_timingStats()
+    , m_callbackStats()
 {
-    m_runThread = true;
-    auto function = std::bind(&PlayFabRequestManager::ThreadFunction, this);
-    m_thread = AZStd::thread(function);
+    // HttpClient::MakeRequest blocks for the whole round trip, so concurrency comes from running several of them at once
+    int workerCount = PlayFabSettings::playFabSettings->httpWorkerThreads;
+    if (workerCount <= 0)
+        workerCount = AZStd::GetMax(4, 2 * static_cast<int>(AZStd::thread::hardware_concurrency()));
+    // Every call goes to the title's host, so a worker beyond the connection limit could only wait in the pool for a connection
+    workerCount = AZStd::GetMin(workerCount, AZStd::GetMax(1, PlayFabSettings::playFabSettings->httpMaxConnections));
+
+    // Background requests may use every worker but one, which is kept free for higher priority requests.
+    // The pool holds back a connection from them in the same way.
+    m_requestQueue = new PlayFabRequestQueue(AZStd::GetMax(1, workerCount - 1), PlayFabSettings::playFabSettings->httpBackgroundMaxWaitMs);
+    m_clientPool = new PlayFabHttpClientPool(PlayFabSettings::playFabSettings->httpMaxConnections, PlayFabSettings::playFabSettings->httpIdleTimeoutMs);
+    m_retryPolicy = new PlayFabRetryPolicy(PlayFabSettings::playFabSettings->httpMaxRetries, PlayFabSettings::playFabSettings->httpRetryBaseDelayMs,
+        PlayFabSettings::playFabSettings->httpRetryMaxDelayMs, PlayFabSettings::playFabSettings->httpRetryBudgetPercent);
+    m_coalescer = new PlayFabRequestCoalescer();
+    // Each worker reads one response at a time, so that many buffers of a size covers steady traffic
+    m_bufferPool = new PlayFabBufferPool(workerCount);
+    m_arenaPool = new PlayFabJsonArenaPool(workerCount);
+    // Requests are serialized on the caller's thread and may wait in the queue while workers send others, so more bodies than workers are kept
+    m_requestBodyPool = new PlayFabRequestBodyPool(4 * workerCount);
+    m_rateLimiter = new PlayFabRateLimiter(PlayFabSettings::playFabSettings->rateLimitMaxDelayMs);
+    m_rateLimiter->SetTitleLimit(PlayFabSettings::playFabSettings->rateLimitTitlePerSecond, PlayFabSettings::playFabSettings->rateLimitTitleBurst);
+
+    for (int i = 0; i < workerCount; ++i)
+    {
+        auto function = std::bind(&PlayFabRequestManager::ThreadFunction, this);
+        m_threads.push_back(AZStd::thread(function));
+    }
+
+    // Constructed on the main thread, which is where queued callbacks are delivered from
+    AZ::TickBus::Handler::BusConnect();
 }
 
 PlayFabRequestManager::~PlayFabRequestManager()
 {
-    m_runThread = false;
-    if (m_thread.joinable())
-        m_thread.join();
+    // Wake the idle workers, and any waiting on a connection, so they can exit
+    m_requestQueue->Shutdown();
+    m_clientPool->Shutdown();
+    for (auto& thread : m_threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    delete m_rateLimiter;
+    delete m_coalescer;
+    delete m_retryPolicy;
+    delete m_clientPool;
+    delete m_requestQueue;
+
+    // Callbacks still waiting for a tick are dropped, there is nothing left to deliver them to during shutdown
+    AZ::TickBus::Handler::BusDisconnect();
+    while (!m_callbackQueue.empty())
+    {
+        delete m_callbackQueue.front();
+        m_callbackQueue.pop();
+    }
+
+    // Last, as every request which could hold a buffer or arena has now been deleted
+    delete m_requestBodyPool;
+    delete m_arenaPool;
+    delete m_bufferPool;
 }
 
 int PlayFabRequestManager::GetPendingCalls()
 {
-    int temp;
+    return m_requestQueue->GetPendingCount();
+}
+
+bool PlayFabRequestManager::WaitForPendingCalls(int timeoutMs)
+{
+    // Polled, as this is only used while shutting down, to let requests which must not be lost reach PlayFab.
+    // That is on the main thread, so no tick delivers the callbacks queued for it meanwhile. They are delivered here instead, as some send more:
+    // a user data or statistics flush held behind an earlier request is sent from that request's callback.
+    auto deadline = AZStd::chrono::system_clock::now() + AZStd::chrono::milliseconds(timeoutMs);
+    for (;;)
+    {
+        DispatchQueuedCallbacks(0);
+        // A request's callback is queued before it stops being pending, so checking the queue second cannot miss one
+        if (GetPendingCalls() == 0)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+            if (m_callbackQueue.empty())
+                return true;
+            continue;
+        }
+        if (AZStd::chrono::system_clock::now() >= deadline)
+            return false;
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+    }
+}
+
+PlayFabConnectionStats PlayFabRequestManager::GetConnectionStats()
+{
+    return m_clientPool->GetStats();
+}
+
+PlayFabTimingStats PlayFabRequestManager::GetTimingStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+    return m_timingStats;
+}
+
+PlayFabCallbackStats PlayFabRequestManager::GetCallbackStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+    return m_callbackStats;
+}
+
+AZStd::unordered_map<AZStd::string, PlayFabRetryStats> PlayFabRequestManager::GetRetryStats()
+{
+    return m_retryPolicy->GetStats();
+}
+
+PlayFabRateLimiter* PlayFabRequestManager::GetRateLimiter()
+{
+    return m_rateLimiter;
+}
+
+AZStd::unordered_map<AZStd::string, PlayFabCoalescingStats> PlayFabRequestManager::GetCoalescingStats()
+{
+    return m_coalescer->GetStats();
+}
+
+PlayFabResponseBufferStats PlayFabRequestManager::GetResponseBufferStats()
+{
+    return m_bufferPool->GetStats();
+}
+
+PlayFabJsonArenaStats PlayFabRequestManager::GetJsonArenaStats()
+{
+    return m_arenaPool->GetStats();
+}
+
+PlayFabRequestBodyStats PlayFabRequestManager::GetRequestBodyStats()
+{
+    return m_requestBodyPool->GetStats();
+}
+
+PlayFabRequestBodyPool* PlayFabRequestManager::GetRequestBodyPool()
+{
+    return m_requestBodyPool;
+}
+
+AZStd::unordered_map<AZStd::string, PlayFabCompressionStats> PlayFabRequestManager::GetCompressionStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+    return m_compressionStats;
+}
+
+void PlayFabRequestManager::DispatchCallbacks(PlayFabRequest* request)
+{
+    // From here on the response is final, so later duplicates must send their own request
+    m_coalescer->Finish(request);
+
+    // The result or error has been decoded from the response, so its buffer can go to the next response rather than waiting for the callbacks
+    request->httpResponse.reset();
+    request->ReleaseResponseBody();
+    request->ReleaseRequestBody();
+
+    if (!PlayFabSettings::playFabSettings->callbacksOnMainThread)
     {
-        AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-        temp = m_pendingCalls;
+        InvokeCallbacks(request);
+        return;
     }
-    return temp;
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+    m_callbackQueue.push(request);
+    m_callbackStats.queuedCallbacks = static_cast<int>(m_callbackQueue.size());
+    m_callbackStats.maxQueuedCallbacks = AZStd::GetMax(m_callbackStats.maxQueuedCallbacks, m_callbackStats.queuedCallbacks);
 }
 
-void PlayFabRequestManager::AddRequest(PlayFabRequest* requestContainer)
+// Deliver the outcome of the request which was sent to the callbacks of a caller, which is either that request or one coalesced into it
+static void InvokeCallbacksFor(PlayFabRequest* sent, PlayFabRequest* caller)
 {
+    if (sent->mError != nullptr)
     {
-        AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-        m_requestsToHandle.push(AZStd::move(requestContainer));
+        if (PlayFabSettings::playFabSettings->globalErrorHandler != nullptr)
+            PlayFabSettings::playFabSettings->globalErrorHandler(*sent->mError, caller->mCustomData);
+        if (caller->mErrorCallback != nullptr)
+            caller->mErrorCallback(*sent->mError, caller->mCustomData);
     }
+    else if (caller->mResultCallback != nullptr && sent->mResultInvoker != nullptr)
+        sent->mResultInvoker(caller, sent->mResult);
 }
 
-void PlayFabRequestManager::ThreadFunction()
+void PlayFabRequestManager::InvokeCallbacks(PlayFabRequest* request)
 {
-    AZStd::queue<PlayFabRequest*> requestsToHandle, resultsToHandle;
+    InvokeCallbacksFor(request, request);
+    // Every follower is for the same api, so it shares the decoded result rather than decoding its own
+    for (PlayFabRequest* follower : request->mFollowers)
+        InvokeCallbacksFor(request, follower);
 
-    // Run the thread as long as directed
-    while (m_runThread)
+    delete request;
+}
+
+void PlayFabRequestManager::DispatchQueuedCallbacks(int budgetUs)
+{
+    auto start = AZStd::chrono::system_clock::now();
+    AZ::u64 elapsedUs = 0;
+    AZ::u64 dispatched = 0;
+    bool deferred = false;
+    for (;;)
     {
+        PlayFabRequest* request;
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            requestsToHandle.swap(m_requestsToHandle);
-            m_pendingCalls = requestsToHandle.size() + resultsToHandle.size();
+            AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+            if (m_callbackQueue.empty())
+                break;
+            if (budgetUs > 0 && elapsedUs >= static_cast<AZ::u64>(budgetUs))
+            {
+                // Spread a burst of results across frames, rather than hitching this one
+                deferred = true;
+                break;
+            }
+            request = m_callbackQueue.front();
+            m_callbackQueue.pop();
+            m_callbackStats.queuedCallbacks = static_cast<int>(m_callbackQueue.size());
         }
 
-        // Send all the requests immediately to make API calls work in Parellel, these don't really wait (much if at all <1 ms)
-        while (!requestsToHandle.empty())
-        {
-            auto request = requestsToHandle.front();
-            HandleRequest(request);
-            resultsToHandle.push(request);
-            requestsToHandle.pop();
-        }
+        // The lock is not held here, so callbacks are free to make new api calls
+        InvokeCallbacks(request);
+        dispatched++;
+        elapsedUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start).count();
+    }
+
+    if (dispatched == 0)
+        return;
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+    m_callbackStats.dispatchedCallbacks += dispatched;
+    if (deferred)
+        m_callbackStats.deferredTicks++;
+    if (budgetUs > 0 && elapsedUs > static_cast<AZ::u64>(budgetUs))
+        m_callbackStats.budgetOverruns++;
+    m_callbackStats.maxTickUs = AZStd::GetMax(m_callbackStats.maxTickUs, elapsedUs);
+}
+
+void PlayFabRequestManager::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+{
+    (void)deltaTime;
+    (void)time;
+    DispatchQueuedCallbacks(PlayFabSettings::playFabSettings->callbackBudgetUs);
+}
+
+PlayFabRequestPriority PlayFabRequestManager::GetDefaultPriority(const AZStd::string& callPath)
+{
+    // Logins and session validation gate everything else the player does, and a late heartbeat gets a game server deregistered
+    size_t nameStart = callPath.rfind('/');
+    AZStd::string name = nameStart == AZStd::string::npos ? callPath : callPath.substr(nameStart + 1);
+    if (name.find("Login") == 0
+        || name == "RegisterPlayFabUser"
+        || name == "AuthenticateSessionTicket"
+        || name == "AuthUser"
+        || name == "RefreshGameServerInstanceHeartbeat")
+        return PlayFabRequestPriorityCritical;
+
+    // Telemetry, nobody waits on the result
+    if (EndsWith(name, "Event")
+        || name == "ReportDeviceInfo"
+        || name == "AttributeInstall")
+        return PlayFabRequestPriorityBackground;
+
+    return PlayFabRequestPriorityGameplay;
+}
+
+void PlayFabRequestManager::AddRequest(PlayFabRequest* requestContainer, PlayFabRequestPriority priority)
+{
+    if (priority < 0 || priority >= PlayFabRequestPriorityCount)
+        priority = GetDefaultPriority(requestContainer->mCallPath);
+    requestContainer->mPriority = priority;
+
+    // A duplicate of a read already in flight waits for that response, without being sent or counted against the rate limit
+    if (m_coalescer->JoinOrLead(requestContainer))
+        return;
+
+    // Requests over the rate limit wait in the queue until their token is due, or fail here without touching the network
+    auto now = AZStd::chrono::system_clock::now();
+    if (!m_rateLimiter->Acquire(requestContainer->mCallPath, now, requestContainer->mQueuedTime))
+    {
+        ReportRateLimited(requestContainer);
+        return;
+    }
 
-        // Handle a single result this tick (blocking call takes 50-500 ms) - Results in Serial unfortunately, can't evaluate which has returned yet (maybe something to fix)
-        if (!resultsToHandle.empty())
+    m_retryPolicy->OnNewRequest();
+    if (requestContainer->mQueuedTime > now)
+        m_requestQueue->PushDelayed(requestContainer);
+    else
+        m_requestQueue->Push(requestContainer);
+}
+
+void PlayFabRequestManager::ThreadFunction()
+{
+    // Every worker blocks in Pop until a request arrives, so nothing is polled while idle and a new request is picked up immediately.
+    // Pop only returns nullptr once the manager is shutting down.
+    while (PlayFabRequest* request = m_requestQueue->Pop())
+    {
+        // Blocking round trip (50-500 ms), then the result is handled on this worker as soon as it arrives.
+        // Each request completes independently, so callbacks fire in completion order rather than submission order.
+        // The callbacks may delete the request, so take what Complete needs first
+        PlayFabRequestPriority priority = request->mPriority;
+        request->mSentTime = AZStd::chrono::system_clock::now();
+        if (HandleRequest(request))
         {
-            auto request = resultsToHandle.front();
+            request->mCompletedTime = AZStd::chrono::system_clock::now();
+            RecordTiming(request);
             HandleResponse(request);
-            resultsToHandle.pop();
         }
         else
-            CrySleep(33); // Don't thrash this thread too hard when there's no requests active
+        {
+            // Shutting down, there is nobody left to report to
+            m_coalescer->Finish(request);
+            delete request;
+        }
+
+        m_requestQueue->Complete(priority);
     }
 }
 
-void PlayFabRequestManager::HandleRequest(PlayFabRequest* requestContainer)
+void PlayFabRequestManager::RecordTiming(PlayFabRequest* request)
 {
-    std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(Aws::Client::ClientConfiguration());
+    AZ::u64 queueWaitUs = request->GetQueueWaitMicroseconds();
+    AZ::u64 networkUs = request->GetNetworkMicroseconds();
+#if defined (PLAYFAB_DEBUG_HTTP_LOG)
+    AZ_TracePrintf("PlayFab", "*** PlayFab Timing - %s, queued: %llu us, network: %llu us", request->mURI.c_str(), static_cast<unsigned long long>(queueWaitUs), static_cast<unsigned long long>(networkUs));
+#endif
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+    m_timingStats.completedRequests++;
+    m_timingStats.totalQueueWaitUs += queueWaitUs;
+    m_timingStats.maxQueueWaitUs = AZStd::GetMax(m_timingStats.maxQueueWaitUs, queueWaitUs);
+    m_timingStats.totalNetworkUs += networkUs;
+    m_timingStats.maxNetworkUs = AZStd::GetMax(m_timingStats.maxNetworkUs, networkUs);
+}
+
+void PlayFabRequestManager::RecordTransferSizes(const AZStd::string& callPath, AZ::u64 requestBytes, AZ::u64 requestBytesSent, AZ::u64 responseBytes, AZ::u64 responseBytesReceived)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_statsMutex);
+    PlayFabCompressionStats& stats = m_compressionStats[callPath];
+    stats.requestBytes += requestBytes;
+    stats.requestBytesSent += requestBytesSent;
+    stats.responseBytes += responseBytes;
+    stats.responseBytesReceived += responseBytesReceived;
+}
+
+bool PlayFabRequestManager::HandleRequest(PlayFabRequest* requestContainer)
+{
+    // Reuse a keep-alive connection to the host when one is available, rather than paying a new connect and handshake per call
+    AZStd::string host = GetHostFromURI(requestContainer->mURI);
+    std::shared_ptr<Aws::Http::HttpClient> httpClient = m_clientPool->AcquireClient(host, requestContainer->mPriority);
+    if (!httpClient)
+        return false; // Shutting down
 
     auto httpRequest = Aws::Http::CreateHttpRequest(Aws::String(requestContainer->mURI.c_str()), requestContainer->mMethod, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
     // #THIRD_KIND_PLAYFAB_HTTP_DEBUGGING: Added debug logging and delay to http request manager
@@ -182,16 +609,38 @@ void PlayFabRequestManager::HandleRequest(PlayFabRequest* requestContainer)
     if (requestContainer->mAuthKey.length() > 0)
         httpRequest->SetHeaderValue(Aws::String(requestContainer->mAuthKey.c_str()), Aws::String(requestContainer->mAuthValue.c_str()));
 
-    auto sharedStream(Aws::MakeShared<Aws::StringStream>("PlayFabHttp AZStd::stringStream"));
-    *sharedStream << requestContainer->mRequestJsonBody.c_str();
-    httpRequest->AddContentBody(sharedStream);
-    httpRequest->SetContentLength(std::to_string(requestContainer->mRequestJsonBody.length()).c_str());
+    if (PlayFabSettings::playFabSettings->httpAcceptCompressedResponses)
+        httpRequest->SetHeaderValue("Accept-Encoding", PlayFabCompression::ContentEncoding);
+
+    // Large bodies are sent compressed, as long as that actually makes them smaller
+    const char* body = requestContainer->GetRequestBody();
+    size_t bodyLength = requestContainer->GetRequestBodySize();
+    AZStd::vector<char> compressedBody;
+    bool compressBody = PlayFabSettings::playFabSettings->httpCompressRequests
+        && bodyLength >= static_cast<size_t>(PlayFabSettings::playFabSettings->httpCompressionThreshold)
+        && PlayFabCompression::Deflate(body, bodyLength, compressedBody)
+        && compressedBody.size() < bodyLength;
+
+    // The http client reads the body from where it already is, both outlive MakeRequest below
+    const char* bodySent = body;
+    size_t bodySize = bodyLength;
+    if (compressBody)
+    {
+        httpRequest->SetHeaderValue("Content-Encoding", PlayFabCompression::ContentEncoding);
+        bodySent = compressedBody.data();
+        bodySize = compressedBody.size();
+    }
+    httpRequest->AddContentBody(Aws::MakeShared<PlayFabMemoryStream>("PlayFabHttp PlayFabMemoryStream", bodySent, bodySize));
+    httpRequest->SetContentLength(std::to_string(bodySize).c_str());
+    RecordTransferSizes(requestContainer->mCallPath, bodyLength, bodySize, 0, 0);
     requestContainer->httpResponse = httpClient->MakeRequest(*httpRequest);
+    m_clientPool->ReleaseClient(host, httpClient, PlayFabHttpClientPool::IsHealthyResponse(requestContainer->httpResponse));
+    return true;
 }
 
 void PlayFabRequestManager::HandleResponse(PlayFabRequest* requestContainer)
 {
-    if (!requestContainer || !requestContainer->httpResponse)
+    if (!requestContainer)
         return;
 
     // #THIRD_KIND_PLAYFAB_HTTP_DEBUGGING: Added debug logging and delay to http request manager
@@ -199,18 +648,89 @@ void PlayFabRequestManager::HandleResponse(PlayFabRequest* requestContainer)
     CrySleep(PLAYFAB_DEBUG_DELAY_RESPONSE);
 #endif
 
+    // With no response at all, mResponseSize stays 0 and the api callback reports a connection timeout
+    if (requestContainer->httpResponse)
+        ReadResponse(requestContainer);
+
+    // A retry is sent once both its backoff has passed and the rate limit allows it. If the rate limit would hold it too long, the original failure is reported instead, and the retry budget is left untouched.
+    int retryDelayMs = 0;
+    AZStd::chrono::system_clock::time_point retryTime;
+    if (m_retryPolicy->ShouldRetry(requestContainer, retryDelayMs)
+        && m_rateLimiter->Acquire(requestContainer->mCallPath, AZStd::chrono::system_clock::now() + AZStd::chrono::milliseconds(retryDelayMs), retryTime)
+        && m_retryPolicy->CommitRetry(requestContainer))
+    {
+#if defined (PLAYFAB_DEBUG_HTTP_LOG)
+        AZ_TracePrintf("PlayFab", "*** PlayFab Retry - %s, attempt %d in %d ms", requestContainer->mURI.c_str(), requestContainer->mRetryCount + 1, retryDelayMs);
+#endif
+        requestContainer->ResetResponse();
+        requestContainer->mRetryCount++;
+        requestContainer->mRetryDelayMs = retryDelayMs;
+        requestContainer->mQueuedTime = retryTime;
+        m_requestQueue->PushDelayed(requestContainer);
+        return;
+    }
+
+    m_retryPolicy->RecordResult(requestContainer);
+    requestContainer->mInternalCallback(requestContainer);
+}
+
+void PlayFabRequestManager::ReadResponse(PlayFabRequest* requestContainer)
+{
     requestContainer->mHttpCode = requestContainer->httpResponse->GetResponseCode();
     Aws::IOStream& responseStream = requestContainer->httpResponse->GetResponseBody();
     responseStream.seekg(0, std::ios_base::end);
     requestContainer->mResponseSize = responseStream.tellg();
     responseStream.seekg(0, std::ios_base::beg);
-    requestContainer->mResponseText = new char[requestContainer->mResponseSize + 1];
+    requestContainer->mResponseBufferPool = m_bufferPool;
+    requestContainer->mResponseText = m_bufferPool->Acquire(requestContainer->mResponseSize + 1, requestContainer->mResponseCapacity);
     responseStream.read(requestContainer->mResponseText, requestContainer->mResponseSize);
     requestContainer->mResponseText[requestContainer->mResponseSize] = '\0';
-    requestContainer->mResponseJson = new rapidjson::Document;
-    requestContainer->mResponseJson->Parse<0>(requestContainer->mResponseText);
+
+    // Only compressed if we asked for it with Accept-Encoding
+    int receivedSize = requestContainer->mResponseSize;
+    if (requestContainer->httpResponse->HasHeader("content-encoding")
+        && requestContainer->httpResponse->GetHeader("content-encoding") == PlayFabCompression::ContentEncoding)
+    {
+        AZStd::vector<char> decompressed;
+        if (!PlayFabCompression::Inflate(requestContainer->mResponseText, requestContainer->mResponseSize, decompressed))
+        {
+            // Nothing of a partial body can be trusted, so it is dropped and the api callback reports this error instead of decoding
+            RecordTransferSizes(requestContainer->mCallPath, 0, 0, 0, receivedSize);
+            requestContainer->ReleaseResponseBody();
+            requestContainer->mResponseSize = 0;
+            requestContainer->mError = new PlayFabError;
+            requestContainer->mError->HttpCode = static_cast<int>(requestContainer->mHttpCode);
+            requestContainer->mError->HttpStatus = "ResponseNotInflated";
+            requestContainer->mError->ErrorCode = PlayFabErrorResponseNotInflated;
+            requestContainer->mError->ErrorName = "ResponseNotInflated";
+            requestContainer->mError->ErrorMessage = "The compressed response for " + requestContainer->mCallPath + " was cut short or corrupt";
+            return;
+        }
+        m_bufferPool->Release(requestContainer->mResponseText, requestContainer->mResponseCapacity);
+        requestContainer->mResponseSize = static_cast<int>(decompressed.size());
+        requestContainer->mResponseText = m_bufferPool->Acquire(requestContainer->mResponseSize + 1, requestContainer->mResponseCapacity);
+        memcpy(requestContainer->mResponseText, decompressed.data(), decompressed.size());
+        requestContainer->mResponseText[requestContainer->mResponseSize] = '\0';
+    }
+    RecordTransferSizes(requestContainer->mCallPath, 0, 0, requestContainer->mResponseSize, receivedSize);
 #if defined (PLAYFAB_DEBUG_HTTP_LOG)
     AZ_TracePrintf("PlayFab", "*** PlayFab Response - %s %s, Response: %s", Aws::Http::HttpMethodMapper::GetNameForHttpMethod(requestContainer->mMethod), requestContainer->mURI.c_str(), requestContainer->mResponseText);
 #endif
-    requestContainer->mInternalCallback(requestContainer);
+
+    // Successful responses are parsed in place, so the Document's strings point into the buffer rather than being copied out of it.
+    // Error responses are parsed normally, as HandleErrorReport may need the intact text for the error message.
+    requestContainer->mResponseArena = m_arenaPool->Acquire();
+    if (requestContainer->mHttpCode == Aws::Http::HttpResponseCode::OK && (PlayFabSettings::playFabSettings->jsonStreamingDecode || requestContainer->mStreamResponse))
+    {
+        // Decoded straight from a token stream by readFromReader, with no Document built at all
+        requestContainer->mResponseReader = requestContainer->mResponseArena->reader;
+        requestContainer->mResponseReader->Parse(requestContainer->mResponseText);
+        return;
+    }
+
+    requestContainer->mResponseJson = requestContainer->mResponseArena->document;
+    if (requestContainer->mHttpCode == Aws::Http::HttpResponseCode::OK)
+        requestContainer->mResponseJson->ParseInsitu<0>(requestContainer->mResponseText);
+    else
+        requestContainer->mResponseJson->Parse<0>(requestContainer->mResponseText);
 }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabHttp.h>
+
+#include <aws/core/http/HttpClient.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabServerSdk
+{
+    // A bounded pool of keep-alive http clients, grouped per host.
+    // Every pooled client holds a single persistent connection, so handing the same client to the next request to that host skips the TCP connect and TLS handshake.
+    // Background requests never hold the last connection to a host, and a freed connection goes to the highest priority waiting for it,
+    // so a burst of background traffic cannot make a critical request queue behind it for a connection.
+    class PlayFabHttpClientPool
+    {
+    public:
+        PlayFabHttpClientPool(int maxConnectionsPerHost, int idleTimeoutMs);
+        ~PlayFabHttpClientPool();
+
+        // Take a connected client for the host, or open a new one. Blocks while every connection priority may use is busy,
+        // or while a request of higher priority is waiting for one.
+        std::shared_ptr<Aws::Http::HttpClient> AcquireClient(const AZStd::string& host, PlayFabRequestPriority priority);
+        // Hand a client back once its response has been received. Clients whose transport failed are closed instead of pooled.
+        void ReleaseClient(const AZStd::string& host, const std::shared_ptr<Aws::Http::HttpClient>& client, bool healthy);
+        // Wake any threads blocked in AcquireClient, and close all idle connections
+        void Shutdown();
+
+        PlayFabConnectionStats GetStats();
+
+        // Health check for a finished exchange: a missing response or response code means the connection is unusable
+        static bool IsHealthyResponse(const std::shared_ptr<Aws::Http::HttpResponse>& response);
+
+    private:
+        struct PooledClient
+        {
+            std::shared_ptr<Aws::Http::HttpClient> client;
+            AZStd::chrono::system_clock::time_point lastUsed;
+        };
+
+        struct HostPool
+        {
+            HostPool() : activeCount(0), waitingCount() {}
+
+            AZStd::vector<PooledClient> idleClients; // Most recently used at the back
+            int activeCount;
+            int waitingCount[PlayFabRequestPriorityCount]; // Threads blocked in AcquireClient, by priority
+        };
+
+        // Close connections which have been idle longer than the idle timeout. Caller must hold m_poolMutex.
+        void EvictIdleClients(AZStd::chrono::system_clock::time_point now);
+
+        const int m_maxConnectionsPerHost;
+        const int m_backgroundConnectionLimit; // One connection is kept for higher priorities, unless there is only one
+        const AZStd::chrono::milliseconds m_idleTimeout;
+
+        AZStd::unordered_map<AZStd::string, HostPool> m_hosts;
+        AZStd::mutex m_poolMutex;
+        AZStd::condition_variable m_clientReleased;
+        bool m_shutdown;
+
+        PlayFabConnectionStats m_stats;
+    };
+}
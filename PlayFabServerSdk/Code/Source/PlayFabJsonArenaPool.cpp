@@ -0,0 +1,119 @@
+#include "StdAfx.h"
+#include "PlayFabJsonArenaPool.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabServerSdk;
+
+PlayFabJsonArenaPool::PlayFabJsonArenaPool(int maxArenas)
+    : m_maxArenas(maxArenas > 0 ? maxArenas : 1)
+    , m_stats()
+{
+}
+
+PlayFabJsonArenaPool::~PlayFabJsonArenaPool()
+{
+    for (PlayFabJsonArena* arena : m_freeArenas)
+        DestroyArena(arena);
+}
+
+PlayFabJsonArena* PlayFabJsonArenaPool::Acquire()
+{
+    size_t bufferSize;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_stats.acquiredArenas++;
+        if (!m_freeArenas.empty())
+        {
+            PlayFabJsonArena* arena = m_freeArenas.back();
+            m_freeArenas.pop_back();
+            m_stats.reusedArenas++;
+            return arena;
+        }
+        bufferSize = GetTargetBytes();
+        m_stats.arenaBytes += bufferSize;
+    }
+
+    // Created outside the lock, other workers need not wait on it
+    return CreateArena(this, bufferSize);
+}
+
+void PlayFabJsonArenaPool::Release(PlayFabJsonArena* arena)
+{
+    if (arena == nullptr)
+        return;
+
+    size_t usedBytes = arena->allocator->Size();
+    arena->document->SetNull();
+    arena->allocator->Clear(); // Frees any overflow chunks, the fixed buffer stays
+    arena->reader->Clear();
+
+    bool keep;
+    bool resize;
+    size_t targetBytes;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_stats.highWaterBytes = AZStd::GetMax(m_stats.highWaterBytes, static_cast<AZ::u64>(usedBytes));
+        if (usedBytes > arena->bufferSize)
+            m_stats.overflowedArenas++;
+
+        // An arena smaller than the high-water mark is replaced, so the next large response fits without overflowing
+        targetBytes = GetTargetBytes();
+        keep = m_freeArenas.size() < m_maxArenas;
+        resize = keep && arena->bufferSize < targetBytes;
+        if (!keep || resize)
+            m_stats.arenaBytes -= arena->bufferSize;
+        if (resize)
+            m_stats.arenaBytes += targetBytes;
+    }
+
+    if (resize)
+    {
+        DestroyArena(arena);
+        arena = CreateArena(this, targetBytes);
+    }
+    else if (!keep)
+    {
+        DestroyArena(arena);
+        return;
+    }
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_freeArenas.push_back(arena);
+}
+
+PlayFabJsonArenaStats PlayFabJsonArenaPool::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+size_t PlayFabJsonArenaPool::GetTargetBytes() const
+{
+    size_t targetBytes = MinArenaBytes;
+    while (targetBytes < m_stats.highWaterBytes && targetBytes < MaxArenaBytes)
+        targetBytes *= 2;
+    return targetBytes;
+}
+
+PlayFabJsonArena* PlayFabJsonArenaPool::CreateArena(PlayFabJsonArenaPool* pool, size_t bufferSize)
+{
+    PlayFabJsonArena* arena = new PlayFabJsonArena;
+    arena->pool = pool;
+    arena->buffer = new char[bufferSize];
+    arena->bufferSize = bufferSize;
+    arena->allocator = new rapidjson::MemoryPoolAllocator<>(arena->buffer, bufferSize);
+    arena->document = new rapidjson::Document(arena->allocator);
+    arena->reader = new PlayFabJsonReader();
+    return arena;
+}
+
+void PlayFabJsonArenaPool::DestroyArena(PlayFabJsonArena* arena)
+{
+    delete arena->reader;
+    delete arena->document;
+    delete arena->allocator;
+    delete[] arena->buffer;
+    delete arena;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabHttp.h>
+#include <PlayFabServerSdk/PlayFabJsonReader.h>
+
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabServerSdk
+{
+    class PlayFabJsonArenaPool;
+
+    // A response Document, and the fixed buffer its allocator carves every value out of, or the reader for a streamed response
+    struct PlayFabJsonArena
+    {
+        PlayFabJsonArenaPool* pool; // Owner, which the arena goes back to once the response has been decoded
+        char* buffer;
+        size_t bufferSize;
+        rapidjson::MemoryPoolAllocator<>* allocator;
+        rapidjson::Document* document;
+        PlayFabJsonReader* reader; // Keeps its token storage between responses
+    };
+
+    // Recycled arenas for response Documents.
+    // Releasing an arena clears its allocator, which keeps the fixed buffer and only frees chunks added when a response outgrew it.
+    // The buffer size follows the largest Document seen so far, so once traffic has settled responses parse without allocating.
+    class PlayFabJsonArenaPool
+    {
+    public:
+        // Keep at most maxArenas free arenas, extra ones are freed on release
+        explicit PlayFabJsonArenaPool(int maxArenas);
+        ~PlayFabJsonArenaPool();
+
+        PlayFabJsonArena* Acquire();
+        // Give back an arena once nothing refers to its Document
+        void Release(PlayFabJsonArena* arena);
+
+        PlayFabJsonArenaStats GetStats();
+
+    private:
+        static const size_t MinArenaBytes = 64 * 1024;
+        static const size_t MaxArenaBytes = 4 * 1024 * 1024; // Larger Documents use overflow chunks rather than growing every arena to match
+
+        // Size for new arena buffers: the high-water mark rounded up to a power of two, within the limits. Caller must hold m_mutex.
+        size_t GetTargetBytes() const;
+        static PlayFabJsonArena* CreateArena(PlayFabJsonArenaPool* pool, size_t bufferSize);
+        static void DestroyArena(PlayFabJsonArena* arena);
+
+        const size_t m_maxArenas;
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<PlayFabJsonArena*> m_freeArenas;
+        PlayFabJsonArenaStats m_stats;
+    };
+}
@@ -11,12 +11,13 @@ void PlayFabMatchmakerApi::AuthUser(
     MatchmakerModels::AuthUserRequest& request,
     ProcessApiCallback<MatchmakerModels::AuthUserResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/AuthUser"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnAuthUserResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/AuthUser"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnAuthUserResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabMatchmakerApi::OnAuthUserResult(PlayFabRequest* request)
@@ -24,16 +25,10 @@ void PlayFabMatchmakerApi::OnAuthUserResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         MatchmakerModels::AuthUserResponse* outResult = new MatchmakerModels::AuthUserResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<MatchmakerModels::AuthUserResponse> successCallback = reinterpret_cast<ProcessApiCallback<MatchmakerModels::AuthUserResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -41,12 +36,13 @@ void PlayFabMatchmakerApi::PlayerJoined(
     MatchmakerModels::PlayerJoinedRequest& request,
     ProcessApiCallback<MatchmakerModels::PlayerJoinedResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/PlayerJoined"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnPlayerJoinedResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/PlayerJoined"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnPlayerJoinedResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabMatchmakerApi::OnPlayerJoinedResult(PlayFabRequest* request)
@@ -54,16 +50,10 @@ void PlayFabMatchmakerApi::OnPlayerJoinedResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         MatchmakerModels::PlayerJoinedResponse* outResult = new MatchmakerModels::PlayerJoinedResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<MatchmakerModels::PlayerJoinedResponse> successCallback = reinterpret_cast<ProcessApiCallback<MatchmakerModels::PlayerJoinedResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -71,12 +61,13 @@ void PlayFabMatchmakerApi::PlayerLeft(
     MatchmakerModels::PlayerLeftRequest& request,
     ProcessApiCallback<MatchmakerModels::PlayerLeftResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/PlayerLeft"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnPlayerLeftResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/PlayerLeft"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnPlayerLeftResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabMatchmakerApi::OnPlayerLeftResult(PlayFabRequest* request)
@@ -84,16 +75,10 @@ void PlayFabMatchmakerApi::OnPlayerLeftResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         MatchmakerModels::PlayerLeftResponse* outResult = new MatchmakerModels::PlayerLeftResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<MatchmakerModels::PlayerLeftResponse> successCallback = reinterpret_cast<ProcessApiCallback<MatchmakerModels::PlayerLeftResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -101,12 +86,13 @@ void PlayFabMatchmakerApi::StartGame(
     MatchmakerModels::StartGameRequest& request,
     ProcessApiCallback<MatchmakerModels::StartGameResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/StartGame"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnStartGameResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/StartGame"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnStartGameResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabMatchmakerApi::OnStartGameResult(PlayFabRequest* request)
@@ -114,16 +100,10 @@ void PlayFabMatchmakerApi::OnStartGameResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         MatchmakerModels::StartGameResponse* outResult = new MatchmakerModels::StartGameResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<MatchmakerModels::StartGameResponse> successCallback = reinterpret_cast<ProcessApiCallback<MatchmakerModels::StartGameResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -131,12 +111,13 @@ void PlayFabMatchmakerApi::UserInfo(
     MatchmakerModels::UserInfoRequest& request,
     ProcessApiCallback<MatchmakerModels::UserInfoResponse> callback,
     ErrorCallback errorCallback,
-    void* customData
+    void* customData,
+    PlayFabRequestPriority priority
 )
 {
 
-    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/UserInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request.toJSONString(), customData, callback, errorCallback, OnUserInfoResult);
-    PlayFabRequestManager::playFabHttp->AddRequest(newRequest);
+    PlayFabRequest* newRequest = new PlayFabRequest(PlayFabSettings::playFabSettings->getURL("/Matchmaker/UserInfo"), Aws::Http::HttpMethod::HTTP_POST, "X-SecretKey", PlayFabSettings::playFabSettings->developerSecretKey, request, customData, callback, errorCallback, OnUserInfoResult);
+    PlayFabRequestManager::playFabHttp->AddRequest(newRequest, priority);
 }
 
 void PlayFabMatchmakerApi::OnUserInfoResult(PlayFabRequest* request)
@@ -144,16 +125,10 @@ void PlayFabMatchmakerApi::OnUserInfoResult(PlayFabRequest* request)
     if (PlayFabBaseModel::DecodeRequest(request))
     {
         MatchmakerModels::UserInfoResponse* outResult = new MatchmakerModels::UserInfoResponse;
-        outResult->readFromValue(request->mResponseJson->FindMember("data")->value);
+        PlayFabBaseModel::ReadResult(request, *outResult);
 
 
-        if (request->mResultCallback != nullptr)
-        {
-            ProcessApiCallback<MatchmakerModels::UserInfoResponse> successCallback = reinterpret_cast<ProcessApiCallback<MatchmakerModels::UserInfoResponse>>(request->mResultCallback);
-            successCallback(*outResult, request->mCustomData);
-        }
-        delete outResult;
-        delete request;
+        PlayFabRequestManager::playFabHttp->DispatchResult(request, outResult);
     }
 }
 
@@ -0,0 +1,113 @@
+#include "StdAfx.h"
+#include "PlayFabRateLimiter.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabServerSdk;
+
+PlayFabRateLimiter::PlayFabRateLimiter(int maxDelayMs)
+    : m_maxDelayUs(AZStd::GetMax(0, maxDelayMs) * 1000LL)
+{
+}
+
+void PlayFabRateLimiter::SetTitleLimit(float ratePerSecond, float burst)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    Configure(m_titleBucket, ratePerSecond, burst);
+}
+
+void PlayFabRateLimiter::SetEndpointLimit(const AZStd::string& callPath, float ratePerSecond, float burst)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    Configure(m_endpointBuckets[callPath], ratePerSecond, burst);
+}
+
+bool PlayFabRateLimiter::Acquire(const AZStd::string& callPath, AZStd::chrono::system_clock::time_point now, AZStd::chrono::system_clock::time_point& sendTime)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    auto endpointIter = m_endpointBuckets.find(callPath);
+    Bucket* buckets[2] = { &m_titleBucket, endpointIter != m_endpointBuckets.end() ? &endpointIter->second : nullptr };
+
+    AZ::s64 waitUs = 0;
+    for (Bucket* bucket : buckets)
+    {
+        if (bucket == nullptr || bucket->ratePerSecond <= 0.0f)
+            continue;
+        Refill(*bucket, now);
+        waitUs = AZStd::GetMax(waitUs, GetWaitMicroseconds(*bucket));
+    }
+
+    // Only take tokens once both buckets have agreed, so a rejected request costs nothing
+    bool rejected = waitUs > m_maxDelayUs;
+    for (Bucket* bucket : buckets)
+    {
+        if (bucket == nullptr || bucket->ratePerSecond <= 0.0f)
+            continue;
+        if (rejected)
+            bucket->rejectedRequests++;
+        else
+        {
+            bucket->tokens -= 1.0f;
+            if (waitUs > 0)
+                bucket->delayedRequests++;
+        }
+    }
+
+    sendTime = now + AZStd::chrono::microseconds(waitUs);
+    return !rejected;
+}
+
+PlayFabRateLimitState PlayFabRateLimiter::GetTitleState()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    Refill(m_titleBucket, AZStd::chrono::system_clock::now());
+    return GetState(m_titleBucket);
+}
+
+PlayFabRateLimitState PlayFabRateLimiter::GetEndpointState(const AZStd::string& callPath)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    auto endpointIter = m_endpointBuckets.find(callPath);
+    if (endpointIter == m_endpointBuckets.end())
+        return GetState(Bucket());
+
+    Refill(endpointIter->second, AZStd::chrono::system_clock::now());
+    return GetState(endpointIter->second);
+}
+
+void PlayFabRateLimiter::Configure(Bucket& bucket, float ratePerSecond, float burst)
+{
+    bucket.ratePerSecond = AZStd::GetMax(0.0f, ratePerSecond);
+    bucket.burst = AZStd::GetMax(1.0f, burst);
+    bucket.tokens = bucket.burst;
+    bucket.lastRefill = AZStd::chrono::system_clock::now();
+}
+
+void PlayFabRateLimiter::Refill(Bucket& bucket, AZStd::chrono::system_clock::time_point now)
+{
+    if (bucket.ratePerSecond <= 0.0f || now <= bucket.lastRefill)
+        return;
+
+    AZ::s64 elapsedUs = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - bucket.lastRefill).count();
+    bucket.tokens = AZStd::GetMin(bucket.burst, bucket.tokens + bucket.ratePerSecond * static_cast<float>(elapsedUs) / 1000000.0f);
+    bucket.lastRefill = now;
+}
+
+AZ::s64 PlayFabRateLimiter::GetWaitMicroseconds(const Bucket& bucket)
+{
+    if (bucket.tokens >= 1.0f)
+        return 0;
+    return static_cast<AZ::s64>((1.0f - bucket.tokens) * 1000000.0f / bucket.ratePerSecond);
+}
+
+PlayFabRateLimitState PlayFabRateLimiter::GetState(const Bucket& bucket)
+{
+    PlayFabRateLimitState state;
+    state.ratePerSecond = bucket.ratePerSecond;
+    state.burst = bucket.burst;
+    state.tokens = bucket.tokens;
+    state.delayedRequests = bucket.delayedRequests;
+    state.rejectedRequests = bucket.rejectedRequests;
+    return state;
+}
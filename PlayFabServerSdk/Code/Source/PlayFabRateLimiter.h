@@ -0,0 +1,55 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabHttp.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace PlayFabServerSdk
+{
+    // Client side token buckets, one for the whole title and one per api path, which keep us under PlayFab's throttling limits
+    // without spending a round trip to find out. Every request takes a token from both its api's bucket and the title bucket.
+    // When a bucket is empty the request may still go ahead, borrowing a token and waiting until it has been refilled,
+    // unless that wait would be longer than the max delay, in which case the request is rejected.
+    class PlayFabRateLimiter
+    {
+    public:
+        explicit PlayFabRateLimiter(int maxDelayMs);
+
+        // Limit the whole title, or a single api path such as "/Server/WriteTitleEvent". A rate of 0 removes the limit.
+        void SetTitleLimit(float ratePerSecond, float burst);
+        void SetEndpointLimit(const AZStd::string& callPath, float ratePerSecond, float burst);
+
+        // Take a token for a request to the api, which may be sent no earlier than now.
+        // Returns false if the request should be rejected, otherwise sendTime is when it may be sent.
+        bool Acquire(const AZStd::string& callPath, AZStd::chrono::system_clock::time_point now, AZStd::chrono::system_clock::time_point& sendTime);
+
+        PlayFabRateLimitState GetTitleState();
+        PlayFabRateLimitState GetEndpointState(const AZStd::string& callPath);
+
+    private:
+        struct Bucket
+        {
+            Bucket() : ratePerSecond(0.0f), burst(0.0f), tokens(0.0f), delayedRequests(0), rejectedRequests(0) {}
+
+            float ratePerSecond; // 0 when unlimited
+            float burst;
+            float tokens; // Negative while requests are waiting on borrowed tokens
+            AZStd::chrono::system_clock::time_point lastRefill;
+            AZ::u64 delayedRequests;
+            AZ::u64 rejectedRequests;
+        };
+
+        static void Configure(Bucket& bucket, float ratePerSecond, float burst);
+        // Add the tokens earned since the last refill. Caller must hold m_mutex.
+        static void Refill(Bucket& bucket, AZStd::chrono::system_clock::time_point now);
+        // How long until the bucket will have a whole token, in microseconds. Caller must hold m_mutex.
+        static AZ::s64 GetWaitMicroseconds(const Bucket& bucket);
+        static PlayFabRateLimitState GetState(const Bucket& bucket);
+
+        const AZ::s64 m_maxDelayUs;
+
+        AZStd::mutex m_mutex;
+        Bucket m_titleBucket;
+        AZStd::unordered_map<AZStd::string, Bucket> m_endpointBuckets;
+    };
+}
@@ -0,0 +1,110 @@
+#include "StdAfx.h"
+#include "PlayFabRequestBodyPool.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabServerSdk;
+
+///////////////////// PlayFabRequestBodyPool /////////////////////
+PlayFabRequestBodyPool::PlayFabRequestBodyPool(int maxBodies)
+    : m_maxBodies(maxBodies > 0 ? maxBodies : 1)
+    , m_stats()
+{
+}
+
+PlayFabRequestBodyPool::~PlayFabRequestBodyPool()
+{
+    for (PlayFabRequestBody* body : m_freeBodies)
+        delete body;
+}
+
+PlayFabRequestBody* PlayFabRequestBodyPool::Acquire()
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_stats.acquiredBodies++;
+        if (!m_freeBodies.empty())
+        {
+            PlayFabRequestBody* body = m_freeBodies.back();
+            m_freeBodies.pop_back();
+            m_stats.reusedBodies++;
+            return body;
+        }
+    }
+
+    PlayFabRequestBody* body = new PlayFabRequestBody();
+    body->pool = this;
+    return body;
+}
+
+void PlayFabRequestBodyPool::Release(PlayFabRequestBody* body)
+{
+    if (body == nullptr)
+        return;
+    if (body->pool == nullptr)
+        delete body;
+    else
+        body->pool->ReleaseToPool(body);
+}
+
+void PlayFabRequestBodyPool::ReleaseToPool(PlayFabRequestBody* body)
+{
+    size_t bodySize = body->buffer.GetSize();
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_stats.largestBodyBytes = AZStd::GetMax(m_stats.largestBodyBytes, static_cast<AZ::u64>(bodySize));
+        if (m_freeBodies.size() < m_maxBodies && bodySize <= MaxPooledBytes)
+        {
+            body->buffer.Clear();
+            body->writer.Reset(body->buffer);
+            m_freeBodies.push_back(body);
+            return;
+        }
+        m_stats.freedBodies++;
+    }
+    delete body;
+}
+
+PlayFabRequestBodyStats PlayFabRequestBodyPool::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+///////////////////// PlayFabMemoryStream /////////////////////
+PlayFabMemoryStreamBuf::PlayFabMemoryStreamBuf(const char* data, size_t size)
+{
+    // Never written through, the get area only needs a non-const pointer to satisfy the streambuf interface
+    char* begin = const_cast<char*>(data);
+    setg(begin, begin, begin + size);
+}
+
+PlayFabMemoryStreamBuf::pos_type PlayFabMemoryStreamBuf::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in))
+        return pos_type(off_type(-1));
+
+    off_type base = 0;
+    if (direction == std::ios_base::cur)
+        base = gptr() - eback();
+    else if (direction == std::ios_base::end)
+        base = egptr() - eback();
+    return seekpos(pos_type(base + offset), which);
+}
+
+PlayFabMemoryStreamBuf::pos_type PlayFabMemoryStreamBuf::seekpos(pos_type position, std::ios_base::openmode which)
+{
+    off_type offset = off_type(position);
+    if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback())
+        return pos_type(off_type(-1));
+    setg(eback(), eback() + offset, egptr());
+    return position;
+}
+
+PlayFabMemoryStream::PlayFabMemoryStream(const char* data, size_t size)
+    : Aws::IOStream(nullptr)
+    , m_buffer(data, size)
+{
+    rdbuf(&m_buffer);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabHttp.h>
+
+#include <AzCore/JSON/writer.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <streambuf>
+
+namespace PlayFabServerSdk
+{
+    class PlayFabRequestBodyPool;
+
+    // A request body, and the writer which serializes a model straight into it
+    struct PlayFabRequestBody
+    {
+        PlayFabRequestBody() : pool(nullptr), writer(buffer) {}
+
+        PlayFabRequestBodyPool* pool; // Owner, which the body goes back to once the request is finished, or nullptr if it was allocated with new
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer; // Keeps its nesting stack between requests
+    };
+
+    // Recycled request bodies.
+    // Clearing a StringBuffer keeps its capacity, so once traffic has settled a request is serialized without allocating.
+    class PlayFabRequestBodyPool
+    {
+    public:
+        // Keep at most maxBodies free bodies, extra ones are freed on release
+        explicit PlayFabRequestBodyPool(int maxBodies);
+        ~PlayFabRequestBodyPool();
+
+        // A cleared body, with its writer ready for a new document
+        PlayFabRequestBody* Acquire();
+        // Give back a body once the request no longer needs it. Bodies from a nullptr pool are deleted.
+        static void Release(PlayFabRequestBody* body);
+
+        PlayFabRequestBodyStats GetStats();
+
+    private:
+        static const size_t MaxPooledBytes = 256 * 1024; // Bodies which grew past this are freed, rather than holding on to the memory for rare huge requests
+
+        void ReleaseToPool(PlayFabRequestBody* body);
+
+        const size_t m_maxBodies;
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<PlayFabRequestBody*> m_freeBodies;
+        PlayFabRequestBodyStats m_stats;
+    };
+
+    // Read only buffer over memory it does not own
+    class PlayFabMemoryStreamBuf
+        : public std::streambuf
+    {
+    public:
+        PlayFabMemoryStreamBuf(const char* data, size_t size);
+
+    protected:
+        pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+    };
+
+    // Stream handed to the http client as a request body, which reads the serialized text where it is rather than copying it into a StringStream.
+    // The memory must outlive the http request.
+    class PlayFabMemoryStream
+        : public Aws::IOStream
+    {
+    public:
+        PlayFabMemoryStream(const char* data, size_t size);
+
+    private:
+        PlayFabMemoryStreamBuf m_buffer;
+    };
+}
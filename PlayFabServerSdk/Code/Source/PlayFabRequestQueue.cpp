@@ -0,0 +1,139 @@
+#include "StdAfx.h"
+#include "PlayFabRequestQueue.h"
+
+#include <AzCore/std/parallel/lock.h>
+
+using namespace PlayFabServerSdk;
+
+PlayFabRequestQueue::PlayFabRequestQueue(int backgroundInFlightLimit, int backgroundMaxWaitMs)
+    : m_backgroundInFlightLimit(backgroundInFlightLimit > 0 ? backgroundInFlightLimit : 1)
+    , m_backgroundMaxWait(backgroundMaxWaitMs)
+    , m_delayedSequence(0)
+    , m_inFlightCount()
+    , m_shutdown(false)
+{
+}
+
+PlayFabRequestQueue::~PlayFabRequestQueue()
+{
+    for (auto& requests : m_requests)
+    {
+        while (!requests.empty())
+        {
+            delete requests.front();
+            requests.pop();
+        }
+    }
+    while (!m_delayedRequests.empty())
+    {
+        delete m_delayedRequests.top().request;
+        m_delayedRequests.pop();
+    }
+}
+
+void PlayFabRequestQueue::Push(PlayFabRequest* request)
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_requests[request->mPriority].push(request);
+    }
+    m_requestAdded.notify_one();
+}
+
+void PlayFabRequestQueue::PushDelayed(PlayFabRequest* request)
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_delayedRequests.push(DelayedRequest{ request->mQueuedTime, m_delayedSequence++, request });
+    }
+    // An idle worker may need to wake earlier than it planned to
+    m_requestAdded.notify_one();
+}
+
+PlayFabRequest* PlayFabRequestQueue::Pop()
+{
+    AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+    PlayFabRequest* request = nullptr;
+    while (!m_shutdown)
+    {
+        AZStd::chrono::system_clock::time_point nextDelayed = PromoteDelayedRequests(AZStd::chrono::system_clock::now());
+        request = TakeNextRequest();
+        if (request != nullptr)
+            break;
+
+        if (m_delayedRequests.empty())
+            m_requestAdded.wait(lock);
+        else
+            m_requestAdded.wait_until(lock, nextDelayed);
+    }
+
+    if (m_shutdown)
+        return nullptr;
+
+    m_inFlightCount[request->mPriority]++;
+    return request;
+}
+
+void PlayFabRequestQueue::Complete(PlayFabRequestPriority priority)
+{
+    bool backgroundWaiting;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_inFlightCount[priority]--;
+        backgroundWaiting = priority == PlayFabRequestPriorityBackground && !m_requests[PlayFabRequestPriorityBackground].empty();
+    }
+
+    // A worker may be idle only because the background limit was reached
+    if (backgroundWaiting)
+        m_requestAdded.notify_one();
+}
+
+void PlayFabRequestQueue::Shutdown()
+{
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_requestAdded.notify_all();
+}
+
+int PlayFabRequestQueue::GetPendingCount()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    int pendingCount = static_cast<int>(m_delayedRequests.size());
+    for (int i = 0; i < PlayFabRequestPriorityCount; ++i)
+        pendingCount += static_cast<int>(m_requests[i].size()) + m_inFlightCount[i];
+    return pendingCount;
+}
+
+PlayFabRequest* PlayFabRequestQueue::TakeNextRequest()
+{
+    AZStd::queue<PlayFabRequest*>& background = m_requests[PlayFabRequestPriorityBackground];
+    bool backgroundAllowed = !background.empty() && m_inFlightCount[PlayFabRequestPriorityBackground] < m_backgroundInFlightLimit;
+
+    int priority = 0;
+    if (backgroundAllowed && AZStd::chrono::system_clock::now() - background.front()->mQueuedTime >= m_backgroundMaxWait)
+        priority = PlayFabRequestPriorityBackground; // Aged out, so it goes before anything else
+    else
+    {
+        while (priority < PlayFabRequestPriorityBackground && m_requests[priority].empty())
+            priority++;
+        if (priority == PlayFabRequestPriorityBackground && !backgroundAllowed)
+            return nullptr;
+    }
+
+    PlayFabRequest* request = m_requests[priority].front();
+    m_requests[priority].pop();
+    return request;
+}
+
+AZStd::chrono::system_clock::time_point PlayFabRequestQueue::PromoteDelayedRequests(AZStd::chrono::system_clock::time_point now)
+{
+    while (!m_delayedRequests.empty() && m_delayedRequests.top().dueTime <= now)
+    {
+        PlayFabRequest* request = m_delayedRequests.top().request;
+        m_requests[request->mPriority].push(request);
+        m_delayedRequests.pop();
+    }
+    return m_delayedRequests.empty() ? AZStd::chrono::system_clock::time_point::max() : m_delayedRequests.top().dueTime;
+}
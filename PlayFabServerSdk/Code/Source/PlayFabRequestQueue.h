@@ -0,0 +1,65 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabHttp.h>
+
+#include <AzCore/std/containers/queue.h>
+
+namespace PlayFabServerSdk
+{
+    // The queue of requests waiting for a worker thread, one fifo per PlayFabRequestPriority.
+    // Idle workers block on a condition variable inside Pop, so they use no cpu while there is nothing to send, and Push wakes one of them immediately.
+    // Higher priorities are always taken first, with two exceptions which keep background traffic moving without letting it crowd out the rest:
+    //  - A background request which has waited longer than the max wait is taken ahead of everything else (aging)
+    //  - Background requests never occupy more than the background in-flight limit of the workers at once
+    // Delayed requests (retries waiting out their backoff) join their priority's fifo once their mQueuedTime is reached.
+    class PlayFabRequestQueue
+    {
+    public:
+        PlayFabRequestQueue(int backgroundInFlightLimit, int backgroundMaxWaitMs);
+        ~PlayFabRequestQueue(); // Deletes any requests which were never sent
+
+        // Queue a request and wake one idle worker
+        void Push(PlayFabRequest* request);
+        // Queue a request which may not be sent before its mQueuedTime
+        void PushDelayed(PlayFabRequest* request);
+        // Block until a request is available and take it, or return nullptr once the queue is shut down
+        PlayFabRequest* Pop();
+        // Mark a request returned by Pop as finished with, given the priority it was popped with (the request itself may already be deleted)
+        void Complete(PlayFabRequestPriority priority);
+        // Release every worker blocked in Pop
+        void Shutdown();
+
+        int GetPendingCount(); // Requests queued or in flight
+
+    private:
+        // Remove the next request to send, or return nullptr if none may be sent yet. Caller must hold m_mutex.
+        PlayFabRequest* TakeNextRequest();
+        // Move delayed requests which are due into their fifos, and return the time the next one is due. Caller must hold m_mutex.
+        AZStd::chrono::system_clock::time_point PromoteDelayedRequests(AZStd::chrono::system_clock::time_point now);
+
+        struct DelayedRequest
+        {
+            AZStd::chrono::system_clock::time_point dueTime;
+            AZ::u64 sequence; // Breaks ties between requests due at the same time, so they keep the order they were pushed in
+            PlayFabRequest* request;
+
+            // Inverted, so the priority_queue puts the earliest due at the top
+            bool operator<(const DelayedRequest& other) const
+            {
+                return dueTime != other.dueTime ? dueTime > other.dueTime : sequence > other.sequence;
+            }
+        };
+
+        const int m_backgroundInFlightLimit;
+        const AZStd::chrono::milliseconds m_backgroundMaxWait;
+
+        AZStd::queue<PlayFabRequest*> m_requests[PlayFabRequestPriorityCount];
+        AZStd::priority_queue<DelayedRequest> m_delayedRequests; // Min-heap on (mQueuedTime, push order)
+        AZ::u64 m_delayedSequence;
+        int m_inFlightCount[PlayFabRequestPriorityCount];
+        bool m_shutdown;
+
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_requestAdded;
+    };
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabHttp.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <random>
+
+namespace PlayFabServerSdk
+{
+    // Decides which failed requests are sent again, and when.
+    // Only idempotent apis are retried, and only for transient failures (no response, 408/429/5xx, or a PlayFab throttling error code).
+    // Delays use exponential backoff with decorrelated jitter, so clients recovering from the same outage do not retry in lockstep.
+    // Retries are paid for from a budget which every new request tops up by budgetPercent of one retry, so retries can never be more than that share of traffic.
+    class PlayFabRetryPolicy
+    {
+    public:
+        PlayFabRetryPolicy(int maxRetries, int baseDelayMs, int maxDelayMs, int budgetPercent);
+
+        // Apis which are safe to send twice: reads, logins and session checks, and heartbeats
+        static bool IsIdempotent(const AZStd::string& callPath);
+        // As above, but a login is only safe to send twice if its body does not ask for the account to be created
+        static bool IsIdempotent(PlayFabRequest* request);
+        // Whether the received response describes a failure which may succeed if sent again
+        static bool IsTransientFailure(PlayFabRequest* request);
+
+        // Call for every new request, to top up the retry budget
+        void OnNewRequest();
+        // Decide whether a request which has just received its response should be sent again, and if so set delayMs to the backoff before sending it.
+        // Nothing is taken from the budget until CommitRetry, so a retry the rate limiter then refuses costs nothing.
+        bool ShouldRetry(PlayFabRequest* request, int& delayMs);
+        // Take an approved retry from the budget and count it. Fails if other retries have spent the budget since ShouldRetry.
+        bool CommitRetry(PlayFabRequest* request);
+        // Call once a request is finished with. A retried request counts as recovered only if its final response succeeded.
+        void RecordResult(PlayFabRequest* request);
+
+        AZStd::unordered_map<AZStd::string, PlayFabRetryStats> GetStats(); // Keyed by api path
+
+    private:
+        // Decorrelated jitter: a random delay between the base delay and three times the previous delay, capped at the max delay. Caller must hold m_mutex.
+        int NextDelayMs(int previousDelayMs);
+
+        const int m_maxRetries;
+        const int m_baseDelayMs;
+        const int m_maxDelayMs;
+        const int m_budgetPercent;
+
+        AZStd::mutex m_mutex;
+        int m_budget; // In hundredths of a retry
+        std::mt19937 m_random;
+        AZStd::unordered_map<AZStd::string, PlayFabRetryStats> m_stats;
+    };
+}
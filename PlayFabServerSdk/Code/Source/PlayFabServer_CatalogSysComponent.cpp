@@ -0,0 +1,127 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabServer_CatalogSysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabCatalogCache.h"
+#include <PlayFabServerSdk/PlayFabLazyModel.h>
+
+namespace PlayFabServerSdk
+{
+    // Fetch results, delivered to the cache which is deleted only after the request manager. customData is the catalog version, allocated for the fetch.
+    static void OnCatalogFetched(const PlayFabLazyModel<ServerModels::GetCatalogItemsResult>& result, void* customData)
+    {
+        // Decoded straight into a model the cache takes the items from, rather than copying them out of a shared result
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        ServerModels::GetCatalogItemsResult decoded;
+        result.Decode(decoded);
+        PlayFabCatalogCache::catalogCache->ApplyFetchResult(*catalogVersion, AZStd::move(decoded.Catalog));
+        delete catalogVersion;
+    }
+
+    static void OnCatalogFetchFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        AZStd::string* catalogVersion = static_cast<AZStd::string*>(customData);
+        PlayFabCatalogCache::catalogCache->ApplyFetchFailure(*catalogVersion);
+        delete catalogVersion;
+    }
+
+    void PlayFabServer_CatalogSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabServer_CatalogSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabServer_CatalogSysComponent>("PlayFabServer_Catalog", "Provides cached, indexed catalogs within the PlayFab Server SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabServer_CatalogSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabServer_CatalogService"));
+    }
+
+    void PlayFabServer_CatalogSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabServer_CatalogService"));
+    }
+
+    void PlayFabServer_CatalogSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabServer_CatalogSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabServer_CatalogSysComponent::Init()
+    {
+    }
+
+    void PlayFabServer_CatalogSysComponent::Activate()
+    {
+        PlayFabServer_CatalogRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabServer_CatalogSysComponent::Deactivate()
+    {
+        PlayFabServer_CatalogRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabServer_CatalogSysComponent::FetchCatalog(const AZStd::string& catalogVersion)
+    {
+        ServerModels::GetCatalogItemsRequest request;
+        request.CatalogVersion = catalogVersion;
+
+        // Nothing is waiting on a refresh, the cache keeps serving the previous snapshot
+        PlayFabServerApi::GetCatalogItemsLazy(request, OnCatalogFetched, OnCatalogFetchFailed, new AZStd::string(catalogVersion), PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabServer_CatalogSysComponent::StartCatalogCache(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Start(catalogVersion);
+    }
+
+    void PlayFabServer_CatalogSysComponent::StopCatalogCache(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Stop(catalogVersion);
+    }
+
+    void PlayFabServer_CatalogSysComponent::RefreshCatalog(AZStd::string catalogVersion)
+    {
+        PlayFabCatalogCache::catalogCache->Refresh(catalogVersion);
+    }
+
+    void PlayFabServer_CatalogSysComponent::SetCatalogRefreshInterval(int seconds)
+    {
+        PlayFabCatalogCache::catalogCache->SetRefreshInterval(seconds);
+    }
+
+    PlayFabCatalogSnapshotPtr PlayFabServer_CatalogSysComponent::GetCatalogSnapshot(const char* catalogVersion)
+    {
+        return PlayFabCatalogCache::catalogCache->GetSnapshot(catalogVersion);
+    }
+
+    PlayFabCatalogCacheStats PlayFabServer_CatalogSysComponent::GetCatalogCacheStats(AZStd::string catalogVersion)
+    {
+        return PlayFabCatalogCache::catalogCache->GetStats(catalogVersion);
+    }
+}
@@ -0,0 +1,42 @@
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabServerSdk/PlayFabServer_Catalogbus.h>
+
+namespace PlayFabServerSdk
+{
+    class PlayFabServer_CatalogSysComponent
+        : public AZ::Component
+        , protected PlayFabServer_CatalogRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabServer_CatalogSysComponent, "{9C3DF7E4-CCFD-42F4-9B75-0B9DF4894562}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabCatalogCache::FetchFunction for this gem's apis
+        static bool FetchCatalog(const AZStd::string& catalogVersion);
+
+        void StartCatalogCache(AZStd::string catalogVersion) override;
+        void StopCatalogCache(AZStd::string catalogVersion) override;
+        void RefreshCatalog(AZStd::string catalogVersion) override;
+        void SetCatalogRefreshInterval(int seconds) override;
+        PlayFabCatalogSnapshotPtr GetCatalogSnapshot(const char* catalogVersion) override;
+        PlayFabCatalogCacheStats GetCatalogCacheStats(AZStd::string catalogVersion) override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
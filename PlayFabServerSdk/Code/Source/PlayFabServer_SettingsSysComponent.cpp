@@ -7,6 +7,7 @@
 #include "PlayFabServer_SettingsSysComponent.h"
 
 #include "PlayFabSettings.h"
+#include "PlayFabRateLimiter.h"
 
 namespace PlayFabServerSdk
 {
@@ -91,4 +92,25 @@ namespace PlayFabServerSdk
         return PlayFabSettings::playFabSettings->developerSecretKey;
     }
 
+    // Rate limit Section
+    void PlayFabServer_SettingsSysComponent::SetTitleRateLimit(float ratePerSecond, float burst)
+    {
+        PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetTitleLimit(ratePerSecond, burst);
+    }
+
+    void PlayFabServer_SettingsSysComponent::SetEndpointRateLimit(AZStd::string callPath, float ratePerSecond, float burst)
+    {
+        PlayFabRequestManager::playFabHttp->GetRateLimiter()->SetEndpointLimit(callPath, ratePerSecond, burst);
+    }
+
+    PlayFabRateLimitState PlayFabServer_SettingsSysComponent::GetTitleRateLimitState()
+    {
+        return PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetTitleState();
+    }
+
+    PlayFabRateLimitState PlayFabServer_SettingsSysComponent::GetEndpointRateLimitState(AZStd::string callPath)
+    {
+        return PlayFabRequestManager::playFabHttp->GetRateLimiter()->GetEndpointState(callPath);
+    }
+
 }
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabServerSdk/PlayFabServer_Statisticsbus.h>
+
+namespace PlayFabServerSdk
+{
+    class PlayFabServer_StatisticsSysComponent
+        : public AZ::Component
+        , protected PlayFabServer_StatisticsRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabServer_StatisticsSysComponent, "{9C3DF7E4-CCFD-42F4-9B75-0B9DF4894563}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabStatisticsAggregator::SendFunction for this gem's apis
+        static bool SendStatistics(ServerModels::UpdatePlayerStatisticsRequest& request);
+
+        void QueueStatisticUpdate(AZStd::string playFabId, ServerModels::StatisticUpdate update) override;
+        void SetStatisticAggregation(AZStd::string statisticName, AdminModels::StatisticAggregationMethod method) override;
+        void LoadStatisticAggregations() override;
+        void FlushStatistics(AZStd::string playFabId) override;
+        void FlushAllStatistics() override;
+        void SetStatisticsFlushInterval(int seconds) override;
+        PlayFabStatisticsAggregatorStats GetStatisticsAggregatorStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
@@ -0,0 +1,146 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabServer_TelemetrySysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabTelemetryPipeline.h"
+
+namespace PlayFabServerSdk
+{
+    // Delivered to the telemetry pipeline, which is deleted only after the request manager
+    static void OnTelemetryEventSent(const ServerModels::WriteEventResponse& result, void* customData)
+    {
+        (void)result;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(true);
+    }
+
+    static void OnTelemetryEventSendFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        (void)customData;
+        PlayFabTelemetryPipeline::telemetryPipeline->OnSendCompleted(false);
+    }
+
+    void PlayFabServer_TelemetrySysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabServer_TelemetrySysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabServer_TelemetrySysComponent>("PlayFabServer_Telemetry", "Buffers and rate limits telemetry events within the PlayFab Server SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabServer_TelemetrySysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabServer_TelemetryService"));
+    }
+
+    void PlayFabServer_TelemetrySysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabServer_TelemetryService"));
+    }
+
+    void PlayFabServer_TelemetrySysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabServer_TelemetrySysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabServer_TelemetrySysComponent::Init()
+    {
+    }
+
+    void PlayFabServer_TelemetrySysComponent::Activate()
+    {
+        PlayFabServer_TelemetryRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabServer_TelemetrySysComponent::Deactivate()
+    {
+        PlayFabServer_TelemetryRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabServer_TelemetrySysComponent::SendTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        switch (event.type)
+        {
+        case PlayFabTelemetryPlayerEvent:
+        {
+            ServerModels::WriteServerPlayerEventRequest request;
+            request.PlayFabId = AZStd::move(event.playFabId);
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabServerApi::WritePlayerEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryCharacterEvent:
+        {
+            ServerModels::WriteServerCharacterEventRequest request;
+            request.PlayFabId = AZStd::move(event.playFabId);
+            request.CharacterId = AZStd::move(event.characterId);
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabServerApi::WriteCharacterEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        case PlayFabTelemetryTitleEvent:
+        {
+            ServerModels::WriteTitleEventRequest request;
+            request.EventName = AZStd::move(event.eventName);
+            request.Timestamp = event.timestamp;
+            request.Body = AZStd::move(event.body);
+            PlayFabServerApi::WriteTitleEvent(AZStd::move(request), OnTelemetryEventSent, OnTelemetryEventSendFailed, nullptr, PlayFabRequestPriorityBackground);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    bool PlayFabServer_TelemetrySysComponent::QueueTelemetryEvent(PlayFabTelemetryEvent& event)
+    {
+        return PlayFabTelemetryPipeline::telemetryPipeline->Queue(event);
+    }
+
+    void PlayFabServer_TelemetrySysComponent::SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate)
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->SetDropPolicy(policy, sampleRate);
+    }
+
+    void PlayFabServer_TelemetrySysComponent::SetTelemetrySendRate(float eventsPerSecond)
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->SetSendRate(eventsPerSecond);
+    }
+
+    void PlayFabServer_TelemetrySysComponent::FlushTelemetry()
+    {
+        PlayFabTelemetryPipeline::telemetryPipeline->Flush();
+    }
+
+    PlayFabTelemetryStats PlayFabServer_TelemetrySysComponent::GetTelemetryStats()
+    {
+        return PlayFabTelemetryPipeline::telemetryPipeline->GetStats();
+    }
+}
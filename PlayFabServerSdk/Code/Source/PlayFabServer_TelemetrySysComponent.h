@@ -0,0 +1,40 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabServerSdk/PlayFabServer_Telemetrybus.h>
+
+namespace PlayFabServerSdk
+{
+    class PlayFabServer_TelemetrySysComponent
+        : public AZ::Component
+        , protected PlayFabServer_TelemetryRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabServer_TelemetrySysComponent, "{9C3DF7E4-CCFD-42F4-9B75-0B9DF4894565}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabTelemetryPipeline::SendFunction for this gem's apis
+        static bool SendTelemetryEvent(PlayFabTelemetryEvent& event);
+
+        bool QueueTelemetryEvent(PlayFabTelemetryEvent& event) override;
+        void SetTelemetryDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate) override;
+        void SetTelemetrySendRate(float eventsPerSecond) override;
+        void FlushTelemetry() override;
+        PlayFabTelemetryStats GetTelemetryStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
@@ -0,0 +1,123 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabServer_TitleDataSysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabTitleDataCache.h"
+
+namespace PlayFabServerSdk
+{
+    // Fetch results, delivered to the cache which is deleted only after the request manager
+    static void OnTitleDataFetched(const ServerModels::GetTitleDataResult& result, void* customData)
+    {
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchResult(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)), result.Data);
+    }
+
+    static void OnTitleDataFetchFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        PlayFabTitleDataCache::titleDataCache->ApplyFetchFailure(static_cast<PlayFabTitleDataSource>(reinterpret_cast<intptr_t>(customData)));
+    }
+
+    void PlayFabServer_TitleDataSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabServer_TitleDataSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabServer_TitleDataSysComponent>("PlayFabServer_TitleData", "Provides cached title data within the PlayFab Server SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabServer_TitleDataSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabServer_TitleDataService"));
+    }
+
+    void PlayFabServer_TitleDataSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabServer_TitleDataService"));
+    }
+
+    void PlayFabServer_TitleDataSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabServer_TitleDataSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabServer_TitleDataSysComponent::Init()
+    {
+    }
+
+    void PlayFabServer_TitleDataSysComponent::Activate()
+    {
+        PlayFabServer_TitleDataRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabServer_TitleDataSysComponent::Deactivate()
+    {
+        PlayFabServer_TitleDataRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabServer_TitleDataSysComponent::FetchTitleData(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys)
+    {
+        ServerModels::GetTitleDataRequest request;
+        request.Keys.assign(keys.begin(), keys.end());
+        void* customData = reinterpret_cast<void*>(static_cast<intptr_t>(source));
+
+        // Nothing is waiting on a refresh, the cache keeps serving the previous snapshot
+        if (source == PlayFabTitleDataPublic)
+            PlayFabServerApi::GetTitleData(request, OnTitleDataFetched, OnTitleDataFetchFailed, customData, PlayFabRequestPriorityBackground);
+        else
+            PlayFabServerApi::GetTitleInternalData(request, OnTitleDataFetched, OnTitleDataFetchFailed, customData, PlayFabRequestPriorityBackground);
+        return true;
+    }
+
+    void PlayFabServer_TitleDataSysComponent::StartTitleDataCache(PlayFabTitleDataSource source, AZStd::vector<AZStd::string> keys)
+    {
+        PlayFabTitleDataCache::titleDataCache->Start(source, keys);
+    }
+
+    void PlayFabServer_TitleDataSysComponent::StopTitleDataCache(PlayFabTitleDataSource source)
+    {
+        PlayFabTitleDataCache::titleDataCache->Stop(source);
+    }
+
+    void PlayFabServer_TitleDataSysComponent::RefreshTitleData(PlayFabTitleDataSource source)
+    {
+        PlayFabTitleDataCache::titleDataCache->Refresh(source);
+    }
+
+    void PlayFabServer_TitleDataSysComponent::SetTitleDataRefreshInterval(int seconds)
+    {
+        PlayFabTitleDataCache::titleDataCache->SetRefreshInterval(seconds);
+    }
+
+    PlayFabTitleDataSnapshotPtr PlayFabServer_TitleDataSysComponent::GetTitleDataSnapshot(PlayFabTitleDataSource source)
+    {
+        return PlayFabTitleDataCache::titleDataCache->GetSnapshot(source);
+    }
+
+    PlayFabTitleDataCacheStats PlayFabServer_TitleDataSysComponent::GetTitleDataCacheStats(PlayFabTitleDataSource source)
+    {
+        return PlayFabTitleDataCache::titleDataCache->GetStats(source);
+    }
+}
@@ -0,0 +1,145 @@
+
+#include "StdAfx.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+
+#include "PlayFabServer_UserDataSysComponent.h"
+
+#include "PlayFabServerApi.h"
+#include "PlayFabUserDataWriteBuffer.h"
+
+namespace PlayFabServerSdk
+{
+    // The customData of a buffered write, allocated for the request. Keeps the request as sent, so the buffer can queue its keys again if it fails.
+    struct UserDataSend
+    {
+        PlayFabUserDataKind kind;
+        ServerModels::UpdateUserDataRequest request;
+    };
+
+    // Delivered to the write buffer, which is deleted only after the request manager
+    static void OnUserDataSent(const ServerModels::UpdateUserDataResult& result, void* customData)
+    {
+        (void)result;
+        UserDataSend* send = static_cast<UserDataSend*>(customData);
+        PlayFabUserDataWriteBuffer::userDataWriteBuffer->OnSendCompleted(send->kind, send->request, true);
+        delete send;
+    }
+
+    static void OnUserDataSendFailed(const PlayFabError& error, void* customData)
+    {
+        (void)error;
+        UserDataSend* send = static_cast<UserDataSend*>(customData);
+        PlayFabUserDataWriteBuffer::userDataWriteBuffer->OnSendCompleted(send->kind, send->request, false);
+        delete send;
+    }
+
+    static ServerModels::UpdateUserInternalDataRequest ToInternalRequest(ServerModels::UpdateUserDataRequest& request)
+    {
+        ServerModels::UpdateUserInternalDataRequest internalRequest;
+        internalRequest.PlayFabId = AZStd::move(request.PlayFabId);
+        internalRequest.Data = AZStd::move(request.Data);
+        internalRequest.KeysToRemove = AZStd::move(request.KeysToRemove);
+        return internalRequest;
+    }
+
+    void PlayFabServer_UserDataSysComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PlayFabServer_UserDataSysComponent, AZ::Component>()
+                ->Version(0)
+                ->SerializerForEmptyClass();
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<PlayFabServer_UserDataSysComponent>("PlayFabServer_UserData", "Buffers and coalesces user data writes within the PlayFab Server SDK")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    // ->Attribute(AZ::Edit::Attributes::Category, "") Set a category
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ;
+            }
+        }
+    }
+
+    void PlayFabServer_UserDataSysComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC("PlayFabServer_UserDataService"));
+    }
+
+    void PlayFabServer_UserDataSysComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC("PlayFabServer_UserDataService"));
+    }
+
+    void PlayFabServer_UserDataSysComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        (void)required;
+    }
+
+    void PlayFabServer_UserDataSysComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        (void)dependent;
+    }
+
+    void PlayFabServer_UserDataSysComponent::Init()
+    {
+    }
+
+    void PlayFabServer_UserDataSysComponent::Activate()
+    {
+        PlayFabServer_UserDataRequestBus::Handler::BusConnect();
+    }
+
+    void PlayFabServer_UserDataSysComponent::Deactivate()
+    {
+        PlayFabServer_UserDataRequestBus::Handler::BusDisconnect();
+    }
+
+    bool PlayFabServer_UserDataSysComponent::SendUserData(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest& request)
+    {
+        UserDataSend* send = new UserDataSend();
+        send->kind = kind;
+        send->request = request;
+
+        switch (kind)
+        {
+        case PlayFabUserData: PlayFabServerApi::UpdateUserData(AZStd::move(request), OnUserDataSent, OnUserDataSendFailed, send, PlayFabRequestPriorityBackground); return true;
+        case PlayFabUserInternalData: PlayFabServerApi::UpdateUserInternalData(ToInternalRequest(request), OnUserDataSent, OnUserDataSendFailed, send, PlayFabRequestPriorityBackground); return true;
+        case PlayFabUserReadOnlyData: PlayFabServerApi::UpdateUserReadOnlyData(AZStd::move(request), OnUserDataSent, OnUserDataSendFailed, send, PlayFabRequestPriorityBackground); return true;
+        case PlayFabUserPublisherData: PlayFabServerApi::UpdateUserPublisherData(AZStd::move(request), OnUserDataSent, OnUserDataSendFailed, send, PlayFabRequestPriorityBackground); return true;
+        case PlayFabUserPublisherInternalData: PlayFabServerApi::UpdateUserPublisherInternalData(ToInternalRequest(request), OnUserDataSent, OnUserDataSendFailed, send, PlayFabRequestPriorityBackground); return true;
+        case PlayFabUserPublisherReadOnlyData: PlayFabServerApi::UpdateUserPublisherReadOnlyData(AZStd::move(request), OnUserDataSent, OnUserDataSendFailed, send, PlayFabRequestPriorityBackground); return true;
+        default:
+            delete send;
+            return false;
+        }
+    }
+
+    void PlayFabServer_UserDataSysComponent::QueueUserDataUpdate(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest request)
+    {
+        PlayFabUserDataWriteBuffer::userDataWriteBuffer->Queue(kind, request);
+    }
+
+    void PlayFabServer_UserDataSysComponent::FlushUserData(AZStd::string playFabId)
+    {
+        PlayFabUserDataWriteBuffer::userDataWriteBuffer->Flush(playFabId);
+    }
+
+    void PlayFabServer_UserDataSysComponent::FlushAllUserData()
+    {
+        PlayFabUserDataWriteBuffer::userDataWriteBuffer->FlushAll();
+    }
+
+    void PlayFabServer_UserDataSysComponent::SetUserDataFlushInterval(int seconds)
+    {
+        PlayFabUserDataWriteBuffer::userDataWriteBuffer->SetFlushInterval(seconds);
+    }
+
+    PlayFabUserDataWriteStats PlayFabServer_UserDataSysComponent::GetUserDataWriteStats()
+    {
+        return PlayFabUserDataWriteBuffer::userDataWriteBuffer->GetStats();
+    }
+}
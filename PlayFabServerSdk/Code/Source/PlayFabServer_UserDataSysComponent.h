@@ -0,0 +1,40 @@
+#pragma once
+
+#include <AzCore/Component/Component.h>
+
+#include <PlayFabServerSdk/PlayFabServer_UserDatabus.h>
+
+namespace PlayFabServerSdk
+{
+    class PlayFabServer_UserDataSysComponent
+        : public AZ::Component
+        , protected PlayFabServer_UserDataRequestBus::Handler
+    {
+    public:
+        AZ_COMPONENT(PlayFabServer_UserDataSysComponent, "{9C3DF7E4-CCFD-42F4-9B75-0B9DF4894564}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        // The PlayFabUserDataWriteBuffer::SendFunction for this gem's apis
+        static bool SendUserData(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest& request);
+
+        void QueueUserDataUpdate(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest request) override;
+        void FlushUserData(AZStd::string playFabId) override;
+        void FlushAllUserData() override;
+        void SetUserDataFlushInterval(int seconds) override;
+        PlayFabUserDataWriteStats GetUserDataWriteStats() override;
+
+    protected:
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::Component interface implementation
+        void Init() override;
+        void Activate() override;
+        void Deactivate() override;
+        ////////////////////////////////////////////////////////////////////////
+    };
+}
@@ -14,5 +14,33 @@ PlayFabSettings::PlayFabSettings() :
     titleId(), // You must set this value for PlayFab to work properly (Found in the Game Manager for your title, at the PlayFab Website)
     globalErrorHandler(nullptr),
     developerSecretKey(), // You must set this value for PlayFab to work properly (Found in the Game Manager for your title, at the PlayFab Website)
+    httpMaxConnections(16),
+    httpIdleTimeoutMs(60000),
+    httpWorkerThreads(0),
+    httpBackgroundMaxWaitMs(2000),
+    httpMaxRetries(3),
+    httpRetryBaseDelayMs(100),
+    httpRetryMaxDelayMs(5000),
+    httpRetryBudgetPercent(10),
+    httpCompressRequests(false),
+    httpCompressionThreshold(1024),
+    httpAcceptCompressedResponses(false),
+    jsonStreamingDecode(false),
+    rateLimitTitlePerSecond(0.0f),
+    rateLimitTitleBurst(10.0f),
+    rateLimitMaxDelayMs(1000),
+    callbacksOnMainThread(false),
+    callbackBudgetUs(2000),
+    titleDataRefreshSeconds(300),
+    catalogRefreshSeconds(600),
+    statisticsFlushSeconds(30),
+    userDataFlushSeconds(30),
+    userDataMaxKeysPerRequest(10),
+    telemetryCapacity(1024),
+    telemetryEventsPerSecond(20.0f),
+    telemetryMaxInFlight(4),
+    telemetryDropPolicy(0),
+    telemetrySampleRate(4),
+    shutdownFlushWaitMs(2000),
     serverURL()
 {};
@@ -19,6 +19,57 @@ namespace PlayFabServerSdk
         ErrorCallback globalErrorHandler;
         AZStd::string developerSecretKey; // You must set this value for PlayFab to work properly (Found in the Game Manager for your title, at the PlayFab Website)
 
+        // Http connection pooling and concurrency, read once when the request manager starts
+        int httpMaxConnections; // Upper bound on concurrent keep-alive connections per host
+        int httpIdleTimeoutMs; // Pooled connections left unused for longer than this are closed
+        int httpWorkerThreads; // Number of requests in flight at once, 0 picks a default from the core count. Never more than httpMaxConnections.
+        int httpBackgroundMaxWaitMs; // Background priority requests queued longer than this are sent ahead of higher priorities
+
+        // Automatic retry of idempotent apis after transient failures, read once when the request manager starts
+        int httpMaxRetries; // Resends per request, 0 disables retries
+        int httpRetryBaseDelayMs; // Shortest backoff before a resend
+        int httpRetryMaxDelayMs; // Longest backoff before a resend
+        int httpRetryBudgetPercent; // Retries are limited to this percentage of new requests, plus a small allowance for bursts
+
+        // Http body compression, read for every request
+        bool httpCompressRequests; // Send request bodies deflate compressed. Only enable this if the title's endpoint accepts Content-Encoding: deflate.
+        int httpCompressionThreshold; // Request bodies smaller than this many bytes are always sent uncompressed
+        bool httpAcceptCompressedResponses; // Ask for deflate compressed responses with Accept-Encoding. Off by default, a body which will not inflate fails its call with PlayFabErrorResponseNotInflated.
+
+        // Response decoding
+        bool jsonStreamingDecode; // Decode successful responses with the generated readFromReader methods, straight from the rapidjson SAX stream, rather than building a Document first
+
+        // Client side rate limiting, see PlayFabRateLimiter. Per api limits are set through the settings bus.
+        float rateLimitTitlePerSecond; // Requests per second for the whole title, 0 for no limit
+        float rateLimitTitleBurst; // Requests which may be sent at once after a quiet period
+        int rateLimitMaxDelayMs; // Requests which would have to wait longer than this for the rate limit are rejected, 0 rejects instead of delaying
+
+        // Callback delivery
+        bool callbacksOnMainThread; // Queue api callbacks and deliver them from the main thread tick, instead of on the http worker which received the response
+        int callbackBudgetUs; // Main thread time per tick for queued callbacks, any left over are delivered next tick. 0 delivers them all every tick.
+
+        // Title data cache, see PlayFabServer_TitleDataRequests
+        int titleDataRefreshSeconds; // How often cached title data is fetched again, read once when the cache starts
+
+        // Catalog cache, see PlayFabServer_CatalogRequests
+        int catalogRefreshSeconds; // How often cached catalogs are fetched again, read once when the cache starts
+
+        // Statistics aggregator, see PlayFabServer_StatisticsRequests
+        int statisticsFlushSeconds; // How long a player's statistic updates are merged before they are sent, read once when the aggregator starts
+
+        // User data write buffer, see PlayFabServer_UserDataRequests
+        int userDataFlushSeconds; // How long a player's user data changes are merged before they are sent, read once when the buffer starts
+        int userDataMaxKeysPerRequest; // Keys written and removed in one UpdateUser*Data call, which must not exceed the title's limit
+
+        // Telemetry pipeline, see PlayFabServer_TelemetryRequests
+        int telemetryCapacity; // Events the buffer holds, rounded up to a power of two, read once when the pipeline starts
+        float telemetryEventsPerSecond; // Write*Event calls the flusher makes per second
+        int telemetryMaxInFlight; // Write*Event calls waiting in the request manager at once, 0 for no limit
+        int telemetryDropPolicy; // A PlayFabTelemetryDropPolicy
+        int telemetrySampleRate; // One in this many new events is kept by PlayFabTelemetrySample
+
+        int shutdownFlushWaitMs; // How long shutdown waits for the final flush of the statistics, user data and telemetry buffers to be sent
+
         PlayFabSettings();
 
         AZStd::string getURL(const AZStd::string& callPath)
@@ -0,0 +1,251 @@
+#include "StdAfx.h"
+#include "PlayFabStatisticsAggregator.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+#include <limits>
+
+using namespace PlayFabServerSdk;
+
+PlayFabStatisticsAggregator* PlayFabStatisticsAggregator::statisticsAggregator = nullptr;
+
+namespace
+{
+    bool SameVersion(const ServerModels::StatisticUpdate& a, const ServerModels::StatisticUpdate& b)
+    {
+        return a.Version.notNull() == b.Version.notNull() && (a.Version.isNull() || a.Version.mValue == b.Version.mValue);
+    }
+}
+
+PlayFabStatisticsAggregator::PlayFabStatisticsAggregator(SendFunction sendFunction, int flushIntervalSeconds)
+    : m_sendFunction(sendFunction)
+    , m_flushIntervalSeconds(AZStd::GetMax(flushIntervalSeconds, 0))
+    , m_stats()
+{
+    AZ::TickBus::Handler::BusConnect();
+}
+
+PlayFabStatisticsAggregator::~PlayFabStatisticsAggregator()
+{
+    AZ::TickBus::Handler::BusDisconnect();
+
+    // The module flushes and waits for the calls before shutting the request manager down, so only updates queued after that, or held behind
+    // a call which did not complete within the wait, are lost
+    int pendingPlayers = GetStats().pendingPlayers;
+    if (pendingPlayers > 0)
+        AZ_TracePrintf("PlayFab", "*** PlayFab Statistics for %d players were still pending after the shutdown flush, and have not been sent", pendingPlayers);
+}
+
+void PlayFabStatisticsAggregator::Queue(const AZStd::string& playFabId, const ServerModels::StatisticUpdate& update)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_stats.queuedUpdates++;
+    Merge(m_players[playFabId.c_str()], update, false);
+}
+
+void PlayFabStatisticsAggregator::Merge(PlayerStatistics& player, const ServerModels::StatisticUpdate& update, bool olderThanPending)
+{
+    // Players stay while a call is in flight, so the flush interval starts from the first update after it as well as for a new player
+    if (player.statistics.empty())
+        player.firstQueuedTime = AZStd::chrono::system_clock::now();
+
+    for (ServerModels::StatisticUpdate& pending : player.statistics)
+    {
+        if (pending.StatisticName == update.StatisticName && SameVersion(pending, update))
+        {
+            PlayFabFlatMap<AdminModels::StatisticAggregationMethod>::const_iterator found = m_aggregations.find(update.StatisticName);
+            AdminModels::StatisticAggregationMethod method = found == m_aggregations.end() ? AdminModels::StatisticAggregationMethodLast : found->second;
+            pending.Value = olderThanPending ? Aggregate(method, update.Value, pending.Value) : Aggregate(method, pending.Value, update.Value);
+            return;
+        }
+    }
+    player.statistics.push_back(update);
+}
+
+void PlayFabStatisticsAggregator::SetAggregation(const AZStd::string& statisticName, AdminModels::StatisticAggregationMethod method)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_aggregations[statisticName] = method;
+}
+
+void PlayFabStatisticsAggregator::SetAggregations(const std::vector<AdminModels::PlayerStatisticDefinition>& definitions)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    for (const AdminModels::PlayerStatisticDefinition& definition : definitions)
+    {
+        if (definition.AggregationMethod.notNull())
+            m_aggregations[definition.StatisticName] = definition.AggregationMethod.mValue;
+    }
+}
+
+void PlayFabStatisticsAggregator::Flush(const AZStd::string& playFabId)
+{
+    AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest> outgoing;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        PlayFabFlatMap<PlayerStatistics>::iterator player = m_players.find(playFabId);
+        if (player == m_players.end())
+            return;
+        FlushPlayer(player->first, player->second, outgoing);
+    }
+    Send(outgoing);
+}
+
+void PlayFabStatisticsAggregator::FlushAll()
+{
+    AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest> outgoing;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        outgoing.reserve(m_players.size());
+        for (auto& player : m_players)
+            FlushPlayer(player.first, player.second, outgoing);
+    }
+    Send(outgoing);
+}
+
+void PlayFabStatisticsAggregator::SetFlushInterval(int seconds)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_flushIntervalSeconds = AZStd::GetMax(seconds, 0);
+}
+
+PlayFabStatisticsAggregatorStats PlayFabStatisticsAggregator::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabStatisticsAggregatorStats stats = m_stats;
+    for (const auto& player : m_players)
+    {
+        stats.pendingPlayers += !player.second.statistics.empty();
+        stats.pendingStatistics += static_cast<int>(player.second.statistics.size());
+    }
+    return stats;
+}
+
+void PlayFabStatisticsAggregator::Update(AZStd::chrono::system_clock::time_point now)
+{
+    AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest> outgoing;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const AZStd::chrono::seconds interval(m_flushIntervalSeconds);
+        for (PlayFabFlatMap<PlayerStatistics>::iterator player = m_players.begin(); player != m_players.end();)
+        {
+            if (!player->second.inFlight && !player->second.statistics.empty() && now - player->second.firstQueuedTime >= interval)
+                TakeRequest(player->first, player->second, outgoing);
+
+            // Players stay until their last call completes, so the next flush can wait for it
+            if (!player->second.inFlight && player->second.statistics.empty())
+                player = m_players.erase(player);
+            else
+                ++player;
+        }
+    }
+    Send(outgoing);
+}
+
+void PlayFabStatisticsAggregator::OnSendCompleted(const ServerModels::UpdatePlayerStatisticsRequest& request, bool succeeded)
+{
+    AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest> outgoing;
+    bool lost = false;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        PlayFabFlatMap<PlayerStatistics>::iterator found = m_players.find(request.PlayFabId);
+        if (!succeeded)
+            m_stats.failedRequests++;
+        if (found == m_players.end())
+            return;
+
+        PlayerStatistics& player = found->second;
+        player.inFlight = false;
+        if (succeeded)
+            player.failedSends = 0;
+        else if (++player.failedSends >= MaxSendAttempts)
+        {
+            player.failedSends = 0;
+            m_stats.lostStatistics += request.Statistics.size();
+            lost = true;
+        }
+        else
+        {
+            // Older than anything queued since, so a newer Last value wins, and Sum, Min and Max fold the failed value in
+            for (const ServerModels::StatisticUpdate& update : request.Statistics)
+                Merge(player, update, true);
+            m_stats.requeuedStatistics += request.Statistics.size();
+        }
+
+        if (player.flushRequested)
+            TakeRequest(found->first, player, outgoing);
+    }
+
+    if (lost)
+    {
+        AZ_TracePrintf("PlayFab", "*** PlayFab Statistics updates of %s failed to send %d times, and have been dropped", request.PlayFabId.c_str(), MaxSendAttempts);
+        PlayFabServer_StatisticsNotificationBus::Broadcast(&PlayFabServer_StatisticsNotifications::OnStatisticUpdatesLost, request.PlayFabId, request.Statistics);
+    }
+    Send(outgoing);
+}
+
+void PlayFabStatisticsAggregator::FlushPlayer(const AZStd::string& playFabId, PlayerStatistics& player, AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest>& outgoing)
+{
+    // Sending now could put two calls for the player in flight together, and the older one could land last
+    if (player.inFlight)
+        player.flushRequested = !player.statistics.empty();
+    else
+        TakeRequest(playFabId, player, outgoing);
+}
+
+void PlayFabStatisticsAggregator::TakeRequest(const AZStd::string& playFabId, PlayerStatistics& player, AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest>& outgoing)
+{
+    player.flushRequested = false;
+    if (player.statistics.empty())
+        return;
+
+    ServerModels::UpdatePlayerStatisticsRequest request;
+    request.PlayFabId = playFabId;
+    request.Statistics = AZStd::move(player.statistics);
+    player.statistics.clear();
+    player.inFlight = true;
+    outgoing.push_back(AZStd::move(request));
+}
+
+Int32 PlayFabStatisticsAggregator::Aggregate(AdminModels::StatisticAggregationMethod method, Int32 pending, Int32 value)
+{
+    switch (method)
+    {
+    case AdminModels::StatisticAggregationMethodMin: return AZStd::GetMin(pending, value);
+    case AdminModels::StatisticAggregationMethodMax: return AZStd::GetMax(pending, value);
+    case AdminModels::StatisticAggregationMethodSum:
+    {
+        // PlayFab adds the sent value to the stored one, so the pending value is the sum of the changes, held to the range a statistic can store
+        AZ::s64 sum = static_cast<AZ::s64>(pending) + value;
+        return static_cast<Int32>(AZStd::GetMax<AZ::s64>(AZStd::GetMin<AZ::s64>(sum, std::numeric_limits<Int32>::max()), std::numeric_limits<Int32>::min()));
+    }
+    case AdminModels::StatisticAggregationMethodLast:
+    default:
+        return value;
+    }
+}
+
+void PlayFabStatisticsAggregator::Send(AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest>& outgoing)
+{
+    // Sent outside the lock, as a request rejected by the rate limiter fails straight away
+    for (ServerModels::UpdatePlayerStatisticsRequest& request : outgoing)
+    {
+        size_t statisticCount = request.Statistics.size();
+        if (m_sendFunction(request))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_stats.sentRequests++;
+            m_stats.sentStatistics += statisticCount;
+        }
+        else
+            OnSendCompleted(request, false);
+    }
+}
+
+void PlayFabStatisticsAggregator::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+{
+    (void)deltaTime;
+    (void)time;
+    Update(AZStd::chrono::system_clock::now());
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabServer_Statisticsbus.h>
+#include <PlayFabServerSdk/PlayFabFlatMap.h>
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabServerSdk
+{
+    // Write-behind buffer for player statistics, see PlayFabServer_StatisticsRequests.
+    // Updates are merged per player, statistic and version as they are queued, so a player's updates since their last flush become
+    // one UpdatePlayerStatistics call, however many times each statistic changed. A player's next call waits for the previous one to complete,
+    // so a Last statistic cannot be overwritten by an older value landing late.
+    class PlayFabStatisticsAggregator
+        : private AZ::TickBus::Handler
+    {
+    public:
+        // Send the aggregated statistics of one player, which must end in OnSendCompleted with the request as it was sent.
+        // Returns false, leaving request as it was, if it could not be sent.
+        typedef bool(*SendFunction)(ServerModels::UpdatePlayerStatisticsRequest& request);
+
+        static PlayFabStatisticsAggregator* statisticsAggregator;
+
+        PlayFabStatisticsAggregator(SendFunction sendFunction, int flushIntervalSeconds);
+        ~PlayFabStatisticsAggregator();
+
+        void Queue(const AZStd::string& playFabId, const ServerModels::StatisticUpdate& update);
+        void SetAggregation(const AZStd::string& statisticName, AdminModels::StatisticAggregationMethod method);
+        void SetAggregations(const std::vector<AdminModels::PlayerStatisticDefinition>& definitions);
+        // Send the pending updates now, or for a player with a call in flight, as soon as it completes
+        void Flush(const AZStd::string& playFabId);
+        void FlushAll();
+        void SetFlushInterval(int seconds);
+        PlayFabStatisticsAggregatorStats GetStats();
+
+        // Send the statistics of every player whose flush interval has passed, and whose previous call has completed
+        void Update(AZStd::chrono::system_clock::time_point now);
+        // The statistics of a failed call are merged back into the pending ones by their methods, until the player's calls have failed MaxSendAttempts times in a row
+        void OnSendCompleted(const ServerModels::UpdatePlayerStatisticsRequest& request, bool succeeded);
+
+        static const int MaxSendAttempts = 3;
+
+    private:
+        struct PlayerStatistics
+        {
+            PlayerStatistics() : inFlight(false), flushRequested(false), failedSends(0) {}
+
+            std::vector<ServerModels::StatisticUpdate> statistics; // One per statistic and version, few enough that a search beats a map
+            AZStd::chrono::system_clock::time_point firstQueuedTime; // The flush interval runs from here
+            bool inFlight; // The player's last call has not completed
+            bool flushRequested; // An explicit flush arrived while inFlight, so the statistics go as soon as it completes
+            int failedSends; // Calls which have failed in a row
+        };
+
+        // Combine a pending value with a newer one, as PlayFab would for the statistic's method
+        static Int32 Aggregate(AdminModels::StatisticAggregationMethod method, Int32 pending, Int32 value);
+        // Merge update into the pending statistics of player, as older than any pending update of the same statistic and version if olderThanPending. Caller must hold m_mutex.
+        void Merge(PlayerStatistics& player, const ServerModels::StatisticUpdate& update, bool olderThanPending);
+
+        // Take the pending statistics of a player as a request now if nothing is in flight for them, otherwise once it completes. Caller must hold m_mutex.
+        void FlushPlayer(const AZStd::string& playFabId, PlayerStatistics& player, AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest>& outgoing);
+        void TakeRequest(const AZStd::string& playFabId, PlayerStatistics& player, AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest>& outgoing);
+
+        // Send the requests outside the lock
+        void Send(AZStd::vector<ServerModels::UpdatePlayerStatisticsRequest>& outgoing);
+
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        const SendFunction m_sendFunction;
+
+        AZStd::mutex m_mutex;
+        PlayFabFlatMap<PlayerStatistics> m_players; // Keyed by PlayFabId
+        PlayFabFlatMap<AdminModels::StatisticAggregationMethod> m_aggregations; // Keyed by statistic name
+        int m_flushIntervalSeconds;
+        PlayFabStatisticsAggregatorStats m_stats;
+    };
+}
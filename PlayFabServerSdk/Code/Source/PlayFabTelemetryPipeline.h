@@ -0,0 +1,81 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabServer_Telemetrybus.h>
+#include "PlayFabRingBuffer.h"
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/chrono/clocks.h>
+
+namespace PlayFabServerSdk
+{
+    // Bounded telemetry buffer and the flusher which sends from it, see PlayFabServer_TelemetryRequests.
+    // Game threads push events into a lock-free ring, and the flusher thread pops them and sends them at the send rate (a token bucket of one
+    // second's worth of events), never with more than maxInFlight of them waiting in the request manager. A burst of events therefore waits in
+    // the ring, or is dropped by the drop policy, rather than filling the request queue ahead of gameplay calls.
+    class PlayFabTelemetryPipeline
+    {
+    public:
+        // Send one event through the api of its type, which must end in OnSendCompleted. Returns false if it could not be sent.
+        typedef bool(*SendFunction)(PlayFabTelemetryEvent& event);
+
+        static PlayFabTelemetryPipeline* telemetryPipeline;
+
+        // maxInFlight of 0 does not limit the events in flight
+        PlayFabTelemetryPipeline(SendFunction sendFunction, int capacity, float eventsPerSecond, int maxInFlight, PlayFabTelemetryDropPolicy dropPolicy, int sampleRate);
+        ~PlayFabTelemetryPipeline();
+
+        // Start the flusher thread. Until then events are only sent by Update and Flush.
+        void StartFlusher();
+        // Stop and join the flusher thread, which must be done before the request manager is deleted
+        void StopFlusher();
+
+        bool Queue(PlayFabTelemetryEvent& event);
+        void SetDropPolicy(PlayFabTelemetryDropPolicy policy, int sampleRate);
+        void SetSendRate(float eventsPerSecond);
+        // Send waiting events now, ignoring the send rate but not the in flight limit. Returns true once none are left waiting.
+        // Events beyond the limit are sent by a later Update or Flush, after earlier ones complete.
+        bool Flush();
+        PlayFabTelemetryStats GetStats();
+
+        // Send as many waiting events as the send rate and the in flight limit allow
+        void Update(AZStd::chrono::system_clock::time_point now);
+        void OnSendCompleted(bool succeeded);
+
+    private:
+        static const int FlushPeriodMs = 50; // How often the flusher thread wakes to send
+        static const int SampleThresholdPercent = 75; // How full the ring is before PlayFabTelemetrySample starts leaving events out
+
+        void Send(PlayFabTelemetryEvent& event);
+        void FlusherFunction();
+
+        const SendFunction m_sendFunction;
+        PlayFabRingBuffer<PlayFabTelemetryEvent> m_ring;
+        const int m_maxInFlight;
+
+        // Read by every producer
+        AZStd::atomic<int> m_dropPolicy;
+        AZStd::atomic<int> m_sampleRate;
+        AZStd::atomic<AZ::u64> m_sampleCounter;
+
+        AZStd::atomic<AZ::u64> m_producedEvents;
+        AZStd::atomic<AZ::u64> m_sentEvents;
+        AZStd::atomic<AZ::u64> m_failedEvents;
+        AZStd::atomic<AZ::u64> m_droppedOldest;
+        AZStd::atomic<AZ::u64> m_droppedSampled;
+        AZStd::atomic<AZ::u64> m_droppedFull;
+        AZStd::atomic<int> m_inFlightEvents;
+
+        AZStd::mutex m_sendMutex; // Guards the token bucket, Update may be called from more than one thread
+        float m_eventsPerSecond;
+        float m_tokens;
+        AZStd::chrono::system_clock::time_point m_lastUpdateTime;
+
+        AZStd::mutex m_flusherMutex;
+        AZStd::condition_variable m_flusherWake;
+        bool m_stopping;
+        AZStd::thread m_flusher;
+    };
+}
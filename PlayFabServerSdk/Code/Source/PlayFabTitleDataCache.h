@@ -0,0 +1,70 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabTitleDataSnapshot.h>
+#include <PlayFabServerSdk/PlayFabBaseModel.h>
+#include "PlayFabSnapshotPublisher.h"
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabServerSdk
+{
+    // Title data kept in memory and refreshed in the background, see PlayFabServer_TitleDataRequests.
+    // Readers take a handle to the current snapshot. A refresh which changes anything builds a new snapshot and publishes it in place of the old one,
+    // so reads never take the cache's lock or allocate. A replaced snapshot is freed once the last reader holding it lets go.
+    class PlayFabTitleDataCache
+        : private AZ::TickBus::Handler
+    {
+    public:
+        // Send the api call for source, which must end in ApplyFetchResult or ApplyFetchFailure. Returns false if the gem has no api for source.
+        typedef bool(*FetchFunction)(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys);
+
+        static PlayFabTitleDataCache* titleDataCache;
+
+        PlayFabTitleDataCache(FetchFunction fetchFunction, int refreshIntervalSeconds);
+        ~PlayFabTitleDataCache();
+
+        void Start(PlayFabTitleDataSource source, const AZStd::vector<AZStd::string>& keys);
+        void Stop(PlayFabTitleDataSource source);
+        void Refresh(PlayFabTitleDataSource source);
+        void SetRefreshInterval(int seconds);
+
+        PlayFabTitleDataSnapshotPtr GetSnapshot(PlayFabTitleDataSource source) const
+        {
+            return m_sources[source].current.Get();
+        }
+        PlayFabTitleDataCacheStats GetStats(PlayFabTitleDataSource source);
+
+        // Start the fetches which are due
+        void Update(AZStd::chrono::system_clock::time_point now);
+        // Replace the values of source with a fetch result. Publishes a new snapshot and notifies PlayFabServer_TitleDataNotificationBus if any key changed.
+        void ApplyFetchResult(PlayFabTitleDataSource source, const PlayFabStringMap<AZStd::string>& data);
+        void ApplyFetchFailure(PlayFabTitleDataSource source);
+
+    private:
+        static const int FailureRetrySeconds = 30; // Delay before fetching again after an error, when the refresh interval is longer
+
+        struct SourceState
+        {
+            SourceState();
+
+            PlayFabSnapshotPublisher<PlayFabTitleDataSnapshot> current; // Only ever replaced, under m_mutex
+            bool active;
+            bool fetching; // At most one fetch per source is in flight
+            bool refreshRequested; // Fetch on the next update, rather than at nextRefreshTime
+            AZStd::vector<AZStd::string> keys; // Empty for every key
+            AZStd::chrono::system_clock::time_point nextRefreshTime;
+            PlayFabTitleDataCacheStats stats;
+        };
+
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        const FetchFunction m_fetchFunction;
+
+        AZStd::mutex m_mutex; // Guards everything but the reads of the current snapshots
+        SourceState m_sources[PlayFabTitleDataSourceCount];
+        int m_refreshIntervalSeconds;
+    };
+}
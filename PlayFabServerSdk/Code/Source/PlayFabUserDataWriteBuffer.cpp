@@ -0,0 +1,340 @@
+#include "StdAfx.h"
+#include "PlayFabUserDataWriteBuffer.h"
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace PlayFabServerSdk;
+
+PlayFabUserDataWriteBuffer* PlayFabUserDataWriteBuffer::userDataWriteBuffer = nullptr;
+
+namespace
+{
+    const int PermissionGroupCount = 3; // No permission, Private and Public, as one permission applies to every key of a request
+
+    int PermissionGroup(const Boxed<ServerModels::UserDataPermission>& permission)
+    {
+        if (permission.isNull())
+            return 0;
+        return permission.mValue == ServerModels::UserDataPermissionPrivate ? 1 : 2;
+    }
+
+    bool HasPermission(PlayFabUserDataKind kind)
+    {
+        return kind != PlayFabUserInternalData && kind != PlayFabUserPublisherInternalData;
+    }
+}
+
+PlayFabUserDataWriteBuffer::PlayFabUserDataWriteBuffer(SendFunction sendFunction, int flushIntervalSeconds, int maxKeysPerRequest)
+    : m_sendFunction(sendFunction)
+    , m_flushIntervalSeconds(AZStd::GetMax(flushIntervalSeconds, 0))
+    , m_maxKeysPerRequest(AZStd::GetMax(maxKeysPerRequest, 1))
+    , m_stats()
+{
+    AZ::TickBus::Handler::BusConnect();
+}
+
+PlayFabUserDataWriteBuffer::~PlayFabUserDataWriteBuffer()
+{
+    AZ::TickBus::Handler::BusDisconnect();
+
+    // The module flushes and waits for the requests before shutting the request manager down, so only changes queued after that, or held behind
+    // a request which did not complete within the wait, are lost
+    int pendingKeys = GetStats().pendingKeys;
+    if (pendingKeys > 0)
+        AZ_TracePrintf("PlayFab", "*** PlayFab User data changes to %d keys were still pending after the shutdown flush, and have not been sent", pendingKeys);
+}
+
+void PlayFabUserDataWriteBuffer::Queue(PlayFabUserDataKind kind, const ServerModels::UpdateUserDataRequest& request)
+{
+    if (kind < 0 || kind >= PlayFabUserDataKindCount)
+        return;
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_stats.queuedUpdates++;
+    PendingWrites& writes = m_players[request.PlayFabId].kinds[kind];
+    if (writes.keys.empty())
+        writes.firstQueuedTime = AZStd::chrono::system_clock::now();
+
+    PendingKey change;
+    change.remove = false;
+    if (HasPermission(kind))
+        change.permission = request.Permission;
+    for (const auto& entry : request.Data)
+    {
+        change.value = entry.second;
+        auto added = writes.keys.insert(PlayFabFlatMap<PendingKey>::value_type(entry.first, change));
+        if (!added.second)
+        {
+            added.first->second = change;
+            m_stats.coalescedKeys++;
+        }
+        // A new change gets every send attempt, whatever happened to the one it replaces
+        if (!writes.failedSends.empty())
+            writes.failedSends.erase(entry.first);
+    }
+
+    // After the writes, so a key in both is removed
+    PendingKey removal;
+    removal.remove = true;
+    for (const AZStd::string& key : request.KeysToRemove)
+    {
+        auto added = writes.keys.insert(PlayFabFlatMap<PendingKey>::value_type(key, removal));
+        if (!added.second)
+        {
+            added.first->second = removal;
+            m_stats.coalescedKeys++;
+        }
+        if (!writes.failedSends.empty())
+            writes.failedSends.erase(key);
+    }
+    m_stats.queuedKeys += request.Data.size() + request.KeysToRemove.size();
+}
+
+void PlayFabUserDataWriteBuffer::Flush(const AZStd::string& playFabId)
+{
+    AZStd::vector<Outgoing> outgoing;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        PlayFabFlatMap<PlayerWrites>::iterator player = m_players.find(playFabId);
+        if (player == m_players.end())
+            return;
+        for (int kind = 0; kind < PlayFabUserDataKindCount; ++kind)
+            FlushWrites(player->first, static_cast<PlayFabUserDataKind>(kind), player->second.kinds[kind], outgoing);
+    }
+    Send(outgoing);
+}
+
+void PlayFabUserDataWriteBuffer::FlushAll()
+{
+    AZStd::vector<Outgoing> outgoing;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (auto& player : m_players)
+        {
+            for (int kind = 0; kind < PlayFabUserDataKindCount; ++kind)
+                FlushWrites(player.first, static_cast<PlayFabUserDataKind>(kind), player.second.kinds[kind], outgoing);
+        }
+    }
+    Send(outgoing);
+}
+
+void PlayFabUserDataWriteBuffer::SetFlushInterval(int seconds)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    m_flushIntervalSeconds = AZStd::GetMax(seconds, 0);
+}
+
+PlayFabUserDataWriteStats PlayFabUserDataWriteBuffer::GetStats()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    PlayFabUserDataWriteStats stats = m_stats;
+    for (const auto& player : m_players)
+    {
+        int pendingKeys = 0;
+        for (const PendingWrites& writes : player.second.kinds)
+            pendingKeys += static_cast<int>(writes.keys.size());
+        stats.pendingPlayers += pendingKeys > 0;
+        stats.pendingKeys += pendingKeys;
+    }
+    return stats;
+}
+
+void PlayFabUserDataWriteBuffer::Update(AZStd::chrono::system_clock::time_point now)
+{
+    AZStd::vector<Outgoing> outgoing;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const AZStd::chrono::seconds interval(m_flushIntervalSeconds);
+        for (PlayFabFlatMap<PlayerWrites>::iterator player = m_players.begin(); player != m_players.end();)
+        {
+            for (int kind = 0; kind < PlayFabUserDataKindCount; ++kind)
+            {
+                PendingWrites& writes = player->second.kinds[kind];
+                if (!writes.keys.empty() && writes.inFlight == 0 && now - writes.firstQueuedTime >= interval)
+                    TakeRequests(player->first, static_cast<PlayFabUserDataKind>(kind), writes, outgoing);
+            }
+
+            // Players stay until their last requests complete, so the next flush can wait for them
+            if (IsIdle(player->second))
+                player = m_players.erase(player);
+            else
+                ++player;
+        }
+    }
+    Send(outgoing);
+}
+
+void PlayFabUserDataWriteBuffer::OnSendCompleted(PlayFabUserDataKind kind, const ServerModels::UpdateUserDataRequest& request, bool succeeded)
+{
+    AZStd::vector<Outgoing> outgoing;
+    AZStd::vector<AZStd::string> lostKeys;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (!succeeded)
+            m_stats.failedRequests++;
+        PlayFabFlatMap<PlayerWrites>::iterator player = m_players.find(request.PlayFabId);
+        if (player == m_players.end() || kind < 0 || kind >= PlayFabUserDataKindCount)
+            return;
+
+        PendingWrites& writes = player->second.kinds[kind];
+        writes.inFlight = AZStd::GetMax(writes.inFlight - 1, 0);
+        if (succeeded)
+        {
+            if (!writes.failedSends.empty())
+            {
+                for (const auto& entry : request.Data)
+                    writes.failedSends.erase(entry.first);
+                for (const AZStd::string& key : request.KeysToRemove)
+                    writes.failedSends.erase(key);
+            }
+        }
+        else
+        {
+            PendingKey change;
+            change.remove = false;
+            if (HasPermission(kind))
+                change.permission = request.Permission;
+            for (const auto& entry : request.Data)
+            {
+                change.value = entry.second;
+                Requeue(entry.first, change, writes, lostKeys);
+            }
+            PendingKey removal;
+            removal.remove = true;
+            for (const AZStd::string& key : request.KeysToRemove)
+                Requeue(key, removal, writes, lostKeys);
+            m_stats.lostKeys += lostKeys.size();
+        }
+
+        if (writes.inFlight == 0 && writes.flushRequested)
+            TakeRequests(player->first, kind, writes, outgoing);
+    }
+
+    if (!lostKeys.empty())
+    {
+        AZ_TracePrintf("PlayFab", "*** PlayFab User data changes to %d keys of %s failed to send %d times, and have been dropped", static_cast<int>(lostKeys.size()), request.PlayFabId.c_str(), MaxSendAttempts);
+        PlayFabServer_UserDataNotificationBus::Broadcast(&PlayFabServer_UserDataNotifications::OnUserDataWriteLost, kind, request.PlayFabId, lostKeys);
+    }
+    Send(outgoing);
+}
+
+void PlayFabUserDataWriteBuffer::Requeue(const AZStd::string& key, const PendingKey& change, PendingWrites& writes, AZStd::vector<AZStd::string>& lostKeys)
+{
+    // A newer change has been queued, and is what PlayFab should end up with
+    if (writes.keys.find(key) != writes.keys.end())
+    {
+        writes.failedSends.erase(key);
+        return;
+    }
+
+    int& failures = writes.failedSends[key.c_str()];
+    if (++failures >= MaxSendAttempts)
+    {
+        writes.failedSends.erase(key);
+        lostKeys.push_back(key);
+        return;
+    }
+
+    // The flush interval runs again from here, which spaces out the attempts
+    if (writes.keys.empty())
+        writes.firstQueuedTime = AZStd::chrono::system_clock::now();
+    writes.keys.insert(PlayFabFlatMap<PendingKey>::value_type(key, change));
+    m_stats.requeuedKeys++;
+}
+
+void PlayFabUserDataWriteBuffer::TakeRequests(const AZStd::string& playFabId, PlayFabUserDataKind kind, PendingWrites& writes, AZStd::vector<Outgoing>& outgoing)
+{
+    writes.flushRequested = false;
+    if (writes.keys.empty())
+        return;
+
+    const size_t first = outgoing.size();
+    const size_t maxKeys = static_cast<size_t>(m_maxKeysPerRequest);
+    for (int group = 0; group < PermissionGroupCount; ++group)
+    {
+        size_t current = outgoing.size();
+        for (auto& entry : writes.keys)
+        {
+            PendingKey& key = entry.second;
+            if (key.remove || PermissionGroup(key.permission) != group)
+                continue;
+            if (current == outgoing.size() || outgoing[current].request.Data.size() >= maxKeys)
+            {
+                current = outgoing.size();
+                Outgoing request;
+                request.kind = kind;
+                request.request.PlayFabId = playFabId;
+                request.request.Permission = key.permission;
+                outgoing.push_back(AZStd::move(request));
+            }
+            outgoing[current].request.Data[entry.first] = AZStd::move(key.value);
+        }
+    }
+
+    // Removals fill the room left in the requests for the writes, then any more requests they need
+    size_t current = first;
+    for (auto& entry : writes.keys)
+    {
+        if (!entry.second.remove)
+            continue;
+        while (current < outgoing.size() && outgoing[current].request.Data.size() + outgoing[current].request.KeysToRemove.size() >= maxKeys)
+            ++current;
+        if (current == outgoing.size())
+        {
+            Outgoing request;
+            request.kind = kind;
+            request.request.PlayFabId = playFabId;
+            outgoing.push_back(AZStd::move(request));
+        }
+        outgoing[current].request.KeysToRemove.push_back(entry.first);
+    }
+
+    int requestCount = static_cast<int>(outgoing.size() - first);
+    writes.keys.clear();
+    writes.inFlight += requestCount;
+    m_stats.splitRequests += requestCount - 1;
+}
+
+void PlayFabUserDataWriteBuffer::FlushWrites(const AZStd::string& playFabId, PlayFabUserDataKind kind, PendingWrites& writes, AZStd::vector<Outgoing>& outgoing)
+{
+    // Sending now could put two writes to a key in flight together, and the older one could land last
+    if (writes.inFlight > 0)
+        writes.flushRequested = !writes.keys.empty();
+    else
+        TakeRequests(playFabId, kind, writes, outgoing);
+}
+
+bool PlayFabUserDataWriteBuffer::IsIdle(const PlayerWrites& player)
+{
+    for (const PendingWrites& writes : player.kinds)
+    {
+        if (!writes.keys.empty() || writes.inFlight > 0)
+            return false;
+    }
+    return true;
+}
+
+void PlayFabUserDataWriteBuffer::Send(AZStd::vector<Outgoing>& outgoing)
+{
+    // Sent outside the lock, as a request rejected by the rate limiter fails straight away
+    for (Outgoing& entry : outgoing)
+    {
+        size_t keyCount = entry.request.Data.size() + entry.request.KeysToRemove.size();
+        if (m_sendFunction(entry.kind, entry.request))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_stats.sentRequests++;
+            m_stats.sentKeys += keyCount;
+        }
+        else
+            OnSendCompleted(entry.kind, entry.request, false);
+    }
+}
+
+void PlayFabUserDataWriteBuffer::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+{
+    (void)deltaTime;
+    (void)time;
+    Update(AZStd::chrono::system_clock::now());
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <PlayFabServerSdk/PlayFabServer_UserDatabus.h>
+#include <PlayFabServerSdk/PlayFabFlatMap.h>
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PlayFabServerSdk
+{
+    // Write-behind buffer for user data, see PlayFabServer_UserDataRequests.
+    // Pending changes are kept per player and kind, one per key, so a key changed many times between flushes is sent once.
+    // A flush becomes as few UpdateUser*Data calls as the keys per call limit and the permissions of the keys allow.
+    class PlayFabUserDataWriteBuffer
+        : private AZ::TickBus::Handler
+    {
+    public:
+        // Send one request through the api of kind, which must end in OnSendCompleted with the request as it was sent.
+        // Returns false, leaving request as it was, if it could not be sent.
+        typedef bool(*SendFunction)(PlayFabUserDataKind kind, ServerModels::UpdateUserDataRequest& request);
+
+        static PlayFabUserDataWriteBuffer* userDataWriteBuffer;
+
+        PlayFabUserDataWriteBuffer(SendFunction sendFunction, int flushIntervalSeconds, int maxKeysPerRequest);
+        ~PlayFabUserDataWriteBuffer();
+
+        void Queue(PlayFabUserDataKind kind, const ServerModels::UpdateUserDataRequest& request);
+        // Send the pending changes now, or for a player and kind with requests in flight, as soon as the last of them completes
+        void Flush(const AZStd::string& playFabId);
+        void FlushAll();
+        void SetFlushInterval(int seconds);
+        PlayFabUserDataWriteStats GetStats();
+
+        // Send the changes of every player and kind whose flush interval has passed, and whose previous flush has completed
+        void Update(AZStd::chrono::system_clock::time_point now);
+        // The keys of a failed request are queued again, unless a newer change to them has been queued since, until they have failed MaxSendAttempts times
+        void OnSendCompleted(PlayFabUserDataKind kind, const ServerModels::UpdateUserDataRequest& request, bool succeeded);
+
+        static const int MaxSendAttempts = 3;
+
+    private:
+        struct PendingKey
+        {
+            bool remove; // Removal rather than a write of value
+            AZStd::string value;
+            Boxed<ServerModels::UserDataPermission> permission;
+        };
+
+        struct PendingWrites
+        {
+            PendingWrites() : inFlight(0), flushRequested(false) {}
+
+            PlayFabFlatMap<PendingKey> keys;
+            AZStd::chrono::system_clock::time_point firstQueuedTime; // The flush interval runs from here
+            int inFlight; // Requests of the last flush which have not completed
+            PlayFabFlatMap<int> failedSends; // How many times the pending or in flight change to a key has failed to send
+            bool flushRequested; // An explicit flush arrived while inFlight, so the keys go as soon as it reaches 0
+        };
+
+        struct PlayerWrites
+        {
+            PendingWrites kinds[PlayFabUserDataKindCount];
+        };
+
+        struct Outgoing
+        {
+            PlayFabUserDataKind kind;
+            ServerModels::UpdateUserDataRequest request;
+        };
+
+        // Turn the pending changes of one player and kind into requests of at most m_maxKeysPerRequest keys, and clear them
+        void TakeRequests(const AZStd::string& playFabId, PlayFabUserDataKind kind, PendingWrites& writes, AZStd::vector<Outgoing>& outgoing);
+        // TakeRequests now if nothing is in flight for the player and kind, otherwise once it completes
+        void FlushWrites(const AZStd::string& playFabId, PlayFabUserDataKind kind, PendingWrites& writes, AZStd::vector<Outgoing>& outgoing);
+        static bool IsIdle(const PlayerWrites& player);
+        // Queue a failed change again, unless a newer one has replaced it or it has failed too often, in which case it is added to lostKeys
+        void Requeue(const AZStd::string& key, const PendingKey& change, PendingWrites& writes, AZStd::vector<AZStd::string>& lostKeys);
+
+        // Send the requests outside the lock
+        void Send(AZStd::vector<Outgoing>& outgoing);
+
+        // AZ::TickBus::Handler
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        const SendFunction m_sendFunction;
+
+        AZStd::mutex m_mutex;
+        PlayFabFlatMap<PlayerWrites> m_players; // Keyed by PlayFabId
+        int m_flushIntervalSeconds;
+        const int m_maxKeysPerRequest;
+        PlayFabUserDataWriteStats m_stats;
+    };
+}